@@ -26,12 +26,14 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <typeinfo>
 
 #include <assert.h>
 #include <config.h>
 
 #include <libCERTI/M_Classes.hh>
 #include <libCERTI/NM_Classes.hh>
+#include <libCERTI/PeerRoutes.hh>
 #include <libCERTI/PrettyDebug.hh>
 #include <libCERTI/SecureTCPSocket.hh>
 #include <libCERTI/SocketHTTPProxy.hh>
@@ -65,13 +67,13 @@ NetworkMessage* Communications::waitMessage(NetworkMessage::Type type_msg, Feder
 
     // Otherwise, wait for a message with same type than expected and with
     // same federate number.
-    msg = NM_Factory::receive(socketTCP);
+    msg = receiveFromRTIG();
 
     Debug(D, pdProtocol) << "TCP Message of Type " << static_cast<int>(type_msg) << "has arrived." << std::endl;
 
     while ((msg->getMessageType() != type_msg) || ((numeroFedere != 0) && (msg->getFederate() != numeroFedere))) {
         waitingList.push_back(msg);
-        msg = NM_Factory::receive(socketTCP);
+        msg = receiveFromRTIG();
         Debug(D, pdProtocol) << "Message of Type " << static_cast<int>(type_msg) << " has arrived." << std::endl;
     }
 
@@ -136,6 +138,23 @@ Communications::Communications(int RTIA_port, int RTIA_fd)
 
     socketTCP->createConnection(certihost, atoi(tcp_port));
     socketUDP->createConnection(certihost, atoi(udp_port));
+
+#ifdef CERTI_USE_IO_URING
+    // a proxy or a secure socket transforms what it receives
+    if (typeid(*socketTCP) == typeid(SocketTCP)) {
+        rtigRing = IoUring::create(8, 32);
+    }
+    if (rtigRing) {
+        rtigRing->receive(socketTCP->returnSocket(), 0);
+        rtigRing->submit();
+        Debug(D, pdInit) << "Receiving from RTIG through io_uring" << std::endl;
+    }
+#endif
+
+    if (PeerNetwork::isEnabledFromEnvironment()) {
+        // the fences go before the message sendMessage is sending
+        peerNetwork.reset(new PeerNetwork([this](NetworkMessage& fence) { fence.send(socketTCP, NM_msgBufSend); }));
+    }
 }
 
 Communications::~Communications()
@@ -145,6 +164,10 @@ Communications::~Communications()
 
     NM_Close_Connexion closeMsg;
     closeMsg.send(socketTCP, NM_msgBufSend);
+#ifdef CERTI_USE_IO_URING
+    // its receive holds the connection open
+    rtigRing.reset();
+#endif
     socketTCP->close();
 
     delete socketUN;
@@ -183,7 +206,7 @@ void Communications::readMessage(Communications::ReadResult& n,
                                  Message** msg,
                                  struct timeval* timeout)
 {
-    const int tcp_fd(socketTCP->returnSocket());
+    const int tcp_fd(getRTIGDescriptor());
     const int udp_fd(socketUDP->returnSocket());
 
     int max_fd = 0; // not used for _WIN32
@@ -195,6 +218,14 @@ void Communications::readMessage(Communications::ReadResult& n,
         FD_SET(udp_fd, &fdset);
 #ifndef _WIN32
         max_fd = std::max(max_fd, std::max(tcp_fd, udp_fd));
+#endif
+    }
+    if (msg_reseau && peerNetwork) {
+        const int peer_fd = peerNetwork->watch(fdset);
+#ifndef _WIN32
+        max_fd = std::max(max_fd, peer_fd);
+#else
+        (void) peer_fd;
 #endif
     }
     if (msg) {
@@ -220,10 +251,10 @@ void Communications::readMessage(Communications::ReadResult& n,
         waitingList.pop_front();
         n = ReadResult::FromNetwork;
     }
-    else if (msg_reseau && socketTCP->isDataReady()) {
+    else if (msg_reseau && isRTIGDataReady()) {
         // Datas are in TCP waiting buffer.
         // Read a message from RTIG TCP link.
-        *msg_reseau = NM_Factory::receive(socketTCP);
+        *msg_reseau = receiveFromRTIG();
         n = ReadResult::FromNetwork;
     }
     else if (msg_reseau && socketUDP->isDataReady()) {
@@ -232,6 +263,10 @@ void Communications::readMessage(Communications::ReadResult& n,
         *msg_reseau = NM_Factory::receive(socketUDP);
         n = ReadResult::FromNetwork;
     }
+    else if (msg_reseau && peerNetwork && (*msg_reseau = peerNetwork->receive(nullptr))) {
+        // Datas are in the buffer of a peer link.
+        n = ReadResult::FromPeer;
+    }
     else if (msg && socketUN->isDataReady()) {
         // Datas are in UNIX waiting buffer.
         // Read a message from federate UNIX link.
@@ -242,10 +277,12 @@ void Communications::readMessage(Communications::ReadResult& n,
 // waitingList is empty and no data in TCP buffer.
 // Wait a message (coming from federate or network).
 #ifdef _WIN32
-        if (select(max_fd, &fdset, NULL, NULL, timeout) < 0) {
+        const int ready = select(max_fd, &fdset, NULL, NULL, timeout);
+        if (ready < 0) {
             if (WSAGetLastError() == WSAEINTR)
 #else
-        if (select(max_fd + 1, &fdset, NULL, NULL, timeout) < 0) {
+        const int ready = select(max_fd + 1, &fdset, NULL, NULL, timeout);
+        if (ready < 0) {
             if (errno == EINTR)
 #endif
             {
@@ -269,21 +306,30 @@ void Communications::readMessage(Communications::ReadResult& n,
         }
 #endif
 
-        if (FD_ISSET(socketTCP->returnSocket(), &fdset)) {
+        if (FD_ISSET(tcp_fd, &fdset)) {
             // Read a message coming from the TCP link with RTIG.
-            *msg_reseau = NM_Factory::receive(socketTCP);
-            n = ReadResult::FromNetwork;
+            *msg_reseau = receiveReadyFromRTIG();
+            // nullptr if part of a message only was received
+            n = *msg_reseau ? ReadResult::FromNetwork : ReadResult::Invalid;
         }
         else if (FD_ISSET(socketUDP->returnSocket(), &fdset)) {
             // Read a message coming from the UDP link with RTIG.
             *msg_reseau = NM_Factory::receive(socketUDP);
             n = ReadResult::FromNetwork;
         }
+        else if (msg_reseau && peerNetwork && (*msg_reseau = peerNetwork->receive(&fdset))) {
+            // Read a message coming from a peer RTIA.
+            n = ReadResult::FromPeer;
+        }
         else if (FD_ISSET(socketUN->returnSocket(), &fdset)) {
             // Read a message coming from the federate.
             *msg = M_Factory::receive(socketUN);
             n = ReadResult::FromFederate;
         }
+        else if (ready != 0) {
+            // a peer connected or left, nothing to read
+            n = ReadResult::Invalid;
+        }
         else {
             // select() timeout occured
             n = ReadResult::Timeout;
@@ -291,6 +337,99 @@ void Communications::readMessage(Communications::ReadResult& n,
     }
 }
 
+NetworkMessage* Communications::receiveFromRTIG()
+{
+#ifdef CERTI_USE_IO_URING
+    if (rtigRing) {
+        while (!rtigFrames.hasMessage()) {
+            reapRTIG(true);
+        }
+        return acknowledge(rtigFrames.takeMessage().release());
+    }
+#endif
+    return acknowledge(NM_Factory::receive(socketTCP));
+}
+
+NetworkMessage* Communications::receiveReadyFromRTIG()
+{
+#ifdef CERTI_USE_IO_URING
+    if (rtigRing) {
+        reapRTIG(false);
+        return acknowledge(rtigFrames.takeMessage().release());
+    }
+#endif
+    return acknowledge(NM_Factory::receive(socketTCP));
+}
+
+NetworkMessage* Communications::acknowledge(NetworkMessage* msg)
+{
+    if (peerNetwork && msg && msg->getMessageType() == NetworkMessage::Type::PEER_ROUTES_INVALIDATED) {
+        Debug(D, pdProtocol) << "Peer routes invalidated, answering RTIG" << std::endl;
+        std::unique_ptr<NetworkMessage> answer(peerNetwork->acknowledge());
+        sendMessage(answer.get());
+    }
+    return msg;
+}
+
+bool Communications::isRTIGDataReady()
+{
+#ifdef CERTI_USE_IO_URING
+    if (rtigRing) {
+        if (!rtigFrames.hasMessage()) {
+            reapRTIG(false);
+        }
+        return rtigFrames.hasMessage();
+    }
+#endif
+    return socketTCP->isDataReady();
+}
+
+int Communications::getRTIGDescriptor() const
+{
+#ifdef CERTI_USE_IO_URING
+    if (rtigRing) {
+        return rtigRing->descriptor();
+    }
+#endif
+    return socketTCP->returnSocket();
+}
+
+#ifdef CERTI_USE_IO_URING
+void Communications::reapRTIG(const bool wait)
+{
+    if (wait && !rtigRing->wait(-1)) {
+        throw NetworkSignal("EINTR on io_uring wait");
+    }
+
+    bool rearm{false};
+    rtigRing->reap([this, &rearm](const IoUring::Completion& completion) {
+        if (completion.result > 0) {
+            rtigFrames.append(completion.bytes, completion.result);
+            rearm = rearm || !completion.more;
+        }
+        else if (completion.result == -ENOBUFS) {
+            rearm = true;
+        }
+        else if (completion.result == 0) {
+            throw NetworkError("Connection closed by client.");
+        }
+        else {
+            throw NetworkError("Error while receiving TCP message.");
+        }
+    });
+
+    if (rearm) {
+        rtigRing->receive(socketTCP->returnSocket(), 0);
+        rtigRing->submit();
+    }
+}
+#endif
+
+PeerNetwork* Communications::peers()
+{
+    return peerNetwork.get();
+}
+
 bool Communications::searchMessage(NetworkMessage::Type type_msg, FederateHandle numeroFedere, NetworkMessage** msg)
 {
     list<NetworkMessage*>::iterator i;
@@ -313,6 +452,15 @@ bool Communications::searchMessage(NetworkMessage::Type type_msg, FederateHandle
 
 void Communications::sendMessage(NetworkMessage* Msg)
 {
+    if (peerNetwork) {
+        if (!PeerRoutes::keepsRoutes(Msg->getMessageType())) {
+            peerNetwork->invalidate();
+        }
+        // the peers read what was sent to them directly first
+        if (PeerRoutes::fencesPeers(Msg->getMessageType())) {
+            peerNetwork->close();
+        }
+    }
     Msg->send(socketTCP, NM_msgBufSend);
 }
 
@@ -24,6 +24,7 @@
 #define _CERTI_COMMUNICATIONS_HH
 
 #include <list>
+#include <memory>
 
 #include <include/certi.hh>
 
@@ -32,9 +33,15 @@
 #include <libCERTI/SocketTCP.hh>
 #include <libCERTI/SocketUDP.hh>
 #include <libCERTI/SocketUN.hh>
+
+#include "PeerNetwork.hh"
 #ifdef FEDERATION_USES_MULTICAST
 #include <libCERTI/SocketMC.hh>
 #endif
+#ifdef CERTI_USE_IO_URING
+#include <libCERTI/FrameBuffer.hh>
+#include <libCERTI/IoUring.hh>
+#endif
 
 namespace certi {
 namespace rtia {
@@ -46,13 +53,15 @@ namespace rtia {
 class Communications {
 public:
     
-    enum class ReadResult { Invalid, FromNetwork, FromFederate, Timeout };
+    enum class ReadResult { Invalid, FromNetwork, FromPeer, FromFederate, Timeout };
     
     Communications(int RTIA_port, int RTIA_fd);
     ~Communications();
 
     /**
      * Send a message to RTIG.
+     * The peer routes are forgotten if the RTIG may change the routing processing it,
+     * and the peers sent to directly are fenced if they must read it after.
      * @param[in] Msg the message to be sent
      */
     void sendMessage(NetworkMessage* Msg);
@@ -72,8 +81,8 @@ public:
     Message* receiveUN();
 
     /**
-     * Read some message from either network (RTIG/RTIA) or federate (RTIA/Federate).
-     * Returns the actual source in the 1st parameter (RTIG=>1 federate=>2)
+     * Read some message from either network (RTIG/RTIA), peer RTIAs or federate (RTIA/Federate).
+     * Returns the actual source in the 1st parameter
      * @param[out] n result of the operation
      * @param[out] msg_reseau pointer to pointer to network message
      * @param[out] msg pointer to pointer to message
@@ -93,6 +102,9 @@ public:
      */
     NetworkMessage* waitMessage(NetworkMessage::Type type_msg, FederateHandle numeroFedere);
 
+    /// Links with the peer RTIAs, nullptr unless CERTI_PEER_TO_PEER is set.
+    PeerNetwork* peers();
+
 protected:
     MessageBuffer NM_msgBufSend;
     MessageBuffer msgBufSend;
@@ -103,6 +115,7 @@ protected:
 #endif
     SocketTCP* socketTCP;
     SocketUDP* socketUDP;
+    std::unique_ptr<PeerNetwork> peerNetwork;
 
 private:
     /** This is the wait list of message already received from RTIG
@@ -117,6 +130,37 @@ private:
      * returns RTI_FALSE.
      */
     bool searchMessage(NetworkMessage::Type type_msg, FederateHandle numeroFedere, NetworkMessage** msg);
+
+    /// Block until a message is received from RTIG, and return it.
+    NetworkMessage* receiveFromRTIG();
+
+    /** Once the descriptor of RTIG is readable, receive a message from RTIG.
+     * Returns NULL if part of a message only was received yet.
+     */
+    NetworkMessage* receiveReadyFromRTIG();
+
+    /** Answer at once msg, received from RTIG, if it invalidates the peer routes.
+     * The RTIG holds the request which invalidated them until then, the
+     * RTIA may be waiting for its own answer. Returns msg.
+     */
+    NetworkMessage* acknowledge(NetworkMessage* msg);
+
+    /// Returns true if a message received from RTIG is waiting to be read.
+    bool isRTIGDataReady();
+
+    /// Descriptor watched by select for the messages of RTIG.
+    int getRTIGDescriptor() const;
+
+#ifdef CERTI_USE_IO_URING
+    /** Append what rtigRing received from RTIG to rtigFrames, once a
+     * completion is there if wait.
+     */
+    void reapRTIG(const bool wait);
+
+    /// Receives from socketTCP when it is a plain TCP socket, nullptr otherwise
+    std::unique_ptr<IoUring> rtigRing;
+    FrameBuffer rtigFrames;
+#endif
 };
 }
 } // namespace certi/rtia
@@ -26,6 +26,8 @@
 #include <cassert>
 #include <memory>
 
+#include <include/make_unique.hh>
+
 #include <libCERTI/FedRegion.hh>
 #include <libCERTI/Interaction.hh>
 #include <libCERTI/InteractionSet.hh>
@@ -77,13 +79,13 @@ SpaceHandle DataDistribution::getAttributeSpace(AttributeHandle attribute, Objec
     throw(ObjectClassNotDefined, AttributeNotDefined)
 {
     std::cout << "DataDistribution::getAttributeSpace" << std::endl;
-    return rootObject->ObjectClasses->getObjectFromHandle(object_class)->getAttribute(attribute)->getSpace();
+    return rootObject->getCompiledFom()->getAttributeSpace(object_class, attribute);
 }
 
 SpaceHandle DataDistribution::getInteractionSpace(InteractionClassHandle interaction) const
     throw(InteractionClassNotDefined)
 {
-    return rootObject->Interactions->getObjectFromHandle(interaction)->getSpace();
+    return rootObject->getCompiledFom()->getInteractionClass(interaction).space;
 }
 
 long DataDistribution::createRegion(SpaceHandle space,
@@ -123,22 +125,118 @@ void DataDistribution::modifyRegion(RegionHandle handle, const std::vector<Exten
     // check region
     RTIRegion* region = rootObject->getRegion(handle);
 
-    // Request to RTIG
-    NM_DDM_Modify_Region req;
+    // the RTIG has the extents of the first modification, kept to roll back to
+    acceptedExtents.emplace(handle, region->getExtents());
+    region->replaceExtents(extents);
+    modifiedRegions.insert(handle);
 
-    req.setFederation(fm->getFederationHandle().get());
-    req.setFederate(fm->getFederateHandle());
-    req.setRegion(handle);
-    req.setExtents(extents);
+    e = Exception::Type::NO_EXCEPTION;
+    Debug(D, pdDebug) << "Modified region " << handle << endl;
+}
 
-    comm->sendMessage(&req);
-    std::unique_ptr<NetworkMessage> rep(comm->waitMessage(NetworkMessage::Type::DDM_MODIFY_REGION, req.getFederate()));
-    e = rep->getException();
+void DataDistribution::commitRegionModifications()
+{
+    auto req = takeRegionModifications();
+    if (req) {
+        comm->sendMessage(req.get());
+    }
+}
 
-    if (e == Exception::Type::NO_EXCEPTION) {
-        region->replaceExtents(extents);
-        Debug(D, pdDebug) << "Modified region " << handle << endl;
+std::unique_ptr<NM_DDM_Modify_Regions> DataDistribution::takeRegionModifications()
+{
+    if (modifiedRegions.empty()) {
+        return nullptr;
+    }
+
+    auto req = make_unique<NM_DDM_Modify_Regions>();
+
+    req->setFederation(fm->getFederationHandle().get());
+    req->setFederate(fm->getFederateHandle());
+    req->setRegionsSize(modifiedRegions.size());
+    req->setExtentCountsSize(modifiedRegions.size());
+    req->setRangeCountsSize(modifiedRegions.size());
+
+    std::map<RegionHandle, std::vector<Extent>> sent;
+    uint32_t i{0u};
+    for (const auto& handle : modifiedRegions) {
+        const auto& extents = rootObject->getRegion(handle)->getExtents();
+        const uint32_t ranges = extents.empty() ? 0 : extents.front().size();
+
+        req->setRegions(handle, i);
+        req->setExtentCounts(extents.size(), i);
+        req->setRangeCounts(ranges, i);
+
+        uint32_t bound = req->getBoundsSize();
+        req->setBoundsSize(bound + 2 * ranges * extents.size());
+        for (const auto& extent : extents) {
+            for (uint32_t h = 1; h <= ranges; ++h) {
+                req->setBounds(extent.getRangeLowerBound(h), bound++);
+                req->setBounds(extent.getRangeUpperBound(h), bound++);
+            }
+        }
+        sent.emplace(handle, extents);
+        ++i;
+    }
+
+    Debug(D, pdDebug) << "Commit " << modifiedRegions.size() << " region modification(s)" << endl;
+    modifiedRegions.clear();
+    unansweredModifications.push_back(std::move(sent));
+
+    return req;
+}
+
+void DataDistribution::regionModificationsAnswered(NetworkMessage& answer)
+{
+    if (unansweredModifications.empty()) {
+        Debug(D, pdError) << "Answer to no region modification" << endl;
+        return;
+    }
+
+    auto batch = std::move(unansweredModifications.front());
+    unansweredModifications.pop_front();
+
+    if (answer.getException() == Exception::Type::NO_EXCEPTION) {
+        for (auto& region : batch) {
+            acceptedExtents[region.first] = std::move(region.second);
+            refusals.erase(region.first);
+        }
+        return;
     }
+
+    Debug(D, pdError) << "RTIG refused region modifications: " << answer.getExceptionReason() << endl;
+
+    // nothing of the batch was applied
+    for (const auto& region : batch) {
+        const RegionHandle handle = region.first;
+        bool modifiedSince = modifiedRegions.count(handle) != 0;
+        for (const auto& later : unansweredModifications) {
+            modifiedSince = modifiedSince || later.count(handle) != 0;
+        }
+        auto accepted = acceptedExtents.find(handle);
+        if (modifiedSince || accepted == acceptedExtents.end()) {
+            continue;
+        }
+        try {
+            rootObject->getRegion(handle)->replaceExtents(accepted->second);
+            refusals[handle] = {answer.getException(), answer.getExceptionReason()};
+            Debug(D, pdDebug) << "Rolled region " << handle << " back" << endl;
+        }
+        catch (RegionNotKnown&) {
+        }
+    }
+}
+
+Exception::Type DataDistribution::takeRegionModificationsRefusal(RegionHandle region, std::string& reason)
+{
+    auto refusal = refusals.find(region);
+    if (refusal == refusals.end()) {
+        return Exception::Type::NO_EXCEPTION;
+    }
+
+    Exception::Type e = refusal->second.first;
+    reason = refusal->second.second;
+    refusals.erase(refusal);
+    return e;
 }
 
 void DataDistribution::deleteRegion(long handle, Exception::Type& e) throw(RegionNotKnown, RegionInUse)
@@ -161,6 +259,8 @@ void DataDistribution::deleteRegion(long handle, Exception::Type& e) throw(Regio
 
     if (e == Exception::Type::NO_EXCEPTION) {
         rootObject->deleteRegion(handle);
+        acceptedExtents.erase(handle);
+        refusals.erase(handle);
         Debug(D, pdDebug) << "Deleted region " << handle << endl;
     }
 }
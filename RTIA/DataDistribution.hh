@@ -23,12 +23,21 @@
 #ifndef _CERTI_DATA_DISTRIBUTION
 #define _CERTI_DATA_DISTRIBUTION
 
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
 #include <libCERTI/RootObject.hh>
 
 #include "Communications.hh"
 #include "FederationManagement.hh"
 
 namespace certi {
+
+class NM_DDM_Modify_Regions;
+
 namespace rtia {
 
 class DataDistribution {
@@ -50,8 +59,36 @@ public:
 
     long createRegion(SpaceHandle, unsigned long, Exception::Type&) throw(SpaceNotDefined);
 
+    /** Modify the extents of a region.
+     *
+     * The region is modified locally, the RTIG learns about it with the
+     * next commitRegionModifications.
+     */
     void modifyRegion(RegionHandle, const std::vector<Extent>&, Exception::Type&);
 
+    /** Send the regions modified since the last commit to the RTIG.
+     *
+     * All of them go in a single NM_DDM_Modify_Regions. The RTIG answers it
+     * once it applied or refused the whole batch, the RTIA does not wait for
+     * the answer. Must be called before any other request of the federate is
+     * processed, so that the RTIG sees the regions as the federate does.
+     */
+    void commitRegionModifications();
+
+    /// The message commitRegionModifications sends, nullptr if no region was modified.
+    std::unique_ptr<NM_DDM_Modify_Regions> takeRegionModifications();
+
+    /** The RTIG answered the oldest region modifications still unanswered.
+     *
+     * When it refused them, the regions get back the extents the RTIG has,
+     * unless the federate modified them again since, and the refusal is kept
+     * for the next modification of each region rolled back.
+     */
+    void regionModificationsAnswered(NetworkMessage& answer);
+
+    /// Exception of the last refused modification of region not reported yet, NO_EXCEPTION if none.
+    Exception::Type takeRegionModificationsRefusal(RegionHandle region, std::string& reason);
+
     void deleteRegion(long, Exception::Type&) throw(RegionNotKnown, RegionInUse);
 
     void associateRegion(ObjectHandle,
@@ -87,6 +124,18 @@ private:
     RootObject* rootObject;
     FederationManagement* fm;
     Communications* comm;
+
+    /// Regions modified locally but not yet sent to the RTIG.
+    std::set<RegionHandle> modifiedRegions;
+
+    /// Extents of the modified regions as the RTIG last accepted them.
+    std::map<RegionHandle, std::vector<Extent>> acceptedExtents;
+
+    /// Extents sent by each commit not answered yet, oldest first.
+    std::deque<std::map<RegionHandle, std::vector<Extent>>> unansweredModifications;
+
+    /// Refusal of the modifications of each region rolled back, with its reason.
+    std::map<RegionHandle, std::pair<Exception::Type, std::string>> refusals;
 };
 }
 } // namespace certi/rtia
@@ -31,6 +31,7 @@
 #include <libCERTI/M_Classes.hh>
 #include <libCERTI/NM_Classes.hh>
 #include <libCERTI/PrettyDebug.hh>
+#include <libCERTI/ValueCompression.hh>
 
 #include "TimeManagement.hh"
 
@@ -82,6 +83,11 @@ FederateHandle FederationManagement::getFederateHandle() const
     return my_federate_handle;
 }
 
+bool FederationManagement::isCompressionGranted() const
+{
+    return my_is_compression_granted;
+}
+
 FederationManagement::ConnectionState FederationManagement::getConnectionState() const
 {
     return my_connection_state;
@@ -226,6 +232,10 @@ FederateHandle FederationManagement::joinFederationExecution(const std::string&
     request.setFederateType(federate_type);
     
     request.setRtiVersion(rti_version);
+    request.setCompression(ValueCompression::isAvailable());
+    if (auto peers = comm->peers()) {
+        request.setPeerPort(peers->getPort());
+    }
 
     request.setAdditionalFomModulesSize(additional_fom_modules.size());
     auto i = 0;
@@ -251,6 +261,10 @@ FederateHandle FederationManagement::joinFederationExecution(const std::string&
         my_federation_handle = FederationHandle(joinResponse.getFederation());
         my_federate_handle = joinResponse.getFederate();
         my_tm->setFederate(my_federate_handle);
+        my_is_compression_granted = joinResponse.getCompression();
+        if (auto peers = comm->peers()) {
+            peers->setFederate(my_federation_handle.get(), my_federate_handle);
+        }
 #ifdef FEDERATION_USES_MULTICAST
         // creation du socket pour la communication best-effort
         comm->CreerSocketMC(reponse->getMulticastAddress(), MC_PORT);
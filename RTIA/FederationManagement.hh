@@ -61,6 +61,9 @@ public:
     FederationHandle getFederationHandle() const;
     FederateHandle getFederateHandle() const;
 
+    /// true if the RTIG accepted compressed values at join.
+    bool isCompressionGranted() const;
+
     ConnectionState getConnectionState() const;
     void setConnectionState(const ConnectionState state);
 
@@ -131,6 +134,8 @@ private:
 
     bool my_is_member_of_a_federation {false};
 
+    bool my_is_compression_granted {false};
+
     bool my_is_saving {false};
     bool my_is_restoring {false};
 
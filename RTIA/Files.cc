@@ -54,22 +54,7 @@ NetworkMessage* Queues::giveFifoMessage(bool& gave_msg, bool& has_remaining_msg)
 
 void Queues::insertTsoMessage(NetworkMessage* msg)
 {
-    if (tsos.empty()) {
-        tsos.push_front(msg);
-        return;
-    }
-    else {
-        for (auto i = tsos.begin(); i != tsos.end(); ++i) {
-            // stricly greater because we want to place new message behind
-            // older ones with same logical time and thus keep receive order
-            // in list.
-            if ((*i)->getDate() > msg->getDate()) {
-                tsos.insert(i, msg);
-                return;
-            }
-        }
-    }
-    tsos.push_back(msg);
+    tsos.insert(msg);
 }
 
 NetworkMessage* Queues::giveTsoMessage(FederationTime logical_time, bool& gave_msg, bool& has_remaining_msg)
@@ -81,7 +66,7 @@ NetworkMessage* Queues::giveTsoMessage(FederationTime logical_time, bool& gave_m
         auto msg = tsos.front();
         if (msg->getDate() <= logical_time) {
             // remove from list but keep pointer to execute ExecuterServiceFedere.
-            tsos.pop_front();
+            tsos.pop();
             gave_msg = true;
 
             // Test if next TSO message can be sent.
@@ -112,6 +97,11 @@ void Queues::nextTsoDate(bool& found, FederationTime& logical_time)
     }
 }
 
+NetworkMessage* Queues::retractTsoMessage(FederateHandle federate, EventRetractionHandle event)
+{
+    return tsos.retract(federate, event);
+}
+
 void Queues::insertBeginCommand(NetworkMessage* msg)
 {
     commands.push_front(msg);
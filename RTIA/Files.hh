@@ -30,6 +30,7 @@
 #include "FederationManagement.hh"
 #include "ObjectManagement.hh"
 #include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/TsoQueue.hh>
 
 namespace certi {
 namespace rtia {
@@ -59,6 +60,9 @@ public:
     /// Returns logical time from first message in TSO list.
     void nextTsoDate(bool& found, FederationTime& logical_time);
 
+    /// Remove the TSO message of event sent by federate, nullptr if it is not (or no longer) queued.
+    NetworkMessage* retractTsoMessage(FederateHandle federate, EventRetractionHandle event);
+
     // File Commandes(ex: requestPause)
     /** Insert a message with a command (ex: requestPause) to the beginning of
      *  command list.
@@ -79,7 +83,7 @@ public:
 private:
     // Attributes
     std::list<NetworkMessage*> fifos; /// FIFO list.
-    std::list<NetworkMessage*> tsos; /// TSO list.
+    TsoQueue tsos; /// TSO list.
     std::list<NetworkMessage*> commands; /// commands list.
 
     /// Call a service on the federate.
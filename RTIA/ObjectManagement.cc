@@ -22,19 +22,23 @@
 
 #include "ObjectManagement.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <config.h>
 #include <iostream>
 #include <memory>
 
 #include <libCERTI/InteractionSet.hh>
+#include <libCERTI/LatencyTrace.hh>
 #include <libCERTI/M_Classes.hh>
 #include <libCERTI/NM_Classes.hh>
+#include <libCERTI/Object.hh>
 #include <libCERTI/ObjectClassSet.hh>
 #include <libCERTI/ObjectSet.hh>
 #include <libCERTI/PrettyDebug.hh>
 
 #include "FederationManagement.hh"
+#include "Files.hh"
 #include "TimeManagement.hh"
 
 using std::cout;
@@ -52,8 +56,15 @@ const ObjectManagement::TransportTypeList ObjectManagement::transportTypeList[]
 const ObjectManagement::OrderTypeList ObjectManagement::orderTypeList[]
     = {{"Receive", RECEIVE}, {"Timestamp", TIMESTAMP}};
 
-ObjectManagement::ObjectManagement(Communications* GC, FederationManagement* GF, RootObject* theRootObj)
-    : comm(GC), fm(GF), rootObject(theRootObj)
+constexpr uint32_t ObjectManagement::minLeaseSize;
+constexpr uint32_t ObjectManagement::maxLeaseSize;
+constexpr size_t ObjectManagement::minRetractablePruneSize;
+
+ObjectManagement::ObjectManagement(Communications* GC,
+                                   Queues* GQueues,
+                                   FederationManagement* GF,
+                                   RootObject* theRootObj)
+    : comm(GC), queues(GQueues), fm(GF), rootObject(theRootObj), leaseSize(minLeaseSize)
 {
 }
 
@@ -90,6 +101,49 @@ ObjectHandle ObjectManagement::registerObject(
     req.setFederate(fm->getFederateHandle());
     req.setFederation(fm->getFederationHandle().get());
     req.setObjectClass(the_class);
+    req.setObject(0);
+
+    auto reservation = rootObject->reservedNames->find(theObjectName);
+    if (theObjectName.empty()
+        || (reservation != rootObject->reservedNames->end()
+            && reservation->second->getHandle() == fm->getFederateHandle())) {
+        // the RTIA registers the object itself, and only the RTIG checks publication on registration
+        try {
+            if (!rootObject->ObjectClasses->getObjectFromHandle(the_class)->isFederatePublisher(
+                    fm->getFederateHandle())) {
+                e = Exception::Type::ObjectClassNotPublished;
+                return 0;
+            }
+        }
+        catch (Exception& ex) {
+            e = ex.type();
+            return 0;
+        }
+
+        ObjectHandle object = leaseObjectHandle(e);
+        if (e != Exception::Type::NO_EXCEPTION) {
+            return 0;
+        }
+
+        // same default name as the RTIG
+        std::string name = theObjectName.empty() ? "HLAObject_" + std::to_string(object) : theObjectName;
+        try {
+            rootObject->registerObjectInstance(fm->getFederateHandle(), the_class, object, name);
+        }
+        catch (Exception& ex) {
+            // still leased, kept for the next registration
+            leasedObjectHandles.push_front(object);
+            e = ex.type();
+            return 0;
+        }
+
+        req.setObject(object);
+        req.setLabel(name);
+        comm->sendMessage(&req);
+
+        return object;
+    }
+
     req.setLabel(theObjectName);
 
     comm->sendMessage(&req);
@@ -109,12 +163,82 @@ ObjectHandle ObjectManagement::registerObject(
     }
 }
 
+ObjectHandle ObjectManagement::leaseObjectHandle(Exception::Type& e)
+{
+    if (leasedObjectHandles.empty()) {
+        NM_Lease_Object_Handles req;
+
+        req.setFederate(fm->getFederateHandle());
+        req.setFederation(fm->getFederationHandle().get());
+        req.setCount(leaseSize);
+
+        comm->sendMessage(&req);
+
+        std::unique_ptr<NM_Lease_Object_Handles> rep(static_cast<NM_Lease_Object_Handles*>(
+            comm->waitMessage(NetworkMessage::Type::LEASE_OBJECT_HANDLES, req.getFederate())));
+
+        // refused registrations are reported with the same message type
+        while (rep->getException() != Exception::Type::NO_EXCEPTION && rep->getObjectsSize() > 0) {
+            registrationFailed(*rep);
+            rep.reset(static_cast<NM_Lease_Object_Handles*>(
+                comm->waitMessage(NetworkMessage::Type::LEASE_OBJECT_HANDLES, req.getFederate())));
+        }
+
+        e = rep->getException();
+        if (e != Exception::Type::NO_EXCEPTION) {
+            return 0;
+        }
+
+        leasedObjectHandles.assign(rep->getObjects().begin(), rep->getObjects().end());
+        leaseSize = std::min(2 * leaseSize, maxLeaseSize);
+
+        Debug(D, pdRegister) << "Leased " << leasedObjectHandles.size() << " object handles" << std::endl;
+    }
+
+    ObjectHandle object = leasedObjectHandles.front();
+    leasedObjectHandles.pop_front();
+    return object;
+}
+
+void ObjectManagement::registrationFailed(NM_Lease_Object_Handles& report)
+{
+    for (const auto& object : report.getObjects()) {
+        Debug(D, pdError) << "RTIG refused the registration of object " << object << ": "
+                          << report.getExceptionReason() << std::endl;
+        ObjectClassHandle objectClass;
+        try {
+            objectClass = rootObject->objects->getObject(object)->getClass();
+        }
+        catch (ObjectNotKnown& e) {
+            Debug(D, pdExcept) << "Object " << object << " already removed: " << e.reason() << std::endl;
+            continue;
+        }
+
+        // The federate was told the object is registered, it is removed
+        // with a callback like any other object, the reason as tag.
+        NM_Remove_Object* RO = new NM_Remove_Object();
+        RO->setFederation(report.getFederation());
+        RO->setFederate(fm->getFederateHandle());
+        RO->setObjectClass(objectClass);
+        RO->setObject(object);
+        RO->setLabel(report.getExceptionReason());
+        queues->insertFifoMessage(RO);
+    }
+}
+
+void ObjectManagement::clearLeasedObjectHandles()
+{
+    leasedObjectHandles.clear();
+    leaseSize = minLeaseSize;
+}
+
 EventRetractionHandle ObjectManagement::updateAttributeValues(ObjectHandle theObjectHandle,
                                                               const std::vector<AttributeHandle>& attribArray,
                                                               const std::vector<AttributeValue_t>& valueArray,
                                                               uint32_t attribArraySize,
                                                               FederationTime theTime,
                                                               const std::string& theTag,
+                                                              uint64_t theTrace,
                                                               Exception::Type& e)
 {
     EventRetractionHandle evtrHandle;
@@ -136,12 +260,25 @@ EventRetractionHandle ObjectManagement::updateAttributeValues(ObjectHandle theOb
         }
 
         req.setLabel(theTag);
+        req.setEvent(nextEvent());
+
+        if (fm->isCompressionGranted()) {
+            compression.compress(req);
+        }
+
+        if (theTrace) {
+            req.setTraceId(theTrace);
+            LatencyTrace::instance().stamp(theTrace, TraceSpan::Hop::RTIA_SEND, fm->getFederateHandle());
+        }
 
         comm->sendMessage(&req);
         std::unique_ptr<NM_Update_Attribute_Values> rep(
             static_cast<NM_Update_Attribute_Values*>(comm->waitMessage(req.getMessageType(), req.getFederate())));
         e = rep->getException();
-        evtrHandle = rep->getEvent();
+        evtrHandle = req.getEvent();
+        if (e == Exception::Type::NO_EXCEPTION) {
+            keepRetractable(evtrHandle, theTime, rep->getReceivers());
+        }
 #ifdef CERTI_USE_NULL_PRIME_MESSAGE_PROTOCOL
         // update the time of the min tx event date
         // this is used per NULL MESSAGE PRIM algorithm
@@ -169,6 +306,7 @@ void ObjectManagement::updateAttributeValues(ObjectHandle theObjectHandle,
                                              const std::vector<AttributeValue_t>& valueArray,
                                              uint32_t attribArraySize,
                                              const std::string& theTag,
+                                             uint64_t theTrace,
                                              Exception::Type& e)
 {
     NM_Update_Attribute_Values req;
@@ -189,6 +327,24 @@ void ObjectManagement::updateAttributeValues(ObjectHandle theObjectHandle,
 
     req.setLabel(theTag);
 
+    if (fm->isCompressionGranted()) {
+        compression.compress(req);
+    }
+
+    if (theTrace) {
+        req.setTraceId(theTrace);
+        LatencyTrace::instance().stamp(theTrace, TraceSpan::Hop::RTIA_SEND, fm->getFederateHandle());
+    }
+
+    // the RTIG validated the same update when it gave the route
+    if (auto peers = comm->peers()) {
+        if (peers->send(req)) {
+            e = Exception::Type::NO_EXCEPTION;
+            Debug(G, pdGendoc) << "exit  ObjectManagement::updateAttributeValues without time" << std::endl;
+            return;
+        }
+    }
+
     comm->sendMessage(&req);
     std::unique_ptr<NetworkMessage> rep(comm->waitMessage(req.getMessageType(), req.getFederate()));
 
@@ -196,6 +352,82 @@ void ObjectManagement::updateAttributeValues(ObjectHandle theObjectHandle,
     Debug(G, pdGendoc) << "exit  ObjectManagement::updateAttributeValues without time" << std::endl;
 }
 
+void ObjectManagement::batchUpdateAttributeValues(const std::vector<ObjectHandle>& objects,
+                                                  const std::vector<uint32_t>& attributeCounts,
+                                                  const std::vector<AttributeHandle>& attributes,
+                                                  const std::vector<AttributeValue_t>& values,
+                                                  FederationTime theTime,
+                                                  const std::string& theTag,
+                                                  Exception::Type& e)
+{
+    Debug(G, pdGendoc) << "enter ObjectManagement::batchUpdateAttributeValues with time" << std::endl;
+    if (!tm->testValidTime(theTime)) {
+        Debug(D, pdDebug) << "Batch UAV InvalidFederationTime: providedTime =" << theTime
+                          << ", currentTime =" << tm->requestFederateTime()
+                          << ", lookahead =" << tm->requestLookahead() << std::endl;
+        e = Exception::Type::InvalidFederationTime;
+        return;
+    }
+
+    NM_Batch_Update_Attribute_Values req;
+    req.setDate(theTime);
+    sendBatch(req, objects, attributeCounts, attributes, values, theTag, e);
+#ifdef CERTI_USE_NULL_PRIME_MESSAGE_PROTOCOL
+    // update the time of the min tx event date
+    // this is used per NULL MESSAGE PRIM algorithm
+    tm->updateMinTxMessageDate(theTime);
+#endif
+    Debug(G, pdGendoc) << "exit  ObjectManagement::batchUpdateAttributeValues with time" << std::endl;
+}
+
+void ObjectManagement::batchUpdateAttributeValues(const std::vector<ObjectHandle>& objects,
+                                                  const std::vector<uint32_t>& attributeCounts,
+                                                  const std::vector<AttributeHandle>& attributes,
+                                                  const std::vector<AttributeValue_t>& values,
+                                                  const std::string& theTag,
+                                                  Exception::Type& e)
+{
+    Debug(G, pdGendoc) << "enter ObjectManagement::batchUpdateAttributeValues without time" << std::endl;
+    NM_Batch_Update_Attribute_Values req;
+    sendBatch(req, objects, attributeCounts, attributes, values, theTag, e);
+    Debug(G, pdGendoc) << "exit  ObjectManagement::batchUpdateAttributeValues without time" << std::endl;
+}
+
+void ObjectManagement::sendBatch(NM_Batch_Update_Attribute_Values& req,
+                                 const std::vector<ObjectHandle>& objects,
+                                 const std::vector<uint32_t>& attributeCounts,
+                                 const std::vector<AttributeHandle>& attributes,
+                                 const std::vector<AttributeValue_t>& values,
+                                 const std::string& theTag,
+                                 Exception::Type& e)
+{
+    req.setFederation(fm->getFederationHandle().get());
+    req.setFederate(fm->getFederateHandle());
+    req.setObjectsSize(objects.size());
+    req.setAttributeCountsSize(objects.size());
+    for (uint32_t i = 0; i < objects.size(); ++i) {
+        req.setObjects(objects[i], i);
+        req.setAttributeCounts(attributeCounts[i], i);
+    }
+    req.setAttributesSize(attributes.size());
+    req.setValuesSize(attributes.size());
+    for (uint32_t i = 0; i < attributes.size(); ++i) {
+        req.setAttributes(attributes[i], i);
+        req.setValues(values[i], i);
+    }
+
+    req.setLabel(theTag);
+
+    if (fm->isCompressionGranted()) {
+        compression.compress(req);
+    }
+
+    comm->sendMessage(&req);
+    std::unique_ptr<NetworkMessage> rep(comm->waitMessage(req.getMessageType(), req.getFederate()));
+
+    e = rep->getException();
+}
+
 void ObjectManagement::discoverObject(ObjectHandle the_object,
                                       ObjectClassHandle the_class,
                                       const std::string& the_name,
@@ -227,7 +459,9 @@ void ObjectManagement::reflectAttributeValues(ObjectHandle the_object,
                                               uint16_t the_size,
                                               FederationTime the_time,
                                               const std::string& the_tag,
+                                              FederateHandle the_federate,
                                               EventRetractionHandle the_event,
+                                              uint64_t the_trace,
                                               Exception::Type& /*e*/)
 {
     M_Reflect_Attribute_Values req;
@@ -236,6 +470,7 @@ void ObjectManagement::reflectAttributeValues(ObjectHandle the_object,
     Debug(G, pdGendoc) << "enter ObjectManagement::reflectAttributeValues with time" << std::endl;
     req.setObject(the_object);
     req.setDate(the_time);
+    event.setSendingFederate(the_federate);
     event.setSN(the_event);
     req.setEventRetraction(event);
     req.setTag(the_tag);
@@ -247,6 +482,10 @@ void ObjectManagement::reflectAttributeValues(ObjectHandle the_object,
         req.setAttributes(the_attributes[i], i);
     }
 
+    if (the_trace) {
+        req.setTraceId(the_trace);
+    }
+
     comm->requestFederateService(&req);
     Debug(G, pdGendoc) << "exit  ObjectManagement::reflectAttributeValues with time" << std::endl;
 }
@@ -256,6 +495,7 @@ void ObjectManagement::reflectAttributeValues(ObjectHandle the_object,
                                               const std::vector<AttributeValue_t>& the_values,
                                               uint16_t the_size,
                                               const std::string& the_tag,
+                                              uint64_t the_trace,
                                               Exception::Type& /*e*/)
 {
     M_Reflect_Attribute_Values req;
@@ -271,6 +511,10 @@ void ObjectManagement::reflectAttributeValues(ObjectHandle the_object,
         req.setAttributes(the_attributes[i], i);
     }
 
+    if (the_trace) {
+        req.setTraceId(the_trace);
+    }
+
     comm->requestFederateService(&req);
     Debug(G, pdGendoc) << "exit  ObjectManagement::reflectAttributeValues without time" << std::endl;
 }
@@ -308,13 +552,21 @@ EventRetractionHandle ObjectManagement::sendInteraction(InteractionClassHandle t
         }
 
         req.setLabel(theTag);
+        req.setEvent(nextEvent());
+
+        if (fm->isCompressionGranted()) {
+            compression.compress(req);
+        }
 
         // Send network message and then wait for answer.
         comm->sendMessage(&req);
-        std::unique_ptr<NetworkMessage> rep(
-            comm->waitMessage(NetworkMessage::Type::SEND_INTERACTION, req.getFederate()));
+        std::unique_ptr<NM_Send_Interaction> rep(static_cast<NM_Send_Interaction*>(
+            comm->waitMessage(NetworkMessage::Type::SEND_INTERACTION, req.getFederate())));
         e = rep->getException();
-        evtrHandle = rep->eventRetraction;
+        evtrHandle = req.getEvent();
+        if (e == Exception::Type::NO_EXCEPTION) {
+            keepRetractable(evtrHandle, theTime, rep->getReceivers());
+        }
 #ifdef CERTI_USE_NULL_PRIME_MESSAGE_PROTOCOL
         // update the time of the min tx event date
         // this is used per NULL MESSAGE PRIM algorithm
@@ -357,6 +609,18 @@ void ObjectManagement::sendInteraction(InteractionClassHandle theInteraction,
 
     req.setLabel(theTag);
 
+    if (fm->isCompressionGranted()) {
+        compression.compress(req);
+    }
+
+    // the RTIG validated the same interaction when it gave the route
+    if (auto peers = comm->peers()) {
+        if (peers->send(req)) {
+            e = Exception::Type::NO_EXCEPTION;
+            return;
+        }
+    }
+
     // Send network message and then wait for answer.
     comm->sendMessage(&req);
     std::unique_ptr<NetworkMessage> rep(comm->waitMessage(NetworkMessage::Type::SEND_INTERACTION, req.getFederate()));
@@ -370,6 +634,7 @@ void ObjectManagement::receiveInteraction(InteractionClassHandle the_interaction
                                           uint16_t the_size,
                                           FederationTime the_time,
                                           const std::string& the_tag,
+                                          FederateHandle the_federate,
                                           EventRetractionHandle the_event,
                                           Exception::Type& /*e*/)
 {
@@ -378,6 +643,7 @@ void ObjectManagement::receiveInteraction(InteractionClassHandle the_interaction
 
     req.setInteractionClass(the_interaction);
     req.setDate(the_time);
+    event.setSendingFederate(the_federate);
     event.setSN(the_event);
     req.setEventRetraction(event);
     req.setTag(the_tag);
@@ -690,14 +956,75 @@ void ObjectManagement::provideAttributeValueUpdate(ObjectHandle the_object,
     Debug(G, pdGendoc) << "exit  ObjectManagement::provideAttributeValueUpdate" << std::endl;
 }
 
-void ObjectManagement::retract(EventRetractionHandle /*theHandle*/, Exception::Type& /*e*/)
+void ObjectManagement::retract(EventRetractionHandle theHandle, Exception::Type& e)
 {
-    throw RTIinternalError("ObjectManagement::retract not implemented.");
+    auto it = retractableEvents.find(theHandle);
+    if (it == end(retractableEvents)) {
+        Debug(D, pdExcept) << "Event " << theHandle << " unknown or no longer retractable" << std::endl;
+        e = Exception::Type::InvalidRetractionHandle;
+        return;
+    }
+    if (it->second.date <= tm->requestFederateTime()) {
+        Debug(D, pdExcept) << "Event " << theHandle << " dated " << it->second.date << " already reached" << std::endl;
+        retractableEvents.erase(it);
+        e = Exception::Type::InvalidRetractionHandle;
+        return;
+    }
+
+    NM_Retract req;
+    req.setFederation(fm->getFederationHandle().get());
+    req.setFederate(fm->getFederateHandle());
+    req.setEvent(theHandle);
+    req.setReceiversSize(it->second.receivers.size());
+    for (uint32_t i = 0; i < it->second.receivers.size(); ++i) {
+        req.setReceivers(it->second.receivers[i], i);
+    }
+    retractableEvents.erase(it);
+
+    // no answer: the receivers cancel or request the retraction on their own
+    comm->sendMessage(&req);
+    e = Exception::Type::NO_EXCEPTION;
 }
 
-void ObjectManagement::reflectRetraction(EventRetractionHandle, Exception::Type&)
+void ObjectManagement::requestRetraction(FederateHandle the_federate, EventRetractionHandle the_event)
 {
-    throw RTIinternalError("ObjectManagement::reflectRetraction not implemented.");
+    M_Request_Retraction req;
+    EventRetraction event;
+
+    event.setSendingFederate(the_federate);
+    event.setSN(the_event);
+    req.setEventRetraction(event);
+
+    comm->requestFederateService(&req);
+}
+
+EventRetractionHandle ObjectManagement::nextEvent()
+{
+    // 0 stands for no event
+    if (++lastEvent == 0) {
+        ++lastEvent;
+    }
+    return lastEvent;
+}
+
+void ObjectManagement::keepRetractable(EventRetractionHandle event,
+                                       FederationTime date,
+                                       const std::vector<FederateHandle>& receivers)
+{
+    if (retractableEvents.size() >= retractablePruneSize) {
+        // events the logical time reached can no longer be retracted
+        const auto now = tm->requestFederateTime();
+        for (auto it = begin(retractableEvents); it != end(retractableEvents);) {
+            if (it->second.date <= now) {
+                it = retractableEvents.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        retractablePruneSize = std::max(minRetractablePruneSize, 2 * retractableEvents.size());
+    }
+    retractableEvents[event] = {date, receivers};
 }
 
 ObjectClassHandle ObjectManagement::getObjectClassHandle(const std::string& theName)
@@ -945,6 +1272,9 @@ void ObjectManagement::turnUpdatesOffForObjectInstance(ObjectHandle theObject,
 
 void ObjectManagement::nameReservationSucceeded(const std::string& reservedName)
 {
+    // remembered so that registering with this name does not need the RTIG
+    rootObject->reserveObjectInstanceName(fm->getFederateHandle(), reservedName);
+
     M_Reserve_Object_Instance_Name_Succeeded req;
 
     req.setObjectName(reservedName);
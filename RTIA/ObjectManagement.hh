@@ -24,9 +24,16 @@
 #ifndef _CERTI_RTIA_OM
 #define _CERTI_RTIA_OM
 
+#include <deque>
+#include <unordered_map>
+
 #include <libCERTI/RootObject.hh>
+#include <libCERTI/ValueCompression.hh>
 
 namespace certi {
+class NM_Batch_Update_Attribute_Values;
+class NM_Lease_Object_Handles;
+
 namespace rtia {
 
 class Communications;
@@ -36,18 +43,35 @@ class TimeManagement;
 
 class ObjectManagement {
 public:
-    ObjectManagement(Communications* GC, FederationManagement* GF, RootObject* theRootObj);
+    ObjectManagement(Communications* GC, Queues* GQueues, FederationManagement* GF, RootObject* theRootObj);
     ~ObjectManagement();
 
     // Object Management services
     void reserveObjectName(const std::string& newObjName, Exception::Type& e);
 
+    /** Register an object instance.
+     *
+     * Unnamed objects and objects named after a name reserved by this
+     * federate cannot clash with another registration, so they are
+     * registered locally with a leased handle and announced to the RTIG
+     * without waiting. Other names are checked by the RTIG first.
+     */
     ObjectHandle registerObject(ObjectClassHandle the_class,
                                 const std::string& theObjectName,
                                 FederationTime,
                                 FederationTime,
                                 Exception::Type& e);
 
+    /** The RTIG refused registrations announced with leased handles.
+     *
+     * The federate is given a removeObjectInstance callback for each object,
+     * with the reason of the refusal as tag, and the object is removed then.
+     */
+    void registrationFailed(NM_Lease_Object_Handles& report);
+
+    /// Forget the leased handles, the RTIG frees them when the federate resigns.
+    void clearLeasedObjectHandles();
+
     /** updateAttributeValues with time
      *    @param theObjectHandle Object handle
      *    @param attribArray attribute handles array (pointer)
@@ -55,6 +79,7 @@ public:
      *    @param attribArraySize attribute and value array size
      *    @param theTime time of the federation
      *    @param theTag user tag (pointer)
+     *    @param theTrace trace id the libRTI drew, 0 if the update is not traced
      *    @param e exception address (may be modified)
      */
     EventRetractionHandle updateAttributeValues(ObjectHandle theObjectHandle,
@@ -63,6 +88,7 @@ public:
                                                 uint32_t attribArraySize,
                                                 FederationTime theTime,
                                                 const std::string& theTag,
+                                                uint64_t theTrace,
                                                 Exception::Type& e);
 
     /** updateAttributeValues without time
@@ -71,6 +97,7 @@ public:
      *    @param valueArray value array (pointer)
      *    @param attribArraySize attribute and value array size
      *    @param theTag user tag (pointer)
+     *    @param theTrace trace id the libRTI drew, 0 if the update is not traced
      *    @param e exception address (may be modified)
      */
     void updateAttributeValues(ObjectHandle theObjectHandle,
@@ -78,8 +105,30 @@ public:
                                const std::vector<AttributeValue_t>& valueArray,
                                uint32_t attribArraySize,
                                const std::string& theTag,
+                               uint64_t theTrace,
                                Exception::Type& e);
 
+    /** batchUpdateAttributeValues with time, a CERTI extension
+     *
+     * The attributes and values of objects[i] are the next attributeCounts[i]
+     * ones, all the updates share theTime and theTag.
+     */
+    void batchUpdateAttributeValues(const std::vector<ObjectHandle>& objects,
+                                    const std::vector<uint32_t>& attributeCounts,
+                                    const std::vector<AttributeHandle>& attributes,
+                                    const std::vector<AttributeValue_t>& values,
+                                    FederationTime theTime,
+                                    const std::string& theTag,
+                                    Exception::Type& e);
+
+    /// batchUpdateAttributeValues without time
+    void batchUpdateAttributeValues(const std::vector<ObjectHandle>& objects,
+                                    const std::vector<uint32_t>& attributeCounts,
+                                    const std::vector<AttributeHandle>& attributes,
+                                    const std::vector<AttributeValue_t>& values,
+                                    const std::string& theTag,
+                                    Exception::Type& e);
+
     void discoverObject(ObjectHandle the_object,
                         ObjectClassHandle the_class,
                         const std::string& the_name,
@@ -93,7 +142,9 @@ public:
                                 uint16_t the_size,
                                 FederationTime the_time,
                                 const std::string& the_tag,
+                                FederateHandle the_federate,
                                 EventRetractionHandle the_event,
+                                uint64_t the_trace,
                                 Exception::Type& e);
 
     void reflectAttributeValues(ObjectHandle the_object,
@@ -101,6 +152,7 @@ public:
                                 const std::vector<AttributeValue_t>& the_values,
                                 uint16_t the_size,
                                 const std::string& the_tag,
+                                uint64_t the_trace,
                                 Exception::Type& e);
 
     EventRetractionHandle sendInteraction(InteractionClassHandle theInteraction,
@@ -126,6 +178,7 @@ public:
                             uint16_t the_size,
                             FederationTime the_time,
                             const std::string& the_tag,
+                            FederateHandle the_federate,
                             EventRetractionHandle the_event,
                             Exception::Type& e);
 
@@ -188,9 +241,16 @@ public:
                                      uint32_t attribArraySize,
                                      Exception::Type&);
 
+    /** Retract a dated update or interaction sent by the federate.
+     *
+     * The RTIG forwards the retraction to the federates the event was sent
+     * to, without answering. InvalidRetractionHandle if the event is unknown
+     * or the logical time of the federate reached its date.
+     */
     void retract(EventRetractionHandle theHandle, Exception::Type& e);
 
-    void reflectRetraction(EventRetractionHandle, Exception::Type& e);
+    /// Ask the federate to retract the event of the_federate it was already given.
+    void requestRetraction(FederateHandle the_federate, EventRetractionHandle the_event);
 
     /** Transmits the Networkmessage NM_Set_Attribute_Scope_Advisory_Switch to 
      * RTIG. The transmission sets the AttributeScopeAdvisory switch at RTIG 
@@ -271,6 +331,9 @@ public:
 
     TimeManagement* tm;
 
+    /// Compression of the values sent, if granted at join, and decompression of those received.
+    ValueCompression compression{ValueCompression::thresholdFromEnvironment()};
+
 protected:
     Communications* comm;
     Queues* queues;
@@ -278,6 +341,43 @@ protected:
     RootObject* rootObject;
 
 private:
+    ObjectHandle leaseObjectHandle(Exception::Type& e);
+
+    /// Handle of the next dated update or interaction sent.
+    EventRetractionHandle nextEvent();
+
+    /// Keep event until the logical time reaches date, with the federates the RTIG sent it to.
+    void keepRetractable(EventRetractionHandle event, FederationTime date, const std::vector<FederateHandle>& receivers);
+
+    /// Fill req with the records, send it and wait for the RTIG answer.
+    void sendBatch(NM_Batch_Update_Attribute_Values& req,
+                   const std::vector<ObjectHandle>& objects,
+                   const std::vector<uint32_t>& attributeCounts,
+                   const std::vector<AttributeHandle>& attributes,
+                   const std::vector<AttributeValue_t>& values,
+                   const std::string& theTag,
+                   Exception::Type& e);
+
+    /// Object handles leased from the RTIG and not used yet.
+    std::deque<ObjectHandle> leasedObjectHandles;
+    /// Number of handles asked for by the next lease, grows up to maxLeaseSize.
+    uint32_t leaseSize;
+
+    static constexpr uint32_t minLeaseSize{16};
+    static constexpr uint32_t maxLeaseSize{1024};
+
+    struct RetractableEvent {
+        FederationTime date;
+        std::vector<FederateHandle> receivers;
+    };
+    /// Dated events sent which may still be retracted, by handle.
+    std::unordered_map<EventRetractionHandle, RetractableEvent> retractableEvents;
+    EventRetractionHandle lastEvent{0};
+    /// Number of retractable events from which the ones already reached are forgotten.
+    size_t retractablePruneSize{minRetractablePruneSize};
+
+    static constexpr size_t minRetractablePruneSize{256};
+
     struct TransportTypeList {
         std::string name;
         TransportType type;
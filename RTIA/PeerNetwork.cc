@@ -0,0 +1,547 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "PeerNetwork.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#endif
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/PrettyDebug.hh>
+
+namespace {
+static constexpr auto peerToPeerEnvironmentVariable = "CERTI_PEER_TO_PEER";
+}
+
+namespace certi {
+namespace rtia {
+
+static PrettyDebug D("RTIA_PEERS", "(RTIA Peers) ");
+
+namespace {
+/// A link whose writes fail instead of raising SIGPIPE once the peer is gone.
+class PeerLink : public SocketTCP {
+public:
+    void send(const unsigned char* buffer, size_t size) override
+    {
+#ifdef MSG_NOSIGNAL
+        size_t total{0};
+        while (total < size) {
+            auto sent = ::send(returnSocket(), buffer + total, size - total, MSG_NOSIGNAL);
+            if (sent < 0 && errno == EINTR) {
+                continue;
+            }
+            if (sent <= 0) {
+                throw NetworkError("Cannot send to peer <" + std::string(strerror(errno)) + ">");
+            }
+            total += sent;
+        }
+#else
+        SocketTCP::send(buffer, size);
+#endif
+    }
+};
+
+/// Copy the values of handles from source to message, in the order of source, with their raw sizes if any.
+template <typename Message, typename Source>
+void copyValues(const Source& source,
+                const std::vector<Handle>& source_handles,
+                const std::vector<uint32_t>& handles,
+                Message& message,
+                void (Message::*setHandle)(const Handle&, uint32_t))
+{
+    const bool compressed = source.getRawSizesSize() != 0;
+    uint32_t count{0};
+    for (uint32_t i = 0; i < source_handles.size(); ++i) {
+        if (std::find(begin(handles), end(handles), source_handles[i]) != end(handles)) {
+            ++count;
+        }
+    }
+
+    message.setValuesSize(count);
+    if (compressed) {
+        message.setRawSizesSize(count);
+    }
+    uint32_t rank{0};
+    for (uint32_t i = 0; i < source_handles.size(); ++i) {
+        if (std::find(begin(handles), end(handles), source_handles[i]) == end(handles)) {
+            continue;
+        }
+        (message.*setHandle)(source_handles[i], rank);
+        message.setValues(source.getValues(i), rank);
+        if (compressed) {
+            message.setRawSizes(source.getRawSizes(i), rank);
+        }
+        ++rank;
+    }
+}
+}
+
+void PeerNetwork::Statistics::print(std::ostream& stream) const
+{
+    stream << " Sent without the RTIG : " << direct << " (" << sent << " messages to peers)" << std::endl
+           << " Received from peers : " << received << std::endl
+           << " Peer routes : " << routes << " (" << invalidations << " invalidations)" << std::endl
+           << " Fences : " << fences << " (" << held << " messages held)" << std::endl;
+}
+
+std::ostream& operator<<(std::ostream& stream, const PeerNetwork::Statistics& statistics)
+{
+    stream << "Peer to peer statistics:" << std::endl;
+    statistics.print(stream);
+    return stream;
+}
+
+bool PeerNetwork::isEnabledFromEnvironment()
+{
+    auto enabled = getenv(peerToPeerEnvironmentVariable);
+    return enabled && std::string(enabled) != "0";
+}
+
+PeerNetwork::PeerNetwork(std::function<void(NetworkMessage&)> to_rtig)
+    : my_server(new SocketTCP), my_toRTIG(std::move(to_rtig))
+{
+    my_server->createServer();
+    Debug(D, pdInit) << "Taking peer to peer data on port " << getPort() << std::endl;
+}
+
+uint32_t PeerNetwork::getPort() const
+{
+    return my_server->returnPort();
+}
+
+void PeerNetwork::setFederate(const Handle federation, const FederateHandle federate)
+{
+    my_federation = federation;
+    my_federate = federate;
+}
+
+void PeerNetwork::install(const NM_Peer_Route& route)
+{
+    my_routes.install(route);
+    ++my_statistics.routes;
+}
+
+void PeerNetwork::invalidate()
+{
+    if (my_routes.size() != 0) {
+        my_routes.clear();
+        ++my_statistics.invalidations;
+    }
+}
+
+std::unique_ptr<NetworkMessage> PeerNetwork::acknowledge()
+{
+    invalidate();
+
+    std::unique_ptr<NetworkMessage> answer(new NM_Peer_Routes_Invalidated);
+    answer->setFederation(my_federation);
+    answer->setFederate(my_federate);
+    return answer;
+}
+
+void PeerNetwork::close()
+{
+    if (my_direct.empty()) {
+        return;
+    }
+
+    NM_Peer_Fence fence;
+    fence.setFederation(my_federation);
+    fence.setFederate(my_federate);
+    fence.setEpoch(++my_epoch);
+    fence.setClosing(true);
+
+    std::vector<PeerRoutes::Endpoint> endpoints;
+    for (const auto& kv : my_direct) {
+        endpoints.push_back({kv.second, kv.first.first, kv.first.second});
+    }
+    my_direct.clear();
+    ++my_statistics.fences;
+
+    // after the last direct message on each link
+    my_buffer.reset();
+    fence.serialize(my_buffer);
+    my_buffer.updateReservedBytes();
+    if (!write(endpoints, my_buffer)) {
+        invalidate();
+    }
+
+    // a peer gone waits for no fence
+    for (const auto& endpoint : endpoints) {
+        if (my_outgoing.count({endpoint.address, endpoint.port}) != 0) {
+            fence.setPeersSize(fence.getPeersSize() + 1);
+            fence.setPeers(endpoint.federate, fence.getPeersSize() - 1);
+        }
+    }
+    if (fence.getPeersSize() != 0) {
+        my_toRTIG(fence);
+    }
+}
+
+void PeerNetwork::fence(const NM_Peer_Fence& fence)
+{
+    if (fence.getClosing()) {
+        await(fence.getFederate(), fence.getEpoch());
+    }
+
+    auto& sender = my_senders[fence.getFederate()];
+    sender.opened = std::max(sender.opened, fence.getEpoch());
+    while (!sender.held.empty() && sender.held.front().first <= sender.opened) {
+        my_ready.push_back(std::move(sender.held.front().second));
+        sender.held.pop_front();
+    }
+}
+
+NetworkMessage* PeerNetwork::takeReady()
+{
+    if (my_ready.empty()) {
+        return nullptr;
+    }
+    auto message = my_ready.front().release();
+    my_ready.pop_front();
+    return message;
+}
+
+bool PeerNetwork::send(const NM_Update_Attribute_Values& update)
+{
+    auto route = my_routes.find(update.getObject(), update.getAttributes());
+    if (!route || !connect(*route)) {
+        return false;
+    }
+
+    // a dropped link invalidates route, once it is no longer read
+    bool kept = open(*route);
+    for (const auto& group : *route) {
+        NM_Reflect_Attribute_Values reflection;
+        reflection.setFederation(update.getFederation());
+        reflection.setFederate(update.getFederate());
+        reflection.setException(Exception::Type::NO_EXCEPTION);
+        reflection.setObject(update.getObject());
+        reflection.setLabel(update.getLabel());
+        reflection.setAttributesSize(group.handles.size());
+        copyValues(update, update.getAttributes(), group.handles, reflection, &NM_Reflect_Attribute_Values::setAttributes);
+        if (update.hasTraceId()) {
+            reflection.setTraceId(update.getTraceId());
+        }
+
+        my_buffer.reset();
+        reflection.serialize(my_buffer);
+        my_buffer.updateReservedBytes();
+        kept = write(group.endpoints, my_buffer) && kept;
+    }
+
+    if (!kept) {
+        invalidate();
+    }
+    ++my_statistics.direct;
+    return true;
+}
+
+bool PeerNetwork::send(const NM_Send_Interaction& interaction)
+{
+    auto route = my_routes.find(interaction.getInteractionClass(), interaction.getRegion(), interaction.getParameters());
+    if (!route || !connect(*route)) {
+        return false;
+    }
+
+    bool kept = open(*route);
+    for (const auto& group : *route) {
+        NM_Receive_Interaction received;
+        received.setFederation(interaction.getFederation());
+        received.setFederate(interaction.getFederate());
+        received.setException(Exception::Type::NO_EXCEPTION);
+        received.setInteractionClass(group.interactionClass);
+        received.setLabel(interaction.getLabel());
+        received.setParametersSize(group.handles.size());
+        copyValues(interaction,
+                   interaction.getParameters(),
+                   group.handles,
+                   received,
+                   &NM_Receive_Interaction::setParameters);
+
+        my_buffer.reset();
+        received.serialize(my_buffer);
+        my_buffer.updateReservedBytes();
+        kept = write(group.endpoints, my_buffer) && kept;
+    }
+
+    if (!kept) {
+        invalidate();
+    }
+    ++my_statistics.direct;
+    return true;
+}
+
+int PeerNetwork::watch(fd_set& fdset) const
+{
+    int highest = my_server->returnSocket();
+    FD_SET(my_server->returnSocket(), &fdset);
+    for (const auto& incoming : my_incoming) {
+        FD_SET(incoming.link->returnSocket(), &fdset);
+        highest = std::max(highest, static_cast<int>(incoming.link->returnSocket()));
+    }
+    // written to only, readable once the peer is gone
+    for (const auto& kv : my_outgoing) {
+        FD_SET(kv.second->returnSocket(), &fdset);
+        highest = std::max(highest, static_cast<int>(kv.second->returnSocket()));
+    }
+    return highest;
+}
+
+NetworkMessage* PeerNetwork::receive(const fd_set* fdset)
+{
+    if (auto message = takeReady()) {
+        return message;
+    }
+
+    auto ready = findReady(fdset);
+
+    if (!ready && fdset) {
+        if (FD_ISSET(my_server->returnSocket(), fdset)) {
+            accept();
+        }
+
+        for (auto it = begin(my_outgoing); it != end(my_outgoing);) {
+            if (FD_ISSET(it->second->returnSocket(), fdset)) {
+                Debug(D, pdInit) << "Peer on port " << it->first.second << " is gone" << std::endl;
+                it->second->close();
+                my_direct.erase(it->first);
+                it = my_outgoing.erase(it);
+                invalidate();
+            }
+            else {
+                ++it;
+            }
+        }
+        return nullptr;
+    }
+
+    while (ready) {
+        if (auto message = read(*ready)) {
+            return message;
+        }
+        // a fence, a held message or a closed link, the descriptor select found may be read already
+        ready = findReady(nullptr);
+    }
+    return nullptr;
+}
+
+const PeerNetwork::Statistics& PeerNetwork::statistics() const
+{
+    return my_statistics;
+}
+
+bool PeerNetwork::connect(const PeerRoutes::Route& route)
+{
+    for (const auto& group : route) {
+        for (const auto& endpoint : group.endpoints) {
+            const Address address{endpoint.address, endpoint.port};
+            if (my_outgoing.count(address) != 0) {
+                continue;
+            }
+            if (my_unreachable.count(address) != 0) {
+                return false;
+            }
+
+            std::unique_ptr<SocketTCP> link(new PeerLink);
+            try {
+                link->createTCPClient(endpoint.port, endpoint.address);
+            }
+            catch (NetworkError& e) {
+                Debug(D, pdError) << "Peer " << endpoint.federate << " unreachable: " << e.reason() << std::endl;
+                my_unreachable.insert(address);
+                return false;
+            }
+            my_outgoing.emplace(address, std::move(link));
+        }
+    }
+    return true;
+}
+
+bool PeerNetwork::open(const PeerRoutes::Route& route)
+{
+    std::vector<PeerRoutes::Endpoint> endpoints;
+    for (const auto& group : route) {
+        for (const auto& endpoint : group.endpoints) {
+            if (my_direct.emplace(Address{endpoint.address, endpoint.port}, endpoint.federate).second) {
+                endpoints.push_back(endpoint);
+            }
+        }
+    }
+    if (endpoints.empty()) {
+        return true;
+    }
+
+    NM_Peer_Fence fence;
+    fence.setFederation(my_federation);
+    fence.setFederate(my_federate);
+    fence.setEpoch(++my_epoch);
+    ++my_statistics.fences;
+
+    // the RTIG relays it after what it was sent before
+    fence.setPeersSize(endpoints.size());
+    for (uint32_t i = 0; i < endpoints.size(); ++i) {
+        fence.setPeers(endpoints[i].federate, i);
+    }
+    my_toRTIG(fence);
+
+    // before the first direct message on each link
+    fence.setPeersSize(0);
+    my_buffer.reset();
+    fence.serialize(my_buffer);
+    my_buffer.updateReservedBytes();
+    return write(endpoints, my_buffer);
+}
+
+bool PeerNetwork::write(const std::vector<PeerRoutes::Endpoint>& endpoints, libhla::MessageBuffer& buffer)
+{
+    bool kept{true};
+    for (const auto& endpoint : endpoints) {
+        auto it = my_outgoing.find({endpoint.address, endpoint.port});
+        if (it == end(my_outgoing)) {
+            // dropped while sending to a previous group
+            continue;
+        }
+        try {
+            it->second->send(static_cast<unsigned char*>(buffer(0)), buffer.size());
+            ++my_statistics.sent;
+        }
+        catch (NetworkError& e) {
+            // the peer is gone, the RTIG routes to whoever replaces it
+            Debug(D, pdInit) << "Peer " << endpoint.federate << " is gone: " << e.reason() << std::endl;
+            it->second->close();
+            my_direct.erase(it->first);
+            my_outgoing.erase(it);
+            kept = false;
+        }
+    }
+    return kept;
+}
+
+void PeerNetwork::accept()
+{
+    std::unique_ptr<SocketTCP> link(new SocketTCP);
+    link->accept(my_server.get());
+    Debug(D, pdInit) << "Peer connected from " << link->returnAdress() << std::endl;
+    my_incoming.push_back({std::move(link), 0, 0});
+}
+
+PeerNetwork::Incoming* PeerNetwork::findReady(const fd_set* fdset)
+{
+    for (auto& incoming : my_incoming) {
+        if (incoming.link->isDataReady() || (fdset && FD_ISSET(incoming.link->returnSocket(), fdset))) {
+            return &incoming;
+        }
+    }
+    return nullptr;
+}
+
+NetworkMessage* PeerNetwork::read(Incoming& incoming)
+{
+    std::unique_ptr<NetworkMessage> message;
+    try {
+        message.reset(NM_Factory::receive(incoming.link.get()));
+    }
+    catch (NetworkError& e) {
+        Debug(D, pdInit) << "Peer link closed: " << e.reason() << std::endl;
+        // no fence comes from this peer anymore
+        if (incoming.federate != 0) {
+            my_senders[incoming.federate].written = std::numeric_limits<uint32_t>::max();
+        }
+        incoming.link->close();
+        const auto link = incoming.link.get();
+        my_incoming.erase(std::find_if(
+            begin(my_incoming), end(my_incoming), [link](const Incoming& other) { return other.link.get() == link; }));
+        return nullptr;
+    }
+
+    auto& sender = my_senders[message->getFederate()];
+
+    if (message->getMessageType() == NetworkMessage::Type::PEER_FENCE) {
+        incoming.federate = message->getFederate();
+        incoming.epoch = static_cast<NM_Peer_Fence&>(*message).getEpoch();
+        sender.written = std::max(sender.written, incoming.epoch);
+        return nullptr;
+    }
+
+    ++my_statistics.received;
+    if (incoming.epoch > sender.opened || !sender.held.empty()) {
+        // what the peer sent through the RTIG before is not read yet
+        sender.held.emplace_back(incoming.epoch, std::move(message));
+        ++my_statistics.held;
+        return nullptr;
+    }
+    return message.release();
+}
+
+void PeerNetwork::await(const FederateHandle federate, const uint32_t epoch)
+{
+    const auto& sender = my_senders[federate];
+    while (sender.written < epoch) {
+        if (auto buffered = findReady(nullptr)) {
+            if (auto message = read(*buffered)) {
+                my_ready.emplace_back(message);
+            }
+            continue;
+        }
+
+        fd_set fdset;
+        FD_ZERO(&fdset);
+        int highest = my_server->returnSocket();
+        FD_SET(my_server->returnSocket(), &fdset);
+        for (const auto& incoming : my_incoming) {
+            FD_SET(incoming.link->returnSocket(), &fdset);
+            highest = std::max(highest, static_cast<int>(incoming.link->returnSocket()));
+        }
+
+        timeval timeout{fence_timeout, 0};
+        const int ready = select(highest + 1, &fdset, nullptr, nullptr, &timeout);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            Debug(D, pdError) << "Peer " << federate << " did not write fence " << epoch << ", going on" << std::endl;
+            return;
+        }
+
+        if (auto incoming = findReady(&fdset)) {
+            if (auto message = read(*incoming)) {
+                my_ready.emplace_back(message);
+            }
+        }
+        else if (FD_ISSET(my_server->returnSocket(), &fdset)) {
+            accept();
+        }
+    }
+}
+}
+} // namespace certi/rtia
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_RTIA_PEER_NETWORK_HH
+#define _CERTI_RTIA_PEER_NETWORK_HH
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <sys/select.h>
+#endif
+
+#include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/PeerRoutes.hh>
+#include <libCERTI/SocketTCP.hh>
+#include <libHLA/MessageBuffer.hh>
+
+namespace certi {
+class NM_Peer_Fence;
+class NM_Send_Interaction;
+class NM_Update_Attribute_Values;
+
+namespace rtia {
+
+/** The TCP links of the RTIA with the RTIAs it exchanges undated updates and interactions with.
+ *
+ * The RTIA listens on a port of its own, given to the RTIG at join, and
+ * connects to a peer the first time a route sends something to it. Messages
+ * from peers come from the links they connected, the links the RTIA connected
+ * are only written to.
+ *
+ * Switching between the RTIG and a peer link is fenced, see PeerRoutes: what
+ * a peer wrote after a fence is held until the RTIG relayed the same fence,
+ * so it comes after what the peer sent through the RTIG before.
+ */
+class PeerNetwork {
+public:
+    struct Statistics {
+        /// updates and interactions sent without the RTIG
+        uint64_t direct{0};
+        /// messages written to peers, and read from them
+        uint64_t sent{0};
+        uint64_t received{0};
+        uint64_t routes{0};
+        uint64_t invalidations{0};
+        /// switches between the RTIG and the peer links
+        uint64_t fences{0};
+        /// messages from peers held until the RTIG relayed their fence
+        uint64_t held{0};
+
+        void print(std::ostream& stream) const;
+    };
+
+    /// true if CERTI_PEER_TO_PEER is set to anything but 0.
+    static bool isEnabledFromEnvironment();
+
+    /** Listen on a port chosen by the system, on every interface.
+     *
+     * @param to_rtig sends the fences to the RTIG, as they are
+     */
+    explicit PeerNetwork(std::function<void(NetworkMessage&)> to_rtig);
+
+    /// Port to give the RTIG at join.
+    uint32_t getPort() const;
+
+    /// Federate the fences are sent for, once it joined federation.
+    void setFederate(const Handle federation, const FederateHandle federate);
+
+    /// Hold the route the RTIG gave.
+    void install(const NM_Peer_Route& route);
+
+    /// Forget every route, they no longer hold.
+    void invalidate();
+
+    /** Forget every route as the RTIG asked, and return the answer it waits
+     * for before changing the routing.
+     */
+    std::unique_ptr<NetworkMessage> acknowledge();
+
+    /** Go back to the RTIG for the peers sent to directly since the last fence.
+     *
+     * To call before sending the RTIG a message for which PeerRoutes::fencesPeers() holds.
+     */
+    void close();
+
+    /** Let through what the peer of fence wrote up to its epoch, now that the RTIG relayed it.
+     *
+     * A closing fence first reads the links until the peer's own fence, or
+     * until the peer is silent for too long. The messages let through are
+     * taken with takeReady().
+     */
+    void fence(const NM_Peer_Fence& fence);
+
+    /// A message let through by fence(), nullptr if none is left.
+    NetworkMessage* takeReady();
+
+    /** Send update to the peers of its route, unless the RTIG must route it.
+     *
+     * @return false if no route is held or a peer cannot be reached, nothing was sent then.
+     */
+    bool send(const NM_Update_Attribute_Values& update);
+
+    /// Same for interaction.
+    bool send(const NM_Send_Interaction& interaction);
+
+    /// Add the descriptors to wait for to fdset, return the highest one.
+    int watch(fd_set& fdset) const;
+
+    /** Read what the peers sent.
+     *
+     * Pending connections are accepted and closed links dropped on the way,
+     * messages written after a fence the RTIG did not relay yet are held.
+     *
+     * @param[in] fdset descriptors select found ready, nullptr to only look at buffered data
+     * @return a message read from a peer, nullptr if none could be read
+     */
+    NetworkMessage* receive(const fd_set* fdset);
+
+    const Statistics& statistics() const;
+
+private:
+    using Address = std::pair<uint32_t, uint32_t>;
+
+    /// A link a peer connected, with the epoch of the last fence written on it.
+    struct Incoming {
+        std::unique_ptr<SocketTCP> link;
+        FederateHandle federate;
+        uint32_t epoch;
+    };
+
+    /// What a peer sent, as far as the fences relayed by the RTIG let it through.
+    struct Sender {
+        /// epoch of the last fence relayed by the RTIG
+        uint32_t opened{0};
+        /// epoch of the last fence read from its links
+        uint32_t written{0};
+        /// messages read in an epoch after opened, in the order of reading
+        std::deque<std::pair<uint32_t, std::unique_ptr<NetworkMessage>>> held{};
+    };
+
+    /// Seconds a closing fence waits for the peer to write anything.
+    static constexpr long fence_timeout{10};
+
+    /// Link to every endpoint of route, false if one cannot be connected.
+    bool connect(const PeerRoutes::Route& route);
+
+    /// Fence the endpoints of route not sent to directly yet, false if a link was dropped.
+    bool open(const PeerRoutes::Route& route);
+
+    /// Write buffer to endpoints, false if a link failed and was dropped.
+    bool write(const std::vector<PeerRoutes::Endpoint>& endpoints, libhla::MessageBuffer& buffer);
+
+    /// Take the connection pending on my_server.
+    void accept();
+
+    /// An incoming link with data buffered, or found ready by select in fdset.
+    Incoming* findReady(const fd_set* fdset);
+
+    /// Read a message from link, nullptr unless it is to process now.
+    NetworkMessage* read(Incoming& link);
+
+    /// Read the links until federate wrote the fence of epoch.
+    void await(const FederateHandle federate, const uint32_t epoch);
+
+    std::unique_ptr<SocketTCP> my_server;
+    std::vector<Incoming> my_incoming{};
+    std::map<Address, std::unique_ptr<SocketTCP>> my_outgoing{};
+    /// endpoints a connection failed to, routes through them go through the RTIG
+    std::set<Address> my_unreachable{};
+
+    std::function<void(NetworkMessage&)> my_toRTIG;
+    Handle my_federation{0};
+    FederateHandle my_federate{0};
+    uint32_t my_epoch{0};
+    /// peers sent to directly since the last fence
+    std::map<Address, FederateHandle> my_direct{};
+
+    std::map<FederateHandle, Sender> my_senders{};
+    std::deque<std::unique_ptr<NetworkMessage>> my_ready{};
+
+    PeerRoutes my_routes{};
+    libhla::MessageBuffer my_buffer{};
+    Statistics my_statistics{};
+};
+
+std::ostream& operator<<(std::ostream& stream, const PeerNetwork::Statistics& statistics);
+}
+} // namespace certi/rtia
+
+#endif // _CERTI_RTIA_PEER_NETWORK_HH
@@ -26,15 +26,21 @@
 #include <limits.h>
 #include <math.h>
 
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/ObjectSet.hh>
+#include <libCERTI/PrettyDebug.hh>
+
 #include "RTIA.hh"
 
 namespace certi {
 namespace rtia {
 
+static PrettyDebug D("RTIA", "[RTIA] ");
+
 RTIA::RTIA(int RTIA_port, int RTIA_fd)
     : comm{RTIA_port, RTIA_fd}
     , fm{&comm}
-    , om{&comm, &fm, &my_root_object}
+    , om{&comm, &queues, &fm, &my_root_object}
     , owm{&comm, &fm}
     , dm{&comm, &fm, &my_root_object}
     , tm{&comm, &queues, &fm, &dm, &om, &owm}
@@ -63,6 +69,27 @@ void RTIA::displayStatistics()
 {
     if (stat.display()) {
         std::cout << stat;
+
+        const auto& compression = om.compression.statistics();
+        if (compression.compressed != 0 || compression.incompressible != 0 || compression.decompressed != 0) {
+            std::cout << compression;
+        }
+
+        if (auto peers = comm.peers()) {
+            std::cout << peers->statistics();
+        }
+    }
+}
+
+bool RTIA::acceptsPeerMessage(const NetworkMessage& message)
+{
+    switch (message.getMessageType()) {
+    case NetworkMessage::Type::RECEIVE_INTERACTION:
+    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES:
+        // held by the peer network until the discovery the RTIG sent before is read
+        return true;
+    default:
+        return false;
     }
 }
 
@@ -128,8 +155,28 @@ void RTIA::execute()
                 processOngoingTick();
             }
             break;
+        case Communications::ReadResult::FromPeer:
+            if (!acceptsPeerMessage(*msgFromRTIG)) {
+                delete msgFromRTIG;
+                break;
+            }
+            processNetworkMessage(msgFromRTIG);
+            if (tm._tick_state == TimeManagement::TICK_BLOCKING) {
+                processOngoingTick();
+            }
+            break;
         case Communications::ReadResult::FromFederate:
-            processFederateRequest(msgFromFederate);
+            if (tm._tick_state == TimeManagement::TICK_BLOCKING) {
+                // a federate calling services during a blocking tick (HLA_IMMEDIATE callback model)
+                // gets the callbacks its requests queued locally without waiting for the network
+                processFederateRequest(msgFromFederate);
+                if (tm._tick_state == TimeManagement::TICK_BLOCKING) {
+                    processOngoingTick();
+                }
+            }
+            else {
+                processFederateRequest(msgFromFederate);
+            }
             break;
         case Communications::ReadResult::Timeout:
             if (tm._tick_state == TimeManagement::TICK_BLOCKING) {
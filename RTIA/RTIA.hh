@@ -71,6 +71,9 @@ private:
     /// Process one message from RTIG (i.e. a NetworkMessage).
     void processNetworkMessage(NetworkMessage* request);
 
+    /// true if message, read from a peer RTIA, is an undated reflection or interaction to deliver.
+    bool acceptsPeerMessage(const NetworkMessage& message);
+
     /** Process a service request coming from the Federate (i.e. a Message).
      * An answer in sent inside the call.
      * @param[in,out] request the message request coming from the federate
@@ -23,6 +23,7 @@
 #include "RTIA.hh"
 
 #include <assert.h>
+#include <limits>
 #include <memory>
 
 #include <config.h>
@@ -301,6 +302,7 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
         }
 
         fm.resignFederationExecution(RFEq->getResignAction(), e);
+        om.clearLeasedObjectHandles();
     } break;
 
     case Message::REGISTER_FEDERATION_SYNCHRONIZATION_POINT: {
@@ -487,8 +489,9 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
                                                  UAVq->getAttributesSize(),
                                                  UAVq->getDate(),
                                                  UAVq->getTag(),
+                                                 UAVq->hasTraceId() ? UAVq->getTraceId() : 0,
                                                  e));
-            //FIXME event.setSendingFederate()
+            event.setSendingFederate(fm.getFederateHandle());
             UAVr->setEventRetraction(event);
             // answer should contains the date too
             UAVr->setDate(UAVq->getDate());
@@ -502,10 +505,38 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
                                      UAVq->getValues(),
                                      UAVq->getAttributesSize(),
                                      UAVq->getTag(),
+                                     UAVq->hasTraceId() ? UAVq->getTraceId() : 0,
                                      e);
         }
     } break;
 
+    case Message::BATCH_UPDATE_ATTRIBUTE_VALUES: {
+        auto BUAVq = static_cast<M_Batch_Update_Attribute_Values*>(request);
+        if (request->isDated()) {
+            Debug(D, pdTrace) << "Receiving Message from Federate, type BatchUpdateAttribValues with TIMESTAMP, "
+                              << BUAVq->getObjectsSize() << " objects." << std::endl;
+            om.batchUpdateAttributeValues(BUAVq->getObjects(),
+                                          BUAVq->getAttributeCounts(),
+                                          BUAVq->getAttributes(),
+                                          BUAVq->getValues(),
+                                          BUAVq->getDate(),
+                                          BUAVq->getTag(),
+                                          e);
+            // answer should contains the date too
+            answer->setDate(BUAVq->getDate());
+        }
+        else {
+            Debug(D, pdTrace) << "Receiving Message from Federate, type BatchUpdateAttribValues without TIMESTAMP, "
+                              << BUAVq->getObjectsSize() << " objects." << std::endl;
+            om.batchUpdateAttributeValues(BUAVq->getObjects(),
+                                          BUAVq->getAttributeCounts(),
+                                          BUAVq->getAttributes(),
+                                          BUAVq->getValues(),
+                                          BUAVq->getTag(),
+                                          e);
+        }
+    } break;
+
     case Message::SEND_INTERACTION: {
         M_Send_Interaction *SIr, *SIq;
         EventRetraction event;
@@ -523,6 +554,7 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
                                            SIq->getTag(),
                                            SIq->getRegion(),
                                            e));
+            event.setSendingFederate(fm.getFederateHandle());
             SIr->setEventRetraction(event);
         }
         else {
@@ -618,10 +650,19 @@ void RTIA::chooseFederateProcessing(Message* request, Message* answer, Exception
             RCAVUq->getObjectClass(), RCAVUq->getAttributes(), RCAVUq->getAttributesSize(), e);
     } break;
 
-    case Message::RETRACT:
-        std::cout << "retract not yet implemented in chooseFederateProcessing" << std::endl;
-        e = Exception::Type::UnimplementedService;
-        break;
+    case Message::RETRACT: {
+        auto Rq = static_cast<M_Retract*>(request);
+        Debug(D, pdTrace) << "Receiving Message from Federate, type Retract." << std::endl;
+
+        // only the events sent by this federate may be retracted
+        if (Rq->getEventRetraction().getSendingFederate() != fm.getFederateHandle()
+            || Rq->getEventRetraction().getSN() > std::numeric_limits<EventRetractionHandle>::max()) {
+            e = Exception::Type::InvalidRetractionHandle;
+        }
+        else {
+            om.retract(Rq->getEventRetraction().getSN(), e);
+        }
+    } break;
 
     case Message::UNCONDITIONAL_ATTRIBUTE_OWNERSHIP_DIVESTITURE: {
         M_Unconditional_Attribute_Ownership_Divestiture* UAODq;
@@ -1358,6 +1399,20 @@ void RTIA::processFederateRequest(Message* request)
             break;
 
         case FederationManagement::ConnectionState::Ready: {
+            if (request->getMessageType() != Message::DDM_MODIFY_REGION) {
+                ddm.commitRegionModifications();
+            }
+            else {
+                // the federate was answered before the RTIG refused the last
+                // modification of the region, the next one fails instead
+                std::string reason;
+                Exception::Type refusal = ddm.takeRegionModificationsRefusal(
+                    static_cast<M_Ddm_Modify_Region*>(request)->getRegion(), reason);
+                if (refusal != Exception::Type::NO_EXCEPTION) {
+                    rep->setException(refusal, reason);
+                    break;
+                }
+            }
             Exception::Type exc;
             chooseFederateProcessing(request, rep.get(), exc);
             if (exc != Exception::Type::RTIinternalError && exc != Exception::Type::NO_EXCEPTION) {
@@ -27,6 +27,7 @@
 
 #include <libCERTI/Interaction.hh>
 #include <libCERTI/InteractionSet.hh>
+#include <libCERTI/LatencyTrace.hh>
 #include <libCERTI/NM_Classes.hh>
 #include <libCERTI/ObjectClass.hh>
 #include <libCERTI/ObjectClassAttribute.hh>
@@ -133,9 +134,39 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
 
     } break;
 
+    case NetworkMessage::Type::DISCOVER_OBJECTS: {
+        NM_Discover_Objects* DOS = static_cast<NM_Discover_Objects*>(request);
+        Debug(D, pdTrace) << "Receving Message from RTIG, type NetworkMessage::DISCOVER_OBJECTS with "
+                          << DOS->getObjectsSize() << " objects." << std::endl;
+
+        // Unpack in one step, the federate is still given one discovery per tick.
+        for (uint32_t i = 0; i < DOS->getObjectsSize(); ++i) {
+            NM_Discover_Object* DO = new NM_Discover_Object();
+            DO->setFederation(DOS->getFederation());
+            DO->setFederate(DOS->getFederate());
+            DO->setException(DOS->getException());
+            DO->setObjectClass(DOS->getObjectClasses(i));
+            DO->setObject(DOS->getObjects(i));
+            DO->setLabel(DOS->getObjectNames(i));
+            queues.insertFifoMessage(DO);
+
+            try {
+                my_root_object.registerObjectInstance(
+                    fm.getFederateHandle(), DO->getObjectClass(), DO->getObject(), DO->getLabel());
+            }
+            catch (ObjectAlreadyRegistered&) {
+            }
+        }
+        delete request;
+    } break;
+
     case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
         NM_Reflect_Attribute_Values* RAV = static_cast<NM_Reflect_Attribute_Values*>(request);
         OrderType updateOrder;
+        const auto trace = LatencyTrace::traceOf(*RAV);
+        LatencyTrace::instance().stamp(trace, TraceSpan::Hop::RTIA_RECEIVE, fm.getFederateHandle());
+
+        om.compression.decompress(*RAV);
 
         //RAV->show(std::cerr);
         Debug(D, pdTrace) << "Receiving Message from RTIG, "
@@ -159,39 +190,69 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         }
         else {
             // Retrieve order type
-            updateOrder = TIMESTAMP;
             // FIXME we may inspect rootObject for an unknown object which has
             // (not yet) been discovered...because DiscoverObject is a RO message
             ObjectClassHandle och = my_root_object.objects->getObjectClass(RAV->getObject());
-            //std::cerr << "FOUND och = " <<och << "  for object " << RAV->getObject() <<std::endl;
-            for (uint32_t i = 0; i < RAV->getAttributesSize(); ++i) {
-                // FIXME we need an object **CLASS** handle and not an **OBJECT* handle
-                //if (rootObject->ObjectClasses->getObjectFromHandle(RAV->getObject())
-                if (my_root_object.ObjectClasses->getObjectFromHandle(och)->getAttribute(RAV->getAttributes(i))->order
-                    != TIMESTAMP) {
-                    updateOrder = RECEIVE;
-                    break;
-                }
-            }
+            // TIMESTAMP only if every attribute is, see above
+            auto fom = my_root_object.getCompiledFom();
+            updateOrder = fom->getObjectClass(och).timestamped.containsAll(RAV->getAttributes()) ? TIMESTAMP : RECEIVE;
         }
 
         // Decide which queue will be used
         if (updateOrder == TIMESTAMP && tm.requestContraintState()) {
             // Update is TSO
+            LatencyTrace::instance().stamp(trace, TraceSpan::Hop::RTIA_ENQUEUE_TSO, fm.getFederateHandle());
             queues.insertTsoMessage(request);
         }
         else {
             // Update is RO
+            LatencyTrace::instance().stamp(trace, TraceSpan::Hop::RTIA_ENQUEUE_FIFO, fm.getFederateHandle());
             queues.insertFifoMessage(request);
         }
 
         break;
     }
 
+    case NetworkMessage::Type::BATCH_REFLECT_ATTRIBUTE_VALUES: {
+        NM_Batch_Reflect_Attribute_Values* BRAV = static_cast<NM_Batch_Reflect_Attribute_Values*>(request);
+        Debug(D, pdTrace) << "Receving Message from RTIG, type NetworkMessage::BATCH_REFLECT_ATTRIBUTE_VALUES with "
+                          << BRAV->getObjectsSize() << " objects." << std::endl;
+
+        om.compression.decompress(*BRAV);
+
+        // Each record is queued as the reflection it would have been on its own
+        uint32_t first{0};
+        for (uint32_t i = 0; i < BRAV->getObjectsSize(); ++i) {
+            NM_Reflect_Attribute_Values* RAV = new NM_Reflect_Attribute_Values();
+            RAV->setFederation(BRAV->getFederation());
+            RAV->setFederate(BRAV->getFederate());
+            RAV->setException(BRAV->getException());
+            RAV->setObject(BRAV->getObjects(i));
+            if (BRAV->isDated()) {
+                RAV->setDate(BRAV->getDate());
+            }
+            if (BRAV->isLabelled()) {
+                RAV->setLabel(BRAV->getLabel());
+            }
+            const uint32_t last = first + BRAV->getAttributeCounts(i);
+            RAV->setAttributesSize(last - first);
+            RAV->setValuesSize(last - first);
+            for (uint32_t rank = first; rank < last; ++rank) {
+                RAV->setAttributes(BRAV->getAttributes(rank), rank - first);
+                RAV->setValues(BRAV->getValues(rank), rank - first);
+            }
+            first = last;
+            processNetworkMessage(RAV);
+        }
+        delete request;
+    } break;
+
     case NetworkMessage::Type::RECEIVE_INTERACTION: {
         NM_Receive_Interaction* RI = static_cast<NM_Receive_Interaction*>(request);
         OrderType interactionOrder;
 
+        om.compression.decompress(*RI);
+
         Debug(D, pdTrace) << "Receving Message from RTIG, type NetworkMessage::RECEIVE_INTERACTION." << std::endl;
 
         // Here we have to consider RAV without time
@@ -234,6 +295,25 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         break;
     }
 
+    case NetworkMessage::Type::REMOVE_OBJECTS: {
+        NM_Remove_Objects* ROS = static_cast<NM_Remove_Objects*>(request);
+        Debug(D, pdTrace) << "Receving Message from RTIG, type NetworkMessage::REMOVE_OBJECTS with "
+                          << ROS->getObjectsSize() << " objects." << std::endl;
+
+        // Unpack in one step, the federate is still given one removal per tick.
+        for (uint32_t i = 0; i < ROS->getObjectsSize(); ++i) {
+            NM_Remove_Object* RO = new NM_Remove_Object();
+            RO->setFederation(ROS->getFederation());
+            RO->setFederate(ROS->getFederate());
+            RO->setException(ROS->getException());
+            RO->setObjectClass(ROS->getObjectClass());
+            RO->setObject(ROS->getObjects(i));
+            RO->setLabel(ROS->getLabel());
+            queues.insertFifoMessage(RO);
+        }
+        delete request;
+    } break;
+
     case NetworkMessage::Type::INFORM_ATTRIBUTE_OWNERSHIP: {
         Debug(D, pdTrace) << "Receving Message from RTIG, "
                              "type NetworkMessage::INFORM_ATTRIBUTE_OWNERSHIP."
@@ -395,6 +475,18 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
                           << std::endl;
         queues.insertLastCommand(request);
         break;
+    case NetworkMessage::Type::DDM_MODIFY_REGIONS:
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type NetworkMessage::DDM_MODIFY_REGIONS." << std::endl;
+        ddm.regionModificationsAnswered(*request);
+        delete request;
+        break;
+
+    case NetworkMessage::Type::LEASE_OBJECT_HANDLES:
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type NetworkMessage::LEASE_OBJECT_HANDLES." << std::endl;
+        om.registrationFailed(*static_cast<NM_Lease_Object_Handles*>(request));
+        delete request;
+        break;
+
     case NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME_SUCCEEDED:
         Debug(D, pdTrace) << "Receiving Message from RTIG, "
                              " type reserveObjectInstanceNameSucceeded."
@@ -452,6 +544,53 @@ void RTIA::processNetworkMessage(NetworkMessage* request)
         break;
     }
     
+    case NetworkMessage::Type::PEER_ROUTE:
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type NetworkMessage::PEER_ROUTE." << std::endl;
+        if (auto peers = comm.peers()) {
+            peers->install(*static_cast<NM_Peer_Route*>(request));
+        }
+        delete request;
+        break;
+
+    case NetworkMessage::Type::PEER_ROUTES_INVALIDATED:
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type NetworkMessage::PEER_ROUTES_INVALIDATED." << std::endl;
+        // the routes were dropped and the RTIG answered as soon as it was received
+        delete request;
+        break;
+
+    case NetworkMessage::Type::PEER_FENCE:
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type NetworkMessage::PEER_FENCE." << std::endl;
+        if (auto peers = comm.peers()) {
+            peers->fence(*static_cast<NM_Peer_Fence*>(request));
+            // what the peer sent directly before comes before what the RTIG sent after
+            while (auto message = peers->takeReady()) {
+                if (acceptsPeerMessage(*message)) {
+                    processNetworkMessage(message);
+                }
+                else {
+                    delete message;
+                }
+            }
+        }
+        delete request;
+        break;
+
+    case NetworkMessage::Type::RETRACT: {
+        NM_Retract* retraction = static_cast<NM_Retract*>(request);
+        Debug(D, pdTrace) << "Receiving Message from RTIG, type NetworkMessage::RETRACT, event "
+                          << retraction->getEvent() << " of federate " << retraction->getFederate() << std::endl;
+
+        // cancelled if still waiting for its date, otherwise the federate retracts it
+        if (auto retracted = queues.retractTsoMessage(retraction->getFederate(), retraction->getEvent())) {
+            delete retracted;
+            delete request;
+        }
+        else {
+            queues.insertFifoMessage(request);
+        }
+        break;
+    }
+
     case NetworkMessage::Type::MOM_STATUS: {
         NM_Mom_Status* status = static_cast<NM_Mom_Status*>(request);
         Debug(D, pdTrace) << "Received mom status, enable=" << status->getMomState() << ", period=" << status->getUpdatePeriod() << std::endl;
@@ -25,8 +25,10 @@
 
 #include <float.h>
 
+#include <libCERTI/LatencyTrace.hh>
 #include <libCERTI/M_Classes.hh>
 #include <libCERTI/NM_Classes.hh>
+#include <libCERTI/TsoQueue.hh>
 
 namespace certi {
 namespace rtia {
@@ -819,7 +821,9 @@ bool TimeManagement::executeFederateService(NetworkMessage& msg)
                                        RAV.getAttributesSize(),
                                        msg.getDate(),
                                        msg.getLabel(),
-                                       msg.eventRetraction,
+                                       msg.getFederate(),
+                                       TsoQueue::eventOf(msg),
+                                       LatencyTrace::traceOf(RAV),
                                        msg.getRefException());
         else
             om->reflectAttributeValues(RAV.getObject(),
@@ -827,6 +831,7 @@ bool TimeManagement::executeFederateService(NetworkMessage& msg)
                                        RAV.getValues(),
                                        RAV.getAttributesSize(),
                                        msg.getLabel(),
+                                       LatencyTrace::traceOf(RAV),
                                        msg.getRefException());
         break;
     }
@@ -847,7 +852,8 @@ bool TimeManagement::executeFederateService(NetworkMessage& msg)
                                    RI.getParametersSize(),
                                    msg.getDate(),
                                    msg.getLabel(),
-                                   msg.eventRetraction,
+                                   msg.getFederate(),
+                                   TsoQueue::eventOf(msg),
                                    msg.getRefException());
         else
             om->receiveInteraction(RI.getInteractionClass(),
@@ -860,6 +866,12 @@ bool TimeManagement::executeFederateService(NetworkMessage& msg)
         break;
     }
 
+    case NetworkMessage::Type::RETRACT: {
+        NM_Retract& R = static_cast<NM_Retract&>(msg);
+        om->requestRetraction(R.getFederate(), R.getEvent());
+        break;
+    }
+
     case NetworkMessage::Type::REMOVE_OBJECT: {
         NM_Remove_Object& RO = static_cast<NM_Remove_Object&>(msg);
         if (msg.isDated()) {
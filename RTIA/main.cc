@@ -66,7 +66,9 @@ void NewHandler()
  * RTIA will try to connect to RTIG process on the machine specified in CERTI_HOME
  * (see \ref certi_user_env) environment variable. If it is void or not set then he will
  * try to connect to localhost. RTIA connect to TCP port specified by CERTI_TCP_PORT
- * and UDP port specified by CERTI_UDP_PORT.
+ * and UDP port specified by CERTI_UDP_PORT. With CERTI_PEER_TO_PEER set, it also
+ * listens on a TCP port chosen by the system for undated updates and interactions
+ * sent by the RTIAs of other federates.
  *
  * @ingroup certi_executable
  */
@@ -0,0 +1,265 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "Conflation.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+
+#include <libCERTI/Object.hh>
+#include <libCERTI/ObjectClass.hh>
+#include <libCERTI/ObjectClassSet.hh>
+#include <libCERTI/PrettyDebug.hh>
+#include <libCERTI/RootObject.hh>
+
+namespace {
+static constexpr auto classesEnvironmentVariable = "CERTI_CONFLATED_CLASSES";
+static constexpr auto depthEnvironmentVariable = "CERTI_CONFLATION_DEPTH";
+static constexpr size_t defaultDepth{4096};
+}
+
+namespace certi {
+namespace rtig {
+
+static PrettyDebug D("RTIG_CONFLATION", __FILE__);
+
+uint64_t ConflationQueue::push(const NM_Reflect_Attribute_Values& reflection)
+{
+    auto it = my_objects.find(reflection.getObject());
+    if (it == end(my_objects)) {
+        my_pending.emplace_back(new NM_Reflect_Attribute_Values(reflection));
+        my_objects.emplace(reflection.getObject(), my_pending.back().get());
+        my_depth += reflection.getAttributesSize();
+        return 0;
+    }
+
+    auto& pending = *it->second;
+    pending.setLabel(reflection.getLabel());
+
+    // compressed values keep their raw size along
+    const bool compressed = pending.getRawSizesSize() != 0 || reflection.getRawSizesSize() != 0;
+    if (compressed) {
+        pending.setRawSizesSize(pending.getAttributesSize());
+    }
+
+    uint64_t replaced{0};
+    for (uint32_t i = 0; i < reflection.getAttributesSize(); ++i) {
+        const auto& attributes = pending.getAttributes();
+        auto rank = std::find(begin(attributes), end(attributes), reflection.getAttributes(i)) - begin(attributes);
+        if (static_cast<uint32_t>(rank) < pending.getAttributesSize()) {
+            pending.setValues(reflection.getValues(i), rank);
+            ++replaced;
+        }
+        else {
+            pending.setAttributesSize(rank + 1);
+            pending.setValuesSize(rank + 1);
+            pending.setAttributes(reflection.getAttributes(i), rank);
+            pending.setValues(reflection.getValues(i), rank);
+            ++my_depth;
+        }
+        if (compressed) {
+            pending.setRawSizesSize(pending.getAttributesSize());
+            pending.setRawSizes(i < reflection.getRawSizesSize() ? reflection.getRawSizes(i) : 0, rank);
+        }
+    }
+    return replaced;
+}
+
+std::unique_ptr<NM_Reflect_Attribute_Values> ConflationQueue::pop()
+{
+    if (my_pending.empty()) {
+        return nullptr;
+    }
+    auto oldest = std::move(my_pending.front());
+    my_pending.pop_front();
+    my_objects.erase(oldest->getObject());
+    my_depth -= oldest->getAttributesSize();
+    return oldest;
+}
+
+bool ConflationQueue::empty() const
+{
+    return my_pending.empty();
+}
+
+size_t ConflationQueue::depth() const
+{
+    return my_depth;
+}
+
+Conflation::Conflation(const std::vector<std::string>& classes, const size_t max_depth)
+    : my_class_names(classes), my_max_depth(max_depth)
+{
+}
+
+Conflation Conflation::fromEnvironment()
+{
+    std::vector<std::string> classes;
+    if (auto classes_s = getenv(classesEnvironmentVariable)) {
+        std::istringstream stream(classes_s);
+        std::string name;
+        while (std::getline(stream, name, ',')) {
+            name.erase(0, name.find_first_not_of(" \t"));
+            name.erase(name.find_last_not_of(" \t") + 1);
+            if (!name.empty()) {
+                classes.push_back(name);
+            }
+        }
+    }
+
+    size_t depth{defaultDepth};
+    if (auto depth_s = getenv(depthEnvironmentVariable)) {
+        depth = std::stoul(depth_s);
+    }
+
+    return Conflation(classes, depth);
+}
+
+bool Conflation::isEnabled() const
+{
+    return !my_class_names.empty() && my_max_depth > 0;
+}
+
+bool Conflation::accepts(NM_Reflect_Attribute_Values& reflection, RootObject& root)
+{
+    // time stamp order and retractable reflections must all be delivered
+    if (!isEnabled() || reflection.isDated() || reflection.hasEvent()) {
+        return false;
+    }
+
+    try {
+        return optsIn(reflection.getFederation(), root.getObject(reflection.getObject())->getClass(), root);
+    }
+    catch (ObjectNotKnown& e) {
+        return false;
+    }
+}
+
+bool Conflation::optsIn(Handle federation, ObjectClassHandle klass, RootObject& root)
+{
+    auto& classes = my_classes[federation];
+    auto it = classes.find(klass);
+    if (it != end(classes)) {
+        return it->second;
+    }
+
+    std::set<ObjectClassHandle> listed;
+    for (const auto& name : my_class_names) {
+        try {
+            listed.insert(root.ObjectClasses->getObjectClassHandle(name));
+        }
+        catch (NameNotFound& e) {
+        }
+    }
+
+    bool opted_in{false};
+    for (ObjectClassHandle level = klass; level != 0 && !opted_in;
+         level = root.getObjectClass(level)->getSuperclass()) {
+        opted_in = listed.count(level) != 0;
+    }
+
+    Debug(D, pdDebug) << "Class " << klass << (opted_in ? " is" : " is not") << " conflated" << std::endl;
+    classes.emplace(klass, opted_in);
+    return opted_in;
+}
+
+void Conflation::resetClasses()
+{
+    my_classes.clear();
+}
+
+bool Conflation::hasPending() const
+{
+    return !my_queues.empty();
+}
+
+bool Conflation::hasPending(Socket* socket) const
+{
+    return my_queues.count(socket) != 0;
+}
+
+bool Conflation::push(Socket* socket, const NM_Reflect_Attribute_Values& reflection)
+{
+    auto& queue = my_queues[socket];
+    if (queue.depth() + reflection.getAttributesSize() > my_max_depth) {
+        if (queue.empty()) {
+            my_queues.erase(socket);
+        }
+        ++my_counters.overflows;
+        return false;
+    }
+
+    const auto replaced = queue.push(reflection);
+    my_counters.queued += reflection.getAttributesSize();
+    my_counters.conflated += replaced;
+    my_counters.max_depth = std::max<uint64_t>(my_counters.max_depth, queue.depth());
+    return true;
+}
+
+std::unique_ptr<NM_Reflect_Attribute_Values> Conflation::pop(Socket* socket)
+{
+    auto it = my_queues.find(socket);
+    if (it == end(my_queues)) {
+        return nullptr;
+    }
+    auto oldest = it->second.pop();
+    if (it->second.empty()) {
+        my_queues.erase(it);
+    }
+    if (oldest) {
+        ++my_counters.flushed;
+    }
+    return oldest;
+}
+
+std::vector<Socket*> Conflation::pendingSockets() const
+{
+    std::vector<Socket*> sockets;
+    for (const auto& kv : my_queues) {
+        sockets.push_back(kv.first);
+    }
+    return sockets;
+}
+
+void Conflation::forget(Socket* socket)
+{
+    my_queues.erase(socket);
+}
+
+const Conflation::Counters& Conflation::counters() const
+{
+    return my_counters;
+}
+
+void Conflation::dump(std::ostream& stream) const
+{
+    stream << "conflation\tall\tqueued\t" << my_counters.queued << '\n'
+           << "conflation\tall\tconflated\t" << my_counters.conflated << '\n'
+           << "conflation\tall\tflushed\t" << my_counters.flushed << '\n'
+           << "conflation\tall\toverflows\t" << my_counters.overflows << '\n'
+           << "conflation\tall\tmax_depth\t" << my_counters.max_depth << '\n';
+}
+
+} // namespace rtig
+} // namespace certi
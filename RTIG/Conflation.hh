@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_CONFLATION_HH
+#define CERTI_RTIG_CONFLATION_HH
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <libCERTI/Handle.hh>
+#include <libCERTI/NM_Classes.hh>
+
+namespace certi {
+
+class RootObject;
+class Socket;
+
+namespace rtig {
+
+/** Reflections waiting to be sent to one subscriber.
+ *
+ * Values are keyed by (object, attribute): a value pushed while an older one
+ * for the same key is still queued replaces it in place, so the subscriber
+ * only gets the latest one. Reflections are sent back oldest object first.
+ */
+class ConflationQueue {
+public:
+    /** Queue the values of reflection.
+     *
+     * @return the number of queued values that were replaced
+     */
+    uint64_t push(const NM_Reflect_Attribute_Values& reflection);
+
+    /// Remove and return the oldest pending reflection, nullptr if none.
+    std::unique_ptr<NM_Reflect_Attribute_Values> pop();
+
+    bool empty() const;
+
+    /// Number of (object, attribute) values queued.
+    size_t depth() const;
+
+private:
+    std::list<std::unique_ptr<NM_Reflect_Attribute_Values>> my_pending{};
+    std::unordered_map<ObjectHandle, NM_Reflect_Attribute_Values*> my_objects{};
+    size_t my_depth{0};
+};
+
+/** Latest-value conflation of reflections for slow subscribers.
+ *
+ * Only receive order reflections of object classes opted in are conflated.
+ * A class is opted in if it, or one of its superclasses, is listed in
+ * CERTI_CONFLATED_CLASSES (comma separated names). Each subscriber queues at
+ * most CERTI_CONFLATION_DEPTH values; beyond that the RTIG blocks on the
+ * subscriber again until its queue is flushed.
+ */
+class Conflation {
+public:
+    struct Counters {
+        /// values queued because the subscriber was not ready
+        uint64_t queued{0};
+        /// queued values replaced by a newer one, never sent
+        uint64_t conflated{0};
+        /// reflections sent from the queues
+        uint64_t flushed{0};
+        /// reflections refused because the queue was full
+        uint64_t overflows{0};
+        /// highest number of values queued for one subscriber
+        uint64_t max_depth{0};
+    };
+
+    Conflation(const std::vector<std::string>& classes, const size_t max_depth);
+
+    /// Read the configuration from CERTI_CONFLATED_CLASSES and CERTI_CONFLATION_DEPTH.
+    static Conflation fromEnvironment();
+
+    bool isEnabled() const;
+
+    /// true if reflection may be conflated, in the federation whose objects are in root.
+    bool accepts(NM_Reflect_Attribute_Values& reflection, RootObject& root);
+
+    /// Forget opted in classes resolved so far, because federations changed.
+    void resetClasses();
+
+    bool hasPending() const;
+    bool hasPending(Socket* socket) const;
+
+    /** Queue reflection for socket.
+     *
+     * @return false if the queue for socket is full, the caller must flush it and send reflection itself.
+     */
+    bool push(Socket* socket, const NM_Reflect_Attribute_Values& reflection);
+
+    /// Remove and return the oldest reflection pending for socket, nullptr if none.
+    std::unique_ptr<NM_Reflect_Attribute_Values> pop(Socket* socket);
+
+    /// Sockets with pending reflections.
+    std::vector<Socket*> pendingSockets() const;
+
+    /// Drop everything pending for socket, which is being closed.
+    void forget(Socket* socket);
+
+    const Counters& counters() const;
+
+    /// Write the counters as lines of the RTIG statistics table.
+    void dump(std::ostream& stream) const;
+
+private:
+    bool optsIn(Handle federation, ObjectClassHandle klass, RootObject& root);
+
+    std::vector<std::string> my_class_names;
+    size_t my_max_depth;
+
+    /// Per federation, whether each class seen so far is opted in
+    std::map<Handle, std::unordered_map<ObjectClassHandle, bool>> my_classes{};
+
+    std::unordered_map<Socket*, ConflationQueue> my_queues{};
+
+    Counters my_counters{};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_CONFLATION_HH
@@ -216,6 +216,52 @@ void Federate::setExceptionReportingSwitch(const bool val)
     my_exceptionReportingSwitch = val;
 }
 
+bool Federate::acceptsCompressedValues() const noexcept
+{
+    return my_acceptsCompressedValues;
+}
+
+void Federate::setAcceptsCompressedValues(const bool val) noexcept
+{
+    my_acceptsCompressedValues = val;
+}
+
+uint32_t Federate::peerAddress() const noexcept
+{
+    return my_peerAddress;
+}
+
+uint32_t Federate::peerPort() const noexcept
+{
+    return my_peerPort;
+}
+
+void Federate::setPeerEndpoint(const uint32_t address, const uint32_t port) noexcept
+{
+    my_peerAddress = address;
+    my_peerPort = port;
+}
+
+bool Federate::holdsPeerRoutes() const noexcept
+{
+    return my_holdsPeerRoutes;
+}
+
+void Federate::setHoldsPeerRoutes(const bool val) noexcept
+{
+    my_holdsPeerRoutes = val;
+}
+
+bool Federate::invalidatesPeerRoutes() const noexcept
+{
+    return my_invalidatesPeerRoutes;
+}
+
+void Federate::setInvalidatesPeerRoutes(const bool val) noexcept
+{
+    my_invalidatesPeerRoutes = val;
+}
+
 bool Federate::isSaving() const noexcept
 {
     return my_isCurrentlySaving;
@@ -138,6 +138,23 @@ public:
     bool isExceptionReportingSwitch() const noexcept;
     void setExceptionReportingSwitch(const bool val);
 
+    /// true if the federate negotiated compressed values at join.
+    bool acceptsCompressedValues() const noexcept;
+    void setAcceptsCompressedValues(const bool val) noexcept;
+
+    /// Address and port the federate takes peer to peer data on, port 0 if it takes none.
+    uint32_t peerAddress() const noexcept;
+    uint32_t peerPort() const noexcept;
+    void setPeerEndpoint(const uint32_t address, const uint32_t port) noexcept;
+
+    /// true if the federate was sent peer routes since they were last invalidated.
+    bool holdsPeerRoutes() const noexcept;
+    void setHoldsPeerRoutes(const bool val) noexcept;
+
+    /// true if the federate was told its peer routes no longer hold and did not answer yet.
+    bool invalidatesPeerRoutes() const noexcept;
+    void setInvalidatesPeerRoutes(const bool val) noexcept;
+
     bool isSaving() const noexcept;
 
     void setSaving(const bool s) noexcept;
@@ -194,6 +211,13 @@ private:
     bool my_serviceReportingSwitch{false};
     bool my_exceptionReportingSwitch{false};
 
+    bool my_acceptsCompressedValues{false};
+
+    uint32_t my_peerAddress{0};
+    uint32_t my_peerPort{0};
+    bool my_holdsPeerRoutes{false};
+    bool my_invalidatesPeerRoutes{false};
+
     bool my_isCurrentlySaving{false};
     bool my_isCurrentlyRestoring{false};
 
@@ -51,10 +51,12 @@
 #include <libCERTI/ObjectClassAttribute.hh>
 #include <libCERTI/ObjectClassSet.hh>
 #include <libCERTI/ObjectSet.hh>
+#include <libCERTI/PeerRoutes.hh>
 #include <libCERTI/PrettyDebug.hh>
 #include <libCERTI/RootObject.hh>
 #include <libCERTI/SecurityServer.hh>
 #include <libCERTI/SocketTCP.hh>
+#include <libCERTI/ValueCompression.hh>
 #include <libCERTI/XmlParser.hh>
 #include <libCERTI/XmlParser2000.hh>
 #include <libCERTI/XmlParser2010.hh>
@@ -142,6 +144,7 @@ Federation::Federation(const string& federation_name,
 
     // Read FOM File to initialize Root Object.
     my_root_object = make_unique<RootObject>(my_server.get());
+    my_serialized_fom = make_unique<rtig::SerializedFom>(*my_root_object);
 
     Debug(D, pdInit) << "New Federation <" << my_name << "> created with Handle <" << my_handle << ">, now reading FOM."
                      << endl;
@@ -269,8 +272,9 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
                                                      const RtiVersion rti_version,
                                                      SocketTCP* tcp_link,
                                                      const uint32_t peer,
-                                                     const uint32_t address
-                                                    )
+                                                     const uint32_t address,
+                                                     const bool compression,
+                                                     const uint32_t peer_port)
 {
     try {
         getFederate(federate_name);
@@ -288,6 +292,10 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
         std::make_pair(federate_handle, make_unique<Federate>(federate_name, federate_type, rti_version, federate_handle)));
 
     Federate& federate = *result.first->second;
+    federate.setAcceptsCompressedValues(compression && ValueCompression::isAvailable());
+    if (peer_port != 0 && tcp_link) {
+        federate.setPeerEndpoint(tcp_link->returnAdress(), peer_port);
+    }
 
     openFomModules(additional_fom_modules);
 
@@ -331,12 +339,10 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
         throw RTIinternalError("Network Error while initializing federate.");
     }
     
-    auto rep = make_unique<NM_Join_Federation_Execution>();
-    getFOM(*rep);
-    
-    auto fom_rep = make_unique<NM_Additional_Fom_Module>();
-    getFOM(*fom_rep);
-    
+    auto rep = my_serialized_fom->makeJoinResponse();
+
+    auto fom_rep = my_serialized_fom->makeAdditionalFomModule();
+
     auto fom_resp = respondToAll(std::move(fom_rep), federate_handle);
     responses.insert(end(responses), make_move_iterator(begin(fom_resp)), make_move_iterator(end(fom_resp)));
     
@@ -347,6 +353,7 @@ std::pair<FederateHandle, Responses> Federation::add(const string& federate_name
     rep->setNumberOfRegulators(getNbRegulators());
     rep->setBestEffortPeer(peer);
     rep->setBestEffortAddress(address);
+    rep->setCompression(federate.acceptsCompressedValues());
 
 // Now we have to answer about JoinFederationExecution
 #ifdef FEDERATION_USES_MULTICAST
@@ -395,6 +402,14 @@ Responses Federation::remove(FederateHandle federate_handle)
 
     my_federate_handle_generator.free(federate_handle);
 
+    auto leased = my_leased_object_handles.find(federate_handle);
+    if (leased != end(my_leased_object_handles)) {
+        for (const auto& handle : leased->second) {
+            my_objects_handle_generator.free(handle);
+        }
+        my_leased_object_handles.erase(leased);
+    }
+
     my_federates.erase(my_federates.find(federate_handle));
 
     if (my_mom) {
@@ -455,6 +470,14 @@ Responses Federation::kill(FederateHandle federate_handle) noexcept
         }
         catch (Exception& e) {
         }
+
+        // its peers must stop sending to it
+        try {
+            auto resp = invalidatePeerRoutes(federate_handle);
+            responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+        }
+        catch (Exception& e) {
+        }
     }
     catch (FederateNotExecutionMember& e) {
         Debug(D, pdInit) << "Federate " << federate_handle << " was not from this federation" << endl;
@@ -1116,7 +1139,10 @@ Responses Federation::publishObject(FederateHandle federate_handle,
         msg->setFederation(my_handle.get());
         msg->setObjectClass(object_handle);
 
-        responses = respondToSome(std::move(msg), {begin(federate_set), end(federate_set)});
+        auto notifications = respondToSome(std::move(msg), {begin(federate_set), end(federate_set)});
+        responses.insert(end(responses),
+                         make_move_iterator(begin(notifications)),
+                         make_move_iterator(end(notifications)));
     }
     else { // unsubscribe branch
         // test if objectClass is subscribed by anyone else
@@ -1158,12 +1184,11 @@ Responses Federation::subscribeObject(FederateHandle federate,
 {
     Debug(G, pdGendoc) << "enter Federation::subscribeObject" << endl;
 
-    Responses responses;
-
     check(federate);
 
     // It may throw AttributeNotDefined
-    my_root_object->ObjectClasses->subscribe(federate, object, attributes);
+    // The discoveries, if any, are sent before the subscription answer.
+    Responses responses = my_root_object->ObjectClasses->subscribe(federate, object, attributes);
 
     /*
      * The above code line (root->ObjectClasses->subscribe(...) calls the
@@ -1210,7 +1235,10 @@ Responses Federation::subscribeObject(FederateHandle federate,
         msg->setFederation(my_handle.get());
         msg->setObjectClass(object);
 
-        responses = respondToSome(std::move(msg), {begin(federate_set), end(federate_set)});
+        auto notifications = respondToSome(std::move(msg), {begin(federate_set), end(federate_set)});
+        responses.insert(end(responses),
+                         make_move_iterator(begin(notifications)),
+                         make_move_iterator(end(notifications)));
     }
     else { // unsubscribe branch
         /* test if objectClass is subscribed by anyone else
@@ -1243,11 +1271,11 @@ Responses Federation::subscribeObject(FederateHandle federate,
     return responses;
 }
 
-void Federation::reserveObjectInstanceName(FederateHandle theFederateHandle, string newObjName)
+Responses Federation::reserveObjectInstanceName(FederateHandle theFederateHandle, string newObjName)
 {
     Debug(G, pdGendoc) << "enter Federation::reserveObjectInstanceName" << endl;
-    Socket* socket;
-    NetworkMessage* msg;
+    Responses responses;
+    std::unique_ptr<NetworkMessage> msg;
 
     bool reservation_ok = my_root_object->reserveObjectInstanceName(theFederateHandle, newObjName);
 
@@ -1255,39 +1283,73 @@ void Federation::reserveObjectInstanceName(FederateHandle theFederateHandle, str
         Debug(G, pdGendoc) << "             =====> Object instance name reservation for MOM: "
                            << (reservation_ok ? "Success" : "Failure") << endl;
         Debug(G, pdGendoc) << "exit  Federation::reserveObjectInstanceName" << endl;
-        return;
+        return responses;
     }
 
     if (reservation_ok) {
-        msg = NM_Factory::create(NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME_SUCCEEDED);
-        NM_Reserve_Object_Instance_Name_Succeeded* okMsg
-            = dynamic_cast<NM_Reserve_Object_Instance_Name_Succeeded*>(msg);
+        auto okMsg = make_unique<NM_Reserve_Object_Instance_Name_Succeeded>();
 
         okMsg->setObjectName(newObjName);
-        Debug(G, pdGendoc) << "             =====> send message R_O_I_N_S to federate " << msg->getFederate() << endl;
+        Debug(G, pdGendoc) << "             =====> send message R_O_I_N_S to federate " << theFederateHandle << endl;
+        msg = std::move(okMsg);
     }
     else {
-        msg = NM_Factory::create(NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME_FAILED);
-        NM_Reserve_Object_Instance_Name_Failed* nokMsg = dynamic_cast<NM_Reserve_Object_Instance_Name_Failed*>(msg);
+        auto nokMsg = make_unique<NM_Reserve_Object_Instance_Name_Failed>();
 
         nokMsg->setObjectName(newObjName);
-        Debug(G, pdGendoc) << "             =====> send message R_O_I_N_F to federate " << msg->getFederate() << endl;
+        Debug(G, pdGendoc) << "             =====> send message R_O_I_N_F to federate " << theFederateHandle << endl;
+        msg = std::move(nokMsg);
     }
 
     msg->setFederation(my_handle.get());
     msg->setFederate(theFederateHandle);
-    // send message.
-    socket = my_server->getSocketLink(msg->getFederate());
-    msg->send(socket, my_nm_buffer);
+    responses.emplace_back(my_server->getSocketLink(theFederateHandle), std::move(msg));
 
-    delete msg;
     Debug(G, pdGendoc) << "exit  Federation::reserveObjectInstanceName" << endl;
+    return responses;
 }
 
-std::pair<ObjectHandle, Responses>
-Federation::registerObject(FederateHandle federate, ObjectClassHandle class_handle, const string& object_name)
+Responses Federation::leaseObjectHandles(FederateHandle federate, uint32_t count)
 {
-    ObjectHandle id = my_objects_handle_generator.provide();
+    check(federate);
+
+    auto rep = make_unique<NM_Lease_Object_Handles>();
+    rep->setFederate(federate);
+    rep->setFederation(my_handle.get());
+    rep->setCount(count);
+    rep->setObjectsSize(count);
+
+    auto& leased = my_leased_object_handles[federate];
+    for (uint32_t i{0u}; i < count; ++i) {
+        auto handle = my_objects_handle_generator.provide();
+        leased.insert(handle);
+        rep->setObjects(handle, i);
+    }
+
+    Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate << " leased " << count
+                         << " object handles, " << leased.size() << " unused" << endl;
+
+    Responses responses;
+    responses.emplace_back(my_server->getSocketLink(federate), std::move(rep));
+    return responses;
+}
+
+std::pair<ObjectHandle, Responses> Federation::registerObject(FederateHandle federate,
+                                                              ObjectClassHandle class_handle,
+                                                              const string& object_name,
+                                                              ObjectHandle leased_handle)
+{
+    ObjectHandle id{leased_handle};
+    if (leased_handle == 0) {
+        id = my_objects_handle_generator.provide();
+    }
+    else {
+        auto leased = my_leased_object_handles.find(federate);
+        if (leased == end(my_leased_object_handles) || leased->second.erase(leased_handle) == 0) {
+            throw RTIinternalError("Object handle " + std::to_string(leased_handle) + " was not leased by federate "
+                                   + std::to_string(federate));
+        }
+    }
     Responses responses;
 
     Debug(G, pdGendoc) << "enter Federation::registerObject" << endl;
@@ -1316,17 +1378,18 @@ Federation::registerObject(FederateHandle federate, ObjectClassHandle class_hand
         throw;
     }
 
-    // request.message()->getFederate(), request.message()->getObjectClass(), request.message()->getLabel()
-    auto rep = make_unique<NM_Register_Object>();
+    if (leased_handle == 0) {
+        auto rep = make_unique<NM_Register_Object>();
 
-    rep->setFederate(federate);
-    rep->setFederation(my_handle.get());
-    rep->setObjectClass(class_handle);
-    rep->setObject(id);
-    rep->setObjectName(strname);
-    rep->setLabel(strname);
+        rep->setFederate(federate);
+        rep->setFederation(my_handle.get());
+        rep->setObjectClass(class_handle);
+        rep->setObject(id);
+        rep->setObjectName(strname);
+        rep->setLabel(strname);
 
-    responses.emplace_back(my_server->getSocketLink(federate), std::move(rep));
+        responses.emplace_back(my_server->getSocketLink(federate), std::move(rep));
+    }
 
     if (my_mom) {
         auto resp = my_mom->updateObjectInstancesThatCanBeDeleted(federate);
@@ -1497,8 +1560,26 @@ Responses Federation::updateAttributeValues(FederateHandle federate,
                                             FederationTime time,
                                             const string& tag)
 {
-    Debug(G, pdGendoc) << "enter Federation::updateAttributeValues with time" << endl;
-    Responses responses;
+    return reportUpdate(federate, object_handle, routeAttributeValues(federate, object_handle, attributes, values, time, tag));
+}
+
+Responses Federation::updateAttributeValues(FederateHandle federate,
+                                            ObjectHandle object_handle,
+                                            const vector<AttributeHandle>& attributes,
+                                            const vector<AttributeValue_t>& values,
+                                            const string& tag)
+{
+    return reportUpdate(federate, object_handle, routeAttributeValues(federate, object_handle, attributes, values, tag));
+}
+
+Responses Federation::routeAttributeValues(FederateHandle federate,
+                                           ObjectHandle object_handle,
+                                           const vector<AttributeHandle>& attributes,
+                                           const vector<AttributeValue_t>& values,
+                                           FederationTime time,
+                                           const string& tag)
+{
+    Debug(G, pdGendoc) << "enter Federation::routeAttributeValues with time" << endl;
 
     check(federate);
 
@@ -1506,97 +1587,190 @@ Responses Federation::updateAttributeValues(FederateHandle federate,
     Object* object = my_root_object->objects->getObject(object_handle);
 
     // It may throw *NotDefined
-    responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, time, tag);
-
-    if (my_mom && federate != my_mom->getHandle()) {
-        std::map<FederateHandle, int> reflections;
-        for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (rep.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
-                    ++reflections[my_server->getFederateHandle(socket)];
-                }
-            }
-        }
+    auto responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, time, tag);
 
-        my_mom->registerUpdate(federate, object->getClass());
-
-        my_mom->registerObjectInstanceUpdated(federate, object->getClass(), object_handle);
-        auto resp = my_mom->updateUpdatesSent(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+    Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate << " updated attributes of Object "
+                         << object_handle << endl;
+    Debug(G, pdGendoc) << "exit  Federation::routeAttributeValues with time" << endl;
+    return responses;
+}
 
-        auto resp2 = my_mom->updateObjectInstancesUpdated(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+Responses Federation::routeAttributeValues(FederateHandle federate,
+                                           ObjectHandle object_handle,
+                                           const vector<AttributeHandle>& attributes,
+                                           const vector<AttributeValue_t>& values,
+                                           const string& tag)
+{
+    Debug(G, pdGendoc) << "enter Federation::routeAttributeValues without time" << endl;
 
-        for (const auto& r : reflections) {
-            my_mom->registerReflection(r.first, object->getClass());
+    check(federate);
 
-            my_mom->registerObjectInstanceReflected(r.first, object->getClass(), object_handle);
-            auto resp3 = my_mom->updateReflectionsReceived(r.first, r.second);
-            responses.insert(end(responses), make_move_iterator(begin(resp3)), make_move_iterator(end(resp3)));
+    // Get the object pointer by id from the root object
+    Object* object = my_root_object->objects->getObject(object_handle);
 
-            auto resp4 = my_mom->updateObjectInstancesReflected(r.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp4)), make_move_iterator(end(resp4)));
-        }
-    }
+    // It may throw *NotDefined
+    auto responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, tag);
 
     Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate << " updated attributes of Object "
                          << object_handle << endl;
-    Debug(G, pdGendoc) << "exit  Federation::updateAttributeValues with time" << endl;
+    Debug(G, pdGendoc) << "exit  Federation::routeAttributeValues without time" << endl;
     return responses;
 }
 
-Responses Federation::updateAttributeValues(FederateHandle federate,
-                                            ObjectHandle object_handle,
-                                            const vector<AttributeHandle>& attributes,
-                                            const vector<AttributeValue_t>& values,
-                                            const string& tag)
+Responses Federation::reportUpdate(FederateHandle federate, ObjectHandle object_handle, Responses&& responses)
 {
-    Debug(G, pdGendoc) << "enter Federation::updateAttributeValues without time" << endl;
-    Responses responses;
-
-    check(federate);
+    if (!my_mom || federate == my_mom->getHandle()) {
+        return std::move(responses);
+    }
 
-    // Get the object pointer by id from the root object
     Object* object = my_root_object->objects->getObject(object_handle);
 
-    // It may throw *NotDefined
-    responses = my_root_object->ObjectClasses->updateAttributeValues(federate, object, attributes, values, tag);
-
-    if (my_mom && federate != my_mom->getHandle()) {
-        std::map<FederateHandle, int> reflections;
-        for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (rep.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
-                    ++reflections[my_server->getFederateHandle(socket)];
-                }
+    std::map<FederateHandle, int> reflections;
+    for (const auto& rep : responses) {
+        for (const auto& socket : rep.sockets()) {
+            if (rep.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
+                ++reflections[my_server->getFederateHandle(socket)];
             }
         }
+    }
 
-        my_mom->registerUpdate(federate, object->getClass());
+    my_mom->registerUpdate(federate, object->getClass());
 
-        my_mom->registerObjectInstanceUpdated(federate, object->getClass(), object_handle);
-        auto resp = my_mom->updateUpdatesSent(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+    my_mom->registerObjectInstanceUpdated(federate, object->getClass(), object_handle);
+    auto resp = my_mom->updateUpdatesSent(federate);
+    responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
 
-        auto resp2 = my_mom->updateObjectInstancesUpdated(federate);
-        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+    auto resp2 = my_mom->updateObjectInstancesUpdated(federate);
+    responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+
+    for (const auto& r : reflections) {
+        my_mom->registerReflection(r.first, object->getClass());
 
-        for (const auto& r : reflections) {
-            my_mom->registerReflection(r.first, object->getClass());
+        my_mom->registerObjectInstanceReflected(r.first, object->getClass(), object_handle);
+        auto resp3 = my_mom->updateReflectionsReceived(r.first, r.second);
+        responses.insert(end(responses), make_move_iterator(begin(resp3)), make_move_iterator(end(resp3)));
+
+        auto resp4 = my_mom->updateObjectInstancesReflected(r.first);
+        responses.insert(end(responses), make_move_iterator(begin(resp4)), make_move_iterator(end(resp4)));
+    }
+
+    return std::move(responses);
+}
+
+Responses Federation::updateAttributeValues(FederateHandle federate,
+                                            const NM_Batch_Update_Attribute_Values& batch,
+                                            ValueCompression& compression)
+{
+    Debug(G, pdGendoc) << "enter Federation::updateAttributeValues batch" << endl;
+
+    uint64_t total{0};
+    for (const auto count : batch.getAttributeCounts()) {
+        total += count;
+    }
+    if (batch.getAttributeCountsSize() != batch.getObjectsSize() || total != batch.getAttributesSize()
+        || batch.getValuesSize() != batch.getAttributesSize()
+        || (batch.getRawSizesSize() != 0 && batch.getRawSizesSize() != batch.getAttributesSize())) {
+        throw RTIinternalError("Inconsistent batch of attribute updates.");
+    }
+
+    Responses responses;
+    std::vector<std::unique_ptr<NM_Batch_Reflect_Attribute_Values>> batches;
+    std::vector<Socket*> batch_sockets;
+    std::unordered_map<Socket*, NM_Batch_Reflect_Attribute_Values*> batch_of;
+
+    uint32_t first{0};
+    for (uint32_t i = 0; i < batch.getObjectsSize(); ++i) {
+        // Each record goes through the same routing as a single update
+        NM_Update_Attribute_Values record;
+        record.setObject(batch.getObjects(i));
+        const auto last = first + batch.getAttributeCounts(i);
+        record.setAttributesSize(last - first);
+        record.setValuesSize(last - first);
+        if (batch.getRawSizesSize() != 0) {
+            record.setRawSizesSize(last - first);
+        }
+        for (uint32_t rank = first; rank < last; ++rank) {
+            record.setAttributes(batch.getAttributes(rank), rank - first);
+            record.setValues(batch.getValues(rank), rank - first);
+            if (batch.getRawSizesSize() != 0) {
+                record.setRawSizes(batch.getRawSizes(rank), rank - first);
+            }
+        }
+        first = last;
+
+        auto record_responses
+            = batch.isDated()
+            ? updateAttributeValues(federate,
+                                    record.getObject(),
+                                    record.getAttributes(),
+                                    record.getValues(),
+                                    batch.getDate(),
+                                    batch.getLabel())
+            : updateAttributeValues(
+                  federate, record.getObject(), record.getAttributes(), record.getValues(), batch.getLabel());
+        record_responses = forwardCompressedValues(std::move(record_responses), record, compression);
+
+        for (auto& response : record_responses) {
+            auto reflection = dynamic_cast<NM_Reflect_Attribute_Values*>(response.message());
+            if (!reflection || reflection->getObject() != record.getObject()) {
+                responses.push_back(std::move(response));
+                continue;
+            }
 
-            my_mom->registerObjectInstanceReflected(r.first, object->getClass(), object_handle);
-            auto resp3 = my_mom->updateReflectionsReceived(r.first, r.second);
-            responses.insert(end(responses), make_move_iterator(begin(resp3)), make_move_iterator(end(resp3)));
+            for (auto socket : response.sockets()) {
+                auto& reflections = batch_of[socket];
+                if (!reflections) {
+                    batches.push_back(make_unique<NM_Batch_Reflect_Attribute_Values>());
+                    batch_sockets.push_back(socket);
+                    reflections = batches.back().get();
+                    reflections->setFederation(my_handle.get());
+                    reflections->setFederate(federate);
+                    if (batch.isDated()) {
+                        reflections->setDate(batch.getDate());
+                    }
+                    reflections->setLabel(batch.getLabel());
+                }
 
-            auto resp4 = my_mom->updateObjectInstancesReflected(r.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp4)), make_move_iterator(end(resp4)));
+                const auto rank = reflections->getObjectsSize();
+                reflections->setObjectsSize(rank + 1);
+                reflections->setAttributeCountsSize(rank + 1);
+                reflections->setObjects(reflection->getObject(), rank);
+                reflections->setAttributeCounts(reflection->getAttributesSize(), rank);
+
+                const auto offset = reflections->getAttributesSize();
+                const auto size = offset + reflection->getAttributesSize();
+                reflections->setAttributesSize(size);
+                reflections->setValuesSize(size);
+                // raw sizes are only sent along once some value is compressed
+                if (reflection->getRawSizesSize() != 0) {
+                    reflections->setRawSizesSize(offset);
+                }
+                if (reflections->getRawSizesSize() != 0) {
+                    reflections->setRawSizesSize(size);
+                }
+                for (uint32_t j = 0; j < reflection->getAttributesSize(); ++j) {
+                    reflections->setAttributes(reflection->getAttributes(j), offset + j);
+                    reflections->setValues(reflection->getValues(j), offset + j);
+                    if (reflections->getRawSizesSize() != 0) {
+                        reflections->setRawSizes(j < reflection->getRawSizesSize() ? reflection->getRawSizes(j) : 0,
+                                                 offset + j);
+                    }
+                }
+            }
         }
     }
 
-    Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate << " updated attributes of Object "
-                         << object_handle << endl;
-    Debug(G, pdGendoc) << "exit  Federation::updateAttributeValues without time" << endl;
-    return responses;
+    Responses batched;
+    batched.reserve(batches.size() + responses.size());
+    for (uint32_t i = 0; i < batches.size(); ++i) {
+        batched.emplace_back(std::vector<Socket*>{batch_sockets[i]}, std::move(batches[i]));
+    }
+    batched.insert(end(batched), make_move_iterator(begin(responses)), make_move_iterator(end(responses)));
+
+    Debug(D, pdRegister) << "Federation " << my_handle << ": Federate " << federate << " updated attributes of "
+                         << batch.getObjectsSize() << " objects for " << batches.size() << " subscribers" << endl;
+    Debug(G, pdGendoc) << "exit  Federation::updateAttributeValues batch" << endl;
+    return batched;
 }
 
 Responses Federation::publishInteraction(FederateHandle federate_handle,
@@ -1669,9 +1843,42 @@ Responses Federation::broadcastInteraction(FederateHandle federate_handle,
                                            RegionHandle region_handle,
                                            const string& tag)
 {
-    Debug(G, pdGendoc) << "enter Federation::broadcastInteraction with time" << endl;
+    return reportInteraction(
+        federate_handle,
+        interaction_class_handle,
+        parameter_handles,
+        parameter_values,
+        region_handle,
+        routeInteraction(
+            federate_handle, interaction_class_handle, parameter_handles, parameter_values, time, region_handle, tag));
+}
 
-    Responses responses;
+Responses Federation::broadcastInteraction(FederateHandle federate_handle,
+                                           InteractionClassHandle interaction_class_handle,
+                                           const vector<ParameterHandle>& parameter_handles,
+                                           const vector<ParameterValue_t>& parameter_values,
+                                           RegionHandle region_handle,
+                                           const string& tag)
+{
+    return reportInteraction(
+        federate_handle,
+        interaction_class_handle,
+        parameter_handles,
+        parameter_values,
+        region_handle,
+        routeInteraction(
+            federate_handle, interaction_class_handle, parameter_handles, parameter_values, region_handle, tag));
+}
+
+Responses Federation::routeInteraction(FederateHandle federate_handle,
+                                       InteractionClassHandle interaction_class_handle,
+                                       const vector<ParameterHandle>& parameter_handles,
+                                       const vector<ParameterValue_t>& parameter_values,
+                                       FederationTime time,
+                                       RegionHandle region_handle,
+                                       const string& tag)
+{
+    Debug(G, pdGendoc) << "enter Federation::routeInteraction with time" << endl;
 
     check(federate_handle);
 
@@ -1680,14 +1887,14 @@ Responses Federation::broadcastInteraction(FederateHandle federate_handle,
         region = my_root_object->getRegion(region_handle);
     }
 
-    responses = my_root_object->Interactions->broadcastInteraction(federate_handle,
-                                                                   interaction_class_handle,
-                                                                   parameter_handles,
-                                                                   parameter_values,
-                                                                   parameter_handles.size(),
-                                                                   time,
-                                                                   region,
-                                                                   tag);
+    auto responses = my_root_object->Interactions->broadcastInteraction(federate_handle,
+                                                                        interaction_class_handle,
+                                                                        parameter_handles,
+                                                                        parameter_values,
+                                                                        parameter_handles.size(),
+                                                                        time,
+                                                                        region,
+                                                                        tag);
     Debug(D, pdRequest) << "Federation " << my_handle << ": Broadcasted Interaction <"
                         << my_root_object->Interactions->getInteractionClassName(interaction_class_handle)
                         << "> from Federate <" << federate_handle << "> nb params " << parameter_handles.size() << endl;
@@ -1698,50 +1905,19 @@ Responses Federation::broadcastInteraction(FederateHandle federate_handle,
                             << "> = <" << string(&(parameter_values[i][0]), parameter_values[i].size()) << ">" << endl;
     }
 
-    if (my_mom) {
-        std::map<FederateHandle, int> interactions;
-        for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (socket && rep.message()->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION) {
-                    ++interactions[my_server->getFederateHandle(socket)];
-                }
-            }
-        }
-
-        my_mom->registerInteractionSent(federate_handle, interaction_class_handle);
-        auto resp = my_mom->updateInteractionsSent(federate_handle);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
-
-        for (const auto& i : interactions) {
-            my_mom->registerInteractionReceived(i.first, interaction_class_handle);
-            auto resp2 = my_mom->updateInteractionsReceived(i.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
-        }
-
-        if (my_root_object->Interactions->getObjectFromHandle(interaction_class_handle)
-                ->isSubscribed(my_mom->getHandle())) {
-            auto mom_responses = my_mom->processInteraction(
-                /*federate_handle, */ interaction_class_handle, parameter_handles, parameter_values, region_handle);
-            responses.insert(
-                end(responses), make_move_iterator(begin(mom_responses)), make_move_iterator(end(mom_responses)));
-        }
-    }
-
-    Debug(G, pdGendoc) << "exit Federation::broadcastInteraction with time" << endl;
+    Debug(G, pdGendoc) << "exit Federation::routeInteraction with time" << endl;
 
     return responses;
 }
 
-Responses Federation::broadcastInteraction(FederateHandle federate_handle,
-                                           InteractionClassHandle interaction_class_handle,
-                                           const vector<ParameterHandle>& parameter_handles,
-                                           const vector<ParameterValue_t>& parameter_values,
-                                           RegionHandle region_handle,
-                                           const string& tag)
+Responses Federation::routeInteraction(FederateHandle federate_handle,
+                                       InteractionClassHandle interaction_class_handle,
+                                       const vector<ParameterHandle>& parameter_handles,
+                                       const vector<ParameterValue_t>& parameter_values,
+                                       RegionHandle region_handle,
+                                       const string& tag)
 {
-    Debug(G, pdGendoc) << "enter Federation::broadcastInteraction without time" << endl;
-
-    Responses responses;
+    Debug(G, pdGendoc) << "enter Federation::routeInteraction without time" << endl;
 
     check(federate_handle);
 
@@ -1750,13 +1926,13 @@ Responses Federation::broadcastInteraction(FederateHandle federate_handle,
         region = my_root_object->getRegion(region_handle);
     }
 
-    responses = my_root_object->Interactions->broadcastInteraction(federate_handle,
-                                                                   interaction_class_handle,
-                                                                   parameter_handles,
-                                                                   parameter_values,
-                                                                   parameter_handles.size(),
-                                                                   region,
-                                                                   tag);
+    auto responses = my_root_object->Interactions->broadcastInteraction(federate_handle,
+                                                                        interaction_class_handle,
+                                                                        parameter_handles,
+                                                                        parameter_values,
+                                                                        parameter_handles.size(),
+                                                                        region,
+                                                                        tag);
     Debug(D, pdRequest) << "Federation " << my_handle << ": Broadcasted Interaction <"
                         << my_root_object->Interactions->getInteractionClassName(interaction_class_handle)
                         << "> from Federate <" << federate_handle << "> nb params " << parameter_handles.size() << endl;
@@ -1767,38 +1943,383 @@ Responses Federation::broadcastInteraction(FederateHandle federate_handle,
                             << "> = <" << string(&(parameter_values[i][0]), parameter_values[i].size()) << ">" << endl;
     }
 
-    if (my_mom) {
-        std::map<FederateHandle, int> interactions;
-        for (const auto& rep : responses) {
-            for (const auto& socket : rep.sockets()) {
-                if (rep.message()->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION) {
-                    ++interactions[my_server->getFederateHandle(socket)];
-                }
+    Debug(G, pdGendoc) << "exit Federation::routeInteraction without time" << endl;
+
+    return responses;
+}
+
+Responses Federation::reportInteraction(FederateHandle federate_handle,
+                                        InteractionClassHandle interaction_class_handle,
+                                        const vector<ParameterHandle>& parameter_handles,
+                                        const vector<ParameterValue_t>& parameter_values,
+                                        RegionHandle region_handle,
+                                        Responses&& responses)
+{
+    if (!my_mom) {
+        return std::move(responses);
+    }
+
+    std::map<FederateHandle, int> interactions;
+    for (const auto& rep : responses) {
+        for (const auto& socket : rep.sockets()) {
+            if (socket && rep.message()->getMessageType() == NetworkMessage::Type::RECEIVE_INTERACTION) {
+                ++interactions[my_server->getFederateHandle(socket)];
             }
         }
+    }
 
-        my_mom->registerInteractionSent(federate_handle, interaction_class_handle);
-        auto resp = my_mom->updateInteractionsSent(federate_handle);
-        responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+    my_mom->registerInteractionSent(federate_handle, interaction_class_handle);
+    auto resp = my_mom->updateInteractionsSent(federate_handle);
+    responses.insert(end(responses), make_move_iterator(begin(resp)), make_move_iterator(end(resp)));
+
+    for (const auto& i : interactions) {
+        my_mom->registerInteractionReceived(i.first, interaction_class_handle);
+        auto resp2 = my_mom->updateInteractionsReceived(i.first);
+        responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+    }
+
+    if (my_root_object->Interactions->getObjectFromHandle(interaction_class_handle)->isSubscribed(my_mom->getHandle())) {
+        auto mom_responses = my_mom->processInteraction(
+            /*federate_handle, */ interaction_class_handle, parameter_handles, parameter_values, region_handle);
+        responses.insert(
+            end(responses), make_move_iterator(begin(mom_responses)), make_move_iterator(end(mom_responses)));
+    }
+
+    return std::move(responses);
+}
+
+namespace {
+/** Set the raw sizes of the forwarded messages of responses, from the values sent.
+ *
+ * handlesOf gives the attributes or parameters of a forwarded message, in
+ * the same space as handles.
+ */
+template <typename Forwarded, typename IsForwarded, typename HandlesOf, typename AcceptsCompression>
+Responses forwardRawSizes(Responses&& responses,
+                          const std::vector<Handle>& handles,
+                          const std::vector<uint32_t>& raw_sizes,
+                          IsForwarded isForwarded,
+                          HandlesOf handlesOf,
+                          AcceptsCompression acceptsCompression,
+                          ValueCompression& compression)
+{
+    std::unordered_map<Handle, uint32_t> raw_size_of;
+    for (uint32_t i{0}; i < handles.size() && i < raw_sizes.size(); ++i) {
+        raw_size_of.emplace(handles[i], raw_sizes[i]);
+    }
+
+    Responses forwarded;
+    forwarded.reserve(responses.size());
+    for (auto& response : responses) {
+        auto message = dynamic_cast<Forwarded*>(response.message());
+        if (!message || !isForwarded(*message)) {
+            forwarded.push_back(std::move(response));
+            continue;
+        }
+
+        const auto& message_handles = handlesOf(*message);
+        message->setRawSizesSize(message_handles.size());
+        for (uint32_t i{0}; i < message_handles.size(); ++i) {
+            auto it = raw_size_of.find(message_handles[i]);
+            message->setRawSizes(it == end(raw_size_of) ? 0 : it->second, i);
+        }
+
+        std::vector<Socket*> compressed_sockets;
+        std::vector<Socket*> plain_sockets;
+        for (auto socket : response.sockets()) {
+            (!socket || acceptsCompression(socket) ? compressed_sockets : plain_sockets).push_back(socket);
+        }
+
+        if (plain_sockets.empty()) {
+            forwarded.push_back(std::move(response));
+            continue;
+        }
+
+        auto plain = make_unique<Forwarded>(*message);
+        compression.decompress(*plain);
+        if (!compressed_sockets.empty()) {
+            forwarded.emplace_back(compressed_sockets, make_unique<Forwarded>(*message));
+        }
+        forwarded.emplace_back(plain_sockets, std::move(plain));
+    }
+    return forwarded;
+}
+}
+
+Responses Federation::forwardCompressedValues(Responses&& responses,
+                                              const NM_Update_Attribute_Values& request,
+                                              ValueCompression& compression)
+{
+    if (request.getRawSizesSize() == 0) {
+        return std::move(responses);
+    }
 
-        for (const auto& i : interactions) {
-            my_mom->registerInteractionReceived(i.first, interaction_class_handle);
-            auto resp2 = my_mom->updateInteractionsReceived(i.first);
-            responses.insert(end(responses), make_move_iterator(begin(resp2)), make_move_iterator(end(resp2)));
+    const auto object = request.getObject();
+    const auto compressing = compressingSockets();
+    return forwardRawSizes<NM_Reflect_Attribute_Values>(
+        std::move(responses),
+        request.getAttributes(),
+        request.getRawSizes(),
+        [object](const NM_Reflect_Attribute_Values& reflection) { return reflection.getObject() == object; },
+        [](const NM_Reflect_Attribute_Values& reflection) -> const std::vector<AttributeHandle>& {
+            return reflection.getAttributes();
+        },
+        [&compressing](Socket* socket) { return compressing.count(socket) != 0; },
+        compression);
+}
+
+Responses Federation::forwardCompressedValues(Responses&& responses,
+                                              const NM_Send_Interaction& request,
+                                              ValueCompression& compression)
+{
+    if (request.getRawSizesSize() == 0) {
+        return std::move(responses);
+    }
+
+    const auto interaction_class = request.getInteractionClass();
+    const auto compressing = compressingSockets();
+    return forwardRawSizes<NM_Receive_Interaction>(
+        std::move(responses),
+        request.getParameters(),
+        request.getRawSizes(),
+        [interaction_class](const NM_Receive_Interaction& interaction) {
+            return interaction.getInteractionClass() == interaction_class;
+        },
+        [](const NM_Receive_Interaction& interaction) -> const std::vector<ParameterHandle>& {
+            return interaction.getParameters();
+        },
+        [&compressing](Socket* socket) { return compressing.count(socket) != 0; },
+        compression);
+}
+
+std::unordered_set<Socket*> Federation::compressingSockets() const
+{
+    std::unordered_set<Socket*> sockets;
+    for (const auto& kv : my_federates) {
+        if (kv.second->acceptsCompressedValues()) {
+            sockets.insert(my_server->getSocketLink(kv.first));
         }
+    }
+    return sockets;
+}
 
-        if (my_root_object->Interactions->getObjectFromHandle(interaction_class_handle)
-                ->isSubscribed(my_mom->getHandle())) {
-            auto mom_responses = my_mom->processInteraction(
-                /*federate_handle, */ interaction_class_handle, parameter_handles, parameter_values, region_handle);
-            responses.insert(
-                end(responses), make_move_iterator(begin(mom_responses)), make_move_iterator(end(mom_responses)));
+std::unique_ptr<NM_Peer_Route> Federation::peerRoute(const NM_Update_Attribute_Values& request,
+                                                     const Responses& responses)
+{
+    const auto object = request.getObject();
+    auto route = peerRoute(
+        request.getFederate(), responses, [object](const NetworkMessage& message, PeerRoutes::Group& group) {
+            if (message.getMessageType() != NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
+                return false;
+            }
+            auto& reflection = static_cast<const NM_Reflect_Attribute_Values&>(message);
+            if (reflection.getObject() != object) {
+                return false;
+            }
+            group.handles.assign(begin(reflection.getAttributes()), end(reflection.getAttributes()));
+            return true;
+        });
+    if (route) {
+        route->setObject(object);
+        route->setKeysSize(request.getAttributesSize());
+        for (uint32_t i = 0; i < request.getAttributesSize(); ++i) {
+            route->setKeys(request.getAttributes(i), i);
         }
     }
+    return route;
+}
 
-    Debug(G, pdGendoc) << "exit Federation::broadcastInteraction without time" << endl;
+std::unique_ptr<NM_Peer_Route> Federation::peerRoute(const NM_Send_Interaction& request, const Responses& responses)
+{
+    // the MOM is no peer
+    if (readsParameters(request.getInteractionClass())) {
+        return nullptr;
+    }
 
-    return responses;
+    auto route = peerRoute(request.getFederate(), responses, [](const NetworkMessage& message, PeerRoutes::Group& group) {
+        if (message.getMessageType() != NetworkMessage::Type::RECEIVE_INTERACTION) {
+            return false;
+        }
+        auto& interaction = static_cast<const NM_Receive_Interaction&>(message);
+        group.interactionClass = interaction.getInteractionClass();
+        group.handles.assign(begin(interaction.getParameters()), end(interaction.getParameters()));
+        return true;
+    });
+    if (route) {
+        route->setInteractionClass(request.getInteractionClass());
+        route->setRegion(request.getRegion());
+        route->setKeysSize(request.getParametersSize());
+        for (uint32_t i = 0; i < request.getParametersSize(); ++i) {
+            route->setKeys(request.getParameters(i), i);
+        }
+    }
+    return route;
+}
+
+Responses Federation::invalidatePeerRoutes(const FederateHandle requester)
+{
+    std::vector<FederateHandle> holders;
+    for (const auto& kv : my_federates) {
+        if (kv.second->holdsPeerRoutes()) {
+            kv.second->setHoldsPeerRoutes(false);
+            if (kv.first != requester) {
+                kv.second->setInvalidatesPeerRoutes(true);
+                holders.push_back(kv.first);
+            }
+        }
+    }
+    if (holders.empty()) {
+        return {};
+    }
+
+    Debug(D, pdDebug) << "Peer routes of " << holders.size() << " federates invalidated" << endl;
+    auto invalidated = make_unique<NM_Peer_Routes_Invalidated>();
+    invalidated->setFederation(my_handle.get());
+    return respondToSome(std::move(invalidated), holders);
+}
+
+bool Federation::awaitsPeerRoutes() const
+{
+    // a federate gone is no longer waited for
+    for (const auto& kv : my_federates) {
+        if (kv.second->invalidatesPeerRoutes()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Federation::peerRoutesInvalidated(const FederateHandle federate)
+{
+    getFederate(federate).setInvalidatesPeerRoutes(false);
+}
+
+Responses Federation::relayPeerFence(const NM_Peer_Fence& fence)
+{
+    std::vector<FederateHandle> peers;
+    for (const auto& peer : fence.getPeers()) {
+        if (my_federates.count(peer) != 0) {
+            peers.push_back(peer);
+        }
+    }
+    if (peers.empty()) {
+        return {};
+    }
+
+    auto relayed = make_unique<NM_Peer_Fence>();
+    relayed->setFederation(my_handle.get());
+    relayed->setFederate(fence.getFederate());
+    relayed->setEpoch(fence.getEpoch());
+    relayed->setClosing(fence.getClosing());
+    return respondToSome(std::move(relayed), peers);
+}
+
+std::unique_ptr<NM_Peer_Route>
+Federation::peerRoute(FederateHandle sender,
+                      const Responses& responses,
+                      const std::function<bool(const NetworkMessage&, PeerRoutes::Group&)>& describe)
+{
+    auto it = my_federates.find(sender);
+    if (it == end(my_federates) || it->second->peerPort() == 0 || awaitsPeerRoutes()) {
+        return nullptr;
+    }
+    const bool compressing = it->second->acceptsCompressedValues();
+
+    // the federates a link goes to, among those which take peer to peer data
+    std::unordered_map<Socket*, const Federate*> peers;
+    for (const auto& kv : my_federates) {
+        if (kv.first != sender && kv.second->peerPort() != 0) {
+            try {
+                peers.emplace(my_server->getSocketLink(kv.first), kv.second.get());
+            }
+            catch (Exception& e) {
+            }
+        }
+    }
+
+    auto route = make_unique<NM_Peer_Route>();
+    route->setFederation(my_handle.get());
+    route->setFederate(sender);
+    for (const auto& response : responses) {
+        PeerRoutes::Group group{0, {}, {}};
+        if (!describe(*response.message(), group)) {
+            return nullptr;
+        }
+        for (const auto& socket : response.sockets()) {
+            auto peer = peers.find(socket);
+            if (peer == end(peers) || (compressing && !peer->second->acceptsCompressedValues())) {
+                return nullptr;
+            }
+            group.endpoints.push_back(
+                {peer->second->getHandle(), peer->second->peerAddress(), peer->second->peerPort()});
+        }
+        PeerRoutes::append(*route, group);
+    }
+
+    it->second->setHoldsPeerRoutes(true);
+    return route;
+}
+
+std::vector<FederateHandle>
+Federation::markRetractable(FederateHandle federate_handle, EventRetractionHandle event, Responses& responses)
+{
+    std::vector<FederateHandle> receivers;
+    for (auto& response : responses) {
+        auto message = response.message();
+        // the MOM answers on its own behalf
+        if (message->getFederate() != federate_handle) {
+            continue;
+        }
+        if (auto reflection = dynamic_cast<NM_Reflect_Attribute_Values*>(message)) {
+            reflection->setEvent(event);
+        }
+        else if (auto interaction = dynamic_cast<NM_Receive_Interaction*>(message)) {
+            interaction->setEvent(event);
+        }
+        else {
+            continue;
+        }
+        for (auto socket : response.sockets()) {
+            receivers.push_back(my_server->getFederateHandle(socket));
+        }
+    }
+
+    std::sort(begin(receivers), end(receivers));
+    receivers.erase(std::unique(begin(receivers), end(receivers)), end(receivers));
+
+    Debug(D, pdDebug) << "Event " << event << " of federate " << federate_handle << " sent to " << receivers.size()
+                      << " federates" << endl;
+    return receivers;
+}
+
+Responses Federation::retract(FederateHandle federate_handle,
+                              EventRetractionHandle event,
+                              const std::vector<FederateHandle>& receivers)
+{
+    check(federate_handle);
+
+    std::vector<FederateHandle> members;
+    std::copy_if(begin(receivers), end(receivers), back_inserter(members), [this](const FederateHandle receiver) {
+        return my_federates.count(receiver) != 0;
+    });
+    if (members.empty()) {
+        return {};
+    }
+
+    Debug(D, pdDebug) << "Event " << event << " of federate " << federate_handle << " retracted at "
+                      << members.size() << " federates" << endl;
+    auto retraction = make_unique<NM_Retract>();
+    retraction->setFederation(my_handle.get());
+    retraction->setFederate(federate_handle);
+    retraction->setEvent(event);
+    return respondToSome(std::move(retraction), members);
+}
+
+bool Federation::readsParameters(InteractionClassHandle interaction_class_handle) const
+{
+    return my_mom
+        && my_root_object->Interactions->getObjectFromHandle(interaction_class_handle)->isSubscribed(
+               my_mom->getHandle());
 }
 
 bool Federation::isOwner(FederateHandle federate_handle, ObjectHandle object_handle, AttributeHandle attribute_handle)
@@ -1811,16 +2332,16 @@ bool Federation::isOwner(FederateHandle federate_handle, ObjectHandle object_han
     return my_root_object->objects->isAttributeOwnedByFederate(federate_handle, object_handle, attribute_handle);
 }
 
-void Federation::queryAttributeOwnership(FederateHandle federate_handle,
-                                         ObjectHandle object_handle,
-                                         AttributeHandle attribute_handle)
+Responses Federation::queryAttributeOwnership(FederateHandle federate_handle,
+                                              ObjectHandle object_handle,
+                                              AttributeHandle attribute_handle)
 {
     check(federate_handle);
 
     Debug(D, pdDebug) << "Owner of Object " << object_handle << " Atrribute " << attribute_handle << endl;
 
     // It may throw *NotDefined
-    my_root_object->objects->queryAttributeOwnership(federate_handle, object_handle, attribute_handle);
+    return my_root_object->objects->queryAttributeOwnership(federate_handle, object_handle, attribute_handle);
 }
 
 Responses Federation::negotiateDivestiture(FederateHandle federate_handle,
@@ -1838,9 +2359,9 @@ Responses Federation::negotiateDivestiture(FederateHandle federate_handle,
         federate_handle, object, attribs, tag);
 }
 
-void Federation::acquireIfAvailable(FederateHandle federate_handle,
-                                    ObjectHandle object_handle,
-                                    const vector<AttributeHandle>& attribs)
+Responses Federation::acquireIfAvailable(FederateHandle federate_handle,
+                                         ObjectHandle object_handle,
+                                         const vector<AttributeHandle>& attribs)
 {
     check(federate_handle);
 
@@ -1848,7 +2369,7 @@ void Federation::acquireIfAvailable(FederateHandle federate_handle,
     Object* object = my_root_object->objects->getObject(object_handle);
 
     // It may throw *NotDefined
-    my_root_object->ObjectClasses->attributeOwnershipAcquisitionIfAvailable(federate_handle, object, attribs);
+    return my_root_object->ObjectClasses->attributeOwnershipAcquisitionIfAvailable(federate_handle, object, attribs);
 }
 
 Responses
@@ -1874,10 +2395,10 @@ Federation::divest(FederateHandle federate_handle, ObjectHandle object_handle, c
     return responses;
 }
 
-void Federation::acquire(FederateHandle federate_handle,
-                         ObjectHandle object_handle,
-                         const vector<AttributeHandle>& attributes,
-                         const string& tag)
+Responses Federation::acquire(FederateHandle federate_handle,
+                              ObjectHandle object_handle,
+                              const vector<AttributeHandle>& attributes,
+                              const string& tag)
 {
     check(federate_handle);
 
@@ -1885,9 +2406,12 @@ void Federation::acquire(FederateHandle federate_handle,
     Object* object = my_root_object->objects->getObject(object_handle);
 
     // It may throw *NotDefined
-    my_root_object->ObjectClasses->attributeOwnershipAcquisition(federate_handle, object, attributes, tag);
+    auto responses
+        = my_root_object->ObjectClasses->attributeOwnershipAcquisition(federate_handle, object, attributes, tag);
 
     Debug(D, pdDebug) << "Acquisition on Object " << object_handle << endl;
+
+    return responses;
 }
 
 void Federation::cancelDivestiture(FederateHandle federate_handle,
@@ -1902,9 +2426,9 @@ void Federation::cancelDivestiture(FederateHandle federate_handle,
     Debug(D, pdDebug) << "CancelDivestiture sur Objet " << id << endl;
 }
 
-AttributeHandleSet* Federation::respondRelease(FederateHandle federate_handle,
-                                               ObjectHandle object_handle,
-                                               const vector<AttributeHandle>& attributes)
+std::pair<AttributeHandleSet*, Responses> Federation::respondRelease(FederateHandle federate_handle,
+                                                                     ObjectHandle object_handle,
+                                                                     const vector<AttributeHandle>& attributes)
 {
     check(federate_handle);
 
@@ -1917,9 +2441,9 @@ AttributeHandleSet* Federation::respondRelease(FederateHandle federate_handle,
     return my_root_object->ObjectClasses->attributeOwnershipReleaseResponse(federate_handle, object, attributes);
 }
 
-void Federation::cancelAcquisition(FederateHandle federate_handle,
-                                   ObjectHandle object_handle,
-                                   const vector<AttributeHandle>& attributes)
+Responses Federation::cancelAcquisition(FederateHandle federate_handle,
+                                        ObjectHandle object_handle,
+                                        const vector<AttributeHandle>& attributes)
 {
     check(federate_handle);
 
@@ -1929,7 +2453,7 @@ void Federation::cancelAcquisition(FederateHandle federate_handle,
     Object* object = my_root_object->objects->getObject(object_handle);
 
     // It may throw *NotDefined
-    my_root_object->ObjectClasses->cancelAttributeOwnershipAcquisition(federate_handle, object, attributes);
+    return my_root_object->ObjectClasses->cancelAttributeOwnershipAcquisition(federate_handle, object, attributes);
 }
 
 long Federation::createRegion(FederateHandle federate_handle, SpaceHandle space_handle, long extents_count)
@@ -1945,6 +2469,32 @@ void Federation::modifyRegion(FederateHandle federate_handle, RegionHandle regio
     my_root_object->modifyRegion(region, extents);
 }
 
+void Federation::modifyRegions(FederateHandle federate_handle,
+                               const vector<RegionHandle>& regions,
+                               const vector<vector<Extent>>& extents)
+{
+    check(federate_handle);
+
+    if (regions.size() != extents.size()) {
+        throw InvalidExtents("Not as many extent sets as regions");
+    }
+
+    vector<RTIRegion*> modified;
+    modified.reserve(regions.size());
+    for (size_t i{0u}; i < regions.size(); ++i) {
+        modified.push_back(my_root_object->getRegion(regions[i]));
+        if (modified.back()->getNumberOfExtents() != extents[i].size()) {
+            throw InvalidExtents("Different number of extents for region " + std::to_string(regions[i]));
+        }
+    }
+
+    for (size_t i{0u}; i < modified.size(); ++i) {
+        modified[i]->replaceExtents(extents[i]);
+    }
+
+    Debug(D, pdDebug) << "Federate " << federate_handle << " modified " << regions.size() << " region(s)" << endl;
+}
+
 void Federation::deleteRegion(FederateHandle federate_handle, long region)
 {
     check(federate_handle);
@@ -1984,13 +2534,14 @@ void Federation::unassociateRegion(FederateHandle federate_handle, ObjectHandle
     my_root_object->getObject(object)->unassociate(region);
 }
 
-void Federation::subscribeAttributesWR(FederateHandle federate_handle,
-                                       ObjectClassHandle c,
-                                       RegionHandle region_handle,
-                                       const vector<AttributeHandle>& attributes)
+Responses Federation::subscribeAttributesWR(FederateHandle federate_handle,
+                                            ObjectClassHandle c,
+                                            RegionHandle region_handle,
+                                            const vector<AttributeHandle>& attributes)
 {
     check(federate_handle);
-    my_root_object->ObjectClasses->subscribe(federate_handle, c, attributes, my_root_object->getRegion(region_handle));
+    return my_root_object->ObjectClasses->subscribe(
+        federate_handle, c, attributes, my_root_object->getRegion(region_handle));
 }
 
 void Federation::unsubscribeAttributesWR(FederateHandle federate_handle,
@@ -2077,12 +2628,12 @@ Responses Federation::updateAsynchronousDelivery(FederateHandle federate_handle,
 
 void Federation::getFOM(NM_Join_Federation_Execution& object_model_data)
 {
-    my_root_object->convertToSerializedFOM(object_model_data);
+    my_serialized_fom->copyTo(object_model_data);
 }
 
 void Federation::getFOM(NM_Additional_Fom_Module& object_model_data)
 {
-    my_root_object->convertToSerializedFOM(object_model_data);
+    my_serialized_fom->copyTo(object_model_data);
 }
 
 bool Federation::updateLastNERxForFederate(FederateHandle federate_handle, FederationTime date)
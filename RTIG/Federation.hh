@@ -24,6 +24,7 @@
 #define _CERTI_RTIG_FEDERATION_HH
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <set>
 #include <string>
@@ -31,6 +32,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <include/certi.hh>
 
@@ -41,10 +43,12 @@
 #include <libCERTI/HandleManager.hh>
 #include <libCERTI/LBTS.hh>
 #include <libCERTI/MessageEvent.hh>
+#include <libCERTI/PeerRoutes.hh>
 #include <libHLA/MessageBuffer.hh>
 
 #include "Federate.hh"
 #include "Mom.hh"
+#include "SerializedFom.hh"
 
 #ifdef FEDERATION_USES_MULTICAST
 #include "SocketMC.hh"
@@ -54,13 +58,19 @@ namespace certi {
 class AttributeHandleSet;
 class AuditFile;
 class Extent;
+class NM_Batch_Update_Attribute_Values;
 class NM_Join_Federation_Execution;
+class NM_Peer_Fence;
+class NM_Peer_Route;
 class NM_Resign_Federation_Execution;
+class NM_Send_Interaction;
+class NM_Update_Attribute_Values;
 class NetworkMessage;
 class RootObject;
 class SecurityServer;
 class SocketServer;
 class SocketTCP;
+class ValueCompression;
 
 namespace rtig {
 class Mom;
@@ -157,6 +167,12 @@ public:
      * 
      * Also send Null messages from all others federates to initialize its LBTS, and
      * finally a RequestPause message if the Federation is already paused.
+     *
+     * The federate is sent compressed values if it asked for compression and
+     * the RTIG is built with zlib, the join answer tells it so.
+     *
+     * A federate giving a peer_port takes peer to peer data on that port, at
+     * the address its tcp_link comes from.
      */
     std::pair<FederateHandle, Responses> add(const std::string& federate_name,
                                              const std::string& federate_type,
@@ -164,7 +180,9 @@ public:
                                              const RtiVersion rti_version,
                                              SocketTCP* tcp_link,
                                              const uint32_t peer,
-                                             const uint32_t address);
+                                             const uint32_t address,
+                                             const bool compression = false,
+                                             const uint32_t peer_port = 0);
 
     /** Remove a federate.
      * 
@@ -295,10 +313,30 @@ public:
                               const std::vector<AttributeHandle>& attributes,
                               const bool subscribe_or_unsubscribe);
 
-    void reserveObjectInstanceName(FederateHandle federate_handle, std::string object_name);
+    Responses reserveObjectInstanceName(FederateHandle federate_handle, std::string object_name);
+
+    /** Reserve object handles for the later registrations of a federate.
+     *
+     * The federate uses them to register objects locally, then announces each
+     * registration with the leased handle. Handles not used by the time the
+     * federate leaves the federation are freed.
+     *
+     * @param federate_handle the federate leasing the handles
+     * @param count the number of handles requested
+     * @return the NM_Lease_Object_Handles answer listing the leased handles
+     */
+    Responses leaseObjectHandles(FederateHandle federate_handle, uint32_t count);
 
-    std::pair<ObjectHandle, Responses>
-    registerObject(FederateHandle federate_handle, ObjectClassHandle class_handle, const std::string& name);
+    /** Registers an object instance.
+     *
+     * @param leased_handle a handle previously leased by federate_handle,
+     * or 0 to get a new one. A leased registration was already answered by
+     * the federate's RTIA, so no NM_Register_Object answer is added.
+     */
+    std::pair<ObjectHandle, Responses> registerObject(FederateHandle federate_handle,
+                                                      ObjectClassHandle class_handle,
+                                                      const std::string& name,
+                                                      ObjectHandle leased_handle = 0);
 
     /** Removes an object instance from federation.
      * 
@@ -341,6 +379,38 @@ public:
                                     const std::vector<AttributeValue_t>& attribute_values,
                                     const std::string& tag);
 
+    /** Route an update of the attributes of object to their subscribers.
+     *
+     * The routing only reads the federation: updates of different objects
+     * may be routed at once on several threads, as long as no other request
+     * is processed meanwhile. reportUpdate() completes the update.
+     */
+    Responses routeAttributeValues(FederateHandle federate_handle,
+                                   ObjectHandle object_handle,
+                                   const std::vector<AttributeHandle>& attributes,
+                                   const std::vector<AttributeValue_t>& attribute_values,
+                                   FederationTime time,
+                                   const std::string& tag);
+
+    Responses routeAttributeValues(FederateHandle federate_handle,
+                                   ObjectHandle object_handle,
+                                   const std::vector<AttributeHandle>& attributes,
+                                   const std::vector<AttributeValue_t>& attribute_values,
+                                   const std::string& tag);
+
+    /// Report the update routed to responses to the MOM, followed by its own responses.
+    Responses reportUpdate(FederateHandle federate_handle, ObjectHandle object_handle, Responses&& responses);
+
+    /** Update the attributes of every object of batch, with its date and tag.
+     *
+     * The reflections are gathered in one NM_Batch_Reflect_Attribute_Values
+     * per subscriber, decompressed with compression for the federates which
+     * did not negotiate it.
+     */
+    Responses updateAttributeValues(FederateHandle federate_handle,
+                                    const NM_Batch_Update_Attribute_Values& batch,
+                                    ValueCompression& compression);
+
     // ----------------------------
     // -- Interaction Management --
     // ----------------------------
@@ -370,44 +440,139 @@ public:
                                    RegionHandle region,
                                    const std::string& tag);
 
+    /// Route an interaction to its subscribers, on any thread as routeAttributeValues().
+    Responses routeInteraction(FederateHandle federate_handle,
+                               InteractionClassHandle interaction_class_handle,
+                               const std::vector<ParameterHandle>& parameters,
+                               const std::vector<ParameterValue_t>& parameters_values,
+                               FederationTime time,
+                               RegionHandle region,
+                               const std::string& tag);
+
+    Responses routeInteraction(FederateHandle federate_handle,
+                               InteractionClassHandle interaction_class_handle,
+                               const std::vector<ParameterHandle>& parameters,
+                               const std::vector<ParameterValue_t>& parameters_values,
+                               RegionHandle region,
+                               const std::string& tag);
+
+    /// Report the interaction routed to responses to the MOM, followed by its own responses.
+    Responses reportInteraction(FederateHandle federate_handle,
+                                InteractionClassHandle interaction_class_handle,
+                                const std::vector<ParameterHandle>& parameters,
+                                const std::vector<ParameterValue_t>& parameters_values,
+                                RegionHandle region,
+                                Responses&& responses);
+
+    // -----------------------
+    // -- Value Compression --
+    // -----------------------
+
+    /** Forward the uncompressed sizes of the values of request to the reflections it caused.
+     *
+     * Compressed values are forwarded untouched, federates which did not
+     * negotiate compression are sent a copy decompressed with compression.
+     */
+    Responses forwardCompressedValues(Responses&& responses,
+                                      const NM_Update_Attribute_Values& request,
+                                      ValueCompression& compression);
+
+    /// Same for the interactions caused by request.
+    Responses forwardCompressedValues(Responses&& responses,
+                                      const NM_Send_Interaction& request,
+                                      ValueCompression& compression);
+
+    /// true if the RTIG itself reads the parameters of interaction class, which must then be decompressed.
+    bool readsParameters(InteractionClassHandle interaction_class_handle) const;
+
+    // ------------------
+    // -- Peer to Peer --
+    // ------------------
+
+    /** Route of the next undated updates like request, read from the reflections it caused.
+     *
+     * nullptr if the sender takes no peer to peer data, while routes are
+     * invalidated, if the responses hold
+     * anything else than reflections of the object, or if one of them goes to
+     * a federate which takes no peer to peer data or could not read the
+     * values as the sender compresses them.
+     */
+    std::unique_ptr<NM_Peer_Route> peerRoute(const NM_Update_Attribute_Values& request, const Responses& responses);
+
+    /// Same for the next undated interactions like request.
+    std::unique_ptr<NM_Peer_Route> peerRoute(const NM_Send_Interaction& request, const Responses& responses);
+
+    /** Tell the federates holding peer routes that they no longer hold.
+     *
+     * Until each of them answered, see awaitsPeerRoutes(), no route is
+     * given. requester, whose request invalidates the routes, dropped its own
+     * ones already and is not told.
+     */
+    Responses invalidatePeerRoutes(const FederateHandle requester = 0);
+
+    /// true while a federate told its peer routes no longer hold did not answer.
+    bool awaitsPeerRoutes() const;
+
+    /// federate answered that it stopped using its peer routes.
+    void peerRoutesInvalidated(const FederateHandle federate);
+
+    /// Send the fence of a federate switching between the RTIG and its peer links to the peers it lists.
+    Responses relayPeerFence(const NM_Peer_Fence& fence);
+
+    // ----------------
+    // -- Retraction --
+    // ----------------
+
+    /** Tag the reflections and interactions sent on behalf of federate with event.
+     *
+     * @return the federates they go to, which the sender gives back to retract the event.
+     */
+    std::vector<FederateHandle>
+    markRetractable(FederateHandle federate_handle, EventRetractionHandle event, Responses& responses);
+
+    /// Tell the receivers of event, except the ones which resigned since, that federate retracted it.
+    Responses retract(FederateHandle federate_handle,
+                      EventRetractionHandle event,
+                      const std::vector<FederateHandle>& receivers);
+
     // --------------------------
     // -- Ownership Management --
     // --------------------------
 
     bool isOwner(FederateHandle federate_handle, ObjectHandle object_handle, AttributeHandle attribute_handle);
 
-    void queryAttributeOwnership(FederateHandle federate_handle,
-                                 ObjectHandle object_handle,
-                                 AttributeHandle attribute_handle);
+    Responses queryAttributeOwnership(FederateHandle federate_handle,
+                                      ObjectHandle object_handle,
+                                      AttributeHandle attribute_handle);
 
     Responses negotiateDivestiture(FederateHandle federate_handle,
                                    ObjectHandle object_handle,
                                    const std::vector<AttributeHandle>& attributes,
                                    const std::string& tag);
 
-    void acquireIfAvailable(FederateHandle federate_handle,
-                            ObjectHandle object_handle,
-                            const std::vector<AttributeHandle>& attributes);
+    Responses acquireIfAvailable(FederateHandle federate_handle,
+                                 ObjectHandle object_handle,
+                                 const std::vector<AttributeHandle>& attributes);
 
     Responses
     divest(FederateHandle federate_handle, ObjectHandle object_handle, const std::vector<AttributeHandle>& attributes);
 
-    void acquire(FederateHandle federate_handle,
-                 ObjectHandle object_handle,
-                 const std::vector<AttributeHandle>& attributes,
-                 const std::string& tag);
+    Responses acquire(FederateHandle federate_handle,
+                      ObjectHandle object_handle,
+                      const std::vector<AttributeHandle>& attributes,
+                      const std::string& tag);
 
     void cancelDivestiture(FederateHandle federate_handle,
                            ObjectHandle object_handle,
                            const std::vector<AttributeHandle>& attributes);
 
-    AttributeHandleSet* respondRelease(FederateHandle federate_handle,
-                                       ObjectHandle object_handle,
-                                       const std::vector<AttributeHandle>& attributes);
+    std::pair<AttributeHandleSet*, Responses> respondRelease(FederateHandle federate_handle,
+                                                             ObjectHandle object_handle,
+                                                             const std::vector<AttributeHandle>& attributes);
 
-    void cancelAcquisition(FederateHandle federate_handle,
-                           ObjectHandle object_handle,
-                           const std::vector<AttributeHandle>& attributes);
+    Responses cancelAcquisition(FederateHandle federate_handle,
+                                ObjectHandle object_handle,
+                                const std::vector<AttributeHandle>& attributes);
 
     // Data Distribution Management
 
@@ -415,6 +580,15 @@ public:
 
     void modifyRegion(FederateHandle federate_handle, RegionHandle region_handle, const std::vector<Extent>& extents);
 
+    /** Modify many regions at once.
+     *
+     * regions[i] gets extents[i]. Every region is checked before any is
+     * modified, so that the modifications are applied all or none.
+     */
+    void modifyRegions(FederateHandle federate_handle,
+                       const std::vector<RegionHandle>& regions,
+                       const std::vector<std::vector<Extent>>& extents);
+
     // FIXME second arguments should be region_handle ?
     void deleteRegion(FederateHandle federate_handle, long region);
 
@@ -425,10 +599,10 @@ public:
 
     void unassociateRegion(FederateHandle federate_handle, ObjectHandle, RegionHandle);
 
-    void subscribeAttributesWR(FederateHandle federate_handle,
-                               ObjectClassHandle object_class_handle,
-                               RegionHandle region_handle,
-                               const std::vector<AttributeHandle>& attributes);
+    Responses subscribeAttributesWR(FederateHandle federate_handle,
+                                    ObjectClassHandle object_class_handle,
+                                    RegionHandle region_handle,
+                                    const std::vector<AttributeHandle>& attributes);
 
     void unsubscribeAttributesWR(FederateHandle federate_handle,
                                  ObjectClassHandle object_class_handle,
@@ -487,6 +661,14 @@ private:
 
     void openFomModules(std::vector<std::string> modules, const bool is_mim = false);
 
+    /// Links of the federates which negotiated compressed values.
+    std::unordered_set<Socket*> compressingSockets() const;
+
+    /// Route of the messages sent by sender, describe telling the handles and class of each response.
+    std::unique_ptr<NM_Peer_Route> peerRoute(FederateHandle sender,
+                                             const Responses& responses,
+                                             const std::function<bool(const NetworkMessage&, PeerRoutes::Group&)>& describe);
+
     bool saveXmlData();
     bool restoreXmlData(std::string docFilename);
 
@@ -515,6 +697,9 @@ private:
     std::unique_ptr<SecurityServer> my_server;
     std::unique_ptr<RootObject> my_root_object;
 
+    /// FOM sent to joining federates, invalidated when modules are added.
+    std::unique_ptr<rtig::SerializedFom> my_serialized_fom;
+
     /// The minimum NERx timestamp for this federation
     FederationTime my_min_NERx{};
 
@@ -533,6 +718,9 @@ private:
     HandleManager<FederateHandle> my_federate_handle_generator{1};
     HandleManager<ObjectHandle> my_objects_handle_generator{1};
 
+    /// Object handles leased by each federate and not registered yet.
+    std::unordered_map<FederateHandle, std::set<ObjectHandle>> my_leased_object_handles{};
+
     bool my_is_save_in_progress{false};
     bool my_is_restore_in_progress{false};
     bool my_save_status{true}; /// True if saving was correctly done, false otherwise.
@@ -323,6 +323,8 @@ void Federation::openFomModules(std::vector<std::string> modules, const bool is_
 
             Debug(D, pdDebug) << "  Add to current root object" << std::endl;
             parseModuleInto(module_path, file_type, *my_root_object, true);
+            my_serialized_fom->invalidate();
+            my_root_object->refreshCompiledFom();
 
             Debug(D, pdDebug) << "  Update path to module" << std::endl;
             if(is_mim) {
@@ -1,6 +1,7 @@
 #include "MessageProcessor.hh"
 
 #include <iostream>
+#include <tuple>
 
 #include <include/certi.hh>
 
@@ -10,6 +11,7 @@
 #include <libCERTI/GAV.hh>
 #include <libCERTI/HandleManager.hh>
 #include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/PeerRoutes.hh>
 #include <libCERTI/PrettyDebug.hh>
 #include <libCERTI/Socket.hh>
 #include <libCERTI/SocketServer.hh>
@@ -42,6 +44,11 @@ MessageProcessor::MessageProcessor(AuditFile& audit_server,
 {
 }
 
+const ValueCompression& MessageProcessor::compression() const
+{
+    return my_compression;
+}
+
 Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
 {
 #define xstr(a) str(a)
@@ -57,6 +64,7 @@ Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
         BASIC_CASE(RESIGN_FEDERATION_EXECUTION, NM_Resign_Federation_Execution);
         BASIC_CASE(MESSAGE_NULL_PRIME, NM_Message_Null_Prime);
         BASIC_CASE(UPDATE_ATTRIBUTE_VALUES, NM_Update_Attribute_Values);
+        BASIC_CASE(BATCH_UPDATE_ATTRIBUTE_VALUES, NM_Batch_Update_Attribute_Values);
         BASIC_CASE(SEND_INTERACTION, NM_Send_Interaction);
         BASIC_CASE(CREATE_FEDERATION_EXECUTION, NM_Create_Federation_Execution);
         BASIC_CASE(DESTROY_FEDERATION_EXECUTION, NM_Destroy_Federation_Execution);
@@ -87,6 +95,7 @@ Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
         BASIC_CASE(SET_ATTRIBUTE_RELEVANCE_ADVISORY_SWITCH, NM_Set_Attribute_Relevance_Advisory_Switch);
         BASIC_CASE(SET_ATTRIBUTE_SCOPE_ADVISORY_SWITCH, NM_Set_Attribute_Scope_Advisory_Switch);
         BASIC_CASE(RESERVE_OBJECT_INSTANCE_NAME, NM_Reserve_Object_Instance_Name);
+        BASIC_CASE(LEASE_OBJECT_HANDLES, NM_Lease_Object_Handles);
         BASIC_CASE(REGISTER_OBJECT, NM_Register_Object);
         BASIC_CASE(DELETE_OBJECT, NM_Delete_Object);
         BASIC_CASE(IS_ATTRIBUTE_OWNED_BY_FEDERATE, NM_Is_Attribute_Owned_By_Federate);
@@ -101,6 +110,7 @@ Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
         BASIC_CASE(CANCEL_ATTRIBUTE_OWNERSHIP_ACQUISITION, NM_Cancel_Attribute_Ownership_Acquisition);
         BASIC_CASE(DDM_CREATE_REGION, NM_DDM_Create_Region);
         BASIC_CASE(DDM_MODIFY_REGION, NM_DDM_Modify_Region);
+        BASIC_CASE(DDM_MODIFY_REGIONS, NM_DDM_Modify_Regions);
         BASIC_CASE(DDM_DELETE_REGION, NM_DDM_Delete_Region);
         BASIC_CASE(DDM_REGISTER_OBJECT, NM_DDM_Register_Object);
         BASIC_CASE(DDM_ASSOCIATE_REGION, NM_DDM_Associate_Region);
@@ -112,6 +122,9 @@ Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
         BASIC_CASE(ENABLE_ASYNCHRONOUS_DELIVERY, NM_Enable_Asynchronous_Delivery);
         BASIC_CASE(DISABLE_ASYNCHRONOUS_DELIVERY, NM_Disable_Asynchronous_Delivery);
         BASIC_CASE(TIME_STATE_UPDATE, NM_Time_State_Update);
+        BASIC_CASE(RETRACT, NM_Retract);
+        BASIC_CASE(PEER_ROUTES_INVALIDATED, NM_Peer_Routes_Invalidated);
+        BASIC_CASE(PEER_FENCE, NM_Peer_Fence);
 
     case NetworkMessage::Type::CLOSE_CONNEXION:
         throw RTIinternalError("Close connection: Should have been handled by RTIG");
@@ -126,6 +139,103 @@ Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request)
     }
 }
 
+Responses MessageProcessor::processEvent(MessageEvent<NetworkMessage> request, Responses routed)
+{
+    switch (request.message()->getMessageType()) {
+    case NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES:
+        return process(MessageEvent<NM_Update_Attribute_Values>{std::move(request)}, std::move(routed));
+    case NetworkMessage::Type::SEND_INTERACTION:
+        return process(MessageEvent<NM_Send_Interaction>{std::move(request)}, std::move(routed));
+    default:
+        throw RTIinternalError("Message type not routed apart");
+    }
+}
+
+Responses MessageProcessor::invalidatePeerRoutes(const NetworkMessage& request)
+{
+    if (PeerRoutes::keepsRoutes(request.getMessageType())) {
+        return {};
+    }
+    try {
+        return my_federations.searchFederation(FederationHandle(request.getFederation()))
+            .invalidatePeerRoutes(request.getFederate());
+    }
+    catch (FederationExecutionDoesNotExist& e) {
+        return {};
+    }
+}
+
+bool MessageProcessor::awaitsPeerRoutes(const NetworkMessage& request)
+{
+    try {
+        return my_federations.searchFederation(FederationHandle(request.getFederation())).awaitsPeerRoutes();
+    }
+    catch (FederationExecutionDoesNotExist& e) {
+        return false;
+    }
+}
+
+bool MessageProcessor::routesConcurrently(const NetworkMessage& request) const
+{
+    switch (request.getMessageType()) {
+    case NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES:
+        return true;
+    case NetworkMessage::Type::SEND_INTERACTION:
+        // the MOM reads the parameters of the interactions it subscribed to
+        try {
+            return !my_federations.searchFederation(FederationHandle(request.getFederation()))
+                        .readsParameters(static_cast<const NM_Send_Interaction&>(request).getInteractionClass());
+        }
+        catch (Exception& e) {
+            return false;
+        }
+    default:
+        return false;
+    }
+}
+
+Responses MessageProcessor::route(const NetworkMessage& request)
+{
+    auto& federation = my_federations.searchFederation(FederationHandle(request.getFederation()));
+
+    switch (request.getMessageType()) {
+    case NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES: {
+        auto& update = static_cast<const NM_Update_Attribute_Values&>(request);
+        if (update.isDated()) {
+            return federation.routeAttributeValues(update.getFederate(),
+                                                   update.getObject(),
+                                                   update.getAttributes(),
+                                                   update.getValues(),
+                                                   update.getDate(),
+                                                   update.getLabel());
+        }
+        return federation.routeAttributeValues(
+            update.getFederate(), update.getObject(), update.getAttributes(), update.getValues(), update.getLabel());
+    }
+    case NetworkMessage::Type::SEND_INTERACTION: {
+        auto& interaction = static_cast<const NM_Send_Interaction&>(request);
+        if (interaction.isDated()) {
+            return federation.routeInteraction(interaction.getFederate(),
+                                               interaction.getInteractionClass(),
+                                               interaction.getParameters(),
+                                               interaction.getValues(),
+                                               interaction.getDate(),
+                                               interaction.getRegion(),
+                                               interaction.getLabel());
+        }
+        return federation.routeInteraction(interaction.getFederate(),
+                                           interaction.getInteractionClass(),
+                                           interaction.getParameters(),
+                                           interaction.getValues(),
+                                           interaction.getParametersSize(),
+                                           interaction.getRegion(),
+                                           interaction.getLabel());
+    }
+    default:
+        throw RTIinternalError("Message type not routed apart");
+    }
+}
+
 Responses MessageProcessor::process(MessageEvent<NM_Create_Federation_Execution>&& request)
 {
     Responses responses;
@@ -186,6 +296,8 @@ Responses MessageProcessor::process(MessageEvent<NM_Join_Federation_Execution>&&
     const auto& federate_type = request.message()->getFederateType();
     const auto& additional_modules = request.message()->getAdditionalFomModules();
     const auto& rti_version = request.message()->getRtiVersion();
+    const auto compression = request.message()->getCompression();
+    const auto peer_port = request.message()->getPeerPort();
 
     unsigned int peer = request.message()->getBestEffortPeer();
     unsigned long address = request.message()->getBestEffortAddress();
@@ -206,7 +318,9 @@ Responses MessageProcessor::process(MessageEvent<NM_Join_Federation_Execution>&&
                                                           rti_version,
                                                           static_cast<SocketTCP*>(request.sockets().front()),
                                                           peer,
-                                                          address);
+                                                          address,
+                                                          compression,
+                                                          peer_port);
     
     my_auditServer << "(" << federation_handle << ") with handle " << federate_handle << ". Socket "
                    << int(request.sockets().front()->returnSocket());
@@ -832,10 +946,18 @@ Responses MessageProcessor::process(MessageEvent<NM_Reserve_Object_Instance_Name
 
     my_auditServer << "Reserve Object Name = " << request.message()->getObjectName();
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+    return my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
         .reserveObjectInstanceName(request.message()->getFederate(), request.message()->getObjectName());
+}
 
-    return {};
+Responses MessageProcessor::process(MessageEvent<NM_Lease_Object_Handles>&& request)
+{
+    my_auditServer.setLevel(AuditLine::Level(6));
+
+    my_auditServer << "Lease Object Handles = " << request.message()->getCount();
+
+    return my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+        .leaseObjectHandles(request.message()->getFederate(), request.message()->getCount());
 }
 
 Responses MessageProcessor::process(MessageEvent<NM_Register_Object>&& request)
@@ -846,11 +968,34 @@ Responses MessageProcessor::process(MessageEvent<NM_Register_Object>&& request)
 
     my_auditServer << "Register Object Class = " << request.message()->getObjectClass();
 
+    auto& federation = my_federations.searchFederation(FederationHandle(request.message()->getFederation()));
+
     ObjectHandle object_handle;
-    std::tie(object_handle, responses)
-        = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-              .registerObject(
-                  request.message()->getFederate(), request.message()->getObjectClass(), request.message()->getLabel());
+    try {
+        std::tie(object_handle, responses) = federation.registerObject(request.message()->getFederate(),
+                                                                       request.message()->getObjectClass(),
+                                                                       request.message()->getLabel(),
+                                                                       request.message()->getObject());
+    }
+    catch (Exception& e) {
+        if (request.message()->getObject() == 0) {
+            throw;
+        }
+        // The RTIA already answered its federate, an answer to the request
+        // would be taken for the one of a later registration.
+        Debug(D, pdExcept) << "Leased registration of object " << request.message()->getObject()
+                           << " failed: " << e.name() << " - " << e.reason() << endl;
+
+        auto rep = make_unique<NM_Lease_Object_Handles>();
+        rep->setFederate(request.message()->getFederate());
+        rep->setFederation(request.message()->getFederation());
+        rep->setCount(0);
+        rep->setObjectsSize(1);
+        rep->setObjects(request.message()->getObject(), 0);
+        rep->setException(e.type(), e.reason());
+        responses.emplace_back(request.sockets().front(), std::move(rep));
+        return responses;
+    }
 
     Debug(D, pdRegister) << "Object \"" << request.message()->getLabel() << "\" of Federate "
                          << request.message()->getFederate() << " has been registered under ID " << object_handle
@@ -861,32 +1006,29 @@ Responses MessageProcessor::process(MessageEvent<NM_Register_Object>&& request)
 
 Responses MessageProcessor::process(MessageEvent<NM_Update_Attribute_Values>&& request)
 {
-    Responses responses;
+    auto routed = route(*request.message());
+    return process(std::move(request), std::move(routed));
+}
 
+Responses MessageProcessor::process(MessageEvent<NM_Update_Attribute_Values>&& request, Responses&& routed)
+{
     my_auditServer.setLevel(AuditLine::Level(1));
 
     my_auditServer << "ObjID = " << request.message()->getObject()
                    << ", Date = " << request.message()->getDate().getTime();
 
-    // Forward the call
-    if (request.message()->isDated()) {
-        // UAV with time
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .updateAttributeValues(request.message()->getFederate(),
-                                               request.message()->getObject(),
-                                               request.message()->getAttributes(),
-                                               request.message()->getValues(),
-                                               request.message()->getDate(),
-                                               request.message()->getLabel());
-    }
-    else {
-        // UAV without time
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .updateAttributeValues(request.message()->getFederate(),
-                                               request.message()->getObject(),
-                                               request.message()->getAttributes(),
-                                               request.message()->getValues(),
-                                               request.message()->getLabel());
+    auto& federation = my_federations.searchFederation(FederationHandle(request.message()->getFederation()));
+
+    auto responses
+        = federation.reportUpdate(request.message()->getFederate(), request.message()->getObject(), std::move(routed));
+
+    responses = federation.forwardCompressedValues(std::move(responses), *request.message(), my_compression);
+
+    // the sender may send the next ones itself
+    if (!request.message()->isDated()) {
+        if (auto route = federation.peerRoute(*request.message(), responses)) {
+            responses.emplace_back(request.sockets().front(), std::move(route));
+        }
     }
 
     // Building answer (Network Message)
@@ -894,6 +1036,17 @@ Responses MessageProcessor::process(MessageEvent<NM_Update_Attribute_Values>&& r
     rep->setFederate(request.message()->getFederate());
     rep->setObject(request.message()->getObject());
 
+    // the sender keeps the receivers to retract the event
+    if (request.message()->isDated() && request.message()->hasEvent()) {
+        const auto receivers
+            = federation.markRetractable(request.message()->getFederate(), request.message()->getEvent(), responses);
+        rep->setEvent(request.message()->getEvent());
+        rep->setReceiversSize(receivers.size());
+        for (uint32_t i = 0; i < receivers.size(); ++i) {
+            rep->setReceivers(receivers[i], i);
+        }
+    }
+
     // Don't forget date, label and tag if provided in the request
     if (request.message()->isDated()) {
         rep->setDate(request.message()->getDate());
@@ -910,42 +1063,88 @@ Responses MessageProcessor::process(MessageEvent<NM_Update_Attribute_Values>&& r
     return responses;
 }
 
+Responses MessageProcessor::process(MessageEvent<NM_Batch_Update_Attribute_Values>&& request)
+{
+    my_auditServer.setLevel(AuditLine::Level(1));
+
+    my_auditServer << "Objects = " << request.message()->getObjectsSize()
+                   << ", Date = " << request.message()->getDate().getTime();
+
+    auto& federation = my_federations.searchFederation(FederationHandle(request.message()->getFederation()));
+
+    auto responses = federation.updateAttributeValues(request.message()->getFederate(), *request.message(), my_compression);
+
+    // The answer only acknowledges the whole batch
+    auto rep = make_unique<NM_Batch_Update_Attribute_Values>();
+    rep->setFederate(request.message()->getFederate());
+    if (request.message()->isDated()) {
+        rep->setDate(request.message()->getDate());
+    }
+    if (request.message()->isLabelled()) {
+        rep->setLabel(request.message()->getLabel());
+    }
+
+    responses.emplace_back(request.sockets().front(), std::move(rep));
+
+    return responses;
+}
+
 Responses MessageProcessor::process(MessageEvent<NM_Send_Interaction>&& request)
 {
-    Responses responses;
+    auto& federation = my_federations.searchFederation(FederationHandle(request.message()->getFederation()));
 
+    // the MOM reads the parameters of the interactions it subscribed to
+    if (request.message()->getRawSizesSize() != 0
+        && federation.readsParameters(request.message()->getInteractionClass())) {
+        my_compression.decompress(*request.message());
+    }
+
+    auto routed = route(*request.message());
+    return process(std::move(request), std::move(routed));
+}
+
+Responses MessageProcessor::process(MessageEvent<NM_Send_Interaction>&& request, Responses&& routed)
+{
     my_auditServer.setLevel(AuditLine::Level(2));
 
     // Building Value Array
     my_auditServer << "IntID = " << request.message()->getInteractionClass()
                    << ", date = " << request.message()->getDate().getTime();
-    if (request.message()->isDated()) {
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .broadcastInteraction(request.message()->getFederate(),
-                                              request.message()->getInteractionClass(),
-                                              request.message()->getParameters(),
-                                              request.message()->getValues(),
-                                              request.message()->getDate(),
-                                              request.message()->getRegion(),
-                                              request.message()->getLabel());
-    }
-    else {
-        responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-                        .broadcastInteraction(request.message()->getFederate(),
-                                              request.message()->getInteractionClass(),
-                                              request.message()->getParameters(),
-                                              request.message()->getValues(),
-                                              request.message()->getParametersSize(),
-                                              request.message()->getRegion(),
-                                              request.message()->getLabel());
-    }
+
+    auto& federation = my_federations.searchFederation(FederationHandle(request.message()->getFederation()));
+
+    auto responses = federation.reportInteraction(request.message()->getFederate(),
+                                                  request.message()->getInteractionClass(),
+                                                  request.message()->getParameters(),
+                                                  request.message()->getValues(),
+                                                  request.message()->getRegion(),
+                                                  std::move(routed));
+
+    responses = federation.forwardCompressedValues(std::move(responses), *request.message(), my_compression);
 
     Debug(D, pdDebug) << "Interaction " << request.message()->getInteractionClass() << " parameters update completed"
                       << endl;
 
+    if (!request.message()->isDated()) {
+        if (auto route = federation.peerRoute(*request.message(), responses)) {
+            responses.emplace_back(request.sockets().front(), std::move(route));
+        }
+    }
+
     auto rep = make_unique<NM_Send_Interaction>();
     rep->setFederate(request.message()->getFederate());
     rep->setInteractionClass(request.message()->getInteractionClass());
+
+    // the sender keeps the receivers to retract the event
+    if (request.message()->isDated() && request.message()->hasEvent()) {
+        const auto receivers
+            = federation.markRetractable(request.message()->getFederate(), request.message()->getEvent(), responses);
+        rep->setEvent(request.message()->getEvent());
+        rep->setReceiversSize(receivers.size());
+        for (uint32_t i = 0; i < receivers.size(); ++i) {
+            rep->setReceivers(receivers[i], i);
+        }
+    }
     // Don't forget label and tag
     if (request.message()->isDated()) {
         rep->setDate(request.message()->getDate());
@@ -1001,9 +1200,10 @@ Responses MessageProcessor::process(MessageEvent<NM_Query_Attribute_Ownership>&&
 
     my_auditServer << "AttributeHandle = " << request.message()->getAttribute();
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-        .queryAttributeOwnership(
-            request.message()->getFederate(), request.message()->getObject(), request.message()->getAttribute());
+    responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                    .queryAttributeOwnership(request.message()->getFederate(),
+                                             request.message()->getObject(),
+                                             request.message()->getAttribute());
 
     Debug(D, pdDebug) << "Owner of Attribute " << request.message()->getAttribute() << " of Object "
                       << request.message()->getObject() << endl;
@@ -1054,9 +1254,10 @@ Responses MessageProcessor::process(MessageEvent<NM_Attribute_Ownership_Acquisit
     my_auditServer << "Object = " << request.message()->getObject()
                    << ", # of att. = " << request.message()->getAttributesSize();
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-        .acquireIfAvailable(
-            request.message()->getFederate(), request.message()->getObject(), request.message()->getAttributes());
+    responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                    .acquireIfAvailable(request.message()->getFederate(),
+                                        request.message()->getObject(),
+                                        request.message()->getAttributes());
 
     Debug(D, pdDebug) << "Federate " << request.message()->getFederate() << " of Federation "
                       << request.message()->getFederation() << " acquisitionIfAvailable "
@@ -1103,11 +1304,11 @@ Responses MessageProcessor::process(MessageEvent<NM_Attribute_Ownership_Acquisit
     my_auditServer << "Object = " << request.message()->getObject()
                    << ", # of att. = " << request.message()->getAttributesSize();
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-        .acquire(request.message()->getFederate(),
-                 request.message()->getObject(),
-                 request.message()->getAttributes(),
-                 request.message()->getLabel());
+    responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                    .acquire(request.message()->getFederate(),
+                             request.message()->getObject(),
+                             request.message()->getAttributes(),
+                             request.message()->getLabel());
 
     Debug(D, pdDebug) << "Federate " << request.message()->getFederate() << " of Federation "
                       << request.message()->getFederation() << " ownership acquisition of object "
@@ -1193,7 +1394,8 @@ Responses MessageProcessor::process(MessageEvent<NM_Attribute_Ownership_Release_
     my_auditServer << "Object = " << request.message()->getObject()
                    << ", # of att. = " << request.message()->getAttributesSize();
 
-    AttributeHandleSet* attributes
+    AttributeHandleSet* attributes;
+    std::tie(attributes, responses)
         = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
               .respondRelease(
                   request.message()->getFederate(), request.message()->getObject(), request.message()->getAttributes());
@@ -1227,9 +1429,10 @@ Responses MessageProcessor::process(MessageEvent<NM_Cancel_Attribute_Ownership_A
     my_auditServer << "Object = " << request.message()->getObject()
                    << ", # of att. = " << request.message()->getAttributesSize();
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
-        .cancelAcquisition(
-            request.message()->getFederate(), request.message()->getObject(), request.message()->getAttributes());
+    responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+                    .cancelAcquisition(request.message()->getFederate(),
+                                       request.message()->getObject(),
+                                       request.message()->getAttributes());
 
     Debug(D, pdDebug) << "Federate " << request.message()->getFederate() << " of Federation "
                       << request.message()->getFederation() << " release response of object "
@@ -1288,6 +1491,53 @@ Responses MessageProcessor::process(MessageEvent<NM_DDM_Modify_Region>&& request
     return responses;
 }
 
+Responses MessageProcessor::process(MessageEvent<NM_DDM_Modify_Regions>&& request)
+{
+    my_auditServer.setLevel(AuditLine::Level(6));
+
+    auto& message = *request.message();
+
+    my_auditServer << "Regions = " << message.getRegionsSize();
+
+    if (message.getExtentCountsSize() != message.getRegionsSize()
+        || message.getRangeCountsSize() != message.getRegionsSize()) {
+        throw RTIinternalError("Malformed region modifications");
+    }
+
+    std::vector<std::vector<Extent>> extents(message.getRegionsSize());
+    uint32_t bound{0u};
+    for (uint32_t i{0u}; i < message.getRegionsSize(); ++i) {
+        const auto ranges = message.getRangeCounts(i);
+        if (bound + 2 * ranges * message.getExtentCounts(i) > message.getBoundsSize()) {
+            throw RTIinternalError("Malformed region modifications");
+        }
+        extents[i].reserve(message.getExtentCounts(i));
+        for (uint32_t j{0u}; j < message.getExtentCounts(i); ++j) {
+            Extent extent(ranges);
+            for (uint32_t h{1u}; h <= ranges; ++h) {
+                extent.setRangeLowerBound(h, message.getBounds(bound++));
+                extent.setRangeUpperBound(h, message.getBounds(bound++));
+            }
+            extents[i].push_back(extent);
+        }
+    }
+
+    Debug(D, pdDebug) << "Federate " << message.getFederate() << " of Federation " << message.getFederation()
+                      << " modifies " << message.getRegionsSize() << " regions" << endl;
+
+    my_federations.searchFederation(FederationHandle(message.getFederation()))
+        .modifyRegions(message.getFederate(), message.getRegions(), extents);
+
+    // the RTIA did not wait, it forgets the extents it would roll back to
+    auto rep = make_unique<NM_DDM_Modify_Regions>();
+    rep->setFederate(message.getFederate());
+    rep->setFederation(message.getFederation());
+
+    Responses responses;
+    responses.emplace_back(request.sockets().front(), std::move(rep));
+    return responses;
+}
+
 Responses MessageProcessor::process(MessageEvent<NM_DDM_Delete_Region>&& request)
 {
     Responses responses;
@@ -1373,7 +1623,8 @@ Responses MessageProcessor::process(MessageEvent<NM_DDM_Subscribe_Attributes>&&
                       << request.message()->getRegion() << " to some attributes of class "
                       << request.message()->getObjectClass() << endl;
 
-    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+    // Discoveries first, then the answer
+    responses = my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
         .subscribeAttributesWR(request.message()->getFederate(),
                                request.message()->getObjectClass(),
                                request.message()->getRegion(),
@@ -1569,5 +1820,37 @@ Responses MessageProcessor::process(MessageEvent<NM_Time_State_Update>&& request
 
     return {};
 }
+
+Responses MessageProcessor::process(MessageEvent<NM_Retract>&& request)
+{
+    my_auditServer.setLevel(AuditLine::Level(2));
+
+    my_auditServer << "Event = " << request.message()->getEvent()
+                   << ", receivers = " << request.message()->getReceiversSize();
+
+    // The sender does not wait for an answer: a receiver which already
+    // delivered the event is asked to retract it on its own.
+    return my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+        .retract(request.message()->getFederate(), request.message()->getEvent(), request.message()->getReceivers());
+}
+Responses MessageProcessor::process(MessageEvent<NM_Peer_Routes_Invalidated>&& request)
+{
+    my_auditServer.setLevel(AuditLine::Level(1));
+
+    my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+        .peerRoutesInvalidated(request.message()->getFederate());
+
+    return {};
+}
+
+Responses MessageProcessor::process(MessageEvent<NM_Peer_Fence>&& request)
+{
+    my_auditServer.setLevel(AuditLine::Level(1));
+
+    my_auditServer << "Epoch = " << request.message()->getEpoch() << ", peers = " << request.message()->getPeersSize();
+
+    return my_federations.searchFederation(FederationHandle(request.message()->getFederation()))
+        .relayPeerFence(*request.message());
+}
 }
 }
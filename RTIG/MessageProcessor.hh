@@ -32,6 +32,7 @@
 #include <libCERTI/MessageEvent.hh>
 #include <libCERTI/NM_Classes.hh>
 #include <libCERTI/SocketServer.hh>
+#include <libCERTI/ValueCompression.hh>
 
 #include "FederationsList.hh"
 
@@ -57,6 +58,40 @@ public:
      */
     Responses processEvent(MessageEvent<NetworkMessage> request);
 
+    /// True if request may be routed on another thread, see route().
+    bool routesConcurrently(const NetworkMessage& request) const;
+
+    /** Route an update or an interaction to the federates subscribed to it.
+     *
+     * The routing only reads the federation: the requests for which
+     * routesConcurrently() holds may be routed on several threads at once,
+     * while no other request is processed.
+     *
+     * @param request the update or interaction to route
+     *
+     * @return the reflections or interactions to send, to pass to processEvent()
+     */
+    Responses route(const NetworkMessage& request);
+
+    /// Process a request already routed by route(), as processEvent() does.
+    Responses processEvent(MessageEvent<NetworkMessage> request, Responses routed);
+
+    /** Tell the peers of the federation of request that their routes no
+     * longer hold, if processing request may change the routing.
+     *
+     * @return the invalidations to send, before processing request
+     */
+    Responses invalidatePeerRoutes(const NetworkMessage& request);
+
+    /** true while peers of the federation of request did not answer the
+     * invalidation of their routes: a request which may change the routing
+     * must wait for them.
+     */
+    bool awaitsPeerRoutes(const NetworkMessage& request);
+
+    /// Decompression of values for the federates which did not negotiate compression.
+    const ValueCompression& compression() const;
+
 private:
     // Event handlers
     Responses process(MessageEvent<NM_Create_Federation_Execution>&& request);
@@ -89,9 +124,13 @@ private:
     Responses process(MessageEvent<NM_Subscribe_Interaction_Class>&& request);
     Responses process(MessageEvent<NM_Unsubscribe_Interaction_Class>&& request);
     Responses process(MessageEvent<NM_Reserve_Object_Instance_Name>&& request);
+    Responses process(MessageEvent<NM_Lease_Object_Handles>&& request);
     Responses process(MessageEvent<NM_Register_Object>&& request);
     Responses process(MessageEvent<NM_Update_Attribute_Values>&& request);
+    Responses process(MessageEvent<NM_Update_Attribute_Values>&& request, Responses&& routed);
+    Responses process(MessageEvent<NM_Batch_Update_Attribute_Values>&& request);
     Responses process(MessageEvent<NM_Send_Interaction>&& request);
+    Responses process(MessageEvent<NM_Send_Interaction>&& request, Responses&& routed);
     Responses process(MessageEvent<NM_Delete_Object>&& request);
     Responses process(MessageEvent<NM_Query_Attribute_Ownership>&& request);
     Responses process(MessageEvent<NM_Negotiated_Attribute_Ownership_Divestiture>&& request);
@@ -104,6 +143,7 @@ private:
     Responses process(MessageEvent<NM_Cancel_Attribute_Ownership_Acquisition>&& request);
     Responses process(MessageEvent<NM_DDM_Create_Region>&& request);
     Responses process(MessageEvent<NM_DDM_Modify_Region>&& request);
+    Responses process(MessageEvent<NM_DDM_Modify_Regions>&& request);
     Responses process(MessageEvent<NM_DDM_Delete_Region>&& request);
     Responses process(MessageEvent<NM_DDM_Associate_Region>&& request);
     Responses process(MessageEvent<NM_DDM_Unassociate_Region>&& request);
@@ -117,6 +157,9 @@ private:
     Responses process(MessageEvent<NM_Enable_Asynchronous_Delivery>&& request);
     Responses process(MessageEvent<NM_Disable_Asynchronous_Delivery>&& request);
     Responses process(MessageEvent<NM_Time_State_Update>&& request);
+    Responses process(MessageEvent<NM_Retract>&& request);
+    Responses process(MessageEvent<NM_Peer_Routes_Invalidated>&& request);
+    Responses process(MessageEvent<NM_Peer_Fence>&& request);
 
     AuditFile& my_auditServer;
     SocketServer& my_socketServer;
@@ -124,6 +167,8 @@ private:
     FederationsList& my_federations;
 
     MessageBuffer my_messageBuffer;
+
+    ValueCompression my_compression{};
 };
 }
 }
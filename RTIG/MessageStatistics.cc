@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "MessageStatistics.hh"
+
+#include <string>
+
+namespace certi {
+namespace rtig {
+
+void MessageStatistics::Entry::record(const std::chrono::nanoseconds processing,
+                                      const uint64_t fanout_count,
+                                      const uint64_t bytes)
+{
+    processing_ns.record(static_cast<uint64_t>(processing.count()));
+    fanout.record(fanout_count);
+    bytes_sent.record(bytes);
+}
+
+void MessageStatistics::Entry::print(std::ostream& stream, const std::string& scope, const std::string& name) const
+{
+    stream << scope << '\t' << name << "\tprocessing_ns\t";
+    processing_ns.print(stream);
+    stream << '\n' << scope << '\t' << name << "\tfanout\t";
+    fanout.print(stream);
+    stream << '\n' << scope << '\t' << name << "\tbytes_sent\t";
+    bytes_sent.print(stream);
+    stream << '\n';
+}
+
+void MessageStatistics::record(const NetworkMessage::Type type,
+                               const Handle federation,
+                               const std::chrono::nanoseconds processing,
+                               const uint64_t fanout,
+                               const uint64_t bytes)
+{
+    const auto index = static_cast<size_t>(type);
+    if (index < my_types.size()) {
+        auto& entry = my_types[index];
+        if (!entry) {
+            entry.reset(new Entry);
+        }
+        entry->record(processing, fanout, bytes);
+    }
+
+    // federation 0 is used by messages not bound to a federation yet (create, join...)
+    if (federation != 0) {
+        my_federations[federation].record(processing, fanout, bytes);
+    }
+}
+
+const MessageStatistics::Entry* MessageStatistics::forType(const NetworkMessage::Type type) const
+{
+    const auto index = static_cast<size_t>(type);
+    if (index >= my_types.size()) {
+        return nullptr;
+    }
+    return my_types[index].get();
+}
+
+const MessageStatistics::Entry* MessageStatistics::forFederation(const Handle federation) const
+{
+    auto it = my_federations.find(federation);
+    if (it == end(my_federations)) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void MessageStatistics::dump(std::ostream& stream) const
+{
+    stream << "scope\tname\tmetric\tcount\tmin\tp50\tp90\tp99\tp999\tmax\tmean\n";
+
+    for (size_t index{0}; index < my_types.size(); ++index) {
+        if (my_types[index]) {
+            my_types[index]->print(stream, "type", NetworkMessage::to_string(static_cast<NetworkMessage::Type>(index)));
+        }
+    }
+
+    for (const auto& kv : my_federations) {
+        kv.second.print(stream, "federation", std::to_string(kv.first));
+    }
+
+    stream.flush();
+}
+
+} // namespace rtig
+} // namespace certi
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_MESSAGE_STATISTICS_HH
+#define CERTI_RTIG_MESSAGE_STATISTICS_HH
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <ostream>
+
+#include <libCERTI/Handle.hh>
+#include <libCERTI/LogLinearHistogram.hh>
+#include <libCERTI/NetworkMessage.hh>
+
+namespace certi {
+namespace rtig {
+
+/** Live statistics on messages processed by the RTIG.
+ *
+ * For each message type and each federation, the RTIG records the time spent
+ * processing a message (including writing the responses to sockets), the
+ * number of sockets responses were sent to, and the number of bytes sent.
+ * Each of these uses a LogLinearHistogram, so memory does not grow with the
+ * number of messages and percentiles are available at any time.
+ *
+ * The RTIG dumps these statistics to RTIG_STATISTICS_FILENAME when it
+ * receives SIGUSR1.
+ */
+class MessageStatistics {
+public:
+    struct Entry {
+        LogLinearHistogram processing_ns;
+        LogLinearHistogram fanout;
+        LogLinearHistogram bytes_sent;
+
+        void record(const std::chrono::nanoseconds processing, const uint64_t fanout, const uint64_t bytes);
+
+        void print(std::ostream& stream, const std::string& scope, const std::string& name) const;
+    };
+
+    void record(const NetworkMessage::Type type,
+                const Handle federation,
+                const std::chrono::nanoseconds processing,
+                const uint64_t fanout,
+                const uint64_t bytes);
+
+    /// Statistics for type, nullptr if no such message was processed yet.
+    const Entry* forType(const NetworkMessage::Type type) const;
+
+    /// Statistics for federation, nullptr if no message was processed for it yet.
+    const Entry* forFederation(const Handle federation) const;
+
+    /// Write all statistics as a tab separated table, with a header line.
+    void dump(std::ostream& stream) const;
+
+private:
+    std::array<std::unique_ptr<Entry>, NetworkMessage::the_message_type_count> my_types{};
+    std::map<Handle, Entry> my_federations{};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_MESSAGE_STATISTICS_HH
@@ -477,6 +477,8 @@ Responses Mom::processFederateModifyAttributeState(const FederateHandle& federat
     Debug(D, pdGendoc) << "enter Mom::processFederateModifyAttributeState " << federate_handle << ", " << objectInstance
                        << ", " << attribute << ", " << attributeState << endl;
 
+    Responses responses;
+
     auto object = my_root.objects->getObject(objectInstance);
 
     // TODO catch everything and package it in a MOMexception
@@ -484,7 +486,7 @@ Responses Mom::processFederateModifyAttributeState(const FederateHandle& federat
         // we want to grand federate_handle the ownership of objectInstance.attribute
         // preconditions already checked by the call
         my_federation.divest(object->getAttribute(attribute)->getOwner(), objectInstance, {attribute});
-        my_federation.acquire(federate_handle, objectInstance, {attribute}, "");
+        responses = my_federation.acquire(federate_handle, objectInstance, {attribute}, "");
     }
     else {
         // we want to divest federate_handle the ownership of objectInstance.attribute
@@ -498,7 +500,7 @@ Responses Mom::processFederateModifyAttributeState(const FederateHandle& federat
 
     Debug(D, pdGendoc) << "exit  Mom::processFederateModifyAttributeState" << endl;
 
-    return {};
+    return responses;
 }
 
 Responses Mom::processFederateSetSwitches(const FederateHandle& federate_handle,
@@ -0,0 +1,177 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "ParallelRouter.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+namespace {
+static constexpr auto routersEnvironmentVariable = "CERTI_RTIG_ROUTERS";
+}
+
+namespace certi {
+namespace rtig {
+
+ParallelRouter::Job::Job(MessageEvent<NetworkMessage> request,
+                         std::shared_ptr<SendPipeline::Record> record,
+                         const uint64_t trace)
+    : request(std::move(request)), record(std::move(record)), trace(trace)
+{
+}
+
+ParallelRouter::ParallelRouter(const size_t routers, Route route) : my_route(std::move(route))
+{
+#ifndef _WIN32
+    // signals are handled by the routing thread, routers inherit a blocked mask
+    sigset_t all;
+    sigset_t previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);
+#endif
+
+    for (size_t i = 0; i < routers; ++i) {
+        my_routers.emplace_back([this] { run(); });
+    }
+
+#ifndef _WIN32
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+#endif
+}
+
+ParallelRouter::~ParallelRouter()
+{
+    {
+        std::lock_guard<std::mutex> lock(my_mutex);
+        my_stop = true;
+    }
+    my_wake.notify_all();
+    for (auto& router : my_routers) {
+        router.join();
+    }
+}
+
+size_t ParallelRouter::routersFromEnvironment()
+{
+    if (auto routers_s = getenv(routersEnvironmentVariable)) {
+        return std::stoul(routers_s);
+    }
+    return 0;
+}
+
+size_t ParallelRouter::routers() const
+{
+    return my_routers.size();
+}
+
+void ParallelRouter::dispatch(MessageEvent<NetworkMessage> request,
+                              std::shared_ptr<SendPipeline::Record> record,
+                              const uint64_t trace)
+{
+    {
+        std::lock_guard<std::mutex> lock(my_mutex);
+        my_jobs.emplace_back(std::move(request), std::move(record), trace);
+    }
+    my_wake.notify_one();
+}
+
+bool ParallelRouter::isIdle() const
+{
+    std::lock_guard<std::mutex> lock(my_mutex);
+    return my_jobs.empty();
+}
+
+void ParallelRouter::complete(const std::function<void(Job&)>& completion)
+{
+    std::deque<Job> jobs;
+    {
+        std::unique_lock<std::mutex> lock(my_mutex);
+        if (my_jobs.empty()) {
+            return;
+        }
+
+        // rather than wait for the routers, route what they did not take yet
+        while (routeNext(lock)) {
+            ++my_statistics.routed_by_caller;
+        }
+        my_routed.wait(lock, [this] { return my_done == my_jobs.size(); });
+
+        my_statistics.routed += my_jobs.size();
+        ++my_statistics.batches;
+        my_statistics.largest_batch = std::max<uint64_t>(my_statistics.largest_batch, my_jobs.size());
+
+        jobs.swap(my_jobs);
+        my_next = 0;
+        my_done = 0;
+    }
+
+    for (auto& job : jobs) {
+        completion(job);
+    }
+}
+
+const ParallelRouter::Statistics& ParallelRouter::statistics() const
+{
+    return my_statistics;
+}
+
+void ParallelRouter::run()
+{
+    std::unique_lock<std::mutex> lock(my_mutex);
+    for (;;) {
+        my_wake.wait(lock, [this] { return my_stop || my_next < my_jobs.size(); });
+        if (!routeNext(lock) && my_stop) {
+            return;
+        }
+    }
+}
+
+bool ParallelRouter::routeNext(std::unique_lock<std::mutex>& lock)
+{
+    if (my_next == my_jobs.size()) {
+        return false;
+    }
+    auto& job = my_jobs[my_next++];
+
+    lock.unlock();
+    try {
+        job.responses = my_route(*job.request.message());
+    }
+    catch (...) {
+        job.error = std::current_exception();
+    }
+    lock.lock();
+
+    if (++my_done == my_jobs.size()) {
+        my_routed.notify_one();
+    }
+    return true;
+}
+
+} // namespace rtig
+} // namespace certi
@@ -0,0 +1,146 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_PARALLEL_ROUTER_HH
+#define CERTI_RTIG_PARALLEL_ROUTER_HH
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <libCERTI/MessageEvent.hh>
+#include <libCERTI/NetworkMessage.hh>
+
+#include "SendPipeline.hh"
+
+namespace certi {
+namespace rtig {
+
+/** Routing of the updates and interactions of a federation on a pool of threads.
+ *
+ * The routing thread dispatches the requests which only need to read the
+ * federation to be routed, see MessageProcessor::routesConcurrently(). The
+ * routers route them in any order, several at once, while the routing thread
+ * goes on reading the next requests. complete() then hands the routed
+ * requests back to the routing thread in dispatch order, so that everything
+ * done with the responses, and the responses themselves, are in the order the
+ * requests were received: the reflections of the updates of one federate
+ * keep their order, dated or not.
+ *
+ * Any other request, and any change of the connections, completes the
+ * dispatched requests first: the subscriptions, ownerships and federates a
+ * request is routed with cannot change while it is routed.
+ *
+ * The number of routers is read from CERTI_RTIG_ROUTERS. With no router,
+ * the RTIG routes every request itself, as it used to.
+ */
+class ParallelRouter {
+public:
+    using Route = std::function<Responses(const NetworkMessage&)>;
+
+    /// A dispatched request, and its routing once routed.
+    struct Job {
+        Job(MessageEvent<NetworkMessage> request, std::shared_ptr<SendPipeline::Record> record, const uint64_t trace);
+
+        MessageEvent<NetworkMessage> request;
+        std::shared_ptr<SendPipeline::Record> record;
+        uint64_t trace;
+
+        Responses responses{};
+        /// thrown by the routing, responses are empty then
+        std::exception_ptr error{};
+    };
+
+    struct Statistics {
+        uint64_t routed{0};
+        /// calls of complete with requests dispatched, and the most requests of one
+        uint64_t batches{0};
+        uint64_t largest_batch{0};
+        /// routed by the routing thread while it waited for the routers
+        uint64_t routed_by_caller{0};
+    };
+
+    ParallelRouter(const size_t routers, Route route);
+
+    /// Route everything dispatched, then stop the routers.
+    ~ParallelRouter();
+
+    ParallelRouter(const ParallelRouter&) = delete;
+    ParallelRouter& operator=(const ParallelRouter&) = delete;
+
+    /// Number of routers read from CERTI_RTIG_ROUTERS, none by default.
+    static size_t routersFromEnvironment();
+
+    size_t routers() const;
+
+    /// Queue request to be routed by the routers.
+    void dispatch(MessageEvent<NetworkMessage> request,
+                  std::shared_ptr<SendPipeline::Record> record,
+                  const uint64_t trace);
+
+    /// true if nothing was dispatched since the last complete.
+    bool isIdle() const;
+
+    /** Wait until every dispatched request is routed, then call completion on each, in dispatch order.
+     *
+     * The routing thread routes the remaining requests itself meanwhile.
+     * Requests dispatched by completion are completed by the next call.
+     */
+    void complete(const std::function<void(Job&)>& completion);
+
+    const Statistics& statistics() const;
+
+private:
+    void run();
+
+    /// Route the next queued job, false if there is none. Called with lock held.
+    bool routeNext(std::unique_lock<std::mutex>& lock);
+
+    Route my_route;
+
+    mutable std::mutex my_mutex{};
+    std::condition_variable my_wake{};
+    std::condition_variable my_routed{};
+
+    /// dispatched since the last complete, references stay valid as the deque grows
+    std::deque<Job> my_jobs{};
+    /// first job not taken by a router yet
+    size_t my_next{0};
+    /// jobs routed so far
+    size_t my_done{0};
+    bool my_stop{false};
+
+    Statistics my_statistics{};
+
+    std::vector<std::thread> my_routers{};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_PARALLEL_ROUTER_HH
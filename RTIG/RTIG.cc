@@ -22,32 +22,29 @@
 
 #include "RTIG.hh"
 
+#include "Federation.hh"
+
 #include <algorithm>
 #include <cerrno>
 #include <csignal>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
 
 #include <libCERTI/FedTimeD.hh>
+#include <libCERTI/LatencyTrace.hh>
 #include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/PeerRoutes.hh>
 #include <libCERTI/PrettyDebug.hh>
 #include <libCERTI/Socket.hh>
 
 #ifdef _WIN32
 #include <signal.h>
-#endif
-
-//#define LOG_MESSAGE_PROCESSING_TIMINGS
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-
-#include <chrono>
-#include <numeric>
-
-std::map<certi::NetworkMessage::Type, std::vector<std::chrono::nanoseconds>> the_timings;
-
+#else
+#include <poll.h>
 #endif
 
 namespace {
@@ -56,6 +53,29 @@ static constexpr auto tcpPortEnvironmentVariable = "CERTI_TCP_PORT";
 
 static constexpr auto defaultUdpPort = PORT_UDP_RTIG;
 static constexpr auto udpPortEnvironmentVariable = "CERTI_UDP_PORT";
+
+static constexpr auto auditFormatEnvironmentVariable = "CERTI_AUDIT_FORMAT";
+
+/// How long to wait for incoming messages before trying again to flush conflated reflections
+static constexpr int conflationFlushDelayMs{5};
+
+/// true if data can be written to socket without blocking.
+bool isWritable(certi::Socket* socket)
+{
+#ifdef _WIN32
+    fd_set fd;
+    FD_ZERO(&fd);
+    FD_SET(socket->returnSocket(), &fd);
+    timeval now{0, 0};
+    return select(0, nullptr, &fd, nullptr, &now) > 0;
+#else
+    struct pollfd pfd;
+    pfd.fd = socket->returnSocket();
+    pfd.events = POLLOUT;
+    pfd.revents = 0;
+    return ::poll(&pfd, 1, 0) > 0 && (pfd.revents & POLLOUT);
+#endif
+}
 }
 
 namespace certi {
@@ -65,6 +85,7 @@ static PrettyDebug D("RTIG", __FILE__);
 static PrettyDebug G("GENDOC", __FILE__);
 
 bool RTIG::terminate = false;
+volatile std::sig_atomic_t RTIG::statistics_requested = 0;
 
 RTIG::RTIG()
     : my_tcpPort(inferTcpPort())
@@ -73,16 +94,33 @@ RTIG::RTIG()
     , my_listeningIPAddress(0)
     , my_federationHandles(1)
     , my_socketServer(&my_tcpSocketServer, &my_udpSocketServer)
-    , my_auditServer(RTIG_AUDIT_FILENAME)
+    , my_auditServer(inferAuditFormat() == AuditFile::Format::Binary ? RTIG_AUDIT_BINARY_FILENAME
+                                                                      : RTIG_AUDIT_FILENAME,
+                     inferAuditFormat())
     , my_federations(my_verboseLevel)
     , my_processor{my_auditServer, my_socketServer, my_federationHandles, my_federations}
+    , my_conflation(Conflation::fromEnvironment())
+#ifdef CERTI_USE_IO_URING
+    , my_ring(IoUring::create())
+    , my_pipeline(SendPipeline::writersFromEnvironment(my_ring != nullptr))
+#else
+    , my_pipeline(SendPipeline::writersFromEnvironment())
+#endif
 {
-    my_NM_msgBufSend.reset();
     my_NM_msgBufReceive.reset();
+
+    if (const auto routers = ParallelRouter::routersFromEnvironment()) {
+        my_router.reset(new ParallelRouter(
+            routers, [this](const NetworkMessage& request) { return my_processor.route(request); }));
+    }
 }
 
 RTIG::~RTIG()
 {
+    // the relay links may be closed before their channels
+    for (auto& kv : my_relays) {
+        kv.second->detach();
+    }
     my_tcpSocketServer.close();
     my_udpSocketServer.close();
 
@@ -103,6 +141,16 @@ void RTIG::execute()
     Socket* link{nullptr};
     int result{0};
     
+#ifdef CERTI_USE_IO_URING
+    if (my_ring) {
+        executeWithRing();
+        return;
+    }
+    if (my_verboseLevel > 0) {
+        std::cout << "io_uring not available, using epoll" << std::endl;
+    }
+#endif
+
 #ifdef CERTI_RTIG_USE_EPOLL    
 int Epollfd;
 my_socketServer.createEpollFd();
@@ -112,6 +160,19 @@ Epollfd = my_socketServer.getEpollDescriptor();
 #endif
 
     while (!terminate) {
+        completeRoutedMessages();
+
+        if (statistics_requested) {
+            statistics_requested = 0;
+            dumpStatistics();
+        }
+
+        if (my_conflation.hasPending()) {
+            flushConflatedUpdates();
+        }
+
+        closeFailedConnections(nullptr);
+
 #if _WIN32
         result = 0;
 
@@ -139,6 +200,10 @@ Epollfd = my_socketServer.getEpollDescriptor();
             if (terminate) {
                 break;
             }
+
+            if (my_conflation.hasPending()) {
+                flushConflatedUpdates();
+            }
         }
 
         if (terminate) {
@@ -190,11 +255,13 @@ Epollfd = my_socketServer.getEpollDescriptor();
         int fd_max = my_socketServer.addToFDSet(&fd);
         fd_max = std::max(my_tcpSocketServer.returnSocket(), fd_max);
 
-        // Wait for an incoming message.
-        result = select(fd_max + 1, &fd, nullptr, nullptr, nullptr);
+        // Wait for an incoming message, or until conflated reflections may be flushed.
+        timeval flushDelay{0, conflationFlushDelayMs * 1000L};
+        result = select(fd_max + 1, &fd, nullptr, nullptr, my_conflation.hasPending() ? &flushDelay : nullptr);
 
         if ((result == -1) && (errno == EINTR)) {
-            break;
+            // interrupted by a signal, either SIGINT (terminate) or SIGUSR1 (statistics)
+            continue;
         }
 		link = my_socketServer.getActiveSocket(&fd);
 
@@ -238,9 +305,10 @@ Epollfd = my_socketServer.getEpollDescriptor();
         my_socketServer.addElementPollList(tcp_server);
         SocketVector = my_socketServer.getSocketVector();
         // blocking call (SHOULD IT BE THIS WAY ??)
-        result = ::poll(&SocketVector[0], SocketVector.size(), -1);
+        result = ::poll(&SocketVector[0], SocketVector.size(), my_conflation.hasPending() ? conflationFlushDelayMs : -1);
         if ((result == -1) && (errno == EINTR)) {
-            break;
+            // interrupted by a signal, either SIGINT (terminate) or SIGUSR1 (statistics)
+            continue;
         }
         for (std::vector<struct pollfd>::iterator it = SocketVector.begin() ; it != SocketVector.end(); ++it)
 		{
@@ -281,10 +349,11 @@ Epollfd = my_socketServer.getEpollDescriptor();
 #endif
 #ifdef CERTI_RTIG_USE_EPOLL
 		struct epoll_event pevents[ 200 ];
-		result = epoll_wait( Epollfd, pevents, 200, -1 );
+		result = epoll_wait( Epollfd, pevents, 200, my_conflation.hasPending() ? conflationFlushDelayMs : -1 );
 		if ((result == -1) && (errno == EINTR)) 
 		{
-				break;
+				// interrupted by a signal, either SIGINT (terminate) or SIGUSR1 (statistics)
+				continue;
 		}
 		for ( int i = 0; i < result; i++ )
 		{
@@ -325,58 +394,158 @@ Epollfd = my_socketServer.getEpollDescriptor();
 
 #endif // #if _WIN32
     }
+
+    completeRoutedMessages();
 }
 
-void RTIG::signalHandler(int sig)
+#ifdef CERTI_USE_IO_URING
+void RTIG::executeWithRing()
 {
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-    std::cerr << "//////////////////////" << std::endl;
-    std::cerr << "/////  TIMINGS  //////" << std::endl;
-    std::cerr << "//////////////////////" << std::endl;
-
-    for (auto& kv : the_timings) {
-        auto message = NM_Factory::create(static_cast<NetworkMessage::Type>(kv.first));
-        std::cerr << static_cast<std::underlying_type<NetworkMessage::Type>::type>(kv.first) << " - "
-                  << message->getMessageName() << std::endl;
-        delete message;
-
-        auto& values = kv.second;
-        std::sort(begin(values), end(values));
-
-        std::cerr << "\tcount: " << values.size() << std::endl;
-        std::cerr << "\tmin: " << values.front().count() << " ns" << std::endl;
-        std::cerr << "\tmax: " << values.back().count() << " ns" << std::endl;
-        std::cerr << "\taverage: "
-                  << std::accumulate(begin(values), end(values), std::chrono::nanoseconds{}).count() / values.size()
-                  << " ns" << std::endl;
-        std::cerr << "\tmedian: " << values.at(values.size() / 2).count() << " ns" << std::endl;
-
-#if 0
-        std::cerr << "\t\t";
-        for (auto& time : values) {
-            std::cerr << time.count() << " ";
-        }
-        std::cerr << std::endl;
-#endif
+    my_transport.reset(new RingTransport(std::move(my_ring)));
+    my_pipeline.batchWrites(my_transport.get());
+    my_transport->listen(my_tcpSocketServer);
+
+    if (my_verboseLevel > 0) {
+        std::cout << "RTIG reading and writing through io_uring" << std::endl;
+    }
+
+    while (!terminate) {
+        completeRoutedMessages();
+
+        if (statistics_requested) {
+            statistics_requested = 0;
+            dumpStatistics();
+        }
+
+        if (my_conflation.hasPending()) {
+            flushConflatedUpdates();
+        }
+
+        closeFailedConnections(nullptr);
+
+        if (!my_transport->wait(my_conflation.hasPending() ? conflationFlushDelayMs : -1)) {
+            // interrupted by a signal, either SIGINT (terminate) or SIGUSR1 (statistics)
+            continue;
+        }
+
+        for (const auto accepted : my_transport->takeAccepted()) {
+            Debug(D, pdCom) << "New client" << std::endl;
+            completeRoutedMessages();
+            try {
+                my_transport->watch(my_socketServer.openAccepted(accepted));
+                Debug(D, pdInit) << "Accepting new connection" << std::endl;
+            }
+            catch (RTIinternalError& e) {
+                Debug(D, pdExcept) << "Error while accepting new connection: " << e.reason() << std::endl;
+            }
+        }
+
+        while (auto link = my_transport->nextReadable()) {
+            Debug(D, pdCom) << "Incoming message on socket " << link->returnSocket() << std::endl;
+
+            try {
+                processIncomingMessage(link, my_transport->receive(link));
+            }
+            catch (NetworkError& e) {
+                if (!e.reason().empty()) {
+                    Debug(D, pdExcept) << "Catching Network Error, reason: " << e.reason() << std::endl;
+                }
+                else {
+                    Debug(D, pdExcept) << "Catching Network Error, unknown reason" << std::endl;
+                }
+                std::cout << "RTIG dropping client connection " << link->returnSocket() << '.' << std::endl;
+                closeConnection(link, true);
+            }
+        }
+
+        for (const auto& link : my_transport->takeClosedSockets()) {
+            std::cout << "RTIG dropping client connection " << link->returnSocket() << '.' << std::endl;
+            closeConnection(link, true);
+        }
     }
 
-    std::cerr << "//////////////////////" << std::endl;
-    std::cerr << "/////  TIMINGS  //////" << std::endl;
-    std::cerr << "//////////////////////" << std::endl;
+    completeRoutedMessages();
+    my_pipeline.batchWrites(nullptr);
+    my_transport.reset();
+}
 #endif
 
+void RTIG::signalHandler(int sig)
+{
     Debug(D, pdError) << "Received Signal: " << sig << std::endl;
 
     if (sig == SIGINT) {
         terminate = true;
     }
 #ifndef _WIN32
+    if (sig == SIGUSR1) {
+        statistics_requested = 1;
+    }
     if (sig == SIGPIPE) {
         std::cout << "Ignoring 'Broken pipe' signal" << std::endl;
     }
 #endif
 }
 
+void RTIG::dumpStatistics()
+{
+    std::ofstream stream(RTIG_STATISTICS_FILENAME, std::ios::trunc);
+    if (!stream.is_open()) {
+        Debug(D, pdError) << "Could not open statistics file " << RTIG_STATISTICS_FILENAME << std::endl;
+        return;
+    }
+    my_pipeline.drain();
+    my_pipeline.collect(my_statistics);
+    my_statistics.dump(stream);
+    if (my_conflation.isEnabled()) {
+        my_conflation.dump(stream);
+        stream.flush();
+    }
+
+    const auto& compression = my_processor.compression().statistics();
+    if (compression.decompressed != 0) {
+        stream << "compression\tall\tdecompressed\t" << compression.decompressed << '\n'
+               << "compression\tall\tdecompression_us\t"
+               << std::chrono::duration_cast<std::chrono::microseconds>(compression.decompression_time).count()
+               << '\n';
+        stream.flush();
+    }
+
+    if (my_router) {
+        const auto& routing = my_router->statistics();
+        stream << "routing\tall\trouters\t" << my_router->routers() << '\n'
+               << "routing\tall\trouted\t" << routing.routed << '\n'
+               << "routing\tall\tbatches\t" << routing.batches << '\n'
+               << "routing\tall\tlargest_batch\t" << routing.largest_batch << '\n'
+               << "routing\tall\trouted_by_caller\t" << routing.routed_by_caller << '\n';
+        stream.flush();
+    }
+
+#ifdef CERTI_USE_IO_URING
+    if (my_transport) {
+        const auto& ring = my_transport->statistics();
+        stream << "io_uring\tall\tenters\t" << ring.enters << '\n'
+               << "io_uring\tall\tsubmitted\t" << ring.submitted << '\n'
+               << "io_uring\tall\tcompletions\t" << ring.completions << '\n';
+        stream.flush();
+    }
+#endif
+
+    if (my_verboseLevel > 0) {
+        std::cout << "RTIG statistics written to " << RTIG_STATISTICS_FILENAME << std::endl;
+    }
+}
+
+const MessageStatistics& RTIG::getStatistics() const
+{
+    return my_statistics;
+}
+
+const Conflation& RTIG::getConflation() const
+{
+    return my_conflation;
+}
+
 void RTIG::setVerboseLevel(const int level)
 {
     my_verboseLevel = level;
@@ -406,22 +575,60 @@ Socket* RTIG::processIncomingMessage(Socket* link)
 {
     Debug(G, pdGendoc) << "enter RTIG::processIncomingMessage" << std::endl;
 
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-    auto start = std::chrono::high_resolution_clock::now();
-#endif
-
     if (!link) {
         Debug(D, pdError) << "No socket in processIncomingMessage" << std::endl;
         return nullptr;
     }
 
-    auto msg = MessageEvent<NetworkMessage>(link, std::unique_ptr<NetworkMessage>(NM_Factory::receive(link)));
+    return processIncomingMessage(link, std::unique_ptr<NetworkMessage>(NM_Factory::receive(link)));
+}
+
+Socket* RTIG::processIncomingMessage(Socket* link, std::unique_ptr<NetworkMessage> message)
+{
+    switch (message->getMessageType()) {
+    case NetworkMessage::Type::RELAY_OPEN:
+    case NetworkMessage::Type::RELAY_CLOSE:
+    case NetworkMessage::Type::RELAY_DATA:
+        processRelayMessage(link, std::move(message));
+        link = closeFailedConnections(link);
+        my_pipeline.collect(my_statistics);
+        Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
+        return link;
+    default:
+        return processMessage(link, std::move(message));
+    }
+}
+
+Socket* RTIG::processMessage(Socket* link, std::unique_ptr<NetworkMessage> message, const bool resumed)
+{
+    if (deferForPeers(link, message, resumed)) {
+        return link;
+    }
+
+    auto msg = MessageEvent<NetworkMessage>(link, std::move(message));
 
     auto federate = msg.message()->getFederate();
+    auto federation = msg.message()->getFederation();
     auto messageType = msg.message()->getMessageType();
 
+    // the reflections of a traced update carry its trace id
+    const auto trace = LatencyTrace::traceOf(*msg.message());
+    LatencyTrace::instance().stamp(trace, TraceSpan::Hop::RTIG_RECEIVE);
+
+    // completed once every response is written
+    auto record = my_pipeline.record(messageType, federation);
+
+    if (my_router) {
+        if (my_processor.routesConcurrently(*msg.message())) {
+            my_router->dispatch(std::move(msg), std::move(record), trace);
+            return link;
+        }
+        // this message may change what the dispatched ones are routed with
+        completeRoutedMessages();
+    }
+
     my_auditServer.startLine(
-        msg.message()->getFederation(),
+        federation,
         federate,
         AuditLine::Type(static_cast<std::underlying_type<NetworkMessage::Type>::type>(messageType)));
 
@@ -441,28 +648,25 @@ Socket* RTIG::processIncomingMessage(Socket* link)
         else {
             auto responses = my_processor.processEvent(std::move(msg));
 
-            Debug(D, pdDebug) << responses.size() << " responses" << std::endl;
-            for (auto& response : responses) {
-                Debug(D, pdDebug) << "Send back " << response.message()->getMessageName() << " to " << response.sockets().size() << " federates" << std::endl;
-                for (const auto& socket: response.sockets()) {
-                    if(socket) {
-                        Debug(D, pdDebug) << "to " << socket->returnSocket() << std::endl;
-                    }
-                    else {
-                        Debug(D, pdDebug) << "to nullptr" << std::endl;
-                    }
-                }
-                response.message()->send(response.sockets(), my_NM_msgBufSend); // send answer to RTIA
+            sendResponses(responses, record, trace);
+
+            if (messageType == NetworkMessage::Type::PEER_ROUTES_INVALIDATED) {
+                resumeDeferredMessages(federation);
+            }
+
+            // opted in classes must be resolved again in the federations that changed
+            if (messageType == NetworkMessage::Type::CREATE_FEDERATION_EXECUTION
+                || messageType == NetworkMessage::Type::JOIN_FEDERATION_EXECUTION
+                || messageType == NetworkMessage::Type::DESTROY_FEDERATION_EXECUTION) {
+                my_conflation.resetClasses();
             }
         }
 
         my_auditServer.endLine(AuditLine::Status(Exception::Type::NO_EXCEPTION), " - OK");
 
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-        auto end = std::chrono::high_resolution_clock::now();
-
-        the_timings[messageType].push_back(end - start);
-#endif
+        record.reset();
+        link = closeFailedConnections(link);
+        my_pipeline.collect(my_statistics);
 
         Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
         return link;
@@ -477,37 +681,294 @@ Socket* RTIG::processIncomingMessage(Socket* link)
 
     // Default Handler
     catch (Exception& e) {
-        Debug(D, pdExcept) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
-        Debug(G, pdGendoc) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
+        sendException(link, messageType, federate, e, record);
 
-        // Server Answer(only if an exception is raised)
-        auto response = std::unique_ptr<NetworkMessage>(NM_Factory::create(messageType));
-        response->setFederate(federate);
-        response->setException(e.type(), e.reason());
+        record.reset();
+        link = closeFailedConnections(link);
+        my_pipeline.collect(my_statistics);
 
-        my_auditServer.setLevel(AuditLine::Level(10));
-        my_auditServer.endLine(AuditLine::Status(e.type()), e.reason() + " - Exception");
+        Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
+        return link;
+    }
+}
 
-        if (link) {
-            Debug(G, pdGendoc) << "            processIncomingMessage ===> send exception back to RTIA" << std::endl;
-            response->send(link, my_NM_msgBufSend);
-            Debug(D, pdExcept) << "RTIG caught exception " << static_cast<long>(e.type())
-                               << " and sent it back to federate " << federate << std::endl;
+bool RTIG::deferForPeers(Socket* link, std::unique_ptr<NetworkMessage>& message, const bool resumed)
+{
+    const auto type = message->getMessageType();
+
+    // what the held messages wait for
+    if (type == NetworkMessage::Type::CLOSE_CONNEXION || type == NetworkMessage::Type::PEER_ROUTES_INVALIDATED
+        || type == NetworkMessage::Type::PEER_FENCE) {
+        return false;
+    }
+
+    auto held = my_deferred.find(message->getFederation());
+    if (!resumed && held != end(my_deferred)) {
+        held->second.emplace_back(link, std::move(message));
+        return true;
+    }
+
+    if (PeerRoutes::keepsRoutes(type)) {
+        return false;
+    }
+
+    // the updates already routed may give routes
+    completeRoutedMessages();
+
+    for (auto& invalidation : my_processor.invalidatePeerRoutes(*message)) {
+        send(invalidation, nullptr);
+    }
+    if (!my_processor.awaitsPeerRoutes(*message)) {
+        return false;
+    }
+
+    Debug(D, pdDebug) << "Holding " << message->getMessageName() << " until peers stop using their routes"
+                      << std::endl;
+    // a resumed message is the first one of the federation
+    my_deferred[message->getFederation()].emplace_front(link, std::move(message));
+    return true;
+}
+
+void RTIG::resumeDeferredMessages(const Handle federation)
+{
+    auto held = my_deferred.find(federation);
+    while (held != end(my_deferred)) {
+        if (held->second.empty()) {
+            my_deferred.erase(held);
+            return;
+        }
+        if (my_processor.awaitsPeerRoutes(*held->second.front().second)) {
+            return;
         }
 
-#ifdef LOG_MESSAGE_PROCESSING_TIMINGS
-        auto end = std::chrono::high_resolution_clock::now();
+        auto next = std::move(held->second.front());
+        held->second.pop_front();
+        try {
+            processMessage(next.first, std::move(next.second), true);
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdExcept) << "Closing connection of a held message: " << e.reason() << std::endl;
+            closeConnection(next.first, true);
+        }
+        held = my_deferred.find(federation);
+    }
+}
 
-        the_timings[messageType].push_back(end - start);
-#endif
+void RTIG::sendResponses(Responses& responses,
+                         const std::shared_ptr<SendPipeline::Record>& record,
+                         const uint64_t trace)
+{
+    Debug(D, pdDebug) << responses.size() << " responses" << std::endl;
+    for (auto& response : responses) {
+        if (trace && response.message()->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
+            static_cast<NM_Reflect_Attribute_Values*>(response.message())->setTraceId(trace);
+        }
+        Debug(D, pdDebug) << "Send back " << response.message()->getMessageName() << " to " << response.sockets().size() << " federates" << std::endl;
+        for (const auto& socket: response.sockets()) {
+            if(socket) {
+                Debug(D, pdDebug) << "to " << socket->returnSocket() << std::endl;
+            }
+            else {
+                Debug(D, pdDebug) << "to nullptr" << std::endl;
+            }
+        }
+        send(response, record); // send answer to RTIA
+    }
+}
 
-        Debug(G, pdGendoc) << "exit  RTIG::processIncomingMessage" << std::endl;
-        return link;
+void RTIG::sendException(Socket* link,
+                         const NetworkMessage::Type type,
+                         const FederateHandle federate,
+                         const Exception& e,
+                         const std::shared_ptr<SendPipeline::Record>& record)
+{
+    Debug(D, pdExcept) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
+    Debug(G, pdGendoc) << "Caught Exception: " << e.name() << " - " << e.reason() << std::endl;
+
+    // Server Answer(only if an exception is raised)
+    auto response = std::unique_ptr<NetworkMessage>(NM_Factory::create(type));
+    response->setFederate(federate);
+    response->setException(e.type(), e.reason());
+
+    my_auditServer.setLevel(AuditLine::Level(10));
+    my_auditServer.endLine(AuditLine::Status(e.type()), e.reason() + " - Exception");
+
+    if (link) {
+        Debug(G, pdGendoc) << "            processIncomingMessage ===> send exception back to RTIA" << std::endl;
+        my_pipeline.push({link}, std::move(response), record);
+        Debug(D, pdExcept) << "RTIG caught exception " << static_cast<long>(e.type())
+                           << " and sent it back to federate " << federate << std::endl;
+    }
+}
+
+void RTIG::completeRoutedMessages()
+{
+    if (!my_router) {
+        return;
+    }
+    my_router->complete([this](ParallelRouter::Job& job) { completeRoutedMessage(job); });
+    my_pipeline.collect(my_statistics);
+}
+
+void RTIG::completeRoutedMessage(ParallelRouter::Job& job)
+{
+    const auto link = job.request.sockets().front();
+    const auto federate = job.request.message()->getFederate();
+    const auto messageType = job.request.message()->getMessageType();
+
+    my_auditServer.startLine(
+        job.request.message()->getFederation(),
+        federate,
+        AuditLine::Type(static_cast<std::underlying_type<NetworkMessage::Type>::type>(messageType)));
+
+    try {
+        // This may throw a security error.
+        my_socketServer.checkMessage(link->returnSocket(), job.request.message());
+
+        if (job.error) {
+            std::rethrow_exception(job.error);
+        }
+
+        auto responses = my_processor.processEvent(std::move(job.request), std::move(job.responses));
+
+        sendResponses(responses, job.record, job.trace);
+
+        my_auditServer.endLine(AuditLine::Status(Exception::Type::NO_EXCEPTION), " - OK");
+    }
+    catch (Exception& e) {
+        sendException(link, messageType, federate, e, job.record);
+    }
+
+    job.record.reset();
+}
+
+void RTIG::processRelayMessage(Socket* link, std::unique_ptr<NetworkMessage> message)
+{
+    auto& relay = my_relays[link];
+    if (!relay) {
+        Debug(D, pdInit) << "Socket " << link->returnSocket() << " is a relay link" << std::endl;
+        relay.reset(new RelayLink(link));
+    }
+
+    switch (message->getMessageType()) {
+    case NetworkMessage::Type::RELAY_OPEN:
+        completeRoutedMessages();
+        my_socketServer.open(relay->open(static_cast<NM_Relay_Open*>(message.get())->getChannel()));
+        break;
+
+    case NetworkMessage::Type::RELAY_CLOSE:
+        // unknown once the RTIG closed it
+        if (auto channel = relay->find(static_cast<NM_Relay_Close*>(message.get())->getChannel())) {
+            std::cout << "RTIG dropping relayed client connection " << channel->returnSocket() << '.' << std::endl;
+            closeConnection(channel, true);
+        }
+        break;
+
+    default: {
+        auto& data = *static_cast<NM_Relay_Data*>(message.get());
+        auto channel = data.getChannelsSize() == 1 ? relay->find(data.getChannels(0)) : nullptr;
+        if (!channel) {
+            Debug(D, pdDebug) << "Dropping message relayed for a closed channel" << std::endl;
+            break;
+        }
+        try {
+            processMessage(channel, relay->unwrap(data));
+        }
+        catch (NetworkError& e) {
+            Debug(D, pdExcept) << "Catching Network Error on relay channel, reason: " << e.reason() << std::endl;
+            std::cout << "RTIG dropping relayed client connection " << channel->returnSocket() << '.' << std::endl;
+            closeConnection(channel, true);
+        }
+    } break;
+    }
+}
+
+void RTIG::send(MessageEvent<NetworkMessage>& response, const std::shared_ptr<SendPipeline::Record>& record)
+{
+    auto message = response.message();
+
+    NM_Reflect_Attribute_Values* reflection{nullptr};
+    if (my_conflation.isEnabled() && message->getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES) {
+        auto candidate = static_cast<NM_Reflect_Attribute_Values*>(message);
+        try {
+            auto& root = my_federations.searchFederation(FederationHandle(candidate->getFederation())).getRootObject();
+            if (my_conflation.accepts(*candidate, root)) {
+                reflection = candidate;
+            }
+        }
+        catch (FederationExecutionDoesNotExist& e) {
+        }
+    }
+
+    if (!reflection && !my_conflation.hasPending()) {
+        my_pipeline.push(response.sockets(), response.releaseMessage(), record);
+        return;
+    }
+
+    std::vector<Socket*> ready;
+    for (const auto& socket : response.sockets()) {
+        if (!socket) {
+            continue;
+        }
+        if (reflection && (my_conflation.hasPending(socket) || !isReadyToWrite(socket))) {
+            if (my_conflation.push(socket, *reflection)) {
+                continue;
+            }
+            Debug(D, pdDebug) << "Conflation queue of socket " << socket->returnSocket() << " is full" << std::endl;
+        }
+        flushConflatedUpdates(socket, true);
+        ready.push_back(socket);
+    }
+
+    if (!ready.empty()) {
+        my_pipeline.push(ready, response.releaseMessage(), record);
+    }
+}
+
+bool RTIG::isReadyToWrite(Socket* socket) const
+{
+    if (my_pipeline.isBusy(socket)) {
+        return false;
     }
+    auto channel = dynamic_cast<RelayChannel*>(socket);
+    return isWritable(channel ? channel->relay().upstream() : socket);
+}
+
+void RTIG::flushConflatedUpdates(Socket* socket, const bool blocking)
+{
+    if (!blocking && !isReadyToWrite(socket)) {
+        return;
+    }
+    while (auto pending = my_conflation.pop(socket)) {
+        my_pipeline.push({socket}, std::move(pending), nullptr);
+    }
+}
+
+void RTIG::flushConflatedUpdates()
+{
+    for (const auto& socket : my_conflation.pendingSockets()) {
+        flushConflatedUpdates(socket, false);
+    }
+}
+
+Socket* RTIG::closeFailedConnections(Socket* link)
+{
+    for (auto failed = my_pipeline.takeFailedSockets(); !failed.empty(); failed = my_pipeline.takeFailedSockets()) {
+        for (const auto& socket : failed) {
+            std::cout << "RTIG dropping client connection " << socket->returnSocket() << '.' << std::endl;
+            if (socket == link) {
+                link = nullptr;
+            }
+            closeConnection(socket, true);
+        }
+    }
+    return link;
 }
 
 void RTIG::openConnection()
 {
+    completeRoutedMessages();
+
     try {
         my_socketServer.open();
         Debug(D, pdInit) << "Accepting new connection" << std::endl;
@@ -523,6 +984,35 @@ void RTIG::closeConnection(Socket* link, bool emergency)
     FederateHandle federate(0);
 
     Debug(G, pdGendoc) << "enter RTIG::closeConnection" << std::endl;
+
+    // the messages dispatched may be answered on link
+    completeRoutedMessages();
+
+    auto relay = my_relays.find(link);
+    if (relay != end(my_relays)) {
+        relay->second->detach();
+        for (const auto& channel : relay->second->channels()) {
+            closeConnection(channel, true);
+        }
+        my_relays.erase(relay);
+    }
+
+    my_conflation.forget(link);
+    my_pipeline.forget(link);
+    for (auto& kv : my_deferred) {
+        auto& held = kv.second;
+        held.erase(std::remove_if(begin(held),
+                                  end(held),
+                                  [link](const std::pair<Socket*, std::unique_ptr<NetworkMessage>>& message) {
+                                      return message.first == link;
+                                  }),
+                   end(held));
+    }
+#ifdef CERTI_USE_IO_URING
+    if (my_transport) {
+        my_transport->forget(link);
+    }
+#endif
     try {
         my_socketServer.close(link->returnSocket(), federation, federate);
     }
@@ -533,11 +1023,14 @@ void RTIG::closeConnection(Socket* link, bool emergency)
     if (emergency) {
         Debug(D, pdExcept) << "Killing Federate(" << federation << ", " << federate << ")..." << std::endl;
         for (auto& response : my_federations.killFederate(federation, federate)) {
-            response.message()->send(response.sockets(), my_NM_msgBufSend);
+            send(response, nullptr);
         }
         Debug(D, pdExcept) << "Federate(" << federation << ", " << federate << ") killed" << std::endl;
     }
 
+    // the federate may have been waited for
+    resumeDeferredMessages(federation.get());
+
     Debug(G, pdGendoc) << "exit  RTIG::closeConnection" << std::endl;
 }
 
@@ -562,6 +1055,17 @@ int RTIG::inferUdpPort()
         return std::stoi(defaultUdpPort);
     }
 }
+
+AuditFile::Format RTIG::inferAuditFormat()
+{
+    auto audit_format_s = getenv(auditFormatEnvironmentVariable);
+    if (audit_format_s && std::string(audit_format_s) == "binary") {
+        return AuditFile::Format::Binary;
+    }
+    else {
+        return AuditFile::Format::Text;
+    }
+}
 }
 } // namespace certi/rtig
 
@@ -24,6 +24,10 @@
 #define CERTI_RTIG_HH
 
 // #include <netinet/in.h>
+#include <csignal>
+#include <deque>
+#include <map>
+#include <memory>
 #include <string>
 
 #include <include/certi.hh>
@@ -39,8 +43,17 @@
 #include <libCERTI/SocketTCP.hh>
 #include <libCERTI/SocketUDP.hh>
 
+#include "Conflation.hh"
 #include "FederationsList.hh"
 #include "MessageProcessor.hh"
+#include "MessageStatistics.hh"
+#include "ParallelRouter.hh"
+#include "RelayLink.hh"
+#include "SendPipeline.hh"
+
+#ifdef CERTI_USE_IO_URING
+#include "RingTransport.hh"
+#endif
 
 namespace certi {
 
@@ -72,11 +85,24 @@ public:
     void setVerboseLevel(const int level);
     void setListeningIPAddress(const std::string& hostName);
 
+    const MessageStatistics& getStatistics() const;
+
+    const Conflation& getConflation() const;
+
 private:
     static bool terminate;
+    static volatile std::sig_atomic_t statistics_requested;
+
+    /// Write message statistics to RTIG_STATISTICS_FILENAME, requested by SIGUSR1.
+    void dumpStatistics();
 
     void createSocketServers();
 
+#ifdef CERTI_USE_IO_URING
+    /// The loop of execute, with the sockets read and written through my_ring.
+    void executeWithRing();
+#endif
+
     /** Process incoming messages.
          *
          * This module works as follows:
@@ -90,18 +116,92 @@ private:
          */
     Socket* processIncomingMessage(Socket*);
 
+    /// Process message, received already on link, see processIncomingMessage(Socket*).
+    Socket* processIncomingMessage(Socket* link, std::unique_ptr<NetworkMessage> message);
+
+    /** Process message, received on link.
+     *
+     * @param resumed true for a message held by deferForPeers() before
+     * @return link, or nullptr if it was closed
+     */
+    Socket* processMessage(Socket* link, std::unique_ptr<NetworkMessage> message, const bool resumed = false);
+
+    /** Hold message, received on link, while peers of its federation did not
+     * answer the invalidation of their routes.
+     *
+     * A request which may change the routing invalidates the routes first,
+     * and waits for the answers if any route was held. Any other request of
+     * the federation waits behind it, but the answers and fences.
+     *
+     * @return true if message was held
+     */
+    bool deferForPeers(Socket* link, std::unique_ptr<NetworkMessage>& message, const bool resumed);
+
+    /// Process the messages held for federation, until it waits for peers again.
+    void resumeDeferredMessages(const Handle federation);
+
+    /// Send the responses to a message, traced by trace if not 0.
+    void sendResponses(Responses& responses, const std::shared_ptr<SendPipeline::Record>& record, const uint64_t trace);
+
+    /// Answer the message of type from federate on link with the exception it raised.
+    void sendException(Socket* link,
+                       const NetworkMessage::Type type,
+                       const FederateHandle federate,
+                       const Exception& e,
+                       const std::shared_ptr<SendPipeline::Record>& record);
+
+    /** Process the messages dispatched to my_router, in the order they were received.
+     *
+     * Called before anything which may change what they were routed with.
+     * The connections a write failed on are closed afterwards, by the caller.
+     */
+    void completeRoutedMessages();
+
+    /// Process a message routed by my_router, as processMessage would have.
+    void completeRoutedMessage(ParallelRouter::Job& job);
+
+    /// Open, close or process what a channel of the relay on link sent.
+    void processRelayMessage(Socket* link, std::unique_ptr<NetworkMessage> message);
+
+    /** Push response to the send pipeline, for its sockets.
+     *
+     * Reflections the conflation policy accepts are queued for the sockets
+     * which are not ready to be written to. Anything else first flushes the
+     * queue of its sockets, so that the order of messages is kept.
+     *
+     * @param record statistics the writes are accounted to, may be null
+     */
+    void send(MessageEvent<NetworkMessage>& response, const std::shared_ptr<SendPipeline::Record>& record);
+
+    /// true if nothing is being written to socket and it can be written to without blocking.
+    bool isReadyToWrite(Socket* socket) const;
+
+    /// Send the reflections queued for socket, if it is ready or blocking.
+    void flushConflatedUpdates(Socket* socket, const bool blocking);
+
+    /// Send queued reflections to every socket ready to be written to.
+    void flushConflatedUpdates();
+
+    /** Close the connections a write failed on.
+     *
+     * @return link, or nullptr if it was one of them
+     */
+    Socket* closeFailedConnections(Socket* link);
+
     void openConnection();
 
     /** closeConnection
          * 
          * If a connection is closed in emergency, KillFederate will be called on
          * federations attribute to remove all references to this federate.
+         * The channels of a relay link are closed in emergency first.
          */
     void closeConnection(Socket*, bool emergency);
 
 private:
     static int inferTcpPort();
     static int inferUdpPort();
+    static AuditFile::Format inferAuditFormat();
 
     int my_tcpPort;
     int my_udpPort;
@@ -110,15 +210,34 @@ private:
     HandleManager<Handle> my_federationHandles;
     SocketTCP my_tcpSocketServer;
     SocketUDP my_udpSocketServer;
+    /// Messages held by deferForPeers(), by federation, with the link they came from
+    std::map<Handle, std::deque<std::pair<Socket*, std::unique_ptr<NetworkMessage>>>> my_deferred;
+    /// Links of the relays, by upstream socket. Declared before the server owning their channels
+    std::map<Socket*, std::unique_ptr<RelayLink>> my_relays;
     SocketServer my_socketServer;
     AuditFile my_auditServer;
     FederationsList my_federations;
-    /** The message buffer used to send Network messages */
-    MessageBuffer my_NM_msgBufSend;
     /** The message buffer used to receive Network messages */
     MessageBuffer my_NM_msgBufReceive;
     
     MessageProcessor my_processor;
+
+    MessageStatistics my_statistics;
+
+    Conflation my_conflation;
+
+#ifdef CERTI_USE_IO_URING
+    /// Created with the RTIG, nullptr if the kernel does not provide it: epoll is used then
+    std::unique_ptr<IoUring> my_ring;
+    /// Set while execute reads and writes through the ring
+    std::unique_ptr<RingTransport> my_transport;
+#endif
+
+    /// Declared after anything it writes to, so that it is stopped before
+    SendPipeline my_pipeline;
+
+    /// nullptr without router. Declared last, the records of its requests complete in the pipeline
+    std::unique_ptr<ParallelRouter> my_router;
 };
 }
 } // namespaces
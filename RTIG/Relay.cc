@@ -0,0 +1,213 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "Relay.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/PrettyDebug.hh>
+
+namespace certi {
+namespace rtig {
+
+static PrettyDebug D("RELAY", "(Relay) ");
+
+volatile std::sig_atomic_t Relay::terminate = 0;
+
+Relay::Relay(const in_port_t port, const std::string& rtig_host, const in_port_t rtig_port)
+    : my_links(&my_server, nullptr)
+{
+    my_server.createServer(port, htonl(INADDR_LOOPBACK));
+    my_upstream.createConnection(rtig_host.c_str(), rtig_port);
+    Debug(D, pdInit) << "Relaying port " << my_server.returnPort() << " to " << rtig_host << ":" << rtig_port
+                     << std::endl;
+}
+
+void Relay::execute()
+{
+    while (!terminate && !my_upstream_lost) {
+        fd_set fd;
+        FD_ZERO(&fd);
+        FD_SET(my_server.returnSocket(), &fd);
+        FD_SET(my_upstream.returnSocket(), &fd);
+        int fd_max = std::max(my_links.addToFDSet(&fd),
+                              std::max(my_server.returnSocket(), my_upstream.returnSocket()));
+
+        if (select(fd_max + 1, &fd, nullptr, nullptr, nullptr) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw NetworkError("select failed <" + std::string(strerror(errno)) + ">");
+        }
+
+        if (FD_ISSET(my_upstream.returnSocket(), &fd)) {
+            try {
+                do {
+                    dispatch();
+                } while (my_upstream.isDataReady());
+            }
+            catch (NetworkError& e) {
+                Debug(D, pdInit) << "RTIG link closed: " << e.reason() << std::endl;
+                return;
+            }
+        }
+
+        while (auto link = my_links.getActiveSocket(&fd)) {
+            FD_CLR(link->returnSocket(), &fd);
+            try {
+                do {
+                    forward(link);
+                } while (link->isDataReady());
+            }
+            catch (NetworkError& e) {
+                if (my_upstream_lost) {
+                    Debug(D, pdInit) << "RTIG link closed: " << e.reason() << std::endl;
+                    return;
+                }
+                Debug(D, pdInit) << "RTIA link closed: " << e.reason() << std::endl;
+                closeConnection(link, true);
+            }
+        }
+
+        if (FD_ISSET(my_server.returnSocket(), &fd)) {
+            openConnection();
+        }
+    }
+}
+
+void Relay::signalHandler(int sig)
+{
+    if (sig == SIGINT || sig == SIGTERM) {
+        terminate = 1;
+    }
+}
+
+const Relay::Statistics& Relay::statistics() const
+{
+    return my_statistics;
+}
+
+void Relay::openConnection()
+{
+    auto link = my_links.open();
+    const auto channel = my_next_channel++;
+    my_links_by_channel.emplace(channel, link);
+    my_channels.emplace(link, channel);
+
+    NM_Relay_Open message;
+    message.setChannel(channel);
+    sendUpstream(message);
+    Debug(D, pdInit) << "RTIA connected on channel " << channel << std::endl;
+}
+
+void Relay::sendUpstream(NetworkMessage& message)
+{
+    try {
+        message.send(&my_upstream, my_outgoing);
+    }
+    catch (NetworkError&) {
+        my_upstream_lost = true;
+        throw;
+    }
+}
+
+void Relay::forward(Socket* link)
+{
+    my_incoming.reset();
+    link->receive(my_incoming(0), libhla::MessageBuffer::reservedBytes);
+    my_incoming.assumeSizeFromReservedBytes();
+    link->receive(my_incoming(libhla::MessageBuffer::reservedBytes),
+                  my_incoming.size() - libhla::MessageBuffer::reservedBytes);
+
+    const auto data = static_cast<const char*>(my_incoming(0));
+    NM_Relay_Data message;
+    message.setChannelsSize(1);
+    message.setChannels(my_channels.at(link), 0);
+    message.setPayload(AttributeValue_t(data, data + my_incoming.size()));
+    sendUpstream(message);
+    ++my_statistics.forwarded;
+}
+
+void Relay::dispatch()
+{
+    std::unique_ptr<NetworkMessage> message(NM_Factory::receive(&my_upstream));
+    ++my_statistics.received;
+
+    switch (message->getMessageType()) {
+    case NetworkMessage::Type::RELAY_DATA: {
+        const auto& data = *static_cast<NM_Relay_Data*>(message.get());
+        const auto payload = reinterpret_cast<const unsigned char*>(data.getPayload().data());
+        for (const auto& channel : data.getChannels()) {
+            auto it = my_links_by_channel.find(channel);
+            if (it == end(my_links_by_channel)) {
+                // closed by the RTIA, the RTIG does not know yet
+                continue;
+            }
+            try {
+                it->second->send(payload, data.getPayload().size());
+                ++my_statistics.delivered;
+            }
+            catch (NetworkError& e) {
+                Debug(D, pdInit) << "Cannot write to channel " << channel << ": " << e.reason() << std::endl;
+                closeConnection(it->second, true);
+            }
+        }
+    } break;
+
+    case NetworkMessage::Type::RELAY_CLOSE: {
+        auto it = my_links_by_channel.find(static_cast<NM_Relay_Close*>(message.get())->getChannel());
+        if (it != end(my_links_by_channel)) {
+            closeConnection(it->second, false);
+        }
+    } break;
+
+    default:
+        Debug(D, pdError) << "Unexpected " << message->getMessageName() << " from the RTIG" << std::endl;
+        break;
+    }
+}
+
+void Relay::closeConnection(Socket* link, const bool tell_rtig)
+{
+    const auto channel = my_channels.at(link);
+    my_channels.erase(link);
+    my_links_by_channel.erase(channel);
+
+    FederationHandle federation(0);
+    FederateHandle federate(0);
+    my_links.close(link->returnSocket(), federation, federate);
+
+    if (tell_rtig) {
+        NM_Relay_Close message;
+        message.setChannel(channel);
+        sendUpstream(message);
+    }
+    Debug(D, pdInit) << "Channel " << channel << " closed" << std::endl;
+}
+
+} // namespace rtig
+} // namespace certi
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_RELAY_HH
+#define CERTI_RTIG_RELAY_HH
+
+#include <csignal>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/SocketServer.hh>
+#include <libCERTI/SocketTCP.hh>
+#include <libHLA/MessageBuffer.hh>
+
+namespace certi {
+namespace rtig {
+
+/** Relay between the RTIAs of a host and the RTIG.
+ *
+ * The RTIAs connect to the relay on the loopback interface as they would to
+ * the RTIG, and the relay forwards all they send on a single link to the RTIG,
+ * each RTIA on a channel of its own. What the RTIG sends to several RTIAs of
+ * the host crosses the network once, with the list of their channels, and the
+ * relay writes it to each of them.
+ *
+ * Messages are forwarded as they are read, the relay never deserializes what
+ * the RTIAs and the RTIG exchange.
+ */
+class Relay {
+public:
+    struct Statistics {
+        /// messages forwarded to the RTIG
+        uint64_t forwarded{0};
+        /// messages read from the RTIG, and written to the RTIAs
+        uint64_t received{0};
+        uint64_t delivered{0};
+    };
+
+    /** Listen on port of the loopback interface, and connect to the RTIG.
+     *
+     * @param rtig_host RTIG host name or address
+     */
+    Relay(const in_port_t port, const std::string& rtig_host, const in_port_t rtig_port);
+
+    /// Relay until the RTIG link is closed or a signal stops the relay.
+    void execute();
+
+    static void signalHandler(int sig);
+
+    const Statistics& statistics() const;
+
+private:
+    static volatile std::sig_atomic_t terminate;
+
+    void openConnection();
+
+    /// Forward a message of link to the RTIG.
+    void forward(Socket* link);
+
+    /// Write what the RTIG sent to the RTIAs it is for.
+    void dispatch();
+
+    /// Write message to the RTIG, a failure means the RTIG link is lost.
+    void sendUpstream(NetworkMessage& message);
+
+    /// Close link, telling the RTIG if it did not close it itself.
+    void closeConnection(Socket* link, const bool tell_rtig);
+
+    SocketTCP my_server;
+    SocketServer my_links;
+    SocketTCP my_upstream;
+    bool my_upstream_lost{false};
+
+    std::map<uint32_t, Socket*> my_links_by_channel{};
+    std::map<Socket*, uint32_t> my_channels{};
+    uint32_t my_next_channel{1};
+
+    libhla::MessageBuffer my_incoming{};
+    libhla::MessageBuffer my_outgoing{};
+    Statistics my_statistics{};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_RELAY_HH
@@ -0,0 +1,204 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "RelayLink.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/PrettyDebug.hh>
+
+namespace certi {
+namespace rtig {
+
+static PrettyDebug D("RTIG_RELAY", "(RTIG Relay) ");
+
+namespace {
+/// Descriptors of the channels, below those of real sockets
+std::atomic<int> nextDescriptor{-2};
+}
+
+RelayLink::RelayLink(Socket* upstream) : my_upstream(upstream)
+{
+}
+
+std::unique_ptr<NetworkMessage> RelayLink::unwrap(const NM_Relay_Data& data)
+{
+    const auto& payload = data.getPayload();
+    if (payload.size() < libhla::MessageBuffer::reservedBytes) {
+        throw NetworkError("Relayed message of " + std::to_string(payload.size()) + " bytes");
+    }
+
+    my_incoming.resize(payload.size());
+    memcpy(my_incoming(0), payload.data(), payload.size());
+    my_incoming.assumeSizeFromReservedBytes();
+    if (my_incoming.size() != payload.size()) {
+        throw NetworkError("Relayed message of " + std::to_string(payload.size()) + " bytes claims "
+                           + std::to_string(my_incoming.size()));
+    }
+
+    NetworkMessage generic;
+    generic.deserialize(my_incoming);
+    std::unique_ptr<NetworkMessage> message(NM_Factory::create(generic.getMessageType()));
+    my_incoming.assumeSizeFromReservedBytes();
+    message->deserialize(my_incoming);
+    return message;
+}
+
+Socket* RelayLink::upstream() const
+{
+    return my_upstream;
+}
+
+RelayChannel* RelayLink::open(const uint32_t channel)
+{
+    if (my_channels.count(channel) != 0) {
+        throw RTIinternalError("Relay channel " + std::to_string(channel) + " is already open");
+    }
+    auto link = new RelayChannel(*this, channel);
+    my_channels.emplace(channel, link);
+    Debug(D, pdInit) << "Channel " << channel << " opened on relay link " << my_upstream->returnSocket()
+                     << " as " << link->returnSocket() << std::endl;
+    return link;
+}
+
+RelayChannel* RelayLink::find(const uint32_t channel) const
+{
+    auto it = my_channels.find(channel);
+    return it == end(my_channels) ? nullptr : it->second;
+}
+
+std::vector<RelayChannel*> RelayLink::channels() const
+{
+    std::vector<RelayChannel*> channels;
+    for (const auto& kv : my_channels) {
+        channels.push_back(kv.second);
+    }
+    return channels;
+}
+
+void RelayLink::send(const std::vector<RelayChannel*>& channels, const unsigned char* data, const size_t size)
+{
+    NM_Relay_Data envelope;
+    envelope.setChannelsSize(channels.size());
+    for (uint32_t i = 0; i < channels.size(); ++i) {
+        envelope.setChannels(channels[i]->channel(), i);
+    }
+    envelope.setPayload(AttributeValue_t(data, data + size));
+    write(envelope);
+}
+
+void RelayLink::detach()
+{
+    std::lock_guard<std::mutex> lock(my_mutex);
+    my_detached = true;
+}
+
+void RelayLink::close(RelayChannel* channel)
+{
+    my_channels.erase(channel->channel());
+
+    NM_Relay_Close message;
+    message.setChannel(channel->channel());
+    try {
+        write(message);
+    }
+    catch (NetworkError& e) {
+        Debug(D, pdExcept) << "Cannot tell the relay channel " << channel->channel()
+                           << " is closed: " << e.reason() << std::endl;
+    }
+}
+
+void RelayLink::write(NetworkMessage& message)
+{
+    std::lock_guard<std::mutex> lock(my_mutex);
+    if (my_detached) {
+        return;
+    }
+    try {
+        message.send(my_upstream, my_buffer);
+    }
+    catch (NetworkError&) {
+        // part of the message may be written, nothing else can be
+        my_detached = true;
+        throw;
+    }
+}
+
+RelayChannel::RelayChannel(RelayLink& relay, const uint32_t channel)
+    : my_relay(relay), my_channel(channel), my_descriptor(nextDescriptor--)
+{
+}
+
+RelayChannel::~RelayChannel()
+{
+    close();
+}
+
+RelayLink& RelayChannel::relay() const
+{
+    return my_relay;
+}
+
+uint32_t RelayChannel::channel() const
+{
+    return my_channel;
+}
+
+void RelayChannel::close()
+{
+    if (!my_closed) {
+        my_closed = true;
+        my_relay.close(this);
+    }
+}
+
+void RelayChannel::send(const unsigned char* data, size_t size)
+{
+    my_relay.send({this}, data, size);
+}
+
+void RelayChannel::receive(void*, unsigned long)
+{
+    throw NetworkError("Messages of relay channel " + std::to_string(my_channel) + " come through the relay link");
+}
+
+bool RelayChannel::isDataReady() const
+{
+    return false;
+}
+
+unsigned long RelayChannel::returnAdress() const
+{
+    return my_relay.upstream()->returnAdress();
+}
+
+SOCKET RelayChannel::returnSocket()
+{
+    return my_descriptor;
+}
+
+} // namespace rtig
+} // namespace certi
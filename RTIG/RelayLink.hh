@@ -0,0 +1,137 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_RELAY_LINK_HH
+#define CERTI_RTIG_RELAY_LINK_HH
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/SocketTCP.hh>
+#include <libHLA/MessageBuffer.hh>
+
+namespace certi {
+
+class NM_Relay_Data;
+
+namespace rtig {
+
+class RelayChannel;
+
+/** The link of a host-local relay, which carries the messages of every RTIA
+ * of its host.
+ *
+ * Each RTIA connected to the relay is seen by the RTIG through a channel,
+ * which takes the place of its TCP link in the SocketServer. A message sent to
+ * several channels of the same relay is written once, with their list, and the
+ * relay writes it to each RTIA.
+ */
+class RelayLink {
+public:
+    explicit RelayLink(Socket* upstream);
+
+    RelayLink(const RelayLink&) = delete;
+    RelayLink& operator=(const RelayLink&) = delete;
+
+    /// Read the message carried by data, from the routing thread.
+    std::unique_ptr<NetworkMessage> unwrap(const NM_Relay_Data& data);
+
+    Socket* upstream() const;
+
+    /** Create the link of the RTIA the relay opened channel for.
+     *
+     * It is owned by the caller, and must be deleted before the relay link.
+     */
+    RelayChannel* open(const uint32_t channel);
+
+    /// Link of channel, nullptr if it is not open.
+    RelayChannel* find(const uint32_t channel) const;
+
+    std::vector<RelayChannel*> channels() const;
+
+    /** Write the serialized message in data to the RTIAs of channels.
+     *
+     * Nothing is written once the relay link is detached.
+     */
+    void send(const std::vector<RelayChannel*>& channels, const unsigned char* data, const size_t size);
+
+    /// Stop writing to the relay, its link is being closed.
+    void detach();
+
+private:
+    friend class RelayChannel;
+
+    /// Tell the relay channel is closed, and forget it.
+    void close(RelayChannel* channel);
+
+    /// Write message upstream, unless detached.
+    void write(NetworkMessage& message);
+
+    Socket* my_upstream;
+    std::map<uint32_t, RelayChannel*> my_channels{};
+    libhla::MessageBuffer my_incoming{};
+
+    /// the routing thread and the writer of the relay both write upstream
+    std::mutex my_mutex{};
+    libhla::MessageBuffer my_buffer{};
+    bool my_detached{false};
+};
+
+/** Link of the RTIA which connected to a relay.
+ *
+ * The channel has no descriptor of its own, returnSocket gives a negative
+ * value, unique among the channels, which the SocketServer does not wait on.
+ * Messages from the RTIA come through the relay link.
+ */
+class RelayChannel : public SocketTCP {
+public:
+    RelayChannel(RelayLink& relay, const uint32_t channel);
+    ~RelayChannel();
+
+    RelayLink& relay() const;
+    uint32_t channel() const;
+
+    void close() override;
+    void send(const unsigned char* data, size_t size) override;
+    void receive(void* buffer, unsigned long size) override;
+    bool isDataReady() const override;
+
+    /// Address of the relay.
+    unsigned long returnAdress() const override;
+
+    SOCKET returnSocket() override;
+
+private:
+    RelayLink& my_relay;
+    const uint32_t my_channel;
+    const SOCKET my_descriptor;
+    bool my_closed{false};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_RELAY_LINK_HH
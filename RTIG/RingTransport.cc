@@ -0,0 +1,314 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+
+#include "RingTransport.hh"
+
+#include <cerrno>
+
+#include <libCERTI/PrettyDebug.hh>
+#include <libCERTI/SocketTCP.hh>
+
+namespace certi {
+namespace rtig {
+
+static PrettyDebug D("RTIG_RING", "(RTIG Ring) ");
+
+namespace {
+constexpr auto requestShift = 56;
+constexpr uint64_t idMask = (uint64_t{1} << requestShift) - 1;
+}
+
+RingTransport::RingTransport(std::unique_ptr<IoUring> ring) : my_ring{std::move(ring)}
+{
+}
+
+uint64_t RingTransport::data(const Request request, const uint64_t id)
+{
+    return (static_cast<uint64_t>(request) << requestShift) | id;
+}
+
+void RingTransport::listen(SocketTCP& server)
+{
+    my_server = server.returnSocket();
+    my_ring->accept(my_server, data(Request::Accept, 0));
+    my_ring->submit();
+}
+
+void RingTransport::watch(Socket* socket)
+{
+    auto connection = std::unique_ptr<Connection>(new Connection{socket, my_next_id++});
+    my_sockets[socket] = connection.get();
+    my_ring->receive(socket->returnSocket(), data(Request::Receive, connection->id));
+    Debug(D, pdDebug) << "Watching socket " << socket->returnSocket() << " as connection " << connection->id
+                      << std::endl;
+    my_connections[connection->id] = std::move(connection);
+}
+
+void RingTransport::forget(Socket* socket)
+{
+    auto connection = find(socket);
+    if (!connection) {
+        return;
+    }
+
+    drain();
+
+    my_ring->cancel(data(Request::Receive, connection->id));
+    my_ring->submit();
+
+    my_sockets.erase(socket);
+    my_connections.erase(connection->id);
+}
+
+bool RingTransport::wait(const int timeout_ms)
+{
+    submitWrites();
+
+    // what was reaped before is not handled yet
+    const bool pending = !my_readable.empty() || !my_accepted.empty() || !my_closed.empty() || !my_failed.empty();
+
+    const bool waited = my_ring->wait(pending ? 0 : timeout_ms);
+    my_ring->reap([this](const IoUring::Completion& completion) { complete(completion); });
+    return waited;
+}
+
+std::vector<SOCKET> RingTransport::takeAccepted()
+{
+    std::vector<SOCKET> accepted;
+    accepted.swap(my_accepted);
+    return accepted;
+}
+
+Socket* RingTransport::nextReadable()
+{
+    while (!my_readable.empty()) {
+        const auto id = my_readable.front();
+        my_readable.pop_front();
+
+        auto it = my_connections.find(id);
+        if (it == end(my_connections)) {
+            continue;
+        }
+        it->second->readable = false;
+        if (it->second->incoming.hasMessage()) {
+            return it->second->socket;
+        }
+    }
+    return nullptr;
+}
+
+std::unique_ptr<NetworkMessage> RingTransport::receive(Socket* socket)
+{
+    auto connection = find(socket);
+    if (!connection) {
+        return nullptr;
+    }
+
+    auto message = connection->incoming.takeMessage();
+
+    // one message at a time, for each connection in turn
+    if (connection->incoming.hasMessage() && !connection->readable) {
+        connection->readable = true;
+        my_readable.push_back(connection->id);
+    }
+    return message;
+}
+
+std::vector<Socket*> RingTransport::takeClosedSockets()
+{
+    std::vector<Socket*> closed;
+    for (const auto id : my_closed) {
+        auto it = my_connections.find(id);
+        if (it != end(my_connections)) {
+            closed.push_back(it->second->socket);
+        }
+    }
+    my_closed.clear();
+    return closed;
+}
+
+void RingTransport::write(Socket* socket, const unsigned char* data, const size_t size)
+{
+    auto connection = find(socket);
+    if (!connection) {
+        // not accepted through the ring
+        socket->send(data, size);
+        return;
+    }
+    if (connection->failed) {
+        return;
+    }
+
+    if (connection->queued.empty() && connection->writing.empty()) {
+        my_unsent.push_back(connection->id);
+    }
+    connection->queued.insert(end(connection->queued), data, data + size);
+}
+
+bool RingTransport::isBusy(Socket* socket) const
+{
+    auto connection = find(socket);
+    return connection && (!connection->writing.empty() || !connection->queued.empty());
+}
+
+void RingTransport::drain()
+{
+    submitWrites();
+    while (my_writing > 0) {
+        my_ring->wait(-1);
+        my_ring->reap([this](const IoUring::Completion& completion) { complete(completion); });
+        submitWrites();
+    }
+}
+
+std::vector<Socket*> RingTransport::takeFailedSockets()
+{
+    std::vector<Socket*> failed;
+    for (const auto id : my_failed) {
+        auto it = my_connections.find(id);
+        if (it != end(my_connections)) {
+            failed.push_back(it->second->socket);
+        }
+    }
+    my_failed.clear();
+    return failed;
+}
+
+const IoUring::Statistics& RingTransport::statistics() const
+{
+    return my_ring->statistics();
+}
+
+void RingTransport::complete(const IoUring::Completion& completion)
+{
+    const auto request = static_cast<Request>(completion.data >> requestShift);
+
+    if (request == Request::Accept) {
+        if (completion.result >= 0) {
+            my_accepted.push_back(completion.result);
+        }
+        else if (completion.result != -ECANCELED) {
+            Debug(D, pdError) << "Accept failed: " << -completion.result << std::endl;
+        }
+        if (!completion.more && completion.result != -ECANCELED) {
+            my_ring->accept(my_server, data(Request::Accept, 0));
+        }
+        return;
+    }
+
+    // the connection may be forgotten already
+    auto it = my_connections.find(completion.data & idMask);
+    if (it == end(my_connections)) {
+        return;
+    }
+
+    if (request == Request::Receive) {
+        received(*it->second, completion);
+    }
+    else {
+        sent(*it->second, completion);
+    }
+}
+
+void RingTransport::received(Connection& connection, const IoUring::Completion& completion)
+{
+    if (completion.result > 0) {
+        connection.incoming.append(completion.bytes, completion.result);
+        if (!connection.readable && connection.incoming.hasMessage()) {
+            connection.readable = true;
+            my_readable.push_back(connection.id);
+        }
+        if (!completion.more) {
+            my_ring->receive(connection.socket->returnSocket(), data(Request::Receive, connection.id));
+        }
+    }
+    else if (completion.result == -ENOBUFS) {
+        // every buffer was in use: the receive stopped, the buffers are back now
+        my_ring->receive(connection.socket->returnSocket(), data(Request::Receive, connection.id));
+    }
+    else if (completion.result != -ECANCELED) {
+        Debug(D, pdDebug) << "Connection " << connection.id << " closed: " << -completion.result << std::endl;
+        my_closed.push_back(connection.id);
+    }
+}
+
+void RingTransport::sent(Connection& connection, const IoUring::Completion& completion)
+{
+    if (completion.result < 0) {
+        Debug(D, pdError) << "Send to connection " << connection.id << " failed: " << -completion.result << std::endl;
+        --my_writing;
+        connection.failed = true;
+        connection.writing.clear();
+        connection.queued.clear();
+        connection.written = 0;
+        my_failed.push_back(connection.id);
+        return;
+    }
+
+    connection.written += completion.result;
+    if (connection.written < connection.writing.size()) {
+        my_ring->send(connection.socket->returnSocket(),
+                      connection.writing.data() + connection.written,
+                      connection.writing.size() - connection.written,
+                      data(Request::Send, connection.id));
+        return;
+    }
+
+    --my_writing;
+    connection.writing.clear();
+    connection.written = 0;
+    if (!connection.queued.empty()) {
+        my_unsent.push_back(connection.id);
+    }
+}
+
+void RingTransport::submitWrites()
+{
+    for (const auto id : my_unsent) {
+        auto it = my_connections.find(id);
+        if (it == end(my_connections)) {
+            continue;
+        }
+        auto& connection = *it->second;
+        if (!connection.writing.empty() || connection.queued.empty()) {
+            continue;
+        }
+
+        connection.writing.swap(connection.queued);
+        my_ring->send(connection.socket->returnSocket(),
+                      connection.writing.data(),
+                      connection.writing.size(),
+                      data(Request::Send, connection.id));
+        ++my_writing;
+    }
+    my_unsent.clear();
+}
+
+RingTransport::Connection* RingTransport::find(Socket* socket) const
+{
+    auto it = my_sockets.find(socket);
+    return it == end(my_sockets) ? nullptr : it->second;
+}
+
+} // namespace rtig
+} // namespace certi
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_RING_TRANSPORT_HH
+#define CERTI_RTIG_RING_TRANSPORT_HH
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <libCERTI/FrameBuffer.hh>
+#include <libCERTI/IoUring.hh>
+#include <libCERTI/NetworkMessage.hh>
+#include <libCERTI/Socket.hh>
+
+#include "SendPipeline.hh"
+
+namespace certi {
+
+class SocketTCP;
+
+namespace rtig {
+
+/** The sockets of the RTIG, read and written through an io_uring.
+ *
+ * Connections are accepted and read by multishot requests, which the kernel
+ * keeps going: the bytes received are cut into messages as they complete.
+ * The writes of the routing thread are queued by socket, and submitted with
+ * the wait for the next completions, in a single system call, at most one
+ * send being in flight for each socket.
+ */
+class RingTransport : public SendPipeline::BatchWriter {
+public:
+    explicit RingTransport(std::unique_ptr<IoUring> ring);
+
+    RingTransport(const RingTransport&) = delete;
+    RingTransport& operator=(const RingTransport&) = delete;
+
+    /// Accept the connections to server, see takeAccepted.
+    void listen(SocketTCP& server);
+
+    /// Read what socket receives.
+    void watch(Socket* socket);
+
+    /// Write what is queued for socket, then stop reading it, before it is closed.
+    void forget(Socket* socket);
+
+    /** Submit the queued writes, then wait for completions, timeout_ms at most,
+     * forever if negative.
+     *
+     * @return false if a signal interrupted the wait
+     */
+    bool wait(const int timeout_ms);
+
+    /// Descriptors of the connections accepted since the last call.
+    std::vector<SOCKET> takeAccepted();
+
+    /// A socket which received a complete message, nullptr if none did.
+    Socket* nextReadable();
+
+    /// The next complete message received on socket, nullptr if there is none.
+    std::unique_ptr<NetworkMessage> receive(Socket* socket);
+
+    /// Sockets closed by their peer, or a read failed on, since the last call.
+    std::vector<Socket*> takeClosedSockets();
+
+    void write(Socket* socket, const unsigned char* data, const size_t size) override;
+    bool isBusy(Socket* socket) const override;
+    void drain() override;
+    std::vector<Socket*> takeFailedSockets() override;
+
+    const IoUring::Statistics& statistics() const;
+
+private:
+    enum class Request : uint64_t { Accept = 1, Receive, Send };
+
+    struct Connection {
+        Socket* socket;
+        uint64_t id;
+        FrameBuffer incoming{};
+        /// In nextReadable's queue
+        bool readable{false};
+        /// Written once the write in flight is done
+        std::vector<unsigned char> queued{};
+        /// The write in flight
+        std::vector<unsigned char> writing{};
+        size_t written{0};
+        bool failed{false};
+    };
+
+    static uint64_t data(const Request request, const uint64_t id);
+
+    void complete(const IoUring::Completion& completion);
+    void received(Connection& connection, const IoUring::Completion& completion);
+    void sent(Connection& connection, const IoUring::Completion& completion);
+
+    /// Send what is queued for the connections with no write in flight.
+    void submitWrites();
+
+    Connection* find(Socket* socket) const;
+
+    std::unique_ptr<IoUring> my_ring;
+    int my_server{-1};
+
+    /// By id: completions may come after a connection is forgotten
+    std::unordered_map<uint64_t, std::unique_ptr<Connection>> my_connections{};
+    std::unordered_map<Socket*, Connection*> my_sockets{};
+    uint64_t my_next_id{1};
+
+    std::vector<SOCKET> my_accepted{};
+    std::deque<uint64_t> my_readable{};
+    std::vector<uint64_t> my_closed{};
+    std::vector<uint64_t> my_failed{};
+    /// Connections with queued bytes and no write in flight
+    std::vector<uint64_t> my_unsent{};
+    /// Number of writes in flight
+    size_t my_writing{0};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_RING_TRANSPORT_HH
@@ -0,0 +1,384 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "SendPipeline.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <signal.h>
+#endif
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/LatencyTrace.hh>
+#include <libCERTI/Socket.hh>
+
+#include "MessageStatistics.hh"
+#include "RelayLink.hh"
+
+namespace {
+static constexpr auto writersEnvironmentVariable = "CERTI_RTIG_WRITERS";
+static constexpr size_t defaultWriters{2};
+
+/// Jobs a writer may have queued before push blocks
+static constexpr size_t maxQueuedJobs{4096};
+}
+
+namespace certi {
+namespace rtig {
+
+/// A message and its serialized form, shared by the writers it is sent from.
+struct SendPipeline::Outgoing {
+    Outgoing(std::unique_ptr<NetworkMessage> message, const std::shared_ptr<Record>& record)
+        : message(std::move(message)), record(record)
+    {
+    }
+
+    std::unique_ptr<NetworkMessage> message;
+    std::shared_ptr<Record> record;
+    std::once_flag serialized{};
+    MessageBuffer buffer{};
+};
+
+SendPipeline::Record::Record(const NetworkMessage::Type type, const Handle federation)
+    : type(type), federation(federation), start(std::chrono::steady_clock::now()), fanout(0), bytes(0)
+{
+}
+
+SendPipeline::SendPipeline(const size_t writers)
+{
+#ifndef _WIN32
+    // signals are handled by the routing thread, writers inherit a blocked mask
+    sigset_t all;
+    sigset_t previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);
+#endif
+
+    for (size_t i = 0; i < writers; ++i) {
+        my_writers.emplace_back(new Writer);
+        auto& writer = *my_writers.back();
+        writer.thread = std::thread([this, &writer] { run(writer); });
+    }
+
+#ifndef _WIN32
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+#endif
+}
+
+SendPipeline::~SendPipeline()
+{
+    for (auto& writer : my_writers) {
+        {
+            std::lock_guard<std::mutex> lock(writer->mutex);
+            writer->stop = true;
+        }
+        writer->wake.notify_one();
+    }
+    for (auto& writer : my_writers) {
+        writer->thread.join();
+    }
+}
+
+size_t SendPipeline::writersFromEnvironment(const bool batched)
+{
+    if (auto writers_s = getenv(writersEnvironmentVariable)) {
+        return std::stoul(writers_s);
+    }
+    return batched ? 0 : defaultWriters;
+}
+
+size_t SendPipeline::writers() const
+{
+    return my_writers.size();
+}
+
+void SendPipeline::batchWrites(BatchWriter* batch)
+{
+    if (!my_writers.empty()) {
+        return;
+    }
+    if (my_batch) {
+        my_batch->drain();
+    }
+    my_batch = batch;
+}
+
+std::shared_ptr<SendPipeline::Record> SendPipeline::record(const NetworkMessage::Type type, const Handle federation)
+{
+    return std::shared_ptr<Record>(new Record(type, federation), [this](Record* record) {
+        complete(record);
+        delete record;
+    });
+}
+
+void SendPipeline::push(const std::vector<Socket*>& sockets,
+                        std::unique_ptr<NetworkMessage> message,
+                        const std::shared_ptr<Record>& record)
+{
+    auto outgoing = std::make_shared<Outgoing>(std::move(message), record);
+
+    // sockets of each writer involved, in the order they were given
+    std::vector<std::pair<Writer*, std::vector<Socket*>>> parts;
+    for (const auto& socket : sockets) {
+        if (!socket) {
+            continue;
+        }
+        auto writer = &writerOf(socket);
+        auto part = std::find_if(
+            begin(parts), end(parts), [writer](const std::pair<Writer*, std::vector<Socket*>>& p) {
+                return p.first == writer;
+            });
+        if (part == end(parts)) {
+            parts.emplace_back(writer, std::vector<Socket*>{});
+            part = end(parts) - 1;
+        }
+        part->second.push_back(socket);
+    }
+
+    for (auto& part : parts) {
+        auto& writer = *part.first;
+        Job job{outgoing, std::move(part.second)};
+
+        if (my_writers.empty()) {
+            write(writer, job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(writer.mutex);
+        writer.written.wait(lock, [&writer] { return writer.jobs.size() < maxQueuedJobs; });
+        for (const auto& socket : job.sockets) {
+            ++writer.pending[socket];
+        }
+        writer.jobs.push_back(std::move(job));
+        lock.unlock();
+        writer.wake.notify_one();
+    }
+}
+
+bool SendPipeline::isBusy(Socket* socket) const
+{
+    if (my_batch) {
+        return my_batch->isBusy(socket);
+    }
+    auto it = my_assignments.find(socket);
+    if (it == end(my_assignments)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(it->second->mutex);
+    return it->second->pending.count(socket) != 0;
+}
+
+void SendPipeline::drain()
+{
+    for (auto& writer : my_writers) {
+        std::unique_lock<std::mutex> lock(writer->mutex);
+        writer->written.wait(lock, [&writer] { return writer->jobs.empty() && !writer->writing; });
+    }
+    if (my_batch) {
+        my_batch->drain();
+    }
+}
+
+void SendPipeline::forget(Socket* socket)
+{
+    auto it = my_assignments.find(socket);
+    auto& writer = it == end(my_assignments) ? my_inline_writer : *it->second;
+
+    std::unique_lock<std::mutex> lock(writer.mutex);
+    writer.written.wait(lock, [&writer, socket] { return writer.pending.count(socket) == 0; });
+    writer.failed.erase(socket);
+    lock.unlock();
+
+    if (it != end(my_assignments)) {
+        my_assignments.erase(it);
+    }
+}
+
+std::vector<Socket*> SendPipeline::takeFailedSockets()
+{
+    std::vector<Socket*> sockets;
+    auto take = [&sockets](Writer& writer) {
+        std::lock_guard<std::mutex> lock(writer.mutex);
+        for (auto& kv : writer.failed) {
+            if (!kv.second) {
+                kv.second = true;
+                sockets.push_back(kv.first);
+            }
+        }
+    };
+
+    take(my_inline_writer);
+    for (auto& writer : my_writers) {
+        take(*writer);
+    }
+    if (my_batch) {
+        auto failed = my_batch->takeFailedSockets();
+        sockets.insert(end(sockets), begin(failed), end(failed));
+    }
+    return sockets;
+}
+
+void SendPipeline::collect(MessageStatistics& statistics)
+{
+    std::vector<Completed> completed;
+    {
+        std::lock_guard<std::mutex> lock(my_completed_mutex);
+        completed.swap(my_completed);
+    }
+    for (const auto& entry : completed) {
+        statistics.record(entry.type, entry.federation, entry.processing, entry.fanout, entry.bytes);
+    }
+}
+
+SendPipeline::Writer& SendPipeline::writerOf(Socket* socket)
+{
+    if (my_writers.empty()) {
+        return my_inline_writer;
+    }
+    auto it = my_assignments.find(socket);
+    if (it == end(my_assignments)) {
+        auto writer = my_writers[my_next_writer % my_writers.size()].get();
+        if (auto channel = dynamic_cast<RelayChannel*>(socket)) {
+            writer = &writerOf(channel->relay().upstream());
+        }
+        else {
+            ++my_next_writer;
+        }
+        it = my_assignments.emplace(socket, writer).first;
+    }
+    return *it->second;
+}
+
+void SendPipeline::run(Writer& writer)
+{
+    std::unique_lock<std::mutex> lock(writer.mutex);
+    for (;;) {
+        writer.wake.wait(lock, [&writer] { return writer.stop || !writer.jobs.empty(); });
+        if (writer.jobs.empty()) {
+            return;
+        }
+
+        auto job = std::move(writer.jobs.front());
+        writer.jobs.pop_front();
+        writer.writing = true;
+        lock.unlock();
+
+        write(writer, job);
+        auto sockets = std::move(job.sockets);
+        // the record may complete here, out of the lock
+        job.outgoing.reset();
+
+        lock.lock();
+        writer.writing = false;
+        for (const auto& socket : sockets) {
+            auto pending = writer.pending.find(socket);
+            if (--pending->second == 0) {
+                writer.pending.erase(pending);
+            }
+        }
+        writer.written.notify_all();
+    }
+}
+
+void SendPipeline::write(Writer& writer, Job& job)
+{
+    auto& outgoing = *job.outgoing;
+    std::call_once(outgoing.serialized, [&outgoing] {
+        LatencyTrace::instance().stamp(LatencyTrace::traceOf(*outgoing.message), TraceSpan::Hop::RTIG_SEND);
+        outgoing.buffer.reset();
+        outgoing.message->serialize(outgoing.buffer);
+        outgoing.buffer.updateReservedBytes();
+    });
+
+    uint64_t fanout{0};
+    // channels of each relay, written in one envelope
+    std::vector<std::pair<RelayLink*, std::vector<RelayChannel*>>> relayed;
+    for (const auto& socket : job.sockets) {
+        {
+            std::lock_guard<std::mutex> lock(writer.mutex);
+            if (writer.failed.count(socket) != 0) {
+                continue;
+            }
+        }
+        if (auto channel = dynamic_cast<RelayChannel*>(socket)) {
+            auto relay = &channel->relay();
+            auto part = std::find_if(
+                begin(relayed), end(relayed), [relay](const std::pair<RelayLink*, std::vector<RelayChannel*>>& p) {
+                    return p.first == relay;
+                });
+            if (part == end(relayed)) {
+                relayed.emplace_back(relay, std::vector<RelayChannel*>{});
+                part = end(relayed) - 1;
+            }
+            part->second.push_back(channel);
+            continue;
+        }
+        if (my_batch) {
+            my_batch->write(socket, static_cast<unsigned char*>(outgoing.buffer(0)), outgoing.buffer.size());
+            ++fanout;
+            continue;
+        }
+        try {
+            socket->send(static_cast<unsigned char*>(outgoing.buffer(0)), outgoing.buffer.size());
+            ++fanout;
+        }
+        catch (Exception& e) {
+            std::lock_guard<std::mutex> lock(writer.mutex);
+            writer.failed.emplace(socket, false);
+        }
+    }
+    for (const auto& part : relayed) {
+        try {
+            part.first->send(part.second, static_cast<unsigned char*>(outgoing.buffer(0)), outgoing.buffer.size());
+            fanout += part.second.size();
+        }
+        catch (Exception& e) {
+            std::lock_guard<std::mutex> lock(writer.mutex);
+            for (const auto& channel : part.second) {
+                writer.failed.emplace(channel, false);
+            }
+        }
+    }
+
+    if (outgoing.record) {
+        outgoing.record->fanout += fanout;
+        outgoing.record->bytes += fanout * outgoing.buffer.size();
+    }
+}
+
+void SendPipeline::complete(Record* record)
+{
+    std::lock_guard<std::mutex> lock(my_completed_mutex);
+    my_completed.push_back({record->type,
+                            record->federation,
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+                                                                                 - record->start),
+                            record->fanout.load(),
+                            record->bytes.load()});
+}
+
+} // namespace rtig
+} // namespace certi
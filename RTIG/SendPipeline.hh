@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_SEND_PIPELINE_HH
+#define CERTI_RTIG_SEND_PIPELINE_HH
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <libCERTI/Handle.hh>
+#include <libCERTI/NetworkMessage.hh>
+#include <libHLA/MessageBuffer.hh>
+
+namespace certi {
+
+class Socket;
+
+namespace rtig {
+
+class MessageStatistics;
+
+/** Serialization and socket writes of the RTIG responses.
+ *
+ * The routing thread pushes responses, a pool of writer threads serializes
+ * and writes them, so that the next incoming message can be processed while
+ * the previous fan-out is still being written. Each socket is always written
+ * by the same writer, in push order; a message sent to sockets of several
+ * writers is serialized once, by the first of them.
+ *
+ * The number of writers is read from CERTI_RTIG_WRITERS. With no writer, push
+ * writes the responses itself, as the RTIG used to.
+ *
+ * A socket a write failed on is reported by takeFailedSockets, nothing more is
+ * written to it until it is forgotten.
+ *
+ * The channels of a relay are written by the writer of the relay link, a
+ * message sent to several of them is written to the relay once.
+ *
+ * With no writer, the writes may be handed to a BatchWriter instead, which
+ * queues them and hands them to the kernel together, see RingTransport.
+ */
+class SendPipeline {
+public:
+    /** Statistics of one processed message.
+     *
+     * They are complete, and handed to collect, once every response pushed
+     * with the record is written and the routing thread released it.
+     */
+    struct Record {
+        Record(const NetworkMessage::Type type, const Handle federation);
+
+        const NetworkMessage::Type type;
+        const Handle federation;
+        const std::chrono::steady_clock::time_point start;
+        std::atomic<uint64_t> fanout;
+        std::atomic<uint64_t> bytes;
+    };
+
+    /// Writes of the routing thread, queued until the processing of incoming messages pauses.
+    class BatchWriter {
+    public:
+        virtual ~BatchWriter() = default;
+
+        /// Queue the size bytes of data, copied, to be written to socket.
+        virtual void write(Socket* socket, const unsigned char* data, const size_t size) = 0;
+
+        /// true if bytes queued for socket are not written yet.
+        virtual bool isBusy(Socket* socket) const = 0;
+
+        /// Block until every byte queued is written.
+        virtual void drain() = 0;
+
+        /// Sockets a write failed on, not reported yet.
+        virtual std::vector<Socket*> takeFailedSockets() = 0;
+    };
+
+    explicit SendPipeline(const size_t writers);
+
+    /// Write everything pushed, then stop the writers.
+    ~SendPipeline();
+
+    SendPipeline(const SendPipeline&) = delete;
+    SendPipeline& operator=(const SendPipeline&) = delete;
+
+    /// Number of writers read from CERTI_RTIG_WRITERS, none by default if the writes are batched.
+    static size_t writersFromEnvironment(const bool batched = false);
+
+    size_t writers() const;
+
+    /** Hand the writes to batch, nullptr to write them at once again.
+     *
+     * Ignored with writers, which write on their own. Drained first.
+     */
+    void batchWrites(BatchWriter* batch);
+
+    /// Start recording the statistics of a message of type, for federation.
+    std::shared_ptr<Record> record(const NetworkMessage::Type type, const Handle federation);
+
+    /** Queue message to be written to sockets.
+     *
+     * Blocks while the queue of one of the writers involved is full.
+     * @param record statistics the writes are accounted to, may be null
+     */
+    void push(const std::vector<Socket*>& sockets,
+              std::unique_ptr<NetworkMessage> message,
+              const std::shared_ptr<Record>& record);
+
+    /// true if messages pushed for socket are not written yet.
+    bool isBusy(Socket* socket) const;
+
+    /// Block until every message pushed is written.
+    void drain();
+
+    /// Drain, then drop everything known about socket, which is about to be closed.
+    void forget(Socket* socket);
+
+    /// Sockets a write failed on, not reported yet.
+    std::vector<Socket*> takeFailedSockets();
+
+    /// Move the records completed so far to statistics.
+    void collect(MessageStatistics& statistics);
+
+private:
+    struct Outgoing;
+    struct Job {
+        std::shared_ptr<Outgoing> outgoing;
+        std::vector<Socket*> sockets;
+    };
+
+    struct Writer {
+        mutable std::mutex mutex{};
+        std::condition_variable wake{};
+        std::condition_variable written{};
+        std::deque<Job> jobs{};
+        bool writing{false};
+        bool stop{false};
+        /// number of queued jobs per socket
+        std::unordered_map<Socket*, size_t> pending{};
+        /// sockets a write failed on, and whether they were reported
+        std::unordered_map<Socket*, bool> failed{};
+        std::thread thread{};
+    };
+
+    struct Completed {
+        NetworkMessage::Type type;
+        Handle federation;
+        std::chrono::nanoseconds processing;
+        uint64_t fanout;
+        uint64_t bytes;
+    };
+
+    Writer& writerOf(Socket* socket);
+    void run(Writer& writer);
+    void write(Writer& writer, Job& job);
+    void complete(Record* record);
+
+    std::vector<std::unique_ptr<Writer>> my_writers{};
+    /// written from the routing thread when there is no writer thread
+    Writer my_inline_writer{};
+    /// queues the writes of the inline writer, if not null
+    BatchWriter* my_batch{nullptr};
+
+    /// Writer assigned to each socket, round robin
+    std::unordered_map<Socket*, Writer*> my_assignments{};
+    size_t my_next_writer{0};
+
+    std::mutex my_completed_mutex{};
+    std::vector<Completed> my_completed{};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_SEND_PIPELINE_HH
@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "SerializedFom.hh"
+
+#include <libCERTI/RootObject.hh>
+#include <libHLA/MessageBuffer.hh>
+
+namespace {
+using certi::rtig::SerializedFom;
+
+/** Message whose FOM fields are left empty and replaced by the cached encoding.
+ *
+ * The three FOM vectors are the last fields of both NM_Join_Federation_Execution
+ * and NM_Additional_Fom_Module. Left empty, they are serialized as three zero
+ * sizes, which are overwritten with the cached encoding.
+ */
+template <typename Message>
+class WithEncodedFom : public Message {
+public:
+    explicit WithEncodedFom(std::shared_ptr<const SerializedFom::Bytes> fom) : my_fom(std::move(fom))
+    {
+    }
+
+    void serialize(libhla::MessageBuffer& msgBuffer) override
+    {
+        Message::serialize(msgBuffer);
+        msgBuffer.seek_write(msgBuffer.size() - 3 * sizeof(uint32_t));
+        msgBuffer.write_uint8s(my_fom->data(), static_cast<uint32_t>(my_fom->size()));
+    }
+
+private:
+    std::shared_ptr<const SerializedFom::Bytes> my_fom;
+};
+
+template <typename Message>
+void copyFields(const certi::NM_Additional_Fom_Module& from, Message& to)
+{
+    to.setRoutingSpacesSize(from.getRoutingSpacesSize());
+    for (uint32_t i{0}; i < from.getRoutingSpacesSize(); ++i) {
+        to.setRoutingSpaces(from.getRoutingSpaces(i), i);
+    }
+    to.setObjectClassesSize(from.getObjectClassesSize());
+    for (uint32_t i{0}; i < from.getObjectClassesSize(); ++i) {
+        to.setObjectClasses(from.getObjectClasses(i), i);
+    }
+    to.setInteractionClassesSize(from.getInteractionClassesSize());
+    for (uint32_t i{0}; i < from.getInteractionClassesSize(); ++i) {
+        to.setInteractionClasses(from.getInteractionClasses(i), i);
+    }
+}
+}
+
+namespace certi {
+namespace rtig {
+
+SerializedFom::SerializedFom(RootObject& root_object) : my_root_object(root_object)
+{
+}
+
+void SerializedFom::invalidate()
+{
+    my_is_valid = false;
+}
+
+bool SerializedFom::isValid() const
+{
+    return my_is_valid;
+}
+
+uint64_t SerializedFom::conversions() const
+{
+    return my_conversions;
+}
+
+const NM_Additional_Fom_Module& SerializedFom::fields()
+{
+    if (!my_is_valid) {
+        convert();
+    }
+    return my_fields;
+}
+
+std::shared_ptr<const SerializedFom::Bytes> SerializedFom::encoded()
+{
+    if (!my_is_valid) {
+        convert();
+    }
+    return my_encoded;
+}
+
+void SerializedFom::copyTo(NM_Join_Federation_Execution& message)
+{
+    copyFields(fields(), message);
+}
+
+void SerializedFom::copyTo(NM_Additional_Fom_Module& message)
+{
+    copyFields(fields(), message);
+}
+
+std::unique_ptr<NM_Join_Federation_Execution> SerializedFom::makeJoinResponse()
+{
+    return std::unique_ptr<NM_Join_Federation_Execution>(new WithEncodedFom<NM_Join_Federation_Execution>(encoded()));
+}
+
+std::unique_ptr<NM_Additional_Fom_Module> SerializedFom::makeAdditionalFomModule()
+{
+    return std::unique_ptr<NM_Additional_Fom_Module>(new WithEncodedFom<NM_Additional_Fom_Module>(encoded()));
+}
+
+void SerializedFom::convert()
+{
+    my_fields = NM_Additional_Fom_Module();
+    my_root_object.convertToSerializedFOM(my_fields);
+
+    // Same encoding as the end of NM_Additional_Fom_Module::serialize
+    libhla::MessageBuffer buffer;
+    buffer.write_uint32(my_fields.getRoutingSpacesSize());
+    for (uint32_t i{0}; i < my_fields.getRoutingSpacesSize(); ++i) {
+        my_fields.getRoutingSpaces(i).serialize(buffer);
+    }
+    buffer.write_uint32(my_fields.getObjectClassesSize());
+    for (uint32_t i{0}; i < my_fields.getObjectClassesSize(); ++i) {
+        my_fields.getObjectClasses(i).serialize(buffer);
+    }
+    buffer.write_uint32(my_fields.getInteractionClassesSize());
+    for (uint32_t i{0}; i < my_fields.getInteractionClassesSize(); ++i) {
+        my_fields.getInteractionClasses(i).serialize(buffer);
+    }
+
+    auto begin = static_cast<const uint8_t*>(buffer(libhla::MessageBuffer::reservedBytes));
+    my_encoded = std::make_shared<const Bytes>(begin, begin + (buffer.size() - libhla::MessageBuffer::reservedBytes));
+
+    my_is_valid = true;
+    ++my_conversions;
+}
+
+} // namespace rtig
+} // namespace certi
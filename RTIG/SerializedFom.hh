@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_RTIG_SERIALIZED_FOM_HH
+#define CERTI_RTIG_SERIALIZED_FOM_HH
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <libCERTI/NM_Classes.hh>
+
+namespace certi {
+
+class RootObject;
+
+namespace rtig {
+
+/** The FOM of a federation, as sent to joining federates.
+ *
+ * Converting the root object walks every routing space, class, attribute and
+ * parameter of the FOM. It is done once, then both the message fields and
+ * their wire encoding are reused for every join, until invalidate() is called
+ * because modules were added to the root object.
+ *
+ * Messages built by makeJoinResponse() and makeAdditionalFomModule() do not
+ * hold a copy of the FOM: they share the encoded bytes and append them when
+ * serialized.
+ */
+class SerializedFom {
+public:
+    using Bytes = std::vector<uint8_t>;
+
+    explicit SerializedFom(RootObject& root_object);
+
+    /// Drop the cached FOM, it will be converted again on next use.
+    void invalidate();
+
+    bool isValid() const;
+
+    /// Number of conversions of the root object since creation.
+    uint64_t conversions() const;
+
+    /// Routing spaces, object classes and interaction classes, as message fields.
+    const NM_Additional_Fom_Module& fields();
+
+    /// The same fields, encoded as they are at the end of a join or additional module message.
+    std::shared_ptr<const Bytes> encoded();
+
+    /// Copy the cached fields into message.
+    void copyTo(NM_Join_Federation_Execution& message);
+    void copyTo(NM_Additional_Fom_Module& message);
+
+    std::unique_ptr<NM_Join_Federation_Execution> makeJoinResponse();
+    std::unique_ptr<NM_Additional_Fom_Module> makeAdditionalFomModule();
+
+private:
+    void convert();
+
+    RootObject& my_root_object;
+
+    bool my_is_valid{false};
+    uint64_t my_conversions{0};
+
+    NM_Additional_Fom_Module my_fields{};
+    std::shared_ptr<const Bytes> my_encoded{};
+};
+
+} // namespace rtig
+} // namespace certi
+
+#endif // CERTI_RTIG_SERIALIZED_FOM_HH
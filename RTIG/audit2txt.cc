@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <libCERTI/AuditRecord.hh>
+
+using certi::AuditRecord;
+using certi::AuditRecordFileHeader;
+
+/**
+ * rtig-audit2txt converts a binary audit file written by the RTIG
+ * (CERTI_AUDIT_FORMAT=binary) to the text format of RTIG.log.
+ *
+ * \par rtig-audit2txt RTIG.audit [RTIG.log]
+ *
+ * Output goes to stdout if no output file is given. A binary audit file
+ * contains one header per RTIG run, the legend is written for each of them.
+ */
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3) {
+        std::cerr << "usage: " << argv[0] << " <binary audit file> [text audit file]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input.is_open()) {
+        std::cerr << "Could not open " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream output_file;
+    if (argc == 3) {
+        output_file.open(argv[2], std::ios::app);
+        if (!output_file.is_open()) {
+            std::cerr << "Could not open " << argv[2] << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::ostream& output = (argc == 3) ? output_file : std::cout;
+
+    const auto expected = AuditRecordFileHeader::make();
+    AuditRecordFileHeader header;
+    AuditRecord record;
+    unsigned long count{0};
+    bool header_seen{false};
+
+    // A record starts with its date, which can never match the header magic:
+    // read 8 bytes to decide whether a new run starts or a record follows.
+    char lead[sizeof(expected.magic)];
+    while (input.read(lead, sizeof(lead))) {
+        if (std::equal(lead, lead + sizeof(lead), expected.magic)) {
+            std::copy(lead, lead + sizeof(lead), header.magic);
+            input.read(reinterpret_cast<char*>(&header) + sizeof(lead), sizeof(header) - sizeof(lead));
+            if (!input || !header.isValid()) {
+                std::cerr << "Invalid or incompatible audit header after " << count << " records" << std::endl;
+                return EXIT_FAILURE;
+            }
+            output << "date\tfed-o\tfed\ttype\tlevel\tstatus\tcomment" << std::endl;
+            header_seen = true;
+            continue;
+        }
+
+        if (!header_seen) {
+            std::cerr << argv[1] << " is not a binary audit file" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::copy(lead, lead + sizeof(lead), reinterpret_cast<char*>(&record));
+        if (!input.read(reinterpret_cast<char*>(&record) + sizeof(lead), sizeof(record) - sizeof(lead))) {
+            std::cerr << "Truncated record after " << count << " records" << std::endl;
+            return EXIT_FAILURE;
+        }
+        record.write(output);
+        ++count;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -87,6 +87,19 @@ void NewHandler() throw(MemoryExhausted)
  *      <li> 60400 or, </li>
  *      <li> the value of environment variable CERTI_TCP_PORT if it is defined</li>
  *    </ol>
+ * Sending SIGUSR1 to the RTIG writes live statistics (processing time,
+ * fan-out and bytes sent percentiles, per message type and per federation)
+ * to RTIG.stats without stopping it.
+ * Reflections of the object classes listed in CERTI_CONFLATED_CLASSES
+ * (comma separated) are conflated for subscribers too slow to read them:
+ * only the latest value of each attribute is kept, up to
+ * CERTI_CONFLATION_DEPTH values per subscriber.
+ * Messages are written to the federates by CERTI_RTIG_WRITERS threads,
+ * each federate always by the same one, so that the RTIG routes the next
+ * message while the previous ones are still being written.
+ * The RTIAs of a host may share a single link to the RTIG through a
+ * \ref certi_executable_relay, the RTIG then writes what it sends to several
+ * of them once, with the list of their channels.
  * The RTIG exchange messages with the \ref certi_executable_RTIA in order
  * to satify HLA request coming from the Federate.
  * In particular RTIG is responsible for giving to the Federate (through its RTIA)
@@ -127,6 +140,7 @@ int main(int argc, char* argv[])
     std::signal(SIGINT, SignalHandler);
 #ifndef _WIN32
     std::signal(SIGPIPE, SignalHandler);
+    std::signal(SIGUSR1, SignalHandler);
 #endif
 
     std::set_new_handler(NewHandler);
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/NetworkMessage.hh>
+
+#include "Relay.hh"
+
+namespace {
+static constexpr auto defaultRelayPort = "60401";
+static constexpr auto relayPortEnvironmentVariable = "CERTI_RELAY_PORT";
+static constexpr auto hostEnvironmentVariable = "CERTI_HOST";
+static constexpr auto tcpPortEnvironmentVariable = "CERTI_TCP_PORT";
+
+const char* fromEnvironment(const char* variable, const char* fallback)
+{
+    auto value = getenv(variable);
+    return value ? value : fallback;
+}
+}
+
+extern "C" void SignalHandler(int sig)
+{
+    certi::rtig::Relay::signalHandler(sig);
+    std::signal(sig, SignalHandler);
+}
+
+/**
+ * @defgroup certi_executable_relay rtig-relay
+ *
+ * The host-local relay gathers the links of the \ref certi_executable_RTIA
+ * of a host into a single link to the \ref certi_executable_RTIG, so that
+ * what the RTIG sends to many federates of the host crosses the network once.
+ * The command line usage of the relay is following:
+ * \par rtig-relay [port]
+ * \par
+ * The relay listens on the loopback interface, on port, or the value of
+ * CERTI_RELAY_PORT, or 60401, and connects to the RTIG on CERTI_HOST and
+ * CERTI_TCP_PORT. The RTIAs of the host use the relay with CERTI_HOST set to
+ * localhost and CERTI_TCP_PORT set to the port of the relay.
+ * @ingroup certi_executable
+ */
+int main(int argc, char* argv[])
+{
+    if (argc > 2) {
+        std::cerr << "usage: " << argv[0] << " [port]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto port = std::stoi(argc == 2 ? argv[1] : fromEnvironment(relayPortEnvironmentVariable, defaultRelayPort));
+    const std::string rtig_host = fromEnvironment(hostEnvironmentVariable, "localhost");
+    const auto rtig_port = std::stoi(fromEnvironment(tcpPortEnvironmentVariable, PORT_TCP_RTIG));
+
+    std::signal(SIGINT, SignalHandler);
+#ifndef _WIN32
+    std::signal(SIGTERM, SignalHandler);
+    // a closed RTIA link fails the write instead
+    std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+    try {
+        certi::rtig::Relay relay(port, rtig_host, rtig_port);
+        std::cout << "CERTI relay of port " << port << " to " << rtig_host << ":" << rtig_port << std::endl;
+        relay.execute();
+
+        const auto& statistics = relay.statistics();
+        std::cout << "CERTI relay exiting: " << statistics.forwarded << " messages forwarded, "
+                  << statistics.received << " received for " << statistics.delivered << " deliveries." << std::endl;
+    }
+    catch (certi::NetworkSignal&) {
+        std::cout << "CERTI relay interrupted." << std::endl;
+    }
+    catch (certi::NetworkError& e) {
+        std::cerr << "CERTI relay stopped with a Network Error: [" << e.reason() << "]." << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <libCERTI/LatencyTrace.hh>
+
+using certi::LatencyBreakdown;
+using certi::TraceFileHeader;
+using certi::TraceSpan;
+
+/**
+ * certi-trace-merge joins the trace files written by the federates, their
+ * RTIAs and the RTIG (CERTI_TRACE_DIR) and prints the latency of each hop of
+ * the traced updates, in nanoseconds.
+ *
+ * \par certi-trace-merge certi-*.trace
+ *
+ * A trace file contains one header per process run, the spans follow it.
+ */
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <trace file>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto expected = TraceFileHeader::make();
+    LatencyBreakdown breakdown;
+    unsigned long count{0};
+
+    for (int i = 1; i < argc; ++i) {
+        std::ifstream input(argv[i], std::ios::binary);
+        if (!input.is_open()) {
+            std::cerr << "Could not open " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        TraceFileHeader header;
+        TraceSpan span;
+        bool header_seen{false};
+
+        // A span starts with its trace id, random enough not to match the header
+        // magic: read 8 bytes to decide whether a new run starts or a span follows.
+        char lead[sizeof(expected.magic)];
+        while (input.read(lead, sizeof(lead))) {
+            if (std::equal(lead, lead + sizeof(lead), expected.magic)) {
+                std::copy(lead, lead + sizeof(lead), header.magic);
+                input.read(reinterpret_cast<char*>(&header) + sizeof(lead), sizeof(header) - sizeof(lead));
+                if (!input || !header.isValid()) {
+                    std::cerr << "Invalid or incompatible trace header in " << argv[i] << std::endl;
+                    return EXIT_FAILURE;
+                }
+                header_seen = true;
+                continue;
+            }
+
+            if (!header_seen) {
+                std::cerr << argv[i] << " is not a trace file" << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            std::copy(lead, lead + sizeof(lead), reinterpret_cast<char*>(&span));
+            if (!input.read(reinterpret_cast<char*>(&span) + sizeof(lead), sizeof(span) - sizeof(lead))) {
+                // the process did not exit cleanly
+                std::cerr << "Truncated span in " << argv[i] << std::endl;
+                break;
+            }
+            breakdown.add(span);
+            ++count;
+        }
+    }
+
+    std::cout << count << " spans of " << breakdown.traces() << " traced updates" << std::endl;
+    breakdown.print(std::cout);
+
+    return EXIT_SUCCESS;
+}
@@ -239,6 +239,15 @@ typedef basic_stringize<wchar_t> wstringize;
 // be an absolute path, but it may be a relative path for testing reasons.
 #define RTIG_AUDIT_FILENAME "RTIG.log"
 
+// Path name of the Audit File when the RTIG uses the binary audit format,
+// i.e. when CERTI_AUDIT_FORMAT=binary is set in its environment.
+// Use rtig-audit2txt to convert it to the text format.
+#define RTIG_AUDIT_BINARY_FILENAME "RTIG.audit"
+
+// Path name of the file the RTIG writes its message statistics to,
+// each time it receives SIGUSR1.
+#define RTIG_STATISTICS_FILENAME "RTIG.stats"
+
 // Define the lower audit level you need, from AUDIT_MIN_LEVEL(0, all)
 // to AUDIT_MAX_LEVEL(10, min audit logging).
 // Level 0 : NULL messages(time synchronization)
@@ -131,6 +131,33 @@ EventRetractionHandle updateAttributeValues(ObjectHandle, const AttributeHandleV
  */
 void updateAttributeValues(ObjectHandle object, const AttributeHandleValuePairSet& attributes, const char * tag);
 
+/**
+ * Batch Update Attribute Values (with time) service (CERTI extension).
+ * Update the attributes of several object instances at once, the RTIG routes
+ * them in one pass and subscribers get one reflection callback per object.
+ * @param[in] count      Number of object instances updated
+ * @param[in] objects    Object instance designators
+ * @param[in] attributes Set of attribute designator and value pairs of each object
+ * @param[in] time       Federation time shared by all the updates
+ * @param[in] tag        User supplied tag shared by all the updates
+ * @warning This is a non-standard extension of the HLA 1.3 API, the updates
+ *          cannot be retracted.
+ */
+void batchUpdateAttributeValues(ULong count, const ObjectHandle objects[],
+                                const AttributeHandleValuePairSet * const attributes[],
+                                const FedTime & time, const char * tag);
+
+/**
+ * Batch Update Attribute Values (without time) service (CERTI extension).
+ * @param[in] count      Number of object instances updated
+ * @param[in] objects    Object instance designators
+ * @param[in] attributes Set of attribute designator and value pairs of each object
+ * @param[in] tag        User supplied tag shared by all the updates
+ * @warning This is a non-standard extension of the HLA 1.3 API.
+ */
+void batchUpdateAttributeValues(ULong count, const ObjectHandle objects[],
+                                const AttributeHandleValuePairSet * const attributes[], const char * tag);
+
 /**
  * Send Interaction with time
  * This service (HLA 1.3) send an interaction into the federation.
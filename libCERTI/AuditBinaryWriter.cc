@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "AuditBinaryWriter.hh"
+
+#include "Exception.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+namespace {
+size_t nextPowerOfTwo(size_t value)
+{
+    size_t result{1};
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+/// How long the writer sleeps when the ring is empty
+static constexpr auto idle_period = std::chrono::milliseconds(2);
+}
+
+namespace certi {
+
+AuditBinaryWriter::AuditBinaryWriter(const std::string& file_name, const size_t capacity)
+    : my_ring(nextPowerOfTwo(capacity)), my_mask(my_ring.size() - 1), my_file(std::fopen(file_name.c_str(), "ab"))
+{
+    if (!my_file) {
+        std::cerr << "Could not open Audit file: " << file_name << std::endl;
+        throw RTIinternalError("Could not open Audit file.");
+    }
+
+    auto header = AuditRecordFileHeader::make();
+    std::fwrite(&header, sizeof(header), 1, my_file);
+    std::fflush(my_file);
+
+    my_thread = std::thread(&AuditBinaryWriter::run, this);
+}
+
+AuditBinaryWriter::~AuditBinaryWriter()
+{
+    my_running.store(false, std::memory_order_release);
+    my_thread.join();
+
+    drain();
+    std::fclose(my_file);
+}
+
+void AuditBinaryWriter::push(const AuditRecord& record)
+{
+    const auto head = my_head.load(std::memory_order_relaxed);
+
+    while (head - my_tail.load(std::memory_order_acquire) > my_mask) {
+        ++my_stall_count;
+        std::this_thread::yield();
+    }
+
+    my_ring[head & my_mask] = record;
+    my_head.store(head + 1, std::memory_order_release);
+}
+
+uint64_t AuditBinaryWriter::getStallCount() const
+{
+    return my_stall_count;
+}
+
+void AuditBinaryWriter::run()
+{
+    while (my_running.load(std::memory_order_acquire)) {
+        if (drain() == 0) {
+            std::this_thread::sleep_for(idle_period);
+        }
+    }
+}
+
+size_t AuditBinaryWriter::drain()
+{
+    auto tail = my_tail.load(std::memory_order_relaxed);
+    const auto head = my_head.load(std::memory_order_acquire);
+
+    if (tail == head) {
+        return 0;
+    }
+
+    const auto count = head - tail;
+    while (tail != head) {
+        // write contiguous chunks, the ring may wrap once
+        const auto index = tail & my_mask;
+        const auto chunk = std::min(head - tail, my_ring.size() - index);
+        std::fwrite(&my_ring[index], sizeof(AuditRecord), chunk, my_file);
+        tail += chunk;
+        my_tail.store(tail, std::memory_order_release);
+    }
+    std::fflush(my_file);
+
+    return count;
+}
+
+} // namespace certi
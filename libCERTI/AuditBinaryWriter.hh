@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_AUDIT_BINARY_WRITER_HH
+#define _CERTI_AUDIT_BINARY_WRITER_HH
+
+#include "AuditRecord.hh"
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace certi {
+
+/** Asynchronous writer of AuditRecord into a binary audit file.
+ *
+ * Records are pushed by a single producer (the RTIG thread) into a lock-free
+ * single producer / single consumer ring buffer. A background thread drains
+ * the ring and appends records to the file, so the producer never waits for
+ * disk I/O. If the ring is full, the producer yields until the writer makes
+ * room: audit records are never dropped.
+ *
+ * Use the rtig-audit2txt tool to convert a binary audit file to the text
+ * format written by AuditLine.
+ */
+class CERTI_EXPORT AuditBinaryWriter {
+public:
+    /// capacity is rounded up to the next power of two
+    AuditBinaryWriter(const std::string& file_name, const size_t capacity = 8192);
+
+    /// Drain all pending records, stop the writer thread and close the file.
+    ~AuditBinaryWriter();
+
+    AuditBinaryWriter(const AuditBinaryWriter&) = delete;
+    AuditBinaryWriter& operator=(const AuditBinaryWriter&) = delete;
+
+    /// Copy record into the ring. Must always be called from the same thread.
+    void push(const AuditRecord& record);
+
+    /// Number of times push had to wait because the ring was full.
+    uint64_t getStallCount() const;
+
+private:
+    void run();
+    size_t drain();
+
+    std::vector<AuditRecord> my_ring;
+    const size_t my_mask;
+
+    // head and tail are kept on separate cache lines, the padding avoids
+    // an over-aligned type which C++14 operator new does not support.
+    std::atomic<size_t> my_head{0}; /// next slot written by producer
+    char my_padding[64 - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> my_tail{0}; /// next slot read by writer
+
+    std::atomic<bool> my_running{true};
+    uint64_t my_stall_count{0};
+
+    FILE* my_file{nullptr};
+    std::thread my_thread;
+};
+
+} // namespace certi
+
+#endif // _CERTI_AUDIT_BINARY_WRITER_HH
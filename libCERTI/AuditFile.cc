@@ -24,6 +24,8 @@
 #include "AuditFile.hh"
 
 #include <cstdarg>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
@@ -39,21 +41,28 @@ static const auto NormalStatus = certi::AuditLine::Status(certi::Exception::Type
 
 namespace certi {
 
-AuditFile::AuditFile(const std::string& log_file_name) : my_audit_file{log_file_name, std::ios::app}
+AuditFile::AuditFile(const std::string& log_file_name, const Format format) : my_format{format}
 {
-    if (!my_audit_file.is_open()) {
-        std::cerr << "Could not open Audit file: " << log_file_name << std::endl;
-        throw RTIinternalError("Could not open Audit file.");
+    if (my_format == Format::Binary) {
+        my_binary_writer.reset(new AuditBinaryWriter(log_file_name));
+        my_current_record.clear();
+    }
+    else {
+        my_audit_file.open(log_file_name, std::ios::app);
+        if (!my_audit_file.is_open()) {
+            std::cerr << "Could not open Audit file: " << log_file_name << std::endl;
+            throw RTIinternalError("Could not open Audit file.");
+        }
+
+        // Put legend
+        my_audit_file << "date\t"
+                      << "fed-o\t"
+                      << "fed\t"
+                      << "type\t"
+                      << "level\t"
+                      << "status\t"
+                      << "comment" << std::endl;
     }
-
-    // Put legend
-    my_audit_file << "date\t"
-                  << "fed-o\t"
-                  << "fed\t"
-                  << "type\t"
-                  << "level\t"
-                  << "status\t"
-                  << "comment" << std::endl;
 
     // Put a Start delimiter in the Audit File
     putLine(StartAudit, AuditMaxLevel, NormalStatus, "");
@@ -63,13 +72,29 @@ AuditFile::~AuditFile()
 {
     endLine(NormalStatus, "");
     putLine(StopAudit, AuditMaxLevel, NormalStatus, "");
-    my_audit_file.close();
+    if (my_format == Format::Text) {
+        my_audit_file.close();
+    }
 }
 
 void AuditFile::startLine(const Handle federation_handle,
                           const FederateHandle federate_handle,
                           const AuditLine::Type type)
 {
+    if (my_format == Format::Binary) {
+        if (my_record_started) {
+            std::cerr << "Audit Error : Current line already valid !" << std::endl;
+            return;
+        }
+
+        my_current_record.clear();
+        my_current_record.federation = federation_handle;
+        my_current_record.federate = federate_handle;
+        my_current_record.type = type.get();
+        my_record_started = true;
+        return;
+    }
+
     // Check already valid opened line
     if (my_current_line.started()) {
         std::cerr << "Audit Error : Current line already valid !" << std::endl;
@@ -83,11 +108,33 @@ void AuditFile::startLine(const Handle federation_handle,
 
 void AuditFile::setLevel(const AuditLine::Level level)
 {
+    if (my_format == Format::Binary) {
+        my_current_record.level = level.get();
+        my_record_started = true;
+        return;
+    }
+
     my_current_line.setLevel(level);
 }
 
 void AuditFile::endLine(const AuditLine::Status status, const std::string& reason)
 {
+    if (my_format == Format::Binary) {
+        if (my_record_started) {
+            my_current_record.status = static_cast<uint8_t>(status.get());
+            addComment(reason.data(), reason.size());
+        }
+
+        if (my_current_record.level >= AUDIT_CURRENT_LEVEL
+            || my_current_record.status != static_cast<uint8_t>(Exception::Type::NO_EXCEPTION)) {
+            my_binary_writer->push(my_current_record);
+        }
+
+        my_current_record.clear();
+        my_record_started = false;
+        return;
+    }
+
     if (my_current_line.started()) {
         my_current_line.end(status, reason);
     }
@@ -107,43 +154,76 @@ void AuditFile::putLine(const AuditLine::Type type,
                         const std::string& reason)
 {
     if (level.get() >= AUDIT_CURRENT_LEVEL) {
+        if (my_format == Format::Binary) {
+            AuditRecord record;
+            record.clear();
+            record.type = type.get();
+            record.level = level.get();
+            record.status = static_cast<uint8_t>(status.get());
+            record.append(reason.data(), reason.size());
+            my_binary_writer->push(record);
+            return;
+        }
+
         AuditLine line(type, level, status, reason);
         line.write(my_audit_file);
     }
 }
 
+AuditFile::Format AuditFile::getFormat() const
+{
+    return my_format;
+}
+
+void AuditFile::addComment(const char* str, const size_t length)
+{
+    if (my_format == Format::Binary) {
+        my_current_record.append(str, length);
+        my_record_started = true;
+    }
+    else {
+        my_current_line.addComment(std::string(str, length));
+    }
+}
+
 AuditFile& AuditFile::operator<<(const char* s)
 {
     if (s) {
-        my_current_line.addComment(s);
+        addComment(s, std::strlen(s));
     }
     return *this;
 }
 
 AuditFile& AuditFile::operator<<(const std::string& s)
 {
-    my_current_line.addComment(s);
+    addComment(s.data(), s.size());
     return *this;
 }
 
 AuditFile& AuditFile::operator<<(const int n)
 {
-    return (*this << std::to_string(n));
+    return (*this << static_cast<long>(n));
 }
 
 AuditFile& AuditFile::operator<<(const long n)
 {
-    return (*this << std::to_string(n));
+    char buffer[24];
+    auto length = std::snprintf(buffer, sizeof(buffer), "%ld", n);
+    addComment(buffer, length);
+    return *this;
 }
 
 AuditFile& AuditFile::operator<<(const unsigned int n)
 {
-    return (*this << std::to_string(n));
+    return (*this << static_cast<unsigned long>(n));
 }
 
 AuditFile& AuditFile::operator<<(const unsigned long n)
 {
-    return (*this << std::to_string(n));
+    char buffer[24];
+    auto length = std::snprintf(buffer, sizeof(buffer), "%lu", n);
+    addComment(buffer, length);
+    return *this;
 }
 
 AuditFile& AuditFile::operator<<(const double n)
@@ -24,11 +24,14 @@
 #ifndef _CERTI_AUDIT_FILE_HH
 #define _CERTI_AUDIT_FILE_HH
 
+#include "AuditBinaryWriter.hh"
 #include "AuditLine.hh"
+#include "AuditRecord.hh"
 #include "Exception.hh"
 #include <include/certi.hh>
 
 #include <fstream>
+#include <memory>
 #include <string>
 
 namespace certi {
@@ -45,14 +48,20 @@ namespace certi {
  * adds the parameter string to the current line. Then a last call to EndLine
  * will set the line's status (or Result) and flush the line into the Audit
  * file.
+ *
+ * In Binary format, lines are stored as fixed-size AuditRecord and handed to
+ * an AuditBinaryWriter which writes them from a background thread. Comments
+ * are then limited to AuditRecord::max_comment_length characters.
  */
 class CERTI_EXPORT AuditFile {
 public:
+    enum class Format { Text, Binary };
+
     /** AuditFile constructor to write to file
      * 
      * Audit file is used to store information about actions taken by the RTIG
      */
-    AuditFile(const std::string& log_file_name); // Open LogFileName for writing.
+    AuditFile(const std::string& log_file_name, const Format format = Format::Text); // Open LogFileName for writing.
 
     /** delete an AuditFile instance.
      * 
@@ -106,9 +115,19 @@ public:
         return (*this << ss.str());
     }
 
+    Format getFormat() const;
+
 protected:
+    void addComment(const char* str, const size_t length);
+
+    Format my_format;
+
     std::ofstream my_audit_file; /// Stream pointer to output file.
     AuditLine my_current_line; /// Line currently being processed.
+
+    std::unique_ptr<AuditBinaryWriter> my_binary_writer; /// Only used in Binary format.
+    AuditRecord my_current_record; /// Record currently being processed, in Binary format.
+    bool my_record_started{false};
 };
 
 } // namespace certi
@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "AuditRecord.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+
+namespace {
+static const char AuditRecordMagic[8] = {'C', 'E', 'R', 'T', 'I', 'A', 'U', 'D'};
+}
+
+namespace certi {
+
+static_assert(sizeof(AuditRecord) == 256, "AuditRecord is expected to be exactly 256 bytes");
+
+constexpr uint32_t AuditRecord::max_comment_length;
+constexpr uint32_t AuditRecordFileHeader::current_version;
+
+void AuditRecord::clear()
+{
+    date = std::time(nullptr);
+    federation = 0;
+    federate = 0;
+    type = 0;
+    level = 0;
+    status = 0;
+    reserved = 0;
+    comment_length = 0;
+}
+
+void AuditRecord::append(const char* str, uint32_t length)
+{
+    auto copied = std::min(length, max_comment_length - comment_length);
+    std::memcpy(comment + comment_length, str, copied);
+    comment_length += copied;
+}
+
+void AuditRecord::write(std::ostream& stream) const
+{
+    stream << date << '\t' << federation << '\t' << federate << '\t' << type << '\t' << level << '\t'
+           << static_cast<unsigned int>(status) << '\t';
+    stream.write(comment, comment_length);
+    stream << std::endl;
+}
+
+AuditRecordFileHeader AuditRecordFileHeader::make()
+{
+    AuditRecordFileHeader header;
+    std::memcpy(header.magic, AuditRecordMagic, sizeof(AuditRecordMagic));
+    header.version = current_version;
+    header.record_size = sizeof(AuditRecord);
+    return header;
+}
+
+bool AuditRecordFileHeader::isValid() const
+{
+    return std::memcmp(magic, AuditRecordMagic, sizeof(AuditRecordMagic)) == 0 && version == current_version
+        && record_size == sizeof(AuditRecord);
+}
+
+} // namespace certi
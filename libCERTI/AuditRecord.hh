@@ -0,0 +1,82 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_AUDIT_RECORD_HH
+#define _CERTI_AUDIT_RECORD_HH
+
+#include <include/certi.hh>
+
+#include <cstdint>
+#include <ostream>
+
+namespace certi {
+
+/** Fixed-size audit record, as stored in a binary audit file.
+ *
+ * This is the binary counterpart of AuditLine: same fields, but with a
+ * bounded comment so that a record can be copied in a ring buffer without
+ * any allocation. Comments longer than max_comment_length are truncated.
+ *
+ * Records are stored in host byte order, the file header allows a reader to
+ * check it is looking at a compatible file.
+ */
+struct CERTI_EXPORT AuditRecord {
+    static constexpr uint32_t max_comment_length{232};
+
+    int64_t date;
+    uint32_t federation;
+    uint32_t federate;
+    uint16_t type;
+    uint16_t level;
+    uint8_t status;
+    uint8_t reserved;
+    uint16_t comment_length;
+    char comment[max_comment_length];
+
+    /// Reset all fields, and set date to now.
+    void clear();
+
+    /// Append str to comment, truncating if needed.
+    void append(const char* str, uint32_t length);
+
+    /// Same output as AuditLine::write
+    void write(std::ostream& stream) const;
+};
+
+/** Header at the beginning of every binary audit file.
+ */
+struct CERTI_EXPORT AuditRecordFileHeader {
+    static constexpr uint32_t current_version{1};
+
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+
+    static AuditRecordFileHeader make();
+
+    bool isValid() const;
+};
+
+} // namespace certi
+
+#endif // _CERTI_AUDIT_RECORD_HH
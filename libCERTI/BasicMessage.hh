@@ -47,7 +47,7 @@ public:
     /**
 	 * Indicate if the message is dated/time-stamped or not
 	 */
-    bool isDated()
+    bool isDated() const
     {
         return _isDated;
     };
@@ -68,7 +68,7 @@ public:
     /**
 	 * Indicate if the message is Tagged or not
 	 */
-    bool isTagged()
+    bool isTagged() const
     {
         return _isTagged;
     };
@@ -90,7 +90,7 @@ public:
     /**
 	 * Indicate if the message is Labelled or not
 	 */
-    bool isLabelled()
+    bool isLabelled() const
     {
         return _isLabelled;
     };
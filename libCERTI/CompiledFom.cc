@@ -0,0 +1,240 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "CompiledFom.hh"
+
+#include <algorithm>
+
+#include "Interaction.hh"
+#include "InteractionSet.hh"
+#include "ObjectClass.hh"
+#include "ObjectClassAttribute.hh"
+#include "ObjectClassSet.hh"
+#include "PrettyDebug.hh"
+#include "RootObject.hh"
+
+namespace certi {
+
+static PrettyDebug D("COMPILED_FOM", __FILE__);
+
+namespace {
+/// Superclasses of each class of classes, from the class up to the root.
+template <typename Class>
+void computeLineages(std::vector<Class>& classes)
+{
+    for (Handle handle = 0; handle < classes.size(); ++handle) {
+        auto& current = classes[handle];
+        if (!current.defined) {
+            continue;
+        }
+        for (Handle ancestor = handle; ancestor != 0 && ancestor < classes.size() && classes[ancestor].defined;
+             ancestor = classes[ancestor].superclass) {
+            if (std::find(begin(current.lineage), end(current.lineage), ancestor) != end(current.lineage)) {
+                throw RTIinternalError("Cycle in the superclasses of class " + std::to_string(handle));
+            }
+            current.lineage.push_back(ancestor);
+        }
+    }
+}
+}
+
+void HandleMask::set(const Handle handle)
+{
+    const auto word = handle / 64;
+    if (word >= my_words.size()) {
+        my_words.resize(word + 1, 0);
+    }
+    my_words[word] |= uint64_t{1} << (handle % 64);
+}
+
+bool HandleMask::test(const Handle handle) const
+{
+    const auto word = handle / 64;
+    return word < my_words.size() && (my_words[word] & (uint64_t{1} << (handle % 64))) != 0;
+}
+
+bool HandleMask::containsAll(const std::vector<Handle>& handles) const
+{
+    return std::all_of(begin(handles), end(handles), [this](const Handle handle) { return test(handle); });
+}
+
+size_t HandleMask::count() const
+{
+    size_t count{0};
+    for (auto word : my_words) {
+        for (; word != 0; word &= word - 1) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+CompiledFom::CompiledFom(const RootObject& root)
+{
+    for (auto it = root.ObjectClasses->handled_begin(); it != root.ObjectClasses->handled_end(); ++it) {
+        const auto handle = it->first;
+        if (handle >= my_object_classes.size()) {
+            my_object_classes.resize(handle + 1);
+        }
+
+        auto& compiled = my_object_classes[handle];
+        compiled.defined = true;
+        compiled.superclass = it->second->getSuperclass();
+
+        const auto& attributes = it->second->getHandleClassAttributeMap();
+        const AttributeHandle last = attributes.empty() ? 0 : attributes.rbegin()->first;
+        compiled.definitions.resize(last + 1, nullptr);
+        compiled.orders.resize(last + 1, RECEIVE);
+        compiled.transports.resize(last + 1, RELIABLE);
+        compiled.spaces.resize(last + 1, 0);
+        for (const auto& kv : attributes) {
+            const auto attribute = kv.first;
+            compiled.attributes.set(attribute);
+            compiled.definitions[attribute] = kv.second;
+            compiled.orders[attribute] = kv.second->order;
+            compiled.transports[attribute] = kv.second->transport;
+            compiled.spaces[attribute] = kv.second->getSpace();
+            if (kv.second->order == TIMESTAMP) {
+                compiled.timestamped.set(attribute);
+            }
+            if (kv.second->transport == RELIABLE) {
+                compiled.reliable.set(attribute);
+            }
+            if (kv.second->getSpace() != 0) {
+                compiled.spaced.set(attribute);
+            }
+        }
+    }
+
+    for (auto it = root.Interactions->handled_begin(); it != root.Interactions->handled_end(); ++it) {
+        const auto handle = it->first;
+        if (handle >= my_interaction_classes.size()) {
+            my_interaction_classes.resize(handle + 1);
+        }
+
+        auto& compiled = my_interaction_classes[handle];
+        compiled.defined = true;
+        compiled.superclass = it->second->getSuperclass();
+        compiled.order = it->second->order;
+        compiled.transport = it->second->transport;
+        compiled.space = it->second->getSpace();
+        const auto& parameters = it->second->getHandleParameterMap();
+        compiled.definitions.resize(parameters.empty() ? 1 : parameters.rbegin()->first + 1, nullptr);
+        for (const auto& kv : parameters) {
+            compiled.parameters.set(kv.first);
+            compiled.definitions[kv.first] = kv.second;
+        }
+    }
+
+    computeLineages(my_object_classes);
+    computeLineages(my_interaction_classes);
+
+    Debug(D, pdInit) << "Compiled " << root.ObjectClasses->size() << " object classes and "
+                     << root.Interactions->size() << " interaction classes" << std::endl;
+}
+
+size_t CompiledFom::objectClassCount() const
+{
+    return std::count_if(begin(my_object_classes), end(my_object_classes), [](const ObjectClass& object_class) {
+        return object_class.defined;
+    });
+}
+
+size_t CompiledFom::interactionClassCount() const
+{
+    return std::count_if(begin(my_interaction_classes),
+                         end(my_interaction_classes),
+                         [](const InteractionClass& interaction_class) { return interaction_class.defined; });
+}
+
+const CompiledFom::ObjectClass* CompiledFom::findObjectClass(const ObjectClassHandle handle) const
+{
+    if (handle >= my_object_classes.size() || !my_object_classes[handle].defined) {
+        return nullptr;
+    }
+    return &my_object_classes[handle];
+}
+
+const CompiledFom::InteractionClass* CompiledFom::findInteractionClass(const InteractionClassHandle handle) const
+{
+    if (handle >= my_interaction_classes.size() || !my_interaction_classes[handle].defined) {
+        return nullptr;
+    }
+    return &my_interaction_classes[handle];
+}
+
+const CompiledFom::ObjectClass& CompiledFom::getObjectClass(const ObjectClassHandle handle) const
+{
+    auto object_class = findObjectClass(handle);
+    if (!object_class) {
+        throw ObjectClassNotDefined("Object class <" + std::to_string(handle) + "> not defined");
+    }
+    return *object_class;
+}
+
+const CompiledFom::InteractionClass& CompiledFom::getInteractionClass(const InteractionClassHandle handle) const
+{
+    auto interaction_class = findInteractionClass(handle);
+    if (!interaction_class) {
+        throw InteractionClassNotDefined("Interaction class <" + std::to_string(handle) + "> not defined");
+    }
+    return *interaction_class;
+}
+
+bool CompiledFom::hasAttribute(const ObjectClassHandle object_class, const AttributeHandle attribute) const
+{
+    auto compiled = findObjectClass(object_class);
+    return compiled && compiled->attributes.test(attribute);
+}
+
+bool CompiledFom::hasParameter(const InteractionClassHandle interaction_class, const ParameterHandle parameter) const
+{
+    auto compiled = findInteractionClass(interaction_class);
+    return compiled && compiled->parameters.test(parameter);
+}
+
+bool CompiledFom::isKindOf(const ObjectClassHandle object_class, const ObjectClassHandle candidate) const
+{
+    auto compiled = findObjectClass(object_class);
+    return compiled && std::find(begin(compiled->lineage), end(compiled->lineage), candidate) != end(compiled->lineage);
+}
+
+bool CompiledFom::isTimestamped(const ObjectClassHandle object_class,
+                                const std::vector<AttributeHandle>& attributes) const
+{
+    auto compiled = findObjectClass(object_class);
+    return compiled && compiled->timestamped.containsAll(attributes);
+}
+
+SpaceHandle CompiledFom::getAttributeSpace(const ObjectClassHandle object_class, const AttributeHandle attribute) const
+{
+    const auto& compiled = getObjectClass(object_class);
+    if (!compiled.attributes.test(attribute)) {
+        throw AttributeNotDefined("Attribute <" + std::to_string(attribute) + "> unknown for object class <"
+                                  + std::to_string(object_class)
+                                  + ">");
+    }
+    return compiled.spaces[attribute];
+}
+
+} // namespace certi
@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_COMPILED_FOM_HH
+#define _CERTI_COMPILED_FOM_HH
+
+#include <include/certi.hh>
+
+#include <cstdint>
+#include <vector>
+
+#include "Handle.hh"
+
+namespace certi {
+
+class ObjectClassAttribute;
+class Parameter;
+class RootObject;
+
+/** Set of handles, one bit per handle.
+ */
+class CERTI_EXPORT HandleMask {
+public:
+    void set(const Handle handle);
+
+    bool test(const Handle handle) const;
+
+    /// True if every handle of handles is in the set.
+    bool containsAll(const std::vector<Handle>& handles) const;
+
+    size_t count() const;
+
+private:
+    std::vector<uint64_t> my_words{};
+};
+
+/** Read-only view of the classes of a FOM, indexed by handle.
+ *
+ * The object class, attribute, interaction class and parameter trees of the
+ * root object are walked once and flattened into vectors indexed by class
+ * handle, each class holding its attributes (resp. parameters) indexed by
+ * handle, the chain of its superclasses, and one mask per order, transport
+ * and routing space property. Lookups are then array accesses instead of map
+ * searches, for the paths taken on every update.
+ *
+ * A compiled FOM never changes: RootObject compiles a new one after classes
+ * or routing spaces were added, see RootObject::getCompiledFom(), and hands it
+ * to the object and interaction classes for their attribute and parameter
+ * lookups. Order and transport are those declared in the FOM.
+ */
+class CERTI_EXPORT CompiledFom {
+public:
+    struct ObjectClass {
+        bool defined{false};
+        ObjectClassHandle superclass{0};
+        /// This class, then its superclasses up to the root
+        std::vector<ObjectClassHandle> lineage{};
+
+        /// Indexed by attribute handle, nullptr if the handle is not an attribute of the class
+        std::vector<ObjectClassAttribute*> definitions{};
+
+        /// Indexed by attribute handle
+        std::vector<OrderType> orders{};
+        std::vector<TransportType> transports{};
+        std::vector<SpaceHandle> spaces{};
+
+        HandleMask attributes{};
+        HandleMask timestamped{};
+        HandleMask reliable{};
+        /// Attributes with a routing space
+        HandleMask spaced{};
+    };
+
+    struct InteractionClass {
+        bool defined{false};
+        InteractionClassHandle superclass{0};
+        /// This class, then its superclasses up to the root
+        std::vector<InteractionClassHandle> lineage{};
+
+        OrderType order{RECEIVE};
+        TransportType transport{RELIABLE};
+        SpaceHandle space{0};
+
+        /// Indexed by parameter handle, nullptr if the handle is not a parameter of the class
+        std::vector<Parameter*> definitions{};
+
+        HandleMask parameters{};
+    };
+
+    explicit CompiledFom(const RootObject& root);
+
+    size_t objectClassCount() const;
+    size_t interactionClassCount() const;
+
+    /// The class, nullptr if it is not defined.
+    const ObjectClass* findObjectClass(const ObjectClassHandle handle) const;
+    const InteractionClass* findInteractionClass(const InteractionClassHandle handle) const;
+
+    /// The class, @throw ObjectClassNotDefined if it is not defined.
+    const ObjectClass& getObjectClass(const ObjectClassHandle handle) const;
+
+    /// The class, @throw InteractionClassNotDefined if it is not defined.
+    const InteractionClass& getInteractionClass(const InteractionClassHandle handle) const;
+
+    bool hasAttribute(const ObjectClassHandle object_class, const AttributeHandle attribute) const;
+
+    bool hasParameter(const InteractionClassHandle interaction_class, const ParameterHandle parameter) const;
+
+    /// True if the class is candidate or one of its subclasses.
+    bool isKindOf(const ObjectClassHandle object_class, const ObjectClassHandle candidate) const;
+
+    /// True if all the attributes are defined in the class and timestamp ordered.
+    bool isTimestamped(const ObjectClassHandle object_class, const std::vector<AttributeHandle>& attributes) const;
+
+    /// Routing space of the attribute, @throw AttributeNotDefined if it is not defined.
+    SpaceHandle getAttributeSpace(const ObjectClassHandle object_class, const AttributeHandle attribute) const;
+
+private:
+    std::vector<ObjectClass> my_object_classes{};
+    std::vector<InteractionClass> my_interaction_classes{};
+};
+
+} // namespace certi
+
+#endif // _CERTI_COMPILED_FOM_HH
@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "FrameBuffer.hh"
+
+#include <cstring>
+#include <string>
+
+#include "NM_Classes.hh"
+
+namespace certi {
+
+void FrameBuffer::append(const void* data, const size_t size)
+{
+    // what is left is a part of one message, at most
+    if (my_begin != 0) {
+        my_bytes.erase(begin(my_bytes), begin(my_bytes) + my_begin);
+        my_begin = 0;
+    }
+    auto bytes = static_cast<const uint8_t*>(data);
+    my_bytes.insert(end(my_bytes), bytes, bytes + size);
+}
+
+bool FrameBuffer::hasMessage() const
+{
+    if (size() < libhla::MessageBuffer::reservedBytes) {
+        return false;
+    }
+    // an invalid size is taken at once, to throw
+    const auto message_size = messageSize();
+    return message_size < libhla::MessageBuffer::reservedBytes || size() >= message_size;
+}
+
+std::unique_ptr<NetworkMessage> FrameBuffer::takeMessage()
+{
+    if (!hasMessage()) {
+        return nullptr;
+    }
+
+    const auto message_size = messageSize();
+    if (message_size < libhla::MessageBuffer::reservedBytes) {
+        throw NetworkError("Received a message of " + std::to_string(message_size) + " bytes");
+    }
+    my_message.resize(message_size);
+    memcpy(my_message(0), my_bytes.data() + my_begin, message_size);
+    my_begin += message_size;
+    if (my_begin == my_bytes.size()) {
+        my_bytes.clear();
+        my_begin = 0;
+    }
+
+    my_message.assumeSizeFromReservedBytes();
+    NetworkMessage generic;
+    generic.deserialize(my_message);
+    std::unique_ptr<NetworkMessage> message(NM_Factory::create(generic.getMessageType()));
+    my_message.assumeSizeFromReservedBytes();
+    message->deserialize(my_message);
+    return message;
+}
+
+size_t FrameBuffer::size() const
+{
+    return my_bytes.size() - my_begin;
+}
+
+uint32_t FrameBuffer::messageSize() const
+{
+    // as MessageBuffer::assumeSizeFromReservedBytes reads it
+    const auto header = my_bytes.data() + my_begin;
+    const bool big_endian = header[0] == 0x01;
+    uint32_t message_size{0};
+    for (int i = 0; i < 4; ++i) {
+        const auto byte = big_endian ? header[1 + i] : header[4 - i];
+        message_size = (message_size << 8) | byte;
+    }
+    return message_size;
+}
+
+} // namespace certi
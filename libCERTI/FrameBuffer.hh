@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_FRAME_BUFFER_HH
+#define _CERTI_FRAME_BUFFER_HH
+
+#include <include/certi.hh>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <libHLA/MessageBuffer.hh>
+
+#include "NetworkMessage.hh"
+
+namespace certi {
+
+/** Bytes received on a TCP link, cut into the network messages they carry.
+ *
+ * A message starts with the reserved bytes of its MessageBuffer: the
+ * endianness, then the size of the message, reserved bytes included. Bytes
+ * are appended as they are received, whatever the message boundaries, and
+ * complete messages are taken in order. Used where the bytes are not read
+ * from the socket by the receiver of the message, see IoUring.
+ */
+class CERTI_EXPORT FrameBuffer {
+public:
+    void append(const void* data, const size_t size);
+
+    /// true if the first message is complete, or its reserved bytes are invalid.
+    bool hasMessage() const;
+
+    /** Remove and return the first message, nullptr if it is not complete.
+     *
+     * @throw NetworkError if its reserved bytes are invalid
+     */
+    std::unique_ptr<NetworkMessage> takeMessage();
+
+    /// Number of bytes not taken yet.
+    size_t size() const;
+
+private:
+    /// Size of the first message, read from its reserved bytes, which must be complete.
+    uint32_t messageSize() const;
+
+    std::vector<uint8_t> my_bytes{};
+    /// Offset of the first byte not taken yet
+    size_t my_begin{0};
+    libhla::MessageBuffer my_message{};
+};
+
+} // namespace certi
+
+#endif // _CERTI_FRAME_BUFFER_HH
@@ -101,6 +101,7 @@ ParameterHandle Interaction::addParameter(Parameter* parameter, bool is_inherite
     }
 
     _handleParameterMap[parameterHandle] = parameter;
+    setCompiledFom(nullptr);
 
     Debug(D, pdRegister) << "Interaction " << handle << "[" << name << "] has a new parameter " << parameterHandle
                          << "[" << parameter->getName() << "]" << std::flush;
@@ -245,9 +246,16 @@ void Interaction::display() const
 //! Returns the parameter by its handle
 Parameter* Interaction::getParameterByHandle(ParameterHandle the_handle) const
 {
-    HandleParameterMap::const_iterator i = _handleParameterMap.find(the_handle);
-    if (i != _handleParameterMap.end()) {
-        return i->second;
+    if (my_compiled_class) {
+        if (the_handle < my_compiled_class->definitions.size() && my_compiled_class->definitions[the_handle]) {
+            return my_compiled_class->definitions[the_handle];
+        }
+    }
+    else {
+        HandleParameterMap::const_iterator i = _handleParameterMap.find(the_handle);
+        if (i != _handleParameterMap.end()) {
+            return i->second;
+        }
     }
 
     throw InteractionParameterNotDefined("for handle " + std::to_string(the_handle));
@@ -278,9 +286,19 @@ const std::string& Interaction::getParameterName(ParameterHandle the_handle) con
 //! Return true if the interaction contains the given parameter
 bool Interaction::hasParameter(ParameterHandle parameterHandle) const
 {
+    if (my_compiled_class) {
+        return my_compiled_class->parameters.test(parameterHandle);
+    }
     return _handleParameterMap.find(parameterHandle) != _handleParameterMap.end();
 }
 
+// ----------------------------------------------------------------------------
+void Interaction::setCompiledFom(std::shared_ptr<const CompiledFom> fom)
+{
+    my_compiled_class = fom ? fom->findInteractionClass(handle) : nullptr;
+    my_compiled_fom = my_compiled_class ? std::move(fom) : nullptr;
+}
+
 // ----------------------------------------------------------------------------
 //! Return true if federate is publishing the attribute.
 bool Interaction::isPublishing(FederateHandle fed)
@@ -31,6 +31,7 @@ class InteractionSet;
 } // namespace certi
 
 // CERTI headers
+#include "CompiledFom.hh"
 #include "MessageEvent.hh"
 #include "Parameter.hh"
 #include "SecurityServer.hh"
@@ -38,6 +39,7 @@ class InteractionSet;
 #include <include/certi.hh>
 
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -164,6 +166,12 @@ public:
      */
     bool hasParameter(ParameterHandle parameterHandle) const;
 
+    /**
+     * Look the parameters up in the compiled fom, nullptr to search the parameter map again.
+     * fom must be compiled from the current parameters of this class, adding one drops it.
+     */
+    void setCompiledFom(std::shared_ptr<const CompiledFom> fom);
+
     void killFederate(FederateHandle theFederate) noexcept;
 
     // -- Transport and Ordering --
@@ -246,6 +254,10 @@ private:
     //! List of this Interaction Class' Parameters.
     HandleParameterMap _handleParameterMap;
 
+    //! The parameters are looked up in my_compiled_class if not null, see setCompiledFom()
+    std::shared_ptr<const CompiledFom> my_compiled_fom{};
+    const CompiledFom::InteractionClass* my_compiled_class{nullptr};
+
     typedef std::set<FederateHandle> PublishersList;
     PublishersList publishers;
 };
@@ -0,0 +1,353 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "IoUring.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include "Exception.hh"
+#include "PrettyDebug.hh"
+
+namespace certi {
+
+static PrettyDebug D("IO_URING", __FILE__);
+
+namespace {
+/// Data of the cancellations, whose completions are not handed to reap
+constexpr uint64_t cancelData{~uint64_t{0}};
+
+/// Multishot receive into a buffer ring came with Linux 6.0
+bool kernelProvidesMultishotReceive()
+{
+    utsname name;
+    int major{0};
+    if (uname(&name) != 0 || sscanf(name.release, "%d.", &major) != 1) {
+        return false;
+    }
+    return major >= 6;
+}
+
+int setup(const unsigned entries, io_uring_params& params)
+{
+    return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+}
+}
+
+std::unique_ptr<IoUring> IoUring::create(const unsigned entries, const unsigned buffers, const unsigned buffer_size)
+{
+    if (!kernelProvidesMultishotReceive()) {
+        Debug(D, pdInit) << "Kernel older than 6.0, no multishot receive" << std::endl;
+        return nullptr;
+    }
+    if (buffers == 0 || buffers > 32768 || (buffers & (buffers - 1)) != 0) {
+        throw RTIinternalError("io_uring buffer count must be a power of 2, not " + std::to_string(buffers));
+    }
+
+    std::unique_ptr<IoUring> ring(new IoUring);
+
+    // multishot requests complete many times, room is left for their completions
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = 4 * entries;
+    ring->my_fd = setup(entries, params);
+    if (ring->my_fd < 0) {
+        Debug(D, pdInit) << "io_uring_setup failed: " << strerror(errno) << std::endl;
+        return nullptr;
+    }
+
+    const unsigned needed = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    if ((params.features & needed) != needed) {
+        Debug(D, pdInit) << "io_uring lacks features, has " << params.features << std::endl;
+        return nullptr;
+    }
+
+    // one mapping for both rings
+    ring->my_rings_size = std::max(params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                                   params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe));
+    ring->my_rings = mmap(nullptr,
+                          ring->my_rings_size,
+                          PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE,
+                          ring->my_fd,
+                          IORING_OFF_SQ_RING);
+    if (ring->my_rings == MAP_FAILED) {
+        ring->my_rings = nullptr;
+        return nullptr;
+    }
+    ring->my_requests_size = params.sq_entries * sizeof(io_uring_sqe);
+    auto requests = mmap(nullptr,
+                         ring->my_requests_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE,
+                         ring->my_fd,
+                         IORING_OFF_SQES);
+    if (requests == MAP_FAILED) {
+        return nullptr;
+    }
+    ring->my_requests = static_cast<io_uring_sqe*>(requests);
+
+    auto base = static_cast<char*>(ring->my_rings);
+    ring->my_sq_head = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+    ring->my_sq_tail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+    ring->my_sq_mask = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+    ring->my_sq_entries = params.sq_entries;
+    ring->my_sq_queued_tail = *ring->my_sq_tail;
+    // requests always sit at the index of their slot
+    auto array = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+    for (unsigned i = 0; i < params.sq_entries; ++i) {
+        array[i] = i;
+    }
+
+    ring->my_cq_head = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+    ring->my_cq_tail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+    ring->my_cq_mask = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+    ring->my_completions = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+
+    // the buffer ring, in buffer group 0
+    ring->my_buffer_ring_size = buffers * sizeof(io_uring_buf);
+    auto buffer_ring
+        = mmap(nullptr, ring->my_buffer_ring_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer_ring == MAP_FAILED) {
+        return nullptr;
+    }
+    ring->my_buffer_ring = static_cast<io_uring_buf_ring*>(buffer_ring);
+
+    io_uring_buf_reg registration;
+    memset(&registration, 0, sizeof(registration));
+    registration.ring_addr = reinterpret_cast<uint64_t>(buffer_ring);
+    registration.ring_entries = buffers;
+    registration.bgid = 0;
+    if (syscall(__NR_io_uring_register, ring->my_fd, IORING_REGISTER_PBUF_RING, &registration, 1) < 0) {
+        Debug(D, pdInit) << "Could not register the buffer ring: " << strerror(errno) << std::endl;
+        return nullptr;
+    }
+
+    ring->my_buffer_count = buffers;
+    ring->my_buffer_size = buffer_size;
+    ring->my_buffers.resize(static_cast<size_t>(buffers) * buffer_size);
+    for (unsigned buffer = 0; buffer < buffers; ++buffer) {
+        ring->giveBack(static_cast<uint16_t>(buffer));
+    }
+
+    Debug(D, pdInit) << "io_uring of " << params.sq_entries << " entries and " << buffers << " buffers of "
+                     << buffer_size << " bytes" << std::endl;
+    return ring;
+}
+
+IoUring::~IoUring()
+{
+    if (my_buffer_ring) {
+        munmap(my_buffer_ring, my_buffer_ring_size);
+    }
+    if (my_requests) {
+        munmap(my_requests, my_requests_size);
+    }
+    if (my_rings) {
+        munmap(my_rings, my_rings_size);
+    }
+    if (my_fd >= 0) {
+        ::close(my_fd);
+    }
+}
+
+int IoUring::descriptor() const
+{
+    return my_fd;
+}
+
+void IoUring::accept(const int socket, const uint64_t data)
+{
+    auto request = nextRequest();
+    request->opcode = IORING_OP_ACCEPT;
+    request->fd = socket;
+    request->ioprio = IORING_ACCEPT_MULTISHOT;
+    request->user_data = data;
+}
+
+void IoUring::receive(const int socket, const uint64_t data)
+{
+    auto request = nextRequest();
+    request->opcode = IORING_OP_RECV;
+    request->fd = socket;
+    request->ioprio = IORING_RECV_MULTISHOT;
+    request->flags = IOSQE_BUFFER_SELECT;
+    request->buf_group = 0;
+    request->user_data = data;
+}
+
+void IoUring::send(const int socket, const void* bytes, const size_t size, const uint64_t data)
+{
+    auto request = nextRequest();
+    request->opcode = IORING_OP_SEND;
+    request->fd = socket;
+    request->addr = reinterpret_cast<uint64_t>(bytes);
+    request->len = static_cast<uint32_t>(size);
+    request->msg_flags = MSG_NOSIGNAL;
+    request->user_data = data;
+}
+
+void IoUring::cancel(const uint64_t data)
+{
+    auto request = nextRequest();
+    request->opcode = IORING_OP_ASYNC_CANCEL;
+    request->fd = -1;
+    request->addr = data;
+    request->cancel_flags = IORING_ASYNC_CANCEL_ALL;
+    request->user_data = cancelData;
+}
+
+void IoUring::submit()
+{
+    if (my_sq_queued_tail == __atomic_load_n(my_sq_head, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+    if (enter(0, 0, nullptr, 0) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        throw NetworkError("io_uring submission failed <" + std::string(strerror(errno)) + ">");
+    }
+}
+
+bool IoUring::wait(const int timeout_ms)
+{
+    __kernel_timespec timeout;
+    io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if (timeout_ms >= 0) {
+        timeout.tv_sec = timeout_ms / 1000;
+        timeout.tv_nsec = (timeout_ms % 1000) * 1000000L;
+        arg.ts = reinterpret_cast<uint64_t>(&timeout);
+    }
+
+    if (enter(1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg)) < 0) {
+        switch (errno) {
+        case EINTR:
+            return false;
+        case ETIME:
+        case EAGAIN:
+        case EBUSY:
+            // timed out, or completions must be reaped first
+            return true;
+        default:
+            throw NetworkError("io_uring wait failed <" + std::string(strerror(errno)) + ">");
+        }
+    }
+    return true;
+}
+
+size_t IoUring::reap(const std::function<void(const Completion&)>& handler)
+{
+    size_t count{0};
+    auto head = *my_cq_head;
+    const auto tail = __atomic_load_n(my_cq_tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+        const auto& cqe = my_completions[head & my_cq_mask];
+        const bool has_buffer = (cqe.flags & IORING_CQE_F_BUFFER) != 0;
+        const auto buffer = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+        const Completion completion{cqe.user_data,
+                                    cqe.res,
+                                    (cqe.flags & IORING_CQE_F_MORE) != 0,
+                                    has_buffer ? &my_buffers[static_cast<size_t>(buffer) * my_buffer_size] : nullptr};
+        ++head;
+        ++count;
+        ++my_statistics.completions;
+
+        // the completion is consumed and its buffer given back, whatever handler does
+        try {
+            if (completion.data != cancelData) {
+                handler(completion);
+            }
+        }
+        catch (...) {
+            if (has_buffer) {
+                giveBack(buffer);
+            }
+            __atomic_store_n(my_cq_head, head, __ATOMIC_RELEASE);
+            throw;
+        }
+        if (has_buffer) {
+            giveBack(buffer);
+        }
+        __atomic_store_n(my_cq_head, head, __ATOMIC_RELEASE);
+    }
+    return count;
+}
+
+const IoUring::Statistics& IoUring::statistics() const
+{
+    return my_statistics;
+}
+
+io_uring_sqe* IoUring::nextRequest()
+{
+    if (my_sq_queued_tail - __atomic_load_n(my_sq_head, __ATOMIC_ACQUIRE) >= my_sq_entries) {
+        submit();
+        if (my_sq_queued_tail - __atomic_load_n(my_sq_head, __ATOMIC_ACQUIRE) >= my_sq_entries) {
+            throw NetworkError("io_uring submission ring is full");
+        }
+    }
+    auto request = &my_requests[my_sq_queued_tail & my_sq_mask];
+    memset(request, 0, sizeof(*request));
+    ++my_sq_queued_tail;
+    return request;
+}
+
+int IoUring::enter(const unsigned min_complete, const unsigned flags, const void* arg, const size_t arg_size)
+{
+    // including those an interrupted call did not submit
+    const auto to_submit = my_sq_queued_tail - __atomic_load_n(my_sq_head, __ATOMIC_ACQUIRE);
+    __atomic_store_n(my_sq_tail, my_sq_queued_tail, __ATOMIC_RELEASE);
+
+    ++my_statistics.enters;
+    const auto submitted = static_cast<int>(
+        syscall(__NR_io_uring_enter, my_fd, to_submit, min_complete, flags, arg, arg_size));
+    if (submitted > 0) {
+        my_statistics.submitted += submitted;
+    }
+    return submitted;
+}
+
+void IoUring::giveBack(const uint16_t buffer)
+{
+    // the ring is an array of buffers, its tail overlaid on the first one: in C++ the bufs
+    // member of io_uring_buf_ring follows an empty struct and is not at offset 0
+    auto& entry = reinterpret_cast<io_uring_buf*>(my_buffer_ring)[my_buffer_tail & (my_buffer_count - 1)];
+    entry.addr = reinterpret_cast<uint64_t>(&my_buffers[static_cast<size_t>(buffer) * my_buffer_size]);
+    entry.len = my_buffer_size;
+    entry.bid = buffer;
+    ++my_buffer_tail;
+    __atomic_store_n(&my_buffer_ring->tail, my_buffer_tail, __ATOMIC_RELEASE);
+}
+
+} // namespace certi
@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_IO_URING_HH
+#define _CERTI_IO_URING_HH
+
+#include <include/certi.hh>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+namespace certi {
+
+/** A Linux io_uring, used through its system calls.
+ *
+ * Requests are queued in the submission ring and handed to the kernel in one
+ * system call, by submit or wait. Accept and receive are multishot: the kernel
+ * keeps them going, one completion per connection or per received chunk, the
+ * received bytes being written to the buffers of a ring registered with the
+ * kernel. Completions are read from the completion ring without any system
+ * call, by reap.
+ *
+ * Only built with CERTI_USE_IO_URING, see create for what the kernel must
+ * provide at run time.
+ */
+class CERTI_EXPORT IoUring {
+public:
+    /// A completed request, or one step of a multishot request.
+    struct Completion {
+        /// Given with the request
+        uint64_t data;
+        /// What the system call would return, -errno on error
+        int32_t result;
+        /// The multishot request goes on, it must be queued again otherwise
+        bool more;
+        /// Received bytes, result of them, nullptr if no buffer was used
+        const uint8_t* bytes;
+    };
+
+    struct Statistics {
+        /// io_uring_enter system calls
+        uint64_t enters{0};
+        uint64_t submitted{0};
+        uint64_t completions{0};
+    };
+
+    /** A ring of entries requests, receiving into buffers of buffer_size bytes.
+     *
+     * @param buffers a power of 2
+     * @return nullptr if the kernel does not provide io_uring with multishot
+     * receive into a buffer ring (Linux 6.0), or forbids it
+     */
+    static std::unique_ptr<IoUring>
+    create(const unsigned entries = 256, const unsigned buffers = 256, const unsigned buffer_size = 16384);
+
+    ~IoUring();
+
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    /// Readable when completions wait to be reaped.
+    int descriptor() const;
+
+    /// Queue a multishot accept of the connections to the listening socket.
+    void accept(const int socket, const uint64_t data);
+
+    /// Queue a multishot receive of what socket receives, into the buffer ring.
+    void receive(const int socket, const uint64_t data);
+
+    /// Queue a send of size bytes, which must not change until it completes.
+    void send(const int socket, const void* bytes, const size_t size, const uint64_t data);
+
+    /// Queue the cancellation of the requests queued with data. It has no completion of its own.
+    void cancel(const uint64_t data);
+
+    /// Submit the queued requests, without waiting.
+    void submit();
+
+    /** Submit the queued requests and wait for a completion, timeout_ms at
+     * most, forever if negative.
+     *
+     * @return false if a signal interrupted the wait
+     */
+    bool wait(const int timeout_ms);
+
+    /** Hand each waiting completion to handler, then give its buffer back to
+     * the buffer ring.
+     *
+     * handler may queue requests.
+     * @return the number of completions
+     */
+    size_t reap(const std::function<void(const Completion&)>& handler);
+
+    const Statistics& statistics() const;
+
+private:
+    IoUring() = default;
+
+    /// Next free request, once the full submission ring is submitted if need be.
+    io_uring_sqe* nextRequest();
+
+    /// Make the queued requests visible to the kernel, and enter it.
+    int enter(const unsigned min_complete, const unsigned flags, const void* arg, const size_t arg_size);
+
+    void giveBack(const uint16_t buffer);
+
+    int my_fd{-1};
+
+    void* my_rings{nullptr};
+    size_t my_rings_size{0};
+    io_uring_sqe* my_requests{nullptr};
+    size_t my_requests_size{0};
+
+    unsigned* my_sq_head{nullptr};
+    unsigned* my_sq_tail{nullptr};
+    unsigned my_sq_mask{0};
+    unsigned my_sq_entries{0};
+    /// Tail of the queued requests, published by enter
+    unsigned my_sq_queued_tail{0};
+
+    unsigned* my_cq_head{nullptr};
+    unsigned* my_cq_tail{nullptr};
+    unsigned my_cq_mask{0};
+    io_uring_cqe* my_completions{nullptr};
+
+    io_uring_buf_ring* my_buffer_ring{nullptr};
+    size_t my_buffer_ring_size{0};
+    unsigned my_buffer_count{0};
+    unsigned my_buffer_size{0};
+    uint16_t my_buffer_tail{0};
+    std::vector<uint8_t> my_buffers{};
+
+    Statistics my_statistics{};
+};
+
+} // namespace certi
+
+#endif // _CERTI_IO_URING_HH
@@ -0,0 +1,324 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "LatencyTrace.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "NM_Classes.hh"
+#include "PrettyDebug.hh"
+
+namespace {
+static constexpr auto directoryEnvironmentVariable = "CERTI_TRACE_DIR";
+static constexpr auto rateEnvironmentVariable = "CERTI_TRACE_RATE";
+static constexpr uint32_t defaultRate{100};
+/// spans held before they are written
+static constexpr size_t pendingSpans{1024};
+
+static const char TraceFileMagic[8] = {'C', 'E', 'R', 'T', 'I', 'T', 'R', 'C'};
+
+std::string directoryFromEnvironment()
+{
+    auto directory = getenv(directoryEnvironmentVariable);
+    return directory ? directory : "";
+}
+
+uint32_t rateFromEnvironment()
+{
+    auto rate = getenv(rateEnvironmentVariable);
+    if (rate && *rate) {
+        return static_cast<uint32_t>(std::stoul(rate));
+    }
+    return defaultRate;
+}
+
+/// certi-<pid>.trace
+std::string fileName()
+{
+#ifdef _WIN32
+    const int pid = _getpid();
+#else
+    const int pid = static_cast<int>(getpid());
+#endif
+    return "certi-" + std::to_string(pid) + ".trace";
+}
+}
+
+namespace certi {
+
+static PrettyDebug D("LATENCY_TRACE", __FILE__);
+
+static_assert(sizeof(TraceSpan) == 24, "TraceSpan is expected to be exactly 24 bytes");
+
+constexpr uint32_t TraceFileHeader::current_version;
+
+const char* TraceSpan::hopName(const Hop hop)
+{
+    switch (hop) {
+    case Hop::LIBRTI_SEND:
+        return "libRTI send";
+    case Hop::RTIA_SEND:
+        return "RTIA send";
+    case Hop::RTIG_RECEIVE:
+        return "RTIG receive";
+    case Hop::RTIG_SEND:
+        return "RTIG send";
+    case Hop::RTIA_RECEIVE:
+        return "RTIA receive";
+    case Hop::RTIA_ENQUEUE_TSO:
+        return "TSO enqueue";
+    case Hop::RTIA_ENQUEUE_FIFO:
+        return "FIFO enqueue";
+    case Hop::LIBRTI_DELIVER:
+        return "callback";
+    default:
+        return "unknown";
+    }
+}
+
+TraceFileHeader TraceFileHeader::make()
+{
+    TraceFileHeader header;
+    std::memcpy(header.magic, TraceFileMagic, sizeof(TraceFileMagic));
+    header.version = current_version;
+    header.span_size = sizeof(TraceSpan);
+    return header;
+}
+
+bool TraceFileHeader::isValid() const
+{
+    return std::memcmp(magic, TraceFileMagic, sizeof(TraceFileMagic)) == 0 && version == current_version
+        && span_size == sizeof(TraceSpan);
+}
+
+LatencyTrace& LatencyTrace::instance()
+{
+    static LatencyTrace the_trace{directoryFromEnvironment(), fileName(), rateFromEnvironment()};
+    return the_trace;
+}
+
+uint64_t LatencyTrace::traceOf(const NetworkMessage& message)
+{
+    switch (message.getMessageType()) {
+    case NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES: {
+        auto& update = static_cast<const NM_Update_Attribute_Values&>(message);
+        return update.hasTraceId() ? update.getTraceId() : 0;
+    }
+    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
+        auto& reflection = static_cast<const NM_Reflect_Attribute_Values&>(message);
+        return reflection.hasTraceId() ? reflection.getTraceId() : 0;
+    }
+    default:
+        return 0;
+    }
+}
+
+LatencyTrace::LatencyTrace(const std::string& directory, const std::string& name, const uint32_t rate)
+    : my_rate(rate), my_clock(libhla::clock::Clock::getBestClock())
+{
+    if (directory.empty() || rate == 0) {
+        return;
+    }
+
+    const auto path = directory + "/" + name;
+    my_file = std::fopen(path.c_str(), "ab");
+    if (!my_file) {
+        Debug(D, pdError) << "Cannot open trace file " << path << ", not tracing" << std::endl;
+        return;
+    }
+    const auto header = TraceFileHeader::make();
+    std::fwrite(&header, sizeof(header), 1, my_file);
+
+    std::random_device random;
+    my_origin = static_cast<uint64_t>(random()) << 32;
+    my_spans.reserve(pendingSpans);
+    Debug(D, pdInit) << "Tracing one update in " << rate << " to " << path << std::endl;
+}
+
+LatencyTrace::~LatencyTrace()
+{
+    if (my_file) {
+        flush();
+        std::fclose(my_file);
+    }
+}
+
+bool LatencyTrace::isEnabled() const
+{
+    return my_file != nullptr;
+}
+
+uint64_t LatencyTrace::sample()
+{
+    if (!my_file) {
+        return 0;
+    }
+    const auto update = my_updates++;
+    if (update % my_rate != 0) {
+        return 0;
+    }
+    // never 0, which stands for untraced
+    return my_origin | (((update / my_rate) & 0xffffffff) + 1);
+}
+
+void LatencyTrace::stamp(const uint64_t trace, const TraceSpan::Hop hop, const uint32_t federate)
+{
+    if (trace == 0 || !my_file) {
+        return;
+    }
+
+    TraceSpan span;
+    span.trace = trace;
+    span.date = static_cast<uint64_t>(my_clock->tick2NanoSecond(my_clock->getCurrentTicksValue()));
+    span.federate = federate;
+    span.hop = hop;
+    std::fill(std::begin(span.reserved), std::end(span.reserved), 0);
+
+    std::lock_guard<std::mutex> lock(my_mutex);
+    my_spans.push_back(span);
+    if (my_spans.size() >= pendingSpans) {
+        write();
+    }
+}
+
+void LatencyTrace::flush()
+{
+    if (!my_file) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(my_mutex);
+    write();
+    std::fflush(my_file);
+}
+
+void LatencyTrace::write()
+{
+    std::fwrite(my_spans.data(), sizeof(TraceSpan), my_spans.size(), my_file);
+    my_spans.clear();
+}
+
+void LatencyBreakdown::add(const TraceSpan& span)
+{
+    my_spans[span.trace].push_back(span);
+}
+
+std::map<LatencyBreakdown::Segment, LogLinearHistogram> LatencyBreakdown::segments() const
+{
+    std::map<Segment, LogLinearHistogram> segments;
+
+    auto record = [&segments](const TraceSpan& from, const TraceSpan& to) {
+        segments[{from.hop, to.hop}].record(to.date > from.date ? to.date - from.date : 0);
+    };
+
+    for (const auto& kv : my_spans) {
+        // the earliest span of each hop up to the RTIG send, then the hops of each receiver
+        std::map<TraceSpan::Hop, TraceSpan> sender;
+        std::map<uint32_t, std::map<TraceSpan::Hop, TraceSpan>> receivers;
+        for (const auto& span : kv.second) {
+            auto& hops = span.hop <= TraceSpan::Hop::RTIG_SEND ? sender : receivers[span.federate];
+            auto it = hops.find(span.hop);
+            if (it == end(hops) || span.date < it->second.date) {
+                hops[span.hop] = span;
+            }
+        }
+
+        const TraceSpan* previous{nullptr};
+        for (const auto& hop : sender) {
+            if (previous) {
+                record(*previous, hop.second);
+            }
+            previous = &hop.second;
+        }
+        const auto last_sent = previous;
+
+        for (const auto& receiver : receivers) {
+            previous = last_sent;
+            for (const auto& hop : receiver.second) {
+                if (previous) {
+                    record(*previous, hop.second);
+                }
+                previous = &hop.second;
+            }
+        }
+    }
+
+    return segments;
+}
+
+LogLinearHistogram LatencyBreakdown::endToEnd() const
+{
+    LogLinearHistogram histogram;
+
+    for (const auto& kv : my_spans) {
+        const auto sent = std::find_if(begin(kv.second), end(kv.second), [](const TraceSpan& span) {
+            return span.hop == TraceSpan::Hop::LIBRTI_SEND;
+        });
+        if (sent == end(kv.second)) {
+            continue;
+        }
+        for (const auto& span : kv.second) {
+            if (span.hop == TraceSpan::Hop::LIBRTI_DELIVER) {
+                histogram.record(span.date > sent->date ? span.date - sent->date : 0);
+            }
+        }
+    }
+
+    return histogram;
+}
+
+size_t LatencyBreakdown::traces() const
+{
+    return my_spans.size();
+}
+
+void LatencyBreakdown::print(std::ostream& stream) const
+{
+    stream << "from\tto\tcount\tmin\tp50\tp90\tp99\tp999\tmax\tmean\n";
+
+    for (const auto& kv : segments()) {
+        stream << TraceSpan::hopName(kv.first.first) << '\t' << TraceSpan::hopName(kv.first.second) << '\t';
+        kv.second.print(stream);
+        stream << '\n';
+    }
+
+    const auto total = endToEnd();
+    if (total.count() != 0) {
+        stream << TraceSpan::hopName(TraceSpan::Hop::LIBRTI_SEND) << '\t'
+               << TraceSpan::hopName(TraceSpan::Hop::LIBRTI_DELIVER) << "\t";
+        total.print(stream);
+        stream << '\n';
+    }
+
+    stream.flush();
+}
+
+} // namespace certi
@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_LATENCY_TRACE_HH
+#define _CERTI_LATENCY_TRACE_HH
+
+#include <include/certi.hh>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <libHLA/Clock.hh>
+
+#include "LogLinearHistogram.hh"
+
+namespace certi {
+
+class NetworkMessage;
+
+/** Fixed-size span, as stored in a trace file: when a traced update went
+ * through a hop.
+ *
+ * Spans are stored in host byte order, the file header allows a reader to
+ * check it is looking at a compatible file.
+ */
+struct CERTI_EXPORT TraceSpan {
+    enum class Hop : uint8_t {
+        LIBRTI_SEND = 1,
+        RTIA_SEND,
+        RTIG_RECEIVE,
+        RTIG_SEND,
+        RTIA_RECEIVE,
+        RTIA_ENQUEUE_TSO,
+        RTIA_ENQUEUE_FIFO,
+        LIBRTI_DELIVER,
+        LAST
+    };
+
+    uint64_t trace;
+    /// nanoseconds of the best clock of the host
+    uint64_t date;
+    /// federate whose RTIA or libRTI took the span, 0 in the RTIG
+    uint32_t federate;
+    Hop hop;
+    uint8_t reserved[3];
+
+    static const char* hopName(const Hop hop);
+};
+
+/** Header at the beginning of every trace file.
+ */
+struct CERTI_EXPORT TraceFileHeader {
+    static constexpr uint32_t current_version{1};
+
+    char magic[8];
+    uint32_t version;
+    uint32_t span_size;
+
+    static TraceFileHeader make();
+
+    bool isValid() const;
+};
+
+/** Latency spans of sampled attribute updates.
+ *
+ * The libRTI of the sending federate draws a trace id for one update in
+ * CERTI_TRACE_RATE, and the id travels with the update and the reflections it
+ * becomes. Every process the update goes through appends a TraceSpan per hop
+ * to its own trace file, certi-<pid>.trace in CERTI_TRACE_DIR, and
+ * certi-trace-merge joins the files on the trace id into a per hop latency
+ * breakdown. Nothing is traced unless CERTI_TRACE_DIR is set.
+ *
+ * Spans are dated with the best clock of the host: the hops of processes
+ * running on different hosts only make sense if their clocks are synchronized.
+ */
+class CERTI_EXPORT LatencyTrace {
+public:
+    /// Tracer configured from CERTI_TRACE_DIR and CERTI_TRACE_RATE, shared by the whole process.
+    static LatencyTrace& instance();
+
+    /// Trace id of message if it is a traced update or reflection, 0 otherwise.
+    static uint64_t traceOf(const NetworkMessage& message);
+
+    /** Write spans to file name in directory, sample one update in rate.
+     *
+     * An empty directory or a rate of 0 disables tracing.
+     */
+    LatencyTrace(const std::string& directory, const std::string& name, const uint32_t rate);
+
+    ~LatencyTrace();
+
+    bool isEnabled() const;
+
+    /// Trace id for the next update, 0 if it is not sampled.
+    uint64_t sample();
+
+    /// Record that trace went through hop now, nothing if trace is 0.
+    void stamp(const uint64_t trace, const TraceSpan::Hop hop, const uint32_t federate = 0);
+
+    /// Write the spans held so far.
+    void flush();
+
+private:
+    void write();
+
+    std::FILE* my_file{nullptr};
+    uint32_t my_rate;
+    std::unique_ptr<libhla::clock::Clock> my_clock;
+
+    /// drawn once, the upper half of every trace id of the process
+    uint64_t my_origin{0};
+    std::atomic<uint64_t> my_updates{0};
+
+    /// the writers of the RTIG stamp concurrently
+    std::mutex my_mutex{};
+    std::vector<TraceSpan> my_spans{};
+};
+
+/** Per hop latencies of the spans of several trace files.
+ *
+ * For each trace, the hops up to the RTIG send are taken once, then those of
+ * each receiving federate follow, and the time between two consecutive hops
+ * is recorded in the histogram of the segment they delimit. Missing hops are
+ * skipped, so that a reflection sent peer to peer shows a segment from the
+ * RTIA of the sender straight to the RTIA of the receiver. Negative times,
+ * from unsynchronized clocks, are recorded as 0.
+ */
+class CERTI_EXPORT LatencyBreakdown {
+public:
+    using Segment = std::pair<TraceSpan::Hop, TraceSpan::Hop>;
+
+    void add(const TraceSpan& span);
+
+    /// Nanoseconds spent between the hops of each segment, in hop order.
+    std::map<Segment, LogLinearHistogram> segments() const;
+
+    /// Nanoseconds from the send of an update to the delivery of each of its reflections.
+    LogLinearHistogram endToEnd() const;
+
+    /// Number of traces with at least one span.
+    size_t traces() const;
+
+    void print(std::ostream& stream) const;
+
+private:
+    std::map<uint64_t, std::vector<TraceSpan>> my_spans{};
+};
+
+} // namespace certi
+
+#endif // _CERTI_LATENCY_TRACE_HH
@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "LogLinearHistogram.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+unsigned int highestBit(const uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    unsigned int bit{0};
+    for (auto v = value; v >>= 1;) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+}
+
+namespace certi {
+
+constexpr unsigned int LogLinearHistogram::sub_bucket_bits;
+constexpr unsigned int LogLinearHistogram::sub_bucket_count;
+constexpr unsigned int LogLinearHistogram::bucket_count;
+
+unsigned int LogLinearHistogram::bucketIndex(const uint64_t value)
+{
+    if (value < sub_bucket_count) {
+        return static_cast<unsigned int>(value);
+    }
+
+    const auto exponent = highestBit(value);
+    const auto sub_bucket = static_cast<unsigned int>(value >> (exponent - sub_bucket_bits)) & (sub_bucket_count - 1);
+
+    return (exponent - sub_bucket_bits + 1) * sub_bucket_count + sub_bucket;
+}
+
+uint64_t LogLinearHistogram::bucketUpperBound(const unsigned int index)
+{
+    if (index < sub_bucket_count) {
+        return index;
+    }
+
+    const auto exponent = index / sub_bucket_count + sub_bucket_bits - 1;
+    const auto sub_bucket = index % sub_bucket_count;
+    const auto width = uint64_t{1} << (exponent - sub_bucket_bits);
+
+    return (uint64_t{1} << exponent) + (sub_bucket + 1) * width - 1;
+}
+
+void LogLinearHistogram::record(const uint64_t value)
+{
+    ++my_buckets[bucketIndex(value)];
+    ++my_count;
+    my_sum += value;
+    my_min = std::min(my_min, value);
+    my_max = std::max(my_max, value);
+}
+
+void LogLinearHistogram::reset()
+{
+    *this = LogLinearHistogram();
+}
+
+void LogLinearHistogram::merge(const LogLinearHistogram& other)
+{
+    for (unsigned int i{0}; i < bucket_count; ++i) {
+        my_buckets[i] += other.my_buckets[i];
+    }
+    my_count += other.my_count;
+    my_sum += other.my_sum;
+    my_min = std::min(my_min, other.my_min);
+    my_max = std::max(my_max, other.my_max);
+}
+
+uint64_t LogLinearHistogram::count() const
+{
+    return my_count;
+}
+
+uint64_t LogLinearHistogram::min() const
+{
+    return my_count ? my_min : 0;
+}
+
+uint64_t LogLinearHistogram::max() const
+{
+    return my_max;
+}
+
+uint64_t LogLinearHistogram::sum() const
+{
+    return my_sum;
+}
+
+double LogLinearHistogram::mean() const
+{
+    return my_count ? static_cast<double>(my_sum) / my_count : 0.0;
+}
+
+uint64_t LogLinearHistogram::percentile(const double q) const
+{
+    if (my_count == 0) {
+        return 0;
+    }
+
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * my_count)));
+
+    uint64_t seen{0};
+    for (unsigned int index{0}; index < bucket_count; ++index) {
+        seen += my_buckets[index];
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(index), my_max);
+        }
+    }
+    return my_max;
+}
+
+void LogLinearHistogram::print(std::ostream& stream) const
+{
+    stream << count() << '\t' << min() << '\t' << percentile(0.5) << '\t' << percentile(0.9) << '\t'
+           << percentile(0.99) << '\t' << percentile(0.999) << '\t' << max() << '\t' << static_cast<uint64_t>(mean());
+}
+
+} // namespace certi
@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_LOG_LINEAR_HISTOGRAM_HH
+#define _CERTI_LOG_LINEAR_HISTOGRAM_HH
+
+#include <include/certi.hh>
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+
+namespace certi {
+
+/** Constant memory histogram of unsigned 64 bits values.
+ *
+ * Each power of two range is split in sub_bucket_count linear buckets, so
+ * that any recorded value is known with a relative error below
+ * 1 / sub_bucket_count, whatever its magnitude. Values below
+ * sub_bucket_count are recorded exactly.
+ *
+ * record() is a few arithmetic operations and never allocates, which makes
+ * the histogram usable on the hot path of the RTIG.
+ */
+class CERTI_EXPORT LogLinearHistogram {
+public:
+    static constexpr unsigned int sub_bucket_bits{4};
+    static constexpr unsigned int sub_bucket_count{1u << sub_bucket_bits};
+    static constexpr unsigned int bucket_count{(64 - sub_bucket_bits + 1) * sub_bucket_count};
+
+    void record(const uint64_t value);
+
+    void reset();
+
+    /// Add all values recorded in other, as if they had been recorded here.
+    void merge(const LogLinearHistogram& other);
+
+    uint64_t count() const;
+    uint64_t min() const;
+    uint64_t max() const;
+    uint64_t sum() const;
+    double mean() const;
+
+    /** Value below which a fraction q of the recorded values are.
+     *
+     * The returned value is the upper bound of the bucket holding the q-th
+     * value, clamped to max(). Returns 0 if nothing was recorded.
+     */
+    uint64_t percentile(const double q) const;
+
+    /// Print count, min, p50, p90, p99, p999, max and mean, tab separated.
+    void print(std::ostream& stream) const;
+
+    static unsigned int bucketIndex(const uint64_t value);
+    static uint64_t bucketUpperBound(const unsigned int index);
+
+private:
+    std::array<uint64_t, bucket_count> my_buckets{};
+    uint64_t my_count{0};
+    uint64_t my_min{UINT64_MAX};
+    uint64_t my_max{0};
+    uint64_t my_sum{0};
+};
+
+} // namespace certi
+
+#endif // _CERTI_LOG_LINEAR_HISTOGRAM_HH
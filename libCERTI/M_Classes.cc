@@ -1724,6 +1724,10 @@ void M_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     if (_hasEventRetraction) {
         eventRetraction.serialize(msgBuffer);
     }
+    msgBuffer.write_bool(_hasTraceId);
+    if (_hasTraceId) {
+        msgBuffer.write_uint64(traceId);
+    }
 }
 
 void M_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -1749,6 +1753,10 @@ void M_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
+    _hasTraceId = msgBuffer.read_bool();
+    if (_hasTraceId) {
+        traceId = msgBuffer.read_uint64();
+    }
 }
 
 const ObjectClassHandle& M_Update_Attribute_Values::getObjectClass() const
@@ -1857,6 +1865,22 @@ bool M_Update_Attribute_Values::hasEventRetraction() const
     return _hasEventRetraction;
 }
 
+const uint64_t& M_Update_Attribute_Values::getTraceId() const
+{
+    return traceId;
+}
+
+void M_Update_Attribute_Values::setTraceId(const uint64_t& newTraceId)
+{
+    _hasTraceId = true;
+    traceId = newTraceId;
+}
+
+bool M_Update_Attribute_Values::hasTraceId() const
+{
+    return _hasTraceId;
+}
+
 std::ostream& operator<<(std::ostream& os, const M_Update_Attribute_Values& msg)
 {
     os << "[M_Update_Attribute_Values - Begin]" << std::endl;
@@ -1878,11 +1902,249 @@ std::ostream& operator<<(std::ostream& os, const M_Update_Attribute_Values& msg)
     }
     os << std::endl;
     os << "  (opt) eventRetraction =" << msg.eventRetraction << std::endl;
+    os << "  (opt) traceId =" << msg.traceId << std::endl;
     
     os << "[M_Update_Attribute_Values - End]" << std::endl;
     return os;
 }
 
+M_Batch_Update_Attribute_Values::M_Batch_Update_Attribute_Values()
+{
+    this->messageName = "M_Batch_Update_Attribute_Values";
+    this->type = Message::BATCH_UPDATE_ATTRIBUTE_VALUES;
+}
+
+void M_Batch_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t objectsSize = objects.size();
+    msgBuffer.write_uint32(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        msgBuffer.write_uint32(objects[i]);
+    }
+    uint32_t attributeCountsSize = attributeCounts.size();
+    msgBuffer.write_uint32(attributeCountsSize);
+    for (uint32_t i = 0; i < attributeCountsSize; ++i) {
+        msgBuffer.write_uint32(attributeCounts[i]);
+    }
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    uint32_t valuesSize = values.size();
+    msgBuffer.write_uint32(valuesSize);
+    for (uint32_t i = 0; i < valuesSize; ++i) {
+        //serialize native whose representation is 'repeated' byte 
+        msgBuffer.write_uint32(values[i].size());
+        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+    }
+}
+
+void M_Batch_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t objectsSize = msgBuffer.read_uint32();
+    objects.resize(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        objects[i] = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t attributeCountsSize = msgBuffer.read_uint32();
+    attributeCounts.resize(attributeCountsSize);
+    for (uint32_t i = 0; i < attributeCountsSize; ++i) {
+        attributeCounts[i] = msgBuffer.read_uint32();
+    }
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t valuesSize = msgBuffer.read_uint32();
+    values.resize(valuesSize);
+    for (uint32_t i = 0; i < valuesSize; ++i) {
+        //deserialize native whose representation is 'repeated' byte 
+        values[i].resize(msgBuffer.read_uint32());
+        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+    }
+}
+
+uint32_t M_Batch_Update_Attribute_Values::getObjectsSize() const
+{
+    return objects.size();
+}
+
+void M_Batch_Update_Attribute_Values::setObjectsSize(uint32_t num)
+{
+    objects.resize(num);
+}
+
+const std::vector<ObjectHandle>& M_Batch_Update_Attribute_Values::getObjects() const
+{
+    return objects;
+}
+
+const ObjectHandle& M_Batch_Update_Attribute_Values::getObjects(uint32_t rank) const
+{
+    return objects[rank];
+}
+
+ObjectHandle& M_Batch_Update_Attribute_Values::getObjects(uint32_t rank)
+{
+    return objects[rank];
+}
+
+void M_Batch_Update_Attribute_Values::setObjects(const ObjectHandle& newObjects, uint32_t rank)
+{
+    objects[rank] = newObjects;
+}
+
+void M_Batch_Update_Attribute_Values::removeObjects(uint32_t rank)
+{
+    objects.erase(objects.begin() + rank);
+}
+
+uint32_t M_Batch_Update_Attribute_Values::getAttributeCountsSize() const
+{
+    return attributeCounts.size();
+}
+
+void M_Batch_Update_Attribute_Values::setAttributeCountsSize(uint32_t num)
+{
+    attributeCounts.resize(num);
+}
+
+const std::vector<uint32_t>& M_Batch_Update_Attribute_Values::getAttributeCounts() const
+{
+    return attributeCounts;
+}
+
+const uint32_t& M_Batch_Update_Attribute_Values::getAttributeCounts(uint32_t rank) const
+{
+    return attributeCounts[rank];
+}
+
+uint32_t& M_Batch_Update_Attribute_Values::getAttributeCounts(uint32_t rank)
+{
+    return attributeCounts[rank];
+}
+
+void M_Batch_Update_Attribute_Values::setAttributeCounts(const uint32_t& newAttributeCounts, uint32_t rank)
+{
+    attributeCounts[rank] = newAttributeCounts;
+}
+
+void M_Batch_Update_Attribute_Values::removeAttributeCounts(uint32_t rank)
+{
+    attributeCounts.erase(attributeCounts.begin() + rank);
+}
+
+uint32_t M_Batch_Update_Attribute_Values::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void M_Batch_Update_Attribute_Values::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& M_Batch_Update_Attribute_Values::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& M_Batch_Update_Attribute_Values::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& M_Batch_Update_Attribute_Values::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void M_Batch_Update_Attribute_Values::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void M_Batch_Update_Attribute_Values::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+uint32_t M_Batch_Update_Attribute_Values::getValuesSize() const
+{
+    return values.size();
+}
+
+void M_Batch_Update_Attribute_Values::setValuesSize(uint32_t num)
+{
+    values.resize(num);
+}
+
+const std::vector<AttributeValue_t>& M_Batch_Update_Attribute_Values::getValues() const
+{
+    return values;
+}
+
+const AttributeValue_t& M_Batch_Update_Attribute_Values::getValues(uint32_t rank) const
+{
+    return values[rank];
+}
+
+AttributeValue_t& M_Batch_Update_Attribute_Values::getValues(uint32_t rank)
+{
+    return values[rank];
+}
+
+void M_Batch_Update_Attribute_Values::setValues(const AttributeValue_t& newValues, uint32_t rank)
+{
+    values[rank] = newValues;
+}
+
+void M_Batch_Update_Attribute_Values::removeValues(uint32_t rank)
+{
+    values.erase(values.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const M_Batch_Update_Attribute_Values& msg)
+{
+    os << "[M_Batch_Update_Attribute_Values - Begin]" << std::endl;
+    
+    os << static_cast<const M_Batch_Update_Attribute_Values::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objects [] =" << std::endl;
+    for (const auto& element : msg.objects) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  attributeCounts [] =" << std::endl;
+    for (const auto& element : msg.attributeCounts) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  values [] =" << std::endl;
+    for (const auto& element : msg.values) {
+        os << "// TODO field <values> of type <AttributeValue_t>";
+        (void) element;
+    }
+    os << std::endl;
+    
+    os << "[M_Batch_Update_Attribute_Values - End]" << std::endl;
+    return os;
+}
+
 M_Discover_Object_Instance::M_Discover_Object_Instance()
 {
     this->messageName = "M_Discover_Object_Instance";
@@ -2008,6 +2270,10 @@ void M_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
     if (_hasEventRetraction) {
         eventRetraction.serialize(msgBuffer);
     }
+    msgBuffer.write_bool(_hasTraceId);
+    if (_hasTraceId) {
+        msgBuffer.write_uint64(traceId);
+    }
 }
 
 void M_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2033,6 +2299,10 @@ void M_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
     if (_hasEventRetraction) {
         eventRetraction.deserialize(msgBuffer);
     }
+    _hasTraceId = msgBuffer.read_bool();
+    if (_hasTraceId) {
+        traceId = msgBuffer.read_uint64();
+    }
 }
 
 const ObjectClassHandle& M_Reflect_Attribute_Values::getObjectClass() const
@@ -2141,6 +2411,22 @@ bool M_Reflect_Attribute_Values::hasEventRetraction() const
     return _hasEventRetraction;
 }
 
+const uint64_t& M_Reflect_Attribute_Values::getTraceId() const
+{
+    return traceId;
+}
+
+void M_Reflect_Attribute_Values::setTraceId(const uint64_t& newTraceId)
+{
+    _hasTraceId = true;
+    traceId = newTraceId;
+}
+
+bool M_Reflect_Attribute_Values::hasTraceId() const
+{
+    return _hasTraceId;
+}
+
 std::ostream& operator<<(std::ostream& os, const M_Reflect_Attribute_Values& msg)
 {
     os << "[M_Reflect_Attribute_Values - Begin]" << std::endl;
@@ -2162,6 +2448,7 @@ std::ostream& operator<<(std::ostream& os, const M_Reflect_Attribute_Values& msg
     }
     os << std::endl;
     os << "  (opt) eventRetraction =" << msg.eventRetraction << std::endl;
+    os << "  (opt) traceId =" << msg.traceId << std::endl;
     
     os << "[M_Reflect_Attribute_Values - End]" << std::endl;
     return os;
@@ -5690,6 +5977,45 @@ M_Request_Retraction::M_Request_Retraction()
     this->type = Message::REQUEST_RETRACTION;
 }
 
+void M_Request_Retraction::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    eventRetraction.serialize(msgBuffer);
+}
+
+void M_Request_Retraction::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    eventRetraction.deserialize(msgBuffer);
+}
+
+const EventRetraction& M_Request_Retraction::getEventRetraction() const
+{
+    return eventRetraction;
+}
+
+void M_Request_Retraction::setEventRetraction(const EventRetraction& newEventRetraction)
+{
+    eventRetraction = newEventRetraction;
+}
+
+std::ostream& operator<<(std::ostream& os, const M_Request_Retraction& msg)
+{
+    os << "[M_Request_Retraction - Begin]" << std::endl;
+    
+    os << static_cast<const M_Request_Retraction::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  eventRetraction = " << msg.eventRetraction << std::endl;
+    
+    os << "[M_Request_Retraction - End]" << std::endl;
+    return os;
+}
+
 M_Time_Advance_Request::M_Time_Advance_Request()
 {
     this->messageName = "M_Time_Advance_Request";
@@ -5882,6 +6208,8 @@ void M_Ddm_Modify_Region::serialize(libhla::MessageBuffer& msgBuffer)
         //don't know how to serialize native field <extentSet> of type <Extent>
         //probably no 'representation' given
     }
+    // The extents actually set by the federate are the BasicMessage ones
+    serializeExtent(msgBuffer);
 }
 
 void M_Ddm_Modify_Region::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -5897,6 +6225,7 @@ void M_Ddm_Modify_Region::deserialize(libhla::MessageBuffer& msgBuffer)
         //don't know how to deserialize native field <extentSet> of type <Extent>
         //probably no 'representation' given
     }
+    deserializeExtent(msgBuffer);
 }
 
 const RegionHandle& M_Ddm_Modify_Region::getRegion() const
@@ -8702,6 +9031,9 @@ Message* M_Factory::create(M_Type type) throw (NetworkError ,NetworkSignal) {
         case Message::Type::RESERVE_OBJECT_INSTANCE_NAME_FAILED:
             msg = new M_Reserve_Object_Instance_Name_Failed();
             break;
+        case Message::Type::BATCH_UPDATE_ATTRIBUTE_VALUES:
+            msg = new M_Batch_Update_Attribute_Values();
+            break;
         case Message::Type::LAST:
             throw NetworkError("LAST message type should not be used!!");
             break;
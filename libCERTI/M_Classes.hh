@@ -890,6 +890,10 @@ public:
     void setEventRetraction(const EventRetraction& newEventRetraction);
     bool hasEventRetraction() const;
     
+    const uint64_t& getTraceId() const;
+    void setTraceId(const uint64_t& newTraceId);
+    bool hasTraceId() const;
+    
     using Super = Message;
     friend std::ostream& operator<<(std::ostream& os, const M_Update_Attribute_Values& msg);
 
@@ -900,11 +904,67 @@ protected:
     std::vector<AttributeValue_t> values;
     EventRetraction eventRetraction;
     bool _hasEventRetraction {false};
+    uint64_t traceId;
+    bool _hasTraceId {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const M_Update_Attribute_Values& msg);
 
 
+class CERTI_EXPORT M_Batch_Update_Attribute_Values : public Message {
+public:
+    M_Batch_Update_Attribute_Values();
+    virtual ~M_Batch_Update_Attribute_Values() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    uint32_t getObjectsSize() const;
+    void setObjectsSize(uint32_t num);
+    const std::vector<ObjectHandle>& getObjects() const;
+    const ObjectHandle& getObjects(uint32_t rank) const;
+    ObjectHandle& getObjects(uint32_t rank);
+    void setObjects(const ObjectHandle& newObjects, uint32_t rank);
+    void removeObjects(uint32_t rank);
+    
+    uint32_t getAttributeCountsSize() const;
+    void setAttributeCountsSize(uint32_t num);
+    const std::vector<uint32_t>& getAttributeCounts() const;
+    const uint32_t& getAttributeCounts(uint32_t rank) const;
+    uint32_t& getAttributeCounts(uint32_t rank);
+    void setAttributeCounts(const uint32_t& newAttributeCounts, uint32_t rank);
+    void removeAttributeCounts(uint32_t rank);
+    
+    uint32_t getAttributesSize() const;
+    void setAttributesSize(uint32_t num);
+    const std::vector<AttributeHandle>& getAttributes() const;
+    const AttributeHandle& getAttributes(uint32_t rank) const;
+    AttributeHandle& getAttributes(uint32_t rank);
+    void setAttributes(const AttributeHandle& newAttributes, uint32_t rank);
+    void removeAttributes(uint32_t rank);
+    
+    uint32_t getValuesSize() const;
+    void setValuesSize(uint32_t num);
+    const std::vector<AttributeValue_t>& getValues() const;
+    const AttributeValue_t& getValues(uint32_t rank) const;
+    AttributeValue_t& getValues(uint32_t rank);
+    void setValues(const AttributeValue_t& newValues, uint32_t rank);
+    void removeValues(uint32_t rank);
+    
+    using Super = Message;
+    friend std::ostream& operator<<(std::ostream& os, const M_Batch_Update_Attribute_Values& msg);
+
+protected:
+    std::vector<ObjectHandle> objects;
+    std::vector<uint32_t> attributeCounts;
+    std::vector<AttributeHandle> attributes;
+    std::vector<AttributeValue_t> values;
+};
+
+std::ostream& operator<<(std::ostream& os, const M_Batch_Update_Attribute_Values& msg);
+
+
 class CERTI_EXPORT M_Discover_Object_Instance : public Message {
 public:
     M_Discover_Object_Instance();
@@ -976,6 +1036,10 @@ public:
     void setEventRetraction(const EventRetraction& newEventRetraction);
     bool hasEventRetraction() const;
     
+    const uint64_t& getTraceId() const;
+    void setTraceId(const uint64_t& newTraceId);
+    bool hasTraceId() const;
+    
     using Super = Message;
     friend std::ostream& operator<<(std::ostream& os, const M_Reflect_Attribute_Values& msg);
 
@@ -986,6 +1050,8 @@ protected:
     std::vector<AttributeValue_t> values;
     EventRetraction eventRetraction;
     bool _hasEventRetraction {false};
+    uint64_t traceId;
+    bool _hasTraceId {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const M_Reflect_Attribute_Values& msg);
@@ -2257,8 +2323,22 @@ public:
     M_Request_Retraction();
     virtual ~M_Request_Retraction() = default;
     
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const EventRetraction& getEventRetraction() const;
+    void setEventRetraction(const EventRetraction& newEventRetraction);
+    
+    using Super = Message;
+    friend std::ostream& operator<<(std::ostream& os, const M_Request_Retraction& msg);
+
+protected:
+    EventRetraction eventRetraction;
 };
 
+std::ostream& operator<<(std::ostream& os, const M_Request_Retraction& msg);
+
 // HLA 1.3 - §8.8
 class CERTI_EXPORT M_Time_Advance_Request : public Message {
 public:
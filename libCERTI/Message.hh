@@ -208,6 +208,8 @@ public:
         CREATE_FEDERATION_EXECUTION_V4, // CERTI V4 C++
         JOIN_FEDERATION_EXECUTION_V4, // CERTI V4 C++
 
+        BATCH_UPDATE_ATTRIBUTE_VALUES, // CERTI extension
+
         LAST // should be the "last" (not used)
     };
     
@@ -91,6 +91,12 @@ public:
         return my_message.get();
     }
 
+    /// Hand the message over, the event is left without one.
+    inline std::unique_ptr<NM> releaseMessage()
+    {
+        return std::move(my_message);
+    }
+
 private:
     std::vector<Socket*> my_sockets;
     std::unique_ptr<NM> my_message;
@@ -769,6 +769,8 @@ void NM_Join_Federation_Execution::serialize(libhla::MessageBuffer& msgBuffer)
     }
     msgBuffer.write_uint8(rtiVersion);
     msgBuffer.write_string(federateType);
+    msgBuffer.write_bool(compression);
+    msgBuffer.write_uint32(peerPort);
     uint32_t additionalFomModulesSize = additionalFomModules.size();
     msgBuffer.write_uint32(additionalFomModulesSize);
     for (uint32_t i = 0; i < additionalFomModulesSize; ++i) {
@@ -807,6 +809,8 @@ void NM_Join_Federation_Execution::deserialize(libhla::MessageBuffer& msgBuffer)
     }
     rtiVersion = static_cast<RtiVersion>(msgBuffer.read_uint8());
     msgBuffer.read_string(federateType);
+    compression = msgBuffer.read_bool();
+    peerPort = msgBuffer.read_uint32();
     uint32_t additionalFomModulesSize = msgBuffer.read_uint32();
     additionalFomModules.resize(additionalFomModulesSize);
     for (uint32_t i = 0; i < additionalFomModulesSize; ++i) {
@@ -915,6 +919,26 @@ void NM_Join_Federation_Execution::setFederateType(const std::string& newFederat
     federateType = newFederateType;
 }
 
+const bool& NM_Join_Federation_Execution::getCompression() const
+{
+    return compression;
+}
+
+void NM_Join_Federation_Execution::setCompression(const bool& newCompression)
+{
+    compression = newCompression;
+}
+
+const uint32_t& NM_Join_Federation_Execution::getPeerPort() const
+{
+    return peerPort;
+}
+
+void NM_Join_Federation_Execution::setPeerPort(const uint32_t& newPeerPort)
+{
+    peerPort = newPeerPort;
+}
+
 uint32_t NM_Join_Federation_Execution::getAdditionalFomModulesSize() const
 {
     return additionalFomModules.size();
@@ -1070,6 +1094,8 @@ std::ostream& operator<<(std::ostream& os, const NM_Join_Federation_Execution& m
     os << "  (opt) federateName =" << msg.federateName << std::endl;
     os << "  rtiVersion = " << msg.rtiVersion << std::endl;
     os << "  federateType = " << msg.federateType << std::endl;
+    os << "  compression = " << msg.compression << std::endl;
+    os << "  peerPort = " << msg.peerPort << std::endl;
     os << "  additionalFomModules [] =" << std::endl;
     for (const auto& element : msg.additionalFomModules) {
         os << element;
@@ -2292,6 +2318,283 @@ std::ostream& operator<<(std::ostream& os, const NM_Discover_Object& msg)
     return os;
 }
 
+NM_Discover_Objects::NM_Discover_Objects()
+{
+    this->messageName = "NM_Discover_Objects";
+    this->type = NetworkMessage::Type::DISCOVER_OBJECTS;
+}
+
+void NM_Discover_Objects::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t objectClassesSize = objectClasses.size();
+    msgBuffer.write_uint32(objectClassesSize);
+    for (uint32_t i = 0; i < objectClassesSize; ++i) {
+        msgBuffer.write_uint32(objectClasses[i]);
+    }
+    uint32_t objectsSize = objects.size();
+    msgBuffer.write_uint32(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        msgBuffer.write_uint32(objects[i]);
+    }
+    uint32_t objectNamesSize = objectNames.size();
+    msgBuffer.write_uint32(objectNamesSize);
+    for (uint32_t i = 0; i < objectNamesSize; ++i) {
+        msgBuffer.write_string(objectNames[i]);
+    }
+}
+
+void NM_Discover_Objects::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t objectClassesSize = msgBuffer.read_uint32();
+    objectClasses.resize(objectClassesSize);
+    for (uint32_t i = 0; i < objectClassesSize; ++i) {
+        objectClasses[i] = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t objectsSize = msgBuffer.read_uint32();
+    objects.resize(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        objects[i] = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t objectNamesSize = msgBuffer.read_uint32();
+    objectNames.resize(objectNamesSize);
+    for (uint32_t i = 0; i < objectNamesSize; ++i) {
+        msgBuffer.read_string(objectNames[i]);
+    }
+}
+
+uint32_t NM_Discover_Objects::getObjectClassesSize() const
+{
+    return objectClasses.size();
+}
+
+void NM_Discover_Objects::setObjectClassesSize(uint32_t num)
+{
+    objectClasses.resize(num);
+}
+
+const std::vector<ObjectClassHandle>& NM_Discover_Objects::getObjectClasses() const
+{
+    return objectClasses;
+}
+
+const ObjectClassHandle& NM_Discover_Objects::getObjectClasses(uint32_t rank) const
+{
+    return objectClasses[rank];
+}
+
+ObjectClassHandle& NM_Discover_Objects::getObjectClasses(uint32_t rank)
+{
+    return objectClasses[rank];
+}
+
+void NM_Discover_Objects::setObjectClasses(const ObjectClassHandle& newObjectClasses, uint32_t rank)
+{
+    objectClasses[rank] = newObjectClasses;
+}
+
+void NM_Discover_Objects::removeObjectClasses(uint32_t rank)
+{
+    objectClasses.erase(objectClasses.begin() + rank);
+}
+
+uint32_t NM_Discover_Objects::getObjectsSize() const
+{
+    return objects.size();
+}
+
+void NM_Discover_Objects::setObjectsSize(uint32_t num)
+{
+    objects.resize(num);
+}
+
+const std::vector<ObjectHandle>& NM_Discover_Objects::getObjects() const
+{
+    return objects;
+}
+
+const ObjectHandle& NM_Discover_Objects::getObjects(uint32_t rank) const
+{
+    return objects[rank];
+}
+
+ObjectHandle& NM_Discover_Objects::getObjects(uint32_t rank)
+{
+    return objects[rank];
+}
+
+void NM_Discover_Objects::setObjects(const ObjectHandle& newObjects, uint32_t rank)
+{
+    objects[rank] = newObjects;
+}
+
+void NM_Discover_Objects::removeObjects(uint32_t rank)
+{
+    objects.erase(objects.begin() + rank);
+}
+
+uint32_t NM_Discover_Objects::getObjectNamesSize() const
+{
+    return objectNames.size();
+}
+
+void NM_Discover_Objects::setObjectNamesSize(uint32_t num)
+{
+    objectNames.resize(num);
+}
+
+const std::vector<std::string>& NM_Discover_Objects::getObjectNames() const
+{
+    return objectNames;
+}
+
+const std::string& NM_Discover_Objects::getObjectNames(uint32_t rank) const
+{
+    return objectNames[rank];
+}
+
+std::string& NM_Discover_Objects::getObjectNames(uint32_t rank)
+{
+    return objectNames[rank];
+}
+
+void NM_Discover_Objects::setObjectNames(const std::string& newObjectNames, uint32_t rank)
+{
+    objectNames[rank] = newObjectNames;
+}
+
+void NM_Discover_Objects::removeObjectNames(uint32_t rank)
+{
+    objectNames.erase(objectNames.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Discover_Objects& msg)
+{
+    os << "[NM_Discover_Objects - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Discover_Objects::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objectClasses [] =" << std::endl;
+    for (const auto& element : msg.objectClasses) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  objects [] =" << std::endl;
+    for (const auto& element : msg.objects) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  objectNames [] =" << std::endl;
+    for (const auto& element : msg.objectNames) {
+        os << element;
+    }
+    os << std::endl;
+    
+    os << "[NM_Discover_Objects - End]" << std::endl;
+    return os;
+}
+
+NM_Lease_Object_Handles::NM_Lease_Object_Handles()
+{
+    this->messageName = "NM_Lease_Object_Handles";
+    this->type = NetworkMessage::Type::LEASE_OBJECT_HANDLES;
+}
+
+void NM_Lease_Object_Handles::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(count);
+    uint32_t objectsSize = objects.size();
+    msgBuffer.write_uint32(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        msgBuffer.write_uint32(objects[i]);
+    }
+}
+
+void NM_Lease_Object_Handles::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    count = msgBuffer.read_uint32();
+    uint32_t objectsSize = msgBuffer.read_uint32();
+    objects.resize(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        objects[i] = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    }
+}
+
+const uint32_t& NM_Lease_Object_Handles::getCount() const
+{
+    return count;
+}
+
+void NM_Lease_Object_Handles::setCount(const uint32_t& newCount)
+{
+    count = newCount;
+}
+
+uint32_t NM_Lease_Object_Handles::getObjectsSize() const
+{
+    return objects.size();
+}
+
+void NM_Lease_Object_Handles::setObjectsSize(uint32_t num)
+{
+    objects.resize(num);
+}
+
+const std::vector<ObjectHandle>& NM_Lease_Object_Handles::getObjects() const
+{
+    return objects;
+}
+
+const ObjectHandle& NM_Lease_Object_Handles::getObjects(uint32_t rank) const
+{
+    return objects[rank];
+}
+
+ObjectHandle& NM_Lease_Object_Handles::getObjects(uint32_t rank)
+{
+    return objects[rank];
+}
+
+void NM_Lease_Object_Handles::setObjects(const ObjectHandle& newObjects, uint32_t rank)
+{
+    objects[rank] = newObjects;
+}
+
+void NM_Lease_Object_Handles::removeObjects(uint32_t rank)
+{
+    objects.erase(objects.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Lease_Object_Handles& msg)
+{
+    os << "[NM_Lease_Object_Handles - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Lease_Object_Handles::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  count = " << msg.count << std::endl;
+    os << "  objects [] =" << std::endl;
+    for (const auto& element : msg.objects) {
+        os << element;
+    }
+    os << std::endl;
+    
+    os << "[NM_Lease_Object_Handles - End]" << std::endl;
+    return os;
+}
+
 NM_Update_Attribute_Values::NM_Update_Attribute_Values()
 {
     this->messageName = "NM_Update_Attribute_Values";
@@ -2316,9 +2619,24 @@ void NM_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
+    uint32_t rawSizesSize = rawSizes.size();
+    msgBuffer.write_uint32(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        msgBuffer.write_uint32(rawSizes[i]);
+    }
     msgBuffer.write_bool(_hasEvent);
     if (_hasEvent) {
-            }
+        msgBuffer.write_uint32(event);
+    }
+    msgBuffer.write_bool(_hasTraceId);
+    if (_hasTraceId) {
+        msgBuffer.write_uint64(traceId);
+    }
+    uint32_t receiversSize = receivers.size();
+    msgBuffer.write_uint32(receiversSize);
+    for (uint32_t i = 0; i < receiversSize; ++i) {
+        msgBuffer.write_uint32(receivers[i]);
+    }
 }
 
 void NM_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2339,9 +2657,24 @@ void NM_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
         values[i].resize(msgBuffer.read_uint32());
         msgBuffer.read_bytes(&(values[i][0]),values[i].size());
     }
+    uint32_t rawSizesSize = msgBuffer.read_uint32();
+    rawSizes.resize(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        rawSizes[i] = msgBuffer.read_uint32();
+    }
     _hasEvent = msgBuffer.read_bool();
     if (_hasEvent) {
-            }
+        event = static_cast<EventRetractionHandle>(msgBuffer.read_uint32());
+    }
+    _hasTraceId = msgBuffer.read_bool();
+    if (_hasTraceId) {
+        traceId = msgBuffer.read_uint64();
+    }
+    uint32_t receiversSize = msgBuffer.read_uint32();
+    receivers.resize(receiversSize);
+    for (uint32_t i = 0; i < receiversSize; ++i) {
+        receivers[i] = static_cast<FederateHandle>(msgBuffer.read_uint32());
+    }
 }
 
 const ObjectHandle& NM_Update_Attribute_Values::getObject() const
@@ -2424,6 +2757,41 @@ void NM_Update_Attribute_Values::removeValues(uint32_t rank)
     values.erase(values.begin() + rank);
 }
 
+uint32_t NM_Update_Attribute_Values::getRawSizesSize() const
+{
+    return rawSizes.size();
+}
+
+void NM_Update_Attribute_Values::setRawSizesSize(uint32_t num)
+{
+    rawSizes.resize(num);
+}
+
+const std::vector<uint32_t>& NM_Update_Attribute_Values::getRawSizes() const
+{
+    return rawSizes;
+}
+
+const uint32_t& NM_Update_Attribute_Values::getRawSizes(uint32_t rank) const
+{
+    return rawSizes[rank];
+}
+
+uint32_t& NM_Update_Attribute_Values::getRawSizes(uint32_t rank)
+{
+    return rawSizes[rank];
+}
+
+void NM_Update_Attribute_Values::setRawSizes(const uint32_t& newRawSizes, uint32_t rank)
+{
+    rawSizes[rank] = newRawSizes;
+}
+
+void NM_Update_Attribute_Values::removeRawSizes(uint32_t rank)
+{
+    rawSizes.erase(rawSizes.begin() + rank);
+}
+
 const EventRetractionHandle& NM_Update_Attribute_Values::getEvent() const
 {
     return event;
@@ -2440,6 +2808,57 @@ bool NM_Update_Attribute_Values::hasEvent() const
     return _hasEvent;
 }
 
+const uint64_t& NM_Update_Attribute_Values::getTraceId() const
+{
+    return traceId;
+}
+
+void NM_Update_Attribute_Values::setTraceId(const uint64_t& newTraceId)
+{
+    _hasTraceId = true;
+    traceId = newTraceId;
+}
+
+bool NM_Update_Attribute_Values::hasTraceId() const
+{
+    return _hasTraceId;
+}
+
+uint32_t NM_Update_Attribute_Values::getReceiversSize() const
+{
+    return receivers.size();
+}
+
+void NM_Update_Attribute_Values::setReceiversSize(uint32_t num)
+{
+    receivers.resize(num);
+}
+
+const std::vector<FederateHandle>& NM_Update_Attribute_Values::getReceivers() const
+{
+    return receivers;
+}
+
+const FederateHandle& NM_Update_Attribute_Values::getReceivers(uint32_t rank) const
+{
+    return receivers[rank];
+}
+
+FederateHandle& NM_Update_Attribute_Values::getReceivers(uint32_t rank)
+{
+    return receivers[rank];
+}
+
+void NM_Update_Attribute_Values::setReceivers(const FederateHandle& newReceivers, uint32_t rank)
+{
+    receivers[rank] = newReceivers;
+}
+
+void NM_Update_Attribute_Values::removeReceivers(uint32_t rank)
+{
+    receivers.erase(receivers.begin() + rank);
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg)
 {
     os << "[NM_Update_Attribute_Values - Begin]" << std::endl;
@@ -2459,7 +2878,18 @@ std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg
         (void) element;
     }
     os << std::endl;
+    os << "  rawSizes [] =" << std::endl;
+    for (const auto& element : msg.rawSizes) {
+        os << element;
+    }
+    os << std::endl;
     os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
+    os << "  (opt) traceId =" << msg.traceId << std::endl;
+    os << "  receivers [] =" << std::endl;
+    for (const auto& element : msg.receivers) {
+        os << element;
+    }
+    os << std::endl;
     
     os << "[NM_Update_Attribute_Values - End]" << std::endl;
     return os;
@@ -2489,9 +2919,19 @@ void NM_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
+    uint32_t rawSizesSize = rawSizes.size();
+    msgBuffer.write_uint32(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        msgBuffer.write_uint32(rawSizes[i]);
+    }
     msgBuffer.write_bool(_hasEvent);
     if (_hasEvent) {
-            }
+        msgBuffer.write_uint32(event);
+    }
+    msgBuffer.write_bool(_hasTraceId);
+    if (_hasTraceId) {
+        msgBuffer.write_uint64(traceId);
+    }
 }
 
 void NM_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
@@ -2512,9 +2952,19 @@ void NM_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
         values[i].resize(msgBuffer.read_uint32());
         msgBuffer.read_bytes(&(values[i][0]),values[i].size());
     }
+    uint32_t rawSizesSize = msgBuffer.read_uint32();
+    rawSizes.resize(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        rawSizes[i] = msgBuffer.read_uint32();
+    }
     _hasEvent = msgBuffer.read_bool();
     if (_hasEvent) {
-            }
+        event = static_cast<EventRetractionHandle>(msgBuffer.read_uint32());
+    }
+    _hasTraceId = msgBuffer.read_bool();
+    if (_hasTraceId) {
+        traceId = msgBuffer.read_uint64();
+    }
 }
 
 const ObjectHandle& NM_Reflect_Attribute_Values::getObject() const
@@ -2597,9 +3047,44 @@ void NM_Reflect_Attribute_Values::removeValues(uint32_t rank)
     values.erase(values.begin() + rank);
 }
 
-const EventRetractionHandle& NM_Reflect_Attribute_Values::getEvent() const
+uint32_t NM_Reflect_Attribute_Values::getRawSizesSize() const
 {
-    return event;
+    return rawSizes.size();
+}
+
+void NM_Reflect_Attribute_Values::setRawSizesSize(uint32_t num)
+{
+    rawSizes.resize(num);
+}
+
+const std::vector<uint32_t>& NM_Reflect_Attribute_Values::getRawSizes() const
+{
+    return rawSizes;
+}
+
+const uint32_t& NM_Reflect_Attribute_Values::getRawSizes(uint32_t rank) const
+{
+    return rawSizes[rank];
+}
+
+uint32_t& NM_Reflect_Attribute_Values::getRawSizes(uint32_t rank)
+{
+    return rawSizes[rank];
+}
+
+void NM_Reflect_Attribute_Values::setRawSizes(const uint32_t& newRawSizes, uint32_t rank)
+{
+    rawSizes[rank] = newRawSizes;
+}
+
+void NM_Reflect_Attribute_Values::removeRawSizes(uint32_t rank)
+{
+    rawSizes.erase(rawSizes.begin() + rank);
+}
+
+const EventRetractionHandle& NM_Reflect_Attribute_Values::getEvent() const
+{
+    return event;
 }
 
 void NM_Reflect_Attribute_Values::setEvent(const EventRetractionHandle& newEvent)
@@ -2613,6 +3098,22 @@ bool NM_Reflect_Attribute_Values::hasEvent() const
     return _hasEvent;
 }
 
+const uint64_t& NM_Reflect_Attribute_Values::getTraceId() const
+{
+    return traceId;
+}
+
+void NM_Reflect_Attribute_Values::setTraceId(const uint64_t& newTraceId)
+{
+    _hasTraceId = true;
+    traceId = newTraceId;
+}
+
+bool NM_Reflect_Attribute_Values::hasTraceId() const
+{
+    return _hasTraceId;
+}
+
 std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& msg)
 {
     os << "[NM_Reflect_Attribute_Values - Begin]" << std::endl;
@@ -2632,28 +3133,43 @@ std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& ms
         (void) element;
     }
     os << std::endl;
+    os << "  rawSizes [] =" << std::endl;
+    for (const auto& element : msg.rawSizes) {
+        os << element;
+    }
+    os << std::endl;
     os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
+    os << "  (opt) traceId =" << msg.traceId << std::endl;
     
     os << "[NM_Reflect_Attribute_Values - End]" << std::endl;
     return os;
 }
 
-NM_Send_Interaction::NM_Send_Interaction()
+NM_Batch_Update_Attribute_Values::NM_Batch_Update_Attribute_Values()
 {
-    this->messageName = "NM_Send_Interaction";
-    this->type = NetworkMessage::Type::SEND_INTERACTION;
+    this->messageName = "NM_Batch_Update_Attribute_Values";
+    this->type = NetworkMessage::Type::BATCH_UPDATE_ATTRIBUTE_VALUES;
 }
 
-void NM_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Batch_Update_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_uint32(interactionClass);
-    uint32_t parametersSize = parameters.size();
-    msgBuffer.write_uint32(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        msgBuffer.write_uint32(parameters[i]);
+    uint32_t objectsSize = objects.size();
+    msgBuffer.write_uint32(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        msgBuffer.write_uint32(objects[i]);
+    }
+    uint32_t attributeCountsSize = attributeCounts.size();
+    msgBuffer.write_uint32(attributeCountsSize);
+    for (uint32_t i = 0; i < attributeCountsSize; ++i) {
+        msgBuffer.write_uint32(attributeCounts[i]);
+    }
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
     }
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
@@ -2662,19 +3178,32 @@ void NM_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
-    msgBuffer.write_uint32(region);
+    uint32_t rawSizesSize = rawSizes.size();
+    msgBuffer.write_uint32(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        msgBuffer.write_uint32(rawSizes[i]);
+    }
 }
 
-void NM_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Batch_Update_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
-    uint32_t parametersSize = msgBuffer.read_uint32();
-    parameters.resize(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
+    uint32_t objectsSize = msgBuffer.read_uint32();
+    objects.resize(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        objects[i] = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t attributeCountsSize = msgBuffer.read_uint32();
+    attributeCounts.resize(attributeCountsSize);
+    for (uint32_t i = 0; i < attributeCountsSize; ++i) {
+        attributeCounts[i] = msgBuffer.read_uint32();
+    }
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
@@ -2683,140 +3212,251 @@ void NM_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
         values[i].resize(msgBuffer.read_uint32());
         msgBuffer.read_bytes(&(values[i][0]),values[i].size());
     }
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    uint32_t rawSizesSize = msgBuffer.read_uint32();
+    rawSizes.resize(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        rawSizes[i] = msgBuffer.read_uint32();
+    }
 }
 
-const InteractionClassHandle& NM_Send_Interaction::getInteractionClass() const
+uint32_t NM_Batch_Update_Attribute_Values::getObjectsSize() const
 {
-    return interactionClass;
+    return objects.size();
 }
 
-void NM_Send_Interaction::setInteractionClass(const InteractionClassHandle& newInteractionClass)
+void NM_Batch_Update_Attribute_Values::setObjectsSize(uint32_t num)
 {
-    interactionClass = newInteractionClass;
+    objects.resize(num);
 }
 
-uint32_t NM_Send_Interaction::getParametersSize() const
+const std::vector<ObjectHandle>& NM_Batch_Update_Attribute_Values::getObjects() const
 {
-    return parameters.size();
+    return objects;
 }
 
-void NM_Send_Interaction::setParametersSize(uint32_t num)
+const ObjectHandle& NM_Batch_Update_Attribute_Values::getObjects(uint32_t rank) const
 {
-    parameters.resize(num);
+    return objects[rank];
 }
 
-const std::vector<ParameterHandle>& NM_Send_Interaction::getParameters() const
+ObjectHandle& NM_Batch_Update_Attribute_Values::getObjects(uint32_t rank)
 {
-    return parameters;
+    return objects[rank];
 }
 
-const ParameterHandle& NM_Send_Interaction::getParameters(uint32_t rank) const
+void NM_Batch_Update_Attribute_Values::setObjects(const ObjectHandle& newObjects, uint32_t rank)
 {
-    return parameters[rank];
+    objects[rank] = newObjects;
 }
 
-ParameterHandle& NM_Send_Interaction::getParameters(uint32_t rank)
+void NM_Batch_Update_Attribute_Values::removeObjects(uint32_t rank)
 {
-    return parameters[rank];
+    objects.erase(objects.begin() + rank);
 }
 
-void NM_Send_Interaction::setParameters(const ParameterHandle& newParameters, uint32_t rank)
+uint32_t NM_Batch_Update_Attribute_Values::getAttributeCountsSize() const
 {
-    parameters[rank] = newParameters;
+    return attributeCounts.size();
 }
 
-void NM_Send_Interaction::removeParameters(uint32_t rank)
+void NM_Batch_Update_Attribute_Values::setAttributeCountsSize(uint32_t num)
 {
-    parameters.erase(parameters.begin() + rank);
+    attributeCounts.resize(num);
 }
 
-uint32_t NM_Send_Interaction::getValuesSize() const
+const std::vector<uint32_t>& NM_Batch_Update_Attribute_Values::getAttributeCounts() const
+{
+    return attributeCounts;
+}
+
+const uint32_t& NM_Batch_Update_Attribute_Values::getAttributeCounts(uint32_t rank) const
+{
+    return attributeCounts[rank];
+}
+
+uint32_t& NM_Batch_Update_Attribute_Values::getAttributeCounts(uint32_t rank)
+{
+    return attributeCounts[rank];
+}
+
+void NM_Batch_Update_Attribute_Values::setAttributeCounts(const uint32_t& newAttributeCounts, uint32_t rank)
+{
+    attributeCounts[rank] = newAttributeCounts;
+}
+
+void NM_Batch_Update_Attribute_Values::removeAttributeCounts(uint32_t rank)
+{
+    attributeCounts.erase(attributeCounts.begin() + rank);
+}
+
+uint32_t NM_Batch_Update_Attribute_Values::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_Batch_Update_Attribute_Values::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_Batch_Update_Attribute_Values::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_Batch_Update_Attribute_Values::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_Batch_Update_Attribute_Values::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_Batch_Update_Attribute_Values::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_Batch_Update_Attribute_Values::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+uint32_t NM_Batch_Update_Attribute_Values::getValuesSize() const
 {
     return values.size();
 }
 
-void NM_Send_Interaction::setValuesSize(uint32_t num)
+void NM_Batch_Update_Attribute_Values::setValuesSize(uint32_t num)
 {
     values.resize(num);
 }
 
-const std::vector<ParameterValue_t>& NM_Send_Interaction::getValues() const
+const std::vector<AttributeValue_t>& NM_Batch_Update_Attribute_Values::getValues() const
 {
     return values;
 }
 
-const ParameterValue_t& NM_Send_Interaction::getValues(uint32_t rank) const
+const AttributeValue_t& NM_Batch_Update_Attribute_Values::getValues(uint32_t rank) const
 {
     return values[rank];
 }
 
-ParameterValue_t& NM_Send_Interaction::getValues(uint32_t rank)
+AttributeValue_t& NM_Batch_Update_Attribute_Values::getValues(uint32_t rank)
 {
     return values[rank];
 }
 
-void NM_Send_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
+void NM_Batch_Update_Attribute_Values::setValues(const AttributeValue_t& newValues, uint32_t rank)
 {
     values[rank] = newValues;
 }
 
-void NM_Send_Interaction::removeValues(uint32_t rank)
+void NM_Batch_Update_Attribute_Values::removeValues(uint32_t rank)
 {
     values.erase(values.begin() + rank);
 }
 
-const RegionHandle& NM_Send_Interaction::getRegion() const
+uint32_t NM_Batch_Update_Attribute_Values::getRawSizesSize() const
 {
-    return region;
+    return rawSizes.size();
 }
 
-void NM_Send_Interaction::setRegion(const RegionHandle& newRegion)
+void NM_Batch_Update_Attribute_Values::setRawSizesSize(uint32_t num)
 {
-    region = newRegion;
+    rawSizes.resize(num);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg)
+const std::vector<uint32_t>& NM_Batch_Update_Attribute_Values::getRawSizes() const
 {
-    os << "[NM_Send_Interaction - Begin]" << std::endl;
+    return rawSizes;
+}
+
+const uint32_t& NM_Batch_Update_Attribute_Values::getRawSizes(uint32_t rank) const
+{
+    return rawSizes[rank];
+}
+
+uint32_t& NM_Batch_Update_Attribute_Values::getRawSizes(uint32_t rank)
+{
+    return rawSizes[rank];
+}
+
+void NM_Batch_Update_Attribute_Values::setRawSizes(const uint32_t& newRawSizes, uint32_t rank)
+{
+    rawSizes[rank] = newRawSizes;
+}
+
+void NM_Batch_Update_Attribute_Values::removeRawSizes(uint32_t rank)
+{
+    rawSizes.erase(rawSizes.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Batch_Update_Attribute_Values& msg)
+{
+    os << "[NM_Batch_Update_Attribute_Values - Begin]" << std::endl;
     
-    os << static_cast<const NM_Send_Interaction::Super&>(msg); // show parent class
+    os << static_cast<const NM_Batch_Update_Attribute_Values::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  interactionClass = " << msg.interactionClass << std::endl;
-    os << "  parameters [] =" << std::endl;
-    for (const auto& element : msg.parameters) {
+    os << "  objects [] =" << std::endl;
+    for (const auto& element : msg.objects) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  attributeCounts [] =" << std::endl;
+    for (const auto& element : msg.attributeCounts) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
         os << element;
     }
     os << std::endl;
     os << "  values [] =" << std::endl;
     for (const auto& element : msg.values) {
-        os << "// TODO field <values> of type <ParameterValue_t>";
+        os << "// TODO field <values> of type <AttributeValue_t>";
         (void) element;
     }
     os << std::endl;
-    os << "  region = " << msg.region << std::endl;
+    os << "  rawSizes [] =" << std::endl;
+    for (const auto& element : msg.rawSizes) {
+        os << element;
+    }
+    os << std::endl;
     
-    os << "[NM_Send_Interaction - End]" << std::endl;
+    os << "[NM_Batch_Update_Attribute_Values - End]" << std::endl;
     return os;
 }
 
-NM_Receive_Interaction::NM_Receive_Interaction()
+NM_Batch_Reflect_Attribute_Values::NM_Batch_Reflect_Attribute_Values()
 {
-    this->messageName = "NM_Receive_Interaction";
-    this->type = NetworkMessage::Type::RECEIVE_INTERACTION;
+    this->messageName = "NM_Batch_Reflect_Attribute_Values";
+    this->type = NetworkMessage::Type::BATCH_REFLECT_ATTRIBUTE_VALUES;
 }
 
-void NM_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Batch_Reflect_Attribute_Values::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_uint32(interactionClass);
-    uint32_t parametersSize = parameters.size();
-    msgBuffer.write_uint32(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        msgBuffer.write_uint32(parameters[i]);
+    uint32_t objectsSize = objects.size();
+    msgBuffer.write_uint32(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        msgBuffer.write_uint32(objects[i]);
+    }
+    uint32_t attributeCountsSize = attributeCounts.size();
+    msgBuffer.write_uint32(attributeCountsSize);
+    for (uint32_t i = 0; i < attributeCountsSize; ++i) {
+        msgBuffer.write_uint32(attributeCounts[i]);
+    }
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
     }
     uint32_t valuesSize = values.size();
     msgBuffer.write_uint32(valuesSize);
@@ -2825,21 +3465,32 @@ void NM_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
         msgBuffer.write_uint32(values[i].size());
         msgBuffer.write_bytes(&(values[i][0]),values[i].size());
     }
-    msgBuffer.write_bool(_hasEvent);
-    if (_hasEvent) {
-            }
+    uint32_t rawSizesSize = rawSizes.size();
+    msgBuffer.write_uint32(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        msgBuffer.write_uint32(rawSizes[i]);
+    }
 }
 
-void NM_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Batch_Reflect_Attribute_Values::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
-    uint32_t parametersSize = msgBuffer.read_uint32();
-    parameters.resize(parametersSize);
-    for (uint32_t i = 0; i < parametersSize; ++i) {
-        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
+    uint32_t objectsSize = msgBuffer.read_uint32();
+    objects.resize(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        objects[i] = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t attributeCountsSize = msgBuffer.read_uint32();
+    attributeCounts.resize(attributeCountsSize);
+    for (uint32_t i = 0; i < attributeCountsSize; ++i) {
+        attributeCounts[i] = msgBuffer.read_uint32();
+    }
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
     uint32_t valuesSize = msgBuffer.read_uint32();
     values.resize(valuesSize);
@@ -2848,1042 +3499,1102 @@ void NM_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
         values[i].resize(msgBuffer.read_uint32());
         msgBuffer.read_bytes(&(values[i][0]),values[i].size());
     }
-    _hasEvent = msgBuffer.read_bool();
-    if (_hasEvent) {
-            }
+    uint32_t rawSizesSize = msgBuffer.read_uint32();
+    rawSizes.resize(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        rawSizes[i] = msgBuffer.read_uint32();
+    }
 }
 
-const InteractionClassHandle& NM_Receive_Interaction::getInteractionClass() const
+uint32_t NM_Batch_Reflect_Attribute_Values::getObjectsSize() const
 {
-    return interactionClass;
+    return objects.size();
 }
 
-void NM_Receive_Interaction::setInteractionClass(const InteractionClassHandle& newInteractionClass)
+void NM_Batch_Reflect_Attribute_Values::setObjectsSize(uint32_t num)
 {
-    interactionClass = newInteractionClass;
+    objects.resize(num);
 }
 
-uint32_t NM_Receive_Interaction::getParametersSize() const
+const std::vector<ObjectHandle>& NM_Batch_Reflect_Attribute_Values::getObjects() const
 {
-    return parameters.size();
+    return objects;
 }
 
-void NM_Receive_Interaction::setParametersSize(uint32_t num)
+const ObjectHandle& NM_Batch_Reflect_Attribute_Values::getObjects(uint32_t rank) const
 {
-    parameters.resize(num);
+    return objects[rank];
 }
 
-const std::vector<ParameterHandle>& NM_Receive_Interaction::getParameters() const
+ObjectHandle& NM_Batch_Reflect_Attribute_Values::getObjects(uint32_t rank)
 {
-    return parameters;
+    return objects[rank];
 }
 
-const ParameterHandle& NM_Receive_Interaction::getParameters(uint32_t rank) const
+void NM_Batch_Reflect_Attribute_Values::setObjects(const ObjectHandle& newObjects, uint32_t rank)
 {
-    return parameters[rank];
+    objects[rank] = newObjects;
 }
 
-ParameterHandle& NM_Receive_Interaction::getParameters(uint32_t rank)
+void NM_Batch_Reflect_Attribute_Values::removeObjects(uint32_t rank)
 {
-    return parameters[rank];
+    objects.erase(objects.begin() + rank);
 }
 
-void NM_Receive_Interaction::setParameters(const ParameterHandle& newParameters, uint32_t rank)
+uint32_t NM_Batch_Reflect_Attribute_Values::getAttributeCountsSize() const
 {
-    parameters[rank] = newParameters;
+    return attributeCounts.size();
 }
 
-void NM_Receive_Interaction::removeParameters(uint32_t rank)
+void NM_Batch_Reflect_Attribute_Values::setAttributeCountsSize(uint32_t num)
 {
-    parameters.erase(parameters.begin() + rank);
+    attributeCounts.resize(num);
 }
 
-uint32_t NM_Receive_Interaction::getValuesSize() const
+const std::vector<uint32_t>& NM_Batch_Reflect_Attribute_Values::getAttributeCounts() const
 {
-    return values.size();
+    return attributeCounts;
 }
 
-void NM_Receive_Interaction::setValuesSize(uint32_t num)
+const uint32_t& NM_Batch_Reflect_Attribute_Values::getAttributeCounts(uint32_t rank) const
 {
-    values.resize(num);
+    return attributeCounts[rank];
 }
 
-const std::vector<ParameterValue_t>& NM_Receive_Interaction::getValues() const
+uint32_t& NM_Batch_Reflect_Attribute_Values::getAttributeCounts(uint32_t rank)
 {
-    return values;
+    return attributeCounts[rank];
 }
 
-const ParameterValue_t& NM_Receive_Interaction::getValues(uint32_t rank) const
+void NM_Batch_Reflect_Attribute_Values::setAttributeCounts(const uint32_t& newAttributeCounts, uint32_t rank)
 {
-    return values[rank];
+    attributeCounts[rank] = newAttributeCounts;
 }
 
-ParameterValue_t& NM_Receive_Interaction::getValues(uint32_t rank)
+void NM_Batch_Reflect_Attribute_Values::removeAttributeCounts(uint32_t rank)
 {
-    return values[rank];
+    attributeCounts.erase(attributeCounts.begin() + rank);
 }
 
-void NM_Receive_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
+uint32_t NM_Batch_Reflect_Attribute_Values::getAttributesSize() const
 {
-    values[rank] = newValues;
+    return attributes.size();
 }
 
-void NM_Receive_Interaction::removeValues(uint32_t rank)
+void NM_Batch_Reflect_Attribute_Values::setAttributesSize(uint32_t num)
 {
-    values.erase(values.begin() + rank);
+    attributes.resize(num);
 }
 
-const EventRetractionHandle& NM_Receive_Interaction::getEvent() const
+const std::vector<AttributeHandle>& NM_Batch_Reflect_Attribute_Values::getAttributes() const
 {
-    return event;
+    return attributes;
 }
 
-void NM_Receive_Interaction::setEvent(const EventRetractionHandle& newEvent)
+const AttributeHandle& NM_Batch_Reflect_Attribute_Values::getAttributes(uint32_t rank) const
 {
-    _hasEvent = true;
-    event = newEvent;
+    return attributes[rank];
 }
 
-bool NM_Receive_Interaction::hasEvent() const
+AttributeHandle& NM_Batch_Reflect_Attribute_Values::getAttributes(uint32_t rank)
 {
-    return _hasEvent;
+    return attributes[rank];
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Receive_Interaction& msg)
+void NM_Batch_Reflect_Attribute_Values::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
 {
-    os << "[NM_Receive_Interaction - Begin]" << std::endl;
-    
-    os << static_cast<const NM_Receive_Interaction::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  interactionClass = " << msg.interactionClass << std::endl;
-    os << "  parameters [] =" << std::endl;
-    for (const auto& element : msg.parameters) {
-        os << element;
-    }
-    os << std::endl;
-    os << "  values [] =" << std::endl;
-    for (const auto& element : msg.values) {
-        os << "// TODO field <values> of type <ParameterValue_t>";
-        (void) element;
-    }
-    os << std::endl;
-    os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
-    
-    os << "[NM_Receive_Interaction - End]" << std::endl;
-    return os;
+    attributes[rank] = newAttributes;
 }
 
-NM_Delete_Object::NM_Delete_Object()
+void NM_Batch_Reflect_Attribute_Values::removeAttributes(uint32_t rank)
 {
-    this->messageName = "NM_Delete_Object";
-    this->type = NetworkMessage::Type::DELETE_OBJECT;
+    attributes.erase(attributes.begin() + rank);
 }
 
-void NM_Delete_Object::serialize(libhla::MessageBuffer& msgBuffer)
+uint32_t NM_Batch_Reflect_Attribute_Values::getValuesSize() const
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(object);
-    msgBuffer.write_bool(_hasEvent);
-    if (_hasEvent) {
-            }
+    return values.size();
 }
 
-void NM_Delete_Object::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Batch_Reflect_Attribute_Values::setValuesSize(uint32_t num)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    _hasEvent = msgBuffer.read_bool();
-    if (_hasEvent) {
-            }
+    values.resize(num);
 }
 
-const ObjectHandle& NM_Delete_Object::getObject() const
+const std::vector<AttributeValue_t>& NM_Batch_Reflect_Attribute_Values::getValues() const
 {
-    return object;
+    return values;
 }
 
-void NM_Delete_Object::setObject(const ObjectHandle& newObject)
+const AttributeValue_t& NM_Batch_Reflect_Attribute_Values::getValues(uint32_t rank) const
 {
-    object = newObject;
+    return values[rank];
 }
 
-const EventRetractionHandle& NM_Delete_Object::getEvent() const
+AttributeValue_t& NM_Batch_Reflect_Attribute_Values::getValues(uint32_t rank)
 {
-    return event;
+    return values[rank];
 }
 
-void NM_Delete_Object::setEvent(const EventRetractionHandle& newEvent)
+void NM_Batch_Reflect_Attribute_Values::setValues(const AttributeValue_t& newValues, uint32_t rank)
 {
-    _hasEvent = true;
-    event = newEvent;
+    values[rank] = newValues;
 }
 
-bool NM_Delete_Object::hasEvent() const
+void NM_Batch_Reflect_Attribute_Values::removeValues(uint32_t rank)
 {
-    return _hasEvent;
+    values.erase(values.begin() + rank);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Delete_Object& msg)
+uint32_t NM_Batch_Reflect_Attribute_Values::getRawSizesSize() const
 {
-    os << "[NM_Delete_Object - Begin]" << std::endl;
+    return rawSizes.size();
+}
+
+void NM_Batch_Reflect_Attribute_Values::setRawSizesSize(uint32_t num)
+{
+    rawSizes.resize(num);
+}
+
+const std::vector<uint32_t>& NM_Batch_Reflect_Attribute_Values::getRawSizes() const
+{
+    return rawSizes;
+}
+
+const uint32_t& NM_Batch_Reflect_Attribute_Values::getRawSizes(uint32_t rank) const
+{
+    return rawSizes[rank];
+}
+
+uint32_t& NM_Batch_Reflect_Attribute_Values::getRawSizes(uint32_t rank)
+{
+    return rawSizes[rank];
+}
+
+void NM_Batch_Reflect_Attribute_Values::setRawSizes(const uint32_t& newRawSizes, uint32_t rank)
+{
+    rawSizes[rank] = newRawSizes;
+}
+
+void NM_Batch_Reflect_Attribute_Values::removeRawSizes(uint32_t rank)
+{
+    rawSizes.erase(rawSizes.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Batch_Reflect_Attribute_Values& msg)
+{
+    os << "[NM_Batch_Reflect_Attribute_Values - Begin]" << std::endl;
     
-    os << static_cast<const NM_Delete_Object::Super&>(msg); // show parent class
+    os << static_cast<const NM_Batch_Reflect_Attribute_Values::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  object = " << msg.object << std::endl;
-    os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
+    os << "  objects [] =" << std::endl;
+    for (const auto& element : msg.objects) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  attributeCounts [] =" << std::endl;
+    for (const auto& element : msg.attributeCounts) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  values [] =" << std::endl;
+    for (const auto& element : msg.values) {
+        os << "// TODO field <values> of type <AttributeValue_t>";
+        (void) element;
+    }
+    os << std::endl;
+    os << "  rawSizes [] =" << std::endl;
+    for (const auto& element : msg.rawSizes) {
+        os << element;
+    }
+    os << std::endl;
     
-    os << "[NM_Delete_Object - End]" << std::endl;
+    os << "[NM_Batch_Reflect_Attribute_Values - End]" << std::endl;
     return os;
 }
 
-NM_Remove_Object::NM_Remove_Object()
+NM_Send_Interaction::NM_Send_Interaction()
 {
-    this->messageName = "NM_Remove_Object";
-    this->type = NetworkMessage::Type::REMOVE_OBJECT;
+    this->messageName = "NM_Send_Interaction";
+    this->type = NetworkMessage::Type::SEND_INTERACTION;
 }
 
-void NM_Remove_Object::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Send_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_uint32(object);
-    msgBuffer.write_uint32(objectClass);
+    msgBuffer.write_uint32(interactionClass);
+    uint32_t parametersSize = parameters.size();
+    msgBuffer.write_uint32(parametersSize);
+    for (uint32_t i = 0; i < parametersSize; ++i) {
+        msgBuffer.write_uint32(parameters[i]);
+    }
+    uint32_t valuesSize = values.size();
+    msgBuffer.write_uint32(valuesSize);
+    for (uint32_t i = 0; i < valuesSize; ++i) {
+        //serialize native whose representation is 'repeated' byte 
+        msgBuffer.write_uint32(values[i].size());
+        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+    }
+    uint32_t rawSizesSize = rawSizes.size();
+    msgBuffer.write_uint32(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        msgBuffer.write_uint32(rawSizes[i]);
+    }
+    msgBuffer.write_uint32(region);
     msgBuffer.write_bool(_hasEvent);
     if (_hasEvent) {
-            }
+        msgBuffer.write_uint32(event);
+    }
+    uint32_t receiversSize = receivers.size();
+    msgBuffer.write_uint32(receiversSize);
+    for (uint32_t i = 0; i < receiversSize; ++i) {
+        msgBuffer.write_uint32(receivers[i]);
+    }
 }
 
-void NM_Remove_Object::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Send_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
+    uint32_t parametersSize = msgBuffer.read_uint32();
+    parameters.resize(parametersSize);
+    for (uint32_t i = 0; i < parametersSize; ++i) {
+        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t valuesSize = msgBuffer.read_uint32();
+    values.resize(valuesSize);
+    for (uint32_t i = 0; i < valuesSize; ++i) {
+        //deserialize native whose representation is 'repeated' byte 
+        values[i].resize(msgBuffer.read_uint32());
+        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+    }
+    uint32_t rawSizesSize = msgBuffer.read_uint32();
+    rawSizes.resize(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        rawSizes[i] = msgBuffer.read_uint32();
+    }
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     _hasEvent = msgBuffer.read_bool();
     if (_hasEvent) {
-            }
+        event = static_cast<EventRetractionHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t receiversSize = msgBuffer.read_uint32();
+    receivers.resize(receiversSize);
+    for (uint32_t i = 0; i < receiversSize; ++i) {
+        receivers[i] = static_cast<FederateHandle>(msgBuffer.read_uint32());
+    }
 }
 
-const ObjectHandle& NM_Remove_Object::getObject() const
+const InteractionClassHandle& NM_Send_Interaction::getInteractionClass() const
 {
-    return object;
+    return interactionClass;
 }
 
-void NM_Remove_Object::setObject(const ObjectHandle& newObject)
+void NM_Send_Interaction::setInteractionClass(const InteractionClassHandle& newInteractionClass)
 {
-    object = newObject;
+    interactionClass = newInteractionClass;
 }
 
-const ObjectClassHandle& NM_Remove_Object::getObjectClass() const
+uint32_t NM_Send_Interaction::getParametersSize() const
 {
-    return objectClass;
+    return parameters.size();
 }
 
-void NM_Remove_Object::setObjectClass(const ObjectClassHandle& newObjectClass)
+void NM_Send_Interaction::setParametersSize(uint32_t num)
 {
-    objectClass = newObjectClass;
+    parameters.resize(num);
 }
 
-const EventRetractionHandle& NM_Remove_Object::getEvent() const
+const std::vector<ParameterHandle>& NM_Send_Interaction::getParameters() const
 {
-    return event;
+    return parameters;
 }
 
-void NM_Remove_Object::setEvent(const EventRetractionHandle& newEvent)
+const ParameterHandle& NM_Send_Interaction::getParameters(uint32_t rank) const
 {
-    _hasEvent = true;
-    event = newEvent;
+    return parameters[rank];
 }
 
-bool NM_Remove_Object::hasEvent() const
+ParameterHandle& NM_Send_Interaction::getParameters(uint32_t rank)
 {
-    return _hasEvent;
+    return parameters[rank];
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Remove_Object& msg)
+void NM_Send_Interaction::setParameters(const ParameterHandle& newParameters, uint32_t rank)
 {
-    os << "[NM_Remove_Object - Begin]" << std::endl;
-    
-    os << static_cast<const NM_Remove_Object::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  object = " << msg.object << std::endl;
-    os << "  objectClass = " << msg.objectClass << std::endl;
-    os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
-    
-    os << "[NM_Remove_Object - End]" << std::endl;
-    return os;
+    parameters[rank] = newParameters;
 }
 
-NM_Change_Attribute_Transport_Type::NM_Change_Attribute_Transport_Type()
+void NM_Send_Interaction::removeParameters(uint32_t rank)
 {
-    this->messageName = "NM_Change_Attribute_Transport_Type";
-    this->type = NetworkMessage::Type::CHANGE_ATTRIBUTE_TRANSPORT_TYPE;
+    parameters.erase(parameters.begin() + rank);
 }
 
-void NM_Change_Attribute_Transport_Type::serialize(libhla::MessageBuffer& msgBuffer)
+uint32_t NM_Send_Interaction::getValuesSize() const
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(object);
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
-    msgBuffer.write_uint8(transport);
+    return values.size();
 }
 
-void NM_Change_Attribute_Transport_Type::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Send_Interaction::setValuesSize(uint32_t num)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
-    transport = static_cast<TransportType>(msgBuffer.read_uint8());
+    values.resize(num);
 }
 
-const ObjectHandle& NM_Change_Attribute_Transport_Type::getObject() const
+const std::vector<ParameterValue_t>& NM_Send_Interaction::getValues() const
 {
-    return object;
+    return values;
 }
 
-void NM_Change_Attribute_Transport_Type::setObject(const ObjectHandle& newObject)
+const ParameterValue_t& NM_Send_Interaction::getValues(uint32_t rank) const
 {
-    object = newObject;
+    return values[rank];
 }
 
-uint32_t NM_Change_Attribute_Transport_Type::getAttributesSize() const
+ParameterValue_t& NM_Send_Interaction::getValues(uint32_t rank)
 {
-    return attributes.size();
+    return values[rank];
 }
 
-void NM_Change_Attribute_Transport_Type::setAttributesSize(uint32_t num)
+void NM_Send_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
 {
-    attributes.resize(num);
+    values[rank] = newValues;
 }
 
-const std::vector<AttributeHandle>& NM_Change_Attribute_Transport_Type::getAttributes() const
+void NM_Send_Interaction::removeValues(uint32_t rank)
 {
-    return attributes;
+    values.erase(values.begin() + rank);
 }
 
-const AttributeHandle& NM_Change_Attribute_Transport_Type::getAttributes(uint32_t rank) const
+uint32_t NM_Send_Interaction::getRawSizesSize() const
 {
-    return attributes[rank];
+    return rawSizes.size();
 }
 
-AttributeHandle& NM_Change_Attribute_Transport_Type::getAttributes(uint32_t rank)
+void NM_Send_Interaction::setRawSizesSize(uint32_t num)
 {
-    return attributes[rank];
+    rawSizes.resize(num);
 }
 
-void NM_Change_Attribute_Transport_Type::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+const std::vector<uint32_t>& NM_Send_Interaction::getRawSizes() const
 {
-    attributes[rank] = newAttributes;
+    return rawSizes;
 }
 
-void NM_Change_Attribute_Transport_Type::removeAttributes(uint32_t rank)
+const uint32_t& NM_Send_Interaction::getRawSizes(uint32_t rank) const
 {
-    attributes.erase(attributes.begin() + rank);
+    return rawSizes[rank];
 }
 
-const TransportType& NM_Change_Attribute_Transport_Type::getTransport() const
+uint32_t& NM_Send_Interaction::getRawSizes(uint32_t rank)
 {
-    return transport;
+    return rawSizes[rank];
 }
 
-void NM_Change_Attribute_Transport_Type::setTransport(const TransportType& newTransport)
+void NM_Send_Interaction::setRawSizes(const uint32_t& newRawSizes, uint32_t rank)
 {
-    transport = newTransport;
+    rawSizes[rank] = newRawSizes;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Change_Attribute_Transport_Type& msg)
+void NM_Send_Interaction::removeRawSizes(uint32_t rank)
 {
-    os << "[NM_Change_Attribute_Transport_Type - Begin]" << std::endl;
-    
-    os << static_cast<const NM_Change_Attribute_Transport_Type::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  object = " << msg.object << std::endl;
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
-        os << element;
-    }
-    os << std::endl;
-    os << "  transport = " << msg.transport << std::endl;
-    
-    os << "[NM_Change_Attribute_Transport_Type - End]" << std::endl;
-    return os;
-}
-
-NM_Change_Attribute_Order_Type::NM_Change_Attribute_Order_Type()
-{
-    this->messageName = "NM_Change_Attribute_Order_Type";
-    this->type = NetworkMessage::Type::CHANGE_ATTRIBUTE_ORDER_TYPE;
-}
-
-void NM_Change_Attribute_Order_Type::serialize(libhla::MessageBuffer& msgBuffer)
-{
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(object);
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
-    msgBuffer.write_uint8(order);
+    rawSizes.erase(rawSizes.begin() + rank);
 }
 
-void NM_Change_Attribute_Order_Type::deserialize(libhla::MessageBuffer& msgBuffer)
+const RegionHandle& NM_Send_Interaction::getRegion() const
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
-    order = static_cast<OrderType>(msgBuffer.read_uint8());
+    return region;
 }
 
-const ObjectHandle& NM_Change_Attribute_Order_Type::getObject() const
+void NM_Send_Interaction::setRegion(const RegionHandle& newRegion)
 {
-    return object;
+    region = newRegion;
 }
 
-void NM_Change_Attribute_Order_Type::setObject(const ObjectHandle& newObject)
+const EventRetractionHandle& NM_Send_Interaction::getEvent() const
 {
-    object = newObject;
+    return event;
 }
 
-uint32_t NM_Change_Attribute_Order_Type::getAttributesSize() const
+void NM_Send_Interaction::setEvent(const EventRetractionHandle& newEvent)
 {
-    return attributes.size();
+    _hasEvent = true;
+    event = newEvent;
 }
 
-void NM_Change_Attribute_Order_Type::setAttributesSize(uint32_t num)
+bool NM_Send_Interaction::hasEvent() const
 {
-    attributes.resize(num);
+    return _hasEvent;
 }
 
-const std::vector<AttributeHandle>& NM_Change_Attribute_Order_Type::getAttributes() const
+uint32_t NM_Send_Interaction::getReceiversSize() const
 {
-    return attributes;
+    return receivers.size();
 }
 
-const AttributeHandle& NM_Change_Attribute_Order_Type::getAttributes(uint32_t rank) const
+void NM_Send_Interaction::setReceiversSize(uint32_t num)
 {
-    return attributes[rank];
+    receivers.resize(num);
 }
 
-AttributeHandle& NM_Change_Attribute_Order_Type::getAttributes(uint32_t rank)
+const std::vector<FederateHandle>& NM_Send_Interaction::getReceivers() const
 {
-    return attributes[rank];
+    return receivers;
 }
 
-void NM_Change_Attribute_Order_Type::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+const FederateHandle& NM_Send_Interaction::getReceivers(uint32_t rank) const
 {
-    attributes[rank] = newAttributes;
+    return receivers[rank];
 }
 
-void NM_Change_Attribute_Order_Type::removeAttributes(uint32_t rank)
+FederateHandle& NM_Send_Interaction::getReceivers(uint32_t rank)
 {
-    attributes.erase(attributes.begin() + rank);
+    return receivers[rank];
 }
 
-const OrderType& NM_Change_Attribute_Order_Type::getOrder() const
+void NM_Send_Interaction::setReceivers(const FederateHandle& newReceivers, uint32_t rank)
 {
-    return order;
+    receivers[rank] = newReceivers;
 }
 
-void NM_Change_Attribute_Order_Type::setOrder(const OrderType& newOrder)
+void NM_Send_Interaction::removeReceivers(uint32_t rank)
 {
-    order = newOrder;
+    receivers.erase(receivers.begin() + rank);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Change_Attribute_Order_Type& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg)
 {
-    os << "[NM_Change_Attribute_Order_Type - Begin]" << std::endl;
+    os << "[NM_Send_Interaction - Begin]" << std::endl;
     
-    os << static_cast<const NM_Change_Attribute_Order_Type::Super&>(msg); // show parent class
+    os << static_cast<const NM_Send_Interaction::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  object = " << msg.object << std::endl;
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
+    os << "  interactionClass = " << msg.interactionClass << std::endl;
+    os << "  parameters [] =" << std::endl;
+    for (const auto& element : msg.parameters) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  values [] =" << std::endl;
+    for (const auto& element : msg.values) {
+        os << "// TODO field <values> of type <ParameterValue_t>";
+        (void) element;
+    }
+    os << std::endl;
+    os << "  rawSizes [] =" << std::endl;
+    for (const auto& element : msg.rawSizes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  (opt) event =" << msg.event << std::endl;
+    os << "  receivers [] =" << std::endl;
+    for (const auto& element : msg.receivers) {
         os << element;
     }
     os << std::endl;
-    os << "  order = " << msg.order << std::endl;
     
-    os << "[NM_Change_Attribute_Order_Type - End]" << std::endl;
+    os << "[NM_Send_Interaction - End]" << std::endl;
     return os;
 }
 
-NM_Change_Interaction_Transport_Type::NM_Change_Interaction_Transport_Type()
+NM_Receive_Interaction::NM_Receive_Interaction()
 {
-    this->messageName = "NM_Change_Interaction_Transport_Type";
-    this->type = NetworkMessage::Type::CHANGE_INTERACTION_TRANSPORT_TYPE;
+    this->messageName = "NM_Receive_Interaction";
+    this->type = NetworkMessage::Type::RECEIVE_INTERACTION;
 }
 
-void NM_Change_Interaction_Transport_Type::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Receive_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
     msgBuffer.write_uint32(interactionClass);
-    msgBuffer.write_uint8(transport);
+    uint32_t parametersSize = parameters.size();
+    msgBuffer.write_uint32(parametersSize);
+    for (uint32_t i = 0; i < parametersSize; ++i) {
+        msgBuffer.write_uint32(parameters[i]);
+    }
+    uint32_t valuesSize = values.size();
+    msgBuffer.write_uint32(valuesSize);
+    for (uint32_t i = 0; i < valuesSize; ++i) {
+        //serialize native whose representation is 'repeated' byte 
+        msgBuffer.write_uint32(values[i].size());
+        msgBuffer.write_bytes(&(values[i][0]),values[i].size());
+    }
+    uint32_t rawSizesSize = rawSizes.size();
+    msgBuffer.write_uint32(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        msgBuffer.write_uint32(rawSizes[i]);
+    }
+    msgBuffer.write_bool(_hasEvent);
+    if (_hasEvent) {
+        msgBuffer.write_uint32(event);
+    }
 }
 
-void NM_Change_Interaction_Transport_Type::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Receive_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
-    transport = static_cast<TransportType>(msgBuffer.read_uint8());
+    uint32_t parametersSize = msgBuffer.read_uint32();
+    parameters.resize(parametersSize);
+    for (uint32_t i = 0; i < parametersSize; ++i) {
+        parameters[i] = static_cast<ParameterHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t valuesSize = msgBuffer.read_uint32();
+    values.resize(valuesSize);
+    for (uint32_t i = 0; i < valuesSize; ++i) {
+        //deserialize native whose representation is 'repeated' byte 
+        values[i].resize(msgBuffer.read_uint32());
+        msgBuffer.read_bytes(&(values[i][0]),values[i].size());
+    }
+    uint32_t rawSizesSize = msgBuffer.read_uint32();
+    rawSizes.resize(rawSizesSize);
+    for (uint32_t i = 0; i < rawSizesSize; ++i) {
+        rawSizes[i] = msgBuffer.read_uint32();
+    }
+    _hasEvent = msgBuffer.read_bool();
+    if (_hasEvent) {
+        event = static_cast<EventRetractionHandle>(msgBuffer.read_uint32());
+    }
 }
 
-const InteractionClassHandle& NM_Change_Interaction_Transport_Type::getInteractionClass() const
+const InteractionClassHandle& NM_Receive_Interaction::getInteractionClass() const
 {
     return interactionClass;
 }
 
-void NM_Change_Interaction_Transport_Type::setInteractionClass(const InteractionClassHandle& newInteractionClass)
+void NM_Receive_Interaction::setInteractionClass(const InteractionClassHandle& newInteractionClass)
 {
     interactionClass = newInteractionClass;
 }
 
-const TransportType& NM_Change_Interaction_Transport_Type::getTransport() const
+uint32_t NM_Receive_Interaction::getParametersSize() const
 {
-    return transport;
+    return parameters.size();
 }
 
-void NM_Change_Interaction_Transport_Type::setTransport(const TransportType& newTransport)
+void NM_Receive_Interaction::setParametersSize(uint32_t num)
 {
-    transport = newTransport;
+    parameters.resize(num);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Change_Interaction_Transport_Type& msg)
+const std::vector<ParameterHandle>& NM_Receive_Interaction::getParameters() const
 {
-    os << "[NM_Change_Interaction_Transport_Type - Begin]" << std::endl;
-    
-    os << static_cast<const NM_Change_Interaction_Transport_Type::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  interactionClass = " << msg.interactionClass << std::endl;
-    os << "  transport = " << msg.transport << std::endl;
-    
-    os << "[NM_Change_Interaction_Transport_Type - End]" << std::endl;
-    return os;
+    return parameters;
 }
 
-NM_Change_Interaction_Order_Type::NM_Change_Interaction_Order_Type()
+const ParameterHandle& NM_Receive_Interaction::getParameters(uint32_t rank) const
 {
-    this->messageName = "NM_Change_Interaction_Order_Type";
-    this->type = NetworkMessage::Type::CHANGE_INTERACTION_ORDER_TYPE;
+    return parameters[rank];
 }
 
-void NM_Change_Interaction_Order_Type::serialize(libhla::MessageBuffer& msgBuffer)
+ParameterHandle& NM_Receive_Interaction::getParameters(uint32_t rank)
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(interactionClass);
-    msgBuffer.write_uint8(order);
+    return parameters[rank];
 }
 
-void NM_Change_Interaction_Order_Type::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Receive_Interaction::setParameters(const ParameterHandle& newParameters, uint32_t rank)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
-    order = static_cast<OrderType>(msgBuffer.read_uint8());
+    parameters[rank] = newParameters;
 }
 
-const InteractionClassHandle& NM_Change_Interaction_Order_Type::getInteractionClass() const
+void NM_Receive_Interaction::removeParameters(uint32_t rank)
 {
-    return interactionClass;
+    parameters.erase(parameters.begin() + rank);
 }
 
-void NM_Change_Interaction_Order_Type::setInteractionClass(const InteractionClassHandle& newInteractionClass)
+uint32_t NM_Receive_Interaction::getValuesSize() const
 {
-    interactionClass = newInteractionClass;
+    return values.size();
 }
 
-const OrderType& NM_Change_Interaction_Order_Type::getOrder() const
+void NM_Receive_Interaction::setValuesSize(uint32_t num)
 {
-    return order;
+    values.resize(num);
 }
 
-void NM_Change_Interaction_Order_Type::setOrder(const OrderType& newOrder)
+const std::vector<ParameterValue_t>& NM_Receive_Interaction::getValues() const
 {
-    order = newOrder;
+    return values;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Change_Interaction_Order_Type& msg)
+const ParameterValue_t& NM_Receive_Interaction::getValues(uint32_t rank) const
 {
-    os << "[NM_Change_Interaction_Order_Type - Begin]" << std::endl;
-    
-    os << static_cast<const NM_Change_Interaction_Order_Type::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  interactionClass = " << msg.interactionClass << std::endl;
-    os << "  order = " << msg.order << std::endl;
-    
-    os << "[NM_Change_Interaction_Order_Type - End]" << std::endl;
-    return os;
+    return values[rank];
 }
 
-NM_Request_Class_Attribute_Value_Update::NM_Request_Class_Attribute_Value_Update()
+ParameterValue_t& NM_Receive_Interaction::getValues(uint32_t rank)
 {
-    this->messageName = "NM_Request_Class_Attribute_Value_Update";
-    this->type = NetworkMessage::Type::REQUEST_CLASS_ATTRIBUTE_VALUE_UPDATE;
+    return values[rank];
 }
 
-void NM_Request_Class_Attribute_Value_Update::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Receive_Interaction::setValues(const ParameterValue_t& newValues, uint32_t rank)
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(objectClass);
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
+    values[rank] = newValues;
 }
 
-void NM_Request_Class_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Receive_Interaction::removeValues(uint32_t rank)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
+    values.erase(values.begin() + rank);
 }
 
-const ObjectClassHandle& NM_Request_Class_Attribute_Value_Update::getObjectClass() const
+uint32_t NM_Receive_Interaction::getRawSizesSize() const
 {
-    return objectClass;
+    return rawSizes.size();
 }
 
-void NM_Request_Class_Attribute_Value_Update::setObjectClass(const ObjectClassHandle& newObjectClass)
+void NM_Receive_Interaction::setRawSizesSize(uint32_t num)
 {
-    objectClass = newObjectClass;
+    rawSizes.resize(num);
 }
 
-uint32_t NM_Request_Class_Attribute_Value_Update::getAttributesSize() const
+const std::vector<uint32_t>& NM_Receive_Interaction::getRawSizes() const
 {
-    return attributes.size();
+    return rawSizes;
 }
 
-void NM_Request_Class_Attribute_Value_Update::setAttributesSize(uint32_t num)
+const uint32_t& NM_Receive_Interaction::getRawSizes(uint32_t rank) const
 {
-    attributes.resize(num);
+    return rawSizes[rank];
 }
 
-const std::vector<AttributeHandle>& NM_Request_Class_Attribute_Value_Update::getAttributes() const
+uint32_t& NM_Receive_Interaction::getRawSizes(uint32_t rank)
 {
-    return attributes;
+    return rawSizes[rank];
 }
 
-const AttributeHandle& NM_Request_Class_Attribute_Value_Update::getAttributes(uint32_t rank) const
+void NM_Receive_Interaction::setRawSizes(const uint32_t& newRawSizes, uint32_t rank)
 {
-    return attributes[rank];
+    rawSizes[rank] = newRawSizes;
 }
 
-AttributeHandle& NM_Request_Class_Attribute_Value_Update::getAttributes(uint32_t rank)
+void NM_Receive_Interaction::removeRawSizes(uint32_t rank)
 {
-    return attributes[rank];
+    rawSizes.erase(rawSizes.begin() + rank);
 }
 
-void NM_Request_Class_Attribute_Value_Update::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+const EventRetractionHandle& NM_Receive_Interaction::getEvent() const
 {
-    attributes[rank] = newAttributes;
+    return event;
 }
 
-void NM_Request_Class_Attribute_Value_Update::removeAttributes(uint32_t rank)
+void NM_Receive_Interaction::setEvent(const EventRetractionHandle& newEvent)
 {
-    attributes.erase(attributes.begin() + rank);
+    _hasEvent = true;
+    event = newEvent;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Request_Class_Attribute_Value_Update& msg)
+bool NM_Receive_Interaction::hasEvent() const
 {
-    os << "[NM_Request_Class_Attribute_Value_Update - Begin]" << std::endl;
+    return _hasEvent;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Receive_Interaction& msg)
+{
+    os << "[NM_Receive_Interaction - Begin]" << std::endl;
     
-    os << static_cast<const NM_Request_Class_Attribute_Value_Update::Super&>(msg); // show parent class
+    os << static_cast<const NM_Receive_Interaction::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  objectClass = " << msg.objectClass << std::endl;
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
+    os << "  interactionClass = " << msg.interactionClass << std::endl;
+    os << "  parameters [] =" << std::endl;
+    for (const auto& element : msg.parameters) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  values [] =" << std::endl;
+    for (const auto& element : msg.values) {
+        os << "// TODO field <values> of type <ParameterValue_t>";
+        (void) element;
+    }
+    os << std::endl;
+    os << "  rawSizes [] =" << std::endl;
+    for (const auto& element : msg.rawSizes) {
         os << element;
     }
     os << std::endl;
+    os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
     
-    os << "[NM_Request_Class_Attribute_Value_Update - End]" << std::endl;
+    os << "[NM_Receive_Interaction - End]" << std::endl;
     return os;
 }
 
-NM_Request_Object_Attribute_Value_Update::NM_Request_Object_Attribute_Value_Update()
+NM_Delete_Object::NM_Delete_Object()
 {
-    this->messageName = "NM_Request_Object_Attribute_Value_Update";
-    this->type = NetworkMessage::Type::REQUEST_OBJECT_ATTRIBUTE_VALUE_UPDATE;
+    this->messageName = "NM_Delete_Object";
+    this->type = NetworkMessage::Type::DELETE_OBJECT;
 }
 
-void NM_Request_Object_Attribute_Value_Update::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Delete_Object::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
     msgBuffer.write_uint32(object);
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
+    msgBuffer.write_bool(_hasEvent);
+    if (_hasEvent) {
+        msgBuffer.write_uint32(event);
     }
 }
 
-void NM_Request_Object_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Delete_Object::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    _hasEvent = msgBuffer.read_bool();
+    if (_hasEvent) {
+        event = static_cast<EventRetractionHandle>(msgBuffer.read_uint32());
     }
 }
 
-const ObjectHandle& NM_Request_Object_Attribute_Value_Update::getObject() const
+const ObjectHandle& NM_Delete_Object::getObject() const
 {
     return object;
 }
 
-void NM_Request_Object_Attribute_Value_Update::setObject(const ObjectHandle& newObject)
+void NM_Delete_Object::setObject(const ObjectHandle& newObject)
 {
     object = newObject;
 }
 
-uint32_t NM_Request_Object_Attribute_Value_Update::getAttributesSize() const
-{
-    return attributes.size();
-}
-
-void NM_Request_Object_Attribute_Value_Update::setAttributesSize(uint32_t num)
-{
-    attributes.resize(num);
-}
-
-const std::vector<AttributeHandle>& NM_Request_Object_Attribute_Value_Update::getAttributes() const
-{
-    return attributes;
-}
-
-const AttributeHandle& NM_Request_Object_Attribute_Value_Update::getAttributes(uint32_t rank) const
-{
-    return attributes[rank];
-}
-
-AttributeHandle& NM_Request_Object_Attribute_Value_Update::getAttributes(uint32_t rank)
+const EventRetractionHandle& NM_Delete_Object::getEvent() const
 {
-    return attributes[rank];
+    return event;
 }
 
-void NM_Request_Object_Attribute_Value_Update::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+void NM_Delete_Object::setEvent(const EventRetractionHandle& newEvent)
 {
-    attributes[rank] = newAttributes;
+    _hasEvent = true;
+    event = newEvent;
 }
 
-void NM_Request_Object_Attribute_Value_Update::removeAttributes(uint32_t rank)
+bool NM_Delete_Object::hasEvent() const
 {
-    attributes.erase(attributes.begin() + rank);
+    return _hasEvent;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Request_Object_Attribute_Value_Update& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Delete_Object& msg)
 {
-    os << "[NM_Request_Object_Attribute_Value_Update - Begin]" << std::endl;
+    os << "[NM_Delete_Object - Begin]" << std::endl;
     
-    os << static_cast<const NM_Request_Object_Attribute_Value_Update::Super&>(msg); // show parent class
+    os << static_cast<const NM_Delete_Object::Super&>(msg); // show parent class
     
     // Specific display
     os << "  object = " << msg.object << std::endl;
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
-        os << element;
-    }
-    os << std::endl;
+    os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
     
-    os << "[NM_Request_Object_Attribute_Value_Update - End]" << std::endl;
+    os << "[NM_Delete_Object - End]" << std::endl;
     return os;
 }
 
-NM_Is_Attribute_Owned_By_Federate::NM_Is_Attribute_Owned_By_Federate()
+NM_Remove_Object::NM_Remove_Object()
 {
-    this->messageName = "NM_Is_Attribute_Owned_By_Federate";
-    this->type = NetworkMessage::Type::IS_ATTRIBUTE_OWNED_BY_FEDERATE;
+    this->messageName = "NM_Remove_Object";
+    this->type = NetworkMessage::Type::REMOVE_OBJECT;
 }
 
-void NM_Is_Attribute_Owned_By_Federate::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Remove_Object::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
     msgBuffer.write_uint32(object);
-    msgBuffer.write_uint32(attribute);
+    msgBuffer.write_uint32(objectClass);
+    msgBuffer.write_bool(_hasEvent);
+    if (_hasEvent) {
+        msgBuffer.write_uint32(event);
+    }
 }
 
-void NM_Is_Attribute_Owned_By_Federate::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Remove_Object::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    _hasEvent = msgBuffer.read_bool();
+    if (_hasEvent) {
+        event = static_cast<EventRetractionHandle>(msgBuffer.read_uint32());
+    }
 }
 
-const ObjectHandle& NM_Is_Attribute_Owned_By_Federate::getObject() const
+const ObjectHandle& NM_Remove_Object::getObject() const
 {
     return object;
 }
 
-void NM_Is_Attribute_Owned_By_Federate::setObject(const ObjectHandle& newObject)
+void NM_Remove_Object::setObject(const ObjectHandle& newObject)
 {
     object = newObject;
 }
 
-const AttributeHandle& NM_Is_Attribute_Owned_By_Federate::getAttribute() const
+const ObjectClassHandle& NM_Remove_Object::getObjectClass() const
 {
-    return attribute;
+    return objectClass;
 }
 
-void NM_Is_Attribute_Owned_By_Federate::setAttribute(const AttributeHandle& newAttribute)
+void NM_Remove_Object::setObjectClass(const ObjectClassHandle& newObjectClass)
 {
-    attribute = newAttribute;
+    objectClass = newObjectClass;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Is_Attribute_Owned_By_Federate& msg)
+const EventRetractionHandle& NM_Remove_Object::getEvent() const
 {
-    os << "[NM_Is_Attribute_Owned_By_Federate - Begin]" << std::endl;
+    return event;
+}
+
+void NM_Remove_Object::setEvent(const EventRetractionHandle& newEvent)
+{
+    _hasEvent = true;
+    event = newEvent;
+}
+
+bool NM_Remove_Object::hasEvent() const
+{
+    return _hasEvent;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Remove_Object& msg)
+{
+    os << "[NM_Remove_Object - Begin]" << std::endl;
     
-    os << static_cast<const NM_Is_Attribute_Owned_By_Federate::Super&>(msg); // show parent class
+    os << static_cast<const NM_Remove_Object::Super&>(msg); // show parent class
     
     // Specific display
     os << "  object = " << msg.object << std::endl;
-    os << "  attribute = " << msg.attribute << std::endl;
+    os << "  objectClass = " << msg.objectClass << std::endl;
+    os << "  (opt) event =" << "// TODO field <event> of type <EventRetractionHandle>" << std::endl;
     
-    os << "[NM_Is_Attribute_Owned_By_Federate - End]" << std::endl;
+    os << "[NM_Remove_Object - End]" << std::endl;
     return os;
 }
 
-NM_Query_Attribute_Ownership::NM_Query_Attribute_Ownership()
+NM_Remove_Objects::NM_Remove_Objects()
 {
-    this->messageName = "NM_Query_Attribute_Ownership";
-    this->type = NetworkMessage::Type::QUERY_ATTRIBUTE_OWNERSHIP;
+    this->messageName = "NM_Remove_Objects";
+    this->type = NetworkMessage::Type::REMOVE_OBJECTS;
 }
 
-void NM_Query_Attribute_Ownership::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Remove_Objects::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_uint32(object);
-    msgBuffer.write_uint32(attribute);
+    msgBuffer.write_uint32(objectClass);
+    uint32_t objectsSize = objects.size();
+    msgBuffer.write_uint32(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        msgBuffer.write_uint32(objects[i]);
+    }
 }
 
-void NM_Query_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Remove_Objects::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    uint32_t objectsSize = msgBuffer.read_uint32();
+    objects.resize(objectsSize);
+    for (uint32_t i = 0; i < objectsSize; ++i) {
+        objects[i] = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    }
 }
 
-const ObjectHandle& NM_Query_Attribute_Ownership::getObject() const
+const ObjectClassHandle& NM_Remove_Objects::getObjectClass() const
 {
-    return object;
+    return objectClass;
 }
 
-void NM_Query_Attribute_Ownership::setObject(const ObjectHandle& newObject)
+void NM_Remove_Objects::setObjectClass(const ObjectClassHandle& newObjectClass)
 {
-    object = newObject;
+    objectClass = newObjectClass;
 }
 
-const AttributeHandle& NM_Query_Attribute_Ownership::getAttribute() const
+uint32_t NM_Remove_Objects::getObjectsSize() const
 {
-    return attribute;
+    return objects.size();
 }
 
-void NM_Query_Attribute_Ownership::setAttribute(const AttributeHandle& newAttribute)
+void NM_Remove_Objects::setObjectsSize(uint32_t num)
 {
-    attribute = newAttribute;
+    objects.resize(num);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Query_Attribute_Ownership& msg)
+const std::vector<ObjectHandle>& NM_Remove_Objects::getObjects() const
 {
-    os << "[NM_Query_Attribute_Ownership - Begin]" << std::endl;
+    return objects;
+}
+
+const ObjectHandle& NM_Remove_Objects::getObjects(uint32_t rank) const
+{
+    return objects[rank];
+}
+
+ObjectHandle& NM_Remove_Objects::getObjects(uint32_t rank)
+{
+    return objects[rank];
+}
+
+void NM_Remove_Objects::setObjects(const ObjectHandle& newObjects, uint32_t rank)
+{
+    objects[rank] = newObjects;
+}
+
+void NM_Remove_Objects::removeObjects(uint32_t rank)
+{
+    objects.erase(objects.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Remove_Objects& msg)
+{
+    os << "[NM_Remove_Objects - Begin]" << std::endl;
     
-    os << static_cast<const NM_Query_Attribute_Ownership::Super&>(msg); // show parent class
+    os << static_cast<const NM_Remove_Objects::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  object = " << msg.object << std::endl;
-    os << "  attribute = " << msg.attribute << std::endl;
+    os << "  objectClass = " << msg.objectClass << std::endl;
+    os << "  objects [] =" << std::endl;
+    for (const auto& element : msg.objects) {
+        os << element;
+    }
+    os << std::endl;
     
-    os << "[NM_Query_Attribute_Ownership - End]" << std::endl;
+    os << "[NM_Remove_Objects - End]" << std::endl;
     return os;
 }
 
-NM_Attribute_Is_Not_Owned::NM_Attribute_Is_Not_Owned()
+NM_Change_Attribute_Transport_Type::NM_Change_Attribute_Transport_Type()
 {
-    this->messageName = "NM_Attribute_Is_Not_Owned";
-    this->type = NetworkMessage::Type::ATTRIBUTE_IS_NOT_OWNED;
+    this->messageName = "NM_Change_Attribute_Transport_Type";
+    this->type = NetworkMessage::Type::CHANGE_ATTRIBUTE_TRANSPORT_TYPE;
 }
 
-void NM_Attribute_Is_Not_Owned::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Change_Attribute_Transport_Type::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
     msgBuffer.write_uint32(object);
-    msgBuffer.write_uint32(attribute);
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_uint8(transport);
 }
 
-void NM_Attribute_Is_Not_Owned::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Change_Attribute_Transport_Type::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    transport = static_cast<TransportType>(msgBuffer.read_uint8());
 }
 
-const ObjectHandle& NM_Attribute_Is_Not_Owned::getObject() const
+const ObjectHandle& NM_Change_Attribute_Transport_Type::getObject() const
 {
     return object;
 }
 
-void NM_Attribute_Is_Not_Owned::setObject(const ObjectHandle& newObject)
+void NM_Change_Attribute_Transport_Type::setObject(const ObjectHandle& newObject)
 {
     object = newObject;
 }
 
-const AttributeHandle& NM_Attribute_Is_Not_Owned::getAttribute() const
-{
-    return attribute;
-}
-
-void NM_Attribute_Is_Not_Owned::setAttribute(const AttributeHandle& newAttribute)
+uint32_t NM_Change_Attribute_Transport_Type::getAttributesSize() const
 {
-    attribute = newAttribute;
+    return attributes.size();
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Attribute_Is_Not_Owned& msg)
+void NM_Change_Attribute_Transport_Type::setAttributesSize(uint32_t num)
 {
-    os << "[NM_Attribute_Is_Not_Owned - Begin]" << std::endl;
-    
-    os << static_cast<const NM_Attribute_Is_Not_Owned::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  object = " << msg.object << std::endl;
-    os << "  attribute = " << msg.attribute << std::endl;
-    
-    os << "[NM_Attribute_Is_Not_Owned - End]" << std::endl;
-    return os;
+    attributes.resize(num);
 }
 
-NM_Inform_Attribute_Ownership::NM_Inform_Attribute_Ownership()
+const std::vector<AttributeHandle>& NM_Change_Attribute_Transport_Type::getAttributes() const
 {
-    this->messageName = "NM_Inform_Attribute_Ownership";
-    this->type = NetworkMessage::Type::INFORM_ATTRIBUTE_OWNERSHIP;
+    return attributes;
 }
 
-void NM_Inform_Attribute_Ownership::serialize(libhla::MessageBuffer& msgBuffer)
+const AttributeHandle& NM_Change_Attribute_Transport_Type::getAttributes(uint32_t rank) const
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(object);
-    msgBuffer.write_uint32(attribute);
+    return attributes[rank];
 }
 
-void NM_Inform_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer)
+AttributeHandle& NM_Change_Attribute_Transport_Type::getAttributes(uint32_t rank)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    return attributes[rank];
 }
 
-const ObjectHandle& NM_Inform_Attribute_Ownership::getObject() const
+void NM_Change_Attribute_Transport_Type::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
 {
-    return object;
+    attributes[rank] = newAttributes;
 }
 
-void NM_Inform_Attribute_Ownership::setObject(const ObjectHandle& newObject)
+void NM_Change_Attribute_Transport_Type::removeAttributes(uint32_t rank)
 {
-    object = newObject;
+    attributes.erase(attributes.begin() + rank);
 }
 
-const AttributeHandle& NM_Inform_Attribute_Ownership::getAttribute() const
+const TransportType& NM_Change_Attribute_Transport_Type::getTransport() const
 {
-    return attribute;
+    return transport;
 }
 
-void NM_Inform_Attribute_Ownership::setAttribute(const AttributeHandle& newAttribute)
+void NM_Change_Attribute_Transport_Type::setTransport(const TransportType& newTransport)
 {
-    attribute = newAttribute;
+    transport = newTransport;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Inform_Attribute_Ownership& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Change_Attribute_Transport_Type& msg)
 {
-    os << "[NM_Inform_Attribute_Ownership - Begin]" << std::endl;
+    os << "[NM_Change_Attribute_Transport_Type - Begin]" << std::endl;
     
-    os << static_cast<const NM_Inform_Attribute_Ownership::Super&>(msg); // show parent class
+    os << static_cast<const NM_Change_Attribute_Transport_Type::Super&>(msg); // show parent class
     
     // Specific display
     os << "  object = " << msg.object << std::endl;
-    os << "  attribute = " << msg.attribute << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  transport = " << msg.transport << std::endl;
     
-    os << "[NM_Inform_Attribute_Ownership - End]" << std::endl;
+    os << "[NM_Change_Attribute_Transport_Type - End]" << std::endl;
     return os;
 }
 
-NM_Attribute_Ownership_Base::NM_Attribute_Ownership_Base()
+NM_Change_Attribute_Order_Type::NM_Change_Attribute_Order_Type()
 {
-    this->messageName = "NM_Attribute_Ownership_Base";
-    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_BASE;
+    this->messageName = "NM_Change_Attribute_Order_Type";
+    this->type = NetworkMessage::Type::CHANGE_ATTRIBUTE_ORDER_TYPE;
 }
 
-void NM_Attribute_Ownership_Base::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Change_Attribute_Order_Type::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
@@ -3894,9 +4605,10 @@ void NM_Attribute_Ownership_Base::serialize(libhla::MessageBuffer& msgBuffer)
     for (uint32_t i = 0; i < attributesSize; ++i) {
         msgBuffer.write_uint32(attributes[i]);
     }
+    msgBuffer.write_uint8(order);
 }
 
-void NM_Attribute_Ownership_Base::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Change_Attribute_Order_Type::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
@@ -3907,58 +4619,69 @@ void NM_Attribute_Ownership_Base::deserialize(libhla::MessageBuffer& msgBuffer)
     for (uint32_t i = 0; i < attributesSize; ++i) {
         attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
+    order = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
-const ObjectHandle& NM_Attribute_Ownership_Base::getObject() const
+const ObjectHandle& NM_Change_Attribute_Order_Type::getObject() const
 {
     return object;
 }
 
-void NM_Attribute_Ownership_Base::setObject(const ObjectHandle& newObject)
+void NM_Change_Attribute_Order_Type::setObject(const ObjectHandle& newObject)
 {
     object = newObject;
 }
 
-uint32_t NM_Attribute_Ownership_Base::getAttributesSize() const
+uint32_t NM_Change_Attribute_Order_Type::getAttributesSize() const
 {
     return attributes.size();
 }
 
-void NM_Attribute_Ownership_Base::setAttributesSize(uint32_t num)
+void NM_Change_Attribute_Order_Type::setAttributesSize(uint32_t num)
 {
     attributes.resize(num);
 }
 
-const std::vector<AttributeHandle>& NM_Attribute_Ownership_Base::getAttributes() const
+const std::vector<AttributeHandle>& NM_Change_Attribute_Order_Type::getAttributes() const
 {
     return attributes;
 }
 
-const AttributeHandle& NM_Attribute_Ownership_Base::getAttributes(uint32_t rank) const
+const AttributeHandle& NM_Change_Attribute_Order_Type::getAttributes(uint32_t rank) const
 {
     return attributes[rank];
 }
 
-AttributeHandle& NM_Attribute_Ownership_Base::getAttributes(uint32_t rank)
+AttributeHandle& NM_Change_Attribute_Order_Type::getAttributes(uint32_t rank)
 {
     return attributes[rank];
 }
 
-void NM_Attribute_Ownership_Base::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+void NM_Change_Attribute_Order_Type::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
 {
     attributes[rank] = newAttributes;
 }
 
-void NM_Attribute_Ownership_Base::removeAttributes(uint32_t rank)
+void NM_Change_Attribute_Order_Type::removeAttributes(uint32_t rank)
 {
     attributes.erase(attributes.begin() + rank);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Attribute_Ownership_Base& msg)
+const OrderType& NM_Change_Attribute_Order_Type::getOrder() const
 {
-    os << "[NM_Attribute_Ownership_Base - Begin]" << std::endl;
+    return order;
+}
+
+void NM_Change_Attribute_Order_Type::setOrder(const OrderType& newOrder)
+{
+    order = newOrder;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Change_Attribute_Order_Type& msg)
+{
+    os << "[NM_Change_Attribute_Order_Type - Begin]" << std::endl;
     
-    os << static_cast<const NM_Attribute_Ownership_Base::Super&>(msg); // show parent class
+    os << static_cast<const NM_Change_Attribute_Order_Type::Super&>(msg); // show parent class
     
     // Specific display
     os << "  object = " << msg.object << std::endl;
@@ -3967,1473 +4690,3210 @@ std::ostream& operator<<(std::ostream& os, const NM_Attribute_Ownership_Base& ms
         os << element;
     }
     os << std::endl;
+    os << "  order = " << msg.order << std::endl;
     
-    os << "[NM_Attribute_Ownership_Base - End]" << std::endl;
+    os << "[NM_Change_Attribute_Order_Type - End]" << std::endl;
     return os;
 }
 
-NM_Negotiated_Attribute_Ownership_Divestiture::NM_Negotiated_Attribute_Ownership_Divestiture()
+NM_Change_Interaction_Transport_Type::NM_Change_Interaction_Transport_Type()
 {
-    this->messageName = "NM_Negotiated_Attribute_Ownership_Divestiture";
-    this->type = NetworkMessage::Type::NEGOTIATED_ATTRIBUTE_OWNERSHIP_DIVESTITURE;
+    this->messageName = "NM_Change_Interaction_Transport_Type";
+    this->type = NetworkMessage::Type::CHANGE_INTERACTION_TRANSPORT_TYPE;
 }
 
-NM_Attribute_Ownership_Acquisition_Notification::NM_Attribute_Ownership_Acquisition_Notification()
+void NM_Change_Interaction_Transport_Type::serialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_Attribute_Ownership_Acquisition_Notification";
-    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_ACQUISITION_NOTIFICATION;
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(interactionClass);
+    msgBuffer.write_uint8(transport);
 }
 
-NM_Attribute_Ownership_Divestiture_Notification::NM_Attribute_Ownership_Divestiture_Notification()
+void NM_Change_Interaction_Transport_Type::deserialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_Attribute_Ownership_Divestiture_Notification";
-    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_DIVESTITURE_NOTIFICATION;
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
+    transport = static_cast<TransportType>(msgBuffer.read_uint8());
 }
 
-NM_Request_Attribute_Ownership_Assumption::NM_Request_Attribute_Ownership_Assumption()
+const InteractionClassHandle& NM_Change_Interaction_Transport_Type::getInteractionClass() const
 {
-    this->messageName = "NM_Request_Attribute_Ownership_Assumption";
-    this->type = NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION;
+    return interactionClass;
 }
 
-NM_Attribute_Ownership_Unavailable::NM_Attribute_Ownership_Unavailable()
+void NM_Change_Interaction_Transport_Type::setInteractionClass(const InteractionClassHandle& newInteractionClass)
 {
-    this->messageName = "NM_Attribute_Ownership_Unavailable";
-    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_UNAVAILABLE;
+    interactionClass = newInteractionClass;
 }
 
-NM_Attribute_Ownership_Acquisition_If_Available::NM_Attribute_Ownership_Acquisition_If_Available()
+const TransportType& NM_Change_Interaction_Transport_Type::getTransport() const
 {
-    this->messageName = "NM_Attribute_Ownership_Acquisition_If_Available";
-    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_ACQUISITION_IF_AVAILABLE;
+    return transport;
 }
 
-NM_Unconditional_Attribute_Ownership_Divestiture::NM_Unconditional_Attribute_Ownership_Divestiture()
+void NM_Change_Interaction_Transport_Type::setTransport(const TransportType& newTransport)
 {
-    this->messageName = "NM_Unconditional_Attribute_Ownership_Divestiture";
-    this->type = NetworkMessage::Type::UNCONDITIONAL_ATTRIBUTE_OWNERSHIP_DIVESTITURE;
+    transport = newTransport;
 }
 
-NM_Attribute_Ownership_Acquisition::NM_Attribute_Ownership_Acquisition()
+std::ostream& operator<<(std::ostream& os, const NM_Change_Interaction_Transport_Type& msg)
 {
-    this->messageName = "NM_Attribute_Ownership_Acquisition";
-    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_ACQUISITION;
+    os << "[NM_Change_Interaction_Transport_Type - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Change_Interaction_Transport_Type::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  interactionClass = " << msg.interactionClass << std::endl;
+    os << "  transport = " << msg.transport << std::endl;
+    
+    os << "[NM_Change_Interaction_Transport_Type - End]" << std::endl;
+    return os;
 }
 
-NM_Request_Attribute_Ownership_Release::NM_Request_Attribute_Ownership_Release()
+NM_Change_Interaction_Order_Type::NM_Change_Interaction_Order_Type()
 {
-    this->messageName = "NM_Request_Attribute_Ownership_Release";
-    this->type = NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_RELEASE;
+    this->messageName = "NM_Change_Interaction_Order_Type";
+    this->type = NetworkMessage::Type::CHANGE_INTERACTION_ORDER_TYPE;
 }
 
-NM_Cancel_Negotiated_Attribute_Ownership_Divestiture::NM_Cancel_Negotiated_Attribute_Ownership_Divestiture()
+void NM_Change_Interaction_Order_Type::serialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_Cancel_Negotiated_Attribute_Ownership_Divestiture";
-    this->type = NetworkMessage::Type::CANCEL_NEGOTIATED_ATTRIBUTE_OWNERSHIP_DIVESTITURE;
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(interactionClass);
+    msgBuffer.write_uint8(order);
 }
 
-NM_Attribute_Ownership_Release_Response::NM_Attribute_Ownership_Release_Response()
+void NM_Change_Interaction_Order_Type::deserialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_Attribute_Ownership_Release_Response";
-    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_RELEASE_RESPONSE;
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
+    order = static_cast<OrderType>(msgBuffer.read_uint8());
 }
 
-NM_Cancel_Attribute_Ownership_Acquisition::NM_Cancel_Attribute_Ownership_Acquisition()
+const InteractionClassHandle& NM_Change_Interaction_Order_Type::getInteractionClass() const
 {
-    this->messageName = "NM_Cancel_Attribute_Ownership_Acquisition";
-    this->type = NetworkMessage::Type::CANCEL_ATTRIBUTE_OWNERSHIP_ACQUISITION;
+    return interactionClass;
 }
 
-NM_Confirm_Attribute_Ownership_Acquisition_Cancellation::NM_Confirm_Attribute_Ownership_Acquisition_Cancellation()
+void NM_Change_Interaction_Order_Type::setInteractionClass(const InteractionClassHandle& newInteractionClass)
 {
-    this->messageName = "NM_Confirm_Attribute_Ownership_Acquisition_Cancellation";
-    this->type = NetworkMessage::Type::CONFIRM_ATTRIBUTE_OWNERSHIP_ACQUISITION_CANCELLATION;
+    interactionClass = newInteractionClass;
 }
 
-NM_DDM_Create_Region::NM_DDM_Create_Region()
+const OrderType& NM_Change_Interaction_Order_Type::getOrder() const
 {
-    this->messageName = "NM_DDM_Create_Region";
-    this->type = NetworkMessage::Type::DDM_CREATE_REGION;
+    return order;
 }
 
-void NM_DDM_Create_Region::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Change_Interaction_Order_Type::setOrder(const OrderType& newOrder)
+{
+    order = newOrder;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Change_Interaction_Order_Type& msg)
+{
+    os << "[NM_Change_Interaction_Order_Type - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Change_Interaction_Order_Type::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  interactionClass = " << msg.interactionClass << std::endl;
+    os << "  order = " << msg.order << std::endl;
+    
+    os << "[NM_Change_Interaction_Order_Type - End]" << std::endl;
+    return os;
+}
+
+NM_Request_Class_Attribute_Value_Update::NM_Request_Class_Attribute_Value_Update()
+{
+    this->messageName = "NM_Request_Class_Attribute_Value_Update";
+    this->type = NetworkMessage::Type::REQUEST_CLASS_ATTRIBUTE_VALUE_UPDATE;
+}
+
+void NM_Request_Class_Attribute_Value_Update::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
+    msgBuffer.write_uint32(objectClass);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         msgBuffer.write_uint32(attributes[i]);
     }
-    msgBuffer.write_bool(DDM_bool);
-    msgBuffer.write_uint32(space);
-    msgBuffer.write_uint32(region);
-    msgBuffer.write_uint32(nbExtents);
 }
 
-void NM_DDM_Create_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Request_Class_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
-    DDM_bool = msgBuffer.read_bool();
-    space = static_cast<SpaceHandle>(msgBuffer.read_uint32());
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    nbExtents = msgBuffer.read_uint32();
 }
 
-uint32_t NM_DDM_Create_Region::getAttributesSize() const
+const ObjectClassHandle& NM_Request_Class_Attribute_Value_Update::getObjectClass() const
+{
+    return objectClass;
+}
+
+void NM_Request_Class_Attribute_Value_Update::setObjectClass(const ObjectClassHandle& newObjectClass)
+{
+    objectClass = newObjectClass;
+}
+
+uint32_t NM_Request_Class_Attribute_Value_Update::getAttributesSize() const
 {
     return attributes.size();
 }
 
-void NM_DDM_Create_Region::setAttributesSize(uint32_t num)
+void NM_Request_Class_Attribute_Value_Update::setAttributesSize(uint32_t num)
 {
     attributes.resize(num);
 }
 
-const std::vector<AttributeHandle>& NM_DDM_Create_Region::getAttributes() const
+const std::vector<AttributeHandle>& NM_Request_Class_Attribute_Value_Update::getAttributes() const
 {
     return attributes;
 }
 
-const AttributeHandle& NM_DDM_Create_Region::getAttributes(uint32_t rank) const
+const AttributeHandle& NM_Request_Class_Attribute_Value_Update::getAttributes(uint32_t rank) const
 {
     return attributes[rank];
 }
 
-AttributeHandle& NM_DDM_Create_Region::getAttributes(uint32_t rank)
+AttributeHandle& NM_Request_Class_Attribute_Value_Update::getAttributes(uint32_t rank)
 {
     return attributes[rank];
 }
 
-void NM_DDM_Create_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+void NM_Request_Class_Attribute_Value_Update::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
 {
     attributes[rank] = newAttributes;
 }
 
-void NM_DDM_Create_Region::removeAttributes(uint32_t rank)
+void NM_Request_Class_Attribute_Value_Update::removeAttributes(uint32_t rank)
 {
     attributes.erase(attributes.begin() + rank);
 }
 
-const bool& NM_DDM_Create_Region::getDDM_bool() const
-{
-    return DDM_bool;
-}
-
-void NM_DDM_Create_Region::setDDM_bool(const bool& newDDM_bool)
-{
-    DDM_bool = newDDM_bool;
-}
-
-const SpaceHandle& NM_DDM_Create_Region::getSpace() const
-{
-    return space;
-}
-
-void NM_DDM_Create_Region::setSpace(const SpaceHandle& newSpace)
-{
-    space = newSpace;
-}
-
-const RegionHandle& NM_DDM_Create_Region::getRegion() const
-{
-    return region;
-}
-
-void NM_DDM_Create_Region::setRegion(const RegionHandle& newRegion)
-{
-    region = newRegion;
-}
-
-const uint32_t& NM_DDM_Create_Region::getNbExtents() const
-{
-    return nbExtents;
-}
-
-void NM_DDM_Create_Region::setNbExtents(const uint32_t& newNbExtents)
-{
-    nbExtents = newNbExtents;
-}
-
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Create_Region& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Request_Class_Attribute_Value_Update& msg)
 {
-    os << "[NM_DDM_Create_Region - Begin]" << std::endl;
+    os << "[NM_Request_Class_Attribute_Value_Update - Begin]" << std::endl;
     
-    os << static_cast<const NM_DDM_Create_Region::Super&>(msg); // show parent class
+    os << static_cast<const NM_Request_Class_Attribute_Value_Update::Super&>(msg); // show parent class
     
     // Specific display
+    os << "  objectClass = " << msg.objectClass << std::endl;
     os << "  attributes [] =" << std::endl;
     for (const auto& element : msg.attributes) {
         os << element;
     }
     os << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    os << "  space = " << msg.space << std::endl;
-    os << "  region = " << msg.region << std::endl;
-    os << "  nbExtents = " << msg.nbExtents << std::endl;
     
-    os << "[NM_DDM_Create_Region - End]" << std::endl;
+    os << "[NM_Request_Class_Attribute_Value_Update - End]" << std::endl;
     return os;
 }
 
-NM_DDM_Modify_Region::NM_DDM_Modify_Region()
+NM_Request_Object_Attribute_Value_Update::NM_Request_Object_Attribute_Value_Update()
 {
-    this->messageName = "NM_DDM_Modify_Region";
-    this->type = NetworkMessage::Type::DDM_MODIFY_REGION;
+    this->messageName = "NM_Request_Object_Attribute_Value_Update";
+    this->type = NetworkMessage::Type::REQUEST_OBJECT_ATTRIBUTE_VALUE_UPDATE;
 }
 
-void NM_DDM_Modify_Region::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Request_Object_Attribute_Value_Update::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
+    msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         msgBuffer.write_uint32(attributes[i]);
     }
-    msgBuffer.write_bool(DDM_bool);
-    msgBuffer.write_uint32(region);
 }
 
-void NM_DDM_Modify_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Request_Object_Attribute_Value_Update::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
-    DDM_bool = msgBuffer.read_bool();
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
 }
 
-uint32_t NM_DDM_Modify_Region::getAttributesSize() const
+const ObjectHandle& NM_Request_Object_Attribute_Value_Update::getObject() const
+{
+    return object;
+}
+
+void NM_Request_Object_Attribute_Value_Update::setObject(const ObjectHandle& newObject)
+{
+    object = newObject;
+}
+
+uint32_t NM_Request_Object_Attribute_Value_Update::getAttributesSize() const
 {
     return attributes.size();
 }
 
-void NM_DDM_Modify_Region::setAttributesSize(uint32_t num)
+void NM_Request_Object_Attribute_Value_Update::setAttributesSize(uint32_t num)
 {
     attributes.resize(num);
 }
 
-const std::vector<AttributeHandle>& NM_DDM_Modify_Region::getAttributes() const
+const std::vector<AttributeHandle>& NM_Request_Object_Attribute_Value_Update::getAttributes() const
 {
     return attributes;
 }
 
-const AttributeHandle& NM_DDM_Modify_Region::getAttributes(uint32_t rank) const
+const AttributeHandle& NM_Request_Object_Attribute_Value_Update::getAttributes(uint32_t rank) const
 {
     return attributes[rank];
 }
 
-AttributeHandle& NM_DDM_Modify_Region::getAttributes(uint32_t rank)
+AttributeHandle& NM_Request_Object_Attribute_Value_Update::getAttributes(uint32_t rank)
 {
     return attributes[rank];
 }
 
-void NM_DDM_Modify_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+void NM_Request_Object_Attribute_Value_Update::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
 {
     attributes[rank] = newAttributes;
 }
 
-void NM_DDM_Modify_Region::removeAttributes(uint32_t rank)
+void NM_Request_Object_Attribute_Value_Update::removeAttributes(uint32_t rank)
 {
     attributes.erase(attributes.begin() + rank);
 }
 
-const bool& NM_DDM_Modify_Region::getDDM_bool() const
-{
-    return DDM_bool;
-}
-
-void NM_DDM_Modify_Region::setDDM_bool(const bool& newDDM_bool)
-{
-    DDM_bool = newDDM_bool;
-}
-
-const RegionHandle& NM_DDM_Modify_Region::getRegion() const
-{
-    return region;
-}
-
-void NM_DDM_Modify_Region::setRegion(const RegionHandle& newRegion)
-{
-    region = newRegion;
-}
-
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Modify_Region& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Request_Object_Attribute_Value_Update& msg)
 {
-    os << "[NM_DDM_Modify_Region - Begin]" << std::endl;
+    os << "[NM_Request_Object_Attribute_Value_Update - Begin]" << std::endl;
     
-    os << static_cast<const NM_DDM_Modify_Region::Super&>(msg); // show parent class
+    os << static_cast<const NM_Request_Object_Attribute_Value_Update::Super&>(msg); // show parent class
     
     // Specific display
+    os << "  object = " << msg.object << std::endl;
     os << "  attributes [] =" << std::endl;
     for (const auto& element : msg.attributes) {
         os << element;
     }
     os << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    os << "  region = " << msg.region << std::endl;
     
-    os << "[NM_DDM_Modify_Region - End]" << std::endl;
+    os << "[NM_Request_Object_Attribute_Value_Update - End]" << std::endl;
     return os;
 }
 
-NM_DDM_Delete_Region::NM_DDM_Delete_Region()
+NM_Is_Attribute_Owned_By_Federate::NM_Is_Attribute_Owned_By_Federate()
 {
-    this->messageName = "NM_DDM_Delete_Region";
-    this->type = NetworkMessage::Type::DDM_DELETE_REGION;
+    this->messageName = "NM_Is_Attribute_Owned_By_Federate";
+    this->type = NetworkMessage::Type::IS_ATTRIBUTE_OWNED_BY_FEDERATE;
 }
 
-void NM_DDM_Delete_Region::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Is_Attribute_Owned_By_Federate::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_uint32(region);
+    msgBuffer.write_uint32(object);
+    msgBuffer.write_uint32(attribute);
 }
 
-void NM_DDM_Delete_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Is_Attribute_Owned_By_Federate::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
-const RegionHandle& NM_DDM_Delete_Region::getRegion() const
+const ObjectHandle& NM_Is_Attribute_Owned_By_Federate::getObject() const
 {
-    return region;
+    return object;
 }
 
-void NM_DDM_Delete_Region::setRegion(const RegionHandle& newRegion)
+void NM_Is_Attribute_Owned_By_Federate::setObject(const ObjectHandle& newObject)
 {
-    region = newRegion;
+    object = newObject;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Delete_Region& msg)
+const AttributeHandle& NM_Is_Attribute_Owned_By_Federate::getAttribute() const
 {
-    os << "[NM_DDM_Delete_Region - Begin]" << std::endl;
+    return attribute;
+}
+
+void NM_Is_Attribute_Owned_By_Federate::setAttribute(const AttributeHandle& newAttribute)
+{
+    attribute = newAttribute;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Is_Attribute_Owned_By_Federate& msg)
+{
+    os << "[NM_Is_Attribute_Owned_By_Federate - Begin]" << std::endl;
     
-    os << static_cast<const NM_DDM_Delete_Region::Super&>(msg); // show parent class
+    os << static_cast<const NM_Is_Attribute_Owned_By_Federate::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  region = " << msg.region << std::endl;
+    os << "  object = " << msg.object << std::endl;
+    os << "  attribute = " << msg.attribute << std::endl;
     
-    os << "[NM_DDM_Delete_Region - End]" << std::endl;
+    os << "[NM_Is_Attribute_Owned_By_Federate - End]" << std::endl;
     return os;
 }
 
-NM_DDM_Associate_Region::NM_DDM_Associate_Region()
+NM_Query_Attribute_Ownership::NM_Query_Attribute_Ownership()
 {
-    this->messageName = "NM_DDM_Associate_Region";
-    this->type = NetworkMessage::Type::DDM_ASSOCIATE_REGION;
+    this->messageName = "NM_Query_Attribute_Ownership";
+    this->type = NetworkMessage::Type::QUERY_ATTRIBUTE_OWNERSHIP;
 }
 
-void NM_DDM_Associate_Region::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Query_Attribute_Ownership::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
-    msgBuffer.write_bool(DDM_bool);
-    msgBuffer.write_uint32(region);
     msgBuffer.write_uint32(object);
+    msgBuffer.write_uint32(attribute);
 }
 
-void NM_DDM_Associate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Query_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
-    DDM_bool = msgBuffer.read_bool();
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
     object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
-uint32_t NM_DDM_Associate_Region::getAttributesSize() const
+const ObjectHandle& NM_Query_Attribute_Ownership::getObject() const
 {
-    return attributes.size();
+    return object;
 }
 
-void NM_DDM_Associate_Region::setAttributesSize(uint32_t num)
+void NM_Query_Attribute_Ownership::setObject(const ObjectHandle& newObject)
 {
-    attributes.resize(num);
+    object = newObject;
 }
 
-const std::vector<AttributeHandle>& NM_DDM_Associate_Region::getAttributes() const
+const AttributeHandle& NM_Query_Attribute_Ownership::getAttribute() const
 {
-    return attributes;
+    return attribute;
 }
 
-const AttributeHandle& NM_DDM_Associate_Region::getAttributes(uint32_t rank) const
+void NM_Query_Attribute_Ownership::setAttribute(const AttributeHandle& newAttribute)
 {
-    return attributes[rank];
+    attribute = newAttribute;
 }
 
-AttributeHandle& NM_DDM_Associate_Region::getAttributes(uint32_t rank)
+std::ostream& operator<<(std::ostream& os, const NM_Query_Attribute_Ownership& msg)
 {
-    return attributes[rank];
+    os << "[NM_Query_Attribute_Ownership - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Query_Attribute_Ownership::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  object = " << msg.object << std::endl;
+    os << "  attribute = " << msg.attribute << std::endl;
+    
+    os << "[NM_Query_Attribute_Ownership - End]" << std::endl;
+    return os;
 }
 
-void NM_DDM_Associate_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+NM_Attribute_Is_Not_Owned::NM_Attribute_Is_Not_Owned()
 {
-    attributes[rank] = newAttributes;
+    this->messageName = "NM_Attribute_Is_Not_Owned";
+    this->type = NetworkMessage::Type::ATTRIBUTE_IS_NOT_OWNED;
 }
 
-void NM_DDM_Associate_Region::removeAttributes(uint32_t rank)
+void NM_Attribute_Is_Not_Owned::serialize(libhla::MessageBuffer& msgBuffer)
 {
-    attributes.erase(attributes.begin() + rank);
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(object);
+    msgBuffer.write_uint32(attribute);
 }
 
-const bool& NM_DDM_Associate_Region::getDDM_bool() const
+void NM_Attribute_Is_Not_Owned::deserialize(libhla::MessageBuffer& msgBuffer)
 {
-    return DDM_bool;
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
 }
 
-void NM_DDM_Associate_Region::setDDM_bool(const bool& newDDM_bool)
+const ObjectHandle& NM_Attribute_Is_Not_Owned::getObject() const
 {
-    DDM_bool = newDDM_bool;
+    return object;
 }
 
-const RegionHandle& NM_DDM_Associate_Region::getRegion() const
+void NM_Attribute_Is_Not_Owned::setObject(const ObjectHandle& newObject)
 {
-    return region;
+    object = newObject;
 }
 
-void NM_DDM_Associate_Region::setRegion(const RegionHandle& newRegion)
+const AttributeHandle& NM_Attribute_Is_Not_Owned::getAttribute() const
 {
-    region = newRegion;
+    return attribute;
 }
 
-const ObjectHandle& NM_DDM_Associate_Region::getObject() const
+void NM_Attribute_Is_Not_Owned::setAttribute(const AttributeHandle& newAttribute)
+{
+    attribute = newAttribute;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Attribute_Is_Not_Owned& msg)
+{
+    os << "[NM_Attribute_Is_Not_Owned - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Attribute_Is_Not_Owned::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  object = " << msg.object << std::endl;
+    os << "  attribute = " << msg.attribute << std::endl;
+    
+    os << "[NM_Attribute_Is_Not_Owned - End]" << std::endl;
+    return os;
+}
+
+NM_Inform_Attribute_Ownership::NM_Inform_Attribute_Ownership()
+{
+    this->messageName = "NM_Inform_Attribute_Ownership";
+    this->type = NetworkMessage::Type::INFORM_ATTRIBUTE_OWNERSHIP;
+}
+
+void NM_Inform_Attribute_Ownership::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(object);
+    msgBuffer.write_uint32(attribute);
+}
+
+void NM_Inform_Attribute_Ownership::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    attribute = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+}
+
+const ObjectHandle& NM_Inform_Attribute_Ownership::getObject() const
 {
     return object;
 }
 
-void NM_DDM_Associate_Region::setObject(const ObjectHandle& newObject)
+void NM_Inform_Attribute_Ownership::setObject(const ObjectHandle& newObject)
 {
     object = newObject;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Associate_Region& msg)
+const AttributeHandle& NM_Inform_Attribute_Ownership::getAttribute() const
 {
-    os << "[NM_DDM_Associate_Region - Begin]" << std::endl;
+    return attribute;
+}
+
+void NM_Inform_Attribute_Ownership::setAttribute(const AttributeHandle& newAttribute)
+{
+    attribute = newAttribute;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Inform_Attribute_Ownership& msg)
+{
+    os << "[NM_Inform_Attribute_Ownership - Begin]" << std::endl;
     
-    os << static_cast<const NM_DDM_Associate_Region::Super&>(msg); // show parent class
+    os << static_cast<const NM_Inform_Attribute_Ownership::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
-        os << element;
-    }
-    os << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    os << "  region = " << msg.region << std::endl;
     os << "  object = " << msg.object << std::endl;
+    os << "  attribute = " << msg.attribute << std::endl;
     
-    os << "[NM_DDM_Associate_Region - End]" << std::endl;
+    os << "[NM_Inform_Attribute_Ownership - End]" << std::endl;
     return os;
 }
 
-NM_DDM_Unassociate_Region::NM_DDM_Unassociate_Region()
+NM_Attribute_Ownership_Base::NM_Attribute_Ownership_Base()
 {
-    this->messageName = "NM_DDM_Unassociate_Region";
-    this->type = NetworkMessage::Type::DDM_UNASSOCIATE_REGION;
+    this->messageName = "NM_Attribute_Ownership_Base";
+    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_BASE;
 }
 
-void NM_DDM_Unassociate_Region::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Attribute_Ownership_Base::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
+    msgBuffer.write_uint32(object);
     uint32_t attributesSize = attributes.size();
     msgBuffer.write_uint32(attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         msgBuffer.write_uint32(attributes[i]);
     }
-    msgBuffer.write_uint32(region);
-    msgBuffer.write_uint32(object);
-    msgBuffer.write_bool(DDM_bool);
 }
 
-void NM_DDM_Unassociate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Attribute_Ownership_Base::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
     uint32_t attributesSize = msgBuffer.read_uint32();
     attributes.resize(attributesSize);
     for (uint32_t i = 0; i < attributesSize; ++i) {
         attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
     }
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    DDM_bool = msgBuffer.read_bool();
 }
 
-uint32_t NM_DDM_Unassociate_Region::getAttributesSize() const
+const ObjectHandle& NM_Attribute_Ownership_Base::getObject() const
+{
+    return object;
+}
+
+void NM_Attribute_Ownership_Base::setObject(const ObjectHandle& newObject)
+{
+    object = newObject;
+}
+
+uint32_t NM_Attribute_Ownership_Base::getAttributesSize() const
 {
     return attributes.size();
 }
 
-void NM_DDM_Unassociate_Region::setAttributesSize(uint32_t num)
+void NM_Attribute_Ownership_Base::setAttributesSize(uint32_t num)
 {
     attributes.resize(num);
 }
 
-const std::vector<AttributeHandle>& NM_DDM_Unassociate_Region::getAttributes() const
+const std::vector<AttributeHandle>& NM_Attribute_Ownership_Base::getAttributes() const
 {
     return attributes;
 }
 
-const AttributeHandle& NM_DDM_Unassociate_Region::getAttributes(uint32_t rank) const
+const AttributeHandle& NM_Attribute_Ownership_Base::getAttributes(uint32_t rank) const
 {
     return attributes[rank];
 }
 
-AttributeHandle& NM_DDM_Unassociate_Region::getAttributes(uint32_t rank)
+AttributeHandle& NM_Attribute_Ownership_Base::getAttributes(uint32_t rank)
 {
     return attributes[rank];
 }
 
-void NM_DDM_Unassociate_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+void NM_Attribute_Ownership_Base::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
 {
     attributes[rank] = newAttributes;
 }
 
-void NM_DDM_Unassociate_Region::removeAttributes(uint32_t rank)
+void NM_Attribute_Ownership_Base::removeAttributes(uint32_t rank)
 {
     attributes.erase(attributes.begin() + rank);
 }
 
-const RegionHandle& NM_DDM_Unassociate_Region::getRegion() const
+std::ostream& operator<<(std::ostream& os, const NM_Attribute_Ownership_Base& msg)
 {
-    return region;
+    os << "[NM_Attribute_Ownership_Base - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Attribute_Ownership_Base::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  object = " << msg.object << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    
+    os << "[NM_Attribute_Ownership_Base - End]" << std::endl;
+    return os;
 }
 
-void NM_DDM_Unassociate_Region::setRegion(const RegionHandle& newRegion)
+NM_Negotiated_Attribute_Ownership_Divestiture::NM_Negotiated_Attribute_Ownership_Divestiture()
 {
-    region = newRegion;
+    this->messageName = "NM_Negotiated_Attribute_Ownership_Divestiture";
+    this->type = NetworkMessage::Type::NEGOTIATED_ATTRIBUTE_OWNERSHIP_DIVESTITURE;
 }
 
-const ObjectHandle& NM_DDM_Unassociate_Region::getObject() const
+NM_Attribute_Ownership_Acquisition_Notification::NM_Attribute_Ownership_Acquisition_Notification()
 {
-    return object;
+    this->messageName = "NM_Attribute_Ownership_Acquisition_Notification";
+    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_ACQUISITION_NOTIFICATION;
 }
 
-void NM_DDM_Unassociate_Region::setObject(const ObjectHandle& newObject)
+NM_Attribute_Ownership_Divestiture_Notification::NM_Attribute_Ownership_Divestiture_Notification()
 {
-    object = newObject;
+    this->messageName = "NM_Attribute_Ownership_Divestiture_Notification";
+    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_DIVESTITURE_NOTIFICATION;
 }
 
-const bool& NM_DDM_Unassociate_Region::getDDM_bool() const
+NM_Request_Attribute_Ownership_Assumption::NM_Request_Attribute_Ownership_Assumption()
 {
-    return DDM_bool;
+    this->messageName = "NM_Request_Attribute_Ownership_Assumption";
+    this->type = NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION;
 }
 
-void NM_DDM_Unassociate_Region::setDDM_bool(const bool& newDDM_bool)
+NM_Attribute_Ownership_Unavailable::NM_Attribute_Ownership_Unavailable()
 {
-    DDM_bool = newDDM_bool;
+    this->messageName = "NM_Attribute_Ownership_Unavailable";
+    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_UNAVAILABLE;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Unassociate_Region& msg)
+NM_Attribute_Ownership_Acquisition_If_Available::NM_Attribute_Ownership_Acquisition_If_Available()
 {
-    os << "[NM_DDM_Unassociate_Region - Begin]" << std::endl;
-    
-    os << static_cast<const NM_DDM_Unassociate_Region::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
-        os << element;
-    }
-    os << std::endl;
-    os << "  region = " << msg.region << std::endl;
-    os << "  object = " << msg.object << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    
-    os << "[NM_DDM_Unassociate_Region - End]" << std::endl;
-    return os;
+    this->messageName = "NM_Attribute_Ownership_Acquisition_If_Available";
+    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_ACQUISITION_IF_AVAILABLE;
 }
 
-NM_DDM_Register_Object::NM_DDM_Register_Object()
+NM_Unconditional_Attribute_Ownership_Divestiture::NM_Unconditional_Attribute_Ownership_Divestiture()
 {
-    this->messageName = "NM_DDM_Register_Object";
-    this->type = NetworkMessage::Type::DDM_REGISTER_OBJECT;
+    this->messageName = "NM_Unconditional_Attribute_Ownership_Divestiture";
+    this->type = NetworkMessage::Type::UNCONDITIONAL_ATTRIBUTE_OWNERSHIP_DIVESTITURE;
 }
 
-void NM_DDM_Register_Object::serialize(libhla::MessageBuffer& msgBuffer)
+NM_Attribute_Ownership_Acquisition::NM_Attribute_Ownership_Acquisition()
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(objectClass);
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
-    msgBuffer.write_uint32(region);
-    msgBuffer.write_bool(_hasObjectInstanceName);
-    if (_hasObjectInstanceName) {
-        msgBuffer.write_string(objectInstanceName);
-    }
-    msgBuffer.write_uint32(object);
-    msgBuffer.write_bool(DDM_bool);
+    this->messageName = "NM_Attribute_Ownership_Acquisition";
+    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_ACQUISITION;
 }
 
-void NM_DDM_Register_Object::deserialize(libhla::MessageBuffer& msgBuffer)
+NM_Request_Attribute_Ownership_Release::NM_Request_Attribute_Ownership_Release()
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    _hasObjectInstanceName = msgBuffer.read_bool();
-    if (_hasObjectInstanceName) {
-        msgBuffer.read_string(objectInstanceName);
-    }
-    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
-    DDM_bool = msgBuffer.read_bool();
+    this->messageName = "NM_Request_Attribute_Ownership_Release";
+    this->type = NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_RELEASE;
 }
 
-const ObjectClassHandle& NM_DDM_Register_Object::getObjectClass() const
+NM_Cancel_Negotiated_Attribute_Ownership_Divestiture::NM_Cancel_Negotiated_Attribute_Ownership_Divestiture()
 {
-    return objectClass;
+    this->messageName = "NM_Cancel_Negotiated_Attribute_Ownership_Divestiture";
+    this->type = NetworkMessage::Type::CANCEL_NEGOTIATED_ATTRIBUTE_OWNERSHIP_DIVESTITURE;
+}
+
+NM_Attribute_Ownership_Release_Response::NM_Attribute_Ownership_Release_Response()
+{
+    this->messageName = "NM_Attribute_Ownership_Release_Response";
+    this->type = NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_RELEASE_RESPONSE;
+}
+
+NM_Cancel_Attribute_Ownership_Acquisition::NM_Cancel_Attribute_Ownership_Acquisition()
+{
+    this->messageName = "NM_Cancel_Attribute_Ownership_Acquisition";
+    this->type = NetworkMessage::Type::CANCEL_ATTRIBUTE_OWNERSHIP_ACQUISITION;
+}
+
+NM_Confirm_Attribute_Ownership_Acquisition_Cancellation::NM_Confirm_Attribute_Ownership_Acquisition_Cancellation()
+{
+    this->messageName = "NM_Confirm_Attribute_Ownership_Acquisition_Cancellation";
+    this->type = NetworkMessage::Type::CONFIRM_ATTRIBUTE_OWNERSHIP_ACQUISITION_CANCELLATION;
+}
+
+NM_DDM_Create_Region::NM_DDM_Create_Region()
+{
+    this->messageName = "NM_DDM_Create_Region";
+    this->type = NetworkMessage::Type::DDM_CREATE_REGION;
+}
+
+void NM_DDM_Create_Region::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_bool(DDM_bool);
+    msgBuffer.write_uint32(space);
+    msgBuffer.write_uint32(region);
+    msgBuffer.write_uint32(nbExtents);
+}
+
+void NM_DDM_Create_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    DDM_bool = msgBuffer.read_bool();
+    space = static_cast<SpaceHandle>(msgBuffer.read_uint32());
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    nbExtents = msgBuffer.read_uint32();
+}
+
+uint32_t NM_DDM_Create_Region::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_DDM_Create_Region::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_DDM_Create_Region::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_DDM_Create_Region::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_DDM_Create_Region::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_DDM_Create_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_DDM_Create_Region::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+const bool& NM_DDM_Create_Region::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Create_Region::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+const SpaceHandle& NM_DDM_Create_Region::getSpace() const
+{
+    return space;
+}
+
+void NM_DDM_Create_Region::setSpace(const SpaceHandle& newSpace)
+{
+    space = newSpace;
+}
+
+const RegionHandle& NM_DDM_Create_Region::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Create_Region::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+const uint32_t& NM_DDM_Create_Region::getNbExtents() const
+{
+    return nbExtents;
+}
+
+void NM_DDM_Create_Region::setNbExtents(const uint32_t& newNbExtents)
+{
+    nbExtents = newNbExtents;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Create_Region& msg)
+{
+    os << "[NM_DDM_Create_Region - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Create_Region::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    os << "  space = " << msg.space << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  nbExtents = " << msg.nbExtents << std::endl;
+    
+    os << "[NM_DDM_Create_Region - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Modify_Region::NM_DDM_Modify_Region()
+{
+    this->messageName = "NM_DDM_Modify_Region";
+    this->type = NetworkMessage::Type::DDM_MODIFY_REGION;
+}
+
+void NM_DDM_Modify_Region::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_bool(DDM_bool);
+    msgBuffer.write_uint32(region);
+    serializeExtent(msgBuffer);
+}
+
+void NM_DDM_Modify_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    DDM_bool = msgBuffer.read_bool();
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    deserializeExtent(msgBuffer);
+}
+
+uint32_t NM_DDM_Modify_Region::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_DDM_Modify_Region::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_DDM_Modify_Region::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_DDM_Modify_Region::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_DDM_Modify_Region::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_DDM_Modify_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_DDM_Modify_Region::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+const bool& NM_DDM_Modify_Region::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Modify_Region::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+const RegionHandle& NM_DDM_Modify_Region::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Modify_Region::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Modify_Region& msg)
+{
+    os << "[NM_DDM_Modify_Region - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Modify_Region::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    
+    os << "[NM_DDM_Modify_Region - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Modify_Regions::NM_DDM_Modify_Regions()
+{
+    this->messageName = "NM_DDM_Modify_Regions";
+    this->type = NetworkMessage::Type::DDM_MODIFY_REGIONS;
+}
+
+void NM_DDM_Modify_Regions::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t regionsSize = regions.size();
+    msgBuffer.write_uint32(regionsSize);
+    for (uint32_t i = 0; i < regionsSize; ++i) {
+        msgBuffer.write_uint32(regions[i]);
+    }
+    uint32_t extentCountsSize = extentCounts.size();
+    msgBuffer.write_uint32(extentCountsSize);
+    for (uint32_t i = 0; i < extentCountsSize; ++i) {
+        msgBuffer.write_uint32(extentCounts[i]);
+    }
+    uint32_t rangeCountsSize = rangeCounts.size();
+    msgBuffer.write_uint32(rangeCountsSize);
+    for (uint32_t i = 0; i < rangeCountsSize; ++i) {
+        msgBuffer.write_uint32(rangeCounts[i]);
+    }
+    uint32_t boundsSize = bounds.size();
+    msgBuffer.write_uint32(boundsSize);
+    for (uint32_t i = 0; i < boundsSize; ++i) {
+        msgBuffer.write_uint32(bounds[i]);
+    }
+}
+
+void NM_DDM_Modify_Regions::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t regionsSize = msgBuffer.read_uint32();
+    regions.resize(regionsSize);
+    for (uint32_t i = 0; i < regionsSize; ++i) {
+        regions[i] = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t extentCountsSize = msgBuffer.read_uint32();
+    extentCounts.resize(extentCountsSize);
+    for (uint32_t i = 0; i < extentCountsSize; ++i) {
+        extentCounts[i] = msgBuffer.read_uint32();
+    }
+    uint32_t rangeCountsSize = msgBuffer.read_uint32();
+    rangeCounts.resize(rangeCountsSize);
+    for (uint32_t i = 0; i < rangeCountsSize; ++i) {
+        rangeCounts[i] = msgBuffer.read_uint32();
+    }
+    uint32_t boundsSize = msgBuffer.read_uint32();
+    bounds.resize(boundsSize);
+    for (uint32_t i = 0; i < boundsSize; ++i) {
+        bounds[i] = msgBuffer.read_uint32();
+    }
+}
+
+uint32_t NM_DDM_Modify_Regions::getRegionsSize() const
+{
+    return regions.size();
+}
+
+void NM_DDM_Modify_Regions::setRegionsSize(uint32_t num)
+{
+    regions.resize(num);
+}
+
+const std::vector<RegionHandle>& NM_DDM_Modify_Regions::getRegions() const
+{
+    return regions;
+}
+
+const RegionHandle& NM_DDM_Modify_Regions::getRegions(uint32_t rank) const
+{
+    return regions[rank];
+}
+
+RegionHandle& NM_DDM_Modify_Regions::getRegions(uint32_t rank)
+{
+    return regions[rank];
+}
+
+void NM_DDM_Modify_Regions::setRegions(const RegionHandle& newRegions, uint32_t rank)
+{
+    regions[rank] = newRegions;
+}
+
+void NM_DDM_Modify_Regions::removeRegions(uint32_t rank)
+{
+    regions.erase(regions.begin() + rank);
+}
+
+uint32_t NM_DDM_Modify_Regions::getExtentCountsSize() const
+{
+    return extentCounts.size();
+}
+
+void NM_DDM_Modify_Regions::setExtentCountsSize(uint32_t num)
+{
+    extentCounts.resize(num);
+}
+
+const std::vector<uint32_t>& NM_DDM_Modify_Regions::getExtentCounts() const
+{
+    return extentCounts;
+}
+
+const uint32_t& NM_DDM_Modify_Regions::getExtentCounts(uint32_t rank) const
+{
+    return extentCounts[rank];
+}
+
+uint32_t& NM_DDM_Modify_Regions::getExtentCounts(uint32_t rank)
+{
+    return extentCounts[rank];
+}
+
+void NM_DDM_Modify_Regions::setExtentCounts(const uint32_t& newExtentCounts, uint32_t rank)
+{
+    extentCounts[rank] = newExtentCounts;
+}
+
+void NM_DDM_Modify_Regions::removeExtentCounts(uint32_t rank)
+{
+    extentCounts.erase(extentCounts.begin() + rank);
+}
+
+uint32_t NM_DDM_Modify_Regions::getRangeCountsSize() const
+{
+    return rangeCounts.size();
+}
+
+void NM_DDM_Modify_Regions::setRangeCountsSize(uint32_t num)
+{
+    rangeCounts.resize(num);
+}
+
+const std::vector<uint32_t>& NM_DDM_Modify_Regions::getRangeCounts() const
+{
+    return rangeCounts;
+}
+
+const uint32_t& NM_DDM_Modify_Regions::getRangeCounts(uint32_t rank) const
+{
+    return rangeCounts[rank];
+}
+
+uint32_t& NM_DDM_Modify_Regions::getRangeCounts(uint32_t rank)
+{
+    return rangeCounts[rank];
+}
+
+void NM_DDM_Modify_Regions::setRangeCounts(const uint32_t& newRangeCounts, uint32_t rank)
+{
+    rangeCounts[rank] = newRangeCounts;
+}
+
+void NM_DDM_Modify_Regions::removeRangeCounts(uint32_t rank)
+{
+    rangeCounts.erase(rangeCounts.begin() + rank);
+}
+
+uint32_t NM_DDM_Modify_Regions::getBoundsSize() const
+{
+    return bounds.size();
+}
+
+void NM_DDM_Modify_Regions::setBoundsSize(uint32_t num)
+{
+    bounds.resize(num);
+}
+
+const std::vector<uint32_t>& NM_DDM_Modify_Regions::getBounds() const
+{
+    return bounds;
+}
+
+const uint32_t& NM_DDM_Modify_Regions::getBounds(uint32_t rank) const
+{
+    return bounds[rank];
+}
+
+uint32_t& NM_DDM_Modify_Regions::getBounds(uint32_t rank)
+{
+    return bounds[rank];
+}
+
+void NM_DDM_Modify_Regions::setBounds(const uint32_t& newBounds, uint32_t rank)
+{
+    bounds[rank] = newBounds;
+}
+
+void NM_DDM_Modify_Regions::removeBounds(uint32_t rank)
+{
+    bounds.erase(bounds.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Modify_Regions& msg)
+{
+    os << "[NM_DDM_Modify_Regions - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Modify_Regions::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  regions [] =" << std::endl;
+    for (const auto& element : msg.regions) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  extentCounts [] =" << std::endl;
+    for (const auto& element : msg.extentCounts) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  rangeCounts [] =" << std::endl;
+    for (const auto& element : msg.rangeCounts) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  bounds [] =" << std::endl;
+    for (const auto& element : msg.bounds) {
+        os << element;
+    }
+    os << std::endl;
+    
+    os << "[NM_DDM_Modify_Regions - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Delete_Region::NM_DDM_Delete_Region()
+{
+    this->messageName = "NM_DDM_Delete_Region";
+    this->type = NetworkMessage::Type::DDM_DELETE_REGION;
+}
+
+void NM_DDM_Delete_Region::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(region);
+}
+
+void NM_DDM_Delete_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+}
+
+const RegionHandle& NM_DDM_Delete_Region::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Delete_Region::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Delete_Region& msg)
+{
+    os << "[NM_DDM_Delete_Region - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Delete_Region::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  region = " << msg.region << std::endl;
+    
+    os << "[NM_DDM_Delete_Region - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Associate_Region::NM_DDM_Associate_Region()
+{
+    this->messageName = "NM_DDM_Associate_Region";
+    this->type = NetworkMessage::Type::DDM_ASSOCIATE_REGION;
+}
+
+void NM_DDM_Associate_Region::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_bool(DDM_bool);
+    msgBuffer.write_uint32(region);
+    msgBuffer.write_uint32(object);
+}
+
+void NM_DDM_Associate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    DDM_bool = msgBuffer.read_bool();
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+}
+
+uint32_t NM_DDM_Associate_Region::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_DDM_Associate_Region::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_DDM_Associate_Region::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_DDM_Associate_Region::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_DDM_Associate_Region::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_DDM_Associate_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_DDM_Associate_Region::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+const bool& NM_DDM_Associate_Region::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Associate_Region::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+const RegionHandle& NM_DDM_Associate_Region::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Associate_Region::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+const ObjectHandle& NM_DDM_Associate_Region::getObject() const
+{
+    return object;
+}
+
+void NM_DDM_Associate_Region::setObject(const ObjectHandle& newObject)
+{
+    object = newObject;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Associate_Region& msg)
+{
+    os << "[NM_DDM_Associate_Region - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Associate_Region::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  object = " << msg.object << std::endl;
+    
+    os << "[NM_DDM_Associate_Region - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Unassociate_Region::NM_DDM_Unassociate_Region()
+{
+    this->messageName = "NM_DDM_Unassociate_Region";
+    this->type = NetworkMessage::Type::DDM_UNASSOCIATE_REGION;
+}
+
+void NM_DDM_Unassociate_Region::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_uint32(region);
+    msgBuffer.write_uint32(object);
+    msgBuffer.write_bool(DDM_bool);
+}
+
+void NM_DDM_Unassociate_Region::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    DDM_bool = msgBuffer.read_bool();
+}
+
+uint32_t NM_DDM_Unassociate_Region::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_DDM_Unassociate_Region::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_DDM_Unassociate_Region::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_DDM_Unassociate_Region::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_DDM_Unassociate_Region::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_DDM_Unassociate_Region::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_DDM_Unassociate_Region::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+const RegionHandle& NM_DDM_Unassociate_Region::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Unassociate_Region::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+const ObjectHandle& NM_DDM_Unassociate_Region::getObject() const
+{
+    return object;
+}
+
+void NM_DDM_Unassociate_Region::setObject(const ObjectHandle& newObject)
+{
+    object = newObject;
+}
+
+const bool& NM_DDM_Unassociate_Region::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Unassociate_Region::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Unassociate_Region& msg)
+{
+    os << "[NM_DDM_Unassociate_Region - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Unassociate_Region::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  object = " << msg.object << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    
+    os << "[NM_DDM_Unassociate_Region - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Register_Object::NM_DDM_Register_Object()
+{
+    this->messageName = "NM_DDM_Register_Object";
+    this->type = NetworkMessage::Type::DDM_REGISTER_OBJECT;
+}
+
+void NM_DDM_Register_Object::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(objectClass);
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_uint32(region);
+    msgBuffer.write_bool(_hasObjectInstanceName);
+    if (_hasObjectInstanceName) {
+        msgBuffer.write_string(objectInstanceName);
+    }
+    msgBuffer.write_uint32(object);
+    msgBuffer.write_bool(DDM_bool);
+}
+
+void NM_DDM_Register_Object::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    _hasObjectInstanceName = msgBuffer.read_bool();
+    if (_hasObjectInstanceName) {
+        msgBuffer.read_string(objectInstanceName);
+    }
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    DDM_bool = msgBuffer.read_bool();
+}
+
+const ObjectClassHandle& NM_DDM_Register_Object::getObjectClass() const
+{
+    return objectClass;
 }
 
 void NM_DDM_Register_Object::setObjectClass(const ObjectClassHandle& newObjectClass)
 {
-    objectClass = newObjectClass;
+    objectClass = newObjectClass;
+}
+
+uint32_t NM_DDM_Register_Object::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_DDM_Register_Object::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_DDM_Register_Object::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_DDM_Register_Object::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_DDM_Register_Object::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_DDM_Register_Object::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_DDM_Register_Object::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+const RegionHandle& NM_DDM_Register_Object::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Register_Object::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+const std::string& NM_DDM_Register_Object::getObjectInstanceName() const
+{
+    return objectInstanceName;
+}
+
+void NM_DDM_Register_Object::setObjectInstanceName(const std::string& newObjectInstanceName)
+{
+    _hasObjectInstanceName = true;
+    objectInstanceName = newObjectInstanceName;
+}
+
+bool NM_DDM_Register_Object::hasObjectInstanceName() const
+{
+    return _hasObjectInstanceName;
+}
+
+const ObjectHandle& NM_DDM_Register_Object::getObject() const
+{
+    return object;
+}
+
+void NM_DDM_Register_Object::setObject(const ObjectHandle& newObject)
+{
+    object = newObject;
+}
+
+const bool& NM_DDM_Register_Object::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Register_Object::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Register_Object& msg)
+{
+    os << "[NM_DDM_Register_Object - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Register_Object::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objectClass = " << msg.objectClass << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  (opt) objectInstanceName =" << msg.objectInstanceName << std::endl;
+    os << "  object = " << msg.object << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    
+    os << "[NM_DDM_Register_Object - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Subscribe_Attributes::NM_DDM_Subscribe_Attributes()
+{
+    this->messageName = "NM_DDM_Subscribe_Attributes";
+    this->type = NetworkMessage::Type::DDM_SUBSCRIBE_ATTRIBUTES;
+}
+
+void NM_DDM_Subscribe_Attributes::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(objectClass);
+    msgBuffer.write_uint32(region);
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_bool(DDM_bool);
+}
+
+void NM_DDM_Subscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    DDM_bool = msgBuffer.read_bool();
+}
+
+const ObjectClassHandle& NM_DDM_Subscribe_Attributes::getObjectClass() const
+{
+    return objectClass;
+}
+
+void NM_DDM_Subscribe_Attributes::setObjectClass(const ObjectClassHandle& newObjectClass)
+{
+    objectClass = newObjectClass;
+}
+
+const RegionHandle& NM_DDM_Subscribe_Attributes::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Subscribe_Attributes::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+uint32_t NM_DDM_Subscribe_Attributes::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_DDM_Subscribe_Attributes::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_DDM_Subscribe_Attributes::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_DDM_Subscribe_Attributes::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_DDM_Subscribe_Attributes::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_DDM_Subscribe_Attributes::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_DDM_Subscribe_Attributes::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+const bool& NM_DDM_Subscribe_Attributes::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Subscribe_Attributes::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Subscribe_Attributes& msg)
+{
+    os << "[NM_DDM_Subscribe_Attributes - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Subscribe_Attributes::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objectClass = " << msg.objectClass << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    
+    os << "[NM_DDM_Subscribe_Attributes - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Unsubscribe_Attributes::NM_DDM_Unsubscribe_Attributes()
+{
+    this->messageName = "NM_DDM_Unsubscribe_Attributes";
+    this->type = NetworkMessage::Type::DDM_UNSUBSCRIBE_ATTRIBUTES;
+}
+
+void NM_DDM_Unsubscribe_Attributes::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(objectClass);
+    msgBuffer.write_uint32(region);
+    uint32_t attributesSize = attributes.size();
+    msgBuffer.write_uint32(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        msgBuffer.write_uint32(attributes[i]);
+    }
+    msgBuffer.write_bool(DDM_bool);
+}
+
+void NM_DDM_Unsubscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    uint32_t attributesSize = msgBuffer.read_uint32();
+    attributes.resize(attributesSize);
+    for (uint32_t i = 0; i < attributesSize; ++i) {
+        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
+    }
+    DDM_bool = msgBuffer.read_bool();
+}
+
+const ObjectClassHandle& NM_DDM_Unsubscribe_Attributes::getObjectClass() const
+{
+    return objectClass;
+}
+
+void NM_DDM_Unsubscribe_Attributes::setObjectClass(const ObjectClassHandle& newObjectClass)
+{
+    objectClass = newObjectClass;
+}
+
+const RegionHandle& NM_DDM_Unsubscribe_Attributes::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Unsubscribe_Attributes::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+uint32_t NM_DDM_Unsubscribe_Attributes::getAttributesSize() const
+{
+    return attributes.size();
+}
+
+void NM_DDM_Unsubscribe_Attributes::setAttributesSize(uint32_t num)
+{
+    attributes.resize(num);
+}
+
+const std::vector<AttributeHandle>& NM_DDM_Unsubscribe_Attributes::getAttributes() const
+{
+    return attributes;
+}
+
+const AttributeHandle& NM_DDM_Unsubscribe_Attributes::getAttributes(uint32_t rank) const
+{
+    return attributes[rank];
+}
+
+AttributeHandle& NM_DDM_Unsubscribe_Attributes::getAttributes(uint32_t rank)
+{
+    return attributes[rank];
+}
+
+void NM_DDM_Unsubscribe_Attributes::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+{
+    attributes[rank] = newAttributes;
+}
+
+void NM_DDM_Unsubscribe_Attributes::removeAttributes(uint32_t rank)
+{
+    attributes.erase(attributes.begin() + rank);
+}
+
+const bool& NM_DDM_Unsubscribe_Attributes::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Unsubscribe_Attributes::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Unsubscribe_Attributes& msg)
+{
+    os << "[NM_DDM_Unsubscribe_Attributes - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Unsubscribe_Attributes::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objectClass = " << msg.objectClass << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  attributes [] =" << std::endl;
+    for (const auto& element : msg.attributes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    
+    os << "[NM_DDM_Unsubscribe_Attributes - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Subscribe_Interaction::NM_DDM_Subscribe_Interaction()
+{
+    this->messageName = "NM_DDM_Subscribe_Interaction";
+    this->type = NetworkMessage::Type::DDM_SUBSCRIBE_INTERACTION;
+}
+
+void NM_DDM_Subscribe_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(interactionClass);
+    msgBuffer.write_uint32(region);
+    msgBuffer.write_bool(DDM_bool);
+}
+
+void NM_DDM_Subscribe_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    DDM_bool = msgBuffer.read_bool();
+}
+
+const InteractionClassHandle& NM_DDM_Subscribe_Interaction::getInteractionClass() const
+{
+    return interactionClass;
+}
+
+void NM_DDM_Subscribe_Interaction::setInteractionClass(const InteractionClassHandle& newInteractionClass)
+{
+    interactionClass = newInteractionClass;
+}
+
+const RegionHandle& NM_DDM_Subscribe_Interaction::getRegion() const
+{
+    return region;
+}
+
+void NM_DDM_Subscribe_Interaction::setRegion(const RegionHandle& newRegion)
+{
+    region = newRegion;
+}
+
+const bool& NM_DDM_Subscribe_Interaction::getDDM_bool() const
+{
+    return DDM_bool;
+}
+
+void NM_DDM_Subscribe_Interaction::setDDM_bool(const bool& newDDM_bool)
+{
+    DDM_bool = newDDM_bool;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Subscribe_Interaction& msg)
+{
+    os << "[NM_DDM_Subscribe_Interaction - Begin]" << std::endl;
+    
+    os << static_cast<const NM_DDM_Subscribe_Interaction::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  interactionClass = " << msg.interactionClass << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
+    
+    os << "[NM_DDM_Subscribe_Interaction - End]" << std::endl;
+    return os;
+}
+
+NM_DDM_Unsubscribe_Interaction::NM_DDM_Unsubscribe_Interaction()
+{
+    this->messageName = "NM_DDM_Unsubscribe_Interaction";
+    this->type = NetworkMessage::Type::DDM_UNSUBSCRIBE_INTERACTION;
+}
+
+NM_Provide_Attribute_Value_Update::NM_Provide_Attribute_Value_Update()
+{
+    this->messageName = "NM_Provide_Attribute_Value_Update";
+    this->type = NetworkMessage::Type::PROVIDE_ATTRIBUTE_VALUE_UPDATE;
+}
+
+NM_Start_Registration_For_Object_Class::NM_Start_Registration_For_Object_Class()
+{
+    this->messageName = "NM_Start_Registration_For_Object_Class";
+    this->type = NetworkMessage::Type::START_REGISTRATION_FOR_OBJECT_CLASS;
+}
+
+void NM_Start_Registration_For_Object_Class::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(objectClass);
+}
+
+void NM_Start_Registration_For_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+}
+
+const ObjectClassHandle& NM_Start_Registration_For_Object_Class::getObjectClass() const
+{
+    return objectClass;
+}
+
+void NM_Start_Registration_For_Object_Class::setObjectClass(const ObjectClassHandle& newObjectClass)
+{
+    objectClass = newObjectClass;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Start_Registration_For_Object_Class& msg)
+{
+    os << "[NM_Start_Registration_For_Object_Class - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Start_Registration_For_Object_Class::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objectClass = " << msg.objectClass << std::endl;
+    
+    os << "[NM_Start_Registration_For_Object_Class - End]" << std::endl;
+    return os;
+}
+
+NM_Stop_Registration_For_Object_Class::NM_Stop_Registration_For_Object_Class()
+{
+    this->messageName = "NM_Stop_Registration_For_Object_Class";
+    this->type = NetworkMessage::Type::STOP_REGISTRATION_FOR_OBJECT_CLASS;
+}
+
+void NM_Stop_Registration_For_Object_Class::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(objectClass);
+}
+
+void NM_Stop_Registration_For_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+}
+
+const ObjectClassHandle& NM_Stop_Registration_For_Object_Class::getObjectClass() const
+{
+    return objectClass;
+}
+
+void NM_Stop_Registration_For_Object_Class::setObjectClass(const ObjectClassHandle& newObjectClass)
+{
+    objectClass = newObjectClass;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Stop_Registration_For_Object_Class& msg)
+{
+    os << "[NM_Stop_Registration_For_Object_Class - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Stop_Registration_For_Object_Class::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objectClass = " << msg.objectClass << std::endl;
+    
+    os << "[NM_Stop_Registration_For_Object_Class - End]" << std::endl;
+    return os;
+}
+
+NM_Reserve_Object_Instance_Name::NM_Reserve_Object_Instance_Name()
+{
+    this->messageName = "NM_Reserve_Object_Instance_Name";
+    this->type = NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME;
+}
+
+void NM_Reserve_Object_Instance_Name::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_string(objectName);
+}
+
+void NM_Reserve_Object_Instance_Name::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    msgBuffer.read_string(objectName);
+}
+
+const std::string& NM_Reserve_Object_Instance_Name::getObjectName() const
+{
+    return objectName;
+}
+
+void NM_Reserve_Object_Instance_Name::setObjectName(const std::string& newObjectName)
+{
+    objectName = newObjectName;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Reserve_Object_Instance_Name& msg)
+{
+    os << "[NM_Reserve_Object_Instance_Name - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Reserve_Object_Instance_Name::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  objectName = " << msg.objectName << std::endl;
+    
+    os << "[NM_Reserve_Object_Instance_Name - End]" << std::endl;
+    return os;
+}
+
+NM_Reserve_Object_Instance_Name_Succeeded::NM_Reserve_Object_Instance_Name_Succeeded()
+{
+    this->messageName = "NM_Reserve_Object_Instance_Name_Succeeded";
+    this->type = NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME_SUCCEEDED;
+}
+
+NM_Reserve_Object_Instance_Name_Failed::NM_Reserve_Object_Instance_Name_Failed()
+{
+    this->messageName = "NM_Reserve_Object_Instance_Name_Failed";
+    this->type = NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME_FAILED;
+}
+
+NM_Message_Null_Prime::NM_Message_Null_Prime()
+{
+    this->messageName = "NM_Message_Null_Prime";
+    this->type = NetworkMessage::Type::MESSAGE_NULL_PRIME;
+}
+
+void NM_Message_Null_Prime::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    // FIXME FIXME FIXME
+    //don't know how to serialize native field <timestamp> of type <FederationTime>
+    //probably no 'representation' given
+}
+
+void NM_Message_Null_Prime::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    // FIXME FIXME FIXME
+    //don't know how to deserialize native field <timestamp> of type <FederationTime>
+    //probably no 'representation' given
+}
+
+const FederationTime& NM_Message_Null_Prime::getTimestamp() const
+{
+    return timestamp;
+}
+
+void NM_Message_Null_Prime::setTimestamp(const FederationTime& newTimestamp)
+{
+    timestamp = newTimestamp;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Message_Null_Prime& msg)
+{
+    os << "[NM_Message_Null_Prime - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Message_Null_Prime::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  timestamp = " << "// TODO field <timestamp> of type <FederationTime>" << std::endl;
+    
+    os << "[NM_Message_Null_Prime - End]" << std::endl;
+    return os;
+}
+
+NM_Enable_Asynchronous_Delivery::NM_Enable_Asynchronous_Delivery()
+{
+    this->messageName = "NM_Enable_Asynchronous_Delivery";
+    this->type = NetworkMessage::Type::ENABLE_ASYNCHRONOUS_DELIVERY;
+}
+
+NM_Disable_Asynchronous_Delivery::NM_Disable_Asynchronous_Delivery()
+{
+    this->messageName = "NM_Disable_Asynchronous_Delivery";
+    this->type = NetworkMessage::Type::DISABLE_ASYNCHRONOUS_DELIVERY;
+}
+
+NM_Time_Advance_Request::NM_Time_Advance_Request()
+{
+    this->messageName = "NM_Time_Advance_Request";
+    this->type = NetworkMessage::Type::TIME_ADVANCE_REQUEST;
+}
+
+NM_Time_Advance_Request_Available::NM_Time_Advance_Request_Available()
+{
+    this->messageName = "NM_Time_Advance_Request_Available";
+    this->type = NetworkMessage::Type::TIME_ADVANCE_REQUEST_AVAILABLE;
+}
+
+NM_Next_Message_Request::NM_Next_Message_Request()
+{
+    this->messageName = "NM_Next_Message_Request";
+    this->type = NetworkMessage::Type::NEXT_MESSAGE_REQUEST;
+}
+
+NM_Next_Message_Request_Available::NM_Next_Message_Request_Available()
+{
+    this->messageName = "NM_Next_Message_Request_Available";
+    this->type = NetworkMessage::Type::NEXT_MESSAGE_REQUEST_AVAILABLE;
+}
+
+NM_Mom_Status::NM_Mom_Status()
+{
+    this->messageName = "NM_Mom_Status";
+    this->type = NetworkMessage::Type::MOM_STATUS;
+}
+
+void NM_Mom_Status::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_bool(momState);
+    msgBuffer.write_uint32(updatePeriod);
+}
+
+void NM_Mom_Status::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    momState = msgBuffer.read_bool();
+    updatePeriod = msgBuffer.read_uint32();
+}
+
+const bool& NM_Mom_Status::getMomState() const
+{
+    return momState;
+}
+
+void NM_Mom_Status::setMomState(const bool& newMomState)
+{
+    momState = newMomState;
+}
+
+const uint32_t& NM_Mom_Status::getUpdatePeriod() const
+{
+    return updatePeriod;
+}
+
+void NM_Mom_Status::setUpdatePeriod(const uint32_t& newUpdatePeriod)
+{
+    updatePeriod = newUpdatePeriod;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Mom_Status& msg)
+{
+    os << "[NM_Mom_Status - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Mom_Status::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  momState = " << msg.momState << std::endl;
+    os << "  updatePeriod = " << msg.updatePeriod << std::endl;
+    
+    os << "[NM_Mom_Status - End]" << std::endl;
+    return os;
+}
+
+NM_Time_State_Update::NM_Time_State_Update()
+{
+    this->messageName = "NM_Time_State_Update";
+    this->type = NetworkMessage::Type::TIME_STATE_UPDATE;
+}
+
+void NM_Time_State_Update::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_double(lookahead);
+    msgBuffer.write_bool(state);
+    msgBuffer.write_double(galt);
+    msgBuffer.write_double(lits);
+}
+
+void NM_Time_State_Update::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    lookahead = msgBuffer.read_double();
+    state = msgBuffer.read_bool();
+    galt = msgBuffer.read_double();
+    lits = msgBuffer.read_double();
+}
+
+const double& NM_Time_State_Update::getLookahead() const
+{
+    return lookahead;
+}
+
+void NM_Time_State_Update::setLookahead(const double& newLookahead)
+{
+    lookahead = newLookahead;
+}
+
+const bool& NM_Time_State_Update::getState() const
+{
+    return state;
+}
+
+void NM_Time_State_Update::setState(const bool& newState)
+{
+    state = newState;
+}
+
+const double& NM_Time_State_Update::getGalt() const
+{
+    return galt;
+}
+
+void NM_Time_State_Update::setGalt(const double& newGalt)
+{
+    galt = newGalt;
+}
+
+const double& NM_Time_State_Update::getLits() const
+{
+    return lits;
+}
+
+void NM_Time_State_Update::setLits(const double& newLits)
+{
+    lits = newLits;
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg)
+{
+    os << "[NM_Time_State_Update - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Time_State_Update::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  lookahead = " << msg.lookahead << std::endl;
+    os << "  state = " << msg.state << std::endl;
+    os << "  galt = " << msg.galt << std::endl;
+    os << "  lits = " << msg.lits << std::endl;
+    
+    os << "[NM_Time_State_Update - End]" << std::endl;
+    return os;
+}
+
+NM_Peer_Route::NM_Peer_Route()
+{
+    this->messageName = "NM_Peer_Route";
+    this->type = NetworkMessage::Type::PEER_ROUTE;
+}
+
+void NM_Peer_Route::serialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(object);
+    msgBuffer.write_uint32(interactionClass);
+    msgBuffer.write_uint32(region);
+    uint32_t keysSize = keys.size();
+    msgBuffer.write_uint32(keysSize);
+    for (uint32_t i = 0; i < keysSize; ++i) {
+        msgBuffer.write_uint32(keys[i]);
+    }
+    uint32_t classesSize = classes.size();
+    msgBuffer.write_uint32(classesSize);
+    for (uint32_t i = 0; i < classesSize; ++i) {
+        msgBuffer.write_uint32(classes[i]);
+    }
+    uint32_t handleCountsSize = handleCounts.size();
+    msgBuffer.write_uint32(handleCountsSize);
+    for (uint32_t i = 0; i < handleCountsSize; ++i) {
+        msgBuffer.write_uint32(handleCounts[i]);
+    }
+    uint32_t handlesSize = handles.size();
+    msgBuffer.write_uint32(handlesSize);
+    for (uint32_t i = 0; i < handlesSize; ++i) {
+        msgBuffer.write_uint32(handles[i]);
+    }
+    uint32_t endpointCountsSize = endpointCounts.size();
+    msgBuffer.write_uint32(endpointCountsSize);
+    for (uint32_t i = 0; i < endpointCountsSize; ++i) {
+        msgBuffer.write_uint32(endpointCounts[i]);
+    }
+    uint32_t federatesSize = federates.size();
+    msgBuffer.write_uint32(federatesSize);
+    for (uint32_t i = 0; i < federatesSize; ++i) {
+        msgBuffer.write_uint32(federates[i]);
+    }
+    uint32_t addressesSize = addresses.size();
+    msgBuffer.write_uint32(addressesSize);
+    for (uint32_t i = 0; i < addressesSize; ++i) {
+        msgBuffer.write_uint32(addresses[i]);
+    }
+    uint32_t portsSize = ports.size();
+    msgBuffer.write_uint32(portsSize);
+    for (uint32_t i = 0; i < portsSize; ++i) {
+        msgBuffer.write_uint32(ports[i]);
+    }
+}
+
+void NM_Peer_Route::deserialize(libhla::MessageBuffer& msgBuffer)
+{
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    object = static_cast<ObjectHandle>(msgBuffer.read_uint32());
+    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
+    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
+    uint32_t keysSize = msgBuffer.read_uint32();
+    keys.resize(keysSize);
+    for (uint32_t i = 0; i < keysSize; ++i) {
+        keys[i] = msgBuffer.read_uint32();
+    }
+    uint32_t classesSize = msgBuffer.read_uint32();
+    classes.resize(classesSize);
+    for (uint32_t i = 0; i < classesSize; ++i) {
+        classes[i] = msgBuffer.read_uint32();
+    }
+    uint32_t handleCountsSize = msgBuffer.read_uint32();
+    handleCounts.resize(handleCountsSize);
+    for (uint32_t i = 0; i < handleCountsSize; ++i) {
+        handleCounts[i] = msgBuffer.read_uint32();
+    }
+    uint32_t handlesSize = msgBuffer.read_uint32();
+    handles.resize(handlesSize);
+    for (uint32_t i = 0; i < handlesSize; ++i) {
+        handles[i] = msgBuffer.read_uint32();
+    }
+    uint32_t endpointCountsSize = msgBuffer.read_uint32();
+    endpointCounts.resize(endpointCountsSize);
+    for (uint32_t i = 0; i < endpointCountsSize; ++i) {
+        endpointCounts[i] = msgBuffer.read_uint32();
+    }
+    uint32_t federatesSize = msgBuffer.read_uint32();
+    federates.resize(federatesSize);
+    for (uint32_t i = 0; i < federatesSize; ++i) {
+        federates[i] = static_cast<FederateHandle>(msgBuffer.read_uint32());
+    }
+    uint32_t addressesSize = msgBuffer.read_uint32();
+    addresses.resize(addressesSize);
+    for (uint32_t i = 0; i < addressesSize; ++i) {
+        addresses[i] = msgBuffer.read_uint32();
+    }
+    uint32_t portsSize = msgBuffer.read_uint32();
+    ports.resize(portsSize);
+    for (uint32_t i = 0; i < portsSize; ++i) {
+        ports[i] = msgBuffer.read_uint32();
+    }
+}
+
+const ObjectHandle& NM_Peer_Route::getObject() const
+{
+    return object;
+}
+
+void NM_Peer_Route::setObject(const ObjectHandle& newObject)
+{
+    object = newObject;
+}
+
+const InteractionClassHandle& NM_Peer_Route::getInteractionClass() const
+{
+    return interactionClass;
+}
+
+void NM_Peer_Route::setInteractionClass(const InteractionClassHandle& newInteractionClass)
+{
+    interactionClass = newInteractionClass;
 }
 
-uint32_t NM_DDM_Register_Object::getAttributesSize() const
+const RegionHandle& NM_Peer_Route::getRegion() const
 {
-    return attributes.size();
+    return region;
 }
 
-void NM_DDM_Register_Object::setAttributesSize(uint32_t num)
+void NM_Peer_Route::setRegion(const RegionHandle& newRegion)
 {
-    attributes.resize(num);
+    region = newRegion;
 }
 
-const std::vector<AttributeHandle>& NM_DDM_Register_Object::getAttributes() const
+uint32_t NM_Peer_Route::getKeysSize() const
 {
-    return attributes;
+    return keys.size();
 }
 
-const AttributeHandle& NM_DDM_Register_Object::getAttributes(uint32_t rank) const
+void NM_Peer_Route::setKeysSize(uint32_t num)
 {
-    return attributes[rank];
+    keys.resize(num);
 }
 
-AttributeHandle& NM_DDM_Register_Object::getAttributes(uint32_t rank)
+const std::vector<uint32_t>& NM_Peer_Route::getKeys() const
 {
-    return attributes[rank];
+    return keys;
 }
 
-void NM_DDM_Register_Object::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+const uint32_t& NM_Peer_Route::getKeys(uint32_t rank) const
 {
-    attributes[rank] = newAttributes;
+    return keys[rank];
 }
 
-void NM_DDM_Register_Object::removeAttributes(uint32_t rank)
+uint32_t& NM_Peer_Route::getKeys(uint32_t rank)
 {
-    attributes.erase(attributes.begin() + rank);
+    return keys[rank];
 }
 
-const RegionHandle& NM_DDM_Register_Object::getRegion() const
+void NM_Peer_Route::setKeys(const uint32_t& newKeys, uint32_t rank)
 {
-    return region;
+    keys[rank] = newKeys;
 }
 
-void NM_DDM_Register_Object::setRegion(const RegionHandle& newRegion)
+void NM_Peer_Route::removeKeys(uint32_t rank)
 {
-    region = newRegion;
+    keys.erase(keys.begin() + rank);
 }
 
-const std::string& NM_DDM_Register_Object::getObjectInstanceName() const
+uint32_t NM_Peer_Route::getClassesSize() const
 {
-    return objectInstanceName;
+    return classes.size();
 }
 
-void NM_DDM_Register_Object::setObjectInstanceName(const std::string& newObjectInstanceName)
+void NM_Peer_Route::setClassesSize(uint32_t num)
 {
-    _hasObjectInstanceName = true;
-    objectInstanceName = newObjectInstanceName;
+    classes.resize(num);
 }
 
-bool NM_DDM_Register_Object::hasObjectInstanceName() const
+const std::vector<uint32_t>& NM_Peer_Route::getClasses() const
 {
-    return _hasObjectInstanceName;
+    return classes;
 }
 
-const ObjectHandle& NM_DDM_Register_Object::getObject() const
+const uint32_t& NM_Peer_Route::getClasses(uint32_t rank) const
 {
-    return object;
+    return classes[rank];
 }
 
-void NM_DDM_Register_Object::setObject(const ObjectHandle& newObject)
+uint32_t& NM_Peer_Route::getClasses(uint32_t rank)
 {
-    object = newObject;
+    return classes[rank];
 }
 
-const bool& NM_DDM_Register_Object::getDDM_bool() const
+void NM_Peer_Route::setClasses(const uint32_t& newClasses, uint32_t rank)
 {
-    return DDM_bool;
+    classes[rank] = newClasses;
 }
 
-void NM_DDM_Register_Object::setDDM_bool(const bool& newDDM_bool)
+void NM_Peer_Route::removeClasses(uint32_t rank)
 {
-    DDM_bool = newDDM_bool;
+    classes.erase(classes.begin() + rank);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Register_Object& msg)
+uint32_t NM_Peer_Route::getHandleCountsSize() const
 {
-    os << "[NM_DDM_Register_Object - Begin]" << std::endl;
-    
-    os << static_cast<const NM_DDM_Register_Object::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  objectClass = " << msg.objectClass << std::endl;
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
-        os << element;
-    }
-    os << std::endl;
-    os << "  region = " << msg.region << std::endl;
-    os << "  (opt) objectInstanceName =" << msg.objectInstanceName << std::endl;
-    os << "  object = " << msg.object << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    
-    os << "[NM_DDM_Register_Object - End]" << std::endl;
-    return os;
+    return handleCounts.size();
 }
 
-NM_DDM_Subscribe_Attributes::NM_DDM_Subscribe_Attributes()
+void NM_Peer_Route::setHandleCountsSize(uint32_t num)
 {
-    this->messageName = "NM_DDM_Subscribe_Attributes";
-    this->type = NetworkMessage::Type::DDM_SUBSCRIBE_ATTRIBUTES;
+    handleCounts.resize(num);
 }
 
-void NM_DDM_Subscribe_Attributes::serialize(libhla::MessageBuffer& msgBuffer)
+const std::vector<uint32_t>& NM_Peer_Route::getHandleCounts() const
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(objectClass);
-    msgBuffer.write_uint32(region);
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
-    msgBuffer.write_bool(DDM_bool);
+    return handleCounts;
 }
 
-void NM_DDM_Subscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
+const uint32_t& NM_Peer_Route::getHandleCounts(uint32_t rank) const
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
-    DDM_bool = msgBuffer.read_bool();
+    return handleCounts[rank];
 }
 
-const ObjectClassHandle& NM_DDM_Subscribe_Attributes::getObjectClass() const
+uint32_t& NM_Peer_Route::getHandleCounts(uint32_t rank)
 {
-    return objectClass;
+    return handleCounts[rank];
 }
 
-void NM_DDM_Subscribe_Attributes::setObjectClass(const ObjectClassHandle& newObjectClass)
+void NM_Peer_Route::setHandleCounts(const uint32_t& newHandleCounts, uint32_t rank)
 {
-    objectClass = newObjectClass;
+    handleCounts[rank] = newHandleCounts;
 }
 
-const RegionHandle& NM_DDM_Subscribe_Attributes::getRegion() const
+void NM_Peer_Route::removeHandleCounts(uint32_t rank)
 {
-    return region;
+    handleCounts.erase(handleCounts.begin() + rank);
 }
 
-void NM_DDM_Subscribe_Attributes::setRegion(const RegionHandle& newRegion)
+uint32_t NM_Peer_Route::getHandlesSize() const
 {
-    region = newRegion;
+    return handles.size();
 }
 
-uint32_t NM_DDM_Subscribe_Attributes::getAttributesSize() const
+void NM_Peer_Route::setHandlesSize(uint32_t num)
 {
-    return attributes.size();
+    handles.resize(num);
 }
 
-void NM_DDM_Subscribe_Attributes::setAttributesSize(uint32_t num)
+const std::vector<uint32_t>& NM_Peer_Route::getHandles() const
 {
-    attributes.resize(num);
+    return handles;
 }
 
-const std::vector<AttributeHandle>& NM_DDM_Subscribe_Attributes::getAttributes() const
+const uint32_t& NM_Peer_Route::getHandles(uint32_t rank) const
 {
-    return attributes;
+    return handles[rank];
 }
 
-const AttributeHandle& NM_DDM_Subscribe_Attributes::getAttributes(uint32_t rank) const
+uint32_t& NM_Peer_Route::getHandles(uint32_t rank)
 {
-    return attributes[rank];
+    return handles[rank];
 }
 
-AttributeHandle& NM_DDM_Subscribe_Attributes::getAttributes(uint32_t rank)
+void NM_Peer_Route::setHandles(const uint32_t& newHandles, uint32_t rank)
 {
-    return attributes[rank];
+    handles[rank] = newHandles;
 }
 
-void NM_DDM_Subscribe_Attributes::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+void NM_Peer_Route::removeHandles(uint32_t rank)
 {
-    attributes[rank] = newAttributes;
+    handles.erase(handles.begin() + rank);
 }
 
-void NM_DDM_Subscribe_Attributes::removeAttributes(uint32_t rank)
+uint32_t NM_Peer_Route::getEndpointCountsSize() const
 {
-    attributes.erase(attributes.begin() + rank);
+    return endpointCounts.size();
 }
 
-const bool& NM_DDM_Subscribe_Attributes::getDDM_bool() const
+void NM_Peer_Route::setEndpointCountsSize(uint32_t num)
 {
-    return DDM_bool;
+    endpointCounts.resize(num);
 }
 
-void NM_DDM_Subscribe_Attributes::setDDM_bool(const bool& newDDM_bool)
+const std::vector<uint32_t>& NM_Peer_Route::getEndpointCounts() const
 {
-    DDM_bool = newDDM_bool;
+    return endpointCounts;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Subscribe_Attributes& msg)
+const uint32_t& NM_Peer_Route::getEndpointCounts(uint32_t rank) const
 {
-    os << "[NM_DDM_Subscribe_Attributes - Begin]" << std::endl;
-    
-    os << static_cast<const NM_DDM_Subscribe_Attributes::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  objectClass = " << msg.objectClass << std::endl;
-    os << "  region = " << msg.region << std::endl;
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
-        os << element;
-    }
-    os << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    
-    os << "[NM_DDM_Subscribe_Attributes - End]" << std::endl;
-    return os;
+    return endpointCounts[rank];
 }
 
-NM_DDM_Unsubscribe_Attributes::NM_DDM_Unsubscribe_Attributes()
+uint32_t& NM_Peer_Route::getEndpointCounts(uint32_t rank)
 {
-    this->messageName = "NM_DDM_Unsubscribe_Attributes";
-    this->type = NetworkMessage::Type::DDM_UNSUBSCRIBE_ATTRIBUTES;
+    return endpointCounts[rank];
 }
 
-void NM_DDM_Unsubscribe_Attributes::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Peer_Route::setEndpointCounts(const uint32_t& newEndpointCounts, uint32_t rank)
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(objectClass);
-    msgBuffer.write_uint32(region);
-    uint32_t attributesSize = attributes.size();
-    msgBuffer.write_uint32(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        msgBuffer.write_uint32(attributes[i]);
-    }
-    msgBuffer.write_bool(DDM_bool);
+    endpointCounts[rank] = newEndpointCounts;
 }
 
-void NM_DDM_Unsubscribe_Attributes::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Peer_Route::removeEndpointCounts(uint32_t rank)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    uint32_t attributesSize = msgBuffer.read_uint32();
-    attributes.resize(attributesSize);
-    for (uint32_t i = 0; i < attributesSize; ++i) {
-        attributes[i] = static_cast<AttributeHandle>(msgBuffer.read_uint32());
-    }
-    DDM_bool = msgBuffer.read_bool();
+    endpointCounts.erase(endpointCounts.begin() + rank);
 }
 
-const ObjectClassHandle& NM_DDM_Unsubscribe_Attributes::getObjectClass() const
+uint32_t NM_Peer_Route::getFederatesSize() const
 {
-    return objectClass;
+    return federates.size();
 }
 
-void NM_DDM_Unsubscribe_Attributes::setObjectClass(const ObjectClassHandle& newObjectClass)
+void NM_Peer_Route::setFederatesSize(uint32_t num)
 {
-    objectClass = newObjectClass;
+    federates.resize(num);
 }
 
-const RegionHandle& NM_DDM_Unsubscribe_Attributes::getRegion() const
+const std::vector<FederateHandle>& NM_Peer_Route::getFederates() const
 {
-    return region;
+    return federates;
 }
 
-void NM_DDM_Unsubscribe_Attributes::setRegion(const RegionHandle& newRegion)
+const FederateHandle& NM_Peer_Route::getFederates(uint32_t rank) const
 {
-    region = newRegion;
+    return federates[rank];
 }
 
-uint32_t NM_DDM_Unsubscribe_Attributes::getAttributesSize() const
+FederateHandle& NM_Peer_Route::getFederates(uint32_t rank)
 {
-    return attributes.size();
+    return federates[rank];
 }
 
-void NM_DDM_Unsubscribe_Attributes::setAttributesSize(uint32_t num)
+void NM_Peer_Route::setFederates(const FederateHandle& newFederates, uint32_t rank)
 {
-    attributes.resize(num);
+    federates[rank] = newFederates;
 }
 
-const std::vector<AttributeHandle>& NM_DDM_Unsubscribe_Attributes::getAttributes() const
+void NM_Peer_Route::removeFederates(uint32_t rank)
 {
-    return attributes;
+    federates.erase(federates.begin() + rank);
 }
 
-const AttributeHandle& NM_DDM_Unsubscribe_Attributes::getAttributes(uint32_t rank) const
+uint32_t NM_Peer_Route::getAddressesSize() const
 {
-    return attributes[rank];
+    return addresses.size();
 }
 
-AttributeHandle& NM_DDM_Unsubscribe_Attributes::getAttributes(uint32_t rank)
+void NM_Peer_Route::setAddressesSize(uint32_t num)
 {
-    return attributes[rank];
+    addresses.resize(num);
 }
 
-void NM_DDM_Unsubscribe_Attributes::setAttributes(const AttributeHandle& newAttributes, uint32_t rank)
+const std::vector<uint32_t>& NM_Peer_Route::getAddresses() const
 {
-    attributes[rank] = newAttributes;
+    return addresses;
 }
 
-void NM_DDM_Unsubscribe_Attributes::removeAttributes(uint32_t rank)
+const uint32_t& NM_Peer_Route::getAddresses(uint32_t rank) const
 {
-    attributes.erase(attributes.begin() + rank);
+    return addresses[rank];
 }
 
-const bool& NM_DDM_Unsubscribe_Attributes::getDDM_bool() const
+uint32_t& NM_Peer_Route::getAddresses(uint32_t rank)
 {
-    return DDM_bool;
+    return addresses[rank];
 }
 
-void NM_DDM_Unsubscribe_Attributes::setDDM_bool(const bool& newDDM_bool)
+void NM_Peer_Route::setAddresses(const uint32_t& newAddresses, uint32_t rank)
 {
-    DDM_bool = newDDM_bool;
+    addresses[rank] = newAddresses;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Unsubscribe_Attributes& msg)
+void NM_Peer_Route::removeAddresses(uint32_t rank)
 {
-    os << "[NM_DDM_Unsubscribe_Attributes - Begin]" << std::endl;
-    
-    os << static_cast<const NM_DDM_Unsubscribe_Attributes::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  objectClass = " << msg.objectClass << std::endl;
-    os << "  region = " << msg.region << std::endl;
-    os << "  attributes [] =" << std::endl;
-    for (const auto& element : msg.attributes) {
-        os << element;
-    }
-    os << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    
-    os << "[NM_DDM_Unsubscribe_Attributes - End]" << std::endl;
-    return os;
+    addresses.erase(addresses.begin() + rank);
 }
 
-NM_DDM_Subscribe_Interaction::NM_DDM_Subscribe_Interaction()
+uint32_t NM_Peer_Route::getPortsSize() const
 {
-    this->messageName = "NM_DDM_Subscribe_Interaction";
-    this->type = NetworkMessage::Type::DDM_SUBSCRIBE_INTERACTION;
+    return ports.size();
 }
 
-void NM_DDM_Subscribe_Interaction::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Peer_Route::setPortsSize(uint32_t num)
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(interactionClass);
-    msgBuffer.write_uint32(region);
-    msgBuffer.write_bool(DDM_bool);
+    ports.resize(num);
 }
 
-void NM_DDM_Subscribe_Interaction::deserialize(libhla::MessageBuffer& msgBuffer)
+const std::vector<uint32_t>& NM_Peer_Route::getPorts() const
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    interactionClass = static_cast<InteractionClassHandle>(msgBuffer.read_uint32());
-    region = static_cast<RegionHandle>(msgBuffer.read_uint32());
-    DDM_bool = msgBuffer.read_bool();
+    return ports;
 }
 
-const InteractionClassHandle& NM_DDM_Subscribe_Interaction::getInteractionClass() const
+const uint32_t& NM_Peer_Route::getPorts(uint32_t rank) const
 {
-    return interactionClass;
+    return ports[rank];
 }
 
-void NM_DDM_Subscribe_Interaction::setInteractionClass(const InteractionClassHandle& newInteractionClass)
+uint32_t& NM_Peer_Route::getPorts(uint32_t rank)
 {
-    interactionClass = newInteractionClass;
+    return ports[rank];
 }
 
-const RegionHandle& NM_DDM_Subscribe_Interaction::getRegion() const
+void NM_Peer_Route::setPorts(const uint32_t& newPorts, uint32_t rank)
 {
-    return region;
+    ports[rank] = newPorts;
 }
 
-void NM_DDM_Subscribe_Interaction::setRegion(const RegionHandle& newRegion)
+void NM_Peer_Route::removePorts(uint32_t rank)
 {
-    region = newRegion;
+    ports.erase(ports.begin() + rank);
 }
 
-const bool& NM_DDM_Subscribe_Interaction::getDDM_bool() const
+std::ostream& operator<<(std::ostream& os, const NM_Peer_Route& msg)
 {
-    return DDM_bool;
+    os << "[NM_Peer_Route - Begin]" << std::endl;
+    
+    os << static_cast<const NM_Peer_Route::Super&>(msg); // show parent class
+    
+    // Specific display
+    os << "  object = " << msg.object << std::endl;
+    os << "  interactionClass = " << msg.interactionClass << std::endl;
+    os << "  region = " << msg.region << std::endl;
+    os << "  keys [] =" << std::endl;
+    for (const auto& element : msg.keys) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  classes [] =" << std::endl;
+    for (const auto& element : msg.classes) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  handleCounts [] =" << std::endl;
+    for (const auto& element : msg.handleCounts) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  handles [] =" << std::endl;
+    for (const auto& element : msg.handles) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  endpointCounts [] =" << std::endl;
+    for (const auto& element : msg.endpointCounts) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  federates [] =" << std::endl;
+    for (const auto& element : msg.federates) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  addresses [] =" << std::endl;
+    for (const auto& element : msg.addresses) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  ports [] =" << std::endl;
+    for (const auto& element : msg.ports) {
+        os << element;
+    }
+    os << std::endl;
+    
+    os << "[NM_Peer_Route - End]" << std::endl;
+    return os;
 }
 
-void NM_DDM_Subscribe_Interaction::setDDM_bool(const bool& newDDM_bool)
+NM_Peer_Routes_Invalidated::NM_Peer_Routes_Invalidated()
 {
-    DDM_bool = newDDM_bool;
+    this->messageName = "NM_Peer_Routes_Invalidated";
+    this->type = NetworkMessage::Type::PEER_ROUTES_INVALIDATED;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_DDM_Subscribe_Interaction& msg)
+NM_Peer_Fence::NM_Peer_Fence()
 {
-    os << "[NM_DDM_Subscribe_Interaction - Begin]" << std::endl;
-    
-    os << static_cast<const NM_DDM_Subscribe_Interaction::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  interactionClass = " << msg.interactionClass << std::endl;
-    os << "  region = " << msg.region << std::endl;
-    os << "  DDM_bool = " << msg.DDM_bool << std::endl;
-    
-    os << "[NM_DDM_Subscribe_Interaction - End]" << std::endl;
-    return os;
+    this->messageName = "NM_Peer_Fence";
+    this->type = NetworkMessage::Type::PEER_FENCE;
 }
 
-NM_DDM_Unsubscribe_Interaction::NM_DDM_Unsubscribe_Interaction()
+void NM_Peer_Fence::serialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_DDM_Unsubscribe_Interaction";
-    this->type = NetworkMessage::Type::DDM_UNSUBSCRIBE_INTERACTION;
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    msgBuffer.write_uint32(epoch);
+    msgBuffer.write_bool(closing);
+    uint32_t peersSize = peers.size();
+    msgBuffer.write_uint32(peersSize);
+    for (uint32_t i = 0; i < peersSize; ++i) {
+        msgBuffer.write_uint32(peers[i]);
+    }
 }
 
-NM_Provide_Attribute_Value_Update::NM_Provide_Attribute_Value_Update()
+void NM_Peer_Fence::deserialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_Provide_Attribute_Value_Update";
-    this->type = NetworkMessage::Type::PROVIDE_ATTRIBUTE_VALUE_UPDATE;
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    epoch = msgBuffer.read_uint32();
+    closing = msgBuffer.read_bool();
+    uint32_t peersSize = msgBuffer.read_uint32();
+    peers.resize(peersSize);
+    for (uint32_t i = 0; i < peersSize; ++i) {
+        peers[i] = static_cast<FederateHandle>(msgBuffer.read_uint32());
+    }
 }
 
-NM_Start_Registration_For_Object_Class::NM_Start_Registration_For_Object_Class()
+const uint32_t& NM_Peer_Fence::getEpoch() const
 {
-    this->messageName = "NM_Start_Registration_For_Object_Class";
-    this->type = NetworkMessage::Type::START_REGISTRATION_FOR_OBJECT_CLASS;
+    return epoch;
 }
 
-void NM_Start_Registration_For_Object_Class::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Peer_Fence::setEpoch(const uint32_t& newEpoch)
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(objectClass);
+    epoch = newEpoch;
 }
 
-void NM_Start_Registration_For_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
+const bool& NM_Peer_Fence::getClosing() const
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    return closing;
 }
 
-const ObjectClassHandle& NM_Start_Registration_For_Object_Class::getObjectClass() const
+void NM_Peer_Fence::setClosing(const bool& newClosing)
 {
-    return objectClass;
+    closing = newClosing;
 }
 
-void NM_Start_Registration_For_Object_Class::setObjectClass(const ObjectClassHandle& newObjectClass)
+uint32_t NM_Peer_Fence::getPeersSize() const
 {
-    objectClass = newObjectClass;
+    return peers.size();
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Start_Registration_For_Object_Class& msg)
+void NM_Peer_Fence::setPeersSize(uint32_t num)
 {
-    os << "[NM_Start_Registration_For_Object_Class - Begin]" << std::endl;
-    
-    os << static_cast<const NM_Start_Registration_For_Object_Class::Super&>(msg); // show parent class
-    
-    // Specific display
-    os << "  objectClass = " << msg.objectClass << std::endl;
-    
-    os << "[NM_Start_Registration_For_Object_Class - End]" << std::endl;
-    return os;
+    peers.resize(num);
 }
 
-NM_Stop_Registration_For_Object_Class::NM_Stop_Registration_For_Object_Class()
+const std::vector<FederateHandle>& NM_Peer_Fence::getPeers() const
 {
-    this->messageName = "NM_Stop_Registration_For_Object_Class";
-    this->type = NetworkMessage::Type::STOP_REGISTRATION_FOR_OBJECT_CLASS;
+    return peers;
 }
 
-void NM_Stop_Registration_For_Object_Class::serialize(libhla::MessageBuffer& msgBuffer)
+const FederateHandle& NM_Peer_Fence::getPeers(uint32_t rank) const
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_uint32(objectClass);
+    return peers[rank];
 }
 
-void NM_Stop_Registration_For_Object_Class::deserialize(libhla::MessageBuffer& msgBuffer)
+FederateHandle& NM_Peer_Fence::getPeers(uint32_t rank)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    objectClass = static_cast<ObjectClassHandle>(msgBuffer.read_uint32());
+    return peers[rank];
 }
 
-const ObjectClassHandle& NM_Stop_Registration_For_Object_Class::getObjectClass() const
+void NM_Peer_Fence::setPeers(const FederateHandle& newPeers, uint32_t rank)
 {
-    return objectClass;
+    peers[rank] = newPeers;
 }
 
-void NM_Stop_Registration_For_Object_Class::setObjectClass(const ObjectClassHandle& newObjectClass)
+void NM_Peer_Fence::removePeers(uint32_t rank)
 {
-    objectClass = newObjectClass;
+    peers.erase(peers.begin() + rank);
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Stop_Registration_For_Object_Class& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Peer_Fence& msg)
 {
-    os << "[NM_Stop_Registration_For_Object_Class - Begin]" << std::endl;
+    os << "[NM_Peer_Fence - Begin]" << std::endl;
     
-    os << static_cast<const NM_Stop_Registration_For_Object_Class::Super&>(msg); // show parent class
+    os << static_cast<const NM_Peer_Fence::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  objectClass = " << msg.objectClass << std::endl;
+    os << "  epoch = " << msg.epoch << std::endl;
+    os << "  closing = " << msg.closing << std::endl;
+    os << "  peers [] =" << std::endl;
+    for (const auto& element : msg.peers) {
+        os << element;
+    }
+    os << std::endl;
     
-    os << "[NM_Stop_Registration_For_Object_Class - End]" << std::endl;
+    os << "[NM_Peer_Fence - End]" << std::endl;
     return os;
 }
 
-NM_Reserve_Object_Instance_Name::NM_Reserve_Object_Instance_Name()
+NM_Relay_Open::NM_Relay_Open()
 {
-    this->messageName = "NM_Reserve_Object_Instance_Name";
-    this->type = NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME;
+    this->messageName = "NM_Relay_Open";
+    this->type = NetworkMessage::Type::RELAY_OPEN;
 }
 
-void NM_Reserve_Object_Instance_Name::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Relay_Open::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_string(objectName);
+    msgBuffer.write_uint32(channel);
 }
 
-void NM_Reserve_Object_Instance_Name::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Relay_Open::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    msgBuffer.read_string(objectName);
+    channel = msgBuffer.read_uint32();
 }
 
-const std::string& NM_Reserve_Object_Instance_Name::getObjectName() const
+const uint32_t& NM_Relay_Open::getChannel() const
 {
-    return objectName;
+    return channel;
 }
 
-void NM_Reserve_Object_Instance_Name::setObjectName(const std::string& newObjectName)
+void NM_Relay_Open::setChannel(const uint32_t& newChannel)
 {
-    objectName = newObjectName;
+    channel = newChannel;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Reserve_Object_Instance_Name& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Relay_Open& msg)
 {
-    os << "[NM_Reserve_Object_Instance_Name - Begin]" << std::endl;
+    os << "[NM_Relay_Open - Begin]" << std::endl;
     
-    os << static_cast<const NM_Reserve_Object_Instance_Name::Super&>(msg); // show parent class
+    os << static_cast<const NM_Relay_Open::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  objectName = " << msg.objectName << std::endl;
+    os << "  channel = " << msg.channel << std::endl;
     
-    os << "[NM_Reserve_Object_Instance_Name - End]" << std::endl;
+    os << "[NM_Relay_Open - End]" << std::endl;
     return os;
 }
 
-NM_Reserve_Object_Instance_Name_Succeeded::NM_Reserve_Object_Instance_Name_Succeeded()
-{
-    this->messageName = "NM_Reserve_Object_Instance_Name_Succeeded";
-    this->type = NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME_SUCCEEDED;
-}
-
-NM_Reserve_Object_Instance_Name_Failed::NM_Reserve_Object_Instance_Name_Failed()
-{
-    this->messageName = "NM_Reserve_Object_Instance_Name_Failed";
-    this->type = NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME_FAILED;
-}
-
-NM_Message_Null_Prime::NM_Message_Null_Prime()
+NM_Relay_Close::NM_Relay_Close()
 {
-    this->messageName = "NM_Message_Null_Prime";
-    this->type = NetworkMessage::Type::MESSAGE_NULL_PRIME;
+    this->messageName = "NM_Relay_Close";
+    this->type = NetworkMessage::Type::RELAY_CLOSE;
 }
 
-void NM_Message_Null_Prime::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Relay_Close::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    // FIXME FIXME FIXME
-    //don't know how to serialize native field <timestamp> of type <FederationTime>
-    //probably no 'representation' given
+    msgBuffer.write_uint32(channel);
 }
 
-void NM_Message_Null_Prime::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Relay_Close::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    // FIXME FIXME FIXME
-    //don't know how to deserialize native field <timestamp> of type <FederationTime>
-    //probably no 'representation' given
+    channel = msgBuffer.read_uint32();
 }
 
-const FederationTime& NM_Message_Null_Prime::getTimestamp() const
+const uint32_t& NM_Relay_Close::getChannel() const
 {
-    return timestamp;
+    return channel;
 }
 
-void NM_Message_Null_Prime::setTimestamp(const FederationTime& newTimestamp)
+void NM_Relay_Close::setChannel(const uint32_t& newChannel)
 {
-    timestamp = newTimestamp;
+    channel = newChannel;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Message_Null_Prime& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Relay_Close& msg)
 {
-    os << "[NM_Message_Null_Prime - Begin]" << std::endl;
+    os << "[NM_Relay_Close - Begin]" << std::endl;
     
-    os << static_cast<const NM_Message_Null_Prime::Super&>(msg); // show parent class
+    os << static_cast<const NM_Relay_Close::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  timestamp = " << "// TODO field <timestamp> of type <FederationTime>" << std::endl;
+    os << "  channel = " << msg.channel << std::endl;
     
-    os << "[NM_Message_Null_Prime - End]" << std::endl;
+    os << "[NM_Relay_Close - End]" << std::endl;
     return os;
 }
 
-NM_Enable_Asynchronous_Delivery::NM_Enable_Asynchronous_Delivery()
-{
-    this->messageName = "NM_Enable_Asynchronous_Delivery";
-    this->type = NetworkMessage::Type::ENABLE_ASYNCHRONOUS_DELIVERY;
-}
-
-NM_Disable_Asynchronous_Delivery::NM_Disable_Asynchronous_Delivery()
+NM_Relay_Data::NM_Relay_Data()
 {
-    this->messageName = "NM_Disable_Asynchronous_Delivery";
-    this->type = NetworkMessage::Type::DISABLE_ASYNCHRONOUS_DELIVERY;
+    this->messageName = "NM_Relay_Data";
+    this->type = NetworkMessage::Type::RELAY_DATA;
 }
 
-NM_Time_Advance_Request::NM_Time_Advance_Request()
+void NM_Relay_Data::serialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_Time_Advance_Request";
-    this->type = NetworkMessage::Type::TIME_ADVANCE_REQUEST;
+    // Call parent class
+    Super::serialize(msgBuffer);
+    // Specific serialization code
+    uint32_t channelsSize = channels.size();
+    msgBuffer.write_uint32(channelsSize);
+    for (uint32_t i = 0; i < channelsSize; ++i) {
+        msgBuffer.write_uint32(channels[i]);
+    }
+    //serialize native whose representation is 'repeated' byte 
+    msgBuffer.write_uint32(payload.size());
+    msgBuffer.write_bytes(payload.data(),payload.size());
 }
 
-NM_Time_Advance_Request_Available::NM_Time_Advance_Request_Available()
+void NM_Relay_Data::deserialize(libhla::MessageBuffer& msgBuffer)
 {
-    this->messageName = "NM_Time_Advance_Request_Available";
-    this->type = NetworkMessage::Type::TIME_ADVANCE_REQUEST_AVAILABLE;
+    // Call parent class
+    Super::deserialize(msgBuffer);
+    // Specific deserialization code
+    uint32_t channelsSize = msgBuffer.read_uint32();
+    channels.resize(channelsSize);
+    for (uint32_t i = 0; i < channelsSize; ++i) {
+        channels[i] = msgBuffer.read_uint32();
+    }
+    //deserialize native whose representation is 'repeated' byte 
+    payload.resize(msgBuffer.read_uint32());
+    msgBuffer.read_bytes(payload.data(),payload.size());
 }
 
-NM_Next_Message_Request::NM_Next_Message_Request()
+uint32_t NM_Relay_Data::getChannelsSize() const
 {
-    this->messageName = "NM_Next_Message_Request";
-    this->type = NetworkMessage::Type::NEXT_MESSAGE_REQUEST;
+    return channels.size();
 }
 
-NM_Next_Message_Request_Available::NM_Next_Message_Request_Available()
+void NM_Relay_Data::setChannelsSize(uint32_t num)
 {
-    this->messageName = "NM_Next_Message_Request_Available";
-    this->type = NetworkMessage::Type::NEXT_MESSAGE_REQUEST_AVAILABLE;
+    channels.resize(num);
 }
 
-NM_Mom_Status::NM_Mom_Status()
+const std::vector<uint32_t>& NM_Relay_Data::getChannels() const
 {
-    this->messageName = "NM_Mom_Status";
-    this->type = NetworkMessage::Type::MOM_STATUS;
+    return channels;
 }
 
-void NM_Mom_Status::serialize(libhla::MessageBuffer& msgBuffer)
+const uint32_t& NM_Relay_Data::getChannels(uint32_t rank) const
 {
-    // Call parent class
-    Super::serialize(msgBuffer);
-    // Specific serialization code
-    msgBuffer.write_bool(momState);
-    msgBuffer.write_uint32(updatePeriod);
+    return channels[rank];
 }
 
-void NM_Mom_Status::deserialize(libhla::MessageBuffer& msgBuffer)
+uint32_t& NM_Relay_Data::getChannels(uint32_t rank)
 {
-    // Call parent class
-    Super::deserialize(msgBuffer);
-    // Specific deserialization code
-    momState = msgBuffer.read_bool();
-    updatePeriod = msgBuffer.read_uint32();
+    return channels[rank];
 }
 
-const bool& NM_Mom_Status::getMomState() const
+void NM_Relay_Data::setChannels(const uint32_t& newChannels, uint32_t rank)
 {
-    return momState;
+    channels[rank] = newChannels;
 }
 
-void NM_Mom_Status::setMomState(const bool& newMomState)
+void NM_Relay_Data::removeChannels(uint32_t rank)
 {
-    momState = newMomState;
+    channels.erase(channels.begin() + rank);
 }
 
-const uint32_t& NM_Mom_Status::getUpdatePeriod() const
+const AttributeValue_t& NM_Relay_Data::getPayload() const
 {
-    return updatePeriod;
+    return payload;
 }
 
-void NM_Mom_Status::setUpdatePeriod(const uint32_t& newUpdatePeriod)
+void NM_Relay_Data::setPayload(const AttributeValue_t& newPayload)
 {
-    updatePeriod = newUpdatePeriod;
+    payload = newPayload;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Mom_Status& msg)
+std::ostream& operator<<(std::ostream& os, const NM_Relay_Data& msg)
 {
-    os << "[NM_Mom_Status - Begin]" << std::endl;
+    os << "[NM_Relay_Data - Begin]" << std::endl;
     
-    os << static_cast<const NM_Mom_Status::Super&>(msg); // show parent class
+    os << static_cast<const NM_Relay_Data::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  momState = " << msg.momState << std::endl;
-    os << "  updatePeriod = " << msg.updatePeriod << std::endl;
+    os << "  channels [] =" << std::endl;
+    for (const auto& element : msg.channels) {
+        os << element;
+    }
+    os << std::endl;
+    os << "  payload = " << "// TODO field <payload> of type <AttributeValue_t>" << std::endl;
     
-    os << "[NM_Mom_Status - End]" << std::endl;
+    os << "[NM_Relay_Data - End]" << std::endl;
     return os;
 }
 
-NM_Time_State_Update::NM_Time_State_Update()
+NM_Retract::NM_Retract()
 {
-    this->messageName = "NM_Time_State_Update";
-    this->type = NetworkMessage::Type::TIME_STATE_UPDATE;
+    this->messageName = "NM_Retract";
+    this->type = NetworkMessage::Type::RETRACT;
 }
 
-void NM_Time_State_Update::serialize(libhla::MessageBuffer& msgBuffer)
+void NM_Retract::serialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::serialize(msgBuffer);
     // Specific serialization code
-    msgBuffer.write_double(lookahead);
-    msgBuffer.write_bool(state);
-    msgBuffer.write_double(galt);
-    msgBuffer.write_double(lits);
+    msgBuffer.write_uint32(event);
+    uint32_t receiversSize = receivers.size();
+    msgBuffer.write_uint32(receiversSize);
+    for (uint32_t i = 0; i < receiversSize; ++i) {
+        msgBuffer.write_uint32(receivers[i]);
+    }
 }
 
-void NM_Time_State_Update::deserialize(libhla::MessageBuffer& msgBuffer)
+void NM_Retract::deserialize(libhla::MessageBuffer& msgBuffer)
 {
     // Call parent class
     Super::deserialize(msgBuffer);
     // Specific deserialization code
-    lookahead = msgBuffer.read_double();
-    state = msgBuffer.read_bool();
-    galt = msgBuffer.read_double();
-    lits = msgBuffer.read_double();
+    event = static_cast<EventRetractionHandle>(msgBuffer.read_uint32());
+    uint32_t receiversSize = msgBuffer.read_uint32();
+    receivers.resize(receiversSize);
+    for (uint32_t i = 0; i < receiversSize; ++i) {
+        receivers[i] = static_cast<FederateHandle>(msgBuffer.read_uint32());
+    }
 }
 
-const double& NM_Time_State_Update::getLookahead() const
+const EventRetractionHandle& NM_Retract::getEvent() const
 {
-    return lookahead;
+    return event;
 }
 
-void NM_Time_State_Update::setLookahead(const double& newLookahead)
+void NM_Retract::setEvent(const EventRetractionHandle& newEvent)
 {
-    lookahead = newLookahead;
+    event = newEvent;
 }
 
-const bool& NM_Time_State_Update::getState() const
+uint32_t NM_Retract::getReceiversSize() const
 {
-    return state;
+    return receivers.size();
 }
 
-void NM_Time_State_Update::setState(const bool& newState)
+void NM_Retract::setReceiversSize(uint32_t num)
 {
-    state = newState;
+    receivers.resize(num);
 }
 
-const double& NM_Time_State_Update::getGalt() const
+const std::vector<FederateHandle>& NM_Retract::getReceivers() const
 {
-    return galt;
+    return receivers;
 }
 
-void NM_Time_State_Update::setGalt(const double& newGalt)
+const FederateHandle& NM_Retract::getReceivers(uint32_t rank) const
 {
-    galt = newGalt;
+    return receivers[rank];
 }
 
-const double& NM_Time_State_Update::getLits() const
+FederateHandle& NM_Retract::getReceivers(uint32_t rank)
 {
-    return lits;
+    return receivers[rank];
 }
 
-void NM_Time_State_Update::setLits(const double& newLits)
+void NM_Retract::setReceivers(const FederateHandle& newReceivers, uint32_t rank)
 {
-    lits = newLits;
+    receivers[rank] = newReceivers;
 }
 
-std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg)
+void NM_Retract::removeReceivers(uint32_t rank)
 {
-    os << "[NM_Time_State_Update - Begin]" << std::endl;
+    receivers.erase(receivers.begin() + rank);
+}
+
+std::ostream& operator<<(std::ostream& os, const NM_Retract& msg)
+{
+    os << "[NM_Retract - Begin]" << std::endl;
     
-    os << static_cast<const NM_Time_State_Update::Super&>(msg); // show parent class
+    os << static_cast<const NM_Retract::Super&>(msg); // show parent class
     
     // Specific display
-    os << "  lookahead = " << msg.lookahead << std::endl;
-    os << "  state = " << msg.state << std::endl;
-    os << "  galt = " << msg.galt << std::endl;
-    os << "  lits = " << msg.lits << std::endl;
+    os << "  event = " << msg.event << std::endl;
+    os << "  receivers [] =" << std::endl;
+    for (const auto& element : msg.receivers) {
+        os << element;
+    }
+    os << std::endl;
     
-    os << "[NM_Time_State_Update - End]" << std::endl;
+    os << "[NM_Retract - End]" << std::endl;
     return os;
 }
 
@@ -5700,6 +8160,12 @@ NetworkMessage* NM_Factory::create(NM_Type type) throw (NetworkError ,NetworkSig
         case NetworkMessage::Type::DISCOVER_OBJECT:
             msg = new NM_Discover_Object();
             break;
+        case NetworkMessage::Type::DISCOVER_OBJECTS:
+            msg = new NM_Discover_Objects();
+            break;
+        case NetworkMessage::Type::LEASE_OBJECT_HANDLES:
+            msg = new NM_Lease_Object_Handles();
+            break;
         case NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES:
             msg = new NM_Update_Attribute_Values();
             break;
@@ -5718,6 +8184,9 @@ NetworkMessage* NM_Factory::create(NM_Type type) throw (NetworkError ,NetworkSig
         case NetworkMessage::Type::REMOVE_OBJECT:
             msg = new NM_Remove_Object();
             break;
+        case NetworkMessage::Type::REMOVE_OBJECTS:
+            msg = new NM_Remove_Objects();
+            break;
         case NetworkMessage::Type::CHANGE_ATTRIBUTE_TRANSPORT_TYPE:
             msg = new NM_Change_Attribute_Transport_Type();
             break;
@@ -5865,6 +8334,36 @@ NetworkMessage* NM_Factory::create(NM_Type type) throw (NetworkError ,NetworkSig
         case NetworkMessage::Type::TIME_STATE_UPDATE:
             msg = new NM_Time_State_Update();
             break;
+        case NetworkMessage::Type::DDM_MODIFY_REGIONS:
+            msg = new NM_DDM_Modify_Regions();
+            break;
+        case NetworkMessage::Type::BATCH_UPDATE_ATTRIBUTE_VALUES:
+            msg = new NM_Batch_Update_Attribute_Values();
+            break;
+        case NetworkMessage::Type::BATCH_REFLECT_ATTRIBUTE_VALUES:
+            msg = new NM_Batch_Reflect_Attribute_Values();
+            break;
+        case NetworkMessage::Type::PEER_ROUTE:
+            msg = new NM_Peer_Route();
+            break;
+        case NetworkMessage::Type::PEER_ROUTES_INVALIDATED:
+            msg = new NM_Peer_Routes_Invalidated();
+            break;
+        case NetworkMessage::Type::PEER_FENCE:
+            msg = new NM_Peer_Fence();
+            break;
+        case NetworkMessage::Type::RELAY_OPEN:
+            msg = new NM_Relay_Open();
+            break;
+        case NetworkMessage::Type::RELAY_CLOSE:
+            msg = new NM_Relay_Close();
+            break;
+        case NetworkMessage::Type::RELAY_DATA:
+            msg = new NM_Relay_Data();
+            break;
+        case NetworkMessage::Type::RETRACT:
+            msg = new NM_Retract();
+            break;
         case NetworkMessage::Type::LAST:
             throw NetworkError("LAST message type should not be used!!");
             break;
@@ -382,6 +382,12 @@ public:
     const std::string& getFederateType() const;
     void setFederateType(const std::string& newFederateType);
     
+    const bool& getCompression() const;
+    void setCompression(const bool& newCompression);
+    
+    const uint32_t& getPeerPort() const;
+    void setPeerPort(const uint32_t& newPeerPort);
+    
     uint32_t getAdditionalFomModulesSize() const;
     void setAdditionalFomModulesSize(uint32_t num);
     const std::vector<std::string>& getAdditionalFomModules() const;
@@ -427,6 +433,8 @@ protected:
     bool _hasFederateName {false};
     RtiVersion rtiVersion;// the rti version
     std::string federateType;
+    bool compression {false};// compressed values accepted by the federate, granted by the RTIG in the answer
+    uint32_t peerPort {0};// port the federate takes peer-to-peer data on, 0 if it takes none
     std::vector<std::string> additionalFomModules;
     std::vector<NM_FOM_Routing_Space> routingSpaces;
     std::vector<NM_FOM_Object_Class> objectClasses;
@@ -1052,6 +1060,84 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_Discover_Object& msg);
 
+// CERTI specific, many §6.3 discoveries at once, e.g. for a late subscriber
+// the i-th object is discovered as objectClasses[i] and named objectNames[i]
+class CERTI_EXPORT NM_Discover_Objects : public NetworkMessage {
+public:
+    NM_Discover_Objects();
+    virtual ~NM_Discover_Objects() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    uint32_t getObjectClassesSize() const;
+    void setObjectClassesSize(uint32_t num);
+    const std::vector<ObjectClassHandle>& getObjectClasses() const;
+    const ObjectClassHandle& getObjectClasses(uint32_t rank) const;
+    ObjectClassHandle& getObjectClasses(uint32_t rank);
+    void setObjectClasses(const ObjectClassHandle& newObjectClasses, uint32_t rank);
+    void removeObjectClasses(uint32_t rank);
+    
+    uint32_t getObjectsSize() const;
+    void setObjectsSize(uint32_t num);
+    const std::vector<ObjectHandle>& getObjects() const;
+    const ObjectHandle& getObjects(uint32_t rank) const;
+    ObjectHandle& getObjects(uint32_t rank);
+    void setObjects(const ObjectHandle& newObjects, uint32_t rank);
+    void removeObjects(uint32_t rank);
+    
+    uint32_t getObjectNamesSize() const;
+    void setObjectNamesSize(uint32_t num);
+    const std::vector<std::string>& getObjectNames() const;
+    const std::string& getObjectNames(uint32_t rank) const;
+    std::string& getObjectNames(uint32_t rank);
+    void setObjectNames(const std::string& newObjectNames, uint32_t rank);
+    void removeObjectNames(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Discover_Objects& msg);
+
+protected:
+    std::vector<ObjectClassHandle> objectClasses;
+    std::vector<ObjectHandle> objects;
+    std::vector<std::string> objectNames;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Discover_Objects& msg);
+
+// CERTI specific, object handles reserved for later registrations
+// the RTIA asks for count handles, the RTIG answers with the leased objects
+class CERTI_EXPORT NM_Lease_Object_Handles : public NetworkMessage {
+public:
+    NM_Lease_Object_Handles();
+    virtual ~NM_Lease_Object_Handles() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const uint32_t& getCount() const;
+    void setCount(const uint32_t& newCount);
+    
+    uint32_t getObjectsSize() const;
+    void setObjectsSize(uint32_t num);
+    const std::vector<ObjectHandle>& getObjects() const;
+    const ObjectHandle& getObjects(uint32_t rank) const;
+    ObjectHandle& getObjects(uint32_t rank);
+    void setObjects(const ObjectHandle& newObjects, uint32_t rank);
+    void removeObjects(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Lease_Object_Handles& msg);
+
+protected:
+    uint32_t count;
+    std::vector<ObjectHandle> objects;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Lease_Object_Handles& msg);
+
 // HLA 1.3 §6.4
 class CERTI_EXPORT NM_Update_Attribute_Values : public NetworkMessage {
 public:
@@ -1081,10 +1167,30 @@ public:
     void setValues(const AttributeValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
     
+    uint32_t getRawSizesSize() const;
+    void setRawSizesSize(uint32_t num);
+    const std::vector<uint32_t>& getRawSizes() const;
+    const uint32_t& getRawSizes(uint32_t rank) const;
+    uint32_t& getRawSizes(uint32_t rank);
+    void setRawSizes(const uint32_t& newRawSizes, uint32_t rank);
+    void removeRawSizes(uint32_t rank);
+    
     const EventRetractionHandle& getEvent() const;
     void setEvent(const EventRetractionHandle& newEvent);
     bool hasEvent() const;
     
+    const uint64_t& getTraceId() const;
+    void setTraceId(const uint64_t& newTraceId);
+    bool hasTraceId() const;
+    
+    uint32_t getReceiversSize() const;
+    void setReceiversSize(uint32_t num);
+    const std::vector<FederateHandle>& getReceivers() const;
+    const FederateHandle& getReceivers(uint32_t rank) const;
+    FederateHandle& getReceivers(uint32_t rank);
+    void setReceivers(const FederateHandle& newReceivers, uint32_t rank);
+    void removeReceivers(uint32_t rank);
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg);
 
@@ -1092,8 +1198,12 @@ protected:
     ObjectHandle object;
     std::vector<AttributeHandle> attributes;
     std::vector<AttributeValue_t> values;
+    std::vector<uint32_t> rawSizes;
     EventRetractionHandle event;
     bool _hasEvent {false};
+    uint64_t traceId;
+    bool _hasTraceId {false};
+    std::vector<FederateHandle> receivers;// CERTI specific, see NM_Retract
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Update_Attribute_Values& msg);
@@ -1127,10 +1237,22 @@ public:
     void setValues(const AttributeValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
     
+    uint32_t getRawSizesSize() const;
+    void setRawSizesSize(uint32_t num);
+    const std::vector<uint32_t>& getRawSizes() const;
+    const uint32_t& getRawSizes(uint32_t rank) const;
+    uint32_t& getRawSizes(uint32_t rank);
+    void setRawSizes(const uint32_t& newRawSizes, uint32_t rank);
+    void removeRawSizes(uint32_t rank);
+    
     const EventRetractionHandle& getEvent() const;
     void setEvent(const EventRetractionHandle& newEvent);
     bool hasEvent() const;
     
+    const uint64_t& getTraceId() const;
+    void setTraceId(const uint64_t& newTraceId);
+    bool hasTraceId() const;
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& msg);
 
@@ -1138,12 +1260,139 @@ protected:
     ObjectHandle object;
     std::vector<AttributeHandle> attributes;
     std::vector<AttributeValue_t> values;
+    std::vector<uint32_t> rawSizes;
     EventRetractionHandle event;
     bool _hasEvent {false};
+    uint64_t traceId;
+    bool _hasTraceId {false};
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Reflect_Attribute_Values& msg);
 
+class CERTI_EXPORT NM_Batch_Update_Attribute_Values : public NetworkMessage {
+public:
+    NM_Batch_Update_Attribute_Values();
+    virtual ~NM_Batch_Update_Attribute_Values() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    uint32_t getObjectsSize() const;
+    void setObjectsSize(uint32_t num);
+    const std::vector<ObjectHandle>& getObjects() const;
+    const ObjectHandle& getObjects(uint32_t rank) const;
+    ObjectHandle& getObjects(uint32_t rank);
+    void setObjects(const ObjectHandle& newObjects, uint32_t rank);
+    void removeObjects(uint32_t rank);
+    
+    uint32_t getAttributeCountsSize() const;
+    void setAttributeCountsSize(uint32_t num);
+    const std::vector<uint32_t>& getAttributeCounts() const;
+    const uint32_t& getAttributeCounts(uint32_t rank) const;
+    uint32_t& getAttributeCounts(uint32_t rank);
+    void setAttributeCounts(const uint32_t& newAttributeCounts, uint32_t rank);
+    void removeAttributeCounts(uint32_t rank);
+    
+    uint32_t getAttributesSize() const;
+    void setAttributesSize(uint32_t num);
+    const std::vector<AttributeHandle>& getAttributes() const;
+    const AttributeHandle& getAttributes(uint32_t rank) const;
+    AttributeHandle& getAttributes(uint32_t rank);
+    void setAttributes(const AttributeHandle& newAttributes, uint32_t rank);
+    void removeAttributes(uint32_t rank);
+    
+    uint32_t getValuesSize() const;
+    void setValuesSize(uint32_t num);
+    const std::vector<AttributeValue_t>& getValues() const;
+    const AttributeValue_t& getValues(uint32_t rank) const;
+    AttributeValue_t& getValues(uint32_t rank);
+    void setValues(const AttributeValue_t& newValues, uint32_t rank);
+    void removeValues(uint32_t rank);
+    
+    uint32_t getRawSizesSize() const;
+    void setRawSizesSize(uint32_t num);
+    const std::vector<uint32_t>& getRawSizes() const;
+    const uint32_t& getRawSizes(uint32_t rank) const;
+    uint32_t& getRawSizes(uint32_t rank);
+    void setRawSizes(const uint32_t& newRawSizes, uint32_t rank);
+    void removeRawSizes(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Batch_Update_Attribute_Values& msg);
+
+protected:
+    std::vector<ObjectHandle> objects;
+    std::vector<uint32_t> attributeCounts;
+    std::vector<AttributeHandle> attributes;
+    std::vector<AttributeValue_t> values;
+    std::vector<uint32_t> rawSizes;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Batch_Update_Attribute_Values& msg);
+
+class CERTI_EXPORT NM_Batch_Reflect_Attribute_Values : public NetworkMessage {
+public:
+    NM_Batch_Reflect_Attribute_Values();
+    virtual ~NM_Batch_Reflect_Attribute_Values() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    uint32_t getObjectsSize() const;
+    void setObjectsSize(uint32_t num);
+    const std::vector<ObjectHandle>& getObjects() const;
+    const ObjectHandle& getObjects(uint32_t rank) const;
+    ObjectHandle& getObjects(uint32_t rank);
+    void setObjects(const ObjectHandle& newObjects, uint32_t rank);
+    void removeObjects(uint32_t rank);
+    
+    uint32_t getAttributeCountsSize() const;
+    void setAttributeCountsSize(uint32_t num);
+    const std::vector<uint32_t>& getAttributeCounts() const;
+    const uint32_t& getAttributeCounts(uint32_t rank) const;
+    uint32_t& getAttributeCounts(uint32_t rank);
+    void setAttributeCounts(const uint32_t& newAttributeCounts, uint32_t rank);
+    void removeAttributeCounts(uint32_t rank);
+    
+    uint32_t getAttributesSize() const;
+    void setAttributesSize(uint32_t num);
+    const std::vector<AttributeHandle>& getAttributes() const;
+    const AttributeHandle& getAttributes(uint32_t rank) const;
+    AttributeHandle& getAttributes(uint32_t rank);
+    void setAttributes(const AttributeHandle& newAttributes, uint32_t rank);
+    void removeAttributes(uint32_t rank);
+    
+    uint32_t getValuesSize() const;
+    void setValuesSize(uint32_t num);
+    const std::vector<AttributeValue_t>& getValues() const;
+    const AttributeValue_t& getValues(uint32_t rank) const;
+    AttributeValue_t& getValues(uint32_t rank);
+    void setValues(const AttributeValue_t& newValues, uint32_t rank);
+    void removeValues(uint32_t rank);
+    
+    uint32_t getRawSizesSize() const;
+    void setRawSizesSize(uint32_t num);
+    const std::vector<uint32_t>& getRawSizes() const;
+    const uint32_t& getRawSizes(uint32_t rank) const;
+    uint32_t& getRawSizes(uint32_t rank);
+    void setRawSizes(const uint32_t& newRawSizes, uint32_t rank);
+    void removeRawSizes(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Batch_Reflect_Attribute_Values& msg);
+
+protected:
+    std::vector<ObjectHandle> objects;
+    std::vector<uint32_t> attributeCounts;
+    std::vector<AttributeHandle> attributes;
+    std::vector<AttributeValue_t> values;
+    std::vector<uint32_t> rawSizes;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Batch_Reflect_Attribute_Values& msg);
+
 // HLA 1.3 §6.6
 class CERTI_EXPORT NM_Send_Interaction : public NetworkMessage {
 public:
@@ -1173,9 +1422,29 @@ public:
     void setValues(const ParameterValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
     
+    uint32_t getRawSizesSize() const;
+    void setRawSizesSize(uint32_t num);
+    const std::vector<uint32_t>& getRawSizes() const;
+    const uint32_t& getRawSizes(uint32_t rank) const;
+    uint32_t& getRawSizes(uint32_t rank);
+    void setRawSizes(const uint32_t& newRawSizes, uint32_t rank);
+    void removeRawSizes(uint32_t rank);
+    
     const RegionHandle& getRegion() const;
     void setRegion(const RegionHandle& newRegion);
     
+    const EventRetractionHandle& getEvent() const;
+    void setEvent(const EventRetractionHandle& newEvent);
+    bool hasEvent() const;
+    
+    uint32_t getReceiversSize() const;
+    void setReceiversSize(uint32_t num);
+    const std::vector<FederateHandle>& getReceivers() const;
+    const FederateHandle& getReceivers(uint32_t rank) const;
+    FederateHandle& getReceivers(uint32_t rank);
+    void setReceivers(const FederateHandle& newReceivers, uint32_t rank);
+    void removeReceivers(uint32_t rank);
+    
     using Super = NetworkMessage;
     friend std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg);
 
@@ -1183,7 +1452,11 @@ protected:
     InteractionClassHandle interactionClass;
     std::vector<ParameterHandle> parameters;
     std::vector<ParameterValue_t> values;
+    std::vector<uint32_t> rawSizes;
     RegionHandle region;// FIXME check this....
+    EventRetractionHandle event;
+    bool _hasEvent {false};
+    std::vector<FederateHandle> receivers;// CERTI specific, see NM_Retract
 };
 
 std::ostream& operator<<(std::ostream& os, const NM_Send_Interaction& msg);
@@ -1217,6 +1490,14 @@ public:
     void setValues(const ParameterValue_t& newValues, uint32_t rank);
     void removeValues(uint32_t rank);
     
+    uint32_t getRawSizesSize() const;
+    void setRawSizesSize(uint32_t num);
+    const std::vector<uint32_t>& getRawSizes() const;
+    const uint32_t& getRawSizes(uint32_t rank) const;
+    uint32_t& getRawSizes(uint32_t rank);
+    void setRawSizes(const uint32_t& newRawSizes, uint32_t rank);
+    void removeRawSizes(uint32_t rank);
+    
     const EventRetractionHandle& getEvent() const;
     void setEvent(const EventRetractionHandle& newEvent);
     bool hasEvent() const;
@@ -1228,6 +1509,7 @@ protected:
     InteractionClassHandle interactionClass;
     std::vector<ParameterHandle> parameters;
     std::vector<ParameterValue_t> values;
+    std::vector<uint32_t> rawSizes;
     EventRetractionHandle event;
     bool _hasEvent {false};
 };
@@ -1294,6 +1576,38 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_Remove_Object& msg);
 
+// CERTI specific, many §6.9 removals at once, e.g. of the objects of a killed federate
+// every object is removed as objectClass
+class CERTI_EXPORT NM_Remove_Objects : public NetworkMessage {
+public:
+    NM_Remove_Objects();
+    virtual ~NM_Remove_Objects() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const ObjectClassHandle& getObjectClass() const;
+    void setObjectClass(const ObjectClassHandle& newObjectClass);
+    
+    uint32_t getObjectsSize() const;
+    void setObjectsSize(uint32_t num);
+    const std::vector<ObjectHandle>& getObjects() const;
+    const ObjectHandle& getObjects(uint32_t rank) const;
+    ObjectHandle& getObjects(uint32_t rank);
+    void setObjects(const ObjectHandle& newObjects, uint32_t rank);
+    void removeObjects(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Remove_Objects& msg);
+
+protected:
+    ObjectClassHandle objectClass;
+    std::vector<ObjectHandle> objects;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Remove_Objects& msg);
+
 
 class CERTI_EXPORT NM_Change_Attribute_Transport_Type : public NetworkMessage {
 public:
@@ -1797,6 +2111,62 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_DDM_Modify_Region& msg);
 
+// CERTI specific, many DDM_Modify_Region at once, not answered
+// region regions[i] gets extentCounts[i] extents of rangeCounts[i] ranges each,
+// read from bounds as lower then upper bound, one region after the other
+class CERTI_EXPORT NM_DDM_Modify_Regions : public NetworkMessage {
+public:
+    NM_DDM_Modify_Regions();
+    virtual ~NM_DDM_Modify_Regions() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    uint32_t getRegionsSize() const;
+    void setRegionsSize(uint32_t num);
+    const std::vector<RegionHandle>& getRegions() const;
+    const RegionHandle& getRegions(uint32_t rank) const;
+    RegionHandle& getRegions(uint32_t rank);
+    void setRegions(const RegionHandle& newRegions, uint32_t rank);
+    void removeRegions(uint32_t rank);
+    
+    uint32_t getExtentCountsSize() const;
+    void setExtentCountsSize(uint32_t num);
+    const std::vector<uint32_t>& getExtentCounts() const;
+    const uint32_t& getExtentCounts(uint32_t rank) const;
+    uint32_t& getExtentCounts(uint32_t rank);
+    void setExtentCounts(const uint32_t& newExtentCounts, uint32_t rank);
+    void removeExtentCounts(uint32_t rank);
+    
+    uint32_t getRangeCountsSize() const;
+    void setRangeCountsSize(uint32_t num);
+    const std::vector<uint32_t>& getRangeCounts() const;
+    const uint32_t& getRangeCounts(uint32_t rank) const;
+    uint32_t& getRangeCounts(uint32_t rank);
+    void setRangeCounts(const uint32_t& newRangeCounts, uint32_t rank);
+    void removeRangeCounts(uint32_t rank);
+    
+    uint32_t getBoundsSize() const;
+    void setBoundsSize(uint32_t num);
+    const std::vector<uint32_t>& getBounds() const;
+    const uint32_t& getBounds(uint32_t rank) const;
+    uint32_t& getBounds(uint32_t rank);
+    void setBounds(const uint32_t& newBounds, uint32_t rank);
+    void removeBounds(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_DDM_Modify_Regions& msg);
+
+protected:
+    std::vector<RegionHandle> regions;
+    std::vector<uint32_t> extentCounts;
+    std::vector<uint32_t> rangeCounts;
+    std::vector<uint32_t> bounds;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_DDM_Modify_Regions& msg);
+
 
 class CERTI_EXPORT NM_DDM_Delete_Region : public NetworkMessage {
 public:
@@ -2282,6 +2652,268 @@ protected:
 
 std::ostream& operator<<(std::ostream& os, const NM_Time_State_Update& msg);
 
+// CERTI specific, where the undated updates of object with the sorted keys
+// attributes, or the undated interactions of interactionClass in region with
+// the sorted keys parameters, are sent without the RTIG.
+// group i receives class classes[i] (interactions only) with the next
+// handleCounts[i] handles, at the next endpointCounts[i] federates, addresses and ports
+class CERTI_EXPORT NM_Peer_Route : public NetworkMessage {
+public:
+    NM_Peer_Route();
+    virtual ~NM_Peer_Route() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const ObjectHandle& getObject() const;
+    void setObject(const ObjectHandle& newObject);
+    
+    const InteractionClassHandle& getInteractionClass() const;
+    void setInteractionClass(const InteractionClassHandle& newInteractionClass);
+    
+    const RegionHandle& getRegion() const;
+    void setRegion(const RegionHandle& newRegion);
+    
+    uint32_t getKeysSize() const;
+    void setKeysSize(uint32_t num);
+    const std::vector<uint32_t>& getKeys() const;
+    const uint32_t& getKeys(uint32_t rank) const;
+    uint32_t& getKeys(uint32_t rank);
+    void setKeys(const uint32_t& newKeys, uint32_t rank);
+    void removeKeys(uint32_t rank);
+    
+    uint32_t getClassesSize() const;
+    void setClassesSize(uint32_t num);
+    const std::vector<uint32_t>& getClasses() const;
+    const uint32_t& getClasses(uint32_t rank) const;
+    uint32_t& getClasses(uint32_t rank);
+    void setClasses(const uint32_t& newClasses, uint32_t rank);
+    void removeClasses(uint32_t rank);
+    
+    uint32_t getHandleCountsSize() const;
+    void setHandleCountsSize(uint32_t num);
+    const std::vector<uint32_t>& getHandleCounts() const;
+    const uint32_t& getHandleCounts(uint32_t rank) const;
+    uint32_t& getHandleCounts(uint32_t rank);
+    void setHandleCounts(const uint32_t& newHandleCounts, uint32_t rank);
+    void removeHandleCounts(uint32_t rank);
+    
+    uint32_t getHandlesSize() const;
+    void setHandlesSize(uint32_t num);
+    const std::vector<uint32_t>& getHandles() const;
+    const uint32_t& getHandles(uint32_t rank) const;
+    uint32_t& getHandles(uint32_t rank);
+    void setHandles(const uint32_t& newHandles, uint32_t rank);
+    void removeHandles(uint32_t rank);
+    
+    uint32_t getEndpointCountsSize() const;
+    void setEndpointCountsSize(uint32_t num);
+    const std::vector<uint32_t>& getEndpointCounts() const;
+    const uint32_t& getEndpointCounts(uint32_t rank) const;
+    uint32_t& getEndpointCounts(uint32_t rank);
+    void setEndpointCounts(const uint32_t& newEndpointCounts, uint32_t rank);
+    void removeEndpointCounts(uint32_t rank);
+    
+    uint32_t getFederatesSize() const;
+    void setFederatesSize(uint32_t num);
+    const std::vector<FederateHandle>& getFederates() const;
+    const FederateHandle& getFederates(uint32_t rank) const;
+    FederateHandle& getFederates(uint32_t rank);
+    void setFederates(const FederateHandle& newFederates, uint32_t rank);
+    void removeFederates(uint32_t rank);
+    
+    uint32_t getAddressesSize() const;
+    void setAddressesSize(uint32_t num);
+    const std::vector<uint32_t>& getAddresses() const;
+    const uint32_t& getAddresses(uint32_t rank) const;
+    uint32_t& getAddresses(uint32_t rank);
+    void setAddresses(const uint32_t& newAddresses, uint32_t rank);
+    void removeAddresses(uint32_t rank);
+    
+    uint32_t getPortsSize() const;
+    void setPortsSize(uint32_t num);
+    const std::vector<uint32_t>& getPorts() const;
+    const uint32_t& getPorts(uint32_t rank) const;
+    uint32_t& getPorts(uint32_t rank);
+    void setPorts(const uint32_t& newPorts, uint32_t rank);
+    void removePorts(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Peer_Route& msg);
+
+protected:
+    ObjectHandle object {0};
+    InteractionClassHandle interactionClass {0};
+    RegionHandle region {0};
+    std::vector<uint32_t> keys;
+    std::vector<uint32_t> classes;
+    std::vector<uint32_t> handleCounts;
+    std::vector<uint32_t> handles;
+    std::vector<uint32_t> endpointCounts;
+    std::vector<FederateHandle> federates;
+    std::vector<uint32_t> addresses;
+    std::vector<uint32_t> ports;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Peer_Route& msg);
+
+// CERTI specific, the peer routes held by the federate no longer hold: from
+// the RTIG, then back to it once the federate stopped using them
+class CERTI_EXPORT NM_Peer_Routes_Invalidated : public NetworkMessage {
+public:
+    NM_Peer_Routes_Invalidated();
+    virtual ~NM_Peer_Routes_Invalidated() = default;
+    
+};
+
+// CERTI specific, federate switches between the RTIG and its peer links: to
+// the RTIG with the peers it switches for, then to each of them. The federate
+// also writes it on the link to each peer, before its first or after its last
+// direct message.
+class CERTI_EXPORT NM_Peer_Fence : public NetworkMessage {
+public:
+    NM_Peer_Fence();
+    virtual ~NM_Peer_Fence() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const uint32_t& getEpoch() const;
+    void setEpoch(const uint32_t& newEpoch);
+    
+    const bool& getClosing() const;
+    void setClosing(const bool& newClosing);
+    
+    uint32_t getPeersSize() const;
+    void setPeersSize(uint32_t num);
+    const std::vector<FederateHandle>& getPeers() const;
+    const FederateHandle& getPeers(uint32_t rank) const;
+    FederateHandle& getPeers(uint32_t rank);
+    void setPeers(const FederateHandle& newPeers, uint32_t rank);
+    void removePeers(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Peer_Fence& msg);
+
+protected:
+    uint32_t epoch {0};
+    bool closing {false};
+    std::vector<FederateHandle> peers;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Peer_Fence& msg);
+
+// CERTI specific, only between a host-local relay and the RTIG: an RTIA
+// connected to the relay, its messages come in NM_Relay_Data on channel
+class CERTI_EXPORT NM_Relay_Open : public NetworkMessage {
+public:
+    NM_Relay_Open();
+    virtual ~NM_Relay_Open() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const uint32_t& getChannel() const;
+    void setChannel(const uint32_t& newChannel);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Relay_Open& msg);
+
+protected:
+    uint32_t channel {0};
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Relay_Open& msg);
+
+// CERTI specific, the link of channel is closed, sent by the relay or the RTIG
+class CERTI_EXPORT NM_Relay_Close : public NetworkMessage {
+public:
+    NM_Relay_Close();
+    virtual ~NM_Relay_Close() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const uint32_t& getChannel() const;
+    void setChannel(const uint32_t& newChannel);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Relay_Close& msg);
+
+protected:
+    uint32_t channel {0};
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Relay_Close& msg);
+
+// CERTI specific, payload is a serialized message, to the RTIG from the RTIA
+// of the only channel, or from the RTIG to the RTIAs of every channel
+class CERTI_EXPORT NM_Relay_Data : public NetworkMessage {
+public:
+    NM_Relay_Data();
+    virtual ~NM_Relay_Data() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    uint32_t getChannelsSize() const;
+    void setChannelsSize(uint32_t num);
+    const std::vector<uint32_t>& getChannels() const;
+    const uint32_t& getChannels(uint32_t rank) const;
+    uint32_t& getChannels(uint32_t rank);
+    void setChannels(const uint32_t& newChannels, uint32_t rank);
+    void removeChannels(uint32_t rank);
+    
+    const AttributeValue_t& getPayload() const;
+    void setPayload(const AttributeValue_t& newPayload);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Relay_Data& msg);
+
+protected:
+    std::vector<uint32_t> channels;
+    AttributeValue_t payload;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Relay_Data& msg);
+
+// CERTI specific, federate retracts its dated event: to the RTIG with the
+// receivers of the answer to the update or interaction, then to each of them
+class CERTI_EXPORT NM_Retract : public NetworkMessage {
+public:
+    NM_Retract();
+    virtual ~NM_Retract() = default;
+    
+    virtual void serialize(libhla::MessageBuffer& msgBuffer);
+    virtual void deserialize(libhla::MessageBuffer& msgBuffer);
+
+    // Attributes accessors and mutators
+    const EventRetractionHandle& getEvent() const;
+    void setEvent(const EventRetractionHandle& newEvent);
+    
+    uint32_t getReceiversSize() const;
+    void setReceiversSize(uint32_t num);
+    const std::vector<FederateHandle>& getReceivers() const;
+    const FederateHandle& getReceivers(uint32_t rank) const;
+    FederateHandle& getReceivers(uint32_t rank);
+    void setReceivers(const FederateHandle& newReceivers, uint32_t rank);
+    void removeReceivers(uint32_t rank);
+    
+    using Super = NetworkMessage;
+    friend std::ostream& operator<<(std::ostream& os, const NM_Retract& msg);
+
+protected:
+    EventRetractionHandle event {0};
+    std::vector<FederateHandle> receivers;
+};
+
+std::ostream& operator<<(std::ostream& os, const NM_Retract& msg);
+
 
 class CERTI_EXPORT New_NetworkMessage {
 public:
@@ -169,6 +169,19 @@ std::string NetworkMessage::to_string(const NetworkMessage::Type& msg_type)
         CASE(NetworkMessage::Type::NEXT_MESSAGE_REQUEST_AVAILABLE)
         CASE(NetworkMessage::Type::TIME_STATE_UPDATE)
         CASE(NetworkMessage::Type::MOM_STATUS)
+        CASE(NetworkMessage::Type::DISCOVER_OBJECTS)
+        CASE(NetworkMessage::Type::LEASE_OBJECT_HANDLES)
+        CASE(NetworkMessage::Type::DDM_MODIFY_REGIONS)
+        CASE(NetworkMessage::Type::BATCH_UPDATE_ATTRIBUTE_VALUES)
+        CASE(NetworkMessage::Type::BATCH_REFLECT_ATTRIBUTE_VALUES)
+        CASE(NetworkMessage::Type::PEER_ROUTE)
+        CASE(NetworkMessage::Type::PEER_ROUTES_INVALIDATED)
+        CASE(NetworkMessage::Type::RELAY_OPEN)
+        CASE(NetworkMessage::Type::RELAY_CLOSE)
+        CASE(NetworkMessage::Type::RELAY_DATA)
+        CASE(NetworkMessage::Type::RETRACT)
+        CASE(NetworkMessage::Type::REMOVE_OBJECTS)
+        CASE(NetworkMessage::Type::PEER_FENCE)
 //         CASE(NetworkMessage::Type::LAST)
         default:
             return "Unknown NetworkMessage::Type";
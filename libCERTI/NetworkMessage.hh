@@ -156,6 +156,19 @@ public:
         NEXT_MESSAGE_REQUEST_AVAILABLE,
         TIME_STATE_UPDATE,
         MOM_STATUS,
+        DISCOVER_OBJECTS, // CERTI specific, only RTIG->RTIA
+        LEASE_OBJECT_HANDLES, // CERTI specific
+        DDM_MODIFY_REGIONS, // CERTI specific
+        BATCH_UPDATE_ATTRIBUTE_VALUES, // CERTI specific
+        BATCH_REFLECT_ATTRIBUTE_VALUES, // CERTI specific, only RTIG->RTIA
+        PEER_ROUTE, // CERTI specific, only RTIG->RTIA
+        PEER_ROUTES_INVALIDATED, // CERTI specific, RTIG<->RTIA
+        RELAY_OPEN, // CERTI specific, only relay->RTIG
+        RELAY_CLOSE, // CERTI specific, relay<->RTIG
+        RELAY_DATA, // CERTI specific, relay<->RTIG
+        RETRACT, // CERTI specific
+        REMOVE_OBJECTS, // CERTI specific, only RTIG->RTIA
+        PEER_FENCE, // CERTI specific, RTIA<->RTIG and RTIA->RTIA
         LAST
     };
     
@@ -23,6 +23,7 @@
 
 #include "Object.hh"
 #include "ObjectAttribute.hh"
+#include "OwnershipIndex.hh"
 #include "RTIRegion.hh"
 
 #include <iostream>
@@ -43,6 +44,8 @@ Object::Object(FederateHandle the_owner) : Owner(the_owner)
 //! Destructor.
 Object::~Object()
 {
+    setOwnershipIndex(nullptr);
+
     // We should delete the pointee because it belongs to the object.
     AttributeMap::const_iterator i;
     for (i = _attributeMap.begin(); i != _attributeMap.end(); ++i) {
@@ -77,6 +80,9 @@ void Object::addAttribute(ObjectAttribute* new_attribute)
     if (_attributeMap.find(attributeHandle) != _attributeMap.end())
         throw RTIinternalError("Attribute already defined");
     _attributeMap[attributeHandle] = new_attribute;
+    if (ownershipIndex) {
+        new_attribute->setOwnershipIndex(ownershipIndex, handle);
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -100,9 +106,28 @@ void Object::setClass(ObjectClassHandle h)
 // ----------------------------------------------------------------------------
 void Object::setOwner(FederateHandle the_federate)
 {
+    if (ownershipIndex) {
+        ownershipIndex->objectOwnerChanged(handle, Owner, the_federate);
+    }
     Owner = the_federate;
 }
 
+// ----------------------------------------------------------------------------
+void Object::setOwnershipIndex(OwnershipIndex* index)
+{
+    if (ownershipIndex) {
+        ownershipIndex->objectOwnerChanged(handle, Owner, 0);
+    }
+    ownershipIndex = index;
+    if (ownershipIndex) {
+        ownershipIndex->objectOwnerChanged(handle, 0, Owner);
+    }
+
+    for (const auto& pair : _attributeMap) {
+        pair.second->setOwnershipIndex(index, handle);
+    }
+}
+
 // ----------------------------------------------------------------------------
 //! Verify that the attribute owner is federate.
 bool Object::isAttributeOwnedByFederate(FederateHandle the_federate, AttributeHandle the_attribute) const
@@ -28,6 +28,7 @@
 // forward declaration
 namespace certi {
 class ObjectAttribute;
+class OwnershipIndex;
 class RTIRegion;
 }
 
@@ -64,6 +65,12 @@ public:
     }
     void setOwner(FederateHandle);
 
+    /** Report ownership changes of this object and of its attributes to index.
+     *
+     * The handle must be set before, it is the key of the index.
+     */
+    void setOwnershipIndex(OwnershipIndex* index);
+
     void unassociate(RTIRegion*);
 
     void killFederate(FederateHandle);
@@ -79,6 +86,8 @@ private:
     AttributeMap _attributeMap;
 
     ObjectClassHandle classHandle; //! Object Class
+
+    OwnershipIndex* ownershipIndex{nullptr};
 };
 }
 
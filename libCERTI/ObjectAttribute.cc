@@ -22,6 +22,7 @@
 // ----------------------------------------------------------------------------
 
 #include "ObjectAttribute.hh"
+#include "OwnershipIndex.hh"
 #include "PrettyDebug.hh"
 #include "RTIRegion.hh"
 
@@ -39,14 +40,22 @@ static PrettyDebug D("OBJECTATTRIBUTE", "(Obj_Attr) - ");
 ObjectAttribute::ObjectAttribute(AttributeHandle new_handle,
                                  FederateHandle new_owner,
                                  ObjectClassAttribute* associated_attribute)
-    : handle(new_handle), owner(new_owner), divesting(false), space(0), source(associated_attribute), region(0)
+    : handle(new_handle),
+      owner(new_owner),
+      divesting(false),
+      space(0),
+      source(associated_attribute),
+      region(0),
+      ownershipIndex(0),
+      object(0)
 {
 }
 
 // ----------------------------------------------------------------------------
-//! Destructor (nothing to do).
+//! Destructor, the attribute is no longer owned by anyone.
 ObjectAttribute::~ObjectAttribute()
 {
+    setOwnershipIndex(0, 0);
 }
 
 // ----------------------------------------------------------------------------
@@ -69,9 +78,26 @@ FederateHandle ObjectAttribute::getOwner() const
 //! Change the federate owner.
 void ObjectAttribute::setOwner(FederateHandle newOwner)
 {
+    if (ownershipIndex) {
+        ownershipIndex->attributeOwnerChanged(object, handle, owner, newOwner);
+    }
     owner = newOwner;
 }
 
+// ----------------------------------------------------------------------------
+//! Register the current owner in index, and keep it informed of later changes.
+void ObjectAttribute::setOwnershipIndex(OwnershipIndex* index, ObjectHandle the_object)
+{
+    if (ownershipIndex) {
+        ownershipIndex->attributeOwnerChanged(object, handle, owner, 0);
+    }
+    ownershipIndex = index;
+    object = the_object;
+    if (ownershipIndex) {
+        ownershipIndex->attributeOwnerChanged(object, handle, 0, owner);
+    }
+}
+
 // ----------------------------------------------------------------------------
 //! Returns attribute divesting state.
 bool ObjectAttribute::beingDivested() const
@@ -36,6 +36,8 @@ class RTIRegion;
 
 class ObjectClassAttribute;
 
+class OwnershipIndex;
+
 //! Object attribute information.
 /*! This class maintains information about an attribute:
   - handle,
@@ -56,6 +58,9 @@ public:
     FederateHandle getOwner() const;
     void setOwner(FederateHandle NewOwner);
 
+    /// Report ownership changes of this attribute of the_object to index.
+    void setOwnershipIndex(OwnershipIndex* index, ObjectHandle the_object);
+
     void setDivesting(bool divesting_state);
     bool beingDivested() const;
 
@@ -95,6 +100,8 @@ private:
     SpaceHandle space; //!< Associated routing space
     ObjectClassAttribute* source; //!< The associated class attribute.
     RTIRegion* region;
+    OwnershipIndex* ownershipIndex; //!< Notified of owner changes, may be null.
+    ObjectHandle object; //!< The object holding this attribute, for the index.
 };
 }
 
@@ -36,6 +36,7 @@
 #include <cassert>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <sstream>
 
 #include <include/make_unique.hh>
@@ -68,6 +69,8 @@ AttributeHandle ObjectClass::addAttribute(ObjectClassAttribute* theAttribute, bo
         theAttribute->level = securityLevelId;
 
     _handleClassAttributeMap[attributeHandle] = theAttribute;
+    setCompiledFom(nullptr);
+    invalidateRoutingTable();
 
     Debug(D, pdProtocol) << "ObjectClass " << handle << " has a new attribute " << attributeHandle << std::endl;
 
@@ -97,7 +100,7 @@ void ObjectClass::addInheritedClassAttributes(ObjectClass* the_child)
   take a look at ObjectClassSet::RegisterObject to understand
   what is going on...
 */
-Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList, const Object* source)
+Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList)
 {
     Debug(G, pdGendoc) << "enter ObjectClass::broadcastClassMessage" << std::endl;
     // 1. Set ObjectHandle to local class Handle.
@@ -105,19 +108,8 @@ Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList,
 
     Debug(G, pdGendoc) << "      ObjectClass::broadcastClassMessage handle " << handle << std::endl;
     // 2. Update message attribute list by removing child's attributes.
-    if ((ocbList->getMsg().getMessageType() == NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES)) {
-        for (uint32_t attr = 0; attr < (ocbList->getMsgRAV()->getAttributesSize());) {
-            // If the attribute is not in that class, remove it from the message.
-            if (hasAttribute(ocbList->getMsgRAV()->getAttributes(attr))) {
-                ++attr;
-            }
-            else {
-                ocbList->getMsgRAV()->removeAttributes(attr);
-            }
-        }
-    }
     if ((ocbList->getMsg().getMessageType() == NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION)) {
-        for (uint32_t attr = 0; attr < (ocbList->getMsgRAV()->getAttributesSize());) {
+        for (uint32_t attr = 0; attr < (ocbList->getMsgRAOA()->getAttributesSize());) {
             // If the attribute is not in that class, remove it from the message.
             if (hasAttribute(ocbList->getMsgRAOA()->getAttributes(attr))) {
                 ++attr;
@@ -141,26 +133,6 @@ Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList,
         }
     } break;
 
-    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
-        // For each class attribute, update the list by adding federates who
-        // subscribed to the attribute.
-        for (uint32_t i = 0; i < ocbList->getMsgRAV()->getAttributesSize(); ++i) {
-            AttributeHandle attributeHandle = ocbList->getMsgRAV()->getAttributes(i);
-
-            HandleClassAttributeMap::iterator a = _handleClassAttributeMap.find(attributeHandle);
-            // May be this is a hard error?
-            if (a == _handleClassAttributeMap.end()) {
-                continue;
-            }
-
-            ObjectAttribute* attr = source->getAttribute(attributeHandle);
-            const RTIRegion* update_region = attr->getRegion();
-            Debug(D, pdTrace) << "RAV: attr " << attributeHandle << " / region "
-                              << (update_region ? update_region->getHandle() : 0) << std::endl;
-            a->second->updateBroadcastList(ocbList, update_region);
-        }
-    } break;
-
     case NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION: {
         // For each class attribute, update the list be adding federates who
         // subscribed to the attribute.
@@ -181,34 +153,27 @@ Responses ObjectClass::broadcastClassMessage(ObjectClassBroadcastList* ocbList,
 }
 
 // ----------------------------------------------------------------------------
-//! sendToFederate.
-void ObjectClass::sendToFederate(NetworkMessage* msg, FederateHandle theFederate)
+void ObjectClass::respondTo(FederateHandle theFederate, std::unique_ptr<NetworkMessage> msg, Responses& responses)
 {
-    // Send the message 'msg' to the Federate which Handle is theFederate.
-    Socket* socket = NULL;
     try {
 #ifdef HLA_USES_UDP
-        socket = server->getSocketLink(theFederate, BEST_EFFORT);
+        responses.emplace_back(server->getSocketLink(theFederate, BEST_EFFORT), std::move(msg));
 #else
-        socket = server->getSocketLink(theFederate);
+        responses.emplace_back(server->getSocketLink(theFederate), std::move(msg));
 #endif
-        msg->send(socket, NM_msgBufSend);
     }
     catch (RTIinternalError& e) {
         Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting" << std::endl;
     }
-    catch (NetworkError& e) {
-        Debug(D, pdExcept) << "Network error while broadcasting, ignoring" << std::endl;
-    }
-    // BUG: If except = 0, could use Multicast.
 }
 
 // ----------------------------------------------------------------------------
-void ObjectClass::sendToOwners(CDiffusion& diffusionList,
-                               Object* object,
-                               FederateHandle theFederate,
-                               const std::string& theTag,
-                               NM_Attribute_Ownership_Base& answer)
+template <typename Answer>
+void ObjectClass::respondToOwners(CDiffusion& diffusionList,
+                                  Object* object,
+                                  FederateHandle theFederate,
+                                  const std::string& theTag,
+                                  Responses& responses)
 {
     int nbAttributes = diffusionList.size();
 
@@ -216,27 +181,28 @@ void ObjectClass::sendToOwners(CDiffusion& diffusionList,
     for (int i = 0; i < nbAttributes; i++) {
         toFederate = diffusionList[i].federate;
         if (toFederate != 0) {
-            answer.setFederation(server->federation().get());
-            answer.setFederate(theFederate);
-            answer.setObject(object->getHandle());
-            answer.setLabel(theTag);
-            answer.setAttributesSize(nbAttributes);
+            auto answer = make_unique<Answer>();
+            answer->setFederation(server->federation().get());
+            answer->setFederate(theFederate);
+            answer->setObject(object->getHandle());
+            answer->setLabel(theTag);
+            answer->setAttributesSize(nbAttributes);
 
             int index = 0;
             for (int j = i; j < nbAttributes; j++) {
                 if (diffusionList[j].federate == toFederate) {
                     Debug(D, pdDebug) << "handle : " << diffusionList[j].attribute << std::endl;
                     diffusionList[j].federate = 0;
-                    answer.setAttributes(diffusionList[j].attribute, index);
+                    answer->setAttributes(diffusionList[j].attribute, index);
                     index++;
                 }
             }
-            Debug(D, pdDebug) << "Envoi message type " << answer.getMessageName() << std::endl;
-            answer.setAttributesSize(index);
-            sendToFederate(&answer, toFederate);
+            Debug(D, pdDebug) << "Envoi message type " << answer->getMessageName() << std::endl;
+            answer->setAttributesSize(index);
+            respondTo(toFederate, std::move(answer), responses);
         }
     }
-} /* end if sendToOwners */
+} /* end if respondToOwners */
 
 // ----------------------------------------------------------------------------
 /*! Throw SecurityError if the Federate is not allowed to access the
@@ -470,9 +436,16 @@ const std::string& ObjectClass::getAttributeName(AttributeHandle the_handle) con
  */
 ObjectClassAttribute* ObjectClass::getAttribute(AttributeHandle the_handle) const
 {
-    HandleClassAttributeMap::const_iterator i = _handleClassAttributeMap.find(the_handle);
-    if (i != _handleClassAttributeMap.end()) {
-        return i->second;
+    if (my_compiled_class) {
+        if (the_handle < my_compiled_class->definitions.size() && my_compiled_class->definitions[the_handle]) {
+            return my_compiled_class->definitions[the_handle];
+        }
+    }
+    else {
+        HandleClassAttributeMap::const_iterator i = _handleClassAttributeMap.find(the_handle);
+        if (i != _handleClassAttributeMap.end()) {
+            return i->second;
+        }
     }
 
     Debug(D, pdExcept) << "ObjectClass " << handle << ": Attribute " << the_handle << " not defined." << std::endl;
@@ -487,9 +460,19 @@ ObjectClassAttribute* ObjectClass::getAttribute(AttributeHandle the_handle) cons
 //! Return true if the attribute with the given handle is an attribute of this object class
 bool ObjectClass::hasAttribute(AttributeHandle attributeHandle) const
 {
+    if (my_compiled_class) {
+        return my_compiled_class->attributes.test(attributeHandle);
+    }
     return _handleClassAttributeMap.find(attributeHandle) != _handleClassAttributeMap.end();
 }
 
+// ----------------------------------------------------------------------------
+void ObjectClass::setCompiledFom(std::shared_ptr<const CompiledFom> fom)
+{
+    my_compiled_class = fom ? fom->findObjectClass(handle) : nullptr;
+    my_compiled_fom = my_compiled_class ? std::move(fom) : nullptr;
+}
+
 // ----------------------------------------------------------------------------
 //! Return true if the Federate is publishing any attribute of this class.
 bool ObjectClass::isFederatePublisher(FederateHandle the_federate) const
@@ -535,7 +518,7 @@ bool ObjectClass::isInstanceInClass(ObjectHandle objectHandle)
 
 // ----------------------------------------------------------------------------
 //! killFederate.
-std::pair<ObjectClassBroadcastList*, Responses> ObjectClass::killFederate(FederateHandle the_federate) noexcept
+void ObjectClass::killFederate(FederateHandle the_federate) noexcept
 {
     Debug(D, pdRegister) << "Object Class " << handle << ": Killing Federate " << the_federate << std::endl;
 
@@ -555,23 +538,68 @@ std::pair<ObjectClassBroadcastList*, Responses> ObjectClass::killFederate(Federa
     catch (SecurityError& e) {
     }
 
-    // Does federate owns instances ?
-    for (HandleObjectMap::const_iterator i = _handleObjectMap.begin(); i != _handleObjectMap.end(); ++i) {
-        if (i->second->getOwner() == the_federate) {
-            // Return non-NULL to indicate that :
-            // 1- A RemoveObject message should be broadcasted through parent
-            // class
-            // 2- The federate may own another instance, and this function
-            // must be called again.
-            // BUG: String \/
-            return deleteInstance(the_federate, i->second, "Killed");
+    Debug(D, pdRegister) << "Object Class " << handle << ":Federate " << the_federate << " killed" << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+Responses
+ObjectClass::killInstances(FederateHandle the_federate, const std::vector<Object*>& objects, const std::string& the_tag)
+{
+    Responses ret;
+
+    for (const auto& object : objects) {
+        _handleObjectMap.erase(object->getHandle());
+    }
+
+    if (!server) {
+        return ret;
+    }
+
+    // Like broadcastClassMessage, each federate is told at the most derived
+    // class it subscribed to.
+    std::vector<std::pair<ObjectClassHandle, std::vector<Socket*>>> recipients;
+    std::set<FederateHandle> reached;
+    for (const ObjectClass* level = this; level; level = level->my_superclass) {
+        std::vector<Socket*> sockets;
+        for (FederateHandle federate = 1; federate <= level->maxSubscriberHandle; ++federate) {
+            if (federate == the_federate || !level->isSubscribed(federate) || !reached.insert(federate).second) {
+                continue;
+            }
+            try {
+#ifdef HLA_USES_UDP
+                sockets.push_back(server->getSocketLink(federate, BEST_EFFORT));
+#else
+                sockets.push_back(server->getSocketLink(federate));
+#endif
+            }
+            catch (Exception& e) {
+                Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
+            }
+        }
+        if (!sockets.empty()) {
+            recipients.emplace_back(level->handle, std::move(sockets));
         }
     }
 
-    Debug(D, pdRegister) << "Object Class " << handle << ":Federate " << the_federate << " killed" << std::endl;
+    Debug(D, pdRegister) << objects.size() << " objects of killed federate " << the_federate << " removed in class "
+                         << handle << ", " << reached.size() << " federates to notify" << std::endl;
 
-    // Return NULL if the Federate did not own any instance.
-    return {nullptr, Responses()};
+    // One message per class the objects are removed as, unpacked by the RTIA.
+    for (const auto& recipient : recipients) {
+        auto answer = make_unique<NM_Remove_Objects>();
+        answer->setFederation(server->federation().get());
+        answer->setFederate(the_federate);
+        answer->setObjectClass(recipient.first);
+        answer->setObjectsSize(objects.size());
+        for (uint32_t i = 0; i < objects.size(); ++i) {
+            answer->setObjects(objects[i]->getHandle(), i);
+        }
+        answer->setLabel(the_tag);
+
+        ret.emplace_back(recipient.second, std::move(answer));
+    }
+
+    return ret;
 }
 
 // ----------------------------------------------------------------------------
@@ -691,48 +719,36 @@ ObjectClass::registerObjectInstance(FederateHandle the_federate, Object* the_obj
 }
 
 // ----------------------------------------------------------------------------
-/** Send a "Discover Object" message to a federate for each object of
-    this class, if the federate was not already subscribed. Subclass
+/** Add to discoveries each object of this class not owned by the
+    federate, if the federate was not already subscribed. Subclass
     objects are not considered. Objects may actually be of a
     superclass.
-    @param federate Federate to send discovery messages to
+    @param federate Federate discovering the objects
     @param super_handle Handle of the class of objects to be
     discovered
+    @param discoveries Message the objects are added to
     @return true if the process should be applied to subclasses too
  */
-bool ObjectClass::sendDiscoverMessages(FederateHandle federate, ObjectClassHandle super_handle)
+bool ObjectClass::addDiscoveries(FederateHandle federate,
+                                 ObjectClassHandle super_handle,
+                                 NM_Discover_Objects& discoveries)
 {
     // If we are in a subclass to which the federate is already subscribed,
     if ((handle != super_handle) && isSubscribed(federate))
         return false;
 
-    // Else, send message for each object
     for (HandleObjectMap::const_iterator i = _handleObjectMap.begin(); i != _handleObjectMap.end(); ++i) {
         if (i->second->getOwner() != federate) {
-            NM_Discover_Object message;
-            Debug(D, pdInit) << "Sending DiscoverObj to Federate " << federate << " for Object "
-                             << i->second->getHandle() << " in class " << handle << std::endl;
-
-            message.setFederation(server->federation().get());
-            message.setFederate(federate);
-            message.setException(Exception::Type::NO_EXCEPTION);
-            message.setObjectClass(super_handle);
-            message.setObject(i->second->getHandle());
-            message.setLabel(i->second->getName());
-            //BUG FIXME strange!!
-            //message.setDate(0.0);
-
-            Socket* socket = NULL;
-            try {
-                socket = server->getSocketLink(federate);
-                message.send(socket, NM_msgBufSend);
-            }
-            catch (RTIinternalError& e) {
-                Debug(D, pdExcept) << "Reference to a killed Federate while sending DO msg." << std::endl;
-            }
-            catch (NetworkError& e) {
-                Debug(D, pdExcept) << "Network error while sending DO msg, ignoring." << std::endl;
-            }
+            Debug(D, pdInit) << "Federate " << federate << " discovers Object " << i->second->getHandle()
+                             << " in class " << handle << std::endl;
+
+            const uint32_t rank = discoveries.getObjectsSize();
+            discoveries.setObjectClassesSize(rank + 1);
+            discoveries.setObjectsSize(rank + 1);
+            discoveries.setObjectNamesSize(rank + 1);
+            discoveries.setObjectClasses(super_handle, rank);
+            discoveries.setObjects(i->second->getHandle(), rank);
+            discoveries.setObjectNames(i->second->getName(), rank);
         }
     }
 
@@ -781,23 +797,21 @@ bool ObjectClass::subscribe(FederateHandle fed, const std::vector<AttributeHandl
     for (std::vector<AttributeHandle>::const_iterator it = attributes.begin(); it != attributes.end(); ++it) {
         getAttribute(*it)->subscribe(fed, region);
     }
+    invalidateRoutingTable();
 
     return (attributes.size() > 0) && !was_subscriber;
 } /* end of subscribe */
 
 // ----------------------------------------------------------------------------
 //! update Attribute Values with time.
-std::pair<ObjectClassBroadcastList*, Responses>
-ObjectClass::updateAttributeValues(FederateHandle the_federate,
-                                   Object* object,
-                                   const std::vector<AttributeHandle>& the_attributes,
-                                   const std::vector<AttributeValue_t>& the_values,
-                                   int the_size,
-                                   FederationTime the_time,
-                                   const std::string& the_tag)
+Responses ObjectClass::updateAttributeValues(FederateHandle the_federate,
+                                             Object* object,
+                                             const std::vector<AttributeHandle>& the_attributes,
+                                             const std::vector<AttributeValue_t>& the_values,
+                                             int the_size,
+                                             FederationTime the_time,
+                                             const std::string& the_tag)
 {
-    Responses ret;
-
     // Ownership management: Test ownership on each attribute before updating.
     ObjectAttribute* oa;
     for (int i = 0; i < the_size; i++) {
@@ -809,52 +823,42 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
     }
 
     // Prepare and Broadcast message for this class
-    ObjectClassBroadcastList* ocbList = NULL;
-    if (server != NULL) {
-        auto answer = make_unique<NM_Reflect_Attribute_Values>();
-        answer->setFederation(server->federation().get());
-        answer->setFederate(the_federate);
-        answer->setException(Exception::Type::NO_EXCEPTION);
-        answer->setObject(object->getHandle());
-        // with time
-        answer->setDate(the_time);
-        answer->setLabel(the_tag);
-        answer->setAttributesSize(the_size);
-        answer->setValuesSize(the_size);
-
-        for (int32_t i = 0; i < the_size; i++) {
-            answer->setAttributes(the_attributes[i], i);
-            answer->setValues(the_values[i], i);
-        }
-
-        ocbList = new ObjectClassBroadcastList(std::move(answer), _handleClassAttributeMap.size());
-
-        Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle
-                             << ", now broadcasting..." << std::endl;
-
-        ret = broadcastClassMessage(ocbList, object);
-    }
-    else {
+    if (server == NULL) {
         Debug(D, pdExcept) << "UpdateAttributeValues should not be called on the RTIA." << std::endl;
         throw RTIinternalError("UpdateAttributeValues called on the RTIA.");
     }
 
-    // Return the BroadcastList in case it had to be passed to the parent
-    // class.
-    return {ocbList, std::move(ret)};
+    auto answer = make_unique<NM_Reflect_Attribute_Values>();
+    answer->setFederation(server->federation().get());
+    answer->setFederate(the_federate);
+    answer->setException(Exception::Type::NO_EXCEPTION);
+    answer->setObject(object->getHandle());
+    // with time
+    answer->setDate(the_time);
+    answer->setLabel(the_tag);
+    answer->setAttributesSize(the_size);
+    answer->setValuesSize(the_size);
+
+    for (int32_t i = 0; i < the_size; i++) {
+        answer->setAttributes(the_attributes[i], i);
+        answer->setValues(the_values[i], i);
+    }
+
+    Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle
+                         << ", now broadcasting..." << std::endl;
+
+    return broadcastReflection(std::move(answer), object);
 }
 
 // ----------------------------------------------------------------------------
 //! update Attribute Values without time.
-std::pair<ObjectClassBroadcastList*, Responses>
-ObjectClass::updateAttributeValues(FederateHandle the_federate,
-                                   Object* object,
-                                   const std::vector<AttributeHandle>& the_attributes,
-                                   const std::vector<AttributeValue_t>& the_values,
-                                   int the_size,
-                                   const std::string& the_tag)
+Responses ObjectClass::updateAttributeValues(FederateHandle the_federate,
+                                             Object* object,
+                                             const std::vector<AttributeHandle>& the_attributes,
+                                             const std::vector<AttributeValue_t>& the_values,
+                                             int the_size,
+                                             const std::string& the_tag)
 {
-    Responses ret;
     // Ownership management: Test ownership on each attribute before updating.
     ObjectAttribute* oa;
     for (int i = 0; i < the_size; i++) {
@@ -867,40 +871,150 @@ ObjectClass::updateAttributeValues(FederateHandle the_federate,
     }
 
     // Prepare and Broadcast message for this class
-    ObjectClassBroadcastList* ocbList = NULL;
-    if (server != NULL) {
-        auto answer = make_unique<NM_Reflect_Attribute_Values>();
-        answer->setFederation(server->federation().get());
-        answer->setFederate(the_federate);
-        answer->setException(Exception::Type::NO_EXCEPTION);
-        answer->setObject(object->getHandle());
-        // without time
+    if (server == NULL) {
+        Debug(D, pdExcept) << "UpdateAttributeValues should not be called on the RTIA." << std::endl;
+        throw RTIinternalError("UpdateAttributeValues called on the RTIA.");
+    }
 
-        answer->setLabel(the_tag);
+    auto answer = make_unique<NM_Reflect_Attribute_Values>();
+    answer->setFederation(server->federation().get());
+    answer->setFederate(the_federate);
+    answer->setException(Exception::Type::NO_EXCEPTION);
+    answer->setObject(object->getHandle());
+    // without time
+
+    answer->setLabel(the_tag);
+
+    answer->setAttributesSize(the_size);
+    answer->setValuesSize(the_size);
+
+    for (int32_t i = 0; i < the_size; i++) {
+        answer->setAttributes(the_attributes[i], i);
+        answer->setValues(the_values[i], i);
+    }
+
+    Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle
+                         << ", now broadcasting..." << std::endl;
+
+    return broadcastReflection(std::move(answer), object);
+}
+
+// ----------------------------------------------------------------------------
+const ObjectClass::RoutingTable& ObjectClass::getRoutingTable()
+{
+    if (my_routing_table_is_valid.load(std::memory_order_acquire)) {
+        return my_routing_table;
+    }
+
+    // the updates of different objects of the class may be routed at once
+    std::lock_guard<std::mutex> lock(my_routing_table_mutex);
+    if (my_routing_table_is_valid.load(std::memory_order_relaxed)) {
+        return my_routing_table;
+    }
 
-        answer->setAttributesSize(the_size);
-        answer->setValuesSize(the_size);
+    Debug(D, pdTrace) << "Computing routing table of class " << handle << std::endl;
 
-        for (int32_t i = 0; i < the_size; i++) {
-            answer->setAttributes(the_attributes[i], i);
-            answer->setValues(the_values[i], i);
+    // Subscriptions at this class come first, so that the first route found
+    // for a federate is the most specific one.
+    my_routing_table.clear();
+    for (const auto& attribute : _handleClassAttributeMap) {
+        auto& routes = my_routing_table[attribute.first];
+        for (const ObjectClass* level = this; level; level = level->my_superclass) {
+            auto level_attribute = level->_handleClassAttributeMap.find(attribute.first);
+            if (level_attribute == level->_handleClassAttributeMap.end()) {
+                break;
+            }
+            for (const auto& subscriber : level_attribute->second->getSubscribers()) {
+                routes.push_back({subscriber, level->handle});
+            }
         }
+    }
 
-        ocbList = new ObjectClassBroadcastList(std::move(answer), _handleClassAttributeMap.size());
+    my_routing_table_is_valid.store(true, std::memory_order_release);
+    return my_routing_table;
+}
 
-        Debug(D, pdProtocol) << "Object " << object->getHandle() << " updated in class " << handle
-                             << ", now broadcasting..." << std::endl;
+// ----------------------------------------------------------------------------
+void ObjectClass::invalidateRoutingTable()
+{
+    if (my_routing_table_is_valid) {
+        my_routing_table_is_valid = false;
+        my_routing_table.clear();
+    }
 
-        ret = broadcastClassMessage(ocbList, object);
+    for (ObjectClassSet::const_iterator i = subClasses->begin(); i != subClasses->end(); ++i) {
+        i->second->invalidateRoutingTable();
     }
-    else {
-        Debug(D, pdExcept) << "UpdateAttributeValues should not be called on the RTIA." << std::endl;
-        throw RTIinternalError("UpdateAttributeValues called on the RTIA.");
+}
+
+// ----------------------------------------------------------------------------
+/*! Send the reflection to every federate subscribed to at least one of its
+  attributes, with a region overlapping the update region. Federates
+  receiving the same attributes share the same message.
+*/
+Responses ObjectClass::broadcastReflection(std::unique_ptr<NM_Reflect_Attribute_Values> message,
+                                           const Object* object)
+{
+    Responses ret;
+
+    const RoutingTable& table = getRoutingTable();
+
+    // For each recipient, the indices of the attributes it should receive
+    std::map<FederateHandle, std::vector<uint32_t>> recipients;
+    for (uint32_t i = 0; i < message->getAttributesSize(); ++i) {
+        AttributeHandle attribute = message->getAttributes(i);
+
+        auto routes = table.find(attribute);
+        if (routes == table.end()) {
+            continue;
+        }
+
+        const RTIRegion* update_region = object->getAttribute(attribute)->getRegion();
+        for (const auto& route : routes->second) {
+            FederateHandle federate = route.subscriber.getHandle();
+            if (federate == message->getFederate() || !route.subscriber.match(update_region)) {
+                continue;
+            }
+
+            auto& indices = recipients[federate];
+            if (indices.empty() || indices.back() != i) {
+                Debug(D, pdTrace) << "RAV: attr " << attribute << " to federate " << federate << " as class "
+                                  << route.objectClass << std::endl;
+                indices.push_back(i);
+            }
+        }
     }
 
-    // Return the BroadcastList in case it had to be passed to the parent
-    // class.
-    return {ocbList, std::move(ret)};
+    std::map<std::vector<uint32_t>, std::vector<Socket*>> groups;
+    for (const auto& recipient : recipients) {
+        try {
+#ifdef HLA_USES_UDP
+            groups[recipient.second].push_back(server->getSocketLink(recipient.first, BEST_EFFORT));
+#else
+            groups[recipient.second].push_back(server->getSocketLink(recipient.first));
+#endif
+        }
+        catch (Exception& e) {
+            Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
+        }
+    }
+
+    for (const auto& group : groups) {
+        auto reflection = make_unique<NM_Reflect_Attribute_Values>(*message);
+        if (group.first.size() != message->getAttributesSize()) {
+            reflection->setAttributesSize(group.first.size());
+            reflection->setValuesSize(group.first.size());
+            for (uint32_t i = 0; i < group.first.size(); ++i) {
+                reflection->setAttributes(message->getAttributes(group.first[i]), i);
+                reflection->setValues(message->getValues(group.first[i]), i);
+            }
+        }
+        Debug(D, pdProtocol) << "Broadcasting " << group.first.size() << " attributes to " << group.second.size()
+                             << " federates" << std::endl;
+        ret.emplace_back(group.second, std::unique_ptr<NetworkMessage>(reflection.release()));
+    }
+
+    return ret;
 }
 
 // ----------------------------------------------------------------------------
@@ -947,7 +1061,7 @@ ObjectClass::negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateH
 
     if (server != NULL) {
         auto answerAssumption = make_unique<NM_Request_Attribute_Ownership_Assumption>();
-        NM_Attribute_Ownership_Divestiture_Notification AnswerDivestiture;
+        auto answerDivestiture = make_unique<NM_Attribute_Ownership_Divestiture_Notification>();
 
         answerAssumption->setAttributesSize(theAttributeList.size());
 
@@ -976,7 +1090,7 @@ ObjectClass::negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateH
                 ++acquisition_count;
                 diffusionAcquisition.push_back(DiffusionPair(NewOwner, oa->getHandle()));
 
-                AnswerDivestiture.setAttributes(theAttributeList[i], divestiture_count);
+                answerDivestiture->setAttributes(theAttributeList[i], divestiture_count);
                 divestiture_count++;
                 /* FIXME not sure that this should be done */
                 if (oca->isNamed("privilegeToDelete")) {
@@ -991,17 +1105,17 @@ ObjectClass::negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateH
         }
 
         if (acquisition_count != 0) {
-            NM_Attribute_Ownership_Acquisition_Notification AOAN;
-            sendToOwners(diffusionAcquisition, object, theFederateHandle, theTag, AOAN);
+            respondToOwners<NM_Attribute_Ownership_Acquisition_Notification>(
+                diffusionAcquisition, object, theFederateHandle, theTag, ret);
         }
 
         if (divestiture_count != 0) {
-            AnswerDivestiture.setFederation(server->federation().get());
-            AnswerDivestiture.setFederate(theFederateHandle);
-            AnswerDivestiture.setObject(object->getHandle());
-            AnswerDivestiture.setLabel(std::string());
-            AnswerDivestiture.setAttributesSize(divestiture_count);
-            sendToFederate(&AnswerDivestiture, theFederateHandle);
+            answerDivestiture->setFederation(server->federation().get());
+            answerDivestiture->setFederate(theFederateHandle);
+            answerDivestiture->setObject(object->getHandle());
+            answerDivestiture->setLabel(std::string());
+            answerDivestiture->setAttributesSize(divestiture_count);
+            respondTo(theFederateHandle, std::move(answerDivestiture), ret);
         }
 
         if (assumption_count != 0) {
@@ -1016,7 +1130,8 @@ ObjectClass::negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateH
 
             Debug(D, pdProtocol) << "Object " << object->getHandle() << " divestiture in class " << handle
                                  << ", now broadcasting..." << std::endl;
-            ret = broadcastClassMessage(List);
+            auto broadcast = broadcastClassMessage(List);
+            ret.insert(end(ret), make_move_iterator(begin(broadcast)), make_move_iterator(end(broadcast)));
         }
     }
     else {
@@ -1030,10 +1145,12 @@ ObjectClass::negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateH
 
 // ----------------------------------------------------------------------------
 //! attributeOwnershipAcquisitionIfAvailable.
-void ObjectClass::attributeOwnershipAcquisitionIfAvailable(FederateHandle the_federate,
-                                                           Object* object,
-                                                           const std::vector<AttributeHandle>& the_attributes)
+Responses ObjectClass::attributeOwnershipAcquisitionIfAvailable(FederateHandle the_federate,
+                                                                Object* object,
+                                                                const std::vector<AttributeHandle>& the_attributes)
 {
+    Responses ret;
+
     // Do all attribute handles exist ? It may throw AttributeNotDefined.
     for (unsigned index = 0; index < the_attributes.size(); index++) {
         getAttribute(the_attributes[index]);
@@ -1063,15 +1180,14 @@ void ObjectClass::attributeOwnershipAcquisitionIfAvailable(FederateHandle the_fe
                 throw AttributeAlreadyBeingAcquired("");
         }
 
-        NM_Attribute_Ownership_Acquisition_Notification* Answer_notification
-            = new NM_Attribute_Ownership_Acquisition_Notification();
+        auto Answer_notification = make_unique<NM_Attribute_Ownership_Acquisition_Notification>();
         Answer_notification->setFederation(server->federation().get());
         Answer_notification->setFederate(the_federate);
         Answer_notification->setException(Exception::Type::NO_EXCEPTION);
         Answer_notification->setObject(object->getHandle());
         Answer_notification->setAttributesSize(the_attributes.size());
 
-        NM_Attribute_Ownership_Unavailable* Answer_unavailable = new NM_Attribute_Ownership_Unavailable();
+        auto Answer_unavailable = make_unique<NM_Attribute_Ownership_Unavailable>();
         Answer_unavailable->setFederation(server->federation().get());
         Answer_unavailable->setFederate(the_federate);
         Answer_unavailable->setException(Exception::Type::NO_EXCEPTION);
@@ -1121,29 +1237,27 @@ void ObjectClass::attributeOwnershipAcquisitionIfAvailable(FederateHandle the_fe
 
         if (compteur_notification != 0) {
             Answer_notification->setAttributesSize(compteur_notification);
-            sendToFederate(Answer_notification, the_federate);
+            respondTo(the_federate, std::move(Answer_notification), ret);
         }
-        else
-            delete Answer_notification;
 
         Debug(D, pdDebug) << "Start: send divestiture notification message" << std::endl;
 
         if (compteur_divestiture != 0) {
-            NM_Attribute_Ownership_Divestiture_Notification AODN;
-            sendToOwners(diffusionDivestiture, object, the_federate, "\0", AODN);
+            respondToOwners<NM_Attribute_Ownership_Divestiture_Notification>(
+                diffusionDivestiture, object, the_federate, "\0", ret);
         }
 
         if (compteur_unavailable != 0) {
             Answer_unavailable->setAttributesSize(compteur_unavailable);
-            sendToFederate(Answer_unavailable, the_federate);
+            respondTo(the_federate, std::move(Answer_unavailable), ret);
         }
-        else
-            delete Answer_unavailable;
     }
     else {
         Debug(D, pdExcept) << "AttributeOwnershipAcquisitionIfAvailable should not be called on the RTIA." << std::endl;
         throw RTIinternalError("AttributeOwnershipAcquisitionIfAvailable called on the RTIA.");
     }
+
+    return ret;
 }
 
 // ----------------------------------------------------------------------------
@@ -1231,8 +1345,8 @@ std::pair<ObjectClassBroadcastList*, Responses> ObjectClass::unconditionalAttrib
         }
 
         if (!diffusionAcquisition.empty()) {
-            NM_Attribute_Ownership_Acquisition_Notification AOAN;
-            sendToOwners(diffusionAcquisition, object, theFederateHandle, "\0", AOAN);
+            respondToOwners<NM_Attribute_Ownership_Acquisition_Notification>(
+                diffusionAcquisition, object, theFederateHandle, "\0", ret);
         }
     }
     else {
@@ -1249,11 +1363,13 @@ std::pair<ObjectClassBroadcastList*, Responses> ObjectClass::unconditionalAttrib
 
 // ----------------------------------------------------------------------------
 //! attributeOwnershipAcquisition.
-void ObjectClass::attributeOwnershipAcquisition(FederateHandle theFederateHandle,
-                                                Object* object,
-                                                const std::vector<AttributeHandle>& theAttributeList,
-                                                const std::string& theTag)
+Responses ObjectClass::attributeOwnershipAcquisition(FederateHandle theFederateHandle,
+                                                     Object* object,
+                                                     const std::vector<AttributeHandle>& theAttributeList,
+                                                     const std::string& theTag)
 {
+    Responses ret;
+
     // Verification of the conditions should be done before any changes!
     // Pre-conditions checking
     for (unsigned i = 0; i < theAttributeList.size(); i++) {
@@ -1276,8 +1392,7 @@ void ObjectClass::attributeOwnershipAcquisition(FederateHandle theFederateHandle
             Debug(D, pdExcept) << "exception : ObjectClassNotPublished." << std::endl;
             throw ObjectClassNotPublished("");
         }
-        NM_Attribute_Ownership_Acquisition_Notification* AnswerNotification
-            = new NM_Attribute_Ownership_Acquisition_Notification();
+        auto AnswerNotification = make_unique<NM_Attribute_Ownership_Acquisition_Notification>();
 
         AnswerNotification->setFederation(server->federation().get());
         AnswerNotification->setFederate(theFederateHandle);
@@ -1324,33 +1439,34 @@ void ObjectClass::attributeOwnershipAcquisition(FederateHandle theFederateHandle
         }
         if (notification_counter != 0) {
             AnswerNotification->setAttributesSize(notification_counter);
-            sendToFederate(AnswerNotification, theFederateHandle);
+            respondTo(theFederateHandle, std::move(AnswerNotification), ret);
         }
-        else
-            delete AnswerNotification;
 
         if (!diffusionDivestiture.empty()) {
-            NM_Attribute_Ownership_Divestiture_Notification AODN;
-            sendToOwners(diffusionDivestiture, object, theFederateHandle, "\0", AODN);
+            respondToOwners<NM_Attribute_Ownership_Divestiture_Notification>(
+                diffusionDivestiture, object, theFederateHandle, "\0", ret);
         }
 
         if (!diffusionRelease.empty()) {
-            NM_Request_Attribute_Ownership_Release RAOR;
-            sendToOwners(diffusionRelease, object, theFederateHandle, theTag, RAOR);
+            respondToOwners<NM_Request_Attribute_Ownership_Release>(
+                diffusionRelease, object, theFederateHandle, theTag, ret);
         }
     }
     else {
         Debug(D, pdExcept) << "AttributeOwnershipAcquisition should not be called on the RTIA." << std::endl;
         throw RTIinternalError("AttributeOwnershipAcquisition called on the RTIA");
     }
+
+    return ret;
 }
 
 // ----------------------------------------------------------------------------
 //! attributeOwnershipReleaseResponse.
-AttributeHandleSet* ObjectClass::attributeOwnershipReleaseResponse(FederateHandle the_federate,
-                                                                   Object* object,
-                                                                   const std::vector<AttributeHandle>& the_attributes)
+std::pair<AttributeHandleSet*, Responses> ObjectClass::attributeOwnershipReleaseResponse(
+    FederateHandle the_federate, Object* object, const std::vector<AttributeHandle>& the_attributes)
 {
+    Responses ret;
+
     // Pre-conditions checking
 
     // Do all attribute handles exist ? It may throw AttributeNotDefined.
@@ -1406,23 +1522,25 @@ AttributeHandleSet* ObjectClass::attributeOwnershipReleaseResponse(FederateHandl
         }
 
         if (!diffusionAcquisition.empty()) {
-            NM_Attribute_Ownership_Acquisition_Notification AOAN;
-            sendToOwners(diffusionAcquisition, object, the_federate, "\0", AOAN);
+            respondToOwners<NM_Attribute_Ownership_Acquisition_Notification>(
+                diffusionAcquisition, object, the_federate, "\0", ret);
         }
     }
     else {
         Debug(D, pdExcept) << "NegotiatedAttributeOwnershipDivestiture should not be called on the RTIA." << std::endl;
         throw RTIinternalError("NegotiatedAttributeOwnershipDivestiture called on the RTIA.");
     }
-    return (theAttribute);
+    return {theAttribute, std::move(ret)};
 }
 
 // ----------------------------------------------------------------------------
 //! cancelAttributeOwnershipAcquisition.
-void ObjectClass::cancelAttributeOwnershipAcquisition(FederateHandle federate_handle,
-                                                      Object* object,
-                                                      const std::vector<AttributeHandle>& attribute_list)
+Responses ObjectClass::cancelAttributeOwnershipAcquisition(FederateHandle federate_handle,
+                                                           Object* object,
+                                                           const std::vector<AttributeHandle>& attribute_list)
 {
+    Responses ret;
+
     // Pre-conditions checking
 
     // Do all attribute handles exist ? It may throw AttributeNotDefined.
@@ -1450,8 +1568,7 @@ void ObjectClass::cancelAttributeOwnershipAcquisition(FederateHandle federate_ha
             }
         }
 
-        NM_Confirm_Attribute_Ownership_Acquisition_Cancellation* answer_confirmation
-            = new NM_Confirm_Attribute_Ownership_Acquisition_Cancellation();
+        auto answer_confirmation = make_unique<NM_Confirm_Attribute_Ownership_Acquisition_Cancellation>();
         answer_confirmation->setFederation(server->federation().get());
         answer_confirmation->setFederate(federate_handle);
         answer_confirmation->setException(Exception::Type::NO_EXCEPTION);
@@ -1473,15 +1590,15 @@ void ObjectClass::cancelAttributeOwnershipAcquisition(FederateHandle federate_ha
 
         if (compteur_confirmation != 0) {
             answer_confirmation->setAttributesSize(compteur_confirmation);
-            sendToFederate(answer_confirmation, federate_handle);
+            respondTo(federate_handle, std::move(answer_confirmation), ret);
         }
-        else
-            delete answer_confirmation;
     }
     else {
         Debug(D, pdExcept) << "CancelAttributeOwnershipAcquisition should not be called on the RTIA." << std::endl;
         throw RTIinternalError("CancelAttributeOwnershipAcquisition called on the RTIA.");
     }
+
+    return ret;
 }
 
 // ----------------------------------------------------------------------------
@@ -1504,6 +1621,7 @@ void ObjectClass::unsubscribe(FederateHandle fed, const RTIRegion* region)
             i->second->unsubscribe(fed, region);
         }
     }
+    invalidateRoutingTable();
 }
 
 // ----------------------------------------------------------------------------
@@ -1517,6 +1635,7 @@ void ObjectClass::unsubscribe(FederateHandle fed)
             i->second->unsubscribe(fed);
         }
     }
+    invalidateRoutingTable();
 } /* end of unsubscribe */
 
 void ObjectClass::addSubClass(ObjectClass* child)
@@ -1526,6 +1645,7 @@ void ObjectClass::addSubClass(ObjectClass* child)
     subClasses->addClass(child, NULL);
     /* link child to parent */
     child->superClass = handle;
+    child->my_superclass = this;
     /* forward inherited properties to child */
     /* Add Object Class Attribute */
     addInheritedClassAttributes(child);
@@ -1540,17 +1660,20 @@ void ObjectClass::addSubClass(ObjectClass* child)
 /** Recursively start discovery of existing objects.
     @param federate FederateHandle to send the discovery message to
     @param subscription ObjectClassHandle of the class actually subscribed by the federate
+    @param discoveries Message the discovered objects are added to
  */
-void ObjectClass::recursiveDiscovering(FederateHandle federate, ObjectClassHandle subscription)
+void ObjectClass::recursiveDiscovering(FederateHandle federate,
+                                       ObjectClassHandle subscription,
+                                       NM_Discover_Objects& discoveries)
 {
     Debug(D, pdInit) << "Recursive Discovering on class " << handle << " for Federate " << federate << "." << std::endl;
 
-    bool go_deeper = sendDiscoverMessages(federate, subscription);
+    bool go_deeper = addDiscoveries(federate, subscription, discoveries);
 
     if (go_deeper) {
         ObjectClassSet::const_iterator i;
         for (i = subClasses->begin(); i != subClasses->end(); ++i) {
-            i->second->recursiveDiscovering(federate, subscription);
+            i->second->recursiveDiscovering(federate, subscription, discoveries);
         }
     }
 }
@@ -35,16 +35,23 @@ class ObjectClassBroadcastList;
 }
 
 // CERTI headers
+#include "CompiledFom.hh"
 #include "GAV.hh"
 #include "MessageEvent.hh"
 #include "NM_Classes.hh"
 #include "Named.hh"
 #include "SecurityServer.hh"
+#include "Subscribable.hh"
 #include <include/certi.hh>
 
 // Standard
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace certi {
 
@@ -69,6 +76,16 @@ public:
     /// The type for the object instance by handle map.
     typedef std::map<ObjectHandle, Object*> HandleObjectMap;
 
+    /// A subscription to an attribute, at this class or at one of its superclasses.
+    struct Route {
+        Subscriber subscriber;
+        /// The class the attribute was subscribed at
+        ObjectClassHandle objectClass;
+    };
+
+    /// The type for the routes of each attribute of this class.
+    typedef std::unordered_map<AttributeHandle, std::vector<Route>> RoutingTable;
+
     /** Create an objectClass.
      * @param[in] name the object class name
      * @param[in] handle the object class handle value
@@ -147,37 +164,49 @@ public:
                                             const std::vector<AttributeHandle>& theAttributeList,
                                             const std::string& theTag);
 
-    void attributeOwnershipAcquisitionIfAvailable(FederateHandle theFederateHandle,
-                                                  Object* object,
-                                                  const std::vector<AttributeHandle>& theAttributeList);
+    Responses attributeOwnershipAcquisitionIfAvailable(FederateHandle theFederateHandle,
+                                                       Object* object,
+                                                       const std::vector<AttributeHandle>& theAttributeList);
 
     std::pair<ObjectClassBroadcastList*, Responses>
     unconditionalAttributeOwnershipDivestiture(FederateHandle, Object* object, const std::vector<AttributeHandle>&);
 
-    void attributeOwnershipAcquisition(FederateHandle theFederateHandle,
-                                       Object* object,
-                                       const std::vector<AttributeHandle>& theAttributeList,
-                                       const std::string& theTag);
+    Responses attributeOwnershipAcquisition(FederateHandle theFederateHandle,
+                                            Object* object,
+                                            const std::vector<AttributeHandle>& theAttributeList,
+                                            const std::string& theTag);
 
-    AttributeHandleSet* attributeOwnershipReleaseResponse(FederateHandle theFederateHandle,
-                                                          Object* object,
-                                                          const std::vector<AttributeHandle>& theAttributeList);
+    std::pair<AttributeHandleSet*, Responses> attributeOwnershipReleaseResponse(
+        FederateHandle theFederateHandle, Object* object, const std::vector<AttributeHandle>& theAttributeList);
 
-    void cancelAttributeOwnershipAcquisition(FederateHandle theFederateHandle,
-                                             Object* object,
-                                             const std::vector<AttributeHandle>& theAttributeList);
+    Responses cancelAttributeOwnershipAcquisition(FederateHandle theFederateHandle,
+                                                  Object* object,
+                                                  const std::vector<AttributeHandle>& theAttributeList);
 
     // RTI Support Services
     AttributeHandle getAttributeHandle(const std::string& theName) const;
 
     const std::string& getAttributeName(AttributeHandle theHandle) const;
 
-    std::pair<ObjectClassBroadcastList*, Responses> killFederate(FederateHandle theFederate) noexcept;
+    /// Remove the publications and subscriptions of the federate.
+    void killFederate(FederateHandle theFederate) noexcept;
+
+    /** Remove instances of this class deleted because their owner was killed.
+     *
+     * The RemoveObject recipients, here and in the superclasses, are
+     * computed once for the whole batch.
+     */
+    Responses killInstances(FederateHandle theFederate, const std::vector<Object*>& objects, const std::string& theTag);
 
     ObjectClassAttribute* getAttribute(AttributeHandle the_handle) const;
 
     bool hasAttribute(AttributeHandle theHandle) const;
 
+    /** Look the attributes up in the compiled fom, nullptr to search the attribute map again.
+     * fom must be compiled from the current attributes of this class, adding one drops it.
+     */
+    void setCompiledFom(std::shared_ptr<const CompiledFom> fom);
+
     // Instance Management
     std::pair<ObjectClassBroadcastList*, Responses> deleteInstance(FederateHandle theFederateHandle,
                                                                    Object* object,
@@ -191,24 +220,35 @@ public:
 
     std::pair<ObjectClassBroadcastList*, Responses> registerObjectInstance(FederateHandle, Object*, ObjectClassHandle);
 
-    Responses broadcastClassMessage(ObjectClassBroadcastList* ocb_list, const Object* = nullptr);
+    Responses broadcastClassMessage(ObjectClassBroadcastList* ocb_list);
 
-    std::pair<ObjectClassBroadcastList*, Responses> updateAttributeValues(FederateHandle,
-                                                                          Object*,
-                                                                          const std::vector<AttributeHandle>&,
-                                                                          const std::vector<AttributeValue_t>&,
-                                                                          int,
-                                                                          FederationTime,
-                                                                          const std::string&);
-
-    std::pair<ObjectClassBroadcastList*, Responses> updateAttributeValues(FederateHandle,
-                                                                          Object*,
-                                                                          const std::vector<AttributeHandle>&,
-                                                                          const std::vector<AttributeValue_t>&,
-                                                                          int,
-                                                                          const std::string&);
+    /** Reflect the update to all subscribers of this class and of its superclasses.
+     * Each subscriber receives a single message with the attributes it subscribed to.
+     */
+    Responses updateAttributeValues(FederateHandle,
+                                    Object*,
+                                    const std::vector<AttributeHandle>&,
+                                    const std::vector<AttributeValue_t>&,
+                                    int,
+                                    FederationTime,
+                                    const std::string&);
+
+    Responses updateAttributeValues(FederateHandle,
+                                    Object*,
+                                    const std::vector<AttributeHandle>&,
+                                    const std::vector<AttributeValue_t>&,
+                                    int,
+                                    const std::string&);
+
+    /** Get the subscriptions to the attributes of this class, across the class hierarchy.
+     * The table is computed on first use, and again after any subscription change
+     * to this class or to one of its superclasses. Several threads may get it at
+     * once, provided no subscription changes meanwhile.
+     */
+    const RoutingTable& getRoutingTable();
 
-    void recursiveDiscovering(FederateHandle, ObjectClassHandle);
+    /// Add the instances of this class and of its subclasses the federate now discovers.
+    void recursiveDiscovering(FederateHandle, ObjectClassHandle, NM_Discover_Objects& discoveries);
 
     /** Getter for the attribute list of the object class.
      * param[out] AttributeList_t @see ObjectClass::AttributeList_t
@@ -235,7 +275,13 @@ private:
 
     void addInheritedClassAttributes(ObjectClass* child);
 
-    void sendToFederate(NetworkMessage* msg, FederateHandle theFederate);
+    /// Add msg for theFederate to responses, unless theFederate is gone.
+    void respondTo(FederateHandle theFederate, std::unique_ptr<NetworkMessage> msg, Responses& responses);
+
+    /// Forget the routing table of this class and of all its subclasses.
+    void invalidateRoutingTable();
+
+    Responses broadcastReflection(std::unique_ptr<NM_Reflect_Attribute_Values> message, const Object* object);
 
     /// Simple private inner-class.
     class DiffusionPair {
@@ -251,25 +297,26 @@ private:
 
     typedef std::vector<DiffusionPair> CDiffusion;
 
-    /// Send the message (msg) to owners using the diffusion list.
-    void sendToOwners(CDiffusion& diffusionList,
-                      Object* object,
-                      FederateHandle theFederate,
-                      const std::string& theTag,
-                      NM_Attribute_Ownership_Base& msg);
+    /// Add an Answer message for each owner of the diffusion list to responses.
+    template <typename Answer>
+    void respondToOwners(CDiffusion& diffusionList,
+                         Object* object,
+                         FederateHandle theFederate,
+                         const std::string& theTag,
+                         Responses& responses);
 
     void sendMessage(NetworkMessage* msg, FederateHandle theDest);
 
-    // The second parameter is the Class of whose behalf the message
-    // are sent. If SDM is called on the original class, the Federate
+    // The second parameter is the Class of whose behalf the objects
+    // are discovered. If called on the original class, the Federate
     // may be a subscriber of the class without stopping the
     // process(because he has just subscribed)
     //
-    // Return RTI_TRUE if the same SendDiscoverMessages method must be called
+    // Return RTI_TRUE if the same addDiscoveries method must be called
     // on the child classes of this class.
-    // Return RTI_FALSE if no messages were sent because the Federate had
-    // already receive DO messages for this class(and all child classes).
-    bool sendDiscoverMessages(FederateHandle, ObjectClassHandle);
+    // Return RTI_FALSE if nothing was added because the Federate had
+    // already discovered the instances of this class(and all child classes).
+    bool addDiscoveries(FederateHandle, ObjectClassHandle, NM_Discover_Objects& discoveries);
 
     // Attributes
     const ObjectClassHandle handle;
@@ -292,8 +339,16 @@ private:
     /// The set of object classes sub classes of this object class
     ObjectClassSet* subClasses;
 
-    /// The message buffer used to send Network messages
-    libhla::MessageBuffer NM_msgBufSend;
+    /// The super class. nullptr if they aren't any.
+    ObjectClass* my_superclass{nullptr};
+
+    RoutingTable my_routing_table;
+    std::atomic<bool> my_routing_table_is_valid{false};
+    std::mutex my_routing_table_mutex;
+
+    /// The attributes are looked up in my_compiled_class if not null, see setCompiledFom()
+    std::shared_ptr<const CompiledFom> my_compiled_fom{};
+    const CompiledFom::ObjectClass* my_compiled_class{nullptr};
 };
 
 } // namespace certi
@@ -38,9 +38,32 @@ namespace certi {
 static PrettyDebug D("BROADCAST", __FILE__);
 static PrettyDebug G("GENDOC", __FILE__);
 
-ObjectBroadcastLine::ObjectBroadcastLine(FederateHandle federate, ObjectBroadcastLine::State initial_state)
+namespace {
+constexpr unsigned int bits_per_word{64};
+
+/// The bits of word `word` that stand for attributes in [1, max_handle].
+uint64_t rangeMask(const size_t word, const AttributeHandle max_handle)
+{
+    uint64_t mask = ~uint64_t{0};
+    if (word == 0) {
+        mask &= ~uint64_t{1};
+    }
+    if (word == max_handle / bits_per_word) {
+        const auto last = max_handle % bits_per_word;
+        if (last != bits_per_word - 1) {
+            mask &= (uint64_t{1} << (last + 1)) - 1;
+        }
+    }
+    return mask;
+}
+}
+
+ObjectBroadcastLine::ObjectBroadcastLine(FederateHandle federate,
+                                         ObjectBroadcastLine::State initial_state,
+                                         AttributeHandle max_handle)
     : my_federate{federate}, my_initial_state{initial_state}
 {
+    reserve(max_handle);
 }
 
 FederateHandle ObjectBroadcastLine::getFederate() const
@@ -50,29 +73,49 @@ FederateHandle ObjectBroadcastLine::getFederate() const
 
 ObjectBroadcastLine::State ObjectBroadcastLine::stateFor(const AttributeHandle attribute) const
 {
-    auto it = my_states.find(attribute);
-    if (it == end(my_states)) {
+    const auto word = attribute / bits_per_word;
+    if (word >= my_waiting.size()) {
         return my_initial_state;
     }
-    else {
-        return it->second;
+
+    const auto bit = uint64_t{1} << (attribute % bits_per_word);
+    if (my_waiting[word] & bit) {
+        return State::Waiting;
     }
+    if (my_sent[word] & bit) {
+        return State::Sent;
+    }
+    return State::NotSub;
 }
 
 void ObjectBroadcastLine::setState(const AttributeHandle attribute, const State value)
 {
-    my_states[attribute] = value;
+    reserve(attribute);
+
+    const auto word = attribute / bits_per_word;
+    const auto bit = uint64_t{1} << (attribute % bits_per_word);
+
+    my_waiting[word] &= ~bit;
+    my_sent[word] &= ~bit;
+    if (value == State::Waiting) {
+        my_waiting[word] |= bit;
+    }
+    else if (value == State::Sent) {
+        my_sent[word] |= bit;
+    }
 }
 
 bool ObjectBroadcastLine::isWaitingAny(const AttributeHandle max_handle) const
 {
-    for (unsigned int attrIndex = 1; attrIndex <= max_handle; ++attrIndex) {
-        if (stateFor(attrIndex) == State::Waiting) {
+    const size_t words = std::min<size_t>(my_waiting.size(), max_handle / bits_per_word + 1);
+    for (size_t word = 0; word < words; ++word) {
+        if (my_waiting[word] & rangeMask(word, max_handle)) {
             return true;
         }
     }
 
-    return false;
+    // attributes not stored yet are all in the initial state
+    return my_initial_state == State::Waiting && max_handle >= my_waiting.size() * bits_per_word;
 }
 
 bool ObjectBroadcastLine::isWaitingAll(const std::vector<AttributeHandle>& attributes) const
@@ -86,6 +129,60 @@ bool ObjectBroadcastLine::isWaitingAll(const std::vector<AttributeHandle>& attri
     return true;
 }
 
+bool ObjectBroadcastLine::isWaitingAll(const Mask& attributes) const
+{
+    for (size_t word = 0; word < attributes.size(); ++word) {
+        if (word >= my_waiting.size()) {
+            if (attributes[word] != 0 && my_initial_state != State::Waiting) {
+                return false;
+            }
+        }
+        else if (attributes[word] & ~my_waiting[word]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ObjectBroadcastLine::setWaitingSent(const AttributeHandle max_handle)
+{
+    if (my_initial_state == State::Waiting) {
+        reserve(max_handle);
+    }
+
+    const size_t words = std::min<size_t>(my_waiting.size(), max_handle / bits_per_word + 1);
+    for (size_t word = 0; word < words; ++word) {
+        const auto sent = my_waiting[word] & rangeMask(word, max_handle);
+        my_sent[word] |= sent;
+        my_waiting[word] &= ~sent;
+    }
+}
+
+ObjectBroadcastLine::Mask ObjectBroadcastLine::maskOf(const std::vector<AttributeHandle>& attributes)
+{
+    Mask mask;
+    for (auto& handle : attributes) {
+        const auto word = handle / bits_per_word;
+        if (word >= mask.size()) {
+            mask.resize(word + 1, 0);
+        }
+        mask[word] |= uint64_t{1} << (handle % bits_per_word);
+    }
+    return mask;
+}
+
+void ObjectBroadcastLine::reserve(const AttributeHandle attribute)
+{
+    const size_t words = attribute / bits_per_word + 1;
+    if (words <= my_waiting.size()) {
+        return;
+    }
+
+    my_waiting.resize(words, my_initial_state == State::Waiting ? ~uint64_t{0} : 0);
+    my_sent.resize(words, my_initial_state == State::Sent ? ~uint64_t{0} : 0);
+}
+
 ObjectClassBroadcastList::ObjectClassBroadcastList(std::unique_ptr<NetworkMessage> message,
                                                    AttributeHandle maxAttHandle)
     : my_message{std::move(message)}, maxHandle{maxAttHandle}
@@ -104,9 +201,6 @@ ObjectClassBroadcastList::ObjectClassBroadcastList(std::unique_ptr<NetworkMessag
     case NetworkMessage::Type::DISCOVER_OBJECT:
         msgDO = static_cast<NM_Discover_Object*>(my_message.get());
         break;
-    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES:
-        msgRAV = static_cast<NM_Reflect_Attribute_Values*>(my_message.get());
-        break;
     case NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION:
         msgRAOA = static_cast<NM_Request_Attribute_Ownership_Assumption*>(my_message.get());
         break;
@@ -120,7 +214,7 @@ ObjectClassBroadcastList::ObjectClassBroadcastList(std::unique_ptr<NetworkMessag
 
     // Add reference of the sender.
     if (my_message->getFederate() != 0) {
-        my_lines.emplace_back(my_message->getFederate(), ObjectBroadcastLine::State::Sent);
+        my_lines.emplace_back(my_message->getFederate(), ObjectBroadcastLine::State::Sent, maxHandle);
     }
 }
 
@@ -139,11 +233,6 @@ NM_Discover_Object* ObjectClassBroadcastList::getMsgDO()
     return msgDO;
 }
 
-NM_Reflect_Attribute_Values* ObjectClassBroadcastList::getMsgRAV()
-{
-    return msgRAV;
-}
-
 NM_Request_Attribute_Ownership_Assumption* ObjectClassBroadcastList::getMsgRAOA()
 {
     return msgRAOA;
@@ -167,7 +256,7 @@ void ObjectClassBroadcastList::addFederate(FederateHandle theFederate, Attribute
 
     if (it == end(my_lines)) {
         Debug(D, pdRegister) << "Adding new line in list for Federate " << theFederate << std::endl;
-        my_lines.emplace_back(theFederate, ObjectBroadcastLine::State::NotSub);
+        my_lines.emplace_back(theFederate, ObjectBroadcastLine::State::NotSub, maxHandle);
         my_lines.back().setState(theAttribute, ObjectBroadcastLine::State::Waiting);
     }
     else if (it->stateFor(theAttribute) != ObjectBroadcastLine::State::Sent) {
@@ -185,9 +274,8 @@ Responses ObjectClassBroadcastList::preparePendingMessage(SecurityServer& server
 {
     Debug(G, pdGendoc) << "enter ObjectClassBroadcastList::sendPendingMessage" << std::endl;
     switch (my_message->getMessageType()) {
-    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES:
     case NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION:
-        return preparePendingRAVMessage(server);
+        return preparePendingRAOAMessage(server);
     case NetworkMessage::Type::DISCOVER_OBJECT:
     case NetworkMessage::Type::REMOVE_OBJECT:
         return preparePendingDOMessage(server);
@@ -209,10 +297,6 @@ void ObjectClassBroadcastList::upcastTo(ObjectClassHandle objectClass)
     case NetworkMessage::Type::DISCOVER_OBJECT:
         msgDO->setObjectClass(objectClass);
         break;
-    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES:
-        // FIXME nothing TODO RAV does not embed object class?
-        //msgRAV->setObjectClass(objectClass);
-        break;
     case NetworkMessage::Type::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION:
         // FIXME nothing TODO RAOA does not embed object class?
         //msgRAOA->setObjectClass(objectClass);
@@ -268,21 +352,13 @@ Responses ObjectClassBroadcastList::preparePendingDOMessage(SecurityServer& serv
     return responses;
 }
 
-Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& server)
+Responses ObjectClassBroadcastList::preparePendingRAOAMessage(SecurityServer& server)
 {
-    Debug(G, pdGendoc) << "enter ObjectClassBroadcastList::sendPendingRAVMessage" << std::endl;
+    Debug(G, pdGendoc) << "enter ObjectClassBroadcastList::sendPendingRAOAMessage" << std::endl;
 
     Responses responses;
 
-    std::vector<AttributeHandle> relevantAttributes;
-
-    if (msgRAV) {
-        relevantAttributes = msgRAV->getAttributes();
-    }
-
-    if (msgRAOA) {
-        relevantAttributes = msgRAOA->getAttributes();
-    }
+    const auto relevantAttributes = ObjectBroadcastLine::maskOf(msgRAOA->getAttributes());
 
     for (auto& line : my_lines) {
         // If *at least* one of the attributes is waiting
@@ -291,22 +367,12 @@ Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& ser
 
             if (line.isWaitingAll(relevantAttributes)) {
                 // YES: Nothing to do.
-                if (msgRAV) {
-                    currentMessage = createResponseMessage(msgRAV);
-                }
-                if (msgRAOA) {
-                    currentMessage = createResponseMessage(msgRAOA);
-                }
+                currentMessage = createResponseMessage(msgRAOA);
                 Debug(D, pdProtocol) << "Broadcasting complete message to Federate " << line.getFederate() << std::endl;
             }
             else {
                 // NO: Create a new message containing only relevant attributes.
-                if (msgRAV) {
-                    currentMessage = createResponseMessageWithValues(msgRAV, line);
-                }
-                if (msgRAOA) {
-                    currentMessage = createResponseMessage(msgRAOA, line);
-                }
+                currentMessage = createResponseMessage(msgRAOA, line);
                 Debug(D, pdProtocol) << "Broadcasting reduced message to Federate " << line.getFederate() << std::endl;
             }
 
@@ -325,18 +391,13 @@ Responses ObjectClassBroadcastList::preparePendingRAVMessage(SecurityServer& ser
             }
 
             // 3. mark attributes as sent.
-            for (unsigned int attrIndex = 1; attrIndex <= maxHandle; attrIndex++) {
-                if (line.stateFor(attrIndex) == ObjectBroadcastLine::State::Waiting) {
-                    line.setState(attrIndex, ObjectBroadcastLine::State::Sent);
-                }
-            }
-            //*/
+            line.setWaitingSent(maxHandle);
         }
         else {
             Debug(D, pdProtocol) << "No message sent to Federate " << line.getFederate() << std::endl;
         }
 
-        Debug(G, pdGendoc) << "exit  ObjectClassBroadcastList::sendPendingRAVMessage" << std::endl;
+        Debug(G, pdGendoc) << "exit  ObjectClassBroadcastList::sendPendingRAOAMessage" << std::endl;
     }
 
     return responses;
@@ -365,32 +426,6 @@ std::unique_ptr<NetworkMessage> ObjectClassBroadcastList::createResponseMessage(
     return std::unique_ptr<NetworkMessage>(static_cast<NetworkMessage*>(reducedMessage.release()));
 }
 
-template <typename T>
-std::unique_ptr<NetworkMessage>
-ObjectClassBroadcastList::createResponseMessageWithValues(T* message, const ObjectBroadcastLine& line)
-{
-    auto reducedMessage = make_unique<T>(*message);
-
-    // Copy attributes that are in the Waiting state in Line.
-    uint32_t currentSize = 0;
-    reducedMessage->setAttributesSize(currentSize);
-
-    for (uint32_t i = 0; i < message->getAttributesSize(); ++i) {
-        auto currentAttrib = message->getAttributes(i);
-        if (line.stateFor(currentAttrib) == ObjectBroadcastLine::State::Waiting) {
-            // Update number of attributes in ReducedMessage.
-            ++currentSize;
-
-            reducedMessage->setAttributesSize(currentSize);
-            reducedMessage->setAttributes(currentAttrib, currentSize - 1);
-
-            reducedMessage->setValuesSize(currentSize);
-            reducedMessage->setValues(message->getValues(i), currentSize - 1);
-        }
-    }
-    return std::unique_ptr<NetworkMessage>(static_cast<NetworkMessage*>(reducedMessage.release()));
-}
-
 template <typename T>
 std::unique_ptr<NetworkMessage> ObjectClassBroadcastList::createResponseMessage(T* message)
 {
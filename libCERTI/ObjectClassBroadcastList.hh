@@ -30,15 +30,18 @@
 #include "SecurityServer.hh"
 #include <include/certi.hh>
 
+#include <cstdint>
 #include <vector>
 
-#include <unordered_map>
-
 namespace certi {
 
 /** An object broadcast line represents a federate
  * interested in part (or all) of the attributes of
  * the message referenced in the ObjectClassBroadcastList.
+ *
+ * The states are kept in two dense bitsets indexed by attribute handle, one
+ * for the waiting attributes and one for the sent attributes, so that a
+ * whole class can be tested or updated a word at a time.
  */
 class ObjectBroadcastLine {
 public:
@@ -49,7 +52,17 @@ public:
         NotSub /// the federate did not subscribed to this attribute
     };
 
-    ObjectBroadcastLine(const FederateHandle federate, const State initial_state = State::NotSub);
+    /// A set of attribute handles, bit h of word h / 64 is set for handle h.
+    using Mask = std::vector<uint64_t>;
+
+    /** Build a line with all attributes up to max_handle in initial_state.
+     *
+     * Attributes beyond max_handle are also in initial_state until their
+     * state is set, max_handle only presizes the bitsets.
+     */
+    ObjectBroadcastLine(const FederateHandle federate,
+                        const State initial_state = State::NotSub,
+                        const AttributeHandle max_handle = 0);
 
     FederateHandle getFederate() const;
 
@@ -57,17 +70,30 @@ public:
 
     void setState(const AttributeHandle attribute, const State value);
 
+    /// True if any attribute in [1, max_handle] is waiting.
     bool isWaitingAny(const AttributeHandle max_handle) const;
 
     bool isWaitingAll(const std::vector<AttributeHandle>& attributes) const;
 
+    /// True if every attribute of the mask is waiting.
+    bool isWaitingAll(const Mask& attributes) const;
+
+    /// Mark every attribute in [1, max_handle] that is waiting as sent.
+    void setWaitingSent(const AttributeHandle max_handle);
+
+    static Mask maskOf(const std::vector<AttributeHandle>& attributes);
+
 private:
+    /// Make the bitsets large enough for attribute, new attributes are in my_initial_state.
+    void reserve(const AttributeHandle attribute);
+
     /// The Federate Handle
     FederateHandle my_federate;
 
     State my_initial_state;
 
-    std::unordered_map<AttributeHandle, State> my_states;
+    Mask my_waiting;
+    Mask my_sent;
 };
 
 /**
@@ -80,16 +106,17 @@ private:
  * <ul>
  *   <li> NM_Remove_Object </li>
  *       <li> NM_Discover_Object </li>
- *   <li> NM_Reflect_Attribute_Values </li>
  *   <li> NM_Request_Attribute_Ownership_Assumption </li>
  *   <li> NM_Attribute_Ownership_Divestiture_Notification </li>
  * </ul>
  * A federate is represented by an ObjectBroadcastLine.
+ *
+ * Reflections are not broadcast with a list, see ObjectClass::broadcastReflection().
  */
 class ObjectClassBroadcastList {
 public:
     /** Message->federate is added to the list, and its state is set as "Sent"
-     * for all attributes. For RAVs messages, MaxAttHandle is the greatest
+     * for all attributes. For RAOA messages, MaxAttHandle is the greatest
      * attribute handle of the class. For Discover_Object message, it can be 0 to
      * mean "any attribute".
      */
@@ -100,7 +127,6 @@ public:
     NetworkMessage& getMsg();
     NM_Remove_Object* getMsgRO();
     NM_Discover_Object* getMsgDO();
-    NM_Reflect_Attribute_Values* getMsgRAV();
     NM_Request_Attribute_Ownership_Assumption* getMsgRAOA();
     NM_Attribute_Ownership_Divestiture_Notification* getMsgAODN();
 
@@ -126,7 +152,7 @@ public:
      * Broadcast the message to all the Federate in the
      * ObjectBroadcastLine::waiting state. If it is a DiscoverObject
      * message, the message is sent as is, and the Federate is marked as
-     * ObjectBroadcastLine::sent for the ANY attribute. If it is a RAV
+     * ObjectBroadcastLine::sent for the ANY attribute. If it is a RAOA
      * message, the message is first copied, without the Attribute list,
      * and then all pending attributes(in the bsWainting state) are added
      * to the copy. The copy is sent, and attributes are marked as
@@ -153,20 +179,16 @@ protected:
     std::unique_ptr<NetworkMessage> my_message;
     NM_Remove_Object* msgRO{nullptr};
     NM_Discover_Object* msgDO{nullptr};
-    NM_Reflect_Attribute_Values* msgRAV{nullptr};
     NM_Request_Attribute_Ownership_Assumption* msgRAOA{nullptr};
     NM_Attribute_Ownership_Divestiture_Notification* msgAODN{nullptr};
 
 private:
     Responses preparePendingDOMessage(SecurityServer& server);
-    Responses preparePendingRAVMessage(SecurityServer& server);
+    Responses preparePendingRAOAMessage(SecurityServer& server);
 
     template <typename T>
     std::unique_ptr<NetworkMessage> createResponseMessage(T* message, const ObjectBroadcastLine& line);
 
-    template <typename T>
-    std::unique_ptr<NetworkMessage> createResponseMessageWithValues(T* message, const ObjectBroadcastLine& line);
-
     template <typename T>
     std::unique_ptr<NetworkMessage> createResponseMessage(T* message);
 
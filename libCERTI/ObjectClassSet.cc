@@ -32,8 +32,11 @@
 
 // Standard
 #include <iosfwd>
+#include <map>
 #include <sstream>
 
+#include <include/make_unique.hh>
+
 namespace certi {
 
 static PrettyDebug D("OBJECTCLASSSET", __FILE__);
@@ -193,55 +196,33 @@ const std::string& ObjectClassSet::getObjectClassName(ObjectClassHandle the_hand
     return getNameFromHandle(the_handle);
 }
 
-Responses ObjectClassSet::killFederate(FederateHandle theFederate) noexcept
+Responses ObjectClassSet::killFederate(FederateHandle theFederate, const std::vector<Object*>& theObjects) noexcept
 {
     Responses ret;
 
-    ObjectClassBroadcastList* ocbList = NULL;
-    ObjectClassHandle currentClass = 0;
+    Debug(D, pdExcept) << "Kill Federate Handle " << theFederate << std::endl;
 
-    handled_iterator i;
+    // Unsubscribe first, so that the federate is not told about its own objects.
+    for (const auto& pair : fromHandle) {
+        pair.second->killFederate(theFederate);
+    }
 
-    for (i = fromHandle.begin(); i != fromHandle.end(); ++i) {
-        // Call KillFederate on every class of the current class set
-        // until it returns NULL.
-        do {
-            Debug(D, pdExcept) << "Kill Federate Handle " << theFederate << std::endl;
+    std::map<ObjectClassHandle, std::vector<Object*>> objectsPerClass;
+    for (const auto& object : theObjects) {
+        objectsPerClass[object->getClass()].push_back(object);
+    }
 
-            Responses resp;
-            std::tie(ocbList, resp) = i->second->killFederate(theFederate);
+    for (const auto& pair : objectsPerClass) {
+        try {
+            auto resp = getObjectFromHandle(pair.first)->killInstances(theFederate, pair.second, "Killed");
             ret.insert(std::end(ret), make_move_iterator(std::begin(resp)), make_move_iterator(std::end(resp)));
-
-            Debug(D, pdExcept) << "Federate Handle " << theFederate << " Killed" << std::endl;
-
-            // Broadcast RemoveObject message recursively
-            // going from current class to its superclass.
-            if (ocbList != NULL) {
-                currentClass = i->second->getSuperclass();
-                Debug(D, pdExcept) << "List not NULL" << std::endl;
-                while (currentClass != 0) {
-                    Debug(D, pdRegister) << "Broadcasting Remove msg to parent class (Killed) " << currentClass
-                                         << std::endl;
-
-                    // It may throw ObjectClassNotDefined
-                    try {
-                        ObjectClass* currentClassObject = getObjectFromHandle(currentClass);
-
-                        auto resp = currentClassObject->broadcastClassMessage(ocbList);
-                        ret.insert(
-                            std::end(ret), make_move_iterator(std::begin(resp)), make_move_iterator(std::end(resp)));
-
-                        currentClass = currentClassObject->getSuperclass();
-                    }
-                    catch (ObjectClassNotDefined& e) {
-                        Debug(D, pdExcept) << "getObjectFromHandle threw when killing " << theFederate << std::endl;
-                    }
-                }
-
-                delete ocbList;
-            }
-        } while (ocbList != NULL);
+        }
+        catch (Exception& e) {
+            Debug(D, pdExcept) << "Could not remove objects of class " << pair.first << " when killing " << theFederate
+                               << std::endl;
+        }
     }
+
     Debug(D, pdExcept) << "End of the KillFederate Procedure." << std::endl;
     return ret;
 }
@@ -297,18 +278,38 @@ ObjectClassSet::registerObjectInstance(FederateHandle the_federate, Object* the_
     return ret;
 }
 
-void ObjectClassSet::subscribe(FederateHandle federate,
-                               ObjectClassHandle class_handle,
-                               const std::vector<AttributeHandle>& attributes,
-                               const RTIRegion* region)
+Responses ObjectClassSet::subscribe(FederateHandle federate,
+                                    ObjectClassHandle class_handle,
+                                    const std::vector<AttributeHandle>& attributes,
+                                    const RTIRegion* region)
 {
+    Responses ret;
+
     ObjectClass* object_class = getObjectFromHandle(class_handle);
 
     bool need_discover = object_class->subscribe(federate, attributes, region);
 
     if (need_discover) {
-        object_class->recursiveDiscovering(federate, class_handle);
+        auto discoveries = make_unique<NM_Discover_Objects>();
+        discoveries->setFederation(server->federation().get());
+        discoveries->setFederate(federate);
+        discoveries->setException(Exception::Type::NO_EXCEPTION);
+
+        object_class->recursiveDiscovering(federate, class_handle, *discoveries);
+
+        if (discoveries->getObjectsSize() != 0) {
+            Debug(D, pdInit) << "Federate " << federate << " discovers " << discoveries->getObjectsSize()
+                             << " objects" << std::endl;
+            try {
+                ret.emplace_back(server->getSocketLink(federate), std::move(discoveries));
+            }
+            catch (RTIinternalError& e) {
+                Debug(D, pdExcept) << "Reference to a killed Federate while discovering objects." << std::endl;
+            }
+        }
     }
+
+    return ret;
 }
 
 Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
@@ -318,38 +319,15 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
                                                 const FederationTime& time,
                                                 const std::string& tag)
 {
-    Responses ret;
-
     ObjectClass* object_class = getObjectFromHandle(object->getClass());
     ObjectClassHandle current_class = object_class->getHandle();
 
     Debug(D, pdProtocol) << "Federate " << federate << " Updating object " << object->getHandle() << " from class "
                          << current_class << std::endl;
 
-    // It may throw a bunch of exceptions
-    ObjectClassBroadcastList* ocbList = NULL;
-    std::tie(ocbList, ret)
-        = object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), time, tag);
-
-    // Broadcast ReflectAttributeValues message recursively
-    current_class = object_class->getSuperclass();
-
-    while (0 != current_class) {
-        Debug(D, pdProtocol) << "Broadcasting RAV msg to parent class " << current_class << " for instance "
-                             << object->getHandle() << std::endl;
-
-        // It may throw ObjectClassNotDefined
-        object_class = getObjectFromHandle(current_class);
-
-        auto resp = object_class->broadcastClassMessage(ocbList, object);
-        ret.insert(std::end(ret), make_move_iterator(std::begin(resp)), make_move_iterator(std::end(resp)));
-
-        current_class = object_class->getSuperclass();
-    }
-
-    delete ocbList;
-
-    return ret;
+    // It may throw a bunch of exceptions.
+    // Subscribers of the superclasses are reached through the routing table of the class.
+    return object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), time, tag);
 }
 
 Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
@@ -358,37 +336,15 @@ Responses ObjectClassSet::updateAttributeValues(FederateHandle federate,
                                                 const std::vector<AttributeValue_t>& values,
                                                 const std::string& tag)
 {
-    Responses ret;
-
     ObjectClass* object_class = getObjectFromHandle(object->getClass());
     ObjectClassHandle current_class = object_class->getHandle();
 
     Debug(D, pdProtocol) << "Federate " << federate << " Updating object " << object->getHandle() << " from class "
                          << current_class << std::endl;
 
-    // It may throw a bunch of exceptions
-    ObjectClassBroadcastList* ocbList = NULL;
-    std::tie(ocbList, ret)
-        = object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), tag);
-
-    // Broadcast ReflectAttributeValues message recursively
-    current_class = object_class->getSuperclass();
-
-    while (current_class != 0) {
-        Debug(D, pdProtocol) << "Broadcasting RAV msg to parent class " << current_class << " for instance "
-                             << object->getHandle() << std::endl;
-
-        // It may throw ObjectClassNotDefined
-        object_class = getObjectFromHandle(current_class);
-        auto resp = object_class->broadcastClassMessage(ocbList, object);
-        ret.insert(std::end(ret), make_move_iterator(std::begin(resp)), make_move_iterator(std::end(resp)));
-
-        current_class = object_class->getSuperclass();
-    }
-
-    delete ocbList;
-
-    return ret;
+    // It may throw a bunch of exceptions.
+    // Subscribers of the superclasses are reached through the routing table of the class.
+    return object_class->updateAttributeValues(federate, object, attributes, values, attributes.size(), tag);
 }
 
 Responses ObjectClassSet::negotiatedAttributeOwnershipDivestiture(FederateHandle theFederateHandle,
@@ -427,15 +383,15 @@ Responses ObjectClassSet::negotiatedAttributeOwnershipDivestiture(FederateHandle
     return ret;
 }
 
-void ObjectClassSet::attributeOwnershipAcquisitionIfAvailable(FederateHandle theFederateHandle,
-                                                              Object* object,
-                                                              const std::vector<AttributeHandle>& theAttributeList)
+Responses ObjectClassSet::attributeOwnershipAcquisitionIfAvailable(FederateHandle theFederateHandle,
+                                                                   Object* object,
+                                                                   const std::vector<AttributeHandle>& theAttributeList)
 {
     // It may throw ObjectNotKnown
     ObjectClass* objectClass = getInstanceClass(object->getHandle());
 
     // It may throw a bunch of exceptions.
-    objectClass->attributeOwnershipAcquisitionIfAvailable(theFederateHandle, object, theAttributeList);
+    return objectClass->attributeOwnershipAcquisitionIfAvailable(theFederateHandle, object, theAttributeList);
 }
 
 Responses ObjectClassSet::unconditionalAttributeOwnershipDivestiture(
@@ -471,19 +427,19 @@ Responses ObjectClassSet::unconditionalAttributeOwnershipDivestiture(
     return ret;
 }
 
-void ObjectClassSet::attributeOwnershipAcquisition(FederateHandle theFederateHandle,
-                                                   Object* object,
-                                                   const std::vector<AttributeHandle>& theAttributeList,
-                                                   const std::string& theTag)
+Responses ObjectClassSet::attributeOwnershipAcquisition(FederateHandle theFederateHandle,
+                                                        Object* object,
+                                                        const std::vector<AttributeHandle>& theAttributeList,
+                                                        const std::string& theTag)
 {
     // It may throw ObjectNotKnown
     ObjectClass* objectClass = getInstanceClass(object->getHandle());
 
     // It may throw a bunch of exceptions.
-    objectClass->attributeOwnershipAcquisition(theFederateHandle, object, theAttributeList, theTag);
+    return objectClass->attributeOwnershipAcquisition(theFederateHandle, object, theAttributeList, theTag);
 }
 
-AttributeHandleSet* ObjectClassSet::attributeOwnershipReleaseResponse(
+std::pair<AttributeHandleSet*, Responses> ObjectClassSet::attributeOwnershipReleaseResponse(
     FederateHandle theFederateHandle, Object* object, const std::vector<AttributeHandle>& theAttributeList)
 {
     // It may throw ObjectNotKnown
@@ -493,15 +449,15 @@ AttributeHandleSet* ObjectClassSet::attributeOwnershipReleaseResponse(
     return objectClass->attributeOwnershipReleaseResponse(theFederateHandle, object, theAttributeList);
 }
 
-void ObjectClassSet::cancelAttributeOwnershipAcquisition(FederateHandle theFederateHandle,
-                                                         Object* object,
-                                                         const std::vector<AttributeHandle>& theAttributeList)
+Responses ObjectClassSet::cancelAttributeOwnershipAcquisition(FederateHandle theFederateHandle,
+                                                              Object* object,
+                                                              const std::vector<AttributeHandle>& theAttributeList)
 {
     // It may throw ObjectNotKnown
     ObjectClass* objectClass = getInstanceClass(object->getHandle());
 
     // It may throw a bunch of exceptions.
-    objectClass->cancelAttributeOwnershipAcquisition(theFederateHandle, object, theAttributeList);
+    return objectClass->cancelAttributeOwnershipAcquisition(theFederateHandle, object, theAttributeList);
 }
 
 } // namespace certi
@@ -62,7 +62,11 @@ public:
 
     const std::string& getObjectClassName(ObjectClassHandle the_handle) const;
 
-    Responses killFederate(FederateHandle theFederate) noexcept;
+    /** Remove the federate from every class, and its objects from their class.
+     *
+     * theObjects are the instances the federate had the privilege to delete.
+     */
+    Responses killFederate(FederateHandle theFederate, const std::vector<Object*>& theObjects) noexcept;
 
     /** Register specified federate as a publisher of the specified attribute list for the specified Object Class.
      * @param[in] theFederateHandle the handle of the publisher federate
@@ -76,16 +80,17 @@ public:
                  bool PubOrUnpub);
 
     /** Subscribes a federate to a set of attributes with a region.
-     * Sends the discovery messages if necessary.
+     * Prepares the discovery of existing objects if necessary.
      * @param federate Federate to subscribe
      * @param class_handle Class to be subscribed
      * @param attributes List of attributes to be subscribed
      * @param region Subscription region (NULL for default)
+     * @return a single NM_Discover_Objects for all the objects discovered, if any
      */
-    void subscribe(FederateHandle,
-                   ObjectClassHandle,
-                   const std::vector<AttributeHandle>& attributes,
-                   const RTIRegion* = NULL);
+    Responses subscribe(FederateHandle,
+                        ObjectClassHandle,
+                        const std::vector<AttributeHandle>& attributes,
+                        const RTIRegion* = NULL);
 
     // Object Instance Management
 
@@ -116,22 +121,23 @@ public:
                                                       const std::vector<AttributeHandle>&,
                                                       const std::string& theTag);
 
-    void attributeOwnershipAcquisitionIfAvailable(FederateHandle, Object* object, const std::vector<AttributeHandle>&);
+    Responses
+    attributeOwnershipAcquisitionIfAvailable(FederateHandle, Object* object, const std::vector<AttributeHandle>&);
 
     Responses
     unconditionalAttributeOwnershipDivestiture(FederateHandle, Object* object, const std::vector<AttributeHandle>&);
 
-    void attributeOwnershipAcquisition(FederateHandle theFederateHandle,
-                                       Object* object,
-                                       const std::vector<AttributeHandle>& theAttributeList,
-                                       const std::string& theTag);
+    Responses attributeOwnershipAcquisition(FederateHandle theFederateHandle,
+                                            Object* object,
+                                            const std::vector<AttributeHandle>& theAttributeList,
+                                            const std::string& theTag);
 
-    AttributeHandleSet*
+    std::pair<AttributeHandleSet*, Responses>
     attributeOwnershipReleaseResponse(FederateHandle, Object* object, const std::vector<AttributeHandle>&);
 
-    void cancelAttributeOwnershipAcquisition(FederateHandle theFederateHandle,
-                                             Object* object,
-                                             const std::vector<AttributeHandle>& theAttributeList);
+    Responses cancelAttributeOwnershipAcquisition(FederateHandle theFederateHandle,
+                                                  Object* object,
+                                                  const std::vector<AttributeHandle>& theAttributeList);
 
 private:
     /** This object will help to find the TCPLink associated with a Federate.
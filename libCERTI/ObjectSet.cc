@@ -28,6 +28,8 @@
 #include "ObjectSet.hh"
 #include "PrettyDebug.hh"
 
+#include <include/make_unique.hh>
+
 // Standard
 #include <iostream>
 
@@ -113,6 +115,8 @@ Object* ObjectSet::registerObjectInstance(FederateHandle the_federate,
         object->setName("HLAobject_" + std::to_string(the_object));
     }
 
+    object->setOwnershipIndex(&my_ownership_index);
+
     my_objects_per_handle[the_object] = object;
     my_objects_per_name[the_name] = object;
 
@@ -146,17 +150,15 @@ FederateHandle ObjectSet::requestObjectOwner(FederateHandle /*the_federate*/, Ob
 
 void ObjectSet::killFederate(FederateHandle the_federate)
 {
-    auto i = begin(my_objects_per_handle);
-    while (i != end(my_objects_per_handle)) {
-        if (i->second->getOwner() == the_federate) {
-            deleteObjectInstance(the_federate, i->first, "");
-            i = begin(my_objects_per_handle);
-        }
-        else {
-            // It is safe to run this multiple times
-            i->second->killFederate(the_federate);
-            ++i;
-        }
+    // Copies, deleting objects and releasing attributes updates the index
+    const auto objects = my_ownership_index.getObjects(the_federate);
+    for (const auto& handle : objects) {
+        deleteObjectInstance(the_federate, handle, "");
+    }
+
+    const auto attributes = my_ownership_index.getAttributes(the_federate);
+    for (const auto& pair : attributes) {
+        getObject(pair.first)->getAttribute(pair.second)->setOwner(0);
     }
 }
 
@@ -174,13 +176,15 @@ bool ObjectSet::isAttributeOwnedByFederate(FederateHandle the_federate,
     return getObject(the_object)->isAttributeOwnedByFederate(the_federate, the_attribute);
 }
 
-void ObjectSet::queryAttributeOwnership(FederateHandle the_federate,
-                                        ObjectHandle the_object,
-                                        AttributeHandle the_attribute) const
+Responses ObjectSet::queryAttributeOwnership(FederateHandle the_federate,
+                                             ObjectHandle the_object,
+                                             AttributeHandle the_attribute) const
 {
+    Responses responses;
+
     if (!server) {
         Debug(D, pdDebug) << "Should only be called by RTIG" << std::endl;
-        return;
+        return responses;
     }
 
     Debug(D, pdDebug) << "query attribute ownership for attribute " << the_attribute << " and object " << the_object
@@ -190,25 +194,32 @@ void ObjectSet::queryAttributeOwnership(FederateHandle the_federate,
 
     ObjectAttribute* oa = object->getAttribute(the_attribute);
 
-    NetworkMessage* answer;
+    std::unique_ptr<NetworkMessage> answer;
     if (oa->getOwner()) {
-        NM_Inform_Attribute_Ownership* IAO = new NM_Inform_Attribute_Ownership();
+        auto IAO = make_unique<NM_Inform_Attribute_Ownership>();
         IAO->setObject(the_object);
         IAO->setAttribute(the_attribute);
-        answer = IAO;
+        answer = std::move(IAO);
     }
     else {
-        NM_Attribute_Is_Not_Owned* AINO = new NM_Attribute_Is_Not_Owned();
+        auto AINO = make_unique<NM_Attribute_Is_Not_Owned>();
         AINO->setObject(the_object);
         AINO->setAttribute(the_attribute);
-        answer = AINO;
+        answer = std::move(AINO);
     }
 
     answer->setFederation(server->federation().get());
     answer->setException(Exception::Type::NO_EXCEPTION);
     answer->setFederate(oa->getOwner());
 
-    sendToFederate(answer, the_federate);
+    try {
+        responses.emplace_back(server->getSocketLink(the_federate), std::move(answer));
+    }
+    catch (RTIinternalError& e) {
+        Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
+    }
+
+    return responses;
 }
 
 void ObjectSet::negotiatedAttributeOwnershipDivestiture(
@@ -307,32 +318,7 @@ Object* ObjectSet::getObjectByName(const std::string& the_object_name) const
 void ObjectSet::getAllObjectInstancesFromFederate(FederateHandle the_federate,
                                                   std::vector<ObjectHandle>& ownedObjectInstances) const
 {
-    ownedObjectInstances.clear();
-    for (const auto& kv : my_objects_per_handle) {
-        if (kv.second && kv.second->getOwner() == the_federate) {
-            ownedObjectInstances.push_back(kv.first);
-        }
-    }
-}
-
-void ObjectSet::sendToFederate(NetworkMessage* msg, FederateHandle the_federate) const
-{
-    // Send the message 'msg' to the Federate which Handle is theFederate.
-    Socket* socket = nullptr;
-    try {
-#ifdef HLA_USES_UDP
-        socket = server->getSocketLink(the_federate, BEST_EFFORT);
-#else
-        socket = server->getSocketLink(the_federate);
-#endif
-        msg->send(socket, const_cast<MessageBuffer&>(NM_msgBufSend));
-    }
-    catch (RTIinternalError& e) {
-        Debug(D, pdExcept) << "Reference to a killed Federate while broadcasting." << std::endl;
-    }
-    catch (NetworkError& e) {
-        Debug(D, pdExcept) << "Network error while broadcasting, ignoring." << std::endl;
-    }
-    // BUG: If except = 0, could use Multicast.
+    const auto& objects = my_ownership_index.getObjects(the_federate);
+    ownedObjectInstances.assign(begin(objects), end(objects));
 }
 }
@@ -27,6 +27,8 @@
 // Project
 class Object;
 #include "GAV.hh"
+#include "MessageEvent.hh"
+#include "OwnershipIndex.hh"
 #include "SecurityServer.hh"
 #include <include/certi.hh>
 #include <libHLA/MessageBuffer.hh>
@@ -71,15 +73,24 @@ public:
 
     FederateHandle requestObjectOwner(FederateHandle the_federate, ObjectHandle the_object) const;
 
+    /** Delete the objects of the federate and release its attributes.
+     *
+     * Only what the federate owns is visited.
+     */
     void killFederate(FederateHandle the_federate);
 
+    const OwnershipIndex& getOwnershipIndex() const
+    {
+        return my_ownership_index;
+    }
+
     // Ownership Management.
 
     bool isAttributeOwnedByFederate(FederateHandle the_federate,
                                     ObjectHandle the_object,
                                     AttributeHandle the_attribute) const;
 
-    void
+    Responses
     queryAttributeOwnership(FederateHandle the_federate, ObjectHandle the_object, AttributeHandle the_attribute) const;
 
     void negotiatedAttributeOwnershipDivestiture(FederateHandle the_federate,
@@ -125,15 +136,12 @@ public:
     void getAllObjectInstancesFromFederate(FederateHandle the_federate, std::vector<ObjectHandle>& handles) const;
 
 protected:
-    void sendToFederate(NetworkMessage* msg, FederateHandle the_federate) const;
-
     SecurityServer* server {nullptr};
 
+    OwnershipIndex my_ownership_index {};
+
     std::map<ObjectHandle, Object*> my_objects_per_handle {};
     std::map<std::string, Object*> my_objects_per_name {};
-    
-    /* The message buffer used to send Network messages */
-    MessageBuffer NM_msgBufSend {};
 };
 
 } // namespace certi
@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "OwnershipIndex.hh"
+
+namespace certi {
+
+namespace {
+template <typename Index, typename Key>
+void transfer(Index& index, const Key& key, FederateHandle previous_owner, FederateHandle new_owner)
+{
+    if (previous_owner == new_owner) {
+        return;
+    }
+
+    if (previous_owner != 0) {
+        auto it = index.find(previous_owner);
+        if (it != end(index)) {
+            it->second.erase(key);
+            if (it->second.empty()) {
+                index.erase(it);
+            }
+        }
+    }
+
+    if (new_owner != 0) {
+        index[new_owner].insert(key);
+    }
+}
+
+template <typename Index>
+const typename Index::mapped_type& lookup(const Index& index, FederateHandle the_federate)
+{
+    static const typename Index::mapped_type none{};
+
+    auto it = index.find(the_federate);
+    return it == end(index) ? none : it->second;
+}
+}
+
+void OwnershipIndex::objectOwnerChanged(ObjectHandle the_object,
+                                        FederateHandle previous_owner,
+                                        FederateHandle new_owner)
+{
+    transfer(my_objects, the_object, previous_owner, new_owner);
+}
+
+void OwnershipIndex::attributeOwnerChanged(ObjectHandle the_object,
+                                           AttributeHandle the_attribute,
+                                           FederateHandle previous_owner,
+                                           FederateHandle new_owner)
+{
+    transfer(my_attributes, ObjectAttributeHandle(the_object, the_attribute), previous_owner, new_owner);
+}
+
+const std::set<ObjectHandle>& OwnershipIndex::getObjects(FederateHandle the_federate) const
+{
+    return lookup(my_objects, the_federate);
+}
+
+const std::set<OwnershipIndex::ObjectAttributeHandle>& OwnershipIndex::getAttributes(FederateHandle the_federate) const
+{
+    return lookup(my_attributes, the_federate);
+}
+
+} // namespace certi
@@ -0,0 +1,68 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_OWNERSHIP_INDEX_HH
+#define _CERTI_OWNERSHIP_INDEX_HH
+
+#include "Handle.hh"
+#include <include/certi.hh>
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace certi {
+
+/** What each federate owns in an ObjectSet.
+ *
+ * Objects are indexed by the federate holding their privilege to delete,
+ * attributes by their current owner. Owner 0 means "not owned" and is not
+ * indexed. Objects and attributes report their ownership changes here, so
+ * that resigning or crashed federates can be cleaned up without scanning
+ * every instance of the federation.
+ */
+class CERTI_EXPORT OwnershipIndex {
+public:
+    typedef std::pair<ObjectHandle, AttributeHandle> ObjectAttributeHandle;
+
+    void objectOwnerChanged(ObjectHandle the_object, FederateHandle previous_owner, FederateHandle new_owner);
+
+    void attributeOwnerChanged(ObjectHandle the_object,
+                               AttributeHandle the_attribute,
+                               FederateHandle previous_owner,
+                               FederateHandle new_owner);
+
+    /// Objects the federate may delete, empty if none.
+    const std::set<ObjectHandle>& getObjects(FederateHandle the_federate) const;
+
+    /// Attributes owned by the federate, empty if none.
+    const std::set<ObjectAttributeHandle>& getAttributes(FederateHandle the_federate) const;
+
+private:
+    std::unordered_map<FederateHandle, std::set<ObjectHandle>> my_objects{};
+    std::unordered_map<FederateHandle, std::set<ObjectAttributeHandle>> my_attributes{};
+};
+
+} // namespace certi
+
+#endif // _CERTI_OWNERSHIP_INDEX_HH
@@ -34,7 +34,7 @@
 
 namespace certi {
 
-class Parameter : public Named, public Handled<ParameterHandle> {
+class CERTI_EXPORT Parameter : public Named, public Handled<ParameterHandle> {
 public:
     Parameter(const std::string& name, ParameterHandle parameterHandle);
 
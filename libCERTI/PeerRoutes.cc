@@ -0,0 +1,175 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "PeerRoutes.hh"
+
+#include <algorithm>
+#include <tuple>
+
+#include "NM_Classes.hh"
+#include "PrettyDebug.hh"
+
+namespace certi {
+
+static PrettyDebug D("PEER_ROUTES", __FILE__);
+
+bool PeerRoutes::keepsRoutes(const NetworkMessage::Type type)
+{
+    switch (type) {
+    case NetworkMessage::Type::MESSAGE_NULL:
+    case NetworkMessage::Type::MESSAGE_NULL_PRIME:
+    case NetworkMessage::Type::TIME_ADVANCE_REQUEST:
+    case NetworkMessage::Type::TIME_ADVANCE_REQUEST_AVAILABLE:
+    case NetworkMessage::Type::NEXT_MESSAGE_REQUEST:
+    case NetworkMessage::Type::NEXT_MESSAGE_REQUEST_AVAILABLE:
+    case NetworkMessage::Type::TIME_STATE_UPDATE:
+    case NetworkMessage::Type::SET_TIME_REGULATING:
+    case NetworkMessage::Type::SET_TIME_CONSTRAINED:
+    case NetworkMessage::Type::ENABLE_ASYNCHRONOUS_DELIVERY:
+    case NetworkMessage::Type::DISABLE_ASYNCHRONOUS_DELIVERY:
+    case NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES:
+    case NetworkMessage::Type::BATCH_UPDATE_ATTRIBUTE_VALUES:
+    case NetworkMessage::Type::SEND_INTERACTION:
+    case NetworkMessage::Type::RETRACT:
+    case NetworkMessage::Type::REGISTER_OBJECT:
+    case NetworkMessage::Type::LEASE_OBJECT_HANDLES:
+    case NetworkMessage::Type::RESERVE_OBJECT_INSTANCE_NAME:
+    case NetworkMessage::Type::REQUEST_OBJECT_ATTRIBUTE_VALUE_UPDATE:
+    case NetworkMessage::Type::REQUEST_CLASS_ATTRIBUTE_VALUE_UPDATE:
+    case NetworkMessage::Type::REGISTER_FEDERATION_SYNCHRONIZATION_POINT:
+    case NetworkMessage::Type::SYNCHRONIZATION_POINT_ACHIEVED:
+    case NetworkMessage::Type::PEER_ROUTES_INVALIDATED:
+    case NetworkMessage::Type::PEER_FENCE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool PeerRoutes::fencesPeers(const NetworkMessage::Type type)
+{
+    switch (type) {
+    case NetworkMessage::Type::MESSAGE_NULL:
+    case NetworkMessage::Type::MESSAGE_NULL_PRIME:
+    case NetworkMessage::Type::TIME_ADVANCE_REQUEST:
+    case NetworkMessage::Type::TIME_ADVANCE_REQUEST_AVAILABLE:
+    case NetworkMessage::Type::NEXT_MESSAGE_REQUEST:
+    case NetworkMessage::Type::NEXT_MESSAGE_REQUEST_AVAILABLE:
+    case NetworkMessage::Type::TIME_STATE_UPDATE:
+    case NetworkMessage::Type::PEER_FENCE:
+        return false;
+    default:
+        return true;
+    }
+}
+
+void PeerRoutes::append(NM_Peer_Route& message, const Group& group)
+{
+    const uint32_t rank = message.getClassesSize();
+    message.setClassesSize(rank + 1);
+    message.setClasses(group.interactionClass, rank);
+    message.setHandleCountsSize(rank + 1);
+    message.setHandleCounts(group.handles.size(), rank);
+    message.setEndpointCountsSize(rank + 1);
+    message.setEndpointCounts(group.endpoints.size(), rank);
+
+    for (const auto& handle : group.handles) {
+        message.setHandlesSize(message.getHandlesSize() + 1);
+        message.setHandles(handle, message.getHandlesSize() - 1);
+    }
+    for (const auto& endpoint : group.endpoints) {
+        const uint32_t last = message.getFederatesSize();
+        message.setFederatesSize(last + 1);
+        message.setFederates(endpoint.federate, last);
+        message.setAddressesSize(last + 1);
+        message.setAddresses(endpoint.address, last);
+        message.setPortsSize(last + 1);
+        message.setPorts(endpoint.port, last);
+    }
+}
+
+void PeerRoutes::install(const NM_Peer_Route& message)
+{
+    Key key{message.getObject(), message.getInteractionClass(), message.getRegion(), message.getKeys()};
+    std::sort(begin(key.handles), end(key.handles));
+
+    Route route;
+    uint32_t handle{0};
+    uint32_t endpoint{0};
+    for (uint32_t i = 0; i < message.getClassesSize(); ++i) {
+        Group group{message.getClasses(i), {}, {}};
+        for (uint32_t n = 0; n < message.getHandleCounts(i) && handle < message.getHandlesSize(); ++n, ++handle) {
+            group.handles.push_back(message.getHandles(handle));
+        }
+        for (uint32_t n = 0; n < message.getEndpointCounts(i) && endpoint < message.getFederatesSize();
+             ++n, ++endpoint) {
+            group.endpoints.push_back(
+                {message.getFederates(endpoint), message.getAddresses(endpoint), message.getPorts(endpoint)});
+        }
+        route.push_back(std::move(group));
+    }
+
+    Debug(D, pdDebug) << "Route of object " << key.object << ", interaction " << key.interactionClass << ": "
+                      << route.size() << " groups" << std::endl;
+    my_routes[std::move(key)] = std::move(route);
+}
+
+const PeerRoutes::Route* PeerRoutes::find(const ObjectHandle object, std::vector<AttributeHandle> attributes) const
+{
+    return find(Key{object, 0, 0, std::move(attributes)});
+}
+
+const PeerRoutes::Route* PeerRoutes::find(const InteractionClassHandle interaction_class,
+                                          const RegionHandle region,
+                                          std::vector<ParameterHandle> parameters) const
+{
+    return find(Key{0, interaction_class, region, std::move(parameters)});
+}
+
+void PeerRoutes::clear()
+{
+    my_routes.clear();
+}
+
+size_t PeerRoutes::size() const
+{
+    return my_routes.size();
+}
+
+bool PeerRoutes::Key::operator<(const Key& other) const
+{
+    return std::tie(object, interactionClass, region, handles)
+        < std::tie(other.object, other.interactionClass, other.region, other.handles);
+}
+
+const PeerRoutes::Route* PeerRoutes::find(Key&& key) const
+{
+    if (my_routes.empty()) {
+        return nullptr;
+    }
+    std::sort(begin(key.handles), end(key.handles));
+    auto it = my_routes.find(key);
+    return it == end(my_routes) ? nullptr : &it->second;
+}
+
+} // namespace certi
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_PEER_ROUTES_HH
+#define _CERTI_PEER_ROUTES_HH
+
+#include <include/certi.hh>
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "Handle.hh"
+#include "NetworkMessage.hh"
+
+namespace certi {
+
+class NM_Peer_Route;
+
+/** Routes of the undated updates and interactions a federate sends to the
+ * RTIAs of the subscribers without the RTIG.
+ *
+ * The RTIG stays the broker of declarations, ownership and regions: when it
+ * routes an undated update or interaction of a federate which takes peer to
+ * peer data, it hands back where it went in an NM_Peer_Route, and the RTIA
+ * sends the next identical ones, same object or interaction class and region,
+ * same handles, straight to those endpoints. Any request which may change the
+ * routing makes the RTIG send NM_Peer_Routes_Invalidated to every federate
+ * holding routes, and wait for each of them to send it back before
+ * processing the request. Timestamp ordered traffic always goes through the
+ * RTIG.
+ *
+ * A federate switching between the RTIG and a peer link sends an
+ * NM_Peer_Fence through the RTIG and writes one on the link: the peer keeps
+ * what comes from the link after a fence until it read the same fence from
+ * the RTIG, and reads the link up to a closing fence before going on with
+ * what the RTIG sent after it.
+ */
+class CERTI_EXPORT PeerRoutes {
+public:
+    /// Where an RTIA takes peer to peer data.
+    struct Endpoint {
+        FederateHandle federate;
+        uint32_t address;
+        uint32_t port;
+    };
+
+    /// Endpoints receiving the same handles, as the same interaction class.
+    struct Group {
+        /// 0 for an update
+        InteractionClassHandle interactionClass;
+        std::vector<uint32_t> handles;
+        std::vector<Endpoint> endpoints;
+    };
+
+    using Route = std::vector<Group>;
+
+    /// true if the RTIG processing a message of type leaves the routes as they are.
+    static bool keepsRoutes(const NetworkMessage::Type type);
+
+    /** true if a message of type must reach the peers after the updates and
+     * interactions sent to them directly before.
+     *
+     * The time management messages tell nothing about the receive order ones.
+     */
+    static bool fencesPeers(const NetworkMessage::Type type);
+
+    /// Add group to the route carried by message.
+    static void append(NM_Peer_Route& message, const Group& group);
+
+    /// Hold the route carried by message, in place of any previous one for the same key.
+    void install(const NM_Peer_Route& message);
+
+    /// Route of the undated updates of attributes of object, nullptr if none is held.
+    const Route* find(const ObjectHandle object, std::vector<AttributeHandle> attributes) const;
+
+    /// Route of the undated interactions of class in region with parameters, nullptr if none is held.
+    const Route* find(const InteractionClassHandle interaction_class,
+                      const RegionHandle region,
+                      std::vector<ParameterHandle> parameters) const;
+
+    void clear();
+
+    size_t size() const;
+
+private:
+    struct Key {
+        ObjectHandle object;
+        InteractionClassHandle interactionClass;
+        RegionHandle region;
+        /// sorted
+        std::vector<uint32_t> handles;
+
+        bool operator<(const Key& other) const;
+    };
+
+    const Route* find(Key&& key) const;
+
+    std::map<Key, Route> my_routes{};
+};
+
+} // namespace certi
+
+#endif // _CERTI_PEER_ROUTES_HH
@@ -326,6 +326,7 @@ void RootObject::addRoutingSpace(const RoutingSpace& rs)
 {
     spaces.push_back(rs);
     spaces.back().setHandle(spaces.size());
+    invalidateCompiledFom();
 }
 
 SpaceHandle RootObject::getRoutingSpaceHandle(const std::string& rs) const
@@ -494,7 +495,12 @@ RootObject::deleteObjectInstance(FederateHandle the_federate, ObjectHandle objec
 
 Responses RootObject::killFederate(FederateHandle the_federate)
 {
-    Responses ret = ObjectClasses->killFederate(the_federate);
+    std::vector<Object*> owned;
+    for (const auto& handle : objects->getOwnershipIndex().getObjects(the_federate)) {
+        owned.push_back(objects->getObject(handle));
+    }
+
+    Responses ret = ObjectClasses->killFederate(the_federate, owned);
     Interactions->killFederate(the_federate);
     objects->killFederate(the_federate);
     return ret;
@@ -525,6 +531,39 @@ Interaction* RootObject::getInteractionClass(InteractionClassHandle the_class)
     return Interactions->getObjectFromHandle(the_class);
 }
 
+std::shared_ptr<const CompiledFom> RootObject::getCompiledFom()
+{
+    if (!my_compiled_fom) {
+        my_compiled_fom = std::make_shared<const CompiledFom>(*this);
+        setCompiledFom(my_compiled_fom);
+    }
+    return my_compiled_fom;
+}
+
+void RootObject::refreshCompiledFom()
+{
+    my_compiled_fom.reset();
+    getCompiledFom();
+}
+
+void RootObject::invalidateCompiledFom()
+{
+    if (my_compiled_fom) {
+        my_compiled_fom.reset();
+        setCompiledFom(nullptr);
+    }
+}
+
+void RootObject::setCompiledFom(const std::shared_ptr<const CompiledFom>& fom)
+{
+    for (auto it = ObjectClasses->handled_begin(); it != ObjectClasses->handled_end(); ++it) {
+        it->second->setCompiledFom(fom);
+    }
+    for (auto it = Interactions->handled_begin(); it != Interactions->handled_end(); ++it) {
+        it->second->setCompiledFom(fom);
+    }
+}
+
 FederateHandle RootObject::requestObjectOwner(FederateHandle theFederateHandle, ObjectHandle theObject)
 {
     Debug(G, pdGendoc) << "into RootObject::requestObjectOwner" << std::endl;
@@ -540,11 +579,13 @@ void RootObject::getAllObjectInstancesFromFederate(FederateHandle the_federate,
 void RootObject::addObjectClass(ObjectClass* currentOC, ObjectClass* parentOC)
 {
     ObjectClasses->addClass(currentOC, parentOC);
+    invalidateCompiledFom();
 }
 
 void RootObject::addInteractionClass(Interaction* currentIC, Interaction* parentIC)
 {
     Interactions->addClass(currentIC, parentIC);
+    invalidateCompiledFom();
 }
 
 void RootObject::convertToSerializedFOM(NM_Join_Federation_Execution& message)
@@ -868,6 +909,7 @@ void RootObject::rebuildFromSerializedFOM(const NM_Join_Federation_Execution& me
             current->addParameter(parameter);
         }
     }
+    refreshCompiledFom();
 }
 
 void RootObject::rebuildFromSerializedFOM(const NM_Additional_Fom_Module& message)
@@ -967,6 +1009,7 @@ void RootObject::rebuildFromSerializedFOM(const NM_Additional_Fom_Module& messag
             }
         }
     }
+    refreshCompiledFom();
 }
 
 int RootObject::getFreeObjectClassHandle()
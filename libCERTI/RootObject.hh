@@ -23,8 +23,10 @@
 #ifndef LIBCERTI_ROOT_OBJECT
 #define LIBCERTI_ROOT_OBJECT
 
+#include <memory>
 #include <vector>
 
+#include "CompiledFom.hh"
 #include "HandleManager.hh"
 #include "MessageEvent.hh"
 #include "NameReservation.hh"
@@ -135,6 +137,18 @@ public:
 
     Interaction* getInteractionClass(InteractionClassHandle);
 
+    /** The classes of the FOM, indexed by handle.
+     *
+     * Compiled on first use, and again after classes or routing spaces were
+     * added. Holders of the returned pointer keep the FOM they got. The
+     * object and interaction classes look their attributes and parameters up
+     * in it once it is compiled.
+     */
+    std::shared_ptr<const CompiledFom> getCompiledFom();
+
+    /// Compile the FOM again, once a module was added to it.
+    void refreshCompiledFom();
+
     Object* getObject(ObjectHandle);
 
     ObjectClassAttribute* getObjectClassAttribute(ObjectHandle, AttributeHandle);
@@ -193,6 +207,14 @@ private:
     // Regions
     std::list<RTIRegion*> regions;
     HandleManager<RegionHandle> regionHandles;
+
+    std::shared_ptr<const CompiledFom> my_compiled_fom{};
+
+    /// Forget the compiled FOM, and have the classes search their own maps until it is compiled again.
+    void invalidateCompiledFom();
+
+    /// Hand fom to every object and interaction class.
+    void setCompiledFom(const std::shared_ptr<const CompiledFom>& fom);
     
 public: // FIXME encapsulation
 
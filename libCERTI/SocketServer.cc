@@ -40,7 +40,7 @@ int SocketServer::addToFDSet(fd_set* select_fdset)
 
     list<SocketTuple*>::iterator i;
     for (i = begin(); i != end(); ++i) {
-        if ((*i)->ReliableLink != NULL) {
+        if ((*i)->ReliableLink != NULL && (*i)->ReliableLink->returnSocket() >= 0) {
             int fd = (*i)->ReliableLink->returnSocket();
             FD_SET(fd, select_fdset);
             fd_max = fd > fd_max ? fd : fd_max;
@@ -160,7 +160,8 @@ Socket* SocketServer::getActiveSocket(fd_set* select_fdset) const
 {
     list<SocketTuple*>::const_iterator i;
     for (i = begin(); i != end(); ++i) {
-        if (((*i)->ReliableLink != NULL) && (FD_ISSET((*i)->ReliableLink->returnSocket(), select_fdset)))
+        if (((*i)->ReliableLink != NULL) && ((*i)->ReliableLink->returnSocket() >= 0)
+            && (FD_ISSET((*i)->ReliableLink->returnSocket(), select_fdset)))
             return (*i)->ReliableLink;
     }
 
@@ -229,7 +230,7 @@ SocketTuple* SocketServer::getWithSocket(long socket_descriptor) const
     throw RTIinternalError("Socket not found.");
 }
 
-void SocketServer::open()
+SocketTCP* SocketServer::open()
 {
 #ifdef WITH_GSSAPI
     SecureTCPSocket* newLink = new SecureTCPSocket();
@@ -242,10 +243,32 @@ void SocketServer::open()
 
     newLink->accept(ServerSocketTCP);
 
-    SocketTuple* newTuple = new SocketTuple(newLink);
+    open(newLink);
+    return newLink;
+}
+
+SocketTCP* SocketServer::openAccepted(SOCKET accepted)
+{
+#ifdef WITH_GSSAPI
+    SecureTCPSocket* newLink = new SecureTCPSocket();
+#else
+    SocketTCP* newLink = new SocketTCP();
+#endif
+
+    newLink->attach(accepted);
+
+    open(newLink);
+    return newLink;
+}
+
+void SocketServer::open(SocketTCP* link)
+{
+    SocketTuple* newTuple = new SocketTuple(link);
 
 #ifdef CERTI_RTIG_USE_EPOLL    
-    addElementEpoll(newTuple->ReliableLink->returnSocket());
+    if (newTuple->ReliableLink->returnSocket() >= 0) {
+        addElementEpoll(newTuple->ReliableLink->returnSocket());
+    }
 #endif
     if (newTuple == NULL)
         throw RTIinternalError("Could not allocate new tuple.");
@@ -278,7 +301,7 @@ void SocketServer::constructPollList()
 	std::memset(&pfd, 0, sizeof(pfd));
     list<SocketTuple*>::iterator i;
     for (i = begin(); i != end(); ++i) {
-        if ((*i)->ReliableLink != NULL) {
+        if ((*i)->ReliableLink != NULL && (*i)->ReliableLink->returnSocket() >= 0) {
             int fd = (*i)->ReliableLink->returnSocket();
             pfd.fd = fd;
             pfd.events = POLLIN;
@@ -306,7 +329,7 @@ void SocketServer::constructEpollList()
 	struct epoll_event ev;
     list<SocketTuple*>::iterator i;
     for (i = begin(); i != end(); ++i) {
-        if ((*i)->ReliableLink != NULL) {
+        if ((*i)->ReliableLink != NULL && (*i)->ReliableLink->returnSocket() >= 0) {
             int fd = (*i)->ReliableLink->returnSocket();
             ev.data.fd = fd;
             ev.events = EPOLLIN;
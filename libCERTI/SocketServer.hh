@@ -83,8 +83,24 @@ public:
      * 
      * The SocketTuple references are empty.
      * Throw RTIinternalError in case of a memory allocation problem.
+     * @return the accepted link
      */
-    void open();
+    SocketTCP* open();
+
+    /** Allocate a new SocketTuple for the connection accepted on the
+     * ServerSocket by other means than open, see IoUring.
+     *
+     * @return the accepted link
+     */
+    SocketTCP* openAccepted(SOCKET accepted);
+
+    /** Allocate a new SocketTuple for link, connected by other means than
+     * an accept, which is owned by the tuple from now on.
+     *
+     * A link without descriptor, whose returnSocket is negative, is not
+     * waited on.
+     */
+    void open(SocketTCP* link);
 
     /** Close and delete the Socket object whose socket is "Socket",
      * and return the former references associated with this socket in
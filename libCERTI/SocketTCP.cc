@@ -165,9 +165,6 @@ int SocketTCP::connect(in_port_t port, in_addr_t addr)
 // ----------------------------------------------------------------------------
 int SocketTCP::accept(SocketTCP* server)
 {
-    struct protoent* TCPent;
-    int optval = 1;
-
 #ifdef _WIN32
     int l;
 #else
@@ -184,6 +181,33 @@ int SocketTCP::accept(SocketTCP* server)
         throw NetworkError("SocketTCP: Accept Failed <" + std::string(strerror(errno)) + ">");
     }
 
+    return setAccepted();
+}
+
+// ----------------------------------------------------------------------------
+int SocketTCP::attach(SOCKET accepted)
+{
+#ifdef _WIN32
+    int l;
+#else
+    socklen_t l;
+#endif
+
+    assert(!_est_init_tcp);
+
+    l = sizeof(_sockIn);
+    _socket_tcp = accepted;
+    getpeername(_socket_tcp, (sockaddr*) &_sockIn, &l);
+
+    return setAccepted();
+}
+
+// ----------------------------------------------------------------------------
+int SocketTCP::setAccepted()
+{
+    struct protoent* TCPent;
+    int optval = 1;
+
     // Set the TCP_NODELAY option(Server Side)
     TCPent = getprotobyname("tcp");
     if (TCPent == NULL) {
@@ -292,6 +316,14 @@ void SocketTCP::createServer(in_port_t port, in_addr_t addr)
                            + strerror(errno));
     }
 
+    // learn the port the system chose if none was given
+#ifdef _WIN32
+    int l = sizeof(_sockIn);
+#else
+    socklen_t l = sizeof(_sockIn);
+#endif
+    getsockname(_socket_tcp, (sockaddr*) &_sockIn, &l);
+
     _est_init_tcp = true;
 }
 
@@ -464,6 +496,12 @@ unsigned long SocketTCP::returnAdress() const
     return getAddr();
 }
 
+// ----------------------------------------------------------------------------
+in_port_t SocketTCP::returnPort() const
+{
+    return ntohs(getPort());
+}
+
 // ----------------------------------------------------------------------------
 SOCKET SocketTCP::returnSocket()
 {
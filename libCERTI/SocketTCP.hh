@@ -51,6 +51,9 @@ public:
     void createServer(in_port_t port = 0, in_addr_t addr = INADDR_ANY);
 
     int accept(SocketTCP* server);
+
+    /// Take over accepted, a connection accepted by other means than accept.
+    int attach(SOCKET accepted);
     virtual void send(const unsigned char*, size_t);
     virtual void receive(void* buffer, unsigned long size);
 
@@ -58,6 +61,9 @@ public:
 
     virtual unsigned long returnAdress() const;
 
+    /// Port of the socket address in host order, the one listened on for a server.
+    in_port_t returnPort() const;
+
     SocketTCP& operator=(SocketTCP& theSocket);
 
     virtual SOCKET returnSocket();
@@ -78,6 +84,9 @@ protected:
     ByteCount_t RcvdBytesCount;
 
 private:
+    /// Set up the connection just accepted.
+    int setAccepted();
+
     int open();
     int connect(in_port_t port, in_addr_t addr);
     int listen(unsigned long howMuch = 5);
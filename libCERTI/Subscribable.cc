@@ -103,7 +103,7 @@ Subscribable::~Subscribable()
  */
 void Subscribable::unsubscribe(FederateHandle fed)
 {
-    std::remove_if(subscribers.begin(), subscribers.end(), HandleComparator<Subscriber>(fed));
+    subscribers.remove_if(HandleComparator<Subscriber>(fed));
 }
 
 // ----------------------------------------------------------------------------
@@ -36,7 +36,7 @@ class RTIRegion;
 
 namespace certi {
 
-class Subscriber {
+class CERTI_EXPORT Subscriber {
 public:
     Subscriber(FederateHandle);
     Subscriber(FederateHandle, const RTIRegion*);
@@ -76,6 +76,11 @@ public:
     void addFederatesIfOverlap(ObjectClassBroadcastList&, const RTIRegion*, Handle) const;
     void addFederatesIfOverlap(InteractionBroadcastList&, const RTIRegion*) const;
 
+    const std::list<Subscriber>& getSubscribers() const
+    {
+        return subscribers;
+    }
+
 private:
     std::list<Subscriber> subscribers;
 };
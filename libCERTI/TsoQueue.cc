@@ -0,0 +1,120 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "TsoQueue.hh"
+
+#include <iterator>
+
+#include "NM_Classes.hh"
+#include "PrettyDebug.hh"
+
+namespace certi {
+
+static PrettyDebug D("TSO_QUEUE", __FILE__);
+
+EventRetractionHandle TsoQueue::eventOf(const NetworkMessage& msg)
+{
+    switch (msg.getMessageType()) {
+    case NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES: {
+        const auto& reflection = static_cast<const NM_Reflect_Attribute_Values&>(msg);
+        return reflection.hasEvent() ? reflection.getEvent() : 0;
+    }
+    case NetworkMessage::Type::RECEIVE_INTERACTION: {
+        const auto& interaction = static_cast<const NM_Receive_Interaction&>(msg);
+        return interaction.hasEvent() ? interaction.getEvent() : 0;
+    }
+    default:
+        return 0;
+    }
+}
+
+uint64_t TsoQueue::key(const FederateHandle federate, const EventRetractionHandle event)
+{
+    return (static_cast<uint64_t>(federate) << 32) | event;
+}
+
+void TsoQueue::insert(NetworkMessage* msg)
+{
+    // stricly greater because we want to place new message behind
+    // older ones with same logical time and thus keep receive order
+    auto position = my_messages.end();
+    while (position != my_messages.begin() && (*std::prev(position))->getDate() > msg->getDate()) {
+        --position;
+    }
+    position = my_messages.insert(position, msg);
+
+    if (auto event = eventOf(*msg)) {
+        my_events[key(msg->getFederate(), event)] = position;
+    }
+}
+
+bool TsoQueue::empty() const
+{
+    return my_messages.empty();
+}
+
+size_t TsoQueue::size() const
+{
+    return my_messages.size();
+}
+
+NetworkMessage* TsoQueue::front() const
+{
+    return my_messages.empty() ? nullptr : my_messages.front();
+}
+
+NetworkMessage* TsoQueue::pop()
+{
+    if (my_messages.empty()) {
+        return nullptr;
+    }
+    auto msg = my_messages.front();
+    my_messages.pop_front();
+    unindex(*msg);
+    return msg;
+}
+
+NetworkMessage* TsoQueue::retract(const FederateHandle federate, const EventRetractionHandle event)
+{
+    auto it = my_events.find(key(federate, event));
+    if (it == my_events.end()) {
+        return nullptr;
+    }
+
+    auto msg = *it->second;
+    my_messages.erase(it->second);
+    my_events.erase(it);
+
+    Debug(D, pdDebug) << "Event " << event << " of federate " << federate << " retracted, " << my_messages.size()
+                      << " messages left" << std::endl;
+    return msg;
+}
+
+void TsoQueue::unindex(const NetworkMessage& msg)
+{
+    if (auto event = eventOf(msg)) {
+        my_events.erase(key(msg.getFederate(), event));
+    }
+}
+
+} // namespace certi
@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_TSO_QUEUE_HH
+#define _CERTI_TSO_QUEUE_HH
+
+#include <include/certi.hh>
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include "Handle.hh"
+
+namespace certi {
+
+class NetworkMessage;
+
+/** Messages waiting for their date, the earliest first.
+ *
+ * Messages of the same date keep their arrival order. Dated reflections and
+ * interactions carrying an event retraction handle are indexed by sending
+ * federate and handle, so the retraction of an event still waiting removes
+ * it in constant time, whatever the number of pending messages.
+ *
+ * The queue does not own the messages: the caller deletes what it is given.
+ */
+class CERTI_EXPORT TsoQueue {
+public:
+    /// The event retraction handle of msg, 0 if it cannot be retracted.
+    static EventRetractionHandle eventOf(const NetworkMessage& msg);
+
+    /** Queue msg behind the messages of the same or earlier date.
+     *
+     * The queue is searched from its end: messages mostly arrive in date order.
+     */
+    void insert(NetworkMessage* msg);
+
+    bool empty() const;
+    size_t size() const;
+
+    /// The earliest message, nullptr if the queue is empty.
+    NetworkMessage* front() const;
+
+    /// Remove and return the earliest message, nullptr if the queue is empty.
+    NetworkMessage* pop();
+
+    /// Remove and return the message of event sent by federate, nullptr if it is not queued.
+    NetworkMessage* retract(const FederateHandle federate, const EventRetractionHandle event);
+
+private:
+    using Messages = std::list<NetworkMessage*>;
+
+    static uint64_t key(const FederateHandle federate, const EventRetractionHandle event);
+
+    void unindex(const NetworkMessage& msg);
+
+    Messages my_messages{};
+    std::unordered_map<uint64_t, Messages::iterator> my_events{};
+};
+
+} // namespace certi
+
+#endif // _CERTI_TSO_QUEUE_HH
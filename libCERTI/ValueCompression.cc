@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#include "ValueCompression.hh"
+
+#include <cstdlib>
+#include <string>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "Exception.hh"
+#include "PrettyDebug.hh"
+
+namespace {
+static constexpr auto thresholdEnvironmentVariable = "CERTI_COMPRESSION_THRESHOLD";
+}
+
+namespace certi {
+
+static PrettyDebug D("COMPRESSION", __FILE__);
+
+double ValueCompression::Statistics::ratio() const
+{
+    if (raw_bytes == 0) {
+        return 1.0;
+    }
+    return static_cast<double>(compressed_bytes) / static_cast<double>(raw_bytes);
+}
+
+void ValueCompression::Statistics::print(std::ostream& stream) const
+{
+    stream << " Values compressed : " << compressed << " (" << raw_bytes << " -> " << compressed_bytes
+           << " Bytes, ratio " << ratio() << ", "
+           << std::chrono::duration_cast<std::chrono::microseconds>(compression_time).count() << " us)" << std::endl
+           << " Values not worth compressing : " << incompressible << std::endl
+           << " Values decompressed : " << decompressed << " ("
+           << std::chrono::duration_cast<std::chrono::microseconds>(decompression_time).count() << " us)"
+           << std::endl;
+}
+
+std::ostream& operator<<(std::ostream& stream, const ValueCompression::Statistics& statistics)
+{
+    statistics.print(stream);
+    return stream;
+}
+
+bool ValueCompression::isAvailable()
+{
+#ifdef HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t ValueCompression::thresholdFromEnvironment()
+{
+    auto threshold_s = getenv(thresholdEnvironmentVariable);
+    if (threshold_s && *threshold_s) {
+        return static_cast<uint32_t>(std::stoul(threshold_s));
+    }
+    return 0;
+}
+
+ValueCompression::ValueCompression(const uint32_t threshold) : my_threshold(isAvailable() ? threshold : 0)
+{
+}
+
+uint32_t ValueCompression::getThreshold() const
+{
+    return my_threshold;
+}
+
+void ValueCompression::setThreshold(const uint32_t threshold)
+{
+    my_threshold = isAvailable() ? threshold : 0;
+}
+
+const ValueCompression::Statistics& ValueCompression::statistics() const
+{
+    return my_statistics;
+}
+
+uint32_t ValueCompression::compressValue(std::vector<char>& value)
+{
+    if (value.size() < my_threshold) {
+        return 0;
+    }
+#ifdef HAVE_ZLIB
+    auto start = std::chrono::steady_clock::now();
+
+    uLongf compressed_size = compressBound(value.size());
+    std::vector<char> compressed(compressed_size);
+    auto result = compress2(reinterpret_cast<Bytef*>(compressed.data()),
+                            &compressed_size,
+                            reinterpret_cast<const Bytef*>(value.data()),
+                            value.size(),
+                            Z_BEST_SPEED);
+
+    my_statistics.compression_time += std::chrono::steady_clock::now() - start;
+
+    if (result != Z_OK || compressed_size >= value.size()) {
+        ++my_statistics.incompressible;
+        return 0;
+    }
+
+    const auto raw_size = static_cast<uint32_t>(value.size());
+    compressed.resize(compressed_size);
+    value.swap(compressed);
+
+    ++my_statistics.compressed;
+    my_statistics.raw_bytes += raw_size;
+    my_statistics.compressed_bytes += compressed_size;
+    return raw_size;
+#else
+    return 0;
+#endif
+}
+
+void ValueCompression::decompressValue(std::vector<char>& value, const uint32_t raw_size)
+{
+#ifdef HAVE_ZLIB
+    auto start = std::chrono::steady_clock::now();
+
+    uLongf size = raw_size;
+    std::vector<char> raw(raw_size);
+    auto result = uncompress(
+        reinterpret_cast<Bytef*>(raw.data()), &size, reinterpret_cast<const Bytef*>(value.data()), value.size());
+
+    my_statistics.decompression_time += std::chrono::steady_clock::now() - start;
+
+    if (result != Z_OK || size != raw_size) {
+        Debug(D, pdExcept) << "Cannot decompress value of " << value.size() << " bytes, zlib error " << result
+                           << std::endl;
+        throw RTIinternalError("Corrupted compressed value");
+    }
+
+    value.swap(raw);
+    ++my_statistics.decompressed;
+#else
+    (void) value;
+    (void) raw_size;
+    throw RTIinternalError("Compressed value received, but CERTI was built without zlib");
+#endif
+}
+
+} // namespace certi
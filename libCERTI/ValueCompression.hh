@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI-libCERTI
+//
+// CERTI-libCERTI is free software ; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public License
+// as published by the Free Software Foundation ; either version 2 of
+// the License, or (at your option) any later version.
+//
+// CERTI-libCERTI is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307
+// USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef _CERTI_VALUE_COMPRESSION_HH
+#define _CERTI_VALUE_COMPRESSION_HH
+
+#include <include/certi.hh>
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace certi {
+
+/** Compression of large attribute and parameter values on the wire.
+ *
+ * A value is compressed only if it is at least threshold bytes long and
+ * deflate makes it smaller. The uncompressed size of each value travels in
+ * the rawSizes field of the message, 0 for a value sent as is. rawSizes is
+ * left empty when no value is compressed, so that small updates cost four
+ * bytes more and nothing else.
+ *
+ * Compression is negotiated at join: the RTIA only compresses values if the
+ * RTIG granted it, and the RTIG forwards compressed values untouched, except
+ * to federates which did not ask for compression. It is available only if
+ * CERTI is built with zlib.
+ */
+class CERTI_EXPORT ValueCompression {
+public:
+    struct Statistics {
+        /// values compressed, and their size before and after
+        uint64_t compressed{0};
+        uint64_t raw_bytes{0};
+        uint64_t compressed_bytes{0};
+        /// values above the threshold that deflate could not make smaller
+        uint64_t incompressible{0};
+        uint64_t decompressed{0};
+        std::chrono::nanoseconds compression_time{0};
+        std::chrono::nanoseconds decompression_time{0};
+
+        /// Compressed size over raw size of the values compressed, 1 if none.
+        double ratio() const;
+
+        void print(std::ostream& stream) const;
+    };
+
+    static bool isAvailable();
+
+    /// Threshold read from CERTI_COMPRESSION_THRESHOLD, 0 if unset.
+    static uint32_t thresholdFromEnvironment();
+
+    /// Compress values of at least threshold bytes, none if threshold is 0.
+    explicit ValueCompression(const uint32_t threshold = 0);
+
+    uint32_t getThreshold() const;
+    void setThreshold(const uint32_t threshold);
+
+    /// Compress the values of message which are worth it, and set its raw sizes.
+    template <typename Message>
+    void compress(Message& message);
+
+    /** Restore the values of message compressed by the sender, and clear its raw sizes.
+     *
+     * @throw RTIinternalError if a value cannot be decompressed
+     */
+    template <typename Message>
+    void decompress(Message& message);
+
+    const Statistics& statistics() const;
+
+private:
+    /// Compress value in place, return its raw size or 0 if it was left as is.
+    uint32_t compressValue(std::vector<char>& value);
+
+    void decompressValue(std::vector<char>& value, const uint32_t raw_size);
+
+    uint32_t my_threshold;
+    Statistics my_statistics{};
+};
+
+template <typename Message>
+void ValueCompression::compress(Message& message)
+{
+    if (my_threshold == 0) {
+        return;
+    }
+
+    bool any{false};
+    for (uint32_t i{0}; i < message.getValuesSize() && !any; ++i) {
+        any = message.getValues(i).size() >= my_threshold;
+    }
+    if (!any) {
+        return;
+    }
+
+    std::vector<uint32_t> raw_sizes(message.getValuesSize(), 0);
+    any = false;
+    for (uint32_t i{0}; i < message.getValuesSize(); ++i) {
+        raw_sizes[i] = compressValue(message.getValues(i));
+        any = any || raw_sizes[i] != 0;
+    }
+    if (!any) {
+        return;
+    }
+
+    message.setRawSizesSize(raw_sizes.size());
+    for (uint32_t i{0}; i < raw_sizes.size(); ++i) {
+        message.setRawSizes(raw_sizes[i], i);
+    }
+}
+
+template <typename Message>
+void ValueCompression::decompress(Message& message)
+{
+    for (uint32_t i{0}; i < message.getRawSizesSize() && i < message.getValuesSize(); ++i) {
+        if (message.getRawSizes(i) != 0) {
+            decompressValue(message.getValues(i), message.getRawSizes(i));
+        }
+    }
+    message.setRawSizesSize(0);
+}
+
+CERTI_EXPORT std::ostream& operator<<(std::ostream& stream, const ValueCompression::Statistics& statistics);
+
+} // namespace certi
+
+#endif // _CERTI_VALUE_COMPRESSION_HH
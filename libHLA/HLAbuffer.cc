@@ -17,14 +17,254 @@
 #include "HLAbuffer.hh"
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#ifndef _WIN32
+#include "tlsf.h"
+#endif
 
 // #define HLATYPES_IEEE1516_DISPLAYPRINTABLE
 
 namespace libhla {
 
-__HLAbuffer::BufferList __HLAbuffer::gBuffers;
+typedef std::map<char*, __HLAbuffer*> BufferList;
+
+// buffers registered by a thread, kept once the thread ended as its buffers may live on
+struct __HLAbufferRegistry {
+    std::mutex mutex;
+    BufferList buffers;
+    // incremented when a buffer is removed, the caches of buffers found here are then stale
+    std::atomic<unsigned long> epoch;
+    // taken by a running thread
+    std::atomic<bool> used;
+    // registries are never deleted, new ones are pushed at the head
+    __HLAbufferRegistry* next;
+
+    __HLAbufferRegistry() : epoch(0), used(true), next(NULL)
+    {
+    }
+};
+
+namespace {
+std::atomic<__HLAbufferRegistry*>& registries()
+{
+    static std::atomic<__HLAbufferRegistry*> gRegistries(NULL);
+    return gRegistries;
+}
+
+// incremented when user memory is registered, as it may nest in any cached buffer
+std::atomic<unsigned long>& nestingEpoch()
+{
+    static std::atomic<unsigned long> gNestingEpoch(0);
+    return gNestingEpoch;
+}
+
+// registry of the calling thread, one left by an ended thread if any
+struct ThreadRegistry {
+    __HLAbufferRegistry* registry;
+
+    ThreadRegistry() : registry(NULL)
+    {
+        for (__HLAbufferRegistry* r = registries().load(std::memory_order_acquire); r != NULL; r = r->next) {
+            bool used = false;
+            if (r->used.compare_exchange_strong(used, true)) {
+                registry = r;
+                return;
+            }
+        }
+        registry = new __HLAbufferRegistry;
+        registry->next = registries().load(std::memory_order_relaxed);
+        while (!registries().compare_exchange_weak(registry->next, registry, std::memory_order_release))
+            ;
+    }
+
+    ~ThreadRegistry()
+    {
+        registry->used.store(false, std::memory_order_release);
+    }
+};
+
+thread_local ThreadRegistry tRegistry;
+
+// last buffer found by a thread, valid while the epochs it was found at did not change
+struct BufferCache {
+    __HLAbuffer* buffer;
+    const char* begin;
+    const char* end;
+    __HLAbufferRegistry* registry;
+    unsigned long epoch;
+    unsigned long nesting;
+};
+
+thread_local BufferCache tLastBuffer = {NULL, NULL, NULL, NULL, 0, 0};
+}
+
+void __HLAbuffer::__register(__HLAbuffer* buffer)
+{
+    __HLAbufferRegistry* registry = tRegistry.registry;
+    {
+        std::lock_guard<std::mutex> lock(registry->mutex);
+        registry->buffers[buffer->mBegin + buffer->mCapacity - 1] = buffer;
+    }
+    buffer->mRegistry = registry;
+    // allocated memory cannot be inside another buffer, user memory may be
+    if (buffer->mUserAllocated)
+        nestingEpoch().fetch_add(1, std::memory_order_release);
+}
+
+void __HLAbuffer::__unregister(__HLAbuffer* buffer)
+{
+    __HLAbufferRegistry* registry = buffer->mRegistry;
+    std::lock_guard<std::mutex> lock(registry->mutex);
+    registry->buffers.erase(buffer->mBegin + buffer->mCapacity - 1);
+    registry->epoch.fetch_add(1, std::memory_order_release);
+}
+
+__HLAbuffer* __HLAbuffer::__find_buffer(const void* __this)
+{
+    const char* pointer = (const char*) __this;
+
+    BufferCache& last = tLastBuffer;
+    if (last.buffer != NULL && pointer >= last.begin && pointer < last.end
+        && last.registry->epoch.load(std::memory_order_acquire) == last.epoch
+        && nestingEpoch().load(std::memory_order_acquire) == last.nesting)
+        return last.buffer;
+
+    const unsigned long nesting = nestingEpoch().load(std::memory_order_acquire);
+    __HLAbuffer* result = NULL;
+    for (__HLAbufferRegistry* r = registries().load(std::memory_order_acquire); r != NULL; r = r->next) {
+        std::lock_guard<std::mutex> lock(r->mutex);
+        // find the first pointer not less than "this", the last pointer
+        BufferList::iterator found = r->buffers.lower_bound((char*) pointer);
+        if (found == r->buffers.end() || pointer < found->second->mBegin)
+            continue;
+        // the innermost buffer of all registries, as within one registry
+        if (result == NULL || found->first < result->mBegin + result->mCapacity - 1) {
+            result = found->second;
+            last.registry = r;
+            last.epoch = r->epoch.load(std::memory_order_relaxed);
+        }
+    }
+    if (result == NULL) {
+        last.buffer = NULL;
+        return NULL;
+    }
+
+    last.buffer = result;
+    last.begin = result->mBegin;
+    last.end = result->mBegin + result->mCapacity;
+    last.nesting = nesting;
+    return result;
+}
+
+// storage of a pool for one thread
+struct HLApool::Area {
+    char* memory;
+    std::thread::id owner;
+    // only contended when a buffer is released by another thread
+    std::mutex mutex;
+    // areas are deleted with the pool, new ones are pushed at the head
+    Area* next;
+};
+
+namespace {
+std::atomic<unsigned long> gPoolIds(0);
+
+// last pool a thread allocated from, and its area
+struct AreaCache {
+    unsigned long pool;
+    void* area;
+};
+
+thread_local AreaCache tLastArea = {0, NULL};
+}
+
+HLApool::HLApool(size_t size) : mSize(size), mId(++gPoolIds), mAreas(NULL)
+{
+}
+
+HLApool::~HLApool()
+{
+    Area* area = mAreas.load(std::memory_order_acquire);
+    while (area != NULL) {
+        Area* next = area->next;
+#ifndef _WIN32
+        if (area->memory != NULL) {
+            destroy_memory_pool(area->memory);
+            free(area->memory);
+        }
+#endif
+        delete area;
+        area = next;
+    }
+}
+
+HLApool::Area* HLApool::__area()
+{
+    AreaCache& last = tLastArea;
+    if (last.pool == mId)
+        return (Area*) last.area;
+
+    const std::thread::id self = std::this_thread::get_id();
+    Area* area = mAreas.load(std::memory_order_acquire);
+    while (area != NULL && area->owner != self)
+        area = area->next;
+
+    if (area == NULL) {
+        area = new Area;
+        area->memory = NULL;
+        area->owner = self;
+#ifndef _WIN32
+        // zeroed, a stale TLSF signature would be taken for an initialised pool
+        area->memory = (char*) calloc(1, mSize);
+        // init_memory_pool() also sets the default pool of the TLSF library
+        static std::mutex gInitMutex;
+        std::lock_guard<std::mutex> lock(gInitMutex);
+        if (area->memory != NULL && init_memory_pool(mSize, area->memory) == (size_t) -1) {
+            free(area->memory);
+            area->memory = NULL;
+        }
+#endif
+        area->next = mAreas.load(std::memory_order_relaxed);
+        while (!mAreas.compare_exchange_weak(area->next, area, std::memory_order_release))
+            ;
+    }
+
+    last.pool = mId;
+    last.area = area;
+    return area;
+}
+
+void* HLApool::allocate(size_t size)
+{
+#ifndef _WIN32
+    Area* area = __area();
+    if (area->memory != NULL) {
+        std::lock_guard<std::mutex> lock(area->mutex);
+        return calloc_ex(1, size, area->memory);
+    }
+#endif
+    return NULL;
+}
+
+void HLApool::release(void* memory)
+{
+#ifndef _WIN32
+    // the areas are disjoint, the one holding the memory may belong to another thread
+    for (Area* area = mAreas.load(std::memory_order_acquire); area != NULL; area = area->next) {
+        if (area->memory != NULL && (char*) memory >= area->memory && (char*) memory < area->memory + mSize) {
+            std::lock_guard<std::mutex> lock(area->mutex);
+            free_ex(memory, area->memory);
+            return;
+        }
+    }
+#endif
+}
 
 bool __HLAbuffer::__is_big_endian()
 {
@@ -17,8 +17,8 @@
 #ifndef _HLATYPES_BUFFER_HH
 #define _HLATYPES_BUFFER_HH
 
+#include <atomic>
 #include <cstdlib>
-#include <map>
 #include <stdexcept>
 #include <utility>
 
@@ -34,12 +34,57 @@ HLA_EXPORT std::ostream& __print_buffer(std::ostream& stream, const void* buffer
  * All structures must have no virtual functions and no non-static members.
  */
 
+/** Memory pool for HLAdata buffers.
+ *
+ * Encoding many small records calls calloc() and free() for every buffer. An
+ * HLAdata created with a pool takes its storage from the pool instead, and so
+ * do the buffers it is resized into. When the pool is exhausted, buffers fall
+ * back to calloc().
+ *
+ * Each thread allocating from the pool gets an area of <size> bytes of its own,
+ * so that threads sharing a pool do not contend. A buffer may be released by
+ * another thread than the one which allocated it. The pool must outlive the
+ * buffers allocated from it.
+ */
+class HLA_EXPORT HLApool {
+public:
+    explicit HLApool(size_t size);
+    ~HLApool();
+
+    HLApool(const HLApool&) = delete;
+    HLApool& operator=(const HLApool&) = delete;
+
+    //! Zero-filled storage of <size> bytes, or NULL if the pool is exhausted
+    void* allocate(size_t size);
+    void release(void* memory);
+
+private:
+    struct Area;
+
+    //! Area of the calling thread, created on its first allocation
+    Area* __area();
+
+    size_t mSize;
+    // distinguishes the pools in the thread caches, an address may be reused
+    unsigned long mId;
+    std::atomic<Area*> mAreas;
+};
+
+struct __HLAbufferRegistry;
+
 class HLA_EXPORT __HLAbuffer {
 private:
-    // static buffer for all instantiations of the HLAdata template
-    // indexed by "last pointers", i.e. pointers to the last byte in the buffer
-    typedef std::map<char*, __HLAbuffer*> BufferList;
-    static BufferList gBuffers;
+    // buffers are registered by the thread creating them, in a registry of its own
+    /* Each registry indexes its buffers by "last pointers", i.e. pointers to
+     * the last byte in the buffer. A thread-local cache of the last buffer
+     * found avoids most of the searches. Removing a buffer only makes stale
+     * the caches of buffers of the same registry, and registering user memory
+     * the caches of all threads, as the new buffer may nest in a cached one.
+     */
+    static void __register(__HLAbuffer* buffer);
+    static void __unregister(__HLAbuffer* buffer);
+
+    __HLAbufferRegistry* mRegistry;
 
     // used to verify that user set correct endianess
     static bool __is_big_endian();
@@ -61,63 +106,68 @@ public:
     size_t mCapacity;
     // no automatic free() and realloc() for user allocated memory
     bool mUserAllocated;
+    // pool the buffer was allocated from, NULL if allocated by calloc()
+    HLApool* mPool;
     // parameters used during dynamic resizing
     const void* mShakeThat;
     int mShakeValue;
 
-    __HLAbuffer(size_t capacity) : mUserAllocated(false), mShakeThat(NULL)
+    __HLAbuffer(size_t capacity, HLApool* pool = NULL)
+        : mRegistry(NULL), mUserAllocated(false), mPool(NULL), mShakeThat(NULL)
     {
         __assert_endianess();
         // exponential growth: capacity *= 1.5
         mCapacity = (size_t)(capacity * 1.5);
-        mBegin = (char*) calloc(1, mCapacity);
-        // store "this" to a global table
-        gBuffers[mBegin + mCapacity - 1] = this;
+        if (pool != NULL) {
+            mBegin = (char*) pool->allocate(mCapacity);
+            if (mBegin != NULL)
+                mPool = pool;
+        }
+        if (mPool == NULL)
+            mBegin = (char*) calloc(1, mCapacity);
+        __register(this);
     }
 
     __HLAbuffer(void* begin, size_t capacity)
-        : mBegin((char*) begin), mCapacity(capacity), mUserAllocated(true), mShakeThat(NULL)
+        : mRegistry(NULL), mBegin((char*) begin), mCapacity(capacity), mUserAllocated(true), mPool(NULL),
+          mShakeThat(NULL)
     {
         __assert_endianess();
-        // store "this" to a global table
-        gBuffers[mBegin + mCapacity - 1] = this;
+        __register(this);
     }
 
     virtual ~__HLAbuffer()
     {
-        if (!mUserAllocated)
+        __unregister(this);
+        if (mPool != NULL)
+            mPool->release(mBegin);
+        else if (!mUserAllocated)
             free(mBegin);
-        // remove "this" from the global table
-        gBuffers.erase(__buffer_iterator(mBegin));
     }
 
     void __exchange_buffers(__HLAbuffer& newBuffer)
     {
-        char* oldBegin = mBegin;
-        size_t oldCapacity = mCapacity;
+        __unregister(this);
+        __unregister(&newBuffer);
 
-        mBegin = newBuffer.mBegin;
-        mCapacity = newBuffer.mCapacity;
-        gBuffers[mBegin + mCapacity - 1] = this; // update
+        std::swap(mBegin, newBuffer.mBegin);
+        std::swap(mCapacity, newBuffer.mCapacity);
+        std::swap(mPool, newBuffer.mPool);
 
-        newBuffer.mBegin = oldBegin;
-        newBuffer.mCapacity = oldCapacity;
-        gBuffers[oldBegin + oldCapacity - 1] = &newBuffer; // update
+        __register(this);
+        __register(&newBuffer);
     }
 
-    static BufferList::iterator __buffer_iterator(const void* __this)
+    static __HLAbuffer& __buffer(const void* __this)
     {
-        // find the first pointer not less than "this", the last pointer
-        BufferList::iterator result = gBuffers.lower_bound((char*) __this);
-        if (result == gBuffers.end())
+        __HLAbuffer* result = __find_buffer(__this);
+        if (result == NULL)
             throw std::runtime_error("HLAdata: bad pointer");
-        return result;
+        return *result;
     }
 
-    static __HLAbuffer& __buffer(const void* __this)
-    {
-        return *(__buffer_iterator(__this)->second);
-    }
+    //! Returns the buffer containing "this", or NULL if not in any buffer
+    static __HLAbuffer* __find_buffer(const void* __this);
 
 #ifndef NDEBUG
     static void __check_memory(const void* __this, size_t size)
@@ -59,6 +59,16 @@ public:
     {
     }
 
+    //! Create new buffer, allocated from <pool>
+    HLAdata(HLApool& pool, size_t capacity = T::emptysizeof()) : __HLAbuffer(capacity, &pool)
+    {
+    }
+
+    //! Create new buffer, allocated from <pool> if not NULL
+    HLAdata(size_t capacity, HLApool* pool) : __HLAbuffer(capacity, pool)
+    {
+    }
+
     //! Create buffer from existing data
     HLAdata(void* begin, size_t capacity) : __HLAbuffer(begin, capacity)
     {
@@ -89,7 +99,7 @@ public:
      */
     virtual void __shake(const void* __that, int value, long resize)
     {
-        HLAdata<T> newData(size() + resize);
+        HLAdata<T> newData(size() + resize, mPool);
 
         // copy the data to the temporary buffer, while changing a <value> of <__that>
         newData.mShakeThat = __that;
@@ -18,6 +18,7 @@
 #define _HLATYPES_VARIABLEARRAY_HH
 
 #include <algorithm>
+#include <vector>
 
 #include "HLAbasicType.hh"
 #include "HLAbuffer.hh"
@@ -36,6 +37,10 @@ namespace libhla {
  * The size() member must be set before accessing the data. No data are moved
  * when the size() is changed.
  *
+ * For arrays of variable-size elements, operator[] walks all the preceding
+ * elements. Loop over the elements with an iterator, or take an index() of the
+ * offsets of all elements for random access.
+ *
  * For example:
 \verbatim
  +-------------+----------------+-------------+-----------------+-----------+
@@ -57,6 +62,91 @@ namespace libhla {
 template <class M, bool hasVariable = M::m_isVariable>
 struct HLAvariableArray;
 
+//! Forward iterator over the elements of a variable array
+/* Each step adds the size of the current element, so that iterating through
+ * an array of variable-size elements is linear.
+ */
+template <class M>
+class __HLAvariableArrayIterator {
+public:
+    __HLAvariableArrayIterator(const void* array, long index, size_t offset)
+        : mArray((const char*) array), mIndex(index), mOffset(offset)
+    {
+    }
+
+    M& operator*() const
+    {
+        return *(M*) (mArray + mOffset);
+    }
+
+    M* operator->() const
+    {
+        return (M*) (mArray + mOffset);
+    }
+
+    __HLAvariableArrayIterator& operator++()
+    {
+        mOffset += (**this).__sizeof();
+        mOffset += __padding(mOffset, M::m_octetBoundary);
+        ++mIndex;
+        return *this;
+    }
+
+    bool operator==(const __HLAvariableArrayIterator& other) const
+    {
+        return mIndex == other.mIndex;
+    }
+
+    bool operator!=(const __HLAvariableArrayIterator& other) const
+    {
+        return mIndex != other.mIndex;
+    }
+
+    //! Offset of the current element from the beginning of the array
+    size_t offset() const
+    {
+        return mOffset;
+    }
+
+private:
+    const char* mArray;
+    long mIndex;
+    size_t mOffset;
+};
+
+//! Offsets of all elements of a variable array, for random access
+/* The offsets are computed once, when the index is created, and kept by the
+ * index only. Like an iterator, the index must not be used once an element
+ * before the last one was resized, or new data were stored in the array.
+ */
+template <class M>
+class __HLAvariableArrayIndex {
+public:
+    template <class A>
+    explicit __HLAvariableArrayIndex(const A& array) : mArray((const char*) &array)
+    {
+        mOffsets.reserve(array.size());
+        for (typename A::iterator it = array.begin(); it != array.end(); ++it)
+            mOffsets.push_back(it.offset());
+    }
+
+    M& operator[](long i) const
+    {
+        if (i < 0 || i >= size())
+            throw std::out_of_range("HLAvariableArray: index out of range");
+        return *(M*) (mArray + mOffsets[i]);
+    }
+
+    long size() const
+    {
+        return (long) mOffsets.size();
+    }
+
+private:
+    const char* mArray;
+    std::vector<size_t> mOffsets;
+};
+
 template <class M, bool hasVariable>
 std::ostream& PrintBuffer(std::ostream& stream, HLAvariableArray<M, hasVariable>& buffer)
 {
@@ -98,6 +188,26 @@ struct HLAvariableArray<M, false> {
         return *(M*) ((char*) this + offset(i));
     }
 
+    typedef __HLAvariableArrayIterator<M> iterator;
+    typedef __HLAvariableArrayIndex<M> offset_index;
+
+    iterator begin() const
+    {
+        return iterator(this, 0, emptysizeof());
+    }
+
+    // the end is not dereferenced, its offset is not computed
+    iterator end() const
+    {
+        return iterator(this, size(), 0);
+    }
+
+    //! Offsets of all elements, for code generic over arrays: operator[] is already constant time here
+    offset_index index() const
+    {
+        return offset_index(*this);
+    }
+
     static size_t emptysizeof()
     {
         return HLAinteger32BE::__sizeof() + __padding(HLAinteger32BE::__sizeof(), M::m_octetBoundary);
@@ -181,6 +291,26 @@ struct HLAvariableArray<M, true> {
         return *(M*) ((char*) this + offset(i));
     }
 
+    typedef __HLAvariableArrayIterator<M> iterator;
+    typedef __HLAvariableArrayIndex<M> offset_index;
+
+    iterator begin() const
+    {
+        return iterator(this, 0, emptysizeof());
+    }
+
+    // the end is not dereferenced, its offset is not computed
+    iterator end() const
+    {
+        return iterator(this, size(), 0);
+    }
+
+    //! Offsets of all elements, computed in a single pass
+    offset_index index() const
+    {
+        return offset_index(*this);
+    }
+
     static size_t emptysizeof()
     {
         return HLAinteger32BE::__sizeof() + __padding(HLAinteger32BE::__sizeof(), M::m_octetBoundary);
@@ -156,6 +156,14 @@ void MessageBuffer::reset()
     updateReservedBytes();
 } /* MessageBuffer::reset() */
 
+void MessageBuffer::seek_write(uint32_t offset)
+{
+    if (offset < reservedBytes || offset > bufferMaxSize) {
+        throw MessageBufferError("seek_write::offset out of buffer");
+    }
+    writeOffset = offset;
+}
+
 uint32_t MessageBuffer::resize(uint32_t newSize)
 {
     reallocate(newSize);
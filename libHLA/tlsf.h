@@ -21,6 +21,10 @@
 
 #include <stddef.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 extern size_t init_memory_pool(size_t mem_pool_size, void* mem_pool);
 extern size_t get_used_size(void* mem_pool);
 extern size_t get_max_size(void* mem_pool);
@@ -36,4 +40,8 @@ extern void tlsf_free(void* ptr);
 extern void* tlsf_realloc(void* ptr, size_t size);
 extern void* tlsf_calloc(size_t nelem, size_t elem_size);
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
@@ -27,6 +27,7 @@
 #include "RTItypesImp.hh"
 #include "PrettyDebug.hh"
 #include "M_Classes.hh"
+#include "LatencyTrace.hh"
 #include <sstream>
 #include <iostream>
 #include <memory>
@@ -36,38 +37,29 @@ static PrettyDebug D("LIBRTI", __FILE__);
 static PrettyDebug G("GENDOC", __FILE__);
 
 template <typename T>
-std::vector<std::pair<AttributeHandle, AttributeValue_t>> getAHVPSFromRequest(T* request)
+void setAHVPSFromRequest(AttributeHandleValuePairSetImp& result, T* request)
 {
     uint32_t size = request->getAttributesSize();
-    std::vector<std::pair<AttributeHandle, AttributeValue_t>> result;
     result.resize(size);
 
     for (uint32_t i = 0; i < size; ++i) {
-        result[i].first = request->getAttributes(i);
-        result[i].second.assign(request->getValues(i).begin(), request->getValues(i).end());
+        result.set(i, request->getAttributes(i), request->getValues(i).data(), request->getValues(i).size());
     }
-
-    return result;
 }
 
 template <typename T>
-std::vector<std::pair<RTI::ParameterHandle, ParameterValue_t>> getPHVPSFromRequest(T* request)
+void setPHVPSFromRequest(ParameterHandleValuePairSetImp& result, T* request)
 {
     uint32_t size = request->getParametersSize();
-
-    std::vector<std::pair<RTI::ParameterHandle, ParameterValue_t>> result;
     result.resize(size);
 
     for (uint32_t i = 0; i < size; ++i) {
-        result[i].first = request->getParameters(i);
-        result[i].second.assign(request->getValues(i).begin(), request->getValues(i).end());
+        result.set(i, request->getParameters(i), request->getValues(i).data(), request->getValues(i).size());
     }
-
-    return result;
 }
 }
 
-RTIambPrivateRefs::RTIambPrivateRefs()
+RTIambPrivateRefs::RTIambPrivateRefs() : reflectedAttributes(0), receivedParameters(0)
 {
     fed_amb = NULL;
 #ifdef _WIN32
@@ -76,6 +68,7 @@ RTIambPrivateRefs::RTIambPrivateRefs()
     pid_RTIA = (pid_t) -1;
 #endif
     is_reentrant = false;
+    federate = 0;
     _theRootObj = NULL;
     socketUn = NULL;
 }
@@ -738,22 +731,24 @@ void RTIambPrivateRefs::callFederateAmbassador(Message* msg) throw(RTI::RTIinter
         try {
             M_Reflect_Attribute_Values* RAV = static_cast<M_Reflect_Attribute_Values*>(msg);
             Debug(G, pdGendoc) << "          tick_kernel call to reflectAttributeValues" << std::endl;
-            RTI::AttributeHandleValuePairSet* attributes = new AttributeHandleValuePairSetImp(getAHVPSFromRequest(RAV));
+            if (RAV->hasTraceId()) {
+                LatencyTrace::instance().stamp(RAV->getTraceId(), TraceSpan::Hop::LIBRTI_DELIVER, federate);
+            }
+            setAHVPSFromRequest(reflectedAttributes, RAV);
 
             if (msg->isDated()) {
                 RTI::EventRetractionHandle event;
                 event.theSerialNumber = RAV->getEventRetraction().getSN();
                 event.sendingFederate = RAV->getEventRetraction().getSendingFederate();
                 fed_amb->reflectAttributeValues(RAV->getObject(),
-                                                *attributes,
+                                                reflectedAttributes,
                                                 RTIfedTime(msg->getDate().getTime()),
                                                 (msg->getTag()).c_str(),
                                                 event);
             }
             else {
-                fed_amb->reflectAttributeValues(RAV->getObject(), *attributes, (msg->getTag()).c_str());
+                fed_amb->reflectAttributeValues(RAV->getObject(), reflectedAttributes, (msg->getTag()).c_str());
             }
-            delete attributes;
         }
         CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS("reflectAttributeValues")
         break;
@@ -761,22 +756,21 @@ void RTIambPrivateRefs::callFederateAmbassador(Message* msg) throw(RTI::RTIinter
     case Message::RECEIVE_INTERACTION:
         try {
             M_Receive_Interaction* RI = static_cast<M_Receive_Interaction*>(msg);
-            RTI::ParameterHandleValuePairSet* parameters = new ParameterHandleValuePairSetImp(getPHVPSFromRequest(RI));
+            setPHVPSFromRequest(receivedParameters, RI);
 
             if (msg->isDated()) {
                 RTI::EventRetractionHandle event;
                 event.theSerialNumber = RI->getEventRetraction().getSN();
                 event.sendingFederate = RI->getEventRetraction().getSendingFederate();
                 fed_amb->receiveInteraction(RI->getInteractionClass(),
-                                            *parameters,
+                                            receivedParameters,
                                             RTIfedTime(msg->getDate().getTime()),
                                             (msg->getTag()).c_str(),
                                             event);
             }
             else {
-                fed_amb->receiveInteraction(RI->getInteractionClass(), *parameters, (msg->getTag()).c_str());
+                fed_amb->receiveInteraction(RI->getInteractionClass(), receivedParameters, (msg->getTag()).c_str());
             }
-            delete parameters;
         }
         CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS("receiveInteraction")
         break;
@@ -808,8 +802,16 @@ void RTIambPrivateRefs::callFederateAmbassador(Message* msg) throw(RTI::RTIinter
         CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS("provideAttributeValueUpdate")
         break;
 
-    case Message::REQUEST_RETRACTION: {
-    } break;
+    case Message::REQUEST_RETRACTION:
+        try {
+            M_Request_Retraction* RR = static_cast<M_Request_Retraction*>(msg);
+            RTI::EventRetractionHandle event;
+            event.theSerialNumber = RR->getEventRetraction().getSN();
+            event.sendingFederate = RR->getEventRetraction().getSendingFederate();
+            fed_amb->requestRetraction(event);
+        }
+        CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS("requestRetraction")
+        break;
 
     case Message::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION:
         try {
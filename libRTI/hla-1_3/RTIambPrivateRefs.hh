@@ -27,6 +27,7 @@
 #include "Message.hh"
 #include "RootObject.hh"
 #include "MessageBuffer.hh"
+#include "RTItypesImp.hh"
 
 using namespace certi ;
 
@@ -54,10 +55,18 @@ public:
     //! used to prevent reentrant calls (see tick() and executeService()).
     bool is_reentrant ;
 
+    //! federate handle given at join, for the spans of traced reflections.
+    FederateHandle federate ;
+
     RootObject *_theRootObj ;
 
     SocketUN *socketUn ;
     MessageBuffer msgBufSend,msgBufReceive ;
+
+    //! values handed to reflectAttributeValues and receiveInteraction, refilled
+    //! by each callback in the storage of the previous one.
+    AttributeHandleValuePairSetImp reflectedAttributes ;
+    ParameterHandleValuePairSetImp receivedParameters ;
 };
 
 // $Id: RTIambPrivateRefs.hh,v 1.1 2014/03/03 15:18:23 erk Exp $
@@ -27,6 +27,7 @@
 #include "RTIambPrivateRefs.hh"
 #include "RTItypesImp.hh"
 
+#include "LatencyTrace.hh"
 #include "M_Classes.hh"
 #include "Message.hh"
 #include "PrettyDebug.hh"
@@ -119,6 +120,29 @@ void assignAHVToRequest(const std::vector<RTI::AttributeHandle>& AHV, T& request
     }
 } /* end of assignAHVToRequest */
 
+void assignBatch(RTI::ULong count,
+                 const RTI::ObjectHandle objects[],
+                 const RTI::AttributeHandleValuePairSet* const attributes[],
+                 M_Batch_Update_Attribute_Values& req)
+{
+    req.setObjectsSize(count);
+    req.setAttributeCountsSize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const std::vector<AttributeHandleValuePair_t>& AHVPS
+            = certi_cast<AttributeHandleValuePairSetImp>()(*attributes[i]).getAttributeHandleValuePairs();
+        req.setObjects(objects[i], i);
+        req.setAttributeCounts(AHVPS.size(), i);
+
+        const uint32_t offset = req.getAttributesSize();
+        req.setAttributesSize(offset + AHVPS.size());
+        req.setValuesSize(offset + AHVPS.size());
+        for (uint32_t j = 0; j < AHVPS.size(); ++j) {
+            req.setAttributes(AHVPS[j].first, offset + j);
+            req.setValues(AHVPS[j].second, offset + j);
+        }
+    }
+} /* end of assignBatch */
+
 template <typename T>
 void assignAHVPSToRequest(const std::vector<std::pair<RTI::AttributeHandle, AttributeValue_t>>& AHVPSv, T& request)
 {
@@ -586,6 +610,7 @@ RTI::RTIambassador::joinFederationExecution(const char* yourName,
 
     privateRefs->executeService(&req, &rep);
     Debug(G, pdGendoc) << "exit  RTIambassador::joinFederationExecution" << std::endl;
+    privateRefs->federate = rep.getFederate();
 
     PrettyDebug::setFederateName("LibRTI::" + std::string(yourName));
     return rep.getFederate();
@@ -603,6 +628,8 @@ void RTI::RTIambassador::resignFederationExecution(ResignAction theAction)
 
     Debug(G, pdGendoc) << "        ====>executeService RESIGN_FEDERATION_EXECUTION" << std::endl;
     privateRefs->executeService(&req, &rep);
+    // federates may leave without running the destructors of the process
+    LatencyTrace::instance().flush();
 
     Debug(G, pdGendoc) << "exit RTIambassador::resignFederationExecution" << std::endl;
 }
@@ -939,6 +966,11 @@ RTI::RTIambassador::updateAttributeValues(ObjectHandle theObject,
         req.setValues(AHVPS[i].second, i);
     }
 
+    if (auto trace = LatencyTrace::instance().sample()) {
+        req.setTraceId(trace);
+        LatencyTrace::instance().stamp(trace, TraceSpan::Hop::LIBRTI_SEND, privateRefs->federate);
+    }
+
     privateRefs->executeService(&req, &rep);
     Debug(G, pdGendoc) << "return  RTIambassador::updateAttributeValues with time" << std::endl;
     eventRetraction.sendingFederate = rep.getEventRetraction().getSendingFederate();
@@ -970,10 +1002,54 @@ void RTI::RTIambassador::updateAttributeValues(ObjectHandle the_object,
         req.setAttributes(AHVPS[i].first, i);
         req.setValues(AHVPS[i].second, i);
     }
+
+    if (auto trace = LatencyTrace::instance().sample()) {
+        req.setTraceId(trace);
+        LatencyTrace::instance().stamp(trace, TraceSpan::Hop::LIBRTI_SEND, privateRefs->federate);
+    }
+
     privateRefs->executeService(&req, &rep);
     Debug(G, pdGendoc) << "exit  RTIambassador::updateAttributeValues without time" << std::endl;
 }
 
+// ----------------------------------------------------------------------------
+void RTI::RTIambassador::batchUpdateAttributeValues(ULong count,
+                                                    const ObjectHandle objects[],
+                                                    const AttributeHandleValuePairSet* const attributes[],
+                                                    const RTI::FedTime& theTime,
+                                                    const char* theTag)
+{
+    Debug(G, pdGendoc) << "enter RTIambassador::batchUpdateAttributeValues with time" << std::endl;
+    M_Batch_Update_Attribute_Values req, rep;
+
+    req.setDate(certi_cast<RTIfedTime>()(theTime).getTime());
+    if (theTag != NULL) {
+        req.setTag(theTag);
+    }
+    assignBatch(count, objects, attributes, req);
+
+    privateRefs->executeService(&req, &rep);
+    Debug(G, pdGendoc) << "exit  RTIambassador::batchUpdateAttributeValues with time" << std::endl;
+}
+
+// ----------------------------------------------------------------------------
+void RTI::RTIambassador::batchUpdateAttributeValues(ULong count,
+                                                    const ObjectHandle objects[],
+                                                    const AttributeHandleValuePairSet* const attributes[],
+                                                    const char* theTag)
+{
+    Debug(G, pdGendoc) << "enter RTIambassador::batchUpdateAttributeValues without time" << std::endl;
+    M_Batch_Update_Attribute_Values req, rep;
+
+    if (theTag != NULL) {
+        req.setTag(theTag);
+    }
+    assignBatch(count, objects, attributes, req);
+
+    privateRefs->executeService(&req, &rep);
+    Debug(G, pdGendoc) << "exit  RTIambassador::batchUpdateAttributeValues without time" << std::endl;
+}
+
 // ----------------------------------------------------------------------------
 RTI::EventRetractionHandle
 RTI::RTIambassador::sendInteraction(InteractionClassHandle theInteraction,
@@ -1467,7 +1543,6 @@ void RTI::RTIambassador::queryLookahead(RTI::FedTime& theTime)
 // Retract
 void RTI::RTIambassador::retract(RTI::EventRetractionHandle handle) 
 {
-    throw RTI::RTIinternalError("Unimplemented Service retract");
     M_Retract req, rep;
     EventRetraction event;
 
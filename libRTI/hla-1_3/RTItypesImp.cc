@@ -162,6 +162,17 @@ RTI::ULong AttributeHandleValuePairSetImp::next(RTI::ULong /*i*/) const
     return 0;
 }
 
+void AttributeHandleValuePairSetImp::resize(RTI::ULong size)
+{
+    _set.resize(size);
+}
+
+void AttributeHandleValuePairSetImp::set(RTI::ULong i, RTI::Handle h, const char* value, RTI::ULong length)
+{
+    _set[i].first = h;
+    _set[i].second.assign(value, value + length);
+}
+
 const std::vector<AttributeHandleValuePair_t>& AttributeHandleValuePairSetImp::getAttributeHandleValuePairs() const
 {
     return _set;
@@ -410,6 +421,17 @@ RTI::ULong ParameterHandleValuePairSetImp::next(RTI::ULong /*i*/) const
     return 0;
 }
 
+void ParameterHandleValuePairSetImp::resize(RTI::ULong size)
+{
+    _set.resize(size);
+}
+
+void ParameterHandleValuePairSetImp::set(RTI::ULong i, RTI::Handle h, const char* value, RTI::ULong length)
+{
+    _set[i].first = h;
+    _set[i].second.assign(value, value + length);
+}
+
 const std::vector<ParameterHandleValuePair_t>& ParameterHandleValuePairSetImp::getParameterHandleValuePairs() const
 {
     return _set;
@@ -107,6 +107,12 @@ public:
     virtual RTI::ULong valid(RTI::ULong i) const;
     virtual RTI::ULong next(RTI::ULong i) const;
 
+    //! Resize to size pairs, keeping the storage of the values of the first ones.
+    void resize(RTI::ULong size);
+
+    //! Set the i-th pair, in the storage of its previous value.
+    void set(RTI::ULong i, RTI::Handle h, const char *value, RTI::ULong length);
+
     const std::vector<AttributeHandleValuePair_t>& getAttributeHandleValuePairs() const;
 
 protected:
@@ -218,6 +224,12 @@ public:
     virtual RTI::ULong valid(RTI::ULong i) const;
     virtual RTI::ULong next(RTI::ULong i) const;
 
+    //! Resize to size pairs, keeping the storage of the values of the first ones.
+    void resize(RTI::ULong size);
+
+    //! Set the i-th pair, in the storage of its previous value.
+    void set(RTI::ULong i, RTI::Handle h, const char *value, RTI::ULong length);
+
     const std::vector<ParameterHandleValuePair_t>& getParameterHandleValuePairs() const;
 
 protected:
@@ -33,6 +33,7 @@
 #include <RTI/certiLogicalTimeFactory.h>
 #include <RTI/certiLogicalTimeInterval.h>
 
+#include "LatencyTrace.hh"
 #include "M_Classes.hh"
 #include "PrettyDebug.hh"
 #include <iostream>
@@ -143,6 +144,7 @@ RTI1516ambPrivateRefs::RTI1516ambPrivateRefs()
     pid_RTIA = (pid_t) -1;
 #endif
     is_reentrant = false;
+    federate = 0;
     _theRootObj = NULL;
     socketUn = NULL;
 }
@@ -864,6 +866,9 @@ void RTI1516ambPrivateRefs::callFederateAmbassador(Message* msg) throw(rti1516::
         try {
             M_Reflect_Attribute_Values* RAV = static_cast<M_Reflect_Attribute_Values*>(msg);
             Debug(G, pdGendoc) << "          tick_kernel call to reflectAttributeValues" << std::endl;
+            if (RAV->hasTraceId()) {
+                LatencyTrace::instance().stamp(RAV->getTraceId(), TraceSpan::Hop::LIBRTI_DELIVER, federate);
+            }
 
             rti1516::ObjectInstanceHandle instance
                 = rti1516::ObjectInstanceHandleFriend::createRTI1516Handle(RAV->getObject());
@@ -983,8 +988,15 @@ void RTI1516ambPrivateRefs::callFederateAmbassador(Message* msg) throw(rti1516::
         CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS(L"provideAttributeValueUpdate")
         break;
 
-    case Message::REQUEST_RETRACTION: {
-    } break;
+    case Message::REQUEST_RETRACTION:
+        try {
+            M_Request_Retraction* RR = static_cast<M_Request_Retraction*>(msg);
+            rti1516::MessageRetractionHandle event = rti1516::MessageRetractionHandleFriend::createRTI1516Handle(
+                RR->getEventRetraction().getSendingFederate(), RR->getEventRetraction().getSN());
+            fed_amb->requestRetraction(event);
+        }
+        CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS(L"requestRetraction")
+        break;
 
     case Message::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION:
         try {
@@ -53,6 +53,9 @@ public:
     //! used to prevent reentrant calls (see tick() and executeService()).
     bool is_reentrant ;
 
+    //! federate handle given at join, for the spans of traced reflections.
+    FederateHandle federate ;
+
     RootObject *_theRootObj ;
 
     SocketUN *socketUn ;
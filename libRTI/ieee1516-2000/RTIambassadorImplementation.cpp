@@ -31,6 +31,7 @@
 
 #include "PrettyDebug.hh"
 
+#include "LatencyTrace.hh"
 #include "M_Classes.hh"
 #include "RTI1516fedTime.h"
 #include "RTIHandleFactory.h"
@@ -302,6 +303,7 @@ rti1516::FederateHandle RTI1516ambassador::joinFederationExecution(
     PrettyDebug::setFederateName("LibRTI::" + std::string(federateTypeAsString));
 
     certi::FederateHandle certiFederateHandle = rep.getFederate();
+    privateRefs->federate = certiFederateHandle;
     rti1516::FederateHandle rti1516FederateHandle
         = rti1516::FederateHandleFriend::createRTI1516Handle(certiFederateHandle);
 
@@ -322,6 +324,8 @@ void RTI1516ambassador::resignFederationExecution(rti1516::ResignAction /*resign
     req.setResignAction(certi::DELETE_OBJECTS_AND_RELEASE_ATTRIBUTES);
     Debug(G, pdGendoc) << "        ====>executeService RESIGN_FEDERATION_EXECUTION" << std::endl;
     privateRefs->executeService(&req, &rep);
+    // federates may leave without running the destructors of the process
+    certi::LatencyTrace::instance().flush();
     Debug(G, pdGendoc) << "exit RTI1516ambassador::resignFederationExecution" << std::endl;
 }
 
@@ -817,6 +821,11 @@ void RTI1516ambassador::updateAttributeValues(
 
     req.setTag(varLengthDataAsString(theUserSuppliedTag));
 
+    if (auto trace = certi::LatencyTrace::instance().sample()) {
+        req.setTraceId(trace);
+        certi::LatencyTrace::instance().stamp(trace, certi::TraceSpan::Hop::LIBRTI_SEND, privateRefs->federate);
+    }
+
     assignAHVMAndExecuteService(theAttributeValues, req, rep);
 
     Debug(G, pdGendoc) << "exit  RTI1516ambassador::updateAttributeValues without time" << std::endl;
@@ -849,6 +858,11 @@ RTI1516ambassador::updateAttributeValues(rti1516::ObjectInstanceHandle theObject
 
     req.setTag(varLengthDataAsString(theUserSuppliedTag));
 
+    if (auto trace = certi::LatencyTrace::instance().sample()) {
+        req.setTraceId(trace);
+        certi::LatencyTrace::instance().stamp(trace, certi::TraceSpan::Hop::LIBRTI_SEND, privateRefs->federate);
+    }
+
     assignAHVMAndExecuteService(theAttributeValues, req, rep);
 
     Debug(G, pdGendoc) << "return  RTI1516ambassador::updateAttributeValues with time" << std::endl;
@@ -1625,7 +1639,6 @@ void RTI1516ambassador::retract(rti1516::MessageRetractionHandle theHandle) thro
     rti1516::RestoreInProgress,
     rti1516::RTIinternalError)
 {
-    throw rti1516::RTIinternalError(L"Unimplemented Service retract");
     M_Retract req, rep;
 
     certi::EventRetraction event = rti1516::MessageRetractionHandleFriend::createEventRetraction(theHandle);
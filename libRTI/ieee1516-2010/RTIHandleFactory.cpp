@@ -50,6 +50,16 @@
 			certiHandle = 0;																		\
 		}																							\
 		return certiHandle;																			\
+    }																								\
+																									\
+	void HandleKind##Friend::assign(HandleKind & rti1516Handle, const certi::Handle & certiHandle)   \
+    {																								\
+		if (rti1516Handle.getImplementation() == 0)												\
+		{																							\
+			rti1516Handle = createRTI1516Handle(certiHandle);										\
+		} else {																					\
+			rti1516Handle.getImplementation()->setValue(certiHandle);								\
+		}																							\
     }																								\
 																									\
 	HandleKind##Friend::HandleKind##Friend() {}														\
@@ -90,6 +100,15 @@ certi::EventRetraction MessageRetractionHandleFriend::createEventRetraction(cons
 	eventRetraction.setSN( handleImpl->getSerialNum() );
 	return eventRetraction;	
 }
+void MessageRetractionHandleFriend::assign(rti1516e::MessageRetractionHandle & messageRetractionHandle, const certi::Handle & certiHandle, uint64_t serialNr) {
+	MessageRetractionHandleImplementation* handleImpl = messageRetractionHandle.getImplementation();
+	if (handleImpl == 0) {
+		messageRetractionHandle = createRTI1516Handle(certiHandle, serialNr);
+		return;
+	}
+	handleImpl->setValue(certiHandle);
+	handleImpl->setSerialNum(serialNr);
+}
 MessageRetractionHandleFriend::MessageRetractionHandleFriend() {}                                       
 MessageRetractionHandleFriend::~MessageRetractionHandleFriend() {}                                      
 
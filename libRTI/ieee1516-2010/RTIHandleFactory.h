@@ -77,6 +77,8 @@ public:                                                         \
    static HandleKind createRTI1516Handle(const certi::Handle & certiHandle);                   \
    static HandleKind createRTI1516Handle(const rti1516e::VariableLengthData & encodedValue);    \
    static certi::Handle toCertiHandle(const HandleKind & rti1516Handle);				       \
+   /* Set rti1516Handle to certiHandle, reusing its implementation */ \
+   static void assign(HandleKind & rti1516Handle, const certi::Handle & certiHandle);           \
 																\
 private:                                                        \
    HandleKind##Friend();                                        \
@@ -104,6 +106,7 @@ namespace rti1516e
 	   static MessageRetractionHandle createRTI1516Handle(const certi::Handle & certiHandle, uint64_t serialNr);   
 	   static MessageRetractionHandle createRTI1516Handle(const rti1516e::VariableLengthData & encodedValue);
 	   static certi::EventRetraction createEventRetraction(const rti1516e::MessageRetractionHandle & messageRetractionHandle);
+	   static void assign(rti1516e::MessageRetractionHandle & messageRetractionHandle, const certi::Handle & certiHandle, uint64_t serialNr);
 	private:                                                        															
 	   MessageRetractionHandleFriend();                                        
 	   ~MessageRetractionHandleFriend();                                       
@@ -34,10 +34,15 @@
 #include <RTI/certiLogicalTimeFactory.h>
 #include <RTI/certiLogicalTimeInterval.h>
 
+#include "LatencyTrace.hh"
 #include "M_Classes.hh"
 #include "PrettyDebug.hh"
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <tuple>
+#include <utility>
 
 namespace certi {
 
@@ -76,36 +81,52 @@ std::vector<std::pair<rti1516e::ParameterHandle, ParameterValue_t>> getPHVPSFrom
     return result;
 }
 
-template <typename T>
-rti1516e::AttributeHandleValueMap* getAHVMFromRequest(T* request)
+/** Set views to the handles and values of request, see RTI1516ambassador::Private::ValueViews.
+ *
+ * handle(i) is the handle of the i-th value of request.
+ */
+template <typename HandleFriend, typename Views, typename T, typename GetHandle>
+void setViewsFromRequest(Views& views, T* request, const uint32_t size, GetHandle handle)
 {
-    uint32_t size = request->getAttributesSize();
-    rti1516e::AttributeHandleValueMap* result = new rti1516e::AttributeHandleValueMap();
-
-    for (uint32_t i = 0; i < size; ++i) {
-        rti1516e::AttributeHandle attribute
-            = rti1516e::AttributeHandleFriend::createRTI1516Handle(request->getAttributes(i));
-        rti1516e::VariableLengthData varData(&(request->getValues(i)[0]), request->getValues(i).size());
-        result->insert(std::pair<rti1516e::AttributeHandle, rti1516e::VariableLengthData>(attribute, varData));
+    const auto callback = ++views.callbacks;
+
+    bool same_handles = true;
+    for (uint32_t i = 0; same_handles && i < size; ++i) {
+        const Handle current = handle(i);
+        auto view = std::lower_bound(
+            begin(views.index), end(views.index), current, [](const typename Views::View& view, const Handle handle) {
+                return view.handle < handle;
+            });
+        same_handles = view != end(views.index) && view->handle == current;
+        if (same_handles && view->callback != callback) {
+            view->value->setDataPointer(request->getValues(i).data(), request->getValues(i).size());
+            view->callback = callback;
+        }
+    }
+    same_handles = same_handles && std::all_of(begin(views.index),
+                                               end(views.index),
+                                               [callback](const typename Views::View& view) {
+                                                   return view.callback == callback;
+                                               });
+    if (same_handles) {
+        return;
     }
 
-    return result;
-}
-
-template <typename T>
-rti1516e::ParameterHandleValueMap* getPHVMFromRequest(T* request)
-{
-    uint32_t size = request->getParametersSize();
-    rti1516e::ParameterHandleValueMap* result = new rti1516e::ParameterHandleValueMap();
-
+    views.values.clear();
+    views.index.clear();
     for (uint32_t i = 0; i < size; ++i) {
-        rti1516e::ParameterHandle parameter
-            = rti1516e::ParameterHandleFriend::createRTI1516Handle(request->getParameters(i));
-        rti1516e::VariableLengthData varData(&(request->getValues(i)[0]), request->getValues(i).size());
-        result->insert(std::pair<rti1516e::ParameterHandle, rti1516e::VariableLengthData>(parameter, varData));
+        // constructed in place, an empty VariableLengthData cannot be copied
+        auto inserted = views.values.emplace(std::piecewise_construct,
+                                             std::forward_as_tuple(HandleFriend::createRTI1516Handle(handle(i))),
+                                             std::forward_as_tuple());
+        if (inserted.second) {
+            inserted.first->second.setDataPointer(request->getValues(i).data(), request->getValues(i).size());
+        }
+    }
+    // the values are ordered by handle
+    for (auto& value : views.values) {
+        views.index.push_back({HandleFriend::toCertiHandle(value.first), &value.second, callback});
     }
-
-    return result;
 }
 
 template <typename T>
@@ -148,6 +169,12 @@ void RTI1516ambassador::Private::executeService(Message* req, Message* rep)
     Debug(G, pdGendoc) << "enter RTI1516ambassador::Private::executeService(" << req->getMessageName() << ", "
                        << rep->getMessageName() << ")" << std::endl;
 
+    if (immediate) {
+        executeImmediateService(req, rep);
+        Debug(G, pdGendoc) << "exit RTI1516ambassador::Private::executeService" << std::endl;
+        return;
+    }
+
     Debug(D, pdDebug) << "sending request to RTIA." << std::endl;
 
     try {
@@ -221,6 +248,198 @@ void RTI1516ambassador::Private::sendTickRequestStop()
     Debug(G, pdGendoc) << "exit RTI1516ambassador::Private::sendTickRequestStop" << std::endl;
 }
 
+void RTI1516ambassador::Private::startCallbackThread()
+{
+    immediate = true;
+    stopping = false;
+    callback_thread = std::thread(&Private::runCallbackThread, this);
+}
+
+void RTI1516ambassador::Private::stopCallbackThread()
+{
+    if (!callback_thread.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(link_mutex);
+        stopping = true;
+        if (tick_pending && !tick_stopped) {
+            M_Tick_Request_Stop stop;
+            try {
+                sendOnLink(stop);
+            }
+            catch (rti1516e::RTIinternalError&) {
+                // the link is broken, so will be the read of the callback thread
+            }
+            tick_stopped = true;
+        }
+        link_changed.notify_all();
+    }
+
+    // returns once the RTIA has answered the outstanding tick
+    callback_thread.join();
+    immediate = false;
+    callbacks.clear();
+}
+
+void RTI1516ambassador::Private::setCallbacksEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(link_mutex);
+    callbacks_enabled = enabled;
+    if (!enabled && tick_pending && !tick_stopped) {
+        // callbacks the RTIA already sent are kept until callbacks are enabled again
+        M_Tick_Request_Stop stop;
+        sendOnLink(stop);
+        tick_stopped = true;
+    }
+    link_changed.notify_all();
+}
+
+bool RTI1516ambassador::Private::isCallbackThread() const
+{
+    return callback_thread.get_id() == std::this_thread::get_id();
+}
+
+void RTI1516ambassador::Private::executeImmediateService(Message* req, Message* rep)
+{
+    PendingReply pending{req->getMessageType(), nullptr};
+
+    std::unique_lock<std::mutex> lock(link_mutex);
+    try {
+        sendOnLink(*req);
+    }
+    catch (rti1516e::RTIinternalError&) {
+        if (req->getMessageType() == certi::Message::CLOSE_CONNEXION) {
+            std::cerr << "libRTI: Could not execute 'Close connexion' service (Network error). Service request ignored."
+                      << std::endl;
+            return;
+        }
+        throw;
+    }
+    pending_replies.push_back(&pending);
+
+    try {
+        while (!pending.message) {
+            if (reading) {
+                link_changed.wait(lock);
+            }
+            else {
+                readLink(lock);
+            }
+        }
+    }
+    catch (...) {
+        pending_replies.erase(std::find(begin(pending_replies), end(pending_replies), &pending));
+        throw;
+    }
+    lock.unlock();
+
+    // the reader did not know the type of the reply, hand it over through a buffer
+    MessageBuffer buffer;
+    pending.message->serialize(buffer);
+    buffer.updateReservedBytes();
+    buffer.assumeSizeFromReservedBytes();
+    rep->deserialize(buffer);
+
+    processException(rep);
+}
+
+void RTI1516ambassador::Private::runCallbackThread()
+{
+    std::unique_lock<std::mutex> lock(link_mutex);
+
+    try {
+        while (!stopping || tick_pending) {
+            if (!stopping && callbacks_enabled && !callbacks.empty()) {
+                std::unique_ptr<Message> callback = std::move(callbacks.front());
+                callbacks.pop_front();
+
+                lock.unlock();
+                try {
+                    callFederateAmbassador(callback.get());
+                }
+                catch (rti1516e::Exception& e) {
+                    // nobody to report it to, the callback is lost but the following ones are delivered
+                    std::wcerr << L"libRTI: " << e.what() << std::endl;
+                }
+                lock.lock();
+
+                // a callback coming after TICK_REQUEST_STOP is not awaited by the RTIA
+                if (tick_pending && !tick_stopped) {
+                    M_Tick_Request_Next next;
+                    sendOnLink(next);
+                }
+            }
+            else if (!stopping && callbacks_enabled && !tick_pending) {
+                M_Tick_Request tick;
+                tick.setMultiple(true);
+                tick.setMinTickTime(std::numeric_limits<double>::infinity());
+                tick.setMaxTickTime(std::numeric_limits<double>::infinity());
+                sendOnLink(tick);
+                tick_pending = true;
+                tick_stopped = false;
+            }
+            else if (tick_pending && !reading) {
+                readLink(lock);
+            }
+            else {
+                link_changed.wait(lock);
+            }
+        }
+    }
+    catch (rti1516e::Exception& e) {
+        // the link is broken, service calls will report it
+        std::wcerr << L"libRTI: callback thread stopped: " << e.what() << std::endl;
+        tick_pending = false;
+    }
+}
+
+void RTI1516ambassador::Private::sendOnLink(Message& msg)
+{
+    try {
+        msg.send(socket_un.get(), msgBufSend);
+    }
+    catch (NetworkError& e) {
+        std::cerr << "libRTI: exception: NetworkError (write)" << std::endl;
+        throw rti1516e::RTIinternalError(L"libRTI: Network Write Error");
+    }
+}
+
+void RTI1516ambassador::Private::readLink(std::unique_lock<std::mutex>& lock)
+{
+    reading = true;
+    lock.unlock();
+
+    std::unique_ptr<Message> msg;
+    try {
+        msg.reset(M_Factory::receive(socket_un.get()));
+    }
+    catch (NetworkError& e) {
+        std::cerr << "libRTI: exception: NetworkError (read)" << std::endl;
+        lock.lock();
+        reading = false;
+        link_changed.notify_all();
+        throw rti1516e::RTIinternalError(L"libRTI: Network Read Error waiting RTI message");
+    }
+
+    lock.lock();
+    reading = false;
+
+    // the RTIA answers service requests in order, callbacks only come one at a time during a tick
+    if (!pending_replies.empty() && pending_replies.front()->type == msg->getMessageType()) {
+        pending_replies.front()->message = std::move(msg);
+        pending_replies.pop_front();
+    }
+    else if (msg->getMessageType() == Message::TICK_REQUEST) {
+        tick_pending = false;
+    }
+    else {
+        callbacks.push_back(std::move(msg));
+    }
+    link_changed.notify_all();
+}
+
 void RTI1516ambassador::Private::processException(Message* msg)
 {
     Debug(D, pdExcept) << "Exception #" << static_cast<int>(msg->getExceptionType()) << std::endl;
@@ -850,40 +1069,46 @@ void RTI1516ambassador::Private::callFederateAmbassador(Message* msg)
         try {
             M_Reflect_Attribute_Values* RAV = static_cast<M_Reflect_Attribute_Values*>(msg);
             Debug(G, pdGendoc) << "          tick_kernel call to reflectAttributeValues" << std::endl;
+            if (RAV->hasTraceId()) {
+                LatencyTrace::instance().stamp(RAV->getTraceId(), TraceSpan::Hop::LIBRTI_DELIVER, federate);
+            }
 
-            rti1516e::ObjectInstanceHandle instance
-                = rti1516e::ObjectInstanceHandleFriend::createRTI1516Handle(RAV->getObject());
+            rti1516e::ObjectInstanceHandleFriend::assign(callback_instance, RAV->getObject());
 
-            rti1516e::AttributeHandleValueMap* attributes = getAHVMFromRequest(RAV);
+            setViewsFromRequest<rti1516e::AttributeHandleFriend>(
+                reflected_values, RAV, RAV->getAttributesSize(), [RAV](const uint32_t i) {
+                    return RAV->getAttributes(i);
+                });
 
-            std::string tagString(msg->getTag());
-            rti1516e::VariableLengthData tagVarData(tagString.c_str(), tagString.length());
+            callback_tag.setDataPointer(const_cast<char*>(msg->getTag().data()), msg->getTag().size());
             /* FIXME 1516-2010: Howto setup SRI properly ?? */
             rti1516e::SupplementalReflectInfo sri;
 
             if (msg->isDated()) {
-                uint64_t sn = RAV->getEventRetraction().getSN();
-                certi::FederateHandle certiHandle = RAV->getEventRetraction().getSendingFederate();
-                rti1516e::MessageRetractionHandle event
-                    = rti1516e::MessageRetractionHandleFriend::createRTI1516Handle(certiHandle, sn);
+                rti1516e::MessageRetractionHandleFriend::assign(callback_retraction,
+                                                                RAV->getEventRetraction().getSendingFederate(),
+                                                                RAV->getEventRetraction().getSN());
 
-                std::unique_ptr<rti1516e::LogicalTime> fedTime(new RTI1516fedTime(msg->getDate().getTime()));
+                RTI1516fedTime fedTime(msg->getDate().getTime());
 
-                fed_amb->reflectAttributeValues(instance, //ObjectInstanceHandle
-                                                *attributes, //AttributeHandleValueMap &
-                                                tagVarData, //VariableLengthData &
+                fed_amb->reflectAttributeValues(callback_instance, //ObjectInstanceHandle
+                                                reflected_values.values, //AttributeHandleValueMap &
+                                                callback_tag, //VariableLengthData &
                                                 rti1516e::TIMESTAMP, //OrderType (send)
                                                 rti1516e::RELIABLE, //TransportationType
-                                                *fedTime, //LogicalTime &
+                                                fedTime, //LogicalTime &
                                                 rti1516e::RECEIVE, //OrderType (receive)
-                                                event, //MessageRetractionHandle
+                                                callback_retraction, //MessageRetractionHandle
                                                 sri);
             }
             else {
-                fed_amb->reflectAttributeValues(
-                    instance, *attributes, tagVarData, rti1516e::RECEIVE, rti1516e::RELIABLE, sri);
+                fed_amb->reflectAttributeValues(callback_instance,
+                                                reflected_values.values,
+                                                callback_tag,
+                                                rti1516e::RECEIVE,
+                                                rti1516e::RELIABLE,
+                                                sri);
             }
-            delete attributes;
         }
         CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS(L"reflectAttributeValues")
         break;
@@ -891,39 +1116,42 @@ void RTI1516ambassador::Private::callFederateAmbassador(Message* msg)
     case Message::RECEIVE_INTERACTION:
         try {
             M_Receive_Interaction* RI = static_cast<M_Receive_Interaction*>(msg);
-            rti1516e::ParameterHandleValueMap* parameters = getPHVMFromRequest(RI);
+            setViewsFromRequest<rti1516e::ParameterHandleFriend>(
+                received_values, RI, RI->getParametersSize(), [RI](const uint32_t i) {
+                    return RI->getParameters(i);
+                });
 
-            rti1516e::InteractionClassHandle interactionHandle
-                = rti1516e::InteractionClassHandleFriend::createRTI1516Handle(RI->getInteractionClass());
+            rti1516e::InteractionClassHandleFriend::assign(callback_interaction, RI->getInteractionClass());
 
-            std::string tagString(msg->getTag());
-            rti1516e::VariableLengthData tagVarData(tagString.c_str(), tagString.length());
+            callback_tag.setDataPointer(const_cast<char*>(msg->getTag().data()), msg->getTag().size());
             /* FIXME 1516-2010: Howto setup SRI properly ?? */
             rti1516e::SupplementalReceiveInfo sri;
 
             if (msg->isDated()) {
-                uint64_t sn = RI->getEventRetraction().getSN();
-                certi::FederateHandle certiHandle = RI->getEventRetraction().getSendingFederate();
-                rti1516e::MessageRetractionHandle event
-                    = rti1516e::MessageRetractionHandleFriend::createRTI1516Handle(certiHandle, sn);
+                rti1516e::MessageRetractionHandleFriend::assign(callback_retraction,
+                                                                RI->getEventRetraction().getSendingFederate(),
+                                                                RI->getEventRetraction().getSN());
 
-                std::unique_ptr<rti1516e::LogicalTime> fedTime(new RTI1516fedTime(msg->getDate().getTime()));
+                RTI1516fedTime fedTime(msg->getDate().getTime());
 
-                fed_amb->receiveInteraction(interactionHandle, // InteractionClassHandle
-                                            *parameters, // ParameterHandleValueMap &
-                                            tagVarData, // VariableLengthData &
+                fed_amb->receiveInteraction(callback_interaction, // InteractionClassHandle
+                                            received_values.values, // ParameterHandleValueMap &
+                                            callback_tag, // VariableLengthData &
                                             rti1516e::TIMESTAMP, //OrderType (send)
                                             rti1516e::RELIABLE, //TransportationType
-                                            *fedTime, //LogicalTime &
+                                            fedTime, //LogicalTime &
                                             rti1516e::RECEIVE, //OrderType (receive)
-                                            event, //MessageRetractionHandle
+                                            callback_retraction, //MessageRetractionHandle
                                             sri);
             }
             else {
-                fed_amb->receiveInteraction(
-                    interactionHandle, *parameters, tagVarData, rti1516e::RECEIVE, rti1516e::RELIABLE, sri);
+                fed_amb->receiveInteraction(callback_interaction,
+                                            received_values.values,
+                                            callback_tag,
+                                            rti1516e::RECEIVE,
+                                            rti1516e::RELIABLE,
+                                            sri);
             }
-            delete parameters;
         }
         CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS(L"receiveInteraction")
         break;
@@ -976,8 +1204,15 @@ void RTI1516ambassador::Private::callFederateAmbassador(Message* msg)
         CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS(L"provideAttributeValueUpdate")
         break;
 
-    case Message::REQUEST_RETRACTION: {
-    } break;
+    case Message::REQUEST_RETRACTION:
+        try {
+            M_Request_Retraction* RR = static_cast<M_Request_Retraction*>(msg);
+            rti1516e::MessageRetractionHandle event = rti1516e::MessageRetractionHandleFriend::createRTI1516Handle(
+                RR->getEventRetraction().getSendingFederate(), RR->getEventRetraction().getSN());
+            fed_amb->requestRetraction(event);
+        }
+        CATCH_FEDERATE_AMBASSADOR_EXCEPTIONS(L"requestRetraction")
+        break;
 
     case Message::REQUEST_ATTRIBUTE_OWNERSHIP_ASSUMPTION:
         try {
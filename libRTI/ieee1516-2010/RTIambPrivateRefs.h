@@ -31,6 +31,13 @@
 #include "RootObject.hh"
 #include <RTI/certiRTI1516.h>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace certi {
 
 struct RTI1516ambassador::Private {
@@ -44,6 +51,32 @@ struct RTI1516ambassador::Private {
     void callFederateAmbassador(Message* msg);
     void leave(const char* msg);
 
+    /** HLA_IMMEDIATE callback model.
+     *
+     * The RTIA only hands callbacks over during a tick, so a library thread keeps
+     * a blocking tick outstanding on the RTIA link and invokes the federate
+     * ambassador as soon as a callback comes. Services called meanwhile share the
+     * link: whoever waits on it reads the next message, hands replies over to the
+     * callers in request order and queues callbacks for the callback thread.
+     */
+    void startCallbackThread();
+    void stopCallbackThread();
+    void setCallbacksEnabled(bool enabled);
+    bool isCallbackThread() const;
+
+    /// A service call waiting for its reply in the HLA_IMMEDIATE model.
+    struct PendingReply {
+        Message::Type type;
+        std::unique_ptr<Message> message;
+    };
+
+    void executeImmediateService(Message* req, Message* rep);
+    void runCallbackThread();
+    /// Send on the RTIA link, link_mutex held.
+    void sendOnLink(Message& msg);
+    /// Read and dispatch one message from the RTIA link, link_mutex held.
+    void readLink(std::unique_lock<std::mutex>& lock);
+
 #ifdef _WIN32
     HANDLE handle_RTIA;
 #else
@@ -57,9 +90,61 @@ struct RTI1516ambassador::Private {
     /// used to prevent reentrant calls (see tick() and executeService()).
     bool is_reentrant{false};
 
+    /// federate handle given at join, for the spans of traced reflections.
+    FederateHandle federate{0};
+
     RootObject* root_object{nullptr};
 
     std::unique_ptr<SocketUN> socket_un{nullptr};
     MessageBuffer msgBufSend, msgBufReceive;
+
+    /// Callbacks are delivered by callback_thread (HLA_IMMEDIATE).
+    bool immediate{false};
+    /// Gated by enableCallbacks/disableCallbacks.
+    bool callbacks_enabled{true};
+
+    std::mutex link_mutex;
+    std::condition_variable link_changed;
+    std::thread callback_thread;
+    bool stopping{false};
+    /// Someone is blocked reading the RTIA link.
+    bool reading{false};
+    /// A TICK_REQUEST was sent and its answer is still to come.
+    bool tick_pending{false};
+    /// The pending tick was asked to stop, the RTIA awaits no TICK_REQUEST_NEXT.
+    bool tick_stopped{false};
+    std::deque<PendingReply*> pending_replies;
+    std::deque<std::unique_ptr<Message>> callbacks;
+
+    /** Values handed to the federate ambassador by reflectAttributeValues or receiveInteraction.
+     *
+     * The values are views of the bytes of the callback message, valid for the
+     * duration of the callback. They are kept from one callback to the next:
+     * a callback with the same handles as the previous one only moves the views
+     * to its own bytes, and allocates nothing.
+     */
+    template <typename HandleValueMap>
+    struct ValueViews {
+        struct View {
+            Handle handle;
+            rti1516e::VariableLengthData* value;
+            /// callback which last set the view
+            uint64_t callback;
+        };
+
+        HandleValueMap values{};
+        /// the values, by handle
+        std::vector<View> index{};
+        uint64_t callbacks{0};
+    };
+
+    ValueViews<rti1516e::AttributeHandleValueMap> reflected_values{};
+    ValueViews<rti1516e::ParameterHandleValueMap> received_values{};
+
+    /// handles and tag of the current callback, reused for the same reason
+    rti1516e::ObjectInstanceHandle callback_instance{};
+    rti1516e::InteractionClassHandle callback_interaction{};
+    rti1516e::MessageRetractionHandle callback_retraction{};
+    rti1516e::VariableLengthData callback_tag{};
 };
 }
@@ -34,11 +34,14 @@
 
 #include "PrettyDebug.hh"
 
+#include "LatencyTrace.hh"
 #include "M_Classes.hh"
 #include "RTI1516fedTime.h"
 #include "RTIHandleFactory.h"
 
 #include <algorithm>
+#include <chrono>
+#include <thread>
 
 namespace {
 
@@ -94,6 +97,32 @@ void RTI1516ambassador::assignAHVMAndExecuteService(const rti1516e::AttributeHan
     p->executeService(&req, &rep);
 }
 
+template <typename T>
+void RTI1516ambassador::assignUpdatesAndExecuteService(const AttributeValueUpdates& updates, T& req, T& rep)
+{
+    req.setObjectsSize(updates.size());
+    req.setAttributeCountsSize(updates.size());
+    uint32_t i = 0;
+    for (AttributeValueUpdates::const_iterator update = updates.begin(); update != updates.end(); ++update, ++i) {
+        req.setObjects(rti1516e::ObjectInstanceHandleFriend::toCertiHandle(update->first), i);
+        req.setAttributeCounts(update->second.size(), i);
+
+        uint32_t rank = req.getAttributesSize();
+        req.setAttributesSize(rank + update->second.size());
+        req.setValuesSize(rank + update->second.size());
+        for (rti1516e::AttributeHandleValueMap::const_iterator it = update->second.begin();
+             it != update->second.end();
+             ++it, ++rank) {
+            req.setAttributes(rti1516e::AttributeHandleFriend::toCertiHandle(it->first), rank);
+            certi::AttributeValue_t attrValue;
+            attrValue.resize(it->second.size());
+            memcpy(&(attrValue[0]), it->second.data(), it->second.size());
+            req.setValues(attrValue, rank);
+        }
+    }
+    p->executeService(&req, &rep);
+}
+
 std::string varLengthDataAsString(rti1516e::VariableLengthData varLengthData)
 {
     std::string retVal((char*) varLengthData.data(), varLengthData.size());
@@ -125,6 +154,8 @@ RTI1516ambassador::RTI1516ambassador() noexcept = default;
 
 RTI1516ambassador::~RTI1516ambassador()
 {
+    p->stopCallbackThread();
+
     certi::M_Close_Connexion req, rep;
 
     Debug(G, pdGendoc) << "        ====>executeService CLOSE_CONNEXION" << std::endl;
@@ -134,6 +165,12 @@ RTI1516ambassador::~RTI1516ambassador()
 bool RTI1516ambassador::__tick_kernel(bool multiple, TickTime minimum, TickTime maximum) throw(
     rti1516e::SpecifiedSaveLabelDoesNotExist, rti1516e::NotConnected, rti1516e::RTIinternalError)
 {
+    if (p->immediate || !p->callbacks_enabled) {
+        // callbacks are delivered by the callback thread, or not at all
+        std::this_thread::sleep_for(std::chrono::duration<double>(minimum));
+        return false;
+    }
+
     M_Tick_Request vers_RTI;
     std::auto_ptr<Message> vers_Fed;
 
@@ -208,7 +245,9 @@ void RTI1516ambassador::connect(
         p->fed_amb = &federateAmbassador;
         break;
     case rti1516e::HLA_IMMEDIATE:
-        throw rti1516e::UnsupportedCallbackModel(L"CONNECT callback model HLA_IMMEDIATE not implemented [yet].");
+        p->fed_amb = &federateAmbassador;
+        p->startCallbackThread();
+        break;
     default:
         throw rti1516e::UnsupportedCallbackModel(L"CONNECT unsupported callback model");
     }
@@ -219,6 +258,10 @@ void RTI1516ambassador::disconnect() throw(rti1516e::FederateIsExecutionMember,
                                            rti1516e::CallNotAllowedFromWithinCallback,
                                            rti1516e::RTIinternalError)
 {
+    if (p->isCallbackThread()) {
+        throw rti1516e::CallNotAllowedFromWithinCallback(L"disconnect");
+    }
+    p->stopCallbackThread();
     p->fed_amb = NULL;
 }
 
@@ -394,6 +437,7 @@ rti1516e::FederateHandle RTI1516ambassador::joinFederationExecution(
 
     Debug(G, pdGendoc) << "        ====>executeService JOIN_FEDERATION_EXECUTION" << std::endl;
     p->executeService(&req, &rep);
+    p->federate = rep.getFederate();
 
     PrettyDebug::setFederateName("LibRTI::" + std::string{begin(federateType), end(federateType)});
 
@@ -418,6 +462,8 @@ void RTI1516ambassador::resignFederationExecution(rti1516e::ResignAction /*resig
     req.setResignAction(certi::DELETE_OBJECTS_AND_RELEASE_ATTRIBUTES);
     Debug(G, pdGendoc) << "        ====>executeService RESIGN_FEDERATION_EXECUTION" << std::endl;
     p->executeService(&req, &rep);
+    // federates may leave without running the destructors of the process
+    certi::LatencyTrace::instance().flush();
     Debug(G, pdGendoc) << "exit RTI1516ambassador::resignFederationExecution" << std::endl;
 }
 
@@ -998,6 +1044,11 @@ void RTI1516ambassador::updateAttributeValues(
 
     req.setTag(varLengthDataAsString(theUserSuppliedTag));
 
+    if (auto trace = certi::LatencyTrace::instance().sample()) {
+        req.setTraceId(trace);
+        certi::LatencyTrace::instance().stamp(trace, certi::TraceSpan::Hop::LIBRTI_SEND, p->federate);
+    }
+
     assignAHVMAndExecuteService(theAttributeValues, req, rep);
 
     Debug(G, pdGendoc) << "exit  RTI1516ambassador::updateAttributeValues without time" << std::endl;
@@ -1031,6 +1082,11 @@ rti1516e::MessageRetractionHandle RTI1516ambassador::updateAttributeValues(
 
     req.setTag(varLengthDataAsString(theUserSuppliedTag));
 
+    if (auto trace = certi::LatencyTrace::instance().sample()) {
+        req.setTraceId(trace);
+        certi::LatencyTrace::instance().stamp(trace, certi::TraceSpan::Hop::LIBRTI_SEND, p->federate);
+    }
+
     assignAHVMAndExecuteService(theAttributeValues, req, rep);
 
     Debug(G, pdGendoc) << "return  RTI1516ambassador::updateAttributeValues with time" << std::endl;
@@ -1039,6 +1095,61 @@ rti1516e::MessageRetractionHandle RTI1516ambassador::updateAttributeValues(
     return rti1516e::MessageRetractionHandleFriend::createRTI1516Handle(certiHandle, serialNum);
 }
 
+void RTI1516ambassador::batchUpdateAttributeValues(AttributeValueUpdates const& theUpdates,
+                                                   rti1516e::VariableLengthData const& theUserSuppliedTag) throw(
+    rti1516e::ObjectInstanceNotKnown,
+    rti1516e::AttributeNotDefined,
+    rti1516e::AttributeNotOwned,
+    rti1516e::FederateNotExecutionMember,
+    rti1516e::SaveInProgress,
+    rti1516e::RestoreInProgress,
+    rti1516e::NotConnected,
+    rti1516e::RTIinternalError)
+{
+    Debug(G, pdGendoc) << "enter RTI1516ambassador::batchUpdateAttributeValues without time" << std::endl;
+    M_Batch_Update_Attribute_Values req, rep;
+
+    if (theUserSuppliedTag.data() == NULL) {
+        throw rti1516e::RTIinternalError(L"Calling batchUpdateAttributeValues with Tag NULL");
+    }
+
+    req.setTag(varLengthDataAsString(theUserSuppliedTag));
+
+    assignUpdatesAndExecuteService(theUpdates, req, rep);
+
+    Debug(G, pdGendoc) << "exit  RTI1516ambassador::batchUpdateAttributeValues without time" << std::endl;
+}
+
+void RTI1516ambassador::batchUpdateAttributeValues(AttributeValueUpdates const& theUpdates,
+                                                   rti1516e::VariableLengthData const& theUserSuppliedTag,
+                                                   rti1516e::LogicalTime const& theTime) throw(
+    rti1516e::ObjectInstanceNotKnown,
+    rti1516e::AttributeNotDefined,
+    rti1516e::AttributeNotOwned,
+    rti1516e::InvalidLogicalTime,
+    rti1516e::FederateNotExecutionMember,
+    rti1516e::SaveInProgress,
+    rti1516e::RestoreInProgress,
+    rti1516e::NotConnected,
+    rti1516e::RTIinternalError)
+{
+    Debug(G, pdGendoc) << "enter RTI1516ambassador::batchUpdateAttributeValues with time" << std::endl;
+    M_Batch_Update_Attribute_Values req, rep;
+
+    certi::FederationTime certiFedTime(certi_cast<RTI1516fedTime>()(theTime).getFedTime());
+    req.setDate(certiFedTime);
+
+    if (theUserSuppliedTag.data() == NULL) {
+        throw rti1516e::RTIinternalError(L"Calling batchUpdateAttributeValues with Tag NULL");
+    }
+
+    req.setTag(varLengthDataAsString(theUserSuppliedTag));
+
+    assignUpdatesAndExecuteService(theUpdates, req, rep);
+
+    Debug(G, pdGendoc) << "exit  RTI1516ambassador::batchUpdateAttributeValues with time" << std::endl;
+}
+
 // 6.12
 void RTI1516ambassador::sendInteraction(
     rti1516e::InteractionClassHandle theInteraction,
@@ -1892,7 +2003,6 @@ void RTI1516ambassador::retract(rti1516e::MessageRetractionHandle theHandle) thr
     rti1516e::NotConnected,
     rti1516e::RTIinternalError)
 {
-    throw rti1516e::RTIinternalError(L"Unimplemented Service retract");
     M_Retract req, rep;
 
     certi::EventRetraction event = rti1516e::MessageRetractionHandleFriend::createEventRetraction(theHandle);
@@ -3015,8 +3125,7 @@ void RTI1516ambassador::enableCallbacks() throw(rti1516e::SaveInProgress,
                                                 rti1516e::RestoreInProgress,
                                                 rti1516e::RTIinternalError)
 {
-    /* TODO */
-    throw rti1516e::RTIinternalError(L"enableCallbacks Not implemented");
+    p->setCallbacksEnabled(true);
 }
 
 // 10.40
@@ -3024,8 +3133,7 @@ void RTI1516ambassador::disableCallbacks() throw(rti1516e::SaveInProgress,
                                                  rti1516e::RestoreInProgress,
                                                  rti1516e::RTIinternalError)
 {
-    /* TODO */
-    throw rti1516e::RTIinternalError(L"disableCallbacks Not implemented");
+    p->setCallbacksEnabled(false);
 }
 
 std::auto_ptr<rti1516e::LogicalTimeFactory> RTI1516ambassador::getTimeFactory() const
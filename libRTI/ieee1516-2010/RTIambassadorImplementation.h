@@ -1508,6 +1508,38 @@ public:
               rti1516e::NotConnected,
               rti1516e::RTIinternalError);
 
+    /// Updates of batchUpdateAttributeValues, one per object instance.
+    typedef std::vector<std::pair<rti1516e::ObjectInstanceHandle, rti1516e::AttributeHandleValueMap>>
+        AttributeValueUpdates;
+
+    /** Batch update attribute values (CERTI extension).
+     *  Update the attributes of several object instances at once, all with
+     *  theUserSuppliedTag. Subscribers get one reflection callback per object.
+     */
+    void batchUpdateAttributeValues(AttributeValueUpdates const& theUpdates,
+                                    rti1516e::VariableLengthData const& theUserSuppliedTag) throw(
+        rti1516e::ObjectInstanceNotKnown,
+        rti1516e::AttributeNotDefined,
+        rti1516e::AttributeNotOwned,
+        rti1516e::FederateNotExecutionMember,
+        rti1516e::SaveInProgress,
+        rti1516e::RestoreInProgress,
+        rti1516e::NotConnected,
+        rti1516e::RTIinternalError);
+
+    /// Same with time, the updates cannot be retracted.
+    void batchUpdateAttributeValues(AttributeValueUpdates const& theUpdates,
+                                    rti1516e::VariableLengthData const& theUserSuppliedTag,
+                                    rti1516e::LogicalTime const& theTime) throw(rti1516e::ObjectInstanceNotKnown,
+                                                                                rti1516e::AttributeNotDefined,
+                                                                                rti1516e::AttributeNotOwned,
+                                                                                rti1516e::InvalidLogicalTime,
+                                                                                rti1516e::FederateNotExecutionMember,
+                                                                                rti1516e::SaveInProgress,
+                                                                                rti1516e::RestoreInProgress,
+                                                                                rti1516e::NotConnected,
+                                                                                rti1516e::RTIinternalError);
+
 protected:
     RTI1516ambassador() noexcept;
 
@@ -1522,6 +1554,8 @@ private:
     void assignPHVMAndExecuteService(const rti1516e::ParameterHandleValueMap& PHVM, T& req, T& rep);
     template <typename T>
     void assignAHVMAndExecuteService(const rti1516e::AttributeHandleValueMap& AHVM, T& req, T& rep);
+    template <typename T>
+    void assignUpdatesAndExecuteService(const AttributeValueUpdates& updates, T& req, T& rep);
     // Helper function for CallBacks
 
     /** Generic callback evocation (CERTI extension).
@@ -1534,6 +1568,9 @@ private:
 
     friend std::auto_ptr<rti1516e::RTIambassador>
     rti1516e::RTIambassadorFactory::createRTIambassador() throw(rti1516e::RTIinternalError);
+
+    /// connects the ambassador to a scripted RTIA link (tests/LibRTI/ieee1516-2010)
+    friend class RTI1516ambassadorTest;
 };
 }
 
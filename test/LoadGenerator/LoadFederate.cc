@@ -0,0 +1,345 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "LoadFederate.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace {
+/// Lookahead of regulating federates, also the step of every time advance.
+constexpr double time_step{1.0};
+
+/// Width of a DDM cell on the X dimension of the routing space.
+constexpr unsigned long cell_width{100};
+
+/// Longest a tick() may keep evoking callbacks before returning to the update loop.
+constexpr double max_callback_burst{0.01};
+
+/// Payloads this long carry the sequence number of the update of the object after the send time.
+constexpr size_t sequenced_payload{2 * sizeof(uint64_t)};
+}
+
+namespace loadgen {
+
+uint64_t now()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+LoadFederate::LoadFederate(const Workload& workload, const unsigned int index, const std::string& fed_file)
+    : my_workload(workload)
+    , my_index(index)
+    , my_fed_file(fed_file)
+    , my_regulating(workload.isRegulating(index))
+    , my_constrained(workload.isConstrained(index))
+    , my_payload(workload.payload, static_cast<char>('a' + index % 26))
+    , my_values(RTI::AttributeSetFactory::create(1))
+{
+    my_result.index = index;
+}
+
+void LoadFederate::setUp()
+{
+    try {
+        my_rtiamb.createFederationExecution(my_workload.federation.c_str(), my_fed_file.c_str());
+    }
+    catch (RTI::FederationExecutionAlreadyExists&) {
+    }
+
+    const auto name = "LoadFederate" + std::to_string(my_index);
+    my_rtiamb.joinFederationExecution(name.c_str(), my_workload.federation.c_str(), this);
+
+    if (my_workload.regions) {
+        auto space = my_rtiamb.getRoutingSpaceHandle("LoadSpace");
+        auto dimension = my_rtiamb.getDimensionHandle("X", space);
+        const auto cell = my_workload.cell(my_index);
+
+        my_region = my_rtiamb.createRegion(space, 1);
+        my_region->setRangeLowerBound(0, dimension, cell * cell_width);
+        my_region->setRangeUpperBound(0, dimension, (cell + 1) * cell_width - 1);
+        my_rtiamb.notifyAboutRegionModification(*my_region);
+    }
+
+    // Subscriptions
+    for (unsigned int klass{0}; klass < my_workload.classes; ++klass) {
+        if (!my_workload.subscribes(my_index, klass)) {
+            continue;
+        }
+        auto handle = my_rtiamb.getObjectClassHandle(Workload::className(klass).c_str());
+        std::unique_ptr<RTI::AttributeHandleSet> attributes{RTI::AttributeHandleSetFactory::create(1)};
+        attributes->add(my_rtiamb.getAttributeHandle("Payload", handle));
+
+        if (my_region) {
+            my_rtiamb.subscribeObjectClassAttributesWithRegion(handle, *my_region, *attributes);
+        }
+        else {
+            my_rtiamb.subscribeObjectClassAttributes(handle, *attributes);
+        }
+    }
+
+    // Publication and registration
+    my_class = my_rtiamb.getObjectClassHandle(Workload::className(my_workload.publishedClass(my_index)).c_str());
+    my_payload_attribute = my_rtiamb.getAttributeHandle("Payload", my_class);
+    std::unique_ptr<RTI::AttributeHandleSet> payload{RTI::AttributeHandleSetFactory::create(1)};
+    payload->add(my_payload_attribute);
+    my_rtiamb.publishObjectClass(my_class, *payload);
+
+    for (unsigned int i{0}; i < my_workload.objects; ++i) {
+        my_objects.push_back(my_rtiamb.registerObjectInstance(my_class));
+        my_sequences.push_back(0);
+        if (my_region) {
+            my_rtiamb.associateRegionForUpdates(*my_region, my_objects.back(), *payload);
+        }
+    }
+
+    // Time management
+    if (my_regulating) {
+        my_rtiamb.enableTimeRegulation(RTIfedTime(my_time), RTIfedTime(time_step));
+        while (!my_regulation_enabled) {
+            tick(0.1);
+        }
+    }
+    if (my_constrained) {
+        my_rtiamb.enableTimeConstrained();
+        while (!my_constrained_enabled) {
+            tick(0.1);
+        }
+        // Receive order updates from non regulating federates must not wait for a grant
+        my_rtiamb.enableAsynchronousDelivery();
+    }
+}
+
+void LoadFederate::run(const uint64_t start, const uint64_t measure, const uint64_t end)
+{
+    my_measure = measure;
+    my_end = end;
+
+    const uint64_t period = my_workload.rate > 0.0 ? static_cast<uint64_t>(my_workload.batch * 1e9 / my_workload.rate) : 0;
+    auto next_update = start;
+
+    const uint64_t redeclare_period
+        = my_workload.redeclare > 0.0 ? static_cast<uint64_t>(1e9 / my_workload.redeclare) : 0;
+    auto next_redeclare = start + redeclare_period;
+
+    for (auto current = now(); current < end; current = now()) {
+        if (redeclare_period && current >= next_redeclare) {
+            redeclare();
+            next_redeclare += redeclare_period;
+        }
+
+        if (current >= next_update) {
+            sendUpdate();
+            if (current >= measure) {
+                my_result.updates += my_workload.batch;
+            }
+            next_update += period;
+        }
+
+        if ((my_regulating || my_constrained) && !my_advance_pending) {
+            requestAdvance();
+        }
+
+        const auto wait = next_update > current ? std::min(next_update, end) - current : 0;
+        tick(wait * 1e-9);
+    }
+
+    my_result.seconds = (end - measure) * 1e-9;
+}
+
+void LoadFederate::tearDown()
+{
+    my_rtiamb.resignFederationExecution(RTI::DELETE_OBJECTS_AND_RELEASE_ATTRIBUTES);
+
+    try {
+        my_rtiamb.destroyFederationExecution(my_workload.federation.c_str());
+    }
+    catch (RTI::FederatesCurrentlyJoined&) {
+    }
+    catch (RTI::FederationExecutionDoesNotExist&) {
+    }
+}
+
+FederateResult& LoadFederate::result()
+{
+    return my_result;
+}
+
+void LoadFederate::reflectAttributeValues(RTI::ObjectHandle object,
+                                          const RTI::AttributeHandleValuePairSet& attributes,
+                                          const RTI::FedTime& /*time*/,
+                                          const char* /*tag*/,
+                                          RTI::EventRetractionHandle /*handle*/)
+{
+    reflect(object, attributes);
+}
+
+void LoadFederate::reflectAttributeValues(RTI::ObjectHandle object,
+                                          const RTI::AttributeHandleValuePairSet& attributes,
+                                          const char* /*tag*/)
+{
+    reflect(object, attributes);
+}
+
+void LoadFederate::timeRegulationEnabled(const RTI::FedTime& time)
+{
+    my_time = static_cast<const RTIfedTime&>(time).getTime();
+    my_regulation_enabled = true;
+}
+
+void LoadFederate::timeConstrainedEnabled(const RTI::FedTime& time)
+{
+    my_time = static_cast<const RTIfedTime&>(time).getTime();
+    my_constrained_enabled = true;
+}
+
+void LoadFederate::timeAdvanceGrant(const RTI::FedTime& time)
+{
+    my_time = static_cast<const RTIfedTime&>(time).getTime();
+    my_advance_pending = false;
+
+    const auto current = now();
+    if (current >= my_measure && current < my_end) {
+        ++my_result.grants;
+    }
+}
+
+void LoadFederate::reflect(const RTI::ObjectHandle object, const RTI::AttributeHandleValuePairSet& attributes)
+{
+    const auto current = now();
+    if (current >= my_end) {
+        return;
+    }
+    const bool measured = current >= my_measure;
+
+    if (measured) {
+        ++my_result.reflections;
+    }
+    for (RTI::ULong i{0}; i < attributes.size(); ++i) {
+        RTI::ULong length{0};
+        const char* value = attributes.getValuePointer(i, length);
+        if (measured && length >= sizeof(uint64_t)) {
+            uint64_t sent;
+            memcpy(&sent, value, sizeof(sent));
+            my_result.latency_ns.record(current > sent ? current - sent : 0);
+        }
+        // the warmup sets where the sequence of each object stands
+        uint64_t sequence{0};
+        if (length >= sequenced_payload) {
+            memcpy(&sequence, value + sizeof(uint64_t), sizeof(sequence));
+        }
+        if (sequence == 0) {
+            continue;
+        }
+        auto last = my_reflected.find(object);
+        if (last == my_reflected.end()) {
+            my_reflected.emplace(object, sequence);
+            continue;
+        }
+        if (measured && sequence <= last->second) {
+            ++my_result.reordered;
+        }
+        else if (measured) {
+            my_result.lost += sequence - last->second - 1;
+        }
+        last->second = std::max(last->second, sequence);
+    }
+}
+
+void LoadFederate::sendUpdate()
+{
+    const auto sent = now();
+    memcpy(my_payload.data(), &sent, sizeof(sent));
+    if (my_payload.size() >= sequenced_payload) {
+        // a batch sends the same payload to several objects, its updates are not numbered
+        const uint64_t sequence = my_workload.batch > 1 ? 0 : ++my_sequences[my_next_object];
+        memcpy(my_payload.data() + sizeof(uint64_t), &sequence, sizeof(sequence));
+    }
+
+    my_values->empty();
+    my_values->add(my_payload_attribute, my_payload.data(), static_cast<RTI::ULong>(my_payload.size()));
+
+    if (my_workload.batch > 1) {
+        sendBatch();
+        return;
+    }
+
+    const auto object = my_objects[my_next_object];
+    my_next_object = (my_next_object + 1) % my_objects.size();
+
+    if (my_regulating) {
+        // While an advance is pending, the earliest allowed timestamp is relative to the requested time
+        const auto timestamp = my_time + (my_advance_pending ? 2 : 1) * time_step;
+        my_rtiamb.updateAttributeValues(object, *my_values, RTIfedTime(timestamp), "");
+    }
+    else {
+        my_rtiamb.updateAttributeValues(object, *my_values, "");
+    }
+}
+
+void LoadFederate::sendBatch()
+{
+    std::vector<RTI::ObjectHandle> objects(my_workload.batch);
+    for (auto& object : objects) {
+        object = my_objects[my_next_object];
+        my_next_object = (my_next_object + 1) % my_objects.size();
+    }
+    // every object is sent the same payload
+    const std::vector<const RTI::AttributeHandleValuePairSet*> values(my_workload.batch, my_values.get());
+
+    if (my_regulating) {
+        const auto timestamp = my_time + (my_advance_pending ? 2 : 1) * time_step;
+        my_rtiamb.batchUpdateAttributeValues(
+            my_workload.batch, objects.data(), values.data(), RTIfedTime(timestamp), "");
+    }
+    else {
+        my_rtiamb.batchUpdateAttributeValues(my_workload.batch, objects.data(), values.data(), "");
+    }
+}
+
+void LoadFederate::redeclare()
+{
+    std::unique_ptr<RTI::AttributeHandleSet> payload{RTI::AttributeHandleSetFactory::create(1)};
+    payload->add(my_payload_attribute);
+    my_rtiamb.publishObjectClass(my_class, *payload);
+}
+
+void LoadFederate::requestAdvance()
+{
+    my_advance_pending = true;
+    if (my_workload.advance == Workload::Advance::NextEventRequest) {
+        my_rtiamb.nextEventRequest(RTIfedTime(my_time + time_step));
+    }
+    else {
+        my_rtiamb.timeAdvanceRequest(RTIfedTime(my_time + time_step));
+    }
+}
+
+void LoadFederate::tick(const double seconds)
+{
+    my_rtiamb.tick(seconds, seconds + max_callback_burst);
+}
+
+} // namespace loadgen
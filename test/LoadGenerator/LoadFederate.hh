@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_LOAD_GENERATOR_LOAD_FEDERATE_HH
+#define CERTI_LOAD_GENERATOR_LOAD_FEDERATE_HH
+
+#include "RTI.hh"
+#include "NullFederateAmbassador.hh"
+#include "fedtime.hh"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Workload.hh"
+
+namespace loadgen {
+
+/// Nanoseconds on the monotonic clock, comparable between processes of the same host.
+uint64_t now();
+
+/** One synthetic federate of the load generator.
+ *
+ * Its role in the federation (published and subscribed classes, region,
+ * time management) is given by the workload and its index.
+ */
+class LoadFederate : public NullFederateAmbassador {
+public:
+    LoadFederate(const Workload& workload, const unsigned int index, const std::string& fed_file);
+
+    /// Create or join the federation, declare interests, register objects and switch on time management.
+    void setUp();
+
+    /** Run the workload.
+     *
+     * Updates are sent from start to end, at the workload rate. Only
+     * updates, reflections and grants seen after measure are counted.
+     * The class is published again at the redeclare rate of the workload.
+     */
+    void run(const uint64_t start, const uint64_t measure, const uint64_t end);
+
+    /// Resign, and destroy the federation if this is the last federate.
+    void tearDown();
+
+    FederateResult& result();
+
+    void reflectAttributeValues(RTI::ObjectHandle object,
+                                const RTI::AttributeHandleValuePairSet& attributes,
+                                const RTI::FedTime& time,
+                                const char* tag,
+                                RTI::EventRetractionHandle handle) override;
+
+    void reflectAttributeValues(RTI::ObjectHandle object,
+                                const RTI::AttributeHandleValuePairSet& attributes,
+                                const char* tag) override;
+
+    void timeRegulationEnabled(const RTI::FedTime& time) override;
+    void timeConstrainedEnabled(const RTI::FedTime& time) override;
+    void timeAdvanceGrant(const RTI::FedTime& time) override;
+
+private:
+    void reflect(const RTI::ObjectHandle object, const RTI::AttributeHandleValuePairSet& attributes);
+    void sendUpdate();
+    void redeclare();
+    void sendBatch();
+    void requestAdvance();
+    void tick(const double seconds);
+
+    const Workload& my_workload;
+    const unsigned int my_index;
+    const std::string my_fed_file;
+    const bool my_regulating;
+    const bool my_constrained;
+
+    RTI::RTIambassador my_rtiamb;
+
+    RTI::ObjectClassHandle my_class{0};
+    RTI::AttributeHandle my_payload_attribute{0};
+    RTI::Region* my_region{nullptr};
+    std::vector<RTI::ObjectHandle> my_objects{};
+    unsigned int my_next_object{0};
+    /// sequence number of the last update of each of my_objects
+    std::vector<uint64_t> my_sequences{};
+    /// sequence number of the last reflection of each object discovered
+    std::map<RTI::ObjectHandle, uint64_t> my_reflected{};
+
+    std::vector<char> my_payload;
+    std::unique_ptr<RTI::AttributeHandleValuePairSet> my_values;
+
+    bool my_regulation_enabled{false};
+    bool my_constrained_enabled{false};
+    bool my_advance_pending{false};
+    double my_time{0.0};
+
+    uint64_t my_measure{0};
+    uint64_t my_end{0};
+
+    FederateResult my_result{};
+};
+
+} // namespace loadgen
+
+#endif // CERTI_LOAD_GENERATOR_LOAD_FEDERATE_HH
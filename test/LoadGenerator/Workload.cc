@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include "Workload.hh"
+
+#include <sstream>
+
+namespace loadgen {
+
+std::string Workload::check() const
+{
+    std::ostringstream reason;
+
+    if (federates == 0) {
+        reason << "at least one federate is needed";
+    }
+    else if (classes == 0 || classes > federates) {
+        reason << "classes must be between 1 and the number of federates";
+    }
+    else if (objects == 0) {
+        reason << "each federate needs at least one object";
+    }
+    else if (subscribers >= federates) {
+        reason << "subscribers per class must be below the number of federates";
+    }
+    else if (payload < sizeof(uint64_t)) {
+        reason << "payload must be at least " << sizeof(uint64_t) << " bytes to hold the send timestamp";
+    }
+    else if (batch == 0) {
+        reason << "batches need at least one update";
+    }
+    else if (regulating > federates || constrained > federates) {
+        reason << "cannot have more regulating or constrained federates than federates";
+    }
+    else if (rate < 0.0 || duration <= 0.0 || warmup < 0.0 || redeclare < 0.0) {
+        reason << "rate, duration, warmup and redeclare must be positive";
+    }
+
+    return reason.str();
+}
+
+unsigned int Workload::publishedClass(const unsigned int federate) const
+{
+    return federate % classes;
+}
+
+bool Workload::subscribes(const unsigned int federate, const unsigned int klass) const
+{
+    const auto distance = (federate + federates - klass % federates) % federates;
+    return distance >= 1 && distance <= subscribers;
+}
+
+unsigned int Workload::cell(const unsigned int federate) const
+{
+    return regions ? federate % regions : 0;
+}
+
+bool Workload::isRegulating(const unsigned int federate) const
+{
+    return federate < regulating;
+}
+
+bool Workload::isConstrained(const unsigned int federate) const
+{
+    return federate + constrained >= federates;
+}
+
+std::string Workload::className(const unsigned int klass)
+{
+    return "LoadClass" + std::to_string(klass);
+}
+
+void Workload::writeFed(std::ostream& stream) const
+{
+    stream << ";; Generated by certi-loadgen\n"
+           << "\n"
+           << "(Fed\n"
+           << "  (Federation " << federation << ")\n"
+           << "  (FedVersion v1.3)\n"
+           << "  (Federate \"fed\" \"Public\")\n"
+           << "  (Spaces\n"
+           << "    (Space \"LoadSpace\"\n"
+           << "      (Dimension X)\n"
+           << "    )\n"
+           << "  )\n"
+           << "  (Objects\n"
+           << "    (Class ObjectRoot\n"
+           << "      (Attribute privilegeToDelete reliable timestamp)\n"
+           << "      (Class RTIprivate)\n";
+    for (unsigned int klass{0}; klass < classes; ++klass) {
+        stream << "      (Class " << className(klass) << "\n"
+               << "        (Attribute Payload RELIABLE TIMESTAMP)\n"
+               << "      )\n";
+    }
+    stream << "    )\n"
+           << "  )\n"
+           << "  (Interactions\n"
+           << "    (Class InteractionRoot BEST_EFFORT RECEIVE\n"
+           << "      (Class RTIprivate BEST_EFFORT RECEIVE)\n"
+           << "    )\n"
+           << "  )\n"
+           << ")\n";
+}
+
+void Workload::writeJson(std::ostream& stream) const
+{
+    stream << "{\"federates\": " << federates << ", \"classes\": " << classes << ", \"objects\": " << objects
+           << ", \"subscribers\": " << subscribers << ", \"payload\": " << payload << ", \"batch\": " << batch
+           << ", \"regions\": " << regions
+           << ", \"regulating\": " << regulating << ", \"constrained\": " << constrained << ", \"rate\": " << rate
+           << ", \"duration\": " << duration << ", \"warmup\": " << warmup << ", \"redeclare\": " << redeclare
+           << ", \"advance\": \""
+           << (advance == Advance::NextEventRequest ? "ner" : "tar") << "\"}";
+}
+
+} // namespace loadgen
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#ifndef CERTI_LOAD_GENERATOR_WORKLOAD_HH
+#define CERTI_LOAD_GENERATOR_WORKLOAD_HH
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include <libCERTI/LogLinearHistogram.hh>
+
+namespace loadgen {
+
+/** Description of a synthetic federation.
+ *
+ * Every federate plays a role fully determined by its index and the
+ * workload, so that two runs with the same parameters exercise the RTIG
+ * the same way:
+ * - federate i publishes class i % classes, and registers objects instances of it,
+ * - federate j subscribes to class c if (j - c) mod federates is in [1, subscribers],
+ * - with regions, federate i updates through cell i % regions and subscribes
+ *   through the same cell, so only federates sharing a cell are connected,
+ * - the first `regulating` federates are time regulating, the last
+ *   `constrained` ones are time constrained.
+ */
+struct Workload {
+    enum class Advance { TimeAdvanceRequest, NextEventRequest };
+
+    unsigned int federates{4};
+    unsigned int classes{1};
+    unsigned int objects{1};
+    unsigned int subscribers{3};
+    unsigned int payload{64};
+    /// updates sent in one batchUpdateAttributeValues call, 1 for plain updates
+    unsigned int batch{1};
+    unsigned int regions{0};
+    unsigned int regulating{0};
+    unsigned int constrained{0};
+    double rate{1000.0};
+    double duration{10.0};
+    double warmup{1.0};
+    /// publications of the class again per second and per federate, each one invalidates the peer routes
+    double redeclare{0.0};
+    Advance advance{Advance::TimeAdvanceRequest};
+    std::string federation{"LoadGenerator"};
+
+    /// Empty string if the workload is consistent, or the reason why it is not.
+    std::string check() const;
+
+    unsigned int publishedClass(const unsigned int federate) const;
+    bool subscribes(const unsigned int federate, const unsigned int klass) const;
+    unsigned int cell(const unsigned int federate) const;
+    bool isRegulating(const unsigned int federate) const;
+    bool isConstrained(const unsigned int federate) const;
+
+    static std::string className(const unsigned int klass);
+
+    /// Write the HLA 1.3 FED file matching this workload.
+    void writeFed(std::ostream& stream) const;
+
+    /// Write the workload as a JSON object.
+    void writeJson(std::ostream& stream) const;
+};
+
+/** What a federate reports to the driver at the end of the run.
+ *
+ * Only what happened during the measurement window is counted. The struct
+ * is trivially copyable so that it can go through a pipe as is.
+ */
+struct FederateResult {
+    uint32_t index;
+    uint32_t failed;
+    uint64_t updates;
+    uint64_t reflections;
+    uint64_t grants;
+    /// updates of an object missing between two of its reflections
+    uint64_t lost;
+    /// reflections of an object older than the previous one
+    uint64_t reordered;
+    double seconds;
+    certi::LogLinearHistogram latency_ns;
+    char error[256];
+};
+
+} // namespace loadgen
+
+#endif // CERTI_LOAD_GENERATOR_WORKLOAD_HH
@@ -0,0 +1,583 @@
+// ----------------------------------------------------------------------------
+// CERTI - HLA RunTime Infrastructure
+// Copyright (C) 2002-2018  ISAE-SUPAERO & ONERA
+//
+// This file is part of CERTI
+//
+// CERTI is free software ; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation ; either version 2 of the License, or
+// (at your option) any later version.
+//
+// CERTI is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY ; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program ; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// ----------------------------------------------------------------------------
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "LoadFederate.hh"
+#include "Workload.hh"
+
+using loadgen::FederateResult;
+using loadgen::LoadFederate;
+using loadgen::Workload;
+
+/**
+ * certi-loadgen runs a reproducible synthetic federation against a RTIG and
+ * reports its throughput and latencies as JSON.
+ *
+ * Each federate is a separate process forked by the driver, with its own
+ * RTIA. Federates set up the federation, then wait for the driver so that
+ * they all start sending at the same time. Updates carry their send time in
+ * the first 8 bytes of the payload, receivers compute the end to end latency
+ * from it: all federates must run on the same host. Payloads of 16 bytes or
+ * more also carry the sequence number of the update of its object, so that
+ * receivers count the updates lost or reflected out of order.
+ *
+ * \par certi-loadgen [options]
+ * See certi-loadgen --help for the workload parameters.
+ */
+
+namespace {
+
+/// Same default as PORT_TCP_RTIG, used when neither --port nor CERTI_TCP_PORT are given.
+constexpr unsigned long default_rtig_port{60400};
+
+struct Options {
+    Workload workload;
+    bool subscribers_given{false};
+    std::string rtig;
+    std::string rtia;
+    std::string output;
+    unsigned int port{0};
+    bool peer_to_peer{false};
+    bool verify{false};
+};
+
+void usage(const char* program, std::ostream& stream)
+{
+    stream << "usage: " << program << " [options]\n"
+           << "  -n, --federates N     number of federates (default 4)\n"
+           << "  -c, --classes K       number of object classes, federate i publishes class i % K (default 1)\n"
+           << "  -o, --objects M       object instances registered per federate (default 1)\n"
+           << "  -s, --subscribers S   subscribers per class (default: every other federate)\n"
+           << "  -p, --payload BYTES   update payload size, at least 8 (default 64)\n"
+           << "  -b, --batch B         send updates B at a time with batchUpdateAttributeValues (default 1)\n"
+           << "  -r, --rate HZ         updates per second and per federate, 0 for unthrottled (default 1000)\n"
+           << "  -g, --regions D       use D disjoint DDM regions, federate i in region i % D (default 0: no DDM)\n"
+           << "  -R, --regulating N    the first N federates are time regulating (default 0)\n"
+           << "  -C, --constrained N   the last N federates are time constrained (default 0)\n"
+           << "  -a, --advance tar|ner time advance service of time managed federates (default tar)\n"
+           << "  -d, --duration S      measurement duration in seconds (default 10)\n"
+           << "  -w, --warmup S        seconds of load before measuring (default 1)\n"
+           << "  -D, --redeclare HZ    publish the class again HZ times per second, invalidating peer routes (default 0)\n"
+           << "  -P, --peer-to-peer    RTIAs exchange undated updates directly (sets CERTI_PEER_TO_PEER)\n"
+           << "  -V, --verify          fail unless updates were reflected, none lost nor out of order\n"
+           << "      --rtig PATH       start this rtig for the run, instead of using a running one\n"
+           << "      --rtia PATH       rtia executable used by the federates (sets CERTI_RTIA)\n"
+           << "      --port PORT       RTIG TCP port when starting a rtig (UDP port is PORT + 100)\n"
+           << "  -f, --output FILE     write the JSON report to FILE instead of stdout\n";
+}
+
+bool parse(int argc, char* argv[], Options& options)
+{
+    enum { RtigOption = 256, RtiaOption, PortOption };
+    static const struct option long_options[] = {{"federates", required_argument, nullptr, 'n'},
+                                                 {"classes", required_argument, nullptr, 'c'},
+                                                 {"objects", required_argument, nullptr, 'o'},
+                                                 {"subscribers", required_argument, nullptr, 's'},
+                                                 {"payload", required_argument, nullptr, 'p'},
+                                                 {"batch", required_argument, nullptr, 'b'},
+                                                 {"rate", required_argument, nullptr, 'r'},
+                                                 {"regions", required_argument, nullptr, 'g'},
+                                                 {"regulating", required_argument, nullptr, 'R'},
+                                                 {"constrained", required_argument, nullptr, 'C'},
+                                                 {"advance", required_argument, nullptr, 'a'},
+                                                 {"duration", required_argument, nullptr, 'd'},
+                                                 {"warmup", required_argument, nullptr, 'w'},
+                                                 {"redeclare", required_argument, nullptr, 'D'},
+                                                 {"peer-to-peer", no_argument, nullptr, 'P'},
+                                                 {"verify", no_argument, nullptr, 'V'},
+                                                 {"rtig", required_argument, nullptr, RtigOption},
+                                                 {"rtia", required_argument, nullptr, RtiaOption},
+                                                 {"port", required_argument, nullptr, PortOption},
+                                                 {"output", required_argument, nullptr, 'f'},
+                                                 {"help", no_argument, nullptr, 'h'},
+                                                 {nullptr, 0, nullptr, 0}};
+
+    auto& workload = options.workload;
+    int option;
+    while ((option = getopt_long(argc, argv, "n:c:o:s:p:b:r:g:R:C:a:d:w:D:PVf:h", long_options, nullptr)) != -1) {
+        switch (option) {
+        case 'n':
+            workload.federates = std::stoul(optarg);
+            break;
+        case 'c':
+            workload.classes = std::stoul(optarg);
+            break;
+        case 'o':
+            workload.objects = std::stoul(optarg);
+            break;
+        case 's':
+            workload.subscribers = std::stoul(optarg);
+            options.subscribers_given = true;
+            break;
+        case 'p':
+            workload.payload = std::stoul(optarg);
+            break;
+        case 'b':
+            workload.batch = std::stoul(optarg);
+            break;
+        case 'r':
+            workload.rate = std::stod(optarg);
+            break;
+        case 'g':
+            workload.regions = std::stoul(optarg);
+            break;
+        case 'R':
+            workload.regulating = std::stoul(optarg);
+            break;
+        case 'C':
+            workload.constrained = std::stoul(optarg);
+            break;
+        case 'a':
+            if (std::string(optarg) == "ner") {
+                workload.advance = Workload::Advance::NextEventRequest;
+            }
+            else if (std::string(optarg) == "tar") {
+                workload.advance = Workload::Advance::TimeAdvanceRequest;
+            }
+            else {
+                std::cerr << "Unknown time advance service " << optarg << std::endl;
+                return false;
+            }
+            break;
+        case 'd':
+            workload.duration = std::stod(optarg);
+            break;
+        case 'w':
+            workload.warmup = std::stod(optarg);
+            break;
+        case 'D':
+            workload.redeclare = std::stod(optarg);
+            break;
+        case 'P':
+            options.peer_to_peer = true;
+            break;
+        case 'V':
+            options.verify = true;
+            break;
+        case RtigOption:
+            options.rtig = optarg;
+            break;
+        case RtiaOption:
+            options.rtia = optarg;
+            break;
+        case PortOption:
+            options.port = std::stoul(optarg);
+            break;
+        case 'f':
+            options.output = optarg;
+            break;
+        case 'h':
+            usage(argv[0], std::cout);
+            exit(EXIT_SUCCESS);
+        default:
+            usage(argv[0], std::cerr);
+            return false;
+        }
+    }
+
+    if (!options.subscribers_given) {
+        workload.subscribers = workload.federates - 1;
+    }
+
+    return true;
+}
+
+bool writeAll(const int fd, const void* data, const size_t size)
+{
+    auto bytes = static_cast<const char*>(data);
+    for (size_t done{0}; done < size;) {
+        auto written = write(fd, bytes + done, size - done);
+        if (written <= 0) {
+            return false;
+        }
+        done += static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool readAll(const int fd, void* data, const size_t size)
+{
+    auto bytes = static_cast<char*>(data);
+    for (size_t done{0}; done < size;) {
+        auto got = read(fd, bytes + done, size - done);
+        if (got <= 0) {
+            return false;
+        }
+        done += static_cast<size_t>(got);
+    }
+    return true;
+}
+
+/// Start, measurement start and end dates sent by the driver. All zero means abort.
+struct Schedule {
+    uint64_t start;
+    uint64_t measure;
+    uint64_t end;
+};
+
+/// Body of a federate process.
+int runFederate(const Workload& workload,
+                const unsigned int index,
+                const std::string& fed_file,
+                const int to_driver,
+                const int from_driver)
+{
+    FederateResult failure{};
+    failure.index = index;
+    failure.failed = 1;
+
+    auto report = [&](const char status, const FederateResult& result) {
+        writeAll(to_driver, &status, 1);
+        writeAll(to_driver, &result, sizeof(result));
+    };
+
+    // Keep stdout for the report, the RTIA prints its statistics there
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    try {
+        LoadFederate federate(workload, index, fed_file);
+        federate.setUp();
+
+        const char ready{'R'};
+        writeAll(to_driver, &ready, 1);
+
+        Schedule schedule{};
+        if (!readAll(from_driver, &schedule, sizeof(schedule)) || schedule.start == 0) {
+            federate.tearDown();
+            return EXIT_FAILURE;
+        }
+
+        federate.run(schedule.start, schedule.measure, schedule.end);
+        federate.tearDown();
+
+        report('D', federate.result());
+        return EXIT_SUCCESS;
+    }
+    catch (RTI::Exception& e) {
+        snprintf(failure.error, sizeof(failure.error), "%s: %s", e._name, e._reason ? e._reason : "");
+    }
+    catch (std::exception& e) {
+        snprintf(failure.error, sizeof(failure.error), "%s", e.what());
+    }
+    report('F', failure);
+    return EXIT_FAILURE;
+}
+
+struct FederateProcess {
+    pid_t pid;
+    int from_federate;
+    int to_federate;
+};
+
+bool spawnFederate(const Workload& workload,
+                   const unsigned int index,
+                   const std::string& fed_file,
+                   FederateProcess& process)
+{
+    int up[2], down[2];
+    if (pipe(up) != 0 || pipe(down) != 0) {
+        return false;
+    }
+
+    process.pid = fork();
+    if (process.pid < 0) {
+        return false;
+    }
+    if (process.pid == 0) {
+        close(up[0]);
+        close(down[1]);
+        _exit(runFederate(workload, index, fed_file, up[1], down[0]));
+    }
+
+    close(up[1]);
+    close(down[0]);
+    process.from_federate = up[0];
+    process.to_federate = down[1];
+    return true;
+}
+
+pid_t spawnRtig(const std::string& rtig, const std::string& directory)
+{
+    auto pid = fork();
+    if (pid == 0) {
+        if (chdir(directory.c_str()) != 0) {
+            _exit(EXIT_FAILURE);
+        }
+        auto log = open("rtig.out", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (log >= 0) {
+            dup2(log, STDOUT_FILENO);
+            dup2(log, STDERR_FILENO);
+            close(log);
+        }
+        execlp(rtig.c_str(), rtig.c_str(), static_cast<char*>(nullptr));
+        _exit(EXIT_FAILURE);
+    }
+    return pid;
+}
+
+/// Wait until something accepts connections on the local TCP port.
+bool waitForPort(const unsigned int port, const pid_t rtig)
+{
+    for (int attempt{0}; attempt < 100; ++attempt) {
+        int status;
+        if (waitpid(rtig, &status, WNOHANG) == rtig) {
+            return false;
+        }
+
+        auto probe = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        auto connected = connect(probe, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+        close(probe);
+        if (connected) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return false;
+}
+
+void removeDirectory(const std::string& directory)
+{
+    if (auto dir = opendir(directory.c_str())) {
+        while (auto entry = readdir(dir)) {
+            if (strcmp(entry->d_name, ".") && strcmp(entry->d_name, "..")) {
+                unlink((directory + "/" + entry->d_name).c_str());
+            }
+        }
+        closedir(dir);
+    }
+    rmdir(directory.c_str());
+}
+
+void writeHistogram(std::ostream& stream, const certi::LogLinearHistogram& histogram)
+{
+    stream << "{\"count\": " << histogram.count() << ", \"min\": " << histogram.min()
+           << ", \"p50\": " << histogram.percentile(0.5) << ", \"p90\": " << histogram.percentile(0.9)
+           << ", \"p99\": " << histogram.percentile(0.99) << ", \"p999\": " << histogram.percentile(0.999)
+           << ", \"max\": " << histogram.max() << ", \"mean\": " << histogram.mean() << "}";
+}
+
+void writeCounters(std::ostream& stream,
+                   const uint64_t updates,
+                   const uint64_t reflections,
+                   const uint64_t grants,
+                   const uint64_t lost,
+                   const uint64_t reordered,
+                   const double seconds)
+{
+    stream << "\"updates\": " << updates << ", \"reflections\": " << reflections << ", \"grants\": " << grants
+           << ", \"lost\": " << lost << ", \"reordered\": " << reordered
+           << ", \"updates_per_second\": " << updates / seconds
+           << ", \"reflections_per_second\": " << reflections / seconds
+           << ", \"grants_per_second\": " << grants / seconds;
+}
+
+void writeReport(std::ostream& stream, const Workload& workload, const std::vector<FederateResult>& results)
+{
+    uint64_t updates{0}, reflections{0}, grants{0}, lost{0}, reordered{0};
+    certi::LogLinearHistogram latency;
+    for (const auto& result : results) {
+        updates += result.updates;
+        reflections += result.reflections;
+        grants += result.grants;
+        lost += result.lost;
+        reordered += result.reordered;
+        latency.merge(result.latency_ns);
+    }
+
+    stream << "{\n  \"workload\": ";
+    workload.writeJson(stream);
+    stream << ",\n  \"total\": {";
+    writeCounters(stream, updates, reflections, grants, lost, reordered, workload.duration);
+    stream << ", \"latency_ns\": ";
+    writeHistogram(stream, latency);
+    stream << "},\n  \"federates\": [";
+    for (size_t i{0}; i < results.size(); ++i) {
+        const auto& result = results[i];
+        stream << (i ? ",\n" : "\n") << "    {\"index\": " << result.index << ", ";
+        writeCounters(stream,
+                      result.updates,
+                      result.reflections,
+                      result.grants,
+                      result.lost,
+                      result.reordered,
+                      result.seconds);
+        stream << ", \"latency_ns\": ";
+        writeHistogram(stream, result.latency_ns);
+        stream << "}";
+    }
+    stream << "\n  ]\n}" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!parse(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+
+    const auto& workload = options.workload;
+    auto problem = workload.check();
+    if (!problem.empty()) {
+        std::cerr << "Invalid workload: " << problem << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+
+    char directory_template[] = "/tmp/certi-loadgen-XXXXXX";
+    if (!mkdtemp(directory_template)) {
+        std::cerr << "Could not create a working directory" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string directory{directory_template};
+    const auto fed_file = directory + "/" + workload.federation + ".fed";
+    {
+        std::ofstream fed(fed_file);
+        workload.writeFed(fed);
+    }
+
+    if (!options.rtia.empty()) {
+        setenv("CERTI_RTIA", options.rtia.c_str(), 1);
+    }
+    if (options.peer_to_peer) {
+        setenv("CERTI_PEER_TO_PEER", "1", 1);
+    }
+
+    pid_t rtig{0};
+    if (!options.rtig.empty()) {
+        if (options.port) {
+            setenv("CERTI_TCP_PORT", std::to_string(options.port).c_str(), 1);
+            setenv("CERTI_UDP_PORT", std::to_string(options.port + 100).c_str(), 1);
+        }
+        auto port = getenv("CERTI_TCP_PORT") ? std::stoul(getenv("CERTI_TCP_PORT")) : default_rtig_port;
+
+        rtig = spawnRtig(options.rtig, directory);
+        if (rtig < 0 || !waitForPort(port, rtig)) {
+            std::cerr << "Could not start " << options.rtig << ", see " << directory << "/rtig.out" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cerr << "Starting " << workload.federates << " federates" << std::endl;
+    std::vector<FederateProcess> processes(workload.federates);
+    std::vector<FederateResult> results(workload.federates);
+    bool ok{true};
+    for (unsigned int i{0}; i < workload.federates && ok; ++i) {
+        ok = spawnFederate(workload, i, fed_file, processes[i]);
+        if (!ok) {
+            processes.resize(i);
+        }
+    }
+
+    // Wait until every federate is set up
+    for (unsigned int i{0}; i < processes.size(); ++i) {
+        char status{0};
+        if (!readAll(processes[i].from_federate, &status, 1) || status != 'R') {
+            if (status == 'F' && readAll(processes[i].from_federate, &results[i], sizeof(results[i]))) {
+                std::cerr << "Federate " << i << " failed: " << results[i].error << std::endl;
+            }
+            ok = false;
+        }
+    }
+
+    Schedule schedule{};
+    if (ok) {
+        schedule.start = loadgen::now() + 100000000;
+        schedule.measure = schedule.start + static_cast<uint64_t>(workload.warmup * 1e9);
+        schedule.end = schedule.measure + static_cast<uint64_t>(workload.duration * 1e9);
+        std::cerr << "Running for " << workload.warmup + workload.duration << " seconds" << std::endl;
+    }
+    for (auto& process : processes) {
+        writeAll(process.to_federate, &schedule, sizeof(schedule));
+    }
+
+    for (unsigned int i{0}; i < processes.size(); ++i) {
+        char status{0};
+        if (ok && (!readAll(processes[i].from_federate, &status, 1)
+                   || !readAll(processes[i].from_federate, &results[i], sizeof(results[i])) || status != 'D')) {
+            std::cerr << "Federate " << i << " failed: " << (status ? results[i].error : "no result") << std::endl;
+            ok = false;
+        }
+        close(processes[i].from_federate);
+        close(processes[i].to_federate);
+        waitpid(processes[i].pid, nullptr, 0);
+    }
+
+    if (rtig > 0) {
+        kill(rtig, SIGINT);
+        waitpid(rtig, nullptr, 0);
+    }
+    removeDirectory(directory);
+
+    if (!ok) {
+        return EXIT_FAILURE;
+    }
+
+    if (options.output.empty()) {
+        writeReport(std::cout, workload, results);
+    }
+    else {
+        std::ofstream output(options.output);
+        writeReport(output, workload, results);
+    }
+
+    if (options.verify) {
+        uint64_t reflections{0};
+        for (const auto& result : results) {
+            if (result.lost || result.reordered) {
+                std::cerr << "Federate " << result.index << " lost " << result.lost << " updates and reflected "
+                          << result.reordered << " out of order" << std::endl;
+                ok = false;
+            }
+            reflections += result.reflections;
+        }
+        if (reflections == 0) {
+            std::cerr << "No update was reflected" << std::endl;
+            ok = false;
+        }
+    }
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "libCERTI/AuditFile.hh"
+#include "libCERTI/AuditLine.hh"
+#include "libCERTI/AuditRecord.hh"
+
+using ::certi::AuditFile;
+using ::certi::AuditLine;
+using ::certi::AuditRecord;
+using ::certi::AuditRecordFileHeader;
+
+namespace {
+static constexpr auto binary_file_name = "auditfile_test.audit";
+
+std::vector<AuditRecord> readRecords(const std::string& file_name)
+{
+    std::vector<AuditRecord> records;
+
+    std::ifstream input(file_name, std::ios::binary);
+    AuditRecordFileHeader header;
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    EXPECT_TRUE(header.isValid());
+
+    AuditRecord record;
+    while (input.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        records.push_back(record);
+    }
+    return records;
+}
+}
+
+TEST(AuditRecordTest, OutputMatchesAuditLine)
+{
+    AuditLine line{AuditLine::Type(3), AuditLine::Level(4), AuditLine::Status(static_cast<::certi::Exception::Type>(5)), "reason"};
+    line.setFederation(1);
+    line.setFederate(2);
+
+    AuditRecord record;
+    record.clear();
+    record.federation = 1;
+    record.federate = 2;
+    record.type = 3;
+    record.level = 4;
+    record.status = 5;
+    record.append("reason", 6);
+
+    std::stringstream from_line;
+    line.write(from_line);
+
+    std::stringstream from_record;
+    record.write(from_record);
+
+    EXPECT_EQ(from_line.str(), from_record.str());
+}
+
+TEST(AuditRecordTest, AppendTruncatesLongComments)
+{
+    AuditRecord record;
+    record.clear();
+
+    std::string long_comment(2 * AuditRecord::max_comment_length, 'x');
+    record.append(long_comment.data(), long_comment.size());
+    record.append("y", 1);
+
+    EXPECT_EQ(AuditRecord::max_comment_length, record.comment_length);
+}
+
+TEST(AuditFileTest, BinaryFormatWritesStartAndStopRecords)
+{
+    std::remove(binary_file_name);
+    {
+        AuditFile audit(binary_file_name, AuditFile::Format::Binary);
+    }
+
+    auto records = readRecords(binary_file_name);
+    ASSERT_EQ(2u, records.size());
+    EXPECT_EQ(128, records.front().type);
+    EXPECT_EQ(129, records.back().type);
+
+    std::remove(binary_file_name);
+}
+
+TEST(AuditFileTest, BinaryFormatKeepsLinesAboveCurrentLevel)
+{
+    std::remove(binary_file_name);
+    {
+        AuditFile audit(binary_file_name, AuditFile::Format::Binary);
+
+        audit.startLine(1, 2, AuditLine::Type(3));
+        audit.setLevel(AuditLine::Level(AUDIT_CURRENT_LEVEL));
+        audit << "Federate " << 42 << ", handle " << 7ul;
+        audit.endLine(AuditLine::Status(::certi::Exception::Type::NO_EXCEPTION), " - OK");
+
+        // below current level, discarded
+        audit.startLine(1, 2, AuditLine::Type(4));
+        audit << "discarded";
+        audit.endLine(AuditLine::Status(::certi::Exception::Type::NO_EXCEPTION), " - OK");
+    }
+
+    auto records = readRecords(binary_file_name);
+    ASSERT_EQ(3u, records.size());
+
+    auto& record = records.at(1);
+    EXPECT_EQ(1u, record.federation);
+    EXPECT_EQ(2u, record.federate);
+    EXPECT_EQ(3, record.type);
+    EXPECT_EQ(AUDIT_CURRENT_LEVEL, record.level);
+    EXPECT_EQ("Federate 42, handle 7 - OK", std::string(record.comment, record.comment_length));
+
+    std::remove(binary_file_name);
+}
+
+TEST(AuditFileTest, BinaryFormatKeepsExceptionsBelowCurrentLevel)
+{
+    std::remove(binary_file_name);
+    {
+        AuditFile audit(binary_file_name, AuditFile::Format::Binary);
+
+        audit.startLine(1, 2, AuditLine::Type(3));
+        audit.endLine(AuditLine::Status(::certi::Exception::Type::RTIinternalError), "failed");
+    }
+
+    auto records = readRecords(binary_file_name);
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(static_cast<uint8_t>(::certi::Exception::Type::RTIinternalError), records.at(1).status);
+
+    std::remove(binary_file_name);
+}
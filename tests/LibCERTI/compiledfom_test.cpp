@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include "libCERTI/CompiledFom.hh"
+#include "libCERTI/Interaction.hh"
+#include "libCERTI/ObjectClass.hh"
+#include "libCERTI/ObjectClassAttribute.hh"
+#include "libCERTI/Parameter.hh"
+#include "libCERTI/RootObject.hh"
+
+using ::certi::CompiledFom;
+using ::certi::HandleMask;
+using ::certi::Interaction;
+using ::certi::ObjectClass;
+using ::certi::ObjectClassAttribute;
+using ::certi::Parameter;
+using ::certi::RootObject;
+
+namespace {
+ObjectClassAttribute*
+attribute(const std::string& name, const certi::AttributeHandle handle, const certi::OrderType order, const certi::SpaceHandle space = 0)
+{
+    auto attribute = new ObjectClassAttribute(name, handle);
+    attribute->order = order;
+    attribute->transport = certi::RELIABLE;
+    attribute->setSpace(space);
+    return attribute;
+}
+}
+
+class CompiledFomTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        // ObjectRoot(1) { privilegeToDelete } > Vehicle(2) { position TSO, space 1 } > Car(4) { plate }
+        auto objectRoot = new ObjectClass("ObjectRoot", 1);
+        root.addObjectClass(objectRoot, nullptr);
+        objectRoot->addAttribute(attribute("privilegeToDelete", 1, certi::RECEIVE));
+
+        auto vehicle = new ObjectClass("Vehicle", 2);
+        root.addObjectClass(vehicle, objectRoot);
+        vehicle->addAttribute(attribute("position", 2, certi::TIMESTAMP, 1));
+
+        auto car = new ObjectClass("Car", 4);
+        root.addObjectClass(car, vehicle);
+        car->addAttribute(attribute("plate", 3, certi::TIMESTAMP));
+
+        auto interactionRoot = new Interaction("InteractionRoot", 1, certi::RELIABLE, certi::RECEIVE);
+        root.addInteractionClass(interactionRoot, nullptr);
+
+        auto crash = new Interaction("Crash", 2, certi::BEST_EFFORT, certi::TIMESTAMP);
+        crash->setSpace(1);
+        root.addInteractionClass(crash, interactionRoot);
+        crash->addParameter(new Parameter("speed", 1));
+    }
+
+    RootObject root{};
+};
+
+TEST(HandleMaskTest, HoldsHandlesAcrossWords)
+{
+    HandleMask mask;
+    mask.set(1);
+    mask.set(64);
+    mask.set(200);
+
+    EXPECT_TRUE(mask.test(1));
+    EXPECT_TRUE(mask.test(64));
+    EXPECT_TRUE(mask.test(200));
+    EXPECT_FALSE(mask.test(0));
+    EXPECT_FALSE(mask.test(63));
+    EXPECT_FALSE(mask.test(1000));
+    EXPECT_EQ(3u, mask.count());
+
+    EXPECT_TRUE(mask.containsAll({1, 200}));
+    EXPECT_FALSE(mask.containsAll({1, 2}));
+    EXPECT_TRUE(mask.containsAll({}));
+}
+
+TEST_F(CompiledFomTest, ClassesAreIndexedByHandle)
+{
+    auto fom = root.getCompiledFom();
+
+    EXPECT_EQ(3u, fom->objectClassCount());
+    EXPECT_EQ(2u, fom->interactionClassCount());
+
+    EXPECT_EQ(nullptr, fom->findObjectClass(3));
+    EXPECT_EQ(nullptr, fom->findObjectClass(42));
+    EXPECT_THROW(fom->getObjectClass(3), certi::ObjectClassNotDefined);
+    EXPECT_THROW(fom->getInteractionClass(3), certi::InteractionClassNotDefined);
+
+    EXPECT_EQ(2u, fom->getObjectClass(4).superclass);
+    EXPECT_EQ((std::vector<certi::ObjectClassHandle>{4, 2, 1}), fom->getObjectClass(4).lineage);
+    EXPECT_TRUE(fom->isKindOf(4, 1));
+    EXPECT_TRUE(fom->isKindOf(4, 4));
+    EXPECT_FALSE(fom->isKindOf(2, 4));
+}
+
+TEST_F(CompiledFomTest, SubclassesHaveInheritedAttributes)
+{
+    auto fom = root.getCompiledFom();
+
+    EXPECT_TRUE(fom->hasAttribute(4, 1));
+    EXPECT_TRUE(fom->hasAttribute(4, 2));
+    EXPECT_TRUE(fom->hasAttribute(4, 3));
+    EXPECT_FALSE(fom->hasAttribute(2, 3));
+    EXPECT_FALSE(fom->hasAttribute(3, 1));
+
+    EXPECT_TRUE(fom->isTimestamped(4, {2, 3}));
+    EXPECT_FALSE(fom->isTimestamped(4, {1, 2}));
+    EXPECT_FALSE(fom->isTimestamped(2, {2, 3}));
+
+    EXPECT_EQ(1u, fom->getAttributeSpace(4, 2));
+    EXPECT_EQ(0u, fom->getAttributeSpace(4, 3));
+    EXPECT_EQ(1u, fom->getObjectClass(4).spaced.count());
+    EXPECT_THROW(fom->getAttributeSpace(2, 3), certi::AttributeNotDefined);
+}
+
+TEST_F(CompiledFomTest, InteractionsKeepTheirDeclaredProperties)
+{
+    auto fom = root.getCompiledFom();
+
+    const auto& crash = fom->getInteractionClass(2);
+    EXPECT_EQ(certi::TIMESTAMP, crash.order);
+    EXPECT_EQ(certi::BEST_EFFORT, crash.transport);
+    EXPECT_EQ(1u, crash.space);
+    EXPECT_TRUE(fom->hasParameter(2, 1));
+    EXPECT_FALSE(fom->hasParameter(1, 1));
+}
+
+TEST_F(CompiledFomTest, AddingClassesCompilesAgain)
+{
+    auto before = root.getCompiledFom();
+    EXPECT_EQ(before, root.getCompiledFom());
+
+    auto truck = new ObjectClass("Truck", 5);
+    root.addObjectClass(truck, root.getObjectClass(2));
+
+    auto after = root.getCompiledFom();
+    EXPECT_NE(before, after);
+    EXPECT_EQ(nullptr, before->findObjectClass(5));
+    ASSERT_NE(nullptr, after->findObjectClass(5));
+    EXPECT_TRUE(after->hasAttribute(5, 2));
+}
+
+TEST_F(CompiledFomTest, ClassesLookUpTheCompiledFom)
+{
+    auto car = root.getObjectClass(4);
+    auto plate = car->getAttribute(3);
+
+    auto fom = root.getCompiledFom();
+    EXPECT_EQ(plate, car->getAttribute(3));
+    EXPECT_EQ(plate, fom->getObjectClass(4).definitions[3]);
+    EXPECT_TRUE(car->hasAttribute(2));
+    EXPECT_FALSE(car->hasAttribute(9));
+    EXPECT_THROW(car->getAttribute(9), certi::AttributeNotDefined);
+    EXPECT_TRUE(root.getInteractionClass(2)->hasParameter(1));
+    EXPECT_FALSE(root.getInteractionClass(1)->hasParameter(1));
+
+    // the class stops using the compiled FOM it is no longer described by
+    car->addAttribute(attribute("color", 9, certi::RECEIVE));
+    EXPECT_TRUE(car->hasAttribute(9));
+    EXPECT_FALSE(fom->hasAttribute(4, 9));
+
+    root.refreshCompiledFom();
+    EXPECT_TRUE(root.getCompiledFom()->hasAttribute(4, 9));
+    EXPECT_EQ(car->getAttribute(9), root.getCompiledFom()->getObjectClass(4).definitions[9]);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "libCERTI/Exception.hh"
+#include "libCERTI/FrameBuffer.hh"
+#include "libCERTI/NM_Classes.hh"
+
+using ::certi::FrameBuffer;
+using ::certi::NetworkMessage;
+using ::certi::NM_Create_Federation_Execution;
+
+namespace {
+std::vector<uint8_t> frame(const std::string& federation_name)
+{
+    NM_Create_Federation_Execution message;
+    message.setFederation(3);
+    message.setFederationExecutionName(federation_name);
+
+    libhla::MessageBuffer buffer;
+    message.serialize(buffer);
+    buffer.updateReservedBytes();
+
+    auto bytes = static_cast<uint8_t*>(buffer(0));
+    return {bytes, bytes + buffer.size()};
+}
+
+std::string federationName(const NetworkMessage& message)
+{
+    EXPECT_EQ(NetworkMessage::Type::CREATE_FEDERATION_EXECUTION, message.getMessageType());
+    return static_cast<const NM_Create_Federation_Execution&>(message).getFederationExecutionName();
+}
+}
+
+TEST(FrameBufferTest, EmptyBufferHasNoMessage)
+{
+    FrameBuffer buffer;
+
+    EXPECT_FALSE(buffer.hasMessage());
+    EXPECT_EQ(nullptr, buffer.takeMessage().get());
+    EXPECT_EQ(0u, buffer.size());
+}
+
+TEST(FrameBufferTest, MessageIsTakenOnceComplete)
+{
+    const auto bytes = frame("first");
+    FrameBuffer buffer;
+
+    // one byte at a time, the reserved bytes included
+    for (size_t i = 0; i + 1 < bytes.size(); ++i) {
+        buffer.append(&bytes[i], 1);
+        ASSERT_FALSE(buffer.hasMessage());
+    }
+    buffer.append(&bytes.back(), 1);
+    ASSERT_TRUE(buffer.hasMessage());
+
+    auto message = buffer.takeMessage();
+    ASSERT_NE(nullptr, message.get());
+    EXPECT_EQ("first", federationName(*message));
+    EXPECT_EQ(3u, message->getFederation());
+    EXPECT_EQ(0u, buffer.size());
+}
+
+TEST(FrameBufferTest, MessagesAreTakenInOrderAcrossAppends)
+{
+    auto bytes = frame("first");
+    const auto second = frame("second, longer");
+    const auto third = frame("third");
+    bytes.insert(end(bytes), begin(second), end(second));
+    bytes.insert(end(bytes), begin(third), end(third));
+
+    FrameBuffer buffer;
+    // the second message is split between the two appends
+    const size_t split = bytes.size() - third.size() - 4;
+    buffer.append(bytes.data(), split);
+
+    auto message = buffer.takeMessage();
+    ASSERT_NE(nullptr, message.get());
+    EXPECT_EQ("first", federationName(*message));
+    EXPECT_FALSE(buffer.hasMessage());
+
+    buffer.append(bytes.data() + split, bytes.size() - split);
+    message = buffer.takeMessage();
+    ASSERT_NE(nullptr, message.get());
+    EXPECT_EQ("second, longer", federationName(*message));
+    message = buffer.takeMessage();
+    ASSERT_NE(nullptr, message.get());
+    EXPECT_EQ("third", federationName(*message));
+    EXPECT_EQ(nullptr, buffer.takeMessage().get());
+}
+
+TEST(FrameBufferTest, SizeSmallerThanReservedBytesIsInvalid)
+{
+    const uint8_t header[] = {0x01, 0, 0, 0, 2};
+    FrameBuffer buffer;
+    buffer.append(header, sizeof(header));
+
+    EXPECT_THROW(buffer.takeMessage(), certi::NetworkError);
+}
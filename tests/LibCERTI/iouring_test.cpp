@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "libCERTI/IoUring.hh"
+
+using ::certi::IoUring;
+
+namespace {
+class IoUringTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        ring = IoUring::create(8, 4, 64);
+        if (!ring) {
+            GTEST_SKIP() << "io_uring is not provided by this kernel";
+        }
+        ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, sockets));
+    }
+
+    void TearDown() override
+    {
+        if (ring) {
+            ring.reset();
+            close(sockets[0]);
+            close(sockets[1]);
+        }
+    }
+
+    /// Completions reaped once one at least is there, none after 5 s.
+    std::vector<IoUring::Completion> waitCompletions(std::string* received = nullptr)
+    {
+        std::vector<IoUring::Completion> completions;
+        for (int attempt = 0; completions.empty() && attempt < 5; ++attempt) {
+            EXPECT_TRUE(ring->wait(1000));
+            ring->reap([&completions, received](const IoUring::Completion& completion) {
+                if (received && completion.bytes) {
+                    received->append(reinterpret_cast<const char*>(completion.bytes), completion.result);
+                }
+                completions.push_back(completion);
+            });
+        }
+        return completions;
+    }
+
+    std::unique_ptr<IoUring> ring{};
+    int sockets[2]{-1, -1};
+};
+}
+
+TEST_F(IoUringTest, ReceiveGoesOnAcrossCompletions)
+{
+    ring->receive(sockets[0], 42);
+    ring->submit();
+
+    std::string received;
+    for (const auto& chunk : {"first", "second"}) {
+        ASSERT_EQ(static_cast<ssize_t>(strlen(chunk)), write(sockets[1], chunk, strlen(chunk)));
+        auto completions = waitCompletions(&received);
+        ASSERT_EQ(1u, completions.size());
+        EXPECT_EQ(42u, completions[0].data);
+        EXPECT_TRUE(completions[0].more);
+    }
+    EXPECT_EQ("firstsecond", received);
+}
+
+TEST_F(IoUringTest, BuffersAreGivenBack)
+{
+    ring->receive(sockets[0], 1);
+    ring->submit();
+
+    // more chunks than buffers, each read before the next one is written
+    std::string received;
+    for (int i = 0; i < 10; ++i) {
+        const std::string chunk(64, static_cast<char>('a' + i));
+        ASSERT_EQ(64, write(sockets[1], chunk.data(), chunk.size()));
+        for (const auto& completion : waitCompletions(&received)) {
+            if (!completion.more) {
+                ring->receive(sockets[0], 1);
+            }
+        }
+    }
+    EXPECT_EQ(640u, received.size());
+    EXPECT_EQ(std::string(64, 'j'), received.substr(576));
+}
+
+TEST_F(IoUringTest, ReceiveEndsWithConnection)
+{
+    ring->receive(sockets[0], 7);
+    ring->submit();
+    shutdown(sockets[1], SHUT_WR);
+
+    auto completions = waitCompletions();
+    ASSERT_EQ(1u, completions.size());
+    EXPECT_EQ(0, completions[0].result);
+    EXPECT_FALSE(completions[0].more);
+}
+
+TEST_F(IoUringTest, SendCompletesWithItsSize)
+{
+    const std::string message{"hello"};
+    ring->send(sockets[0], message.data(), message.size(), 3);
+
+    auto completions = waitCompletions();
+    ASSERT_EQ(1u, completions.size());
+    EXPECT_EQ(3u, completions[0].data);
+    EXPECT_EQ(5, completions[0].result);
+    EXPECT_EQ(nullptr, completions[0].bytes);
+
+    char read_back[5];
+    ASSERT_EQ(5, read(sockets[1], read_back, sizeof(read_back)));
+    EXPECT_EQ(message, std::string(read_back, sizeof(read_back)));
+}
+
+TEST_F(IoUringTest, CancelledReceiveCompletesOnce)
+{
+    ring->receive(sockets[0], 9);
+    ring->submit();
+    ring->cancel(9);
+
+    auto completions = waitCompletions();
+    ASSERT_EQ(1u, completions.size());
+    EXPECT_EQ(9u, completions[0].data);
+    EXPECT_EQ(-ECANCELED, completions[0].result);
+}
+
+TEST_F(IoUringTest, AcceptGoesOnAcrossConnections)
+{
+    const int server = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    ASSERT_EQ(0, bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+    ASSERT_EQ(0, listen(server, 4));
+    ASSERT_EQ(0, getsockname(server, reinterpret_cast<sockaddr*>(&address), &length));
+
+    ring->accept(server, 5);
+    ring->submit();
+
+    for (int i = 0; i < 2; ++i) {
+        const int client = socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_EQ(0, connect(client, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+
+        auto completions = waitCompletions();
+        ASSERT_EQ(1u, completions.size());
+        EXPECT_EQ(5u, completions[0].data);
+        EXPECT_LE(0, completions[0].result);
+        EXPECT_TRUE(completions[0].more);
+        close(completions[0].result);
+        close(client);
+    }
+    close(server);
+}
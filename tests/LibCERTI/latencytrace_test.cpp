@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "libCERTI/LatencyTrace.hh"
+
+using ::certi::LatencyBreakdown;
+using ::certi::LatencyTrace;
+using ::certi::TraceFileHeader;
+using ::certi::TraceSpan;
+
+namespace {
+static constexpr auto trace_file_name = "latencytrace_test.trace";
+
+std::vector<TraceSpan> readSpans(const std::string& file_name)
+{
+    std::vector<TraceSpan> spans;
+
+    std::ifstream input(file_name, std::ios::binary);
+    TraceFileHeader header;
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    EXPECT_TRUE(header.isValid());
+
+    TraceSpan span;
+    while (input.read(reinterpret_cast<char*>(&span), sizeof(span))) {
+        spans.push_back(span);
+    }
+    return spans;
+}
+
+TraceSpan span(const uint64_t trace, const TraceSpan::Hop hop, const uint64_t date, const uint32_t federate = 0)
+{
+    return {trace, date, federate, hop, {0, 0, 0}};
+}
+
+LatencyBreakdown::Segment segment(const TraceSpan::Hop from, const TraceSpan::Hop to)
+{
+    return {from, to};
+}
+}
+
+TEST(LatencyTraceTest, NothingIsTracedWithoutDirectory)
+{
+    LatencyTrace trace{"", trace_file_name, 1};
+
+    EXPECT_FALSE(trace.isEnabled());
+    EXPECT_EQ(0u, trace.sample());
+}
+
+TEST(LatencyTraceTest, OneUpdateInRateIsSampled)
+{
+    std::remove(trace_file_name);
+    LatencyTrace trace{".", trace_file_name, 4};
+    ASSERT_TRUE(trace.isEnabled());
+
+    std::set<uint64_t> ids;
+    for (int i = 0; i < 40; ++i) {
+        if (auto id = trace.sample()) {
+            ids.insert(id);
+        }
+    }
+    EXPECT_EQ(10u, ids.size());
+    std::remove(trace_file_name);
+}
+
+TEST(LatencyTraceTest, SpansAreWrittenAfterTheHeader)
+{
+    std::remove(trace_file_name);
+    uint64_t id{0};
+    {
+        LatencyTrace trace{".", trace_file_name, 1};
+        id = trace.sample();
+        trace.stamp(id, TraceSpan::Hop::RTIA_SEND, 3);
+        trace.stamp(0, TraceSpan::Hop::RTIG_RECEIVE);
+        trace.stamp(id, TraceSpan::Hop::RTIG_RECEIVE);
+    }
+
+    auto spans = readSpans(trace_file_name);
+    ASSERT_EQ(2u, spans.size());
+    EXPECT_EQ(id, spans[0].trace);
+    EXPECT_EQ(TraceSpan::Hop::RTIA_SEND, spans[0].hop);
+    EXPECT_EQ(3u, spans[0].federate);
+    EXPECT_EQ(TraceSpan::Hop::RTIG_RECEIVE, spans[1].hop);
+    EXPECT_LE(spans[0].date, spans[1].date);
+    std::remove(trace_file_name);
+}
+
+TEST(LatencyBreakdownTest, SenderHopsAreCountedOncePerTrace)
+{
+    LatencyBreakdown breakdown;
+    breakdown.add(span(1, TraceSpan::Hop::LIBRTI_SEND, 100, 1));
+    breakdown.add(span(1, TraceSpan::Hop::RTIA_SEND, 110, 1));
+    breakdown.add(span(1, TraceSpan::Hop::RTIG_RECEIVE, 150));
+    breakdown.add(span(1, TraceSpan::Hop::RTIG_SEND, 170));
+    for (uint32_t receiver = 2; receiver <= 3; ++receiver) {
+        breakdown.add(span(1, TraceSpan::Hop::RTIA_RECEIVE, 200 + receiver, receiver));
+        breakdown.add(span(1, TraceSpan::Hop::RTIA_ENQUEUE_FIFO, 210 + receiver, receiver));
+        breakdown.add(span(1, TraceSpan::Hop::LIBRTI_DELIVER, 300 + receiver, receiver));
+    }
+
+    auto segments = breakdown.segments();
+    ASSERT_EQ(6u, segments.size());
+    EXPECT_EQ(1u, segments[segment(TraceSpan::Hop::RTIA_SEND, TraceSpan::Hop::RTIG_RECEIVE)].count());
+    EXPECT_EQ(40u, segments[segment(TraceSpan::Hop::RTIA_SEND, TraceSpan::Hop::RTIG_RECEIVE)].max());
+    EXPECT_EQ(2u, segments[segment(TraceSpan::Hop::RTIG_SEND, TraceSpan::Hop::RTIA_RECEIVE)].count());
+    EXPECT_EQ(32u, segments[segment(TraceSpan::Hop::RTIG_SEND, TraceSpan::Hop::RTIA_RECEIVE)].min());
+    EXPECT_EQ(33u, segments[segment(TraceSpan::Hop::RTIG_SEND, TraceSpan::Hop::RTIA_RECEIVE)].max());
+
+    EXPECT_EQ(1u, breakdown.traces());
+    EXPECT_EQ(2u, breakdown.endToEnd().count());
+    EXPECT_EQ(203u, breakdown.endToEnd().max());
+}
+
+TEST(LatencyBreakdownTest, MissingHopsAreSkipped)
+{
+    LatencyBreakdown breakdown;
+    // sent peer to peer, with a receiver clock behind the sender one
+    breakdown.add(span(7, TraceSpan::Hop::RTIA_SEND, 500, 1));
+    breakdown.add(span(7, TraceSpan::Hop::RTIA_RECEIVE, 450, 2));
+    breakdown.add(span(7, TraceSpan::Hop::RTIA_ENQUEUE_TSO, 460, 2));
+
+    auto segments = breakdown.segments();
+    ASSERT_EQ(2u, segments.size());
+    EXPECT_EQ(0u, segments[segment(TraceSpan::Hop::RTIA_SEND, TraceSpan::Hop::RTIA_RECEIVE)].max());
+    EXPECT_EQ(10u, segments[segment(TraceSpan::Hop::RTIA_RECEIVE, TraceSpan::Hop::RTIA_ENQUEUE_TSO)].max());
+    EXPECT_EQ(0u, breakdown.endToEnd().count());
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+
+#include "libCERTI/LogLinearHistogram.hh"
+
+using ::certi::LogLinearHistogram;
+
+TEST(LogLinearHistogramTest, EmptyHistogramReportsZeros)
+{
+    LogLinearHistogram h;
+
+    EXPECT_EQ(0u, h.count());
+    EXPECT_EQ(0u, h.min());
+    EXPECT_EQ(0u, h.max());
+    EXPECT_EQ(0u, h.percentile(0.99));
+}
+
+TEST(LogLinearHistogramTest, SmallValuesAreExact)
+{
+    LogLinearHistogram h;
+    for (uint64_t i{0}; i < LogLinearHistogram::sub_bucket_count; ++i) {
+        h.record(i);
+    }
+
+    EXPECT_EQ(LogLinearHistogram::sub_bucket_count, h.count());
+    EXPECT_EQ(0u, h.min());
+    EXPECT_EQ(LogLinearHistogram::sub_bucket_count - 1, h.max());
+    EXPECT_EQ(LogLinearHistogram::sub_bucket_count / 2 - 1, h.percentile(0.5));
+}
+
+TEST(LogLinearHistogramTest, BucketBoundsContainValue)
+{
+    for (uint64_t value : {uint64_t{16}, uint64_t{17}, uint64_t{1000}, uint64_t{123456789}, UINT64_MAX}) {
+        auto index = LogLinearHistogram::bucketIndex(value);
+        ASSERT_LT(index, LogLinearHistogram::bucket_count);
+        EXPECT_GE(LogLinearHistogram::bucketUpperBound(index), value);
+        if (index > 0) {
+            EXPECT_LT(LogLinearHistogram::bucketUpperBound(index - 1), value);
+        }
+    }
+}
+
+TEST(LogLinearHistogramTest, PercentilesHaveBoundedRelativeError)
+{
+    LogLinearHistogram h;
+    for (uint64_t i{1}; i <= 100000; ++i) {
+        h.record(i);
+    }
+
+    auto p50 = h.percentile(0.5);
+    auto p99 = h.percentile(0.99);
+    auto p999 = h.percentile(0.999);
+
+    EXPECT_GE(p50, 50000u);
+    EXPECT_LE(p50, 50000u + 50000u / LogLinearHistogram::sub_bucket_count);
+    EXPECT_GE(p99, 99000u);
+    EXPECT_LE(p99, 99000u + 99000u / LogLinearHistogram::sub_bucket_count);
+    EXPECT_GE(p999, 99900u);
+    EXPECT_LE(p999, 100000u);
+    EXPECT_EQ(100000u, h.percentile(1.0));
+}
+
+TEST(LogLinearHistogramTest, ResetClearsEverything)
+{
+    LogLinearHistogram h;
+    h.record(42);
+    h.reset();
+
+    EXPECT_EQ(0u, h.count());
+    EXPECT_EQ(0u, h.sum());
+    EXPECT_EQ(0u, h.percentile(0.5));
+}
+
+TEST(LogLinearHistogramTest, MergeIsSameAsRecordingBoth)
+{
+    LogLinearHistogram a, b, both;
+    for (uint64_t i{1}; i <= 1000; ++i) {
+        (i % 2 ? a : b).record(i * 7);
+        both.record(i * 7);
+    }
+
+    a.merge(b);
+
+    EXPECT_EQ(both.count(), a.count());
+    EXPECT_EQ(both.min(), a.min());
+    EXPECT_EQ(both.max(), a.max());
+    EXPECT_EQ(both.sum(), a.sum());
+    EXPECT_EQ(both.percentile(0.5), a.percentile(0.5));
+    EXPECT_EQ(both.percentile(0.99), a.percentile(0.99));
+}
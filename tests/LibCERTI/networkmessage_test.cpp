@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include "libCERTI/LatencyTrace.hh"
+#include "libCERTI/NM_Classes.hh"
 #include "libCERTI/NetworkMessage.hh"
 
 #include <include/make_unique.hh>
@@ -29,3 +31,283 @@ TEST(NetworkMessageTest, CopyCtorInUniquePtrExistsAndWorks)
     ASSERT_EQ(msg.getFederate(), msg2->getFederate());
     ASSERT_EQ(msg.getFederation(), msg2->getFederation());
 }
+
+TEST(NetworkMessageTest, DiscoverObjectsRoundTrip)
+{
+    ::certi::NM_Discover_Objects msg;
+    msg.setFederate(2);
+    msg.setObjectClassesSize(2);
+    msg.setObjectsSize(2);
+    msg.setObjectNamesSize(2);
+    msg.setObjectClasses(3, 0);
+    msg.setObjects(10, 0);
+    msg.setObjectNames("first", 0);
+    msg.setObjectClasses(4, 1);
+    msg.setObjects(11, 1);
+    msg.setObjectNames("second", 1);
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Discover_Objects read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::DISCOVER_OBJECTS, read.getMessageType());
+    EXPECT_EQ(2u, read.getFederate());
+    EXPECT_EQ(msg.getObjectClasses(), read.getObjectClasses());
+    EXPECT_EQ(msg.getObjects(), read.getObjects());
+    EXPECT_EQ(msg.getObjectNames(), read.getObjectNames());
+}
+
+TEST(NetworkMessageTest, DDMModifyRegionsRoundTrip)
+{
+    ::certi::NM_DDM_Modify_Regions msg;
+    msg.setRegionsSize(2);
+    msg.setExtentCountsSize(2);
+    msg.setRangeCountsSize(2);
+    msg.setRegions(5, 0);
+    msg.setExtentCounts(1, 0);
+    msg.setRangeCounts(2, 0);
+    msg.setRegions(6, 1);
+    msg.setExtentCounts(0, 1);
+    msg.setRangeCounts(0, 1);
+    msg.setBoundsSize(4);
+    for (uint32_t i = 0; i < 4; ++i) {
+        msg.setBounds(100 + i, i);
+    }
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_DDM_Modify_Regions read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::DDM_MODIFY_REGIONS, read.getMessageType());
+    EXPECT_EQ(msg.getRegions(), read.getRegions());
+    EXPECT_EQ(msg.getExtentCounts(), read.getExtentCounts());
+    EXPECT_EQ(msg.getRangeCounts(), read.getRangeCounts());
+    EXPECT_EQ(msg.getBounds(), read.getBounds());
+}
+
+TEST(NetworkMessageTest, BatchUpdateAttributeValuesRoundTrip)
+{
+    ::certi::NM_Batch_Update_Attribute_Values msg;
+    msg.setFederate(2);
+    msg.setDate(::certi::FederationTime(4.0));
+    msg.setLabel("tag");
+    msg.setObjectsSize(2);
+    msg.setAttributeCountsSize(2);
+    msg.setObjects(10, 0);
+    msg.setAttributeCounts(1, 0);
+    msg.setObjects(11, 1);
+    msg.setAttributeCounts(2, 1);
+    msg.setAttributesSize(3);
+    msg.setValuesSize(3);
+    for (uint32_t i = 0; i < 3; ++i) {
+        msg.setAttributes(20 + i, i);
+        msg.setValues({static_cast<char>('a' + i)}, i);
+    }
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Batch_Update_Attribute_Values read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::BATCH_UPDATE_ATTRIBUTE_VALUES, read.getMessageType());
+    EXPECT_TRUE(read.isDated());
+    EXPECT_EQ(4.0, read.getDate().getTime());
+    EXPECT_EQ("tag", read.getLabel());
+    EXPECT_EQ(msg.getObjects(), read.getObjects());
+    EXPECT_EQ(msg.getAttributeCounts(), read.getAttributeCounts());
+    EXPECT_EQ(msg.getAttributes(), read.getAttributes());
+    EXPECT_EQ(msg.getValues(), read.getValues());
+    EXPECT_EQ(0u, read.getRawSizesSize());
+}
+
+TEST(NetworkMessageTest, PeerRouteRoundTrip)
+{
+    ::certi::NM_Peer_Route msg;
+    msg.setFederate(2);
+    msg.setInteractionClass(7);
+    msg.setRegion(3);
+    msg.setKeysSize(2);
+    msg.setKeys(5, 0);
+    msg.setKeys(4, 1);
+    msg.setClassesSize(1);
+    msg.setClasses(6, 0);
+    msg.setHandleCountsSize(1);
+    msg.setHandleCounts(1, 0);
+    msg.setHandlesSize(1);
+    msg.setHandles(4, 0);
+    msg.setEndpointCountsSize(1);
+    msg.setEndpointCounts(1, 0);
+    msg.setFederatesSize(1);
+    msg.setFederates(9, 0);
+    msg.setAddressesSize(1);
+    msg.setAddresses(0x0100007f, 0);
+    msg.setPortsSize(1);
+    msg.setPorts(4000, 0);
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Peer_Route read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::PEER_ROUTE, read.getMessageType());
+    EXPECT_EQ(0u, read.getObject());
+    EXPECT_EQ(7u, read.getInteractionClass());
+    EXPECT_EQ(3u, read.getRegion());
+    EXPECT_EQ(msg.getKeys(), read.getKeys());
+    EXPECT_EQ(msg.getClasses(), read.getClasses());
+    EXPECT_EQ(msg.getHandleCounts(), read.getHandleCounts());
+    EXPECT_EQ(msg.getHandles(), read.getHandles());
+    EXPECT_EQ(msg.getEndpointCounts(), read.getEndpointCounts());
+    EXPECT_EQ(msg.getFederates(), read.getFederates());
+    EXPECT_EQ(msg.getAddresses(), read.getAddresses());
+    EXPECT_EQ(msg.getPorts(), read.getPorts());
+}
+
+TEST(NetworkMessageTest, PeerFenceRoundTrip)
+{
+    ::certi::NM_Peer_Fence msg;
+    msg.setFederate(2);
+    msg.setEpoch(12);
+    msg.setClosing(true);
+    msg.setPeersSize(2);
+    msg.setPeers(4, 0);
+    msg.setPeers(7, 1);
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Peer_Fence read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::PEER_FENCE, read.getMessageType());
+    EXPECT_EQ(2u, read.getFederate());
+    EXPECT_EQ(12u, read.getEpoch());
+    EXPECT_TRUE(read.getClosing());
+    EXPECT_EQ(msg.getPeers(), read.getPeers());
+}
+
+TEST(NetworkMessageTest, RelayDataRoundTrip)
+{
+    ::certi::NM_Relay_Data msg;
+    msg.setChannelsSize(3);
+    msg.setChannels(4, 0);
+    msg.setChannels(1, 1);
+    msg.setChannels(9, 2);
+    msg.setPayload({'\x01', '\x00', '\x7f', 'a'});
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Relay_Data read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::RELAY_DATA, read.getMessageType());
+    EXPECT_EQ(msg.getChannels(), read.getChannels());
+    EXPECT_EQ(msg.getPayload(), read.getPayload());
+}
+
+TEST(NetworkMessageTest, TraceIdRoundTripsOnlyWhenSet)
+{
+    ::certi::NM_Reflect_Attribute_Values traced;
+    traced.setObject(10);
+    traced.setTraceId(0x123456789abcdefull);
+    ::certi::NM_Reflect_Attribute_Values untraced;
+    untraced.setObject(10);
+
+    libhla::MessageBuffer buffer;
+    traced.serialize(buffer);
+    const auto traced_size = buffer.size();
+    ::certi::NM_Reflect_Attribute_Values read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_TRUE(read.hasTraceId());
+    EXPECT_EQ(0x123456789abcdefull, read.getTraceId());
+    EXPECT_EQ(0x123456789abcdefull, ::certi::LatencyTrace::traceOf(read));
+
+    buffer.reset();
+    untraced.serialize(buffer);
+    EXPECT_EQ(traced_size - sizeof(uint64_t), buffer.size());
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_FALSE(read.hasTraceId());
+    EXPECT_EQ(0u, ::certi::LatencyTrace::traceOf(read));
+}
+
+TEST(NetworkMessageTest, EventRoundTripsWithDatedReflections)
+{
+    ::certi::NM_Reflect_Attribute_Values msg;
+    msg.setObject(10);
+    msg.setDate(4.5);
+    msg.setEvent(42);
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Reflect_Attribute_Values read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_TRUE(read.hasEvent());
+    EXPECT_EQ(42u, read.getEvent());
+    EXPECT_EQ(4.5, read.getDate().getTime());
+}
+
+TEST(NetworkMessageTest, RetractRoundTrip)
+{
+    ::certi::NM_Retract msg;
+    msg.setFederate(3);
+    msg.setEvent(17);
+    msg.setReceiversSize(2);
+    msg.setReceivers(1, 0);
+    msg.setReceivers(5, 1);
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Retract read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::RETRACT, read.getMessageType());
+    EXPECT_EQ(3u, read.getFederate());
+    EXPECT_EQ(17u, read.getEvent());
+    EXPECT_EQ(msg.getReceivers(), read.getReceivers());
+}
+
+TEST(NetworkMessageTest, RemoveObjectsRoundTrip)
+{
+    ::certi::NM_Remove_Objects msg;
+    msg.setFederate(2);
+    msg.setObjectClass(3);
+    msg.setObjectsSize(2);
+    msg.setObjects(10, 0);
+    msg.setObjects(11, 1);
+    msg.setLabel("Killed");
+
+    libhla::MessageBuffer buffer;
+    msg.serialize(buffer);
+
+    ::certi::NM_Remove_Objects read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ(NetworkMessage::Type::REMOVE_OBJECTS, read.getMessageType());
+    EXPECT_EQ(2u, read.getFederate());
+    EXPECT_EQ(3u, read.getObjectClass());
+    EXPECT_EQ(msg.getObjects(), read.getObjects());
+    EXPECT_EQ("Killed", read.getLabel());
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+
 #include <libCERTI/ObjectClassBroadcastList.hh>
 #include <libCERTI/SecurityServer.hh>
 
@@ -81,7 +84,6 @@ TEST(ObjectClassBroadcastListTest, CtorAcceptsNM_Remove_Object)
 
     ASSERT_EQ(message, l.getMsgRO());
     ASSERT_EQ(nullptr, l.getMsgDO());
-    ASSERT_EQ(nullptr, l.getMsgRAV());
     ASSERT_EQ(nullptr, l.getMsgRAOA());
     ASSERT_EQ(nullptr, l.getMsgAODN());
 }
@@ -93,21 +95,14 @@ TEST(ObjectClassBroadcastListTest, CtorAcceptsNM_Discover_Object)
 
     ASSERT_EQ(nullptr, l.getMsgRO());
     ASSERT_EQ(message, l.getMsgDO());
-    ASSERT_EQ(nullptr, l.getMsgRAV());
     ASSERT_EQ(nullptr, l.getMsgRAOA());
     ASSERT_EQ(nullptr, l.getMsgAODN());
 }
 
-TEST(ObjectClassBroadcastListTest, CtorAcceptsNM_Reflect_Attribute_Values)
+TEST(ObjectClassBroadcastListTest, CtorThrowsOnNM_Reflect_Attribute_Values)
 {
     auto message = new ::certi::NM_Reflect_Attribute_Values;
-    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message});
-
-    ASSERT_EQ(nullptr, l.getMsgRO());
-    ASSERT_EQ(nullptr, l.getMsgDO());
-    ASSERT_EQ(message, l.getMsgRAV());
-    ASSERT_EQ(nullptr, l.getMsgRAOA());
-    ASSERT_EQ(nullptr, l.getMsgAODN());
+    ASSERT_THROW(ObjectClassBroadcastList(std::unique_ptr<NetworkMessage>{message}), ::certi::RTIinternalError);
 }
 
 TEST(ObjectClassBroadcastListTest, CtorAcceptsNM_Request_Attribute_Ownership_Assumption)
@@ -117,7 +112,6 @@ TEST(ObjectClassBroadcastListTest, CtorAcceptsNM_Request_Attribute_Ownership_Ass
 
     ASSERT_EQ(nullptr, l.getMsgRO());
     ASSERT_EQ(nullptr, l.getMsgDO());
-    ASSERT_EQ(nullptr, l.getMsgRAV());
     ASSERT_EQ(message, l.getMsgRAOA());
     ASSERT_EQ(nullptr, l.getMsgAODN());
 }
@@ -129,7 +123,6 @@ TEST(ObjectClassBroadcastListTest, CtorAcceptsNM_Attribute_Ownership_Divestiture
 
     ASSERT_EQ(nullptr, l.getMsgRO());
     ASSERT_EQ(nullptr, l.getMsgDO());
-    ASSERT_EQ(nullptr, l.getMsgRAV());
     ASSERT_EQ(nullptr, l.getMsgRAOA());
     ASSERT_EQ(message, l.getMsgAODN());
 }
@@ -481,14 +474,14 @@ TEST(ObjectClassBroadcastListTest, PreparePendingDOMessageSendsBaseMessage)
     l.sendPendingMessage(ss);
 }*/
 
-TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageNoWaitingNothingSent)
+TEST(ObjectClassBroadcastListTest, PreparePendingRAOAMessageNoWaitingNothingSent)
 {
     ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
     ::certi::AuditFile a{"tmp"};
     MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
     EXPECT_CALL(ss, getSocketLink(_, _)).Times(0);
 
-    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    auto message = new ::certi::NM_Request_Attribute_Ownership_Assumption;
     message->setFederate(sender_handle);
     message->setAttributesSize(max_handle);
     ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
@@ -519,7 +512,7 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageNoWaitingNothingSent)
     l.sendPendingMessage(ss);
 }*/
 
-TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageOneSentPerFederateWaiting)
+TEST(ObjectClassBroadcastListTest, PreparePendingRAOAMessageOneSentPerFederateWaiting)
 {
     // Federate 1 and 3 will wait
     ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
@@ -529,7 +522,7 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageOneSentPerFederateWai
     EXPECT_CALL(ss, getSocketLink(federate2_handle, _)).Times(0);
     EXPECT_CALL(ss, getSocketLink(federate3_handle, _)).Times(1).WillOnce(::testing::ReturnNull());
 
-    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    auto message = new ::certi::NM_Request_Attribute_Ownership_Assumption;
     message->setFederate(sender_handle);
     message->setAttributesSize(max_handle);
     ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
@@ -565,14 +558,14 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageOneSentPerFederateWai
     ASSERT_EQ(ObjectBroadcastLine::State::Sent, line->stateFor(attr_handle));
 }*/
 
-TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageUpdatesState)
+TEST(ObjectClassBroadcastListTest, PreparePendingRAOAMessageUpdatesState)
 {
     ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
     ::certi::AuditFile a{"tmp"};
     MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
     EXPECT_CALL(ss, getSocketLink(federate_handle, _)).WillOnce(::testing::ReturnNull());
 
-    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    auto message = new ::certi::NM_Request_Attribute_Ownership_Assumption;
     message->setFederate(sender_handle);
     message->setAttributesSize(max_handle);
     ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
@@ -616,9 +609,9 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageUpdatesState)
     l.sendPendingMessage(ss);
 }*/
 
-TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageAllWaitingSendsBaseMessage)
+TEST(ObjectClassBroadcastListTest, PreparePendingRAOAMessageAllWaitingSendsBaseMessage)
 {
-    auto message = new ::certi::NM_Reflect_Attribute_Values;
+    auto message = new ::certi::NM_Request_Attribute_Ownership_Assumption;
     message->setFederate(sender_handle);
     message->setAttributesSize(max_handle);
 
@@ -670,32 +663,6 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageAllWaitingSendsBaseMe
     l.sendPendingMessage(ss);
 }*/
 
-TEST(ObjectClassBroadcastListTest, PreparePendingRAVMessageNotAllWaitingSendsSmallerMessage)
-{
-    auto message = new ::certi::NM_Reflect_Attribute_Values;
-    message->setFederate(sender_handle);
-    message->setAttributesSize(max_handle);
-
-    MessageBuffer mb;
-    message->serialize(mb);
-
-    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
-    ::certi::AuditFile a{"tmp"};
-    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
-    EXPECT_CALL(ss, getSocketLink(federate_handle, _)).WillOnce(::testing::ReturnNull());
-
-    ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, max_handle);
-
-    l.addFederate(federate_handle, attr_handle);
-
-    auto result = l.preparePendingMessage(ss);
-    
-    MessageBuffer mb2;
-    result.front().message()->serialize(mb2);
-    
-    ASSERT_LT(mb2.size(), mb.size());
-}
-
 /*TEST(ObjectClassBroadcastListTest, SendPendingRAOAMessageNotAllWaitingSendsSmallerMessage)
 {
     auto message = new ::certi::NM_Request_Attribute_Ownership_Assumption;
@@ -813,3 +780,82 @@ TEST(ObjectClassBroadcastListTest, PreparePendingRAOAMessageCatchesNetworkErrors
 
     ASSERT_NO_THROW(l.preparePendingMessage(ss));
 }
+
+TEST(ObjectBroadcastLineTest, StatesBeyondMaxHandleKeepInitialState)
+{
+    ObjectBroadcastLine line{42, ObjectBroadcastLine::State::Sent, 10};
+
+    ASSERT_EQ(ObjectBroadcastLine::State::Sent, line.stateFor(10));
+    ASSERT_EQ(ObjectBroadcastLine::State::Sent, line.stateFor(1000));
+
+    line.setState(200, ObjectBroadcastLine::State::Waiting);
+    EXPECT_EQ(ObjectBroadcastLine::State::Waiting, line.stateFor(200));
+    EXPECT_EQ(ObjectBroadcastLine::State::Sent, line.stateFor(199));
+    EXPECT_EQ(ObjectBroadcastLine::State::Sent, line.stateFor(201));
+}
+
+TEST(ObjectBroadcastLineTest, WordWiseTestsRespectMaxHandle)
+{
+    ObjectBroadcastLine line{42, ObjectBroadcastLine::State::NotSub, 130};
+    line.setState(0, ObjectBroadcastLine::State::Waiting);
+    EXPECT_FALSE(line.isWaitingAny(130)) << "attribute 0 is not an attribute";
+
+    line.setState(64, ObjectBroadcastLine::State::Waiting);
+    line.setState(129, ObjectBroadcastLine::State::Waiting);
+    EXPECT_FALSE(line.isWaitingAny(63));
+    EXPECT_TRUE(line.isWaitingAny(64));
+
+    EXPECT_TRUE(line.isWaitingAll(ObjectBroadcastLine::maskOf({64, 129})));
+    EXPECT_FALSE(line.isWaitingAll(ObjectBroadcastLine::maskOf({64, 128})));
+    EXPECT_FALSE(line.isWaitingAll(ObjectBroadcastLine::maskOf({64, 500})));
+
+    line.setWaitingSent(100);
+    EXPECT_EQ(ObjectBroadcastLine::State::Waiting, line.stateFor(0));
+    EXPECT_EQ(ObjectBroadcastLine::State::Sent, line.stateFor(64));
+    EXPECT_EQ(ObjectBroadcastLine::State::Waiting, line.stateFor(129));
+    EXPECT_EQ(ObjectBroadcastLine::State::NotSub, line.stateFor(65));
+}
+
+TEST(ObjectClassBroadcastListBenchmark, PreparePendingRAOAMessageOnWideClass)
+{
+    static constexpr ::certi::AttributeHandle wide_handle{512};
+    static constexpr ::certi::FederateHandle subscribers{32};
+    static constexpr int updates{50};
+
+    ::certi::SocketServer s{new certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+    MockSecurityServer ss(s, a, ::certi::FederationHandle(3));
+    EXPECT_CALL(ss, getSocketLink(_, _)).WillRepeatedly(::testing::ReturnNull());
+
+    std::chrono::nanoseconds elapsed{0};
+    for (int update = 0; update < updates; ++update) {
+        auto message = new ::certi::NM_Request_Attribute_Ownership_Assumption;
+        message->setFederate(sender_handle);
+        message->setAttributesSize(wide_handle);
+        for (::certi::AttributeHandle i = 0; i < wide_handle; ++i) {
+            message->setAttributes(i + 1, i);
+        }
+        ObjectClassBroadcastList l(std::unique_ptr<NetworkMessage>{message}, wide_handle);
+
+        auto start = std::chrono::steady_clock::now();
+
+        // federate f subscribes to one attribute out of f, half of them get the whole update
+        for (::certi::FederateHandle federate = 2; federate < subscribers + 2; ++federate) {
+            const auto step = federate % 2 ? 1 : federate;
+            for (::certi::AttributeHandle attribute = 1; attribute <= wide_handle; attribute += step) {
+                l.addFederate(federate, attribute);
+            }
+        }
+        auto responses = l.preparePendingMessage(ss);
+
+        elapsed += std::chrono::steady_clock::now() - start;
+
+        ASSERT_EQ(subscribers, responses.size());
+        for (auto& line : l.___TESTS_ONLY___lines()) {
+            ASSERT_FALSE(line.isWaitingAny(wide_handle));
+        }
+    }
+
+    std::cerr << "PreparePendingRAOAMessageOnWideClass: " << wide_handle << " attributes, " << subscribers
+              << " subscribers, " << elapsed.count() / updates << " ns per update" << std::endl;
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "libCERTI/NM_Classes.hh"
+#include "libCERTI/PeerRoutes.hh"
+
+using ::certi::NetworkMessage;
+using ::certi::NM_Peer_Route;
+using ::certi::PeerRoutes;
+
+namespace {
+NM_Peer_Route updateRoute(const ::certi::ObjectHandle object,
+                          const std::vector<uint32_t>& keys,
+                          const std::vector<PeerRoutes::Group>& groups)
+{
+    NM_Peer_Route message;
+    message.setObject(object);
+    message.setKeysSize(keys.size());
+    for (uint32_t i = 0; i < keys.size(); ++i) {
+        message.setKeys(keys[i], i);
+    }
+    for (const auto& group : groups) {
+        PeerRoutes::append(message, group);
+    }
+    return message;
+}
+}
+
+TEST(PeerRoutesTest, NoRouteIsHeldAtFirst)
+{
+    PeerRoutes routes;
+
+    EXPECT_EQ(nullptr, routes.find(1, {1, 2}));
+    EXPECT_EQ(nullptr, routes.find(1, 0, {1}));
+    EXPECT_EQ(0u, routes.size());
+}
+
+TEST(PeerRoutesTest, InstalledGroupsAreFoundBack)
+{
+    PeerRoutes routes;
+    routes.install(updateRoute(4, {1, 2}, {{0, {1, 2}, {{2, 10, 4000}, {3, 11, 4001}}}, {0, {2}, {{5, 12, 4002}}}}));
+
+    auto route = routes.find(4, {1, 2});
+    ASSERT_NE(nullptr, route);
+    ASSERT_EQ(2u, route->size());
+    EXPECT_EQ(std::vector<uint32_t>({1, 2}), route->at(0).handles);
+    ASSERT_EQ(2u, route->at(0).endpoints.size());
+    EXPECT_EQ(3u, route->at(0).endpoints[1].federate);
+    EXPECT_EQ(11u, route->at(0).endpoints[1].address);
+    EXPECT_EQ(4001u, route->at(0).endpoints[1].port);
+    EXPECT_EQ(std::vector<uint32_t>({2}), route->at(1).handles);
+    ASSERT_EQ(1u, route->at(1).endpoints.size());
+    EXPECT_EQ(5u, route->at(1).endpoints[0].federate);
+}
+
+TEST(PeerRoutesTest, KeysAreUnordered)
+{
+    PeerRoutes routes;
+    routes.install(updateRoute(4, {2, 1}, {}));
+
+    EXPECT_NE(nullptr, routes.find(4, {1, 2}));
+    EXPECT_NE(nullptr, routes.find(4, {2, 1}));
+    EXPECT_EQ(nullptr, routes.find(4, {1}));
+    EXPECT_EQ(nullptr, routes.find(5, {1, 2}));
+}
+
+TEST(PeerRoutesTest, InteractionRoutesAreKeyedByRegion)
+{
+    PeerRoutes routes;
+    NM_Peer_Route message;
+    message.setInteractionClass(3);
+    message.setRegion(2);
+    message.setKeysSize(1);
+    message.setKeys(1, 0);
+    PeerRoutes::append(message, {6, {1}, {{2, 10, 4000}}});
+    routes.install(message);
+
+    auto route = routes.find(3, 2, {1});
+    ASSERT_NE(nullptr, route);
+    EXPECT_EQ(6u, route->front().interactionClass);
+    EXPECT_EQ(nullptr, routes.find(3, 0, {1}));
+    EXPECT_EQ(nullptr, routes.find(3, {1}));
+}
+
+TEST(PeerRoutesTest, ClearForgetsEveryRoute)
+{
+    PeerRoutes routes;
+    routes.install(updateRoute(4, {1}, {}));
+    routes.install(updateRoute(5, {1}, {}));
+    EXPECT_EQ(2u, routes.size());
+
+    routes.clear();
+
+    EXPECT_EQ(0u, routes.size());
+    EXPECT_EQ(nullptr, routes.find(4, {1}));
+}
+
+TEST(PeerRoutesTest, OnlyDataAndTimeMessagesKeepRoutes)
+{
+    EXPECT_TRUE(PeerRoutes::keepsRoutes(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES));
+    EXPECT_TRUE(PeerRoutes::keepsRoutes(NetworkMessage::Type::SEND_INTERACTION));
+    EXPECT_TRUE(PeerRoutes::keepsRoutes(NetworkMessage::Type::MESSAGE_NULL));
+    EXPECT_TRUE(PeerRoutes::keepsRoutes(NetworkMessage::Type::TIME_ADVANCE_REQUEST));
+
+    EXPECT_FALSE(PeerRoutes::keepsRoutes(NetworkMessage::Type::SUBSCRIBE_OBJECT_CLASS));
+    EXPECT_FALSE(PeerRoutes::keepsRoutes(NetworkMessage::Type::UNPUBLISH_OBJECT_CLASS));
+    EXPECT_FALSE(PeerRoutes::keepsRoutes(NetworkMessage::Type::DELETE_OBJECT));
+    EXPECT_FALSE(PeerRoutes::keepsRoutes(NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_DIVESTITURE_NOTIFICATION));
+    EXPECT_FALSE(PeerRoutes::keepsRoutes(NetworkMessage::Type::DDM_MODIFY_REGION));
+    EXPECT_FALSE(PeerRoutes::keepsRoutes(NetworkMessage::Type::RESIGN_FEDERATION_EXECUTION));
+
+    // the peer network protocol itself
+    EXPECT_TRUE(PeerRoutes::keepsRoutes(NetworkMessage::Type::PEER_ROUTES_INVALIDATED));
+    EXPECT_TRUE(PeerRoutes::keepsRoutes(NetworkMessage::Type::PEER_FENCE));
+}
+
+TEST(PeerRoutesTest, MessagesOtherThanTimeProgressFencePeerLinks)
+{
+    EXPECT_TRUE(PeerRoutes::fencesPeers(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES));
+    EXPECT_TRUE(PeerRoutes::fencesPeers(NetworkMessage::Type::SEND_INTERACTION));
+    EXPECT_TRUE(PeerRoutes::fencesPeers(NetworkMessage::Type::DELETE_OBJECT));
+    EXPECT_TRUE(PeerRoutes::fencesPeers(NetworkMessage::Type::ATTRIBUTE_OWNERSHIP_DIVESTITURE_NOTIFICATION));
+
+    EXPECT_FALSE(PeerRoutes::fencesPeers(NetworkMessage::Type::MESSAGE_NULL));
+    EXPECT_FALSE(PeerRoutes::fencesPeers(NetworkMessage::Type::TIME_ADVANCE_REQUEST));
+    EXPECT_FALSE(PeerRoutes::fencesPeers(NetworkMessage::Type::NEXT_MESSAGE_REQUEST));
+    EXPECT_FALSE(PeerRoutes::fencesPeers(NetworkMessage::Type::PEER_FENCE));
+}
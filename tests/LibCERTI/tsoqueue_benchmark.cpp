@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "libCERTI/NM_Classes.hh"
+#include "libCERTI/TsoQueue.hh"
+
+#define PENDING_EVENTS 100000
+
+TEST(TsoQueueBenchmark, retractAmongPendingEvents)
+{
+    certi::TsoQueue queue;
+    for (certi::EventRetractionHandle event = 1; event <= PENDING_EVENTS; ++event) {
+        auto msg = new certi::NM_Reflect_Attribute_Values;
+        msg->setFederate(1 + event % 4);
+        msg->setDate(event);
+        msg->setEvent(event);
+        queue.insert(msg);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    size_t retracted{0};
+    for (certi::EventRetractionHandle event = 2; event <= PENDING_EVENTS; event += 2) {
+        auto msg = queue.retract(1 + event % 4, event);
+        ASSERT_NE(nullptr, msg) << ", no" << event;
+        delete msg;
+        ++retracted;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(PENDING_EVENTS - retracted, queue.size());
+    while (auto msg = queue.pop()) {
+        delete msg;
+    }
+
+    std::cerr << "retractAmongPendingEvents: " << retracted << " retractions among " << PENDING_EVENTS
+              << " pending events in " << (end - start).count() << " ns, "
+              << (end - start).count() / retracted << " ns each" << std::endl;
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "libCERTI/NM_Classes.hh"
+#include "libCERTI/TsoQueue.hh"
+
+using ::certi::NetworkMessage;
+using ::certi::NM_Message_Null;
+using ::certi::NM_Receive_Interaction;
+using ::certi::NM_Reflect_Attribute_Values;
+using ::certi::TsoQueue;
+
+namespace {
+NetworkMessage* reflection(const certi::FederateHandle federate, const double date, const certi::EventRetractionHandle event = 0)
+{
+    auto msg = new NM_Reflect_Attribute_Values;
+    msg->setFederate(federate);
+    msg->setDate(date);
+    if (event != 0) {
+        msg->setEvent(event);
+    }
+    return msg;
+}
+
+NetworkMessage* interaction(const certi::FederateHandle federate, const double date, const certi::EventRetractionHandle event)
+{
+    auto msg = new NM_Receive_Interaction;
+    msg->setFederate(federate);
+    msg->setDate(date);
+    msg->setEvent(event);
+    return msg;
+}
+
+void drain(TsoQueue& queue)
+{
+    while (auto msg = queue.pop()) {
+        delete msg;
+    }
+}
+}
+
+TEST(TsoQueueTest, EarliestComesFirst)
+{
+    TsoQueue queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(nullptr, queue.pop());
+
+    auto late = reflection(1, 3.0);
+    auto early = reflection(1, 1.0);
+    auto middle = reflection(2, 2.0);
+    queue.insert(late);
+    queue.insert(early);
+    queue.insert(middle);
+
+    EXPECT_EQ(3u, queue.size());
+    EXPECT_EQ(early, queue.front());
+    EXPECT_EQ(early, queue.pop());
+    EXPECT_EQ(middle, queue.pop());
+    EXPECT_EQ(late, queue.pop());
+    EXPECT_TRUE(queue.empty());
+
+    delete late;
+    delete early;
+    delete middle;
+}
+
+TEST(TsoQueueTest, SameDateKeepsArrivalOrder)
+{
+    TsoQueue queue;
+    auto first = reflection(1, 2.0);
+    auto second = reflection(2, 2.0);
+    auto earlier = reflection(3, 1.0);
+    auto third = reflection(1, 2.0);
+    queue.insert(first);
+    queue.insert(second);
+    queue.insert(earlier);
+    queue.insert(third);
+
+    EXPECT_EQ(earlier, queue.pop());
+    EXPECT_EQ(first, queue.pop());
+    EXPECT_EQ(second, queue.pop());
+    EXPECT_EQ(third, queue.pop());
+
+    delete first;
+    delete second;
+    delete earlier;
+    delete third;
+}
+
+TEST(TsoQueueTest, EventOfRetractableMessages)
+{
+    std::unique_ptr<NetworkMessage> plain{reflection(1, 1.0)};
+    std::unique_ptr<NetworkMessage> retractable{reflection(1, 1.0, 7)};
+    std::unique_ptr<NetworkMessage> received{interaction(1, 1.0, 8)};
+    NM_Message_Null null;
+
+    EXPECT_EQ(0u, TsoQueue::eventOf(*plain));
+    EXPECT_EQ(7u, TsoQueue::eventOf(*retractable));
+    EXPECT_EQ(8u, TsoQueue::eventOf(*received));
+    EXPECT_EQ(0u, TsoQueue::eventOf(null));
+}
+
+TEST(TsoQueueTest, RetractRemovesTheEventOfTheSender)
+{
+    TsoQueue queue;
+    auto kept = reflection(1, 1.0, 5);
+    auto retracted = interaction(2, 2.0, 5);
+    auto last = reflection(1, 3.0, 6);
+    queue.insert(kept);
+    queue.insert(retracted);
+    queue.insert(last);
+
+    EXPECT_EQ(nullptr, queue.retract(3, 5));
+    EXPECT_EQ(nullptr, queue.retract(2, 6));
+    EXPECT_EQ(retracted, queue.retract(2, 5));
+    EXPECT_EQ(nullptr, queue.retract(2, 5));
+    delete retracted;
+
+    EXPECT_EQ(2u, queue.size());
+    EXPECT_EQ(kept, queue.pop());
+    EXPECT_EQ(last, queue.pop());
+    delete kept;
+    delete last;
+}
+
+TEST(TsoQueueTest, DeliveredEventsCannotBeRetracted)
+{
+    TsoQueue queue;
+    auto msg = reflection(1, 1.0, 5);
+    queue.insert(msg);
+
+    EXPECT_EQ(msg, queue.pop());
+    EXPECT_EQ(nullptr, queue.retract(1, 5));
+    delete msg;
+
+    queue.insert(reflection(1, 2.0, 9));
+    drain(queue);
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "libCERTI/Exception.hh"
+#include "libCERTI/NM_Classes.hh"
+#include "libCERTI/ValueCompression.hh"
+
+using ::certi::NM_Update_Attribute_Values;
+using ::certi::ValueCompression;
+
+namespace {
+NM_Update_Attribute_Values update(const std::vector<std::string>& values)
+{
+    NM_Update_Attribute_Values message;
+    message.setAttributesSize(values.size());
+    message.setValuesSize(values.size());
+    for (uint32_t i = 0; i < values.size(); ++i) {
+        message.setAttributes(10 + i, i);
+        message.setValues({values[i].begin(), values[i].end()}, i);
+    }
+    return message;
+}
+
+std::string valueOf(const NM_Update_Attribute_Values& message, const uint32_t rank)
+{
+    return {message.getValues(rank).begin(), message.getValues(rank).end()};
+}
+}
+
+TEST(ValueCompressionTest, NoThresholdLeavesValuesAlone)
+{
+    ValueCompression compression;
+    auto message = update({std::string(4096, 'a')});
+
+    compression.compress(message);
+
+    EXPECT_EQ(0u, message.getRawSizesSize());
+    EXPECT_EQ(4096u, message.getValues(0).size());
+    EXPECT_EQ(0u, compression.statistics().compressed);
+}
+
+TEST(ValueCompressionTest, LargeValuesRoundTrip)
+{
+    if (!ValueCompression::isAvailable()) {
+        return;
+    }
+
+    ValueCompression sender(64);
+    const std::string large(4096, 'a');
+    auto message = update({"small", large});
+
+    sender.compress(message);
+
+    ASSERT_EQ(2u, message.getRawSizesSize());
+    EXPECT_EQ(0u, message.getRawSizes(0));
+    EXPECT_EQ(4096u, message.getRawSizes(1));
+    EXPECT_EQ("small", valueOf(message, 0));
+    EXPECT_GT(4096u, message.getValues(1).size());
+
+    EXPECT_EQ(1u, sender.statistics().compressed);
+    EXPECT_EQ(4096u, sender.statistics().raw_bytes);
+    EXPECT_EQ(message.getValues(1).size(), sender.statistics().compressed_bytes);
+    EXPECT_GT(1.0, sender.statistics().ratio());
+
+    libhla::MessageBuffer buffer;
+    message.serialize(buffer);
+    NM_Update_Attribute_Values received;
+    buffer.assumeSize(buffer.size());
+    received.deserialize(buffer);
+
+    ValueCompression receiver;
+    receiver.decompress(received);
+
+    EXPECT_EQ(0u, received.getRawSizesSize());
+    EXPECT_EQ("small", valueOf(received, 0));
+    EXPECT_EQ(large, valueOf(received, 1));
+    EXPECT_EQ(1u, receiver.statistics().decompressed);
+}
+
+TEST(ValueCompressionTest, IncompressibleValueIsSentAsIs)
+{
+    if (!ValueCompression::isAvailable()) {
+        return;
+    }
+
+    ValueCompression compression(8);
+    std::string noise;
+    uint32_t state{12345};
+    for (int i = 0; i < 256; ++i) {
+        state = state * 1103515245 + 12345;
+        noise.push_back(static_cast<char>(state >> 16));
+    }
+    auto message = update({noise});
+
+    compression.compress(message);
+
+    EXPECT_EQ(0u, message.getRawSizesSize());
+    EXPECT_EQ(noise, valueOf(message, 0));
+    EXPECT_EQ(1u, compression.statistics().incompressible);
+}
+
+TEST(ValueCompressionTest, CorruptedValueThrows)
+{
+    auto message = update({"not deflated"});
+    message.setRawSizesSize(1);
+    message.setRawSizes(100, 0);
+
+    ValueCompression compression;
+    EXPECT_THROW(compression.decompress(message), ::certi::RTIinternalError);
+}
@@ -0,0 +1,101 @@
+#ifdef BENCHMARK_HLA_VARIABLE_ARRAY
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <libHLA/HLAtypesIEEE1516.hh>
+
+using namespace libhla;
+
+namespace {
+using StringArray = HLAvariableArray<HLAASCIIstring>;
+
+static constexpr long array_size = 10000;
+
+// Encode the array by hand, as a received attribute value would be
+std::vector<char> encodeStrings(const long count)
+{
+    std::vector<char> result;
+    auto append_uint32 = [&result](const uint32_t value) {
+        for (int shift = 24; shift >= 0; shift -= 8) {
+            result.push_back(static_cast<char>((value >> shift) & 0xff));
+        }
+    };
+
+    append_uint32(count);
+    for (long i = 0; i < count; ++i) {
+        result.resize(result.size() + __padding(result.size(), StringArray::m_octetBoundary));
+        auto value = "string #" + std::to_string(i);
+        append_uint32(value.size());
+        result.insert(end(result), value.begin(), value.end());
+    }
+    return result;
+}
+}
+
+TEST(HLATypesBenchmark, decodeStringArray_iterator)
+{
+    auto encoded = encodeStrings(array_size);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    HLAdata<StringArray> data(encoded.data(), encoded.size());
+    size_t total = 0;
+    for (StringArray::iterator it = (*data).begin(); it != (*data).end(); ++it) {
+        total += std::string(*it).size();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(array_size, (*data).size());
+    ASSERT_LT(0u, total);
+
+    std::cerr << "decodeStringArray_iterator: " << (end - start).count() << " ns" << std::endl;
+}
+
+TEST(HLATypesBenchmark, decodeStringArray_index)
+{
+    auto encoded = encodeStrings(array_size);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    HLAdata<StringArray> data(encoded.data(), encoded.size());
+    StringArray::offset_index index = (*data).index();
+    size_t total = 0;
+    for (long i = 0; i < index.size(); ++i) {
+        total += std::string(index[i]).size();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(array_size, (*data).size());
+    ASSERT_EQ("string #9999", std::string(index[array_size - 1]));
+    ASSERT_LT(0u, total);
+
+    std::cerr << "decodeStringArray_index: " << (end - start).count() << " ns" << std::endl;
+}
+
+TEST(HLATypesBenchmark, decodeStringArray_walk)
+{
+    auto encoded = encodeStrings(array_size);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    HLAdata<StringArray> data(encoded.data(), encoded.size());
+    size_t total = 0;
+    for (long i = 0; i < (*data).size(); ++i) {
+        total += std::string((*data)[i]).size();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    ASSERT_EQ(array_size, (*data).size());
+    ASSERT_LT(0u, total);
+
+    std::cerr << "decodeStringArray_walk: " << (end - start).count() << " ns" << std::endl;
+}
+
+#endif
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <libHLA/HLAtypesIEEE1516.hh>
 
@@ -203,3 +207,296 @@ TEST(HLATypesTest, Test7)
 
     ASSERT_EQ("0000:  02\n", result.str());
 }
+
+TEST(HLATypesTest, StringArrayElementsAfterResize)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLAdata<TA> A;
+    (*A).set_size(3);
+    (*A)[0] = "a";
+    (*A)[1] = "bc";
+    (*A)[2] = "def";
+
+    ASSERT_EQ("a", std::string((*A)[0]));
+    ASSERT_EQ("bc", std::string((*A)[1]));
+    ASSERT_EQ("def", std::string((*A)[2]));
+
+    // growing an element moves all the following ones
+    (*A)[0] = "ghijkl";
+
+    ASSERT_EQ("ghijkl", std::string((*A)[0]));
+    ASSERT_EQ("bc", std::string((*A)[1]));
+    ASSERT_EQ("def", std::string((*A)[2]));
+
+    std::stringstream result;
+    A.print(result);
+
+    ASSERT_EQ("0000:  00 00 00 03 00 00 00 06 67 68 69 6a 6b 6c 00 00\n"
+              "0010:  00 00 00 02 62 63 00 00 00 00 00 03 64 65 66\n",
+              result.str());
+}
+
+TEST(HLATypesTest, StringArrayDecodedInPlace)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    char encoded[] = {0, 0, 0, 2, 0, 0, 0, 3, 'a', 'b', 'c', 0, 0, 0, 0, 5, 'd', 'e', 'f', 'g', 'h'};
+
+    HLAdata<TA> A(encoded, sizeof(encoded));
+    ASSERT_EQ(2, (*A).size());
+    ASSERT_EQ("abc", std::string((*A)[0]));
+    ASSERT_EQ("defgh", std::string((*A)[1]));
+
+    // the same buffer now holds a different layout, of the same array size
+    char other[] = {0, 0, 0, 2, 0, 0, 0, 7, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 0, 0, 0, 0, 1, 'h'};
+    memcpy(encoded, other, sizeof(other));
+
+    ASSERT_EQ("abcdefg", std::string((*A)[0]));
+    ASSERT_EQ("h", std::string((*A)[1]));
+    ASSERT_EQ("h", std::string((*A).index()[1]));
+}
+
+TEST(HLATypesTest, StringArrayIteratedInOrder)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLAdata<TA> A;
+    (*A).set_size(3);
+    (*A)[0] = "a";
+    (*A)[1] = "bcdef";
+    (*A)[2] = "gh";
+
+    std::vector<std::string> values;
+    for (TA::iterator it = (*A).begin(); it != (*A).end(); ++it) {
+        values.push_back(std::string(*it));
+    }
+    ASSERT_EQ(std::vector<std::string>({"a", "bcdef", "gh"}), values);
+
+    TA::offset_index index = (*A).index();
+    ASSERT_EQ(3, index.size());
+    ASSERT_EQ("gh", std::string(index[2]));
+    ASSERT_EQ("a", std::string(index[0]));
+    ASSERT_THROW(index[3], std::out_of_range);
+
+    // arrays of fixed-size elements are iterated the same way
+    using TB = HLAvariableArray<HLAfloat64BE>;
+    HLAdata<TB> B;
+    (*B).set_size(2);
+    (*B)[0] = 1.5;
+    (*B)[1] = 2.5;
+
+    double sum = 0;
+    for (TB::iterator it = (*B).begin(); it != (*B).end(); ++it) {
+        sum += *it;
+    }
+    ASSERT_EQ(4.0, sum);
+}
+
+TEST(HLATypesTest, StringArrayReadOnSeveralThreads)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLAdata<TA> A;
+    (*A).set_size(64);
+    for (long i = 0; i < 64; ++i) {
+        (*A)[i] = std::string(i % 7, 'a' + i % 26);
+    }
+
+    std::vector<std::thread> readers;
+    std::vector<char> succeeded(4, false);
+    for (size_t reader = 0; reader < succeeded.size(); ++reader) {
+        readers.emplace_back([&A, reader, &succeeded] {
+            bool ok = true;
+            for (int round = 0; round < 50; ++round) {
+                for (long i = 0; i < 64; ++i) {
+                    ok = ok && std::string((*A)[i]) == std::string(i % 7, 'a' + i % 26);
+                }
+                TA::offset_index index = (*A).index();
+                ok = ok && std::string(index[63]) == std::string(63 % 7, 'a' + 63 % 26);
+            }
+            succeeded[reader] = ok;
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_EQ(std::vector<char>(4, true), succeeded);
+}
+
+TEST(HLATypesTest, StringArraysEncodedOnWorkerThreads)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    std::vector<std::thread> workers;
+    std::vector<char> succeeded(4, false);
+    for (size_t worker = 0; worker < succeeded.size(); ++worker) {
+        workers.emplace_back([worker, &succeeded] {
+            bool ok = true;
+            for (int round = 0; round < 200; ++round) {
+                HLAdata<TA> A;
+                (*A).set_size(3);
+                (*A)[0] = "a";
+                (*A)[1] = std::to_string(worker);
+                (*A)[2] = "def";
+                // resizing looks up the buffer of the element
+                (*A)[0] = std::string(round % 16, 'x');
+
+                ok = ok && std::string((*A)[0]) == std::string(round % 16, 'x')
+                    && std::string((*A)[1]) == std::to_string(worker) && std::string((*A)[2]) == "def";
+            }
+            succeeded[worker] = ok;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ASSERT_EQ(std::vector<char>(4, true), succeeded);
+}
+
+TEST(HLATypesTest, BufferFoundAgainAfterNestedBufferIsDestroyed)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLAdata<TA> outer;
+    (*outer).set_size(2);
+    (*outer)[0] = std::string(32, 'a');
+    ASSERT_EQ(&outer, __HLAbuffer::__find_buffer(outer.mBegin + 20));
+    {
+        // user memory inside the buffer just found, holding an empty array
+        memset(outer.mBegin + 16, 0, 16);
+        HLAdata<TA> inner(outer.mBegin + 16, 16);
+        ASSERT_EQ(&inner, __HLAbuffer::__find_buffer(outer.mBegin + 20));
+    }
+    ASSERT_EQ(&outer, __HLAbuffer::__find_buffer(outer.mBegin + 20));
+    ASSERT_EQ(nullptr, __HLAbuffer::__find_buffer(&outer));
+}
+
+TEST(HLATypesTest, BufferFoundWhileOtherThreadsCreateBuffers)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLAdata<TA> mine;
+    (*mine).set_size(1);
+    (*mine)[0] = std::string(64, 'a');
+    ASSERT_EQ(&mine, __HLAbuffer::__find_buffer(mine.mBegin + 8));
+
+    std::thread other([] {
+        for (int round = 0; round < 200; ++round) {
+            HLAdata<TA> theirs;
+            __HLAbuffer::__find_buffer(theirs.mBegin);
+        }
+    });
+    for (int round = 0; round < 200; ++round) {
+        ASSERT_EQ(&mine, __HLAbuffer::__find_buffer(mine.mBegin + round % 64));
+    }
+    other.join();
+}
+
+TEST(HLATypesTest, PooledBufferStaysInPoolWhenResized)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLApool pool(1 << 16);
+    {
+        HLAdata<TA> A(pool);
+        ASSERT_EQ(&pool, A.mPool);
+
+        (*A).set_size(2);
+        (*A)[0] = "abc";
+        (*A)[1] = "defgh";
+
+        ASSERT_EQ(&pool, A.mPool);
+        ASSERT_EQ("abc", std::string((*A)[0]));
+        ASSERT_EQ("defgh", std::string((*A)[1]));
+    }
+}
+
+TEST(HLATypesTest, ExhaustedPoolFallsBackToCalloc)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLApool pool(1 << 14);
+    HLAdata<TA> A(pool);
+    (*A).set_size(1);
+    (*A)[0] = std::string(1 << 15, 'a');
+
+    ASSERT_EQ(nullptr, A.mPool);
+    ASSERT_EQ(std::string(1 << 15, 'a'), std::string((*A)[0]));
+}
+
+TEST(HLATypesTest, BufferOfEndedThreadIsFoundAndDestroyedElsewhere)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    std::unique_ptr<HLAdata<TA>> theirs;
+    std::thread other([&theirs] {
+        theirs.reset(new HLAdata<TA>);
+        (**theirs).set_size(1);
+        (**theirs)[0] = "abc";
+    });
+    other.join();
+
+    ASSERT_EQ(theirs.get(), __HLAbuffer::__find_buffer(theirs->mBegin + 4));
+    // resized on this thread, the buffer moves to this thread's registry
+    (**theirs)[0] = std::string(32, 'd');
+    ASSERT_EQ(std::string(32, 'd'), std::string((**theirs)[0]));
+    theirs.reset();
+}
+
+TEST(HLATypesTest, BufferNestedByOtherThreadIsFound)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLAdata<TA> outer;
+    (*outer).set_size(2);
+    (*outer)[0] = std::string(32, 'a');
+    ASSERT_EQ(&outer, __HLAbuffer::__find_buffer(outer.mBegin + 20));
+
+    memset(outer.mBegin + 16, 0, 16);
+    std::unique_ptr<HLAdata<TA>> inner;
+    std::thread other([&outer, &inner] { inner.reset(new HLAdata<TA>(outer.mBegin + 16, 16)); });
+    other.join();
+
+    ASSERT_EQ(inner.get(), __HLAbuffer::__find_buffer(outer.mBegin + 20));
+    inner.reset();
+    ASSERT_EQ(&outer, __HLAbuffer::__find_buffer(outer.mBegin + 20));
+}
+
+TEST(HLATypesTest, PoolSharedByThreads)
+{
+    using TA = HLAvariableArray<HLAASCIIstring>;
+
+    HLApool pool(1 << 16);
+    std::vector<std::unique_ptr<HLAdata<TA>>> kept(4);
+    std::vector<char> succeeded(4, false);
+    std::vector<std::thread> workers;
+    for (size_t worker = 0; worker < succeeded.size(); ++worker) {
+        workers.emplace_back([&pool, worker, &kept, &succeeded] {
+            bool ok = true;
+            for (int round = 0; round < 100; ++round) {
+                HLAdata<TA> A(pool);
+                (*A).set_size(2);
+                (*A)[0] = std::to_string(worker);
+                (*A)[1] = std::string(round % 16, 'x');
+                ok = ok && A.mPool == &pool && std::string((*A)[0]) == std::to_string(worker);
+            }
+            // released by the main thread
+            kept[worker].reset(new HLAdata<TA>(pool));
+            (**kept[worker]).set_size(1);
+            (**kept[worker])[0] = std::to_string(worker);
+            succeeded[worker] = ok && kept[worker]->mPool == &pool;
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    ASSERT_EQ(std::vector<char>(4, true), succeeded);
+    for (size_t worker = 0; worker < kept.size(); ++worker) {
+        ASSERT_EQ(std::to_string(worker), std::string((**kept[worker])[0]));
+    }
+    kept.clear();
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <libRTI/hla-1_3/RTItypesImp.hh>
+
+using ::certi::AttributeHandleValuePairSetImp;
+using ::certi::ParameterHandleValuePairSetImp;
+
+TEST(HandleValuePairSetTest, RefillReplacesThePairs)
+{
+    AttributeHandleValuePairSetImp set{0};
+    set.add(7, "old", 3);
+
+    set.resize(2);
+    set.set(0, 1, "a", 1);
+    set.set(1, 2, "bcd", 3);
+
+    ASSERT_EQ(2u, set.size());
+    EXPECT_EQ(1u, set.getHandle(0));
+    EXPECT_EQ(2u, set.getHandle(1));
+
+    RTI::ULong length{0};
+    char* value = set.getValuePointer(1, length);
+    EXPECT_EQ(3u, length);
+    EXPECT_EQ("bcd", std::string(value, length));
+}
+
+TEST(HandleValuePairSetTest, RefillKeepsTheStorageOfTheValues)
+{
+    ParameterHandleValuePairSetImp set{0};
+    set.resize(1);
+    set.set(0, 1, "first value", 11);
+
+    RTI::ULong length{0};
+    const char* storage = set.getValuePointer(0, length);
+
+    set.resize(1);
+    set.set(0, 2, "second", 6);
+
+    EXPECT_EQ(storage, set.getValuePointer(0, length));
+    EXPECT_EQ(6u, length);
+    EXPECT_EQ("second", std::string(storage, length));
+}
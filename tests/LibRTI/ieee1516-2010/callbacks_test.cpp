@@ -0,0 +1,295 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include <RTI/NullFederateAmbassador.h>
+
+#include "RTIambPrivateRefs.h"
+#include "RTIambassadorImplementation.h"
+
+#include "M_Classes.hh"
+#include "SocketUN.hh"
+
+namespace certi {
+
+/// Records the announced synchronization points, the HLA_IMMEDIATE callbacks of these tests.
+class RecordingFederate : public rti1516e::NullFederateAmbassador {
+public:
+    void announceSynchronizationPoint(std::wstring const& label, rti1516e::VariableLengthData const&) throw(
+        rti1516e::FederateInternalError) override
+    {
+        if (onAnnounce) {
+            onAnnounce(label);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        labels.push_back(label);
+        announced.notify_all();
+    }
+
+    bool waitAnnounced(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return announced.wait_for(lock, std::chrono::seconds(10), [&] { return labels.size() >= count; });
+    }
+
+    std::vector<std::wstring> announcedLabels()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return labels;
+    }
+
+    /// called from the callback, before the label is recorded
+    std::function<void(std::wstring const&)> onAnnounce;
+
+private:
+    std::mutex mutex;
+    std::condition_variable announced;
+    std::vector<std::wstring> labels;
+};
+
+/** The ambassador is linked to a socket pair, the test plays the RTIA on the other end.
+ *
+ * Reads of the RTIA end time out, so a library waiting for the wrong message
+ * fails the test instead of blocking it.
+ */
+class RTI1516ambassadorTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        // the lost link tests write to a closed socket
+        std::signal(SIGPIPE, SIG_IGN);
+
+        ambassador.reset(new RTI1516ambassador());
+        ambassador->p.reset(new RTI1516ambassador::Private);
+        ambassador->p->socket_un.reset(new SocketUN(stIgnoreSignal));
+
+        int fd = ambassador->p->socket_un->socketpair();
+        ASSERT_NE(-1, fd);
+        timeval timeout{10, 0};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        rtia.setSocketFD(fd);
+    }
+
+    void TearDown() override
+    {
+        // the ambassador closes the connexion in vain, and a callback thread left over reads the end of the link
+        closeLink();
+        ambassador.reset();
+    }
+
+    /// M_Factory::receive, with a buffer of its own: its static one is used by the library.
+    std::unique_ptr<Message> receive()
+    {
+        Message generic;
+        generic.receive(&rtia, received);
+        std::unique_ptr<Message> msg(M_Factory::create(generic.getMessageType()));
+        received.assumeSizeFromReservedBytes();
+        msg->deserialize(received);
+        return msg;
+    }
+
+    /// Receive the next message of the library, of the given type.
+    std::unique_ptr<Message> expect(Message::Type type)
+    {
+        std::unique_ptr<Message> msg;
+        try {
+            msg = receive();
+        }
+        catch (NetworkError& e) {
+            ADD_FAILURE() << "no message " << static_cast<int>(type) << " from the library: " << e.reason();
+            return std::unique_ptr<Message>(M_Factory::create(type));
+        }
+        EXPECT_EQ(type, msg->getMessageType());
+        return msg;
+    }
+
+    void send(Message& msg)
+    {
+        msg.send(&rtia, buffer);
+    }
+
+    void announce(const std::string& label)
+    {
+        M_Announce_Synchronization_Point callback;
+        callback.setLabel(label);
+        send(callback);
+    }
+
+    /// Answer a service request, or end the tick with a TICK_REQUEST.
+    void answer(Message::Type type)
+    {
+        std::unique_ptr<Message> rep(M_Factory::create(type));
+        send(*rep);
+    }
+
+    void connect()
+    {
+        ambassador->connect(federate, rti1516e::HLA_IMMEDIATE, L"");
+        auto tick = expect(Message::TICK_REQUEST);
+        if (tick->getMessageType() == Message::TICK_REQUEST) {
+            EXPECT_TRUE(static_cast<M_Tick_Request*>(tick.get())->getMultiple());
+        }
+    }
+
+    /// Disconnect while the callback thread waits for the pending tick.
+    void disconnect()
+    {
+        auto disconnected = std::async(std::launch::async, [this] { ambassador->disconnect(); });
+        expect(Message::TICK_REQUEST_STOP);
+        answer(Message::TICK_REQUEST);
+        ASSERT_EQ(std::future_status::ready, disconnected.wait_for(std::chrono::seconds(10)));
+        disconnected.get();
+    }
+
+    std::future<void> achieveAsync(const std::wstring& label)
+    {
+        return std::async(std::launch::async, [this, label] { ambassador->synchronizationPointAchieved(label, true); });
+    }
+
+    void closeLink()
+    {
+        ::shutdown(rtia.returnSocket(), SHUT_RDWR);
+    }
+
+    bool immediate() const
+    {
+        return ambassador->p->immediate;
+    }
+
+    std::unique_ptr<RTI1516ambassador> ambassador;
+    RecordingFederate federate;
+    SocketUN rtia{stIgnoreSignal};
+    MessageBuffer buffer;
+    MessageBuffer received;
+};
+
+TEST_F(RTI1516ambassadorTest, CallbackIsDeliveredWithoutTick)
+{
+    connect();
+
+    announce("ready");
+    ASSERT_TRUE(federate.waitAnnounced(1));
+    EXPECT_EQ(std::vector<std::wstring>({L"ready"}), federate.announcedLabels());
+
+    // the RTIA goes on with the next callback of the tick
+    expect(Message::TICK_REQUEST_NEXT);
+
+    disconnect();
+    EXPECT_FALSE(immediate());
+}
+
+TEST_F(RTI1516ambassadorTest, ServiceIsAnsweredWhileWaitingForCallbacks)
+{
+    connect();
+
+    auto achieved = achieveAsync(L"ready");
+    auto req = expect(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+    EXPECT_EQ("ready", req->getLabel());
+
+    // a callback before the reply is delivered, the reply goes to the caller
+    announce("other");
+    answer(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+
+    ASSERT_EQ(std::future_status::ready, achieved.wait_for(std::chrono::seconds(10)));
+    EXPECT_NO_THROW(achieved.get());
+    ASSERT_TRUE(federate.waitAnnounced(1));
+    expect(Message::TICK_REQUEST_NEXT);
+
+    disconnect();
+}
+
+TEST_F(RTI1516ambassadorTest, ServiceIsCalledFromCallback)
+{
+    bool achieved = false;
+    federate.onAnnounce = [&](std::wstring const& label) {
+        ambassador->synchronizationPointAchieved(label, true);
+        achieved = true;
+    };
+    connect();
+
+    announce("ready");
+    expect(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+    answer(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+
+    ASSERT_TRUE(federate.waitAnnounced(1));
+    EXPECT_TRUE(achieved);
+    // asked once the callback returned
+    expect(Message::TICK_REQUEST_NEXT);
+
+    disconnect();
+}
+
+TEST_F(RTI1516ambassadorTest, CallbacksAreHeldWhileDisabled)
+{
+    connect();
+
+    ambassador->disableCallbacks();
+    expect(Message::TICK_REQUEST_STOP);
+    // sent by the RTIA before it got the stop
+    announce("held");
+    answer(Message::TICK_REQUEST);
+
+    // the RTIA is asked for no more callbacks, the service is the next message
+    auto achieved = achieveAsync(L"ready");
+    expect(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+    answer(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+    ASSERT_EQ(std::future_status::ready, achieved.wait_for(std::chrono::seconds(10)));
+    achieved.get();
+
+    // the callback was read before the reply
+    EXPECT_TRUE(federate.announcedLabels().empty());
+
+    ambassador->enableCallbacks();
+    ASSERT_TRUE(federate.waitAnnounced(1));
+    EXPECT_EQ(std::vector<std::wstring>({L"held"}), federate.announcedLabels());
+
+    // not part of a tick anymore, a new tick is asked for
+    expect(Message::TICK_REQUEST);
+
+    disconnect();
+}
+
+TEST_F(RTI1516ambassadorTest, DisconnectStopsThreadBlockedOnLink)
+{
+    connect();
+
+    disconnect();
+    EXPECT_FALSE(immediate());
+
+    // back to the HLA_EVOKED model, the service reads its reply itself
+    auto achieved = achieveAsync(L"ready");
+    expect(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+    answer(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+    ASSERT_EQ(std::future_status::ready, achieved.wait_for(std::chrono::seconds(10)));
+    EXPECT_NO_THROW(achieved.get());
+}
+
+TEST_F(RTI1516ambassadorTest, LostLinkFailsServiceAndDisconnect)
+{
+    connect();
+
+    auto achieved = achieveAsync(L"ready");
+    expect(Message::SYNCHRONIZATION_POINT_ACHIEVED);
+
+    // the RTIA is gone before the reply
+    closeLink();
+
+    ASSERT_EQ(std::future_status::ready, achieved.wait_for(std::chrono::seconds(10)));
+    EXPECT_THROW(achieved.get(), rti1516e::RTIinternalError);
+
+    auto disconnected = std::async(std::launch::async, [this] { ambassador->disconnect(); });
+    ASSERT_EQ(std::future_status::ready, disconnected.wait_for(std::chrono::seconds(10)));
+    EXPECT_NO_THROW(disconnected.get());
+}
+
+} // namespace certi
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include "RTIA/DataDistribution.hh"
+#include "RTIA/FederationManagement.hh"
+
+#include "libCERTI/NM_Classes.hh"
+#include "libCERTI/RTIRegion.hh"
+#include "libCERTI/RootObject.hh"
+#include "libCERTI/RoutingSpace.hh"
+
+using ::certi::Exception;
+using ::certi::Extent;
+using ::certi::rtia::DataDistribution;
+using ::certi::rtia::FederationManagement;
+
+class DataDistributionTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        // no dimension, the regions start with empty extents
+        ::certi::RoutingSpace space;
+        root.addRegion(new ::certi::RTIRegion(1, space, 1));
+        root.addRegion(new ::certi::RTIRegion(2, space, 1));
+    }
+
+    static std::vector<Extent> extents(uint32_t lower, uint32_t upper)
+    {
+        Extent extent{1};
+        extent.setRangeLowerBound(1, lower);
+        extent.setRangeUpperBound(1, upper);
+        return {extent};
+    }
+
+    uint32_t lowerBound(::certi::RegionHandle region)
+    {
+        return root.getRegion(region)->getExtents().front().getRangeLowerBound(1);
+    }
+
+    void modify(::certi::RegionHandle region, uint32_t lower, uint32_t upper)
+    {
+        Exception::Type e;
+        ddm.modifyRegion(region, extents(lower, upper), e);
+        ASSERT_EQ(Exception::Type::NO_EXCEPTION, e);
+    }
+
+    static ::certi::NM_DDM_Modify_Regions refusal()
+    {
+        ::certi::NM_DDM_Modify_Regions answer;
+        answer.setException(Exception::Type::InvalidExtents, "refused");
+        return answer;
+    }
+
+    ::certi::RootObject root{};
+    FederationManagement fm{nullptr};
+    DataDistribution ddm{&root, &fm, nullptr};
+};
+
+TEST_F(DataDistributionTest, ModificationsAreSentOnce)
+{
+    modify(1, 10, 20);
+    modify(1, 30, 40);
+    modify(2, 50, 60);
+
+    auto req = ddm.takeRegionModifications();
+    ASSERT_TRUE(req);
+    EXPECT_EQ(std::vector<::certi::RegionHandle>({1, 2}), req->getRegions());
+    EXPECT_EQ(30u, req->getBounds(0));
+
+    EXPECT_FALSE(ddm.takeRegionModifications());
+}
+
+TEST_F(DataDistributionTest, RefusedModificationsAreRolledBackAndReported)
+{
+    modify(1, 10, 20);
+    ddm.takeRegionModifications();
+    ::certi::NM_DDM_Modify_Regions accepted;
+    ddm.regionModificationsAnswered(accepted);
+    EXPECT_EQ(10u, lowerBound(1));
+
+    modify(1, 30, 40);
+    modify(2, 50, 60);
+    ddm.takeRegionModifications();
+    auto refused = refusal();
+    ddm.regionModificationsAnswered(refused);
+
+    // back to what the RTIG has
+    EXPECT_EQ(10u, lowerBound(1));
+    EXPECT_EQ(0u, root.getRegion(2)->getExtents().front().size());
+
+    // reported once for each region
+    std::string reason;
+    EXPECT_EQ(Exception::Type::InvalidExtents, ddm.takeRegionModificationsRefusal(1, reason));
+    EXPECT_EQ("refused", reason);
+    EXPECT_EQ(Exception::Type::NO_EXCEPTION, ddm.takeRegionModificationsRefusal(1, reason));
+    EXPECT_EQ(Exception::Type::InvalidExtents, ddm.takeRegionModificationsRefusal(2, reason));
+    EXPECT_EQ(Exception::Type::NO_EXCEPTION, ddm.takeRegionModificationsRefusal(2, reason));
+}
+
+TEST_F(DataDistributionTest, RefusalOfRegionAcceptedSinceIsNotReported)
+{
+    modify(1, 10, 20);
+    ddm.takeRegionModifications();
+    auto refused = refusal();
+    ddm.regionModificationsAnswered(refused);
+
+    modify(1, 30, 40);
+    ddm.takeRegionModifications();
+    ::certi::NM_DDM_Modify_Regions accepted;
+    ddm.regionModificationsAnswered(accepted);
+
+    std::string reason;
+    EXPECT_EQ(Exception::Type::NO_EXCEPTION, ddm.takeRegionModificationsRefusal(1, reason));
+}
+
+TEST_F(DataDistributionTest, RegionModifiedSinceRefusedModificationsIsKept)
+{
+    modify(1, 10, 20);
+    modify(2, 10, 20);
+    ddm.takeRegionModifications();
+
+    // one region sent again, the other modified but not sent yet
+    modify(1, 30, 40);
+    ddm.takeRegionModifications();
+    modify(2, 50, 60);
+
+    auto refused = refusal();
+    ddm.regionModificationsAnswered(refused);
+
+    EXPECT_EQ(30u, lowerBound(1));
+    EXPECT_EQ(50u, lowerBound(2));
+
+    // their later modifications are answered on their own
+    std::string reason;
+    EXPECT_EQ(Exception::Type::NO_EXCEPTION, ddm.takeRegionModificationsRefusal(1, reason));
+    EXPECT_EQ(Exception::Type::NO_EXCEPTION, ddm.takeRegionModificationsRefusal(2, reason));
+}
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "RTIA/FederationManagement.hh"
+#include "RTIA/Files.hh"
+#include "RTIA/ObjectManagement.hh"
+
+#include "libCERTI/NM_Classes.hh"
+#include "libCERTI/ObjectClass.hh"
+#include "libCERTI/ObjectClassAttribute.hh"
+#include "libCERTI/ObjectSet.hh"
+#include "libCERTI/RootObject.hh"
+
+using ::certi::NetworkMessage;
+using ::certi::rtia::FederationManagement;
+using ::certi::rtia::ObjectManagement;
+using ::certi::rtia::Queues;
+
+class ObjectManagementTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        auto objectRoot = new ::certi::ObjectClass("ObjectRoot", 1);
+        root.addObjectClass(objectRoot, nullptr);
+        objectRoot->addAttribute(new ::certi::ObjectClassAttribute("privilegeToDelete", 1));
+
+        root.registerObjectInstance(fm.getFederateHandle(), 1, object, "HLAObject_5");
+    }
+
+    std::unique_ptr<NetworkMessage> nextFifoMessage()
+    {
+        bool gave = false;
+        bool remaining = false;
+        return std::unique_ptr<NetworkMessage>(queues.giveFifoMessage(gave, remaining));
+    }
+
+    const ::certi::ObjectHandle object{5};
+
+    ::certi::RootObject root{};
+    Queues queues{};
+    FederationManagement fm{nullptr};
+    ObjectManagement om{nullptr, &queues, &fm, &root};
+};
+
+TEST_F(ObjectManagementTest, RefusedLeasedRegistrationIsReportedAsRemoval)
+{
+    ::certi::NM_Lease_Object_Handles report;
+    report.setCount(0);
+    report.setObjectsSize(1);
+    report.setObjects(object, 0);
+    report.setException(::certi::Exception::Type::ObjectClassNotPublished, "not published");
+
+    om.registrationFailed(report);
+
+    auto message = nextFifoMessage();
+    ASSERT_TRUE(message);
+    ASSERT_EQ(NetworkMessage::Type::REMOVE_OBJECT, message->getMessageType());
+    auto removal = static_cast<::certi::NM_Remove_Object*>(message.get());
+    EXPECT_EQ(object, removal->getObject());
+    EXPECT_EQ(1u, removal->getObjectClass());
+    EXPECT_EQ(fm.getFederateHandle(), removal->getFederate());
+    EXPECT_EQ("not published", removal->getLabel());
+
+    // removed when the federate is told
+    EXPECT_NO_THROW(root.objects->getObject(object));
+    EXPECT_FALSE(nextFifoMessage());
+}
+
+TEST_F(ObjectManagementTest, RefusedRegistrationOfRemovedObjectIsIgnored)
+{
+    root.deleteObjectInstance(fm.getFederateHandle(), object, "");
+
+    ::certi::NM_Lease_Object_Handles report;
+    report.setObjectsSize(1);
+    report.setObjects(object, 0);
+    report.setException(::certi::Exception::Type::RTIinternalError, "not leased");
+
+    om.registrationFailed(report);
+
+    EXPECT_FALSE(nextFifoMessage());
+}
+
+TEST_F(ObjectManagementTest, RegistrationOfUnpublishedClassFailsAtTheCall)
+{
+    // no handle is leased nor registration sent: there is no link to the RTIG
+    ::certi::Exception::Type e;
+    EXPECT_EQ(0u, om.registerObject(1, "", {}, {}, e));
+    EXPECT_EQ(::certi::Exception::Type::ObjectClassNotPublished, e);
+
+    EXPECT_EQ(0u, om.registerObject(7, "", {}, {}, e));
+    EXPECT_EQ(::certi::Exception::Type::ObjectClassNotDefined, e);
+}
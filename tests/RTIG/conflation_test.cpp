@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <RTIG/Conflation.hh>
+#include <RTIG/Federation.hh>
+
+#include <libCERTI/AuditFile.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/ObjectClassSet.hh>
+#include <libCERTI/RootObject.hh>
+#include <libCERTI/SocketTCP.hh>
+
+#include "socketperfederateserver.h"
+#include "temporaryfedfile.h"
+
+#include "../mocks/sockettcp_mock.h"
+
+using ::certi::AttributeHandle;
+using ::certi::NM_Reflect_Attribute_Values;
+using ::certi::ObjectHandle;
+using ::certi::rtig::Conflation;
+using ::certi::rtig::ConflationQueue;
+using ::certi::rtig::Federation;
+
+namespace {
+static const ::certi::FederationHandle federation_handle{1};
+
+static constexpr int quiet{0};
+
+NM_Reflect_Attribute_Values reflection(const ObjectHandle object,
+                                       const std::vector<AttributeHandle>& attributes,
+                                       const std::string& value)
+{
+    NM_Reflect_Attribute_Values message;
+    message.setFederation(federation_handle.get());
+    message.setObject(object);
+    message.setLabel(value);
+    message.setAttributesSize(attributes.size());
+    message.setValuesSize(attributes.size());
+    for (uint32_t i = 0; i < attributes.size(); ++i) {
+        message.setAttributes(attributes[i], i);
+        message.setValues({value.begin(), value.end()}, i);
+    }
+    return message;
+}
+
+std::string valueOf(const NM_Reflect_Attribute_Values& message, const uint32_t rank)
+{
+    return {message.getValues(rank).begin(), message.getValues(rank).end()};
+}
+}
+
+TEST(ConflationQueueTest, NewerValueReplacesUnsentOneInPlace)
+{
+    ConflationQueue queue;
+
+    EXPECT_EQ(0u, queue.push(reflection(1, {10, 11}, "old")));
+    EXPECT_EQ(0u, queue.push(reflection(2, {10}, "other")));
+    EXPECT_EQ(1u, queue.push(reflection(1, {11, 12}, "new")));
+    EXPECT_EQ(4u, queue.depth());
+
+    auto first = queue.pop();
+    ASSERT_TRUE(first);
+    EXPECT_EQ(1u, first->getObject());
+    EXPECT_EQ(std::vector<AttributeHandle>({10, 11, 12}), first->getAttributes());
+    EXPECT_EQ("old", valueOf(*first, 0));
+    EXPECT_EQ("new", valueOf(*first, 1));
+    EXPECT_EQ("new", valueOf(*first, 2));
+    EXPECT_EQ("new", first->getLabel());
+
+    // the object kept its place in the queue
+    auto second = queue.pop();
+    ASSERT_TRUE(second);
+    EXPECT_EQ(2u, second->getObject());
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(0u, queue.depth());
+    EXPECT_FALSE(queue.pop());
+}
+
+TEST(ConflationQueueTest, PoppedObjectIsQueuedAgain)
+{
+    ConflationQueue queue;
+
+    queue.push(reflection(1, {10}, "first"));
+    queue.pop();
+
+    EXPECT_EQ(0u, queue.push(reflection(1, {10}, "second")));
+    EXPECT_EQ("second", valueOf(*queue.pop(), 0));
+}
+
+TEST(ConflationTest, DisabledWithoutClasses)
+{
+    Conflation conflation({}, 16);
+
+    EXPECT_FALSE(conflation.isEnabled());
+}
+
+TEST(ConflationTest, FullQueueRefusesReflections)
+{
+    Conflation conflation({"ObjectRoot"}, 3);
+    ::certi::SocketTCP socket;
+
+    EXPECT_TRUE(conflation.push(&socket, reflection(1, {10, 11}, "a")));
+    EXPECT_FALSE(conflation.push(&socket, reflection(2, {10, 11}, "b")));
+    EXPECT_TRUE(conflation.push(&socket, reflection(1, {10}, "c")));
+
+    EXPECT_TRUE(conflation.hasPending(&socket));
+    EXPECT_EQ(std::vector<::certi::Socket*>({&socket}), conflation.pendingSockets());
+
+    auto pending = conflation.pop(&socket);
+    ASSERT_TRUE(pending);
+    EXPECT_EQ("c", valueOf(*pending, 0));
+    EXPECT_FALSE(conflation.hasPending());
+
+    const auto& counters = conflation.counters();
+    EXPECT_EQ(3u, counters.queued);
+    EXPECT_EQ(1u, counters.conflated);
+    EXPECT_EQ(1u, counters.flushed);
+    EXPECT_EQ(1u, counters.overflows);
+    EXPECT_EQ(2u, counters.max_depth);
+}
+
+TEST(ConflationTest, ForgottenSocketHasNothingPending)
+{
+    Conflation conflation({"ObjectRoot"}, 16);
+    ::certi::SocketTCP socket;
+
+    conflation.push(&socket, reflection(1, {10}, "a"));
+    conflation.forget(&socket);
+
+    EXPECT_FALSE(conflation.hasPending());
+    EXPECT_FALSE(conflation.pop(&socket));
+}
+
+class ConflationPolicyTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        auto& classes = *f.getRootObject().ObjectClasses;
+        data = classes.getObjectClassHandle("ObjectRoot.Data");
+        attr1 = classes.getAttributeHandle("Attr1", data);
+
+        auto publisher = f.add("publisher", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        f.publishObject(publisher, data, {attr1}, true);
+        object = f.registerObject(publisher, data, "object").first;
+    }
+
+    SocketPerFederateServer s{new ::certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+
+    TemporaryFedFile tmp{"Conflation.fed"};
+
+    Federation f{"conflation", federation_handle, s, a, {"Conflation.fed"}, "", ::certi::HLA_1_3, quiet};
+
+    MockSocketTcp federate_socket;
+
+    ::certi::ObjectClassHandle data;
+    AttributeHandle attr1;
+    ObjectHandle object;
+};
+
+TEST_F(ConflationPolicyTest, ListedClassIsAccepted)
+{
+    Conflation conflation({"ObjectRoot.Data"}, 16);
+
+    auto message = reflection(object, {attr1}, "a");
+    EXPECT_TRUE(conflation.accepts(message, f.getRootObject()));
+}
+
+TEST_F(ConflationPolicyTest, SubclassOfListedClassIsAccepted)
+{
+    Conflation conflation({"Unknown", "ObjectRoot"}, 16);
+
+    auto message = reflection(object, {attr1}, "a");
+    EXPECT_TRUE(conflation.accepts(message, f.getRootObject()));
+}
+
+TEST_F(ConflationPolicyTest, OtherClassIsRefused)
+{
+    Conflation conflation({"ObjectRoot.RTIprivate"}, 16);
+
+    auto message = reflection(object, {attr1}, "a");
+    EXPECT_FALSE(conflation.accepts(message, f.getRootObject()));
+}
+
+TEST_F(ConflationPolicyTest, TimeStampedReflectionIsRefused)
+{
+    Conflation conflation({"ObjectRoot.Data"}, 16);
+
+    auto message = reflection(object, {attr1}, "a");
+    message.setDate(::certi::FederationTime(1.0));
+    EXPECT_FALSE(conflation.accepts(message, f.getRootObject()));
+}
+
+TEST_F(ConflationPolicyTest, UnknownObjectIsRefused)
+{
+    Conflation conflation({"ObjectRoot"}, 16);
+
+    auto message = reflection(object + 100, {attr1}, "a");
+    EXPECT_FALSE(conflation.accepts(message, f.getRootObject()));
+}
@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <set>
+#include <string>
+
+#include <RTIG/Federation.hh>
+
+#include <libCERTI/AuditFile.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/Object.hh>
+#include <libCERTI/ObjectAttribute.hh>
+#include <libCERTI/ObjectClassSet.hh>
+#include <libCERTI/ObjectSet.hh>
+#include <libCERTI/RootObject.hh>
+#include <libCERTI/SocketTCP.hh>
+
+#include "socketperfederateserver.h"
+#include "temporaryfedfile.h"
+
+using ::certi::AttributeHandle;
+using ::certi::FederateHandle;
+using ::certi::ObjectClassHandle;
+using ::certi::ObjectHandle;
+using ::certi::OwnershipIndex;
+using ::certi::rtig::Federation;
+
+namespace {
+static const ::certi::FederationHandle federation_handle{1};
+
+static constexpr int quiet{0};
+}
+
+class FederateCleanupTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        auto& classes = *f.getRootObject().ObjectClasses;
+        root = classes.getObjectClassHandle("ObjectRoot");
+        data = classes.getObjectClassHandle("ObjectRoot.Data");
+        privilege = classes.getAttributeHandle("privilegeToDelete", root);
+        attr1 = classes.getAttributeHandle("Attr1", data);
+        attr2 = classes.getAttributeHandle("Attr2", data);
+
+        publisher = f.add("publisher", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        acquirer = f.add("acquirer", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        root_subscriber = f.add("root", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        data_subscriber = f.add("data", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+        f.publishObject(publisher, data, {privilege, attr1, attr2}, true);
+        f.publishObject(acquirer, data, {attr1}, true);
+        f.subscribeObject(root_subscriber, root, {privilege}, true);
+        f.subscribeObject(data_subscriber, data, {attr1}, true);
+        // also subscribed at the superclass, must not be told twice
+        f.subscribeObject(data_subscriber, root, {privilege}, true);
+
+        first = f.registerObject(publisher, data, "first").first;
+        second = f.registerObject(publisher, data, "second").first;
+    }
+
+    const OwnershipIndex& index()
+    {
+        return f.getRootObject().objects->getOwnershipIndex();
+    }
+
+    FederateHandle federateOf(::certi::Socket* socket)
+    {
+        for (auto federate : {publisher, acquirer, root_subscriber, data_subscriber}) {
+            if (s.getSocketLink(federation_handle, federate) == socket) {
+                return federate;
+            }
+        }
+        return 0;
+    }
+
+    SocketPerFederateServer s{new ::certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+
+    TemporaryFedFile tmp{"FederateCleanup.fed"};
+
+    Federation f{"cleanup", federation_handle, s, a, {"FederateCleanup.fed"}, "", ::certi::HLA_1_3, quiet};
+
+    MockSocketTcp federate_socket;
+
+    ObjectClassHandle root, data;
+    AttributeHandle privilege, attr1, attr2;
+    FederateHandle publisher, acquirer, root_subscriber, data_subscriber;
+    ObjectHandle first, second;
+};
+
+TEST_F(FederateCleanupTest, IndexListsRegisteredObjectsAndAttributes)
+{
+    EXPECT_EQ(std::set<ObjectHandle>({first, second}), index().getObjects(publisher));
+    EXPECT_EQ(6u, index().getAttributes(publisher).size());
+    EXPECT_EQ(1u, index().getAttributes(publisher).count({first, attr1}));
+
+    EXPECT_TRUE(index().getObjects(acquirer).empty());
+    EXPECT_TRUE(index().getAttributes(acquirer).empty());
+}
+
+TEST_F(FederateCleanupTest, IndexFollowsOwnershipTransfer)
+{
+    // what an unconditional divestiture does
+    f.getRootObject().getObjectAttribute(first, attr1)->setOwner(0);
+    EXPECT_EQ(0u, index().getAttributes(publisher).count({first, attr1}));
+
+    f.acquireIfAvailable(acquirer, first, {attr1});
+    EXPECT_EQ(std::set<OwnershipIndex::ObjectAttributeHandle>({{first, attr1}}), index().getAttributes(acquirer));
+}
+
+TEST_F(FederateCleanupTest, OwnershipAnswersAreReturnedAsResponses)
+{
+    using Type = ::certi::NetworkMessage::Type;
+
+    auto unavailable = f.acquireIfAvailable(acquirer, first, {attr1});
+    ASSERT_EQ(1u, unavailable.size());
+    EXPECT_EQ(Type::ATTRIBUTE_OWNERSHIP_UNAVAILABLE, unavailable.front().message()->getMessageType());
+    EXPECT_EQ(acquirer, federateOf(unavailable.front().sockets().front()));
+
+    auto release = f.acquire(acquirer, first, {attr1}, "tag");
+    ASSERT_EQ(1u, release.size());
+    EXPECT_EQ(Type::REQUEST_ATTRIBUTE_OWNERSHIP_RELEASE, release.front().message()->getMessageType());
+    EXPECT_EQ(publisher, federateOf(release.front().sockets().front()));
+
+    auto released = f.respondRelease(publisher, first, {attr1});
+    delete released.first;
+    ASSERT_EQ(1u, released.second.size());
+    EXPECT_EQ(Type::ATTRIBUTE_OWNERSHIP_ACQUISITION_NOTIFICATION, released.second.front().message()->getMessageType());
+    EXPECT_EQ(acquirer, federateOf(released.second.front().sockets().front()));
+    EXPECT_EQ(acquirer, f.getRootObject().getObjectAttribute(first, attr1)->getOwner());
+}
+
+TEST_F(FederateCleanupTest, IndexForgetsDeletedObjects)
+{
+    f.deleteObject(publisher, first, "");
+
+    EXPECT_EQ(std::set<ObjectHandle>({second}), index().getObjects(publisher));
+    EXPECT_EQ(3u, index().getAttributes(publisher).size());
+}
+
+TEST_F(FederateCleanupTest, KilledFederateReleasesAcquiredAttributes)
+{
+    f.getRootObject().getObjectAttribute(first, attr1)->setOwner(0);
+    f.acquireIfAvailable(acquirer, first, {attr1});
+
+    for (auto& response : f.kill(acquirer)) {
+        EXPECT_NE(::certi::NetworkMessage::Type::REMOVE_OBJECTS, response.message()->getMessageType());
+    }
+
+    EXPECT_EQ(0u, f.getRootObject().getObjectAttribute(first, attr1)->getOwner());
+    EXPECT_TRUE(index().getAttributes(acquirer).empty());
+    EXPECT_EQ(std::set<ObjectHandle>({first, second}), index().getObjects(publisher));
+}
+
+TEST_F(FederateCleanupTest, KilledFederateObjectsAreRemovedOncePerSubscriber)
+{
+    std::map<FederateHandle, std::multiset<ObjectHandle>> removed;
+    for (auto& response : f.kill(publisher)) {
+        EXPECT_NE(::certi::NetworkMessage::Type::REMOVE_OBJECT, response.message()->getMessageType());
+        if (response.message()->getMessageType() != ::certi::NetworkMessage::Type::REMOVE_OBJECTS) {
+            continue;
+        }
+        auto message = static_cast<::certi::NM_Remove_Objects*>(response.message());
+        for (auto socket : response.sockets()) {
+            auto federate = federateOf(socket);
+            removed[federate].insert(message->getObjects().begin(), message->getObjects().end());
+            // told at the class it subscribed to
+            EXPECT_EQ(federate == data_subscriber ? data : root, message->getObjectClass());
+        }
+    }
+
+    ASSERT_EQ(2u, removed.size());
+    EXPECT_EQ(std::multiset<ObjectHandle>({first, second}), removed[root_subscriber]);
+    EXPECT_EQ(std::multiset<ObjectHandle>({first, second}), removed[data_subscriber]);
+
+    EXPECT_TRUE(index().getObjects(publisher).empty());
+    EXPECT_TRUE(index().getAttributes(publisher).empty());
+    EXPECT_THROW(f.getRootObject().getObject(first), ::certi::ObjectNotKnown);
+    EXPECT_FALSE(f.getRootObject().getObjectClass(data)->isInstanceInClass(second));
+}
+
+TEST_F(FederateCleanupTest, LeasedHandleIsRegisteredWithoutAnswer)
+{
+    auto lease = f.leaseObjectHandles(publisher, 2);
+    ASSERT_EQ(1u, lease.size());
+    auto message = static_cast<::certi::NM_Lease_Object_Handles*>(lease.front().message());
+    ASSERT_EQ(::certi::NetworkMessage::Type::LEASE_OBJECT_HANDLES, message->getMessageType());
+    ASSERT_EQ(2u, message->getObjectsSize());
+    EXPECT_NE(message->getObjects(0), message->getObjects(1));
+    EXPECT_EQ(0u, std::set<ObjectHandle>({first, second}).count(message->getObjects(0)));
+
+    auto leased = message->getObjects(1);
+    auto registration = f.registerObject(publisher, data, "", leased);
+
+    EXPECT_EQ(leased, registration.first);
+    for (auto& response : registration.second) {
+        EXPECT_NE(::certi::NetworkMessage::Type::REGISTER_OBJECT, response.message()->getMessageType());
+    }
+    EXPECT_EQ("HLAObject_" + std::to_string(leased), f.getRootObject().getObject(leased)->getName());
+    EXPECT_EQ(1u, index().getObjects(publisher).count(leased));
+
+    // a lease is used once
+    EXPECT_THROW(f.registerObject(publisher, data, "again", leased), ::certi::RTIinternalError);
+}
+
+TEST_F(FederateCleanupTest, HandleLeasedByAnotherFederateIsRefused)
+{
+    auto lease = f.leaseObjectHandles(acquirer, 1);
+    auto leased = static_cast<::certi::NM_Lease_Object_Handles*>(lease.front().message())->getObjects(0);
+
+    EXPECT_THROW(f.registerObject(publisher, data, "", leased), ::certi::RTIinternalError);
+}
+
+TEST_F(FederateCleanupTest, KilledFederateLeaseIsDropped)
+{
+    auto lease = f.leaseObjectHandles(publisher, 1);
+    auto leased = static_cast<::certi::NM_Lease_Object_Handles*>(lease.front().message())->getObjects(0);
+
+    f.kill(publisher);
+
+    EXPECT_THROW(f.registerObject(acquirer, data, "", leased), ::certi::RTIinternalError);
+}
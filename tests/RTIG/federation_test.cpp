@@ -5,6 +5,9 @@
 
 #include <libCERTI/AuditFile.hh>
 #include <libCERTI/NM_Classes.hh>
+#include <libCERTI/RTIRegion.hh>
+#include <libCERTI/RootObject.hh>
+#include <libCERTI/RoutingSpace.hh>
 #include <libCERTI/SocketServer.hh>
 #include <libCERTI/SocketTCP.hh>
 
@@ -794,6 +797,33 @@ TEST_F(FederationTest, ModifyRegionThrowsOnUknFederate)
     ASSERT_THROW(f.modifyRegion(ukn_federate, 1, {}), ::certi::FederateNotExecutionMember);
 }
 
+TEST_F(FederationTest, ModifyRegionsThrowsOnUknFederate)
+{
+    ASSERT_THROW(f.modifyRegions(ukn_federate, {1}, {{}}), ::certi::FederateNotExecutionMember);
+}
+
+TEST_F(FederationTest, ModifyRegionsAppliesAllOrNone)
+{
+    auto handle = f.add("fed", fed_type, {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    // no dimension, the regions start with empty extents
+    ::certi::RoutingSpace space;
+    f.getRootObject().addRegion(new ::certi::RTIRegion(1, space, 1));
+    f.getRootObject().addRegion(new ::certi::RTIRegion(2, space, 2));
+
+    ::certi::Extent extent{1};
+    extent.setRangeLowerBound(1, 10);
+    extent.setRangeUpperBound(1, 20);
+
+    // the second region has two extents, nothing is modified
+    ASSERT_THROW(f.modifyRegions(handle, {1, 2}, {{extent}, {extent}}), ::certi::InvalidExtents);
+    EXPECT_EQ(0u, f.getRootObject().getRegion(1)->getExtents().front().size());
+
+    f.modifyRegions(handle, {1, 2}, {{extent}, {extent, extent}});
+    EXPECT_EQ(10u, f.getRootObject().getRegion(1)->getExtents().front().getRangeLowerBound(1));
+    EXPECT_EQ(20u, f.getRootObject().getRegion(2)->getExtents().back().getRangeUpperBound(1));
+}
+
 TEST_F(FederationTest, DeleteRegionThrowsOnUknFederate)
 {
     ASSERT_THROW(f.deleteRegion(ukn_federate, 1), ::certi::FederateNotExecutionMember);
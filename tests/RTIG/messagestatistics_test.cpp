@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "RTIG/MessageStatistics.hh"
+
+using ::certi::NetworkMessage;
+using ::certi::rtig::MessageStatistics;
+
+TEST(MessageStatisticsTest, NothingRecordedByDefault)
+{
+    MessageStatistics stats;
+
+    EXPECT_EQ(nullptr, stats.forType(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES));
+    EXPECT_EQ(nullptr, stats.forFederation(1));
+}
+
+TEST(MessageStatisticsTest, RecordFillsTypeAndFederation)
+{
+    MessageStatistics stats;
+
+    stats.record(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES, 1, std::chrono::nanoseconds(1000), 3, 300);
+    stats.record(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES, 1, std::chrono::nanoseconds(2000), 5, 500);
+
+    auto type = stats.forType(NetworkMessage::Type::UPDATE_ATTRIBUTE_VALUES);
+    ASSERT_NE(nullptr, type);
+    EXPECT_EQ(2u, type->processing_ns.count());
+    EXPECT_EQ(1000u, type->processing_ns.min());
+    EXPECT_EQ(5u, type->fanout.max());
+    EXPECT_EQ(800u, type->bytes_sent.sum());
+
+    auto federation = stats.forFederation(1);
+    ASSERT_NE(nullptr, federation);
+    EXPECT_EQ(2u, federation->fanout.count());
+}
+
+TEST(MessageStatisticsTest, FederationZeroIsNotTracked)
+{
+    MessageStatistics stats;
+
+    stats.record(NetworkMessage::Type::CREATE_FEDERATION_EXECUTION, 0, std::chrono::nanoseconds(1000), 1, 10);
+
+    EXPECT_NE(nullptr, stats.forType(NetworkMessage::Type::CREATE_FEDERATION_EXECUTION));
+    EXPECT_EQ(nullptr, stats.forFederation(0));
+}
+
+TEST(MessageStatisticsTest, DumpHasHeaderAndThreeLinesPerScope)
+{
+    MessageStatistics stats;
+
+    stats.record(NetworkMessage::Type::SEND_INTERACTION, 2, std::chrono::nanoseconds(1000), 1, 10);
+
+    std::stringstream ss;
+    stats.dump(ss);
+
+    std::string line;
+    int lines{0};
+    while (std::getline(ss, line)) {
+        ++lines;
+    }
+    EXPECT_EQ(1 + 3 + 3, lines);
+}
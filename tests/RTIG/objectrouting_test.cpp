@@ -0,0 +1,490 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <RTIG/Federation.hh>
+
+#include <libCERTI/AuditFile.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/ObjectClass.hh>
+#include <libCERTI/ObjectClassSet.hh>
+#include <libCERTI/PeerRoutes.hh>
+#include <libCERTI/RootObject.hh>
+#include <libCERTI/SocketTCP.hh>
+#include <libCERTI/ValueCompression.hh>
+
+#include "socketperfederateserver.h"
+#include "temporaryfedfile.h"
+
+#include "../mocks/sockettcp_mock.h"
+
+using ::certi::AttributeHandle;
+using ::certi::FederateHandle;
+using ::certi::ObjectClassHandle;
+using ::certi::ObjectHandle;
+using ::certi::rtig::Federation;
+
+namespace {
+static const ::certi::FederationHandle federation_handle{1};
+
+static constexpr int quiet{0};
+}
+
+class ObjectRoutingTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        auto& classes = *f.getRootObject().ObjectClasses;
+        root = classes.getObjectClassHandle("ObjectRoot");
+        data = classes.getObjectClassHandle("ObjectRoot.Data");
+        privilege = classes.getAttributeHandle("privilegeToDelete", root);
+        attr1 = classes.getAttributeHandle("Attr1", data);
+        attr2 = classes.getAttributeHandle("Attr2", data);
+
+        publisher = f.add("publisher", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        root_subscriber = f.add("root", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        attr1_subscriber = f.add("attr1", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+        all_subscriber = f.add("all", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+        f.publishObject(publisher, data, {privilege, attr1, attr2}, true);
+        f.subscribeObject(root_subscriber, root, {privilege}, true);
+        f.subscribeObject(attr1_subscriber, data, {attr1}, true);
+        f.subscribeObject(all_subscriber, data, {privilege, attr1, attr2}, true);
+        // also subscribed at the superclass, must not receive the attribute twice
+        f.subscribeObject(all_subscriber, root, {privilege}, true);
+
+        object = f.registerObject(publisher, data, "object").first;
+    }
+
+    /// Attributes received by each federate for an update of all attributes
+    std::map<FederateHandle, std::vector<AttributeHandle>> update()
+    {
+        std::vector<::certi::AttributeValue_t> values{{'0'}, {'1'}, {'2'}};
+
+        std::map<FederateHandle, std::vector<AttributeHandle>> received;
+        for (auto& response : f.updateAttributeValues(publisher, object, {privilege, attr1, attr2}, values, "")) {
+            auto message = static_cast<::certi::NM_Reflect_Attribute_Values*>(response.message());
+            EXPECT_EQ(::certi::NetworkMessage::Type::REFLECT_ATTRIBUTE_VALUES, message->getMessageType());
+            EXPECT_EQ(message->getAttributesSize(), message->getValuesSize());
+            for (auto socket : response.sockets()) {
+                auto federate = federateOf(socket);
+                EXPECT_EQ(0u, received.count(federate)) << "federate " << federate << " reflected twice";
+                received[federate] = message->getAttributes();
+            }
+        }
+        return received;
+    }
+
+    /// A publisher of every attribute of Data which takes peer to peer data, with one object
+    std::pair<FederateHandle, ObjectHandle> addPeerPublisher()
+    {
+        auto sender = f.add("sender", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0, false, 4000).first;
+        f.publishObject(sender, data, {privilege, attr1, attr2}, true);
+        return {sender, f.registerObject(sender, data, "peer").first};
+    }
+
+    /// Route of an update of attr1 and attr2 of the object of sender
+    std::unique_ptr<::certi::NM_Peer_Route> peerRoute(const FederateHandle sender, const ObjectHandle peer_object)
+    {
+        ::certi::NM_Update_Attribute_Values request;
+        request.setFederate(sender);
+        request.setObject(peer_object);
+        request.setAttributesSize(2);
+        request.setValuesSize(2);
+        request.setAttributes(attr1, 0);
+        request.setValues({'1'}, 0);
+        request.setAttributes(attr2, 1);
+        request.setValues({'2'}, 1);
+
+        auto responses = f.updateAttributeValues(sender, peer_object, request.getAttributes(), request.getValues(), "");
+        return f.peerRoute(request, responses);
+    }
+
+    FederateHandle federateOf(::certi::Socket* socket)
+    {
+        for (auto federate : {publisher, root_subscriber, attr1_subscriber, all_subscriber}) {
+            if (s.getSocketLink(federation_handle, federate) == socket) {
+                return federate;
+            }
+        }
+        return 0;
+    }
+
+    SocketPerFederateServer s{new ::certi::SocketTCP{}, nullptr};
+    ::certi::AuditFile a{"tmp"};
+
+    TemporaryFedFile tmp{"ObjectRouting.fed"};
+
+    Federation f{"routing", federation_handle, s, a, {"ObjectRouting.fed"}, "", ::certi::HLA_1_3, quiet};
+
+    MockSocketTcp federate_socket;
+
+    ObjectClassHandle root, data;
+    AttributeHandle privilege, attr1, attr2;
+    FederateHandle publisher, root_subscriber, attr1_subscriber, all_subscriber;
+    ObjectHandle object;
+};
+
+TEST_F(ObjectRoutingTest, EachSubscriberReceivesItsAttributesOnce)
+{
+    auto received = update();
+
+    ASSERT_EQ(3u, received.size());
+    EXPECT_EQ(std::vector<AttributeHandle>({privilege}), received[root_subscriber]);
+    EXPECT_EQ(std::vector<AttributeHandle>({attr1}), received[attr1_subscriber]);
+    EXPECT_EQ(std::vector<AttributeHandle>({privilege, attr1, attr2}), received[all_subscriber]);
+}
+
+TEST_F(ObjectRoutingTest, RoutingTableListsSuperclassSubscriptions)
+{
+    auto& table = f.getRootObject().getObjectClass(data)->getRoutingTable();
+
+    auto& routes = table.at(privilege);
+    ASSERT_EQ(3u, routes.size());
+    // subscriptions at the class itself come first
+    EXPECT_EQ(all_subscriber, routes[0].subscriber.getHandle());
+    EXPECT_EQ(data, routes[0].objectClass);
+    EXPECT_EQ(root, routes[1].objectClass);
+    EXPECT_EQ(root, routes[2].objectClass);
+
+    EXPECT_EQ(2u, table.at(attr1).size());
+    EXPECT_EQ(1u, table.at(attr2).size());
+}
+
+TEST_F(ObjectRoutingTest, UnsubscribeAtSuperclassUpdatesSubclassRoutes)
+{
+    update();
+
+    f.subscribeObject(root_subscriber, root, {}, false);
+
+    auto received = update();
+    EXPECT_EQ(0u, received.count(root_subscriber));
+    EXPECT_EQ(2u, received.size());
+}
+
+TEST_F(ObjectRoutingTest, NewSubscriptionIsRouted)
+{
+    update();
+
+    f.subscribeObject(attr1_subscriber, data, {attr1, attr2}, true);
+
+    auto received = update();
+    EXPECT_EQ(std::vector<AttributeHandle>({attr1, attr2}), received[attr1_subscriber]);
+}
+
+TEST_F(ObjectRoutingTest, ResignedFederateIsNotRouted)
+{
+    update();
+
+    f.kill(root_subscriber);
+
+    auto received = update();
+    EXPECT_EQ(0u, received.count(root_subscriber));
+    EXPECT_EQ(2u, f.getRootObject().getObjectClass(data)->getRoutingTable().at(privilege).size());
+}
+
+TEST_F(ObjectRoutingTest, UpdatesOfDifferentObjectsAreRoutedAtOnce)
+{
+    std::vector<ObjectHandle> objects{object};
+    for (int i = 0; i < 7; ++i) {
+        objects.push_back(f.registerObject(publisher, data, "object" + std::to_string(i)).first);
+    }
+
+    const auto expected = update();
+
+    // the routing threads compute the routing table again
+    f.subscribeObject(attr1_subscriber, data, {attr1}, true);
+
+    std::vector<::certi::AttributeValue_t> values{{'0'}, {'1'}, {'2'}};
+    std::vector<std::vector<size_t>> fanouts(objects.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        threads.emplace_back([&, i] {
+            for (int n = 0; n < 100; ++n) {
+                size_t fanout{0};
+                for (const auto& response :
+                     f.routeAttributeValues(publisher, objects[i], {privilege, attr1, attr2}, values, "")) {
+                    fanout += response.sockets().size();
+                }
+                fanouts[i].push_back(fanout);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& fanout : fanouts) {
+        EXPECT_EQ(std::vector<size_t>(100, expected.size()), fanout);
+    }
+}
+
+TEST_F(ObjectRoutingTest, LateSubscriberDiscoversAllObjectsInOneMessage)
+{
+    auto other = f.registerObject(publisher, data, "other").first;
+    auto late = f.add("late", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0).first;
+
+    auto responses = f.subscribeObject(late, root, {privilege}, true);
+
+    ASSERT_LE(2u, responses.size());
+    auto message = static_cast<::certi::NM_Discover_Objects*>(responses.front().message());
+    ASSERT_EQ(::certi::NetworkMessage::Type::DISCOVER_OBJECTS, message->getMessageType());
+    EXPECT_EQ(std::vector<::certi::Socket*>({s.getSocketLink(federation_handle, late)}),
+              responses.front().sockets());
+
+    EXPECT_EQ(std::vector<ObjectHandle>({object, other}), message->getObjects());
+    // discovered as the subscribed class
+    EXPECT_EQ(std::vector<ObjectClassHandle>({root, root}), message->getObjectClasses());
+    EXPECT_EQ(std::vector<std::string>({"object", "other"}), message->getObjectNames());
+
+    for (auto& response : responses) {
+        EXPECT_NE(::certi::NetworkMessage::Type::DISCOVER_OBJECT, response.message()->getMessageType());
+    }
+}
+
+TEST_F(ObjectRoutingTest, NothingToDiscoverSendsNoDiscoverMessage)
+{
+    auto responses = f.subscribeObject(publisher, root, {privilege}, true);
+
+    for (auto& response : responses) {
+        EXPECT_NE(::certi::NetworkMessage::Type::DISCOVER_OBJECTS, response.message()->getMessageType());
+    }
+}
+
+TEST_F(ObjectRoutingTest, CompressedValuesAreForwardedAsIsOnlyToFederatesWhichNegotiatedIt)
+{
+    if (!::certi::ValueCompression::isAvailable()) {
+        return;
+    }
+
+    MockSocketTcp compressing_socket;
+    auto compressing = f.add("compressing", "type", {}, ::certi::HLA_1_3, &compressing_socket, 0, 0, true).first;
+    f.subscribeObject(compressing, data, {attr1, attr2}, true);
+
+    const std::string large(1024, 'x');
+    ::certi::NM_Update_Attribute_Values request;
+    request.setObject(object);
+    request.setAttributesSize(2);
+    request.setValuesSize(2);
+    request.setAttributes(attr1, 0);
+    request.setValues({'1'}, 0);
+    request.setAttributes(attr2, 1);
+    request.setValues({large.begin(), large.end()}, 1);
+
+    ::certi::ValueCompression sender(64);
+    sender.compress(request);
+    ASSERT_EQ(2u, request.getRawSizesSize());
+
+    ::certi::ValueCompression rtig;
+    auto responses = f.forwardCompressedValues(
+        f.updateAttributeValues(publisher, object, request.getAttributes(), request.getValues(), ""), request, rtig);
+
+    auto compressing_link = s.getSocketLink(federation_handle, compressing);
+    std::map<FederateHandle, const ::certi::NM_Reflect_Attribute_Values*> received;
+    for (auto& response : responses) {
+        auto message = static_cast<::certi::NM_Reflect_Attribute_Values*>(response.message());
+        for (auto socket : response.sockets()) {
+            received[socket == compressing_link ? compressing : federateOf(socket)] = message;
+        }
+    }
+
+    auto compressed = received[compressing];
+    ASSERT_TRUE(compressed);
+    EXPECT_EQ(std::vector<AttributeHandle>({attr1, attr2}), compressed->getAttributes());
+    EXPECT_EQ(std::vector<uint32_t>({0, 1024}), compressed->getRawSizes());
+    EXPECT_EQ(request.getValues(1), compressed->getValues(1));
+
+    auto plain = received[all_subscriber];
+    ASSERT_TRUE(plain);
+    EXPECT_EQ(0u, plain->getRawSizesSize());
+    EXPECT_EQ(std::vector<char>(large.begin(), large.end()), plain->getValues(1));
+    EXPECT_EQ(1u, rtig.statistics().decompressed);
+}
+
+TEST_F(ObjectRoutingTest, BatchIsReflectedInOneMessagePerSubscriber)
+{
+    auto other = f.registerObject(publisher, data, "other").first;
+
+    ::certi::NM_Batch_Update_Attribute_Values request;
+    request.setLabel("batch");
+    request.setObjectsSize(2);
+    request.setAttributeCountsSize(2);
+    request.setObjects(object, 0);
+    request.setAttributeCounts(2, 0);
+    request.setObjects(other, 1);
+    request.setAttributeCounts(1, 1);
+    request.setAttributesSize(3);
+    request.setValuesSize(3);
+    request.setAttributes(privilege, 0);
+    request.setValues({'p'}, 0);
+    request.setAttributes(attr1, 1);
+    request.setValues({'1'}, 1);
+    request.setAttributes(attr2, 2);
+    request.setValues({'2'}, 2);
+
+    ::certi::ValueCompression compression;
+    std::map<FederateHandle, const ::certi::NM_Batch_Reflect_Attribute_Values*> received;
+    auto responses = f.updateAttributeValues(publisher, request, compression);
+    for (auto& response : responses) {
+        ASSERT_EQ(::certi::NetworkMessage::Type::BATCH_REFLECT_ATTRIBUTE_VALUES,
+                  response.message()->getMessageType());
+        ASSERT_EQ(1u, response.sockets().size());
+        auto federate = federateOf(response.sockets().front());
+        EXPECT_EQ(0u, received.count(federate)) << "federate " << federate << " reflected twice";
+        received[federate] = static_cast<::certi::NM_Batch_Reflect_Attribute_Values*>(response.message());
+    }
+
+    ASSERT_EQ(3u, received.size());
+    EXPECT_EQ(std::vector<ObjectHandle>({object}), received[root_subscriber]->getObjects());
+    EXPECT_EQ(std::vector<AttributeHandle>({privilege}), received[root_subscriber]->getAttributes());
+    EXPECT_EQ(std::vector<AttributeHandle>({attr1}), received[attr1_subscriber]->getAttributes());
+
+    auto all = received[all_subscriber];
+    EXPECT_EQ(std::vector<ObjectHandle>({object, other}), all->getObjects());
+    EXPECT_EQ(std::vector<uint32_t>({2, 1}), all->getAttributeCounts());
+    EXPECT_EQ(std::vector<AttributeHandle>({privilege, attr1, attr2}), all->getAttributes());
+    EXPECT_EQ(std::vector<char>({'2'}), all->getValues(2));
+    EXPECT_EQ("batch", all->getLabel());
+    EXPECT_FALSE(all->isDated());
+}
+
+TEST_F(ObjectRoutingTest, InconsistentBatchIsRefused)
+{
+    ::certi::NM_Batch_Update_Attribute_Values request;
+    request.setObjectsSize(1);
+    request.setAttributeCountsSize(1);
+    request.setObjects(object, 0);
+    request.setAttributeCounts(2, 0);
+    request.setAttributesSize(1);
+    request.setValuesSize(1);
+    request.setAttributes(attr1, 0);
+
+    ::certi::ValueCompression compression;
+    EXPECT_THROW(f.updateAttributeValues(publisher, request, compression), ::certi::RTIinternalError);
+}
+
+TEST_F(ObjectRoutingTest, PeerRouteGroupsSubscribersByAttributes)
+{
+    f.subscribeObject(root_subscriber, root, {}, false);
+    f.subscribeObject(attr1_subscriber, data, {}, false);
+    f.subscribeObject(all_subscriber, data, {}, false);
+    f.subscribeObject(all_subscriber, root, {}, false);
+
+    auto sender = addPeerPublisher();
+    auto first = f.add("first", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0, false, 4001).first;
+    auto second = f.add("second", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0, false, 4002).first;
+    auto both = f.add("both", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0, false, 4003).first;
+    f.subscribeObject(first, data, {attr1}, true);
+    f.subscribeObject(second, data, {attr1}, true);
+    f.subscribeObject(both, data, {attr1, attr2}, true);
+
+    auto message = peerRoute(sender.first, sender.second);
+    ASSERT_TRUE(message);
+    EXPECT_EQ(sender.second, message->getObject());
+    EXPECT_EQ(std::vector<uint32_t>({attr1, attr2}), message->getKeys());
+
+    ::certi::PeerRoutes routes;
+    routes.install(*message);
+    auto route = routes.find(sender.second, {attr2, attr1});
+    ASSERT_NE(nullptr, route);
+
+    std::map<FederateHandle, std::pair<uint32_t, std::vector<uint32_t>>> received;
+    for (const auto& group : *route) {
+        for (const auto& endpoint : group.endpoints) {
+            received[endpoint.federate] = {endpoint.port, group.handles};
+        }
+    }
+    ASSERT_EQ(3u, received.size());
+    EXPECT_EQ(4001u, received[first].first);
+    EXPECT_EQ(std::vector<uint32_t>({attr1}), received[first].second);
+    EXPECT_EQ(4002u, received[second].first);
+    EXPECT_EQ(std::vector<uint32_t>({attr1}), received[second].second);
+    EXPECT_EQ(4003u, received[both].first);
+    EXPECT_EQ(std::vector<uint32_t>({attr1, attr2}), received[both].second);
+}
+
+TEST_F(ObjectRoutingTest, NoPeerRouteThroughFederateWithoutPeerPort)
+{
+    auto sender = addPeerPublisher();
+
+    EXPECT_FALSE(peerRoute(sender.first, sender.second));
+    EXPECT_TRUE(f.invalidatePeerRoutes().empty());
+}
+
+TEST_F(ObjectRoutingTest, PeerRoutesAreInvalidatedAtTheirHoldersOnly)
+{
+    f.subscribeObject(root_subscriber, root, {}, false);
+    f.subscribeObject(attr1_subscriber, data, {}, false);
+    f.subscribeObject(all_subscriber, data, {}, false);
+    f.subscribeObject(all_subscriber, root, {}, false);
+
+    auto sender = addPeerPublisher();
+    auto peer = f.add("peer", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0, false, 4001).first;
+    f.subscribeObject(peer, data, {attr1}, true);
+
+    ASSERT_TRUE(peerRoute(sender.first, sender.second));
+
+    auto responses = f.invalidatePeerRoutes();
+    ASSERT_EQ(1u, responses.size());
+    EXPECT_EQ(::certi::NetworkMessage::Type::PEER_ROUTES_INVALIDATED, responses.front().message()->getMessageType());
+    EXPECT_EQ(std::vector<::certi::Socket*>({s.getSocketLink(federation_handle, sender.first)}),
+              responses.front().sockets());
+
+    EXPECT_TRUE(f.invalidatePeerRoutes().empty());
+}
+
+TEST_F(ObjectRoutingTest, NoPeerRouteUntilEveryHolderStoppedUsingItsRoutes)
+{
+    f.subscribeObject(root_subscriber, root, {}, false);
+    f.subscribeObject(attr1_subscriber, data, {}, false);
+    f.subscribeObject(all_subscriber, data, {}, false);
+    f.subscribeObject(all_subscriber, root, {}, false);
+
+    auto sender = addPeerPublisher();
+    auto peer = f.add("peer", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0, false, 4001).first;
+    f.subscribeObject(peer, data, {attr1}, true);
+    ASSERT_TRUE(peerRoute(sender.first, sender.second));
+
+    // the requester dropped its routes itself and is not waited for
+    EXPECT_TRUE(f.invalidatePeerRoutes(sender.first).empty());
+    EXPECT_FALSE(f.awaitsPeerRoutes());
+
+    ASSERT_TRUE(peerRoute(sender.first, sender.second));
+    EXPECT_EQ(1u, f.invalidatePeerRoutes(peer).size());
+    EXPECT_TRUE(f.awaitsPeerRoutes());
+    EXPECT_FALSE(peerRoute(sender.first, sender.second));
+
+    f.peerRoutesInvalidated(sender.first);
+    EXPECT_FALSE(f.awaitsPeerRoutes());
+    EXPECT_TRUE(peerRoute(sender.first, sender.second));
+}
+
+TEST_F(ObjectRoutingTest, PeerFenceIsRelayedToTheListedPeersStillJoined)
+{
+    auto sender = addPeerPublisher();
+    auto peer = f.add("peer", "type", {}, ::certi::HLA_1_3, &federate_socket, 0, 0, false, 4001).first;
+
+    ::certi::NM_Peer_Fence fence;
+    fence.setFederate(sender.first);
+    fence.setEpoch(3);
+    fence.setClosing(true);
+    fence.setPeersSize(2);
+    fence.setPeers(peer, 0);
+    fence.setPeers(peer + 100, 1);
+
+    auto responses = f.relayPeerFence(fence);
+    ASSERT_EQ(1u, responses.size());
+    EXPECT_EQ(std::vector<::certi::Socket*>({s.getSocketLink(federation_handle, peer)}), responses.front().sockets());
+    auto relayed = static_cast<::certi::NM_Peer_Fence*>(responses.front().message());
+    EXPECT_EQ(sender.first, relayed->getFederate());
+    EXPECT_EQ(3u, relayed->getEpoch());
+    EXPECT_TRUE(relayed->getClosing());
+
+    fence.setPeersSize(1);
+    fence.setPeers(peer + 100, 0);
+    EXPECT_TRUE(f.relayPeerFence(fence).empty());
+}
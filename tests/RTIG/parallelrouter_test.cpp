@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <RTIG/ParallelRouter.hh>
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/NM_Classes.hh>
+
+using ::certi::NetworkMessage;
+using ::certi::Responses;
+using ::certi::rtig::ParallelRouter;
+
+namespace {
+/// An update of object, from federate
+std::unique_ptr<NetworkMessage> update(const ::certi::FederateHandle federate, const ::certi::ObjectHandle object)
+{
+    auto message = std::unique_ptr<::certi::NM_Update_Attribute_Values>(new ::certi::NM_Update_Attribute_Values);
+    message->setFederate(federate);
+    message->setObject(object);
+    return message;
+}
+
+/// One reflection of the update, to nobody
+Responses reflect(const NetworkMessage& request)
+{
+    auto reflection = std::unique_ptr<::certi::NM_Reflect_Attribute_Values>(new ::certi::NM_Reflect_Attribute_Values);
+    reflection->setObject(static_cast<const ::certi::NM_Update_Attribute_Values&>(request).getObject());
+    Responses responses;
+    responses.emplace_back(std::vector<::certi::Socket*>{}, std::move(reflection));
+    return responses;
+}
+
+::certi::ObjectHandle reflectedObject(const ParallelRouter::Job& job)
+{
+    return static_cast<const ::certi::NM_Reflect_Attribute_Values*>(job.responses.front().message())->getObject();
+}
+}
+
+TEST(ParallelRouterTest, NoRouterByDefault)
+{
+    EXPECT_EQ(0u, ParallelRouter::routersFromEnvironment());
+}
+
+TEST(ParallelRouterTest, NothingToComplete)
+{
+    ParallelRouter router{2, reflect};
+    EXPECT_TRUE(router.isIdle());
+
+    int completed{0};
+    router.complete([&completed](ParallelRouter::Job&) { ++completed; });
+    EXPECT_EQ(0, completed);
+    EXPECT_EQ(0u, router.statistics().batches);
+}
+
+TEST(ParallelRouterTest, RequestsAreCompletedInDispatchOrder)
+{
+    // the first requests take the longest to route
+    ParallelRouter router{3, [](const NetworkMessage& request) {
+                              const auto object = static_cast<const ::certi::NM_Update_Attribute_Values&>(request)
+                                                      .getObject();
+                              std::this_thread::sleep_for(std::chrono::microseconds(100 * (64 - object)));
+                              return reflect(request);
+                          }};
+
+    for (::certi::ObjectHandle object = 0; object < 64; ++object) {
+        router.dispatch({nullptr, update(object % 4 + 1, object)}, nullptr, object);
+    }
+    EXPECT_FALSE(router.isIdle());
+
+    std::vector<::certi::ObjectHandle> completed;
+    router.complete([&completed](ParallelRouter::Job& job) {
+        ASSERT_FALSE(job.error);
+        EXPECT_EQ(job.trace, reflectedObject(job));
+        completed.push_back(reflectedObject(job));
+    });
+
+    ASSERT_EQ(64u, completed.size());
+    for (::certi::ObjectHandle object = 0; object < 64; ++object) {
+        EXPECT_EQ(object, completed[object]);
+    }
+    EXPECT_TRUE(router.isIdle());
+    EXPECT_EQ(64u, router.statistics().routed);
+    EXPECT_EQ(1u, router.statistics().batches);
+    EXPECT_EQ(64u, router.statistics().largest_batch);
+}
+
+TEST(ParallelRouterTest, RoutingErrorsAreHandedToCompletion)
+{
+    ParallelRouter router{2, [](const NetworkMessage& request) {
+                              if (request.getFederate() == 2) {
+                                  throw ::certi::AttributeNotOwned("not the owner");
+                              }
+                              return reflect(request);
+                          }};
+
+    router.dispatch({nullptr, update(1, 10)}, nullptr, 0);
+    router.dispatch({nullptr, update(2, 20)}, nullptr, 0);
+    router.dispatch({nullptr, update(1, 30)}, nullptr, 0);
+
+    std::vector<bool> failed;
+    router.complete([&failed](ParallelRouter::Job& job) {
+        failed.push_back(static_cast<bool>(job.error));
+        if (job.error) {
+            EXPECT_TRUE(job.responses.empty());
+            EXPECT_THROW(std::rethrow_exception(job.error), ::certi::AttributeNotOwned);
+        }
+    });
+
+    EXPECT_EQ(std::vector<bool>({false, true, false}), failed);
+}
+
+TEST(ParallelRouterTest, RequestsAreRoutedAtOnce)
+{
+    // each routing waits for another one to start, which only several threads allow
+    std::atomic<int> routing{0};
+    std::atomic<int> overlapped{0};
+    ParallelRouter router{2, [&routing, &overlapped](const NetworkMessage& request) {
+                              ++routing;
+                              const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                              while (routing < 2 && std::chrono::steady_clock::now() < deadline) {
+                                  std::this_thread::yield();
+                              }
+                              if (routing >= 2) {
+                                  ++overlapped;
+                              }
+                              return reflect(request);
+                          }};
+
+    router.dispatch({nullptr, update(1, 1)}, nullptr, 0);
+    router.dispatch({nullptr, update(2, 2)}, nullptr, 0);
+
+    int completed{0};
+    router.complete([&completed](ParallelRouter::Job& job) {
+        EXPECT_FALSE(job.error);
+        ++completed;
+    });
+
+    EXPECT_EQ(2, completed);
+    EXPECT_EQ(2, overlapped);
+}
+
+TEST(ParallelRouterTest, CallerRoutesWithoutRouter)
+{
+    ParallelRouter router{0, reflect};
+
+    router.dispatch({nullptr, update(1, 7)}, nullptr, 0);
+
+    std::vector<::certi::ObjectHandle> completed;
+    router.complete([&completed](ParallelRouter::Job& job) { completed.push_back(reflectedObject(job)); });
+
+    EXPECT_EQ(std::vector<::certi::ObjectHandle>({7}), completed);
+    EXPECT_EQ(1u, router.statistics().routed_by_caller);
+}
+
+TEST(ParallelRouterTest, DispatchedDuringCompletionIsCompletedNext)
+{
+    ParallelRouter router{1, reflect};
+
+    router.dispatch({nullptr, update(1, 1)}, nullptr, 0);
+
+    std::vector<::certi::ObjectHandle> completed;
+    router.complete([&](ParallelRouter::Job& job) {
+        completed.push_back(reflectedObject(job));
+        router.dispatch({nullptr, update(1, 2)}, nullptr, 0);
+    });
+    EXPECT_EQ(1u, completed.size());
+    EXPECT_FALSE(router.isIdle());
+
+    router.complete([&](ParallelRouter::Job& job) { completed.push_back(reflectedObject(job)); });
+    EXPECT_EQ(std::vector<::certi::ObjectHandle>({1, 2}), completed);
+}
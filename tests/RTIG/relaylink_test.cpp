@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <RTIG/RelayLink.hh>
+#include <RTIG/SendPipeline.hh>
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/SocketServer.hh>
+#include <libCERTI/SocketTCP.hh>
+
+using ::certi::NetworkMessage;
+using ::certi::rtig::RelayChannel;
+using ::certi::rtig::RelayLink;
+using ::certi::rtig::SendPipeline;
+
+namespace {
+/// Keeps what is written to it, as the link of a relay.
+class RecordingSocket : public ::certi::SocketTCP {
+public:
+    void send(const unsigned char* data, size_t size) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (failing) {
+            throw ::certi::NetworkError("broken");
+        }
+        written.emplace_back(reinterpret_cast<const char*>(data), size);
+    }
+
+    std::vector<std::string> received()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return written;
+    }
+
+    std::mutex mutex;
+    std::vector<std::string> written;
+    bool failing{false};
+};
+
+std::unique_ptr<NetworkMessage> nullMessage(const ::certi::FederateHandle federate)
+{
+    std::unique_ptr<NetworkMessage> message(new ::certi::NM_Message_Null);
+    message->setFederation(1);
+    message->setFederate(federate);
+    return message;
+}
+
+std::string serialized(NetworkMessage& message)
+{
+    libhla::MessageBuffer buffer;
+    message.serialize(buffer);
+    buffer.updateReservedBytes();
+    return {static_cast<const char*>(buffer(0)), buffer.size()};
+}
+
+/// Read the message written in bytes.
+std::unique_ptr<NetworkMessage> read(const std::string& bytes)
+{
+    libhla::MessageBuffer buffer;
+    buffer.resize(bytes.size());
+    memcpy(buffer(0), bytes.data(), bytes.size());
+    buffer.assumeSizeFromReservedBytes();
+    NetworkMessage generic;
+    generic.deserialize(buffer);
+    std::unique_ptr<NetworkMessage> message(::certi::NM_Factory::create(generic.getMessageType()));
+    buffer.assumeSizeFromReservedBytes();
+    message->deserialize(buffer);
+    return message;
+}
+
+std::string payload(const NetworkMessage& message)
+{
+    auto& data = static_cast<const ::certi::NM_Relay_Data&>(message).getPayload();
+    return {data.data(), data.size()};
+}
+}
+
+TEST(RelayLinkTest, ChannelsHaveDistinctDescriptorsWhichAreNotWaitedOn)
+{
+    RecordingSocket upstream;
+    RelayLink relay(&upstream);
+    ::certi::SocketTCP server;
+    ::certi::SocketServer links(&server, nullptr);
+
+    auto first = relay.open(1);
+    auto second = relay.open(2);
+    links.open(first);
+    links.open(second);
+
+    EXPECT_LT(first->returnSocket(), 0);
+    EXPECT_LT(second->returnSocket(), 0);
+    EXPECT_NE(first->returnSocket(), second->returnSocket());
+    EXPECT_EQ(first, relay.find(1));
+    EXPECT_EQ(nullptr, relay.find(3));
+    EXPECT_THROW(relay.open(2), ::certi::RTIinternalError);
+
+    fd_set fd;
+    FD_ZERO(&fd);
+    EXPECT_EQ(0, links.addToFDSet(&fd));
+    EXPECT_EQ(nullptr, links.getActiveSocket(&fd));
+
+    // the tuples own the channels
+    relay.detach();
+}
+
+TEST(RelayLinkTest, RelayedMessageIsUnwrapped)
+{
+    RecordingSocket upstream;
+    RelayLink relay(&upstream);
+
+    auto message = nullMessage(4);
+    ::certi::NM_Relay_Data data;
+    data.setChannelsSize(1);
+    data.setChannels(1, 0);
+    const auto bytes = serialized(*message);
+    data.setPayload(::certi::AttributeValue_t(begin(bytes), end(bytes)));
+
+    auto unwrapped = relay.unwrap(data);
+    EXPECT_EQ(NetworkMessage::Type::MESSAGE_NULL, unwrapped->getMessageType());
+    EXPECT_EQ(4u, unwrapped->getFederate());
+    EXPECT_EQ(1u, unwrapped->getFederation());
+
+    data.setPayload({'\x00', '\x01'});
+    EXPECT_THROW(relay.unwrap(data), ::certi::NetworkError);
+}
+
+TEST(RelayLinkTest, MessageToChannelsOfARelayIsWrittenOnceWithTheirList)
+{
+    RecordingSocket upstream;
+    RecordingSocket direct;
+    RelayLink relay(&upstream);
+    std::unique_ptr<RelayChannel> first(relay.open(1));
+    std::unique_ptr<RelayChannel> second(relay.open(2));
+    std::unique_ptr<RelayChannel> third(relay.open(3));
+
+    {
+        SendPipeline pipeline(2);
+        auto message = nullMessage(7);
+        const auto expected = serialized(*message);
+        pipeline.push({first.get(), &direct, third.get()}, std::move(message), nullptr);
+        pipeline.drain();
+
+        EXPECT_EQ(std::vector<std::string>({expected}), direct.received());
+        ASSERT_EQ(1u, upstream.received().size());
+        auto envelope = read(upstream.received().front());
+        ASSERT_EQ(NetworkMessage::Type::RELAY_DATA, envelope->getMessageType());
+        EXPECT_EQ(std::vector<uint32_t>({1, 3}), static_cast<::certi::NM_Relay_Data&>(*envelope).getChannels());
+        EXPECT_EQ(expected, payload(*envelope));
+    }
+
+    relay.detach();
+}
+
+TEST(RelayLinkTest, FailedRelayFailsAllItsChannels)
+{
+    RecordingSocket upstream;
+    RelayLink relay(&upstream);
+    std::unique_ptr<RelayChannel> first(relay.open(1));
+    std::unique_ptr<RelayChannel> second(relay.open(2));
+    upstream.failing = true;
+
+    SendPipeline pipeline(1);
+    pipeline.push({first.get(), second.get()}, nullMessage(1), nullptr);
+    pipeline.drain();
+
+    auto failed = pipeline.takeFailedSockets();
+    std::sort(begin(failed), end(failed));
+    std::vector<::certi::Socket*> expected{first.get(), second.get()};
+    std::sort(begin(expected), end(expected));
+    EXPECT_EQ(expected, failed);
+
+    // nothing more is written once a write failed
+    upstream.failing = false;
+    first->send(reinterpret_cast<const unsigned char*>("x"), 1);
+    EXPECT_TRUE(upstream.received().empty());
+}
+
+TEST(RelayLinkTest, ClosedChannelIsToldToTheRelay)
+{
+    RecordingSocket upstream;
+    RelayLink relay(&upstream);
+    auto channel = relay.open(5);
+
+    delete channel;
+
+    EXPECT_EQ(nullptr, relay.find(5));
+    ASSERT_EQ(1u, upstream.received().size());
+    auto message = read(upstream.received().front());
+    ASSERT_EQ(NetworkMessage::Type::RELAY_CLOSE, message->getMessageType());
+    EXPECT_EQ(5u, static_cast<::certi::NM_Relay_Close&>(*message).getChannel());
+}
@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <RTIG/MessageStatistics.hh>
+#include <RTIG/SendPipeline.hh>
+
+#include <libCERTI/Exception.hh>
+#include <libCERTI/NM_Classes.hh>
+#include <libCERTI/SocketTCP.hh>
+
+using ::certi::NetworkMessage;
+using ::certi::rtig::MessageStatistics;
+using ::certi::rtig::SendPipeline;
+
+namespace {
+/// Keeps what is written to it, may fail or hold writes back.
+class RecordingSocket : public ::certi::SocketTCP {
+public:
+    void send(const unsigned char* data, size_t size) override
+    {
+        while (held) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        ++attempts;
+        if (failing) {
+            throw ::certi::NetworkError("broken");
+        }
+        written.emplace_back(reinterpret_cast<const char*>(data), size);
+    }
+
+    std::vector<std::string> received()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return written;
+    }
+
+    std::mutex mutex;
+    std::vector<std::string> written;
+    size_t attempts{0};
+    bool failing{false};
+    std::atomic<bool> held{false};
+};
+
+/// Queues the writes until drained.
+class QueuingBatch : public SendPipeline::BatchWriter {
+public:
+    void write(::certi::Socket* socket, const unsigned char* data, const size_t size) override
+    {
+        queued.emplace_back(socket, std::string(reinterpret_cast<const char*>(data), size));
+    }
+
+    bool isBusy(::certi::Socket* socket) const override
+    {
+        for (const auto& write : queued) {
+            if (write.first == socket) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void drain() override
+    {
+        for (const auto& write : queued) {
+            write.first->send(reinterpret_cast<const unsigned char*>(write.second.data()), write.second.size());
+        }
+        queued.clear();
+    }
+
+    std::vector<::certi::Socket*> takeFailedSockets() override
+    {
+        return {};
+    }
+
+    std::vector<std::pair<::certi::Socket*, std::string>> queued;
+};
+
+std::unique_ptr<NetworkMessage> nullMessage(const ::certi::FederateHandle federate)
+{
+    std::unique_ptr<NetworkMessage> message(new ::certi::NM_Message_Null);
+    message->setFederation(1);
+    message->setFederate(federate);
+    return message;
+}
+
+std::string serialized(const ::certi::FederateHandle federate)
+{
+    libhla::MessageBuffer buffer;
+    nullMessage(federate)->serialize(buffer);
+    buffer.updateReservedBytes();
+    return {static_cast<const char*>(buffer(0)), buffer.size()};
+}
+}
+
+TEST(SendPipelineTest, NoWriterWritesWhilePushing)
+{
+    SendPipeline pipeline(0);
+    RecordingSocket socket;
+
+    pipeline.push({&socket, nullptr}, nullMessage(1), nullptr);
+
+    EXPECT_EQ(0u, pipeline.writers());
+    EXPECT_EQ(std::vector<std::string>({serialized(1)}), socket.received());
+    EXPECT_FALSE(pipeline.isBusy(&socket));
+}
+
+TEST(SendPipelineTest, BatchQueuesWritesUntilDrained)
+{
+    SendPipeline pipeline(0);
+    QueuingBatch batch;
+    pipeline.batchWrites(&batch);
+    RecordingSocket first;
+    RecordingSocket second;
+
+    pipeline.push({&first, &second}, nullMessage(1), nullptr);
+    pipeline.push({&first}, nullMessage(2), nullptr);
+
+    EXPECT_EQ(3u, batch.queued.size());
+    EXPECT_TRUE(first.received().empty());
+    EXPECT_TRUE(pipeline.isBusy(&first));
+
+    pipeline.drain();
+    EXPECT_EQ(std::vector<std::string>({serialized(1), serialized(2)}), first.received());
+    EXPECT_EQ(std::vector<std::string>({serialized(1)}), second.received());
+    EXPECT_FALSE(pipeline.isBusy(&first));
+
+    pipeline.batchWrites(nullptr);
+    pipeline.push({&second}, nullMessage(3), nullptr);
+    EXPECT_EQ(std::vector<std::string>({serialized(1), serialized(3)}), second.received());
+}
+
+TEST(SendPipelineTest, WritersIgnoreBatch)
+{
+    SendPipeline pipeline(1);
+    QueuingBatch batch;
+    pipeline.batchWrites(&batch);
+    RecordingSocket socket;
+
+    pipeline.push({&socket}, nullMessage(1), nullptr);
+    pipeline.drain();
+
+    EXPECT_TRUE(batch.queued.empty());
+    EXPECT_EQ(std::vector<std::string>({serialized(1)}), socket.received());
+}
+
+TEST(SendPipelineTest, EachSocketIsWrittenInPushOrder)
+{
+    SendPipeline pipeline(3);
+    RecordingSocket sockets[5];
+    std::vector<std::string> expected[5];
+
+    for (uint32_t i = 1; i <= 200; ++i) {
+        std::vector<::certi::Socket*> destinations;
+        for (uint32_t s = 0; s < 5; ++s) {
+            if ((i + s) % (s + 2) != 0) {
+                destinations.push_back(&sockets[s]);
+                expected[s].push_back(serialized(i));
+            }
+        }
+        pipeline.push(destinations, nullMessage(i), nullptr);
+    }
+    pipeline.drain();
+
+    for (uint32_t s = 0; s < 5; ++s) {
+        EXPECT_EQ(expected[s], sockets[s].received()) << "socket " << s;
+    }
+}
+
+TEST(SendPipelineTest, SocketIsBusyUntilWritten)
+{
+    SendPipeline pipeline(1);
+    RecordingSocket socket;
+    RecordingSocket other;
+
+    socket.held = true;
+    pipeline.push({&socket}, nullMessage(1), nullptr);
+    EXPECT_TRUE(pipeline.isBusy(&socket));
+    EXPECT_FALSE(pipeline.isBusy(&other));
+
+    socket.held = false;
+    pipeline.drain();
+    EXPECT_FALSE(pipeline.isBusy(&socket));
+}
+
+TEST(SendPipelineTest, FailedSocketIsReportedOnceThenSkipped)
+{
+    SendPipeline pipeline(2);
+    RecordingSocket broken;
+    RecordingSocket healthy;
+    broken.failing = true;
+
+    pipeline.push({&broken, &healthy}, nullMessage(1), nullptr);
+    pipeline.push({&broken, &healthy}, nullMessage(2), nullptr);
+    pipeline.drain();
+
+    EXPECT_EQ(std::vector<::certi::Socket*>({&broken}), pipeline.takeFailedSockets());
+    EXPECT_TRUE(pipeline.takeFailedSockets().empty());
+    EXPECT_EQ(1u, broken.attempts);
+    EXPECT_EQ(2u, healthy.received().size());
+
+    // a forgotten socket starts afresh
+    pipeline.forget(&broken);
+    broken.failing = false;
+    pipeline.push({&broken}, nullMessage(3), nullptr);
+    pipeline.drain();
+    EXPECT_EQ(std::vector<std::string>({serialized(3)}), broken.received());
+}
+
+TEST(SendPipelineTest, RecordIsCollectedOnceWrittenAndReleased)
+{
+    SendPipeline pipeline(2);
+    MessageStatistics statistics;
+    RecordingSocket first;
+    RecordingSocket second;
+
+    auto record = pipeline.record(NetworkMessage::Type::MESSAGE_NULL, 1);
+    pipeline.push({&first, &second}, nullMessage(1), record);
+    record.reset();
+    pipeline.drain();
+    pipeline.collect(statistics);
+
+    auto entry = statistics.forType(NetworkMessage::Type::MESSAGE_NULL);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ(1u, entry->fanout.count());
+    EXPECT_EQ(2u, entry->fanout.max());
+    EXPECT_EQ(2 * serialized(1).size(), entry->bytes_sent.sum());
+
+    pipeline.collect(statistics);
+    EXPECT_EQ(1u, statistics.forType(NetworkMessage::Type::MESSAGE_NULL)->fanout.count());
+}
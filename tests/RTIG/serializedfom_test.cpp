@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <libCERTI/RootObject.hh>
+#include <libCERTI/fed.hh>
+#include <libHLA/MessageBuffer.hh>
+
+#include "RTIG/SerializedFom.hh"
+
+#include "temporaryfedfile.h"
+
+using ::certi::NM_Additional_Fom_Module;
+using ::certi::NM_Join_Federation_Execution;
+using ::certi::RootObject;
+using ::certi::rtig::SerializedFom;
+
+class SerializedFomTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(0, ::certi::fedparser::build(tmp.path().c_str(), &root, false));
+    }
+
+    TemporaryFedFile tmp{"SerializedFom.fed"};
+    RootObject root{};
+    SerializedFom fom{root};
+};
+
+TEST_F(SerializedFomTest, ConvertsOnlyOnce)
+{
+    EXPECT_FALSE(fom.isValid());
+
+    fom.makeJoinResponse();
+    fom.makeAdditionalFomModule();
+    fom.makeJoinResponse();
+
+    EXPECT_TRUE(fom.isValid());
+    EXPECT_EQ(1u, fom.conversions());
+}
+
+TEST_F(SerializedFomTest, InvalidateConvertsAgain)
+{
+    fom.encoded();
+    fom.invalidate();
+    EXPECT_FALSE(fom.isValid());
+
+    fom.encoded();
+    EXPECT_EQ(2u, fom.conversions());
+}
+
+TEST_F(SerializedFomTest, FieldsMatchRootObject)
+{
+    NM_Join_Federation_Execution expected;
+    root.convertToSerializedFOM(expected);
+
+    EXPECT_EQ(expected.getObjectClassesSize(), fom.fields().getObjectClassesSize());
+    EXPECT_EQ(expected.getInteractionClassesSize(), fom.fields().getInteractionClassesSize());
+    EXPECT_EQ(expected.getRoutingSpacesSize(), fom.fields().getRoutingSpacesSize());
+}
+
+TEST_F(SerializedFomTest, CachedJoinResponseIsReadAsARegularOne)
+{
+    auto response = fom.makeJoinResponse();
+    response->setFederationExecutionName("name");
+    response->setNumberOfRegulators(3);
+
+    libhla::MessageBuffer buffer;
+    response->serialize(buffer);
+
+    NM_Join_Federation_Execution read;
+    buffer.assumeSize(buffer.size());
+    read.deserialize(buffer);
+
+    EXPECT_EQ("name", read.getFederationExecutionName());
+    EXPECT_EQ(3, read.getNumberOfRegulators());
+    ASSERT_EQ(fom.fields().getObjectClassesSize(), read.getObjectClassesSize());
+    ASSERT_EQ(fom.fields().getInteractionClassesSize(), read.getInteractionClassesSize());
+    for (uint32_t i{0}; i < read.getObjectClassesSize(); ++i) {
+        EXPECT_EQ(fom.fields().getObjectClasses(i).getName(), read.getObjectClasses(i).getName());
+        EXPECT_EQ(fom.fields().getObjectClasses(i).getAttributesSize(), read.getObjectClasses(i).getAttributesSize());
+    }
+    for (uint32_t i{0}; i < read.getInteractionClassesSize(); ++i) {
+        EXPECT_EQ(fom.fields().getInteractionClasses(i).getName(), read.getInteractionClasses(i).getName());
+    }
+}
+
+TEST_F(SerializedFomTest, CachedAdditionalModuleIsReadAsARegularOne)
+{
+    auto message = fom.makeAdditionalFomModule();
+
+    libhla::MessageBuffer buffer;
+    message->serialize(buffer);
+
+    NM_Additional_Fom_Module read;
+    read.deserialize(buffer);
+
+    EXPECT_EQ(fom.fields().getObjectClassesSize(), read.getObjectClassesSize());
+    EXPECT_EQ(fom.fields().getInteractionClassesSize(), read.getInteractionClassesSize());
+}
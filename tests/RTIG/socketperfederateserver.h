@@ -0,0 +1,39 @@
+#ifndef SOCKETPERFEDERATESERVER_H
+#define SOCKETPERFEDERATESERVER_H
+
+#include <map>
+#include <memory>
+
+#include <libCERTI/SocketServer.hh>
+
+#include "../mocks/sockettcp_mock.h"
+
+/// Give each federate its own socket, so that recipients can be told apart.
+class SocketPerFederateServer : public ::certi::SocketServer {
+public:
+    using SocketServer::SocketServer;
+
+    ::certi::Socket* getSocketLink(::certi::FederationHandle /*the_federation*/,
+                                   ::certi::FederateHandle the_federate,
+                                   ::certi::TransportType /*the_type*/ = ::certi::RELIABLE) const override
+    {
+        auto& socket = my_sockets[the_federate];
+        if (!socket) {
+            socket.reset(new ::testing::NiceMock<MockSocketTcp>);
+        }
+        return socket.get();
+    }
+
+    void setReferences(long /*the_socket*/,
+                       ::certi::FederationHandle /*federation_reference*/,
+                       ::certi::FederateHandle /*federate_reference*/,
+                       unsigned long /*the_address*/,
+                       unsigned int /*the_port*/) override
+    {
+    }
+
+private:
+    mutable std::map<::certi::FederateHandle, std::unique_ptr<MockSocketTcp>> my_sockets;
+};
+
+#endif // SOCKETPERFEDERATESERVER_H